@@ -1,6 +1,20 @@
 include("tools/build")
 require("third_party/premake-export-compile-commands/export-compile-commands")
 
+-- Opt-in profile-guided optimization, orchestrated by `xb pgo`: the project
+-- is generated and built once with --pgo=instrument, the training workloads
+-- are run, and it is then regenerated and rebuilt with --pgo=use to apply the
+-- merged profile. Only affects the Release configuration.
+newoption({
+  trigger = "pgo",
+  description = "Profile-guided optimization phase",
+  value = "PHASE",
+  allowed = {
+    { "instrument", "Build instrumented binaries that write profiles to scratch/pgo." },
+    { "use", "Optimize using the merged profile in scratch/pgo." },
+  },
+})
+
 location(build_root)
 targetdir(build_bin)
 objdir(build_obj)
@@ -88,6 +102,45 @@ filter({"configurations:Release", "platforms:Windows"})
     "/NODEFAULTLIB:MSVCRTD",
   })
 
+local pgo_dir = path.getabsolute("scratch/pgo")
+if _OPTIONS["pgo"] == "instrument" then
+  filter({"configurations:Release", "platforms:Linux"})
+    buildoptions({
+      "-fprofile-generate="..pgo_dir,
+    })
+    linkoptions({
+      "-fprofile-generate="..pgo_dir,
+    })
+  filter({"configurations:Release", "platforms:Windows"})
+    linkoptions({
+      "/GENPROFILE",  -- Writes the .pgd next to the binary, .pgc per run.
+    })
+elseif _OPTIONS["pgo"] == "use" then
+  filter({"configurations:Release", "platforms:Linux", "toolset:clang"})
+    buildoptions({
+      "-fprofile-use="..pgo_dir.."/xenia.profdata",
+      -- Code the training runs never reached is expected.
+      "-Wno-profile-instr-unprofiled",
+      "-Wno-profile-instr-out-of-date",
+    })
+    linkoptions({
+      "-fprofile-use="..pgo_dir.."/xenia.profdata",
+      -- Keep relocations so llvm-bolt can rearrange the layout post-link.
+      "-Wl,--emit-relocs",
+    })
+  filter({"configurations:Release", "platforms:Linux", "toolset:gcc"})
+    buildoptions({
+      "-fprofile-use",
+      "-fprofile-dir="..pgo_dir,
+      "-fprofile-correction",
+    })
+  filter({"configurations:Release", "platforms:Windows"})
+    linkoptions({
+      "/USEPROFILE",  -- Merges the .pgc files from the training runs.
+    })
+end
+filter({})
+
 filter("platforms:Linux")
   system("linux")
   toolset("clang")
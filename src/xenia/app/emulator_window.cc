@@ -119,6 +119,9 @@ bool EmulatorWindow::Initialize() {
       case 0x74: {  // VK_F5
         GpuClearCaches();
       } break;
+      case 0x75: {  // VK_F6
+        DumpMemoryUsage();
+      } break;
       case 0x76: {  // VK_F7
         // Save to file
         // TODO: Choose path based on user input, or from options
@@ -131,6 +134,9 @@ bool EmulatorWindow::Initialize() {
         // TODO: Spawn a new thread to do this.
         emulator()->RestoreFromFile(L"test.sav");
       } break;
+      case 0x78: {  // VK_F9
+        GpuToggleResolutionScale();
+      } break;
       case 0x7A: {  // VK_F11
         ToggleFullscreen();
       } break;
@@ -216,6 +222,9 @@ bool EmulatorWindow::Initialize() {
     cpu_menu->AddChild(MenuItem::Create(MenuItem::Type::kString,
                                         L"&Pause/Resume Profiler", L"`",
                                         []() { Profiler::TogglePause(); }));
+    cpu_menu->AddChild(MenuItem::Create(
+        MenuItem::Type::kString, L"Dump Memory &Usage", L"F6",
+        std::bind(&EmulatorWindow::DumpMemoryUsage, this)));
   }
   cpu_menu->AddChild(MenuItem::Create(MenuItem::Type::kSeparator));
   {
@@ -242,6 +251,9 @@ bool EmulatorWindow::Initialize() {
     gpu_menu->AddChild(
         MenuItem::Create(MenuItem::Type::kString, L"&Clear Caches", L"F5",
                          std::bind(&EmulatorWindow::GpuClearCaches, this)));
+    gpu_menu->AddChild(MenuItem::Create(
+        MenuItem::Type::kString, L"Toggle &Resolution Scale", L"F9",
+        std::bind(&EmulatorWindow::GpuToggleResolutionScale, this)));
   }
   main_menu->AddChild(std::move(gpu_menu));
 
@@ -407,6 +419,11 @@ void EmulatorWindow::CpuBreakIntoDebugger() {
 
 void EmulatorWindow::CpuBreakIntoHostDebugger() { xe::debugging::Break(); }
 
+void EmulatorWindow::DumpMemoryUsage() {
+  Profiler::LogMemoryCounters();
+  emulator()->memory()->DumpHeapUsage();
+}
+
 void EmulatorWindow::GpuTraceFrame() {
   emulator()->graphics_system()->RequestFrameTrace();
 }
@@ -415,6 +432,10 @@ void EmulatorWindow::GpuClearCaches() {
   emulator()->graphics_system()->ClearCaches();
 }
 
+void EmulatorWindow::GpuToggleResolutionScale() {
+  emulator()->graphics_system()->ToggleResolutionScale();
+}
+
 void EmulatorWindow::ToggleFullscreen() {
   window_->ToggleFullscreen(!window_->is_fullscreen());
 
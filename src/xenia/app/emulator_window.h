@@ -53,8 +53,10 @@ class EmulatorWindow {
   void CpuTimeScalarSetDouble();
   void CpuBreakIntoDebugger();
   void CpuBreakIntoHostDebugger();
+  void DumpMemoryUsage();
   void GpuTraceFrame();
   void GpuClearCaches();
+  void GpuToggleResolutionScale();
   void ShowHelpWebsite();
 
   Emulator* emulator_;
@@ -90,3 +90,63 @@ project("xenia-app")
       debugargs({
       })
     end
+
+group("src")
+project("xenia-benchmark")
+  uuid("8a7b62f4-32fb-4a6f-a98a-57d6b2e9df11")
+  kind("ConsoleApp")
+  language("C++")
+  links({
+    "aes_128",
+    "capstone",
+    "dxbc",
+    "glslang-spirv",
+    "imgui",
+    "libavcodec",
+    "libavutil",
+    "mspack",
+    "snappy",
+    "spirv-tools",
+    "volk",
+    "xenia-apu",
+    "xenia-apu-nop",
+    "xenia-base",
+    "xenia-core",
+    "xenia-cpu",
+    "xenia-cpu-backend-x64",
+    "xenia-gpu",
+    "xenia-gpu-null",
+    "xenia-gpu-vk",
+    "xenia-gpu-vulkan",
+    "xenia-hid",
+    "xenia-hid-nop",
+    "xenia-kernel",
+    "xenia-ui",
+    "xenia-ui-spirv",
+    "xenia-ui-vk",
+    "xenia-ui-vulkan",
+    "xenia-vfs",
+    "xxhash",
+  })
+  files({
+    "xenia_benchmark_main.cc",
+    "../base/main_"..platform_suffix..".cc",
+    "../base/main_init_"..platform_suffix..".cc",
+  })
+
+  filter("files:../base/main_init_"..platform_suffix..".cc")
+    vectorextensions("IA32")  -- Disable AVX so our AVX check doesn't use AVX instructions.
+
+  filter("platforms:Linux")
+    links({
+      "X11",
+      "xcb",
+      "X11-xcb",
+      "vulkan",
+    })
+
+  filter("platforms:Windows")
+    links({
+      "xenia-gpu-d3d12",
+      "xenia-ui-d3d12",
+    })
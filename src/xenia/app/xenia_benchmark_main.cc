@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2019 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+#include "xenia/apu/nop/nop_audio_system.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/main.h"
+#include "xenia/base/profiling.h"
+#include "xenia/base/threading.h"
+#include "xenia/config.h"
+#include "xenia/emulator.h"
+#include "xenia/gpu/null/null_graphics_system.h"
+
+DEFINE_transient_string(target, "",
+                        "Specifies the target .xex or .iso to execute.",
+                        "General");
+DEFINE_uint64(benchmark_seconds, 60,
+              "Guest seconds to run before stopping and reporting; 0 runs "
+              "until the title exits on its own.",
+              "Other");
+DEFINE_string(content_root, "", "Root path for content (save/etc) storage.",
+              "Storage");
+
+namespace xe {
+namespace app {
+
+// Headless end-to-end CPU benchmark: runs a title with the null GPU and nop
+// APU backends for a fixed amount of guest time and reports wall time and
+// translation statistics. Combined with --input_replay_file (and
+// --input_record_file to capture the session in the full emulator first),
+// a section of a real title replays deterministically enough to compare JIT
+// changes against each other.
+int benchmark_main(const std::vector<std::wstring>& args) {
+  Profiler::Initialize();
+  Profiler::ThreadEnter("main");
+
+  // Figure out where content should go, mirroring the main app so the same
+  // per-title configs and caches are picked up.
+  std::wstring content_root = xe::to_wstring(cvars::content_root);
+  std::wstring config_folder;
+  if (content_root.empty()) {
+    auto base_path = xe::filesystem::GetExecutableFolder();
+    base_path = xe::to_absolute_path(base_path);
+    auto portable_path = xe::join_paths(base_path, L"portable.txt");
+    if (xe::filesystem::PathExists(portable_path)) {
+      content_root = xe::join_paths(base_path, L"content");
+      config_folder = base_path;
+    } else {
+      content_root = xe::filesystem::GetUserFolder();
+      content_root = xe::join_paths(content_root, L"Xenia");
+      config_folder = content_root;
+      content_root = xe::join_paths(content_root, L"content");
+    }
+  }
+  content_root = xe::to_absolute_path(content_root);
+  config::SetupConfig(config_folder);
+
+  auto emulator = std::make_unique<Emulator>(L"", content_root);
+  X_STATUS result = emulator->Setup(
+      nullptr,
+      [](cpu::Processor* processor) {
+        return std::make_unique<apu::nop::NopAudioSystem>(processor);
+      },
+      []() { return std::make_unique<gpu::null::NullGraphicsSystem>(); },
+      nullptr);
+  if (XFAILED(result)) {
+    XELOGE("Failed to setup emulator: %.8X", result);
+    return 1;
+  }
+
+  std::wstring target_path;
+  if (!cvars::target.empty()) {
+    target_path = xe::to_wstring(cvars::target);
+  } else if (!args.empty()) {
+    target_path = args.back();
+  }
+  if (target_path.empty()) {
+    XELOGE("No target specified");
+    return 5;
+  }
+  target_path = xe::to_absolute_path(target_path);
+
+  uint64_t start_host_ticks = Clock::QueryHostTickCount();
+  result = emulator->LaunchPath(target_path);
+  if (XFAILED(result)) {
+    XELOGE("Failed to launch target: %.8X", result);
+    return 1;
+  }
+  uint64_t start_guest_ticks = Clock::QueryGuestTickCount();
+
+  std::atomic<bool> title_exited = {false};
+  std::thread wait_thread([&emulator, &title_exited]() {
+    emulator->WaitUntilExit();
+    title_exited = true;
+  });
+
+  uint64_t guest_deadline_ticks =
+      cvars::benchmark_seconds
+          ? start_guest_ticks +
+                cvars::benchmark_seconds * Clock::guest_tick_frequency()
+          : UINT64_MAX;
+  while (!title_exited && Clock::QueryGuestTickCount() < guest_deadline_ticks) {
+    xe::threading::Sleep(std::chrono::milliseconds(50));
+  }
+
+  uint64_t host_tick_frequency = Clock::QueryHostTickFrequency();
+  double wall_time_s =
+      double(Clock::QueryHostTickCount() - start_host_ticks) /
+      double(host_tick_frequency);
+  double guest_time_s =
+      double(Clock::QueryGuestTickCount() - start_guest_ticks) /
+      double(Clock::guest_tick_frequency());
+
+  printf("target: %s\n", xe::to_string(target_path).c_str());
+  printf("title_exited: %s\n", title_exited ? "true" : "false");
+  printf("wall_time_s: %.3f\n", wall_time_s);
+  printf("guest_time_s: %.3f\n", guest_time_s);
+  printf("functions_translated: %" PRIu64 "\n",
+         Profiler::QueryCounter("cpu/processor/functions_translated"));
+  printf("instructions_translated: %" PRIu64 "\n",
+         Profiler::QueryCounter("cpu/ppc/instructions_translated"));
+  fflush(stdout);
+
+  if (!title_exited) {
+    emulator->TerminateTitle();
+  }
+  wait_thread.join();
+
+  emulator.reset();
+  Profiler::Dump();
+  Profiler::Shutdown();
+  return 0;
+}
+
+}  // namespace app
+}  // namespace xe
+
+DEFINE_ENTRY_POINT(L"xenia-benchmark", xe::app::benchmark_main, "[target]",
+                   "target");
@@ -10,3 +10,15 @@
 #include "xenia/apu/apu_flags.h"
 
 DEFINE_bool(mute, false, "Mutes all audio output.", "APU")
+
+DEFINE_int32(apu_max_queued_frames, 64,
+             "Number of 256-sample frames the audio backend may run ahead of "
+             "playback (2 to 64). Each frame is ~5.3ms at 48kHz: low values "
+             "cut output latency for rhythm games, high values survive host "
+             "load without underruns.",
+             "APU")
+
+DEFINE_int32(apu_worker_priority, 0,
+             "Host priority of the audio worker thread that pumps driver "
+             "submissions and guest callbacks (-2 lowest to 2 highest).",
+             "APU")
@@ -12,5 +12,7 @@
 
 #include "xenia/base/cvar.h"
 DECLARE_bool(mute)
+DECLARE_int32(apu_max_queued_frames)
+DECLARE_int32(apu_worker_priority)
 
 #endif  // XENIA_APU_APU_FLAGS_H_
@@ -9,9 +9,23 @@
 
 #include "xenia/apu/audio_driver.h"
 
+#include <algorithm>
+
+#include "xenia/apu/apu_flags.h"
+
 namespace xe {
 namespace apu {
 
+AudioDriver::LatencyProfile AudioDriver::latency_profile() {
+  LatencyProfile profile;
+  profile.queued_frames = uint32_t(std::min(
+      int32_t(64), std::max(int32_t(2), cvars::apu_max_queued_frames)));
+  profile.frame_samples = 256;
+  profile.worker_priority = std::min(
+      int32_t(2), std::max(int32_t(-2), cvars::apu_worker_priority));
+  return profile;
+}
+
 AudioDriver::AudioDriver(Memory* memory) : memory_(memory) {}
 
 AudioDriver::~AudioDriver() = default;
@@ -18,11 +18,27 @@ namespace apu {
 
 class AudioDriver {
  public:
+  // Output latency tuning, resolved from the APU cvars with out-of-range
+  // values clamped. The frame size is fixed by the guest contract (titles
+  // always render 256 samples per channel per submission) and is reported
+  // here for latency math only.
+  struct LatencyProfile {
+    uint32_t queued_frames;
+    uint32_t frame_samples;
+    int32_t worker_priority;
+  };
+  static LatencyProfile latency_profile();
+
   explicit AudioDriver(Memory* memory);
   virtual ~AudioDriver();
 
   virtual void SubmitFrame(uint32_t samples_ptr) = 0;
 
+  // Measured end-to-end output latency in milliseconds, from guest submission
+  // to backend playback completion, averaged since startup. Zero until the
+  // backend has completed a buffer (or if it doesn't measure).
+  virtual double measured_latency_ms() const { return 0.0; }
+
  protected:
   inline uint8_t* TranslatePhysical(uint32_t guest_address) const {
     return memory_->TranslatePhysical(guest_address);
@@ -17,6 +17,7 @@
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/ring_buffer.h"
+#include "xenia/base/startup_timeline.h"
 #include "xenia/base/string_buffer.h"
 #include "xenia/base/threading.h"
 #include "xenia/cpu/thread_state.h"
@@ -36,6 +37,10 @@
 namespace xe {
 namespace apu {
 
+namespace {
+StatCounter count_underruns("apu/audio_system/underruns");
+}  // namespace
+
 AudioSystem::AudioSystem(cpu::Processor* processor)
     : memory_(processor->memory()),
       processor_(processor),
@@ -49,6 +54,10 @@ AudioSystem::AudioSystem(cpu::Processor* processor)
   }
   shutdown_event_ = xe::threading::Event::CreateAutoResetEvent(false);
   wait_handles_[kMaximumClientCount] = shutdown_event_.get();
+  for (size_t i = 0; i < kMaximumClientCount; ++i) {
+    submit_events_[i] = xe::threading::Event::CreateAutoResetEvent(false);
+    wait_handles_[kMaximumClientCount + 1 + i] = submit_events_[i].get();
+  }
 
   xma_decoder_ = std::make_unique<xe::apu::XmaDecoder>(processor_);
 
@@ -78,6 +87,17 @@ X_STATUS AudioSystem::Setup(kernel::KernelState* kernel_state) {
   worker_thread_->set_name("Audio Worker");
   worker_thread_->Create();
 
+  auto profile = AudioDriver::latency_profile();
+  if (profile.worker_priority != 0) {
+    worker_thread_->thread()->set_priority(profile.worker_priority);
+  }
+  // Keep the audio worker in the same last-level cache group as the rest of
+  // the emulator so it doesn't service clients across CCX/CCD boundaries.
+  uint64_t llc_affinity_mask = xe::threading::largest_llc_group_affinity_mask();
+  if (llc_affinity_mask) {
+    worker_thread_->thread()->set_affinity_mask(llc_affinity_mask);
+  }
+
   return X_STATUS_SUCCESS;
 }
 
@@ -110,12 +130,28 @@ void AudioSystem::WorkerThreadMain() {
 
     // Number of clients pumped
     bool pumped = false;
-    if (result.first == xe::threading::WaitResult::kSuccess) {
+    if (result.first == xe::threading::WaitResult::kSuccess &&
+        result.second > kMaximumClientCount) {
+      // Submit event: the guest queued a frame while the backend had nothing
+      // in flight, so no buffer completion is coming to wake us. Feed the
+      // driver without consuming a callback credit.
+      auto index = result.second - kMaximumClientCount - 1;
+
+      auto global_lock = global_critical_region_.Acquire();
+      PumpClientFrames(index, clients_[index].driver, false);
+      global_lock.unlock();
+
+      pumped = true;
+    } else if (result.first == xe::threading::WaitResult::kSuccess) {
       auto index = result.second;
 
       auto global_lock = global_critical_region_.Acquire();
       uint32_t client_callback = clients_[index].callback;
       uint32_t client_callback_arg = clients_[index].wrapped_callback_arg;
+      // Drain any frames the guest submitted since the last pass. This runs
+      // before the callback so the guest's buffer is stable: titles only
+      // refill it from inside the callback we're about to invoke.
+      PumpClientFrames(index, clients_[index].driver, true);
       global_lock.unlock();
 
       if (client_callback) {
@@ -171,8 +207,11 @@ X_STATUS AudioSystem::RegisterClient(uint32_t callback, uint32_t callback_arg,
   auto index = FindFreeClient();
   assert_true(index >= 0);
 
+  // The semaphore count is the number of frames the title may run ahead of
+  // playback, i.e. the output latency.
   auto client_semaphore = client_semaphores_[index].get();
-  auto ret = client_semaphore->Release(kMaximumQueuedFrames, nullptr);
+  auto ret = client_semaphore->Release(
+      AudioDriver::latency_profile().queued_frames, nullptr);
   assert_true(ret);
 
   AudioDriver* driver;
@@ -194,13 +233,58 @@ X_STATUS AudioSystem::RegisterClient(uint32_t callback, uint32_t callback_arg,
   return X_STATUS_SUCCESS;
 }
 
+void AudioSystem::PumpClientFrames(size_t index, AudioDriver* driver,
+                                   bool expect_frame) {
+  auto& ring = submit_rings_[index];
+  uint32_t read = ring.read_index.load(std::memory_order_relaxed);
+  uint32_t write = ring.write_index.load(std::memory_order_acquire);
+  if (read == write) {
+    if (expect_frame) {
+      // A backend buffer finished playing and the guest hadn't queued a
+      // replacement - that's an audible gap. Submit-event wakes may race a
+      // drain that already happened and are not underruns.
+      count_underruns.Increment();
+      uint32_t count = ++underrun_counts_[index];
+      if (count == 1 || count % 100 == 0) {
+        XELOGW("AudioSystem: client %zu underrun (%u total)", index, count);
+      }
+    }
+    return;
+  }
+  while (read != write) {
+    if (driver) {
+      driver->SubmitFrame(ring.frames[read % kSubmitRingSize]);
+      StartupTimeline::Mark(StartupTimeline::Phase::kFirstAudioSubmit);
+    }
+    ++read;
+  }
+  ring.read_index.store(read, std::memory_order_release);
+}
+
 void AudioSystem::SubmitFrame(size_t index, uint32_t samples_ptr) {
   SCOPE_profile_cpu_f("apu");
 
-  auto global_lock = global_critical_region_.Acquire();
   assert_true(index < kMaximumClientCount);
-  assert_true(clients_[index].driver != NULL);
-  (clients_[index].driver)->SubmitFrame(samples_ptr);
+
+  // Lock-free push; the guest audio thread must never block here. The ring is
+  // single-producer (the title's audio thread) / single-consumer (our worker
+  // thread), so unsynchronized slot writes between the two index loads are
+  // safe.
+  auto& ring = submit_rings_[index];
+  uint32_t write = ring.write_index.load(std::memory_order_relaxed);
+  uint32_t read = ring.read_index.load(std::memory_order_acquire);
+  if (write - read >= kSubmitRingSize) {
+    // Should be impossible - the semaphore handshake caps frames in flight
+    // well below the ring size. Drop rather than stall the guest.
+    XELOGW("AudioSystem: client %zu submit ring full; dropping frame", index);
+    return;
+  }
+  ring.frames[write % kSubmitRingSize] = samples_ptr;
+  ring.write_index.store(write + 1, std::memory_order_release);
+  // Wake the worker: if the backend queue has fully drained there is no
+  // buffer completion left to release the client semaphore, and without this
+  // the frame would sit in the ring forever.
+  submit_events_[index]->Set();
 }
 
 void AudioSystem::UnregisterClient(size_t index) {
@@ -212,6 +296,15 @@ void AudioSystem::UnregisterClient(size_t index) {
   memory()->SystemHeapFree(clients_[index].wrapped_callback_arg);
   clients_[index] = {0};
 
+  // Discard any frames still pending in the submit ring so a future client
+  // reusing this slot doesn't replay them. The worker drains under the global
+  // lock, so it can't be mid-pump here.
+  auto& ring = submit_rings_[index];
+  ring.read_index.store(ring.write_index.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+  submit_events_[index]->Reset();
+  underrun_counts_[index] = 0;
+
   // Drain the semaphore of its count.
   auto client_semaphore = client_semaphores_[index].get();
   xe::threading::WaitResult wait_result;
@@ -275,7 +368,8 @@ bool AudioSystem::Restore(ByteStream* stream) {
     client.in_use = true;
 
     auto client_semaphore = client_semaphores_[id].get();
-    auto ret = client_semaphore->Release(kMaximumQueuedFrames, nullptr);
+    auto ret = client_semaphore->Release(
+        AudioDriver::latency_profile().queued_frames, nullptr);
     assert_true(ret);
 
     AudioDriver* driver = nullptr;
@@ -84,11 +84,31 @@ class AudioSystem {
 
   int FindFreeClient();
 
+  // Per-client single-producer/single-consumer ring of pending frame
+  // pointers. The guest audio thread pushes in SubmitFrame without taking any
+  // lock; the worker thread drains into the driver right before invoking the
+  // client callback. Indices are free-running and wrapped on access, so
+  // (write - read) is always the queued count.
+  static const uint32_t kSubmitRingSize = uint32_t(kMaximumQueuedFrames);
+  struct SubmitRing {
+    std::atomic<uint32_t> write_index = {0};
+    std::atomic<uint32_t> read_index = {0};
+    uint32_t frames[kSubmitRingSize];
+  };
+  SubmitRing submit_rings_[kMaximumClientCount];
+  uint32_t underrun_counts_[kMaximumClientCount] = {0};
+
+  void PumpClientFrames(size_t index, AudioDriver* driver, bool expect_frame);
+
   std::unique_ptr<xe::threading::Semaphore>
       client_semaphores_[kMaximumClientCount];
+  // Set by SubmitFrame so the worker drains the ring even when the backend
+  // has nothing in flight and thus no completion coming to wake it.
+  std::unique_ptr<xe::threading::Event> submit_events_[kMaximumClientCount];
   // Event is always there in case we have no clients.
   std::unique_ptr<xe::threading::Event> shutdown_event_;
-  xe::threading::WaitHandle* wait_handles_[kMaximumClientCount + 1];
+  // Client semaphores, then the shutdown event, then the submit events.
+  xe::threading::WaitHandle* wait_handles_[kMaximumClientCount * 2 + 1];
 
   bool paused_ = false;
   threading::Fence pause_fence_;
@@ -10,6 +10,7 @@ project("xenia-apu")
     "libavcodec",
     "libavutil",
     "xenia-base",
+    "xenia-vfs",
   })
   defines({
   })
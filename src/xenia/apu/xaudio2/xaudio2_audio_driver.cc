@@ -22,23 +22,19 @@ namespace xaudio2 {
 
 class XAudio2AudioDriver::VoiceCallback : public api::IXAudio2VoiceCallback {
  public:
-  explicit VoiceCallback(xe::threading::Semaphore* semaphore)
-      : semaphore_(semaphore) {}
+  explicit VoiceCallback(XAudio2AudioDriver* driver) : driver_(driver) {}
   ~VoiceCallback() {}
 
   void OnStreamEnd() {}
   void OnVoiceProcessingPassEnd() {}
   void OnVoiceProcessingPassStart(uint32_t samples_required) {}
-  void OnBufferEnd(void* context) {
-    auto ret = semaphore_->Release(1, nullptr);
-    assert_true(ret);
-  }
+  void OnBufferEnd(void* context) { driver_->OnBufferCompleted(); }
   void OnBufferStart(void* context) {}
   void OnLoopEnd(void* context) {}
   void OnVoiceError(void* context, HRESULT result) {}
 
  private:
-  xe::threading::Semaphore* semaphore_ = nullptr;
+  XAudio2AudioDriver* driver_ = nullptr;
 };
 
 XAudio2AudioDriver::XAudio2AudioDriver(Memory* memory,
@@ -50,7 +46,7 @@ XAudio2AudioDriver::~XAudio2AudioDriver() = default;
 bool XAudio2AudioDriver::Initialize() {
   HRESULT hr;
 
-  voice_callback_ = new VoiceCallback(semaphore_);
+  voice_callback_ = new VoiceCallback(this);
 
   // Load the XAudio2 DLL dynamically. Needed both for 2.7 and for
   // differentiating between 2.8 and later versions. Windows 8.1 SDK references
@@ -238,6 +234,11 @@ void XAudio2AudioDriver::SubmitFrame(uint32_t frame_ptr) {
 
   current_frame_ = (current_frame_ + 1) % frame_count_;
 
+  // Timestamp the submission; buffers complete in FIFO order, so the matching
+  // slot is popped in OnBufferCompleted.
+  submit_host_ticks_[submit_slot_++ % frame_count_] =
+      xe::Clock::QueryHostTickCount();
+
   // Update playback ratio to our time scalar.
   // This will keep audio in sync with the game clock.
   float frequency_ratio = static_cast<float>(xe::Clock::guest_time_scalar());
@@ -248,6 +249,31 @@ void XAudio2AudioDriver::SubmitFrame(uint32_t frame_ptr) {
   }
 }
 
+void XAudio2AudioDriver::OnBufferCompleted() {
+  uint64_t submitted = submit_host_ticks_[complete_slot_++ % frame_count_];
+  if (submitted) {
+    latency_tick_total_ += xe::Clock::QueryHostTickCount() - submitted;
+    uint32_t count = ++latency_sample_count_;
+    if (count % 4096 == 0) {
+      XELOGAPU("XAudio2AudioDriver: measured output latency %.2fms",
+               measured_latency_ms());
+    }
+  }
+
+  auto ret = semaphore_->Release(1, nullptr);
+  assert_true(ret);
+}
+
+double XAudio2AudioDriver::measured_latency_ms() const {
+  uint32_t count = latency_sample_count_.load(std::memory_order_relaxed);
+  if (!count) {
+    return 0.0;
+  }
+  uint64_t total = latency_tick_total_.load(std::memory_order_relaxed);
+  return total * 1000.0 /
+         (double(count) * double(xe::Clock::QueryHostTickFrequency()));
+}
+
 void XAudio2AudioDriver::Shutdown() {
   if (api_minor_version_ >= 8) {
     ShutdownObjects(objects_.api_2_8);
@@ -10,6 +10,8 @@
 #ifndef XENIA_APU_XAUDIO2_XAUDIO2_AUDIO_DRIVER_H_
 #define XENIA_APU_XAUDIO2_XAUDIO2_AUDIO_DRIVER_H_
 
+#include <atomic>
+
 #include "xenia/apu/audio_driver.h"
 #include "xenia/apu/xaudio2/xaudio2_api.h"
 #include "xenia/base/threading.h"
@@ -31,7 +33,11 @@ class XAudio2AudioDriver : public AudioDriver {
   void SubmitFrame(uint32_t frame_ptr) override;
   void Shutdown();
 
+  double measured_latency_ms() const override;
+
  private:
+  // Called on the XAudio2 callback thread when a buffer finishes playing.
+  void OnBufferCompleted();
   template <typename Objects>
   bool InitializeObjects(Objects& objects);
   template <typename Objects>
@@ -63,6 +69,14 @@ class XAudio2AudioDriver : public AudioDriver {
   static const uint32_t frame_size_ = sizeof(float) * frame_samples_;
   float frames_[frame_count_][frame_samples_];
   uint32_t current_frame_ = 0;
+
+  // End-to-end latency measurement: submission timestamps are consumed in
+  // order by OnBufferCompleted as XAudio2 plays buffers FIFO.
+  uint64_t submit_host_ticks_[frame_count_] = {};
+  uint32_t submit_slot_ = 0;
+  uint32_t complete_slot_ = 0;
+  std::atomic<uint64_t> latency_tick_total_ = {0};
+  std::atomic<uint32_t> latency_sample_count_ = {0};
 };
 
 }  // namespace xaudio2
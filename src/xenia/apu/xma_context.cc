@@ -18,6 +18,7 @@
 #include "xenia/base/logging.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/ring_buffer.h"
+#include "xenia/vfs/stream_prefetcher.h"
 
 extern "C" {
 #include "third_party/libav/libavcodec/avcodec.h"
@@ -155,6 +156,9 @@ void XmaContext::Clear() {
   data.output_buffer_read_offset = 0;
   data.output_buffer_write_offset = 0;
 
+  // Any samples decoded ahead belong to the stream being torn down.
+  decoded_ahead_.clear();
+
   data.Store(context_ptr);
 }
 
@@ -337,6 +341,18 @@ void XmaContext::DecodePackets(XMA_CONTEXT_DATA* data) {
       data->current_buffer ? input_buffer_1_size : input_buffer_0_size;
   size_t current_input_packet_count = current_input_size / kBytesPerPacket;
 
+  // The title will refill the other buffer (or this one, for rolling buffers)
+  // with the file bytes that follow what we're consuming now; ask the VFS to
+  // stage them so that read doesn't wait on the host. Only re-hint when the
+  // context moves to a new buffer.
+  uint32_t current_input_ptr = data->current_buffer ? data->input_buffer_1_ptr
+                                                    : data->input_buffer_0_ptr;
+  if (current_input_ptr != last_prefetch_input_ptr_) {
+    last_prefetch_input_ptr_ = current_input_ptr;
+    vfs::StreamPrefetcher::PrefetchFrom(current_input_ptr,
+                                        uint32_t(current_input_size));
+  }
+
   // Output buffers are in raw PCM samples, 256 bytes per block.
   // Output buffer is a ring buffer. We need to write from the write offset
   // to the read offset.
@@ -354,12 +370,30 @@ void XmaContext::DecodePackets(XMA_CONTEXT_DATA* data) {
 
   // We can only decode an entire frame and write it out at a time, so
   // don't save any samples.
+  size_t frame_bytes = (data->is_stereo ? 2 : 1) * kBytesPerFrame;
   size_t output_remaining_bytes = output_rb.write_count();
-  output_remaining_bytes -= data->is_stereo ? (output_remaining_bytes % 2048)
-                                            : (output_remaining_bytes % 1024);
+  output_remaining_bytes -= output_remaining_bytes % frame_bytes;
+
+  // Flush frames decoded ahead on a previous pass first; they're already
+  // converted, so this satisfies the kick without re-entering libav.
+  if (decoded_ahead_.size() && output_remaining_bytes > 0) {
+    size_t flush_bytes =
+        std::min(decoded_ahead_.size(), output_remaining_bytes);
+    output_rb.Write(decoded_ahead_.data(), flush_bytes);
+    decoded_ahead_.erase(decoded_ahead_.begin(),
+                         decoded_ahead_.begin() + flush_bytes);
+    output_remaining_bytes -= flush_bytes;
+    data->output_buffer_write_offset = output_rb.write_offset() / 256;
+  }
+
+  // Past the guest-visible ring we may keep decoding into the ahead buffer,
+  // so the next kick starts with data in hand.
+  size_t decode_budget_bytes =
+      output_remaining_bytes +
+      (kDecodeAheadFrames * frame_bytes - decoded_ahead_.size());
 
   // Decode until we can't write any more data.
-  while (output_remaining_bytes > 0) {
+  while (decode_budget_bytes > 0) {
     int num_channels = data->is_stereo ? 2 : 1;
     if (!data->input_buffer_0_valid && !data->input_buffer_1_valid) {
       // Out of data.
@@ -587,12 +621,19 @@ void XmaContext::DecodePackets(XMA_CONTEXT_DATA* data) {
       ConvertFrame((const uint8_t**)decoded_frame_->data, context_->channels,
                    decoded_frame_->nb_samples, current_frame_);
 
-      assert_true(output_remaining_bytes >= kBytesPerFrame * num_channels);
-      output_rb.Write(current_frame_, kBytesPerFrame * num_channels);
       written_bytes = kBytesPerFrame * num_channels;
+      if (output_remaining_bytes >= written_bytes) {
+        output_rb.Write(current_frame_, written_bytes);
+        output_remaining_bytes -= written_bytes;
+        data->output_buffer_write_offset = output_rb.write_offset() / 256;
+      } else {
+        // Ring is full - stash the frame ahead of the guest read pointer.
+        decoded_ahead_.insert(decoded_ahead_.end(), current_frame_,
+                              current_frame_ + written_bytes);
+      }
 
-      output_remaining_bytes -= written_bytes;
-      data->output_buffer_write_offset = output_rb.write_offset() / 256;
+      assert_true(decode_budget_bytes >= written_bytes);
+      decode_budget_bytes -= written_bytes;
     }
   }
 
@@ -649,27 +690,10 @@ int XmaContext::PrepareDecoder(uint8_t* block, size_t size, int sample_rate,
 
 bool XmaContext::ConvertFrame(const uint8_t** samples, int num_channels,
                               int num_samples, uint8_t* output_buffer) {
-  // Loop through every sample, convert and drop it into the output array.
-  // If more than one channel, we need to interleave the samples from each
-  // channel next to each other.
-  // TODO: This can definitely be optimized with AVX/SSE intrinsics!
-  uint32_t o = 0;
-  for (int i = 0; i < num_samples; i++) {
-    for (int j = 0; j < num_channels; j++) {
-      // Select the appropriate array based on the current channel.
-      auto sample_array = reinterpret_cast<const float*>(samples[j]);
-
-      // Raw sample should be within [-1, 1].
-      // Clamp it, just in case.
-      float raw_sample = xe::saturate(sample_array[i]);
-
-      // Convert the sample and output it in big endian.
-      float scaled_sample = raw_sample * ((1 << 15) - 1);
-      int sample = static_cast<int>(scaled_sample);
-      xe::store_and_swap<uint16_t>(&output_buffer[o++ * 2], sample & 0xFFFF);
-    }
-  }
-
+  // Convert and interleave with the byte swap fused in; the kernel handles
+  // the packed fast path and the scalar remainder.
+  xma::ConvertFloatToS16Swapped(reinterpret_cast<const float* const*>(samples),
+                                num_channels, num_samples, output_buffer);
   return true;
 }
 
@@ -145,6 +145,10 @@ class XmaContext {
   static const uint32_t kOutputBytesPerBlock = 256;
   static const uint32_t kOutputMaxSizeBytes = 31 * kOutputBytesPerBlock;
 
+  // Number of whole frames the decoder may run ahead of the guest read
+  // pointer when the output ring is full.
+  static const uint32_t kDecodeAheadFrames = 8;
+
   explicit XmaContext();
   ~XmaContext();
 
@@ -199,6 +203,10 @@ class XmaContext {
   bool is_allocated_ = false;
   bool is_enabled_ = false;
 
+  // Input buffer last hinted to the VFS stream prefetcher; avoids re-issuing
+  // the hint every decode pass while a buffer drains.
+  uint32_t last_prefetch_input_ptr_ = 0;
+
   // libav structures
   AVCodec* codec_ = nullptr;
   AVCodecContext* context_ = nullptr;
@@ -214,6 +222,11 @@ class XmaContext {
   std::vector<uint8_t> partial_frame_buffer_;
 
   uint8_t* current_frame_ = nullptr;
+
+  // Converted PCM decoded ahead of the guest read pointer, flushed into the
+  // output ring on the next kick before libav is touched. Always holds whole
+  // frames.
+  std::vector<uint8_t> decoded_ahead_;
 };
 
 }  // namespace apu
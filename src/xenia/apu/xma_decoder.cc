@@ -9,12 +9,15 @@
 
 #include "xenia/apu/xma_decoder.h"
 
+#include <algorithm>
+
 #include "xenia/apu/xma_context.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/ring_buffer.h"
+#include "xenia/base/thread_pool.h"
 #include "xenia/base/string_buffer.h"
 #include "xenia/cpu/processor.h"
 #include "xenia/cpu/thread_state.h"
@@ -51,6 +54,13 @@ extern "C" {
 DEFINE_bool(libav_verbose, false, "Verbose libav output (debug and above)",
             "APU");
 
+DEFINE_int32(xma_decode_threads, 0,
+             "Maximum number of threads the XMA context sweep may use, "
+             "including the poll thread. 0 = automatic, 1 = decode on the "
+             "poll thread (old behavior). The threads come from the shared "
+             "task pool.",
+             "APU");
+
 namespace xe {
 namespace apu {
 
@@ -126,6 +136,16 @@ X_STATUS XmaDecoder::Setup(kernel::KernelState* kernel_state) {
   register_file_[XE_XMA_REG_NEXT_CONTEXT_INDEX].u32 = 1;
   context_bitmap_.Resize(kContextCount);
 
+  // Each pass of the poll loop fans the context sweep out across the shared
+  // task pool so that many simultaneously-active contexts don't serialize
+  // behind one another.
+  decode_max_workers_ = uint32_t(cvars::xma_decode_threads);
+  if (!decode_max_workers_) {
+    decode_max_workers_ =
+        std::min(uint32_t(4), xe::threading::logical_processor_count() / 2);
+    decode_max_workers_ = std::max(decode_max_workers_, uint32_t(1));
+  }
+
   worker_running_ = true;
   work_event_ = xe::threading::Event::CreateAutoResetEvent(false);
   worker_thread_ = kernel::object_ref<kernel::XHostThread>(
@@ -140,10 +160,9 @@ X_STATUS XmaDecoder::Setup(kernel::KernelState* kernel_state) {
   return X_STATUS_SUCCESS;
 }
 
-void XmaDecoder::WorkerThreadMain() {
-  uint32_t idle_loop_count = 0;
-  while (worker_running_) {
-    // Okay, let's loop through XMA contexts to find ones we need to decode!
+bool XmaDecoder::ProcessContexts() {
+  if (decode_max_workers_ <= 1) {
+    // Sweep on this thread like the hardware's single SPU would.
     bool did_work = false;
     for (uint32_t n = 0; n < kContextCount; n++) {
       XmaContext& context = contexts_[n];
@@ -154,6 +173,30 @@ void XmaDecoder::WorkerThreadMain() {
       // registers_.current_context = n;
       // registers_.next_context = (n + 1) % kContextCount;
     }
+    return did_work;
+  }
+
+  // Fan the sweep out across the shared pool and wait for the pass to drain.
+  // Work() on an idle context just bounces off its lock, so visiting every
+  // index is cheap and keeps the dispatch logic free of racy is_enabled
+  // peeking.
+  std::atomic<bool> did_work = {false};
+  xe::threading::ThreadPool::shared()->ParallelFor(
+      kContextCount,
+      [this, &did_work](uint32_t n) {
+        if (contexts_[n].Work()) {
+          did_work.store(true, std::memory_order_relaxed);
+        }
+      },
+      decode_max_workers_);
+  return did_work.load(std::memory_order_relaxed);
+}
+
+void XmaDecoder::WorkerThreadMain() {
+  uint32_t idle_loop_count = 0;
+  while (worker_running_) {
+    // Okay, let's loop through XMA contexts to find ones we need to decode!
+    bool did_work = ProcessContexts();
 
     if (paused_) {
       pause_fence_.Signal();
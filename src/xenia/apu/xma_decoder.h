@@ -17,6 +17,7 @@
 #include "xenia/apu/xma_context.h"
 #include "xenia/apu/xma_register_file.h"
 #include "xenia/base/bit_map.h"
+#include "xenia/base/threading.h"
 #include "xenia/kernel/xthread.h"
 #include "xenia/xbox.h"
 
@@ -56,6 +57,7 @@ class XmaDecoder {
 
  private:
   void WorkerThreadMain();
+  bool ProcessContexts();
 
   static uint32_t MMIOReadRegisterThunk(void* ppc_context, XmaDecoder* as,
                                         uint32_t addr) {
@@ -74,6 +76,13 @@ class XmaDecoder {
   kernel::object_ref<kernel::XHostThread> worker_thread_;
   std::unique_ptr<xe::threading::Event> work_event_ = nullptr;
 
+  // How many threads the context sweep may use, including the poll thread
+  // itself; 1 means sweeping serially on the poll thread. The threads come
+  // from the shared xe::threading::ThreadPool rather than a dedicated pool.
+  // Contexts are serialized by their own lock_, so a pool worker decoding a
+  // context simply excludes Enable/Disable/Clear on it.
+  uint32_t decode_max_workers_ = 1;
+
   bool paused_ = false;
   xe::threading::Fence pause_fence_;   // Signaled when worker paused.
   xe::threading::Fence resume_fence_;  // Signaled when resume requested.
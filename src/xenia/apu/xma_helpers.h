@@ -14,6 +14,9 @@
 
 #include <stdint.h>
 
+#include "xenia/base/memory.h"
+#include "xenia/base/platform.h"
+
 namespace xe {
 namespace apu {
 namespace xma {
@@ -40,6 +43,60 @@ uint32_t GetPacketMetadata(uint8_t* packet) {
 
 uint32_t GetPacketSkipCount(uint8_t* packet) { return (uint8_t)(packet[3]); }
 
+// Converts planar float samples from the decoder into the interleaved
+// big-endian signed 16-bit PCM the guest expects in the output ring. Samples
+// are clamped to [-1, 1] before scaling.
+inline void ConvertFloatToS16Swapped(const float* const* samples,
+                                     int num_channels, int num_samples,
+                                     uint8_t* output) {
+  auto out = reinterpret_cast<uint16_t*>(output);
+  int i = 0;
+#if XE_ARCH_AMD64
+  // Packed clamp/scale/cvttps2dq/packssdw with the output byte swap fused in.
+  // SSE2 is the x64 baseline, so no runtime dispatch is needed.
+  __m128 scale = _mm_set1_ps(float((1 << 15) - 1));
+  __m128 minus_one = _mm_set1_ps(-1.0f);
+  __m128 plus_one = _mm_set1_ps(1.0f);
+  if (num_channels == 1) {
+    const float* channel = samples[0];
+    for (; i + 8 <= num_samples; i += 8) {
+      __m128 f0 = _mm_loadu_ps(&channel[i]);
+      __m128 f1 = _mm_loadu_ps(&channel[i + 4]);
+      f0 = _mm_mul_ps(_mm_max_ps(_mm_min_ps(f0, plus_one), minus_one), scale);
+      f1 = _mm_mul_ps(_mm_max_ps(_mm_min_ps(f1, plus_one), minus_one), scale);
+      __m128i s = _mm_packs_epi32(_mm_cvttps_epi32(f0), _mm_cvttps_epi32(f1));
+      s = _mm_or_si128(_mm_slli_epi16(s, 8), _mm_srli_epi16(s, 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), s);
+    }
+  } else if (num_channels == 2) {
+    const float* left = samples[0];
+    const float* right = samples[1];
+    for (; i + 4 <= num_samples; i += 4) {
+      __m128 fl = _mm_loadu_ps(&left[i]);
+      __m128 fr = _mm_loadu_ps(&right[i]);
+      fl = _mm_mul_ps(_mm_max_ps(_mm_min_ps(fl, plus_one), minus_one), scale);
+      fr = _mm_mul_ps(_mm_max_ps(_mm_min_ps(fr, plus_one), minus_one), scale);
+      __m128i l = _mm_cvttps_epi32(fl);
+      __m128i r = _mm_cvttps_epi32(fr);
+      // Interleave to L R L R ... while still 32-bit, then pack to int16.
+      __m128i s = _mm_packs_epi32(_mm_unpacklo_epi32(l, r),
+                                  _mm_unpackhi_epi32(l, r));
+      s = _mm_or_si128(_mm_slli_epi16(s, 8), _mm_srli_epi16(s, 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i * 2]), s);
+    }
+  }
+#endif  // XE_ARCH_AMD64
+  for (; i < num_samples; ++i) {
+    for (int j = 0; j < num_channels; ++j) {
+      float sample = samples[j][i];
+      sample = sample < -1.0f ? -1.0f : (sample > 1.0f ? 1.0f : sample);
+      int value = static_cast<int>(sample * ((1 << 15) - 1));
+      xe::store_and_swap<uint16_t>(&out[i * num_channels + j],
+                                   uint16_t(value & 0xFFFF));
+    }
+  }
+}
+
 }  // namespace xma
 }  // namespace apu
 }  // namespace xe
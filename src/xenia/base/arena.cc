@@ -9,13 +9,61 @@
 
 #include "xenia/base/arena.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
 
 #include "xenia/base/assert.h"
+#include "xenia/base/profiling.h"
 
 namespace xe {
 
+MemoryCounter arena_memory("base/arena");
+
+namespace {
+// Upper bound on chunks kept on the shared free list; anything beyond this
+// is returned to the allocator when an arena is destroyed.
+const size_t kMaxPooledChunks = 16;
+std::mutex chunk_pool_mutex_;
+size_t chunk_pool_count_ = 0;
+}  // namespace
+
+// Guarded by chunk_pool_mutex_.
+Arena::Chunk* Arena::chunk_pool_head_ = nullptr;
+
+Arena::Chunk* Arena::AcquireChunk(size_t chunk_size) {
+  {
+    std::lock_guard<std::mutex> guard(chunk_pool_mutex_);
+    Chunk** link = &chunk_pool_head_;
+    while (*link) {
+      if ((*link)->capacity == chunk_size) {
+        Chunk* chunk = *link;
+        *link = chunk->next;
+        --chunk_pool_count_;
+        chunk->next = nullptr;
+        chunk->offset = 0;
+        return chunk;
+      }
+      link = &(*link)->next;
+    }
+  }
+  return new Chunk(chunk_size);
+}
+
+void Arena::ReleaseChunk(Chunk* chunk) {
+  {
+    std::lock_guard<std::mutex> guard(chunk_pool_mutex_);
+    if (chunk_pool_count_ < kMaxPooledChunks) {
+      chunk->next = chunk_pool_head_;
+      chunk_pool_head_ = chunk;
+      ++chunk_pool_count_;
+      return;
+    }
+  }
+  delete chunk;
+}
+
 Arena::Arena(size_t chunk_size)
     : chunk_size_(chunk_size), head_chunk_(nullptr), active_chunk_(nullptr) {}
 
@@ -24,13 +72,14 @@ Arena::~Arena() {
   Chunk* chunk = head_chunk_;
   while (chunk) {
     Chunk* next = chunk->next;
-    delete chunk;
+    ReleaseChunk(chunk);
     chunk = next;
   }
   head_chunk_ = nullptr;
 }
 
 void Arena::Reset() {
+  high_water_mark_ = std::max(high_water_mark_, CalculateSize());
   active_chunk_ = head_chunk_;
   if (active_chunk_) {
     active_chunk_->offset = 0;
@@ -51,14 +100,16 @@ void* Arena::Alloc(size_t size) {
       Chunk* next = active_chunk_->next;
       if (!next) {
         assert_true(size < chunk_size_, "need to support larger chunks");
-        next = new Chunk(chunk_size_);
+        next = AcquireChunk(chunk_size_);
         active_chunk_->next = next;
+        capacity_ += next->capacity;
       }
       next->offset = 0;
       active_chunk_ = next;
     }
   } else {
-    head_chunk_ = active_chunk_ = new Chunk(chunk_size_);
+    head_chunk_ = active_chunk_ = AcquireChunk(chunk_size_);
+    capacity_ += head_chunk_->capacity;
   }
 
   uint8_t* p = active_chunk_->buffer + active_chunk_->offset;
@@ -112,13 +163,18 @@ void Arena::CloneContents(void* buffer, size_t buffer_length) {
 
 Arena::Chunk::Chunk(size_t chunk_size)
     : next(nullptr), capacity(chunk_size), buffer(0), offset(0) {
+  // The owning thread both allocates and fills the chunk, so first-touch
+  // placement keeps arena memory local to that thread's NUMA node without any
+  // explicit binding; per-thread arenas (e.g. translation) depend on this.
   buffer = reinterpret_cast<uint8_t*>(malloc(capacity));
+  arena_memory.Add(capacity);
 }
 
 Arena::Chunk::~Chunk() {
   if (buffer) {
     free(buffer);
   }
+  arena_memory.Remove(capacity);
 }
 
 }  // namespace xe
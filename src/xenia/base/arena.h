@@ -21,6 +21,13 @@ class Arena {
   explicit Arena(size_t chunk_size = 4 * 1024 * 1024);
   ~Arena();
 
+  // Total capacity of all chunks ever grown by this arena. Chunks are
+  // retained across Reset, so once capacity covers the largest use the arena
+  // performs no further heap allocations.
+  size_t capacity() const { return capacity_; }
+  // Largest number of bytes in use at any Reset so far.
+  size_t high_water_mark() const { return high_water_mark_; }
+
   void Reset();
   void DebugFill();
 
@@ -54,9 +61,19 @@ class Arena {
   size_t CalculateSize();
   void CloneContents(void* buffer, size_t buffer_length);
 
+  // Retired chunks are kept on a shared free list so that a newly
+  // constructed arena (such as one owned by a translator spun up on another
+  // thread) warms up from recycled chunks instead of hitting the allocator.
+  static Chunk* AcquireChunk(size_t chunk_size);
+  static void ReleaseChunk(Chunk* chunk);
+  // Intrusive free list of retired chunks, linked through Chunk::next.
+  static Chunk* chunk_pool_head_;
+
   size_t chunk_size_;
   Chunk* head_chunk_;
   Chunk* active_chunk_;
+  size_t capacity_ = 0;
+  size_t high_water_mark_ = 0;
 };
 
 }  // namespace xe
@@ -9,6 +9,8 @@
 
 #include "xenia/base/bit_map.h"
 
+#include <algorithm>
+
 #include "xenia/base/assert.h"
 #include "xenia/base/atomic.h"
 #include "xenia/base/math.h"
@@ -93,4 +95,171 @@ void BitMap::Reset() {
   }
 }
 
+RunBitMap::RunBitMap() = default;
+
+RunBitMap::RunBitMap(size_t size_bits) { Resize(size_bits); }
+
+void RunBitMap::Resize(size_t new_size_bits) {
+  size_t old_word_count = words_.size();
+  size_t new_word_count = (new_size_bits + 63) / 64;
+  words_.resize(new_word_count);
+  summary_.resize((new_word_count + 63) / 64);
+  size_bits_ = new_size_bits;
+  for (size_t i = old_word_count; i < new_word_count; ++i) {
+    words_[i] = ~uint64_t(0);
+    UpdateSummary(i);
+  }
+  // Bits beyond size_bits_ in the final word are permanently clear so runs
+  // can never extend past the end.
+  if (new_size_bits < new_word_count * 64) {
+    ClearRange(new_size_bits, new_word_count * 64 - new_size_bits);
+  }
+}
+
+void RunBitMap::SetAll() {
+  for (size_t i = 0; i < words_.size(); ++i) {
+    words_[i] = ~uint64_t(0);
+    UpdateSummary(i);
+  }
+  if (size_bits_ < words_.size() * 64) {
+    ClearRange(size_bits_, words_.size() * 64 - size_bits_);
+  }
+}
+
+void RunBitMap::SetRange(size_t start, size_t count) {
+  size_t end = start + count;
+  while (start < end) {
+    size_t word_index = start >> 6;
+    size_t word_end = std::min(end, (word_index + 1) * 64);
+    size_t hi = word_end - word_index * 64;
+    uint64_t mask = hi == 64 ? ~uint64_t(0) : ((uint64_t(1) << hi) - 1);
+    mask &= ~uint64_t(0) << (start & 63);
+    words_[word_index] |= mask;
+    UpdateSummary(word_index);
+    start = word_end;
+  }
+}
+
+void RunBitMap::ClearRange(size_t start, size_t count) {
+  size_t end = start + count;
+  while (start < end) {
+    size_t word_index = start >> 6;
+    size_t word_end = std::min(end, (word_index + 1) * 64);
+    size_t hi = word_end - word_index * 64;
+    uint64_t mask = hi == 64 ? ~uint64_t(0) : ((uint64_t(1) << hi) - 1);
+    mask &= ~uint64_t(0) << (start & 63);
+    words_[word_index] &= ~mask;
+    UpdateSummary(word_index);
+    start = word_end;
+  }
+}
+
+void RunBitMap::UpdateSummary(size_t word_index) {
+  uint64_t bit = uint64_t(1) << (word_index & 63);
+  if (words_[word_index] == ~uint64_t(0)) {
+    summary_[word_index >> 6] |= bit;
+  } else {
+    summary_[word_index >> 6] &= ~bit;
+  }
+}
+
+size_t RunBitMap::FindFirstClear(size_t start, size_t end) const {
+  size_t pos = start;
+  while (pos < end) {
+    size_t word_index = pos >> 6;
+    uint64_t inverse = ~words_[word_index] & (~uint64_t(0) << (pos & 63));
+    if (inverse) {
+      size_t bit = word_index * 64 + tzcnt(inverse);
+      return bit < end ? bit : kInvalidIndex;
+    }
+    // This word is fully set from pos on; skip whole fully-set words via the
+    // summary level instead of testing them one by one.
+    ++word_index;
+    while (word_index < words_.size()) {
+      uint64_t summary_inverse =
+          ~summary_[word_index >> 6] & (~uint64_t(0) << (word_index & 63));
+      if (summary_inverse) {
+        word_index = (word_index & ~size_t(63)) + tzcnt(summary_inverse);
+        break;
+      }
+      word_index = (word_index & ~size_t(63)) + 64;
+    }
+    pos = word_index * 64;
+  }
+  return kInvalidIndex;
+}
+
+size_t RunBitMap::FindLastClear(size_t start, size_t end) const {
+  size_t pos = end;
+  while (pos > start) {
+    size_t bit_index = pos - 1;
+    size_t word_index = bit_index >> 6;
+    uint64_t inverse =
+        ~words_[word_index] & (~uint64_t(0) >> (63 - (bit_index & 63)));
+    if (inverse) {
+      size_t bit = word_index * 64 + 63 - lzcnt(inverse);
+      return bit >= start ? bit : kInvalidIndex;
+    }
+    // This word is fully set up to pos; skip whole fully-set words backwards
+    // via the summary level.
+    if (!word_index) {
+      break;
+    }
+    --word_index;
+    while (true) {
+      uint64_t summary_inverse = ~summary_[word_index >> 6] &
+                                 (~uint64_t(0) >> (63 - (word_index & 63)));
+      if (summary_inverse) {
+        word_index = (word_index & ~size_t(63)) + 63 - lzcnt(summary_inverse);
+        break;
+      }
+      if (!(word_index >> 6)) {
+        return kInvalidIndex;
+      }
+      word_index = (word_index & ~size_t(63)) - 1;
+    }
+    pos = word_index * 64 + 64;
+  }
+  return kInvalidIndex;
+}
+
+size_t RunBitMap::FindRun(size_t count, size_t stride, size_t low, size_t high,
+                          bool top_down) const {
+  assert_not_zero(count);
+  assert_not_zero(stride);
+  if (!size_bits_) {
+    return kInvalidIndex;
+  }
+  high = std::min(high, size_bits_ - 1);
+  if (!top_down) {
+    size_t start = (low + stride - 1) / stride * stride;
+    while (start + count - 1 <= high) {
+      size_t used = FindFirstClear(start, start + count);
+      if (used == kInvalidIndex) {
+        return start;
+      }
+      // Skip past the used bit to the next aligned candidate.
+      start = (used + stride) / stride * stride;
+    }
+  } else {
+    if (count - 1 > high) {
+      return kInvalidIndex;
+    }
+    size_t start = (high - (count - 1)) / stride * stride;
+    while (start >= low) {
+      size_t used = FindLastClear(start, start + count);
+      if (used == kInvalidIndex) {
+        return start;
+      }
+      if (used < count) {
+        // No room below the used bit for a full run.
+        break;
+      }
+      // The next candidate must end below the used bit.
+      start = (used - count) / stride * stride;
+    }
+  }
+  return kInvalidIndex;
+}
+
 }  // namespace xe
\ No newline at end of file
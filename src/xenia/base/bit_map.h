@@ -51,6 +51,54 @@ class BitMap {
   std::vector<uint64_t> data_;
 };
 
+// Run Bit Map: hierarchical bitmap for finding runs of consecutive set bits.
+// Bits are stored LSB-first in 64-bit words, with a summary word level whose
+// bit s is set when word s is entirely set, so scans skip fully-set regions
+// 64 words at a time and within a word use tzcnt/lzcnt rather than testing
+// bit by bit. Intended for free-page tracking (bit set = free). Not thread
+// safe - callers must synchronize externally.
+class RunBitMap {
+ public:
+  const static size_t kInvalidIndex = static_cast<size_t>(-1);
+
+  RunBitMap();
+  explicit RunBitMap(size_t size_bits);
+
+  size_t size_bits() const { return size_bits_; }
+
+  // Resizes the bitmap; any bits added are set.
+  void Resize(size_t new_size_bits);
+
+  // Sets all bits.
+  void SetAll();
+
+  bool Get(size_t index) const {
+    return (words_[index >> 6] & (uint64_t(1) << (index & 63))) != 0;
+  }
+  void Set(size_t index) { SetRange(index, 1); }
+  void Clear(size_t index) { ClearRange(index, 1); }
+  void SetRange(size_t start, size_t count);
+  void ClearRange(size_t start, size_t count);
+
+  // Finds a run of count consecutive set bits whose start is a multiple of
+  // stride and which lies entirely within [low, high] (inclusive bit
+  // indices). Returns the start of the lowest such run, or the highest if
+  // top_down, or kInvalidIndex if no run fits.
+  size_t FindRun(size_t count, size_t stride, size_t low, size_t high,
+                 bool top_down) const;
+
+ private:
+  void UpdateSummary(size_t word_index);
+  // Returns the index of the first/last clear bit in [start, end), or
+  // kInvalidIndex if all bits in the range are set.
+  size_t FindFirstClear(size_t start, size_t end) const;
+  size_t FindLastClear(size_t start, size_t end) const;
+
+  size_t size_bits_ = 0;
+  std::vector<uint64_t> words_;
+  std::vector<uint64_t> summary_;
+};
+
 }  // namespace xe
 
 #endif  // XENIA_BASE_BIT_MAP_H_
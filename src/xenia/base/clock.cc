@@ -10,6 +10,7 @@
 #include "xenia/base/clock.h"
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <mutex>
 
@@ -33,18 +34,57 @@ double guest_time_scalar_ = 1.0;
 uint64_t guest_tick_frequency_ = Clock::host_tick_frequency_platform();
 // Base FILETIME of the guest system from app start.
 uint64_t guest_system_time_base_ = Clock::QueryHostSystemTime();
-// Combined time and frequency ratio between host and guest.
-// Split in numerator (first) and denominator (second).
-// Computed by RecomputeGuestTickScalar.
-std::pair<uint64_t, uint64_t> guest_tick_ratio_ = std::make_pair(1, 1);
-
-// Native guest ticks.
-uint64_t last_guest_tick_count_ = 0;
-// Last sampled host tick count.
-uint64_t last_host_tick_count_ = Clock::QueryHostTickCount();
-// Mutex to ensure last_host_tick_count_ and last_guest_tick_count_ are in sync
+// Guest tick base state. Guest ticks are computed as
+//   guest_tick_base + (host_ticks - host_tick_base) * ratio
+// so reads need no shared mutable state; the base is rebased (keeping the
+// reported value continuous) only when the ratio changes, which is rare.
+struct GuestTickBase {
+  // Host tick count sampled when the ratio last changed.
+  uint64_t host_tick_base;
+  // Guest tick count corresponding to host_tick_base.
+  uint64_t guest_tick_base;
+  // Combined time and frequency ratio between host and guest, split in
+  // numerator (first) and denominator (second).
+  uint64_t ratio_numerator;
+  uint64_t ratio_denominator;
+};
+GuestTickBase guest_tick_base_ = {Clock::QueryHostTickCount(), 0, 1, 1};
+// Seqlock over guest_tick_base_: odd while a writer is mid-update. Readers
+// retry instead of blocking, so busy-wait timing loops in guest code never
+// serialize on a lock.
+std::atomic<uint32_t> guest_tick_seq_{0};
+// Highest guest tick count reported so far, to keep the clock monotonic
+// across rebases and minor host counter skew.
+std::atomic<uint64_t> last_guest_tick_count_{0};
+// Serializes writers (ratio changes); readers never take this.
 std::mutex tick_mutex_;
 
+GuestTickBase ReadGuestTickBase() {
+  GuestTickBase base;
+  uint32_t seq;
+  do {
+    seq = guest_tick_seq_.load(std::memory_order_acquire);
+    base = guest_tick_base_;
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((seq & 1) || guest_tick_seq_.load(std::memory_order_relaxed) != seq);
+  return base;
+}
+
+// Converts a host tick count to guest ticks with the given base. Split into
+// quotient and remainder so the intermediate products can't overflow even
+// when the host delta spans the whole session.
+uint64_t GuestTicksFromBase(const GuestTickBase& base,
+                            uint64_t host_tick_count) {
+  uint64_t host_tick_delta = host_tick_count > base.host_tick_base
+                                 ? host_tick_count - base.host_tick_base
+                                 : 0;
+  uint64_t guest_tick_delta =
+      host_tick_delta / base.ratio_denominator * base.ratio_numerator +
+      host_tick_delta % base.ratio_denominator * base.ratio_numerator /
+          base.ratio_denominator;
+  return base.guest_tick_base + guest_tick_delta;
+}
+
 void RecomputeGuestTickScalar() {
   // Create a rational number with numerator (first) and denominator (second)
   auto frac =
@@ -61,36 +101,43 @@ void RecomputeGuestTickScalar() {
   // Keep this a rational calculation and reduce the fraction
   reduce_fraction(frac);
 
+  // Rebase so ticks computed with the new ratio continue from the value the
+  // old ratio would have reported right now.
   std::lock_guard<std::mutex> lock(tick_mutex_);
-  guest_tick_ratio_ = frac;
+  uint64_t host_tick_count = Clock::QueryHostTickCount();
+  uint64_t guest_tick_count = GuestTicksFromBase(guest_tick_base_,
+                                                 host_tick_count);
+  guest_tick_seq_.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  guest_tick_base_.host_tick_base = host_tick_count;
+  guest_tick_base_.guest_tick_base = guest_tick_count;
+  guest_tick_base_.ratio_numerator = frac.first;
+  guest_tick_base_.ratio_denominator = frac.second;
+  guest_tick_seq_.fetch_add(1, std::memory_order_release);
 }
 
-// Update the guest timer for all threads.
-// Return a copy of the value so locking is reduced.
+// Computes the current guest tick count without taking any locks.
 uint64_t UpdateGuestClock() {
   uint64_t host_tick_count = Clock::QueryHostTickCount();
+  auto base = ReadGuestTickBase();
 
   if (cvars::clock_no_scaling) {
     // Nothing to update, calculate on the fly
-    return host_tick_count * guest_tick_ratio_.first / guest_tick_ratio_.second;
+    return host_tick_count * base.ratio_numerator / base.ratio_denominator;
   }
 
-  std::unique_lock<std::mutex> lock(tick_mutex_, std::defer_lock);
-  if (lock.try_lock()) {
-    // Translate host tick count to guest tick count.
-    uint64_t host_tick_delta = host_tick_count > last_host_tick_count_
-                                   ? host_tick_count - last_host_tick_count_
-                                   : 0;
-    last_host_tick_count_ = host_tick_count;
-    uint64_t guest_tick_delta =
-        host_tick_delta * guest_tick_ratio_.first / guest_tick_ratio_.second;
-    last_guest_tick_count_ += guest_tick_delta;
-    return last_guest_tick_count_;
-  } else {
-    // Wait until another thread has finished updating the clock.
-    lock.lock();
-    return last_guest_tick_count_;
+  uint64_t guest_tick_count = GuestTicksFromBase(base, host_tick_count);
+
+  // Never report a value lower than one already handed out - concurrent
+  // readers may interleave with a rebase or see slight host counter skew.
+  uint64_t last = last_guest_tick_count_.load(std::memory_order_relaxed);
+  while (guest_tick_count > last) {
+    if (last_guest_tick_count_.compare_exchange_weak(
+            last, guest_tick_count, std::memory_order_relaxed)) {
+      return guest_tick_count;
+    }
   }
+  return last;
 }
 
 // Offset of the current guest system file time relative to the guest base time.
@@ -135,8 +182,8 @@ void Clock::set_guest_time_scalar(double scalar) {
 }
 
 std::pair<uint64_t, uint64_t> Clock::guest_tick_ratio() {
-  std::lock_guard<std::mutex> lock(tick_mutex_);
-  return guest_tick_ratio_;
+  auto base = ReadGuestTickBase();
+  return std::make_pair(base.ratio_numerator, base.ratio_denominator);
 }
 
 uint64_t Clock::guest_tick_frequency() { return guest_tick_frequency_; }
@@ -9,11 +9,13 @@
 
 #include "cvar.h"
 
+#include <algorithm>
+
 namespace cvar {
 
 cxxopts::Options options("xenia", "Xbox 360 Emulator");
-std::map<std::string, ICommandVar*>* CmdVars;
-std::map<std::string, IConfigVar*>* ConfigVars;
+std::vector<ICommandVar*>* CmdVars;
+std::vector<IConfigVar*>* ConfigVars;
 
 void PrintHelpAndExit() {
   std::cout << options.help({""}) << std::endl;
@@ -26,17 +28,21 @@ void ParseLaunchArguments(int argc, char** argv,
                           const std::string& positional_help,
                           const std::vector<std::string>& positional_options) {
   options.add_options()("help", "Prints help and exit.");
-  if (!CmdVars) CmdVars = new std::map<std::string, ICommandVar*>();
-  if (!ConfigVars) ConfigVars = new std::map<std::string, IConfigVar*>();
-  for (auto& it : *CmdVars) {
-    auto cmdVar = it.second;
+  if (!CmdVars) CmdVars = new std::vector<ICommandVar*>();
+  if (!ConfigVars) ConfigVars = new std::vector<IConfigVar*>();
+
+  // Static-init registration is append-only; freeze the registries into
+  // name order here so help output and config iteration stay deterministic.
+  auto by_name = [](const ICommandVar* a, const ICommandVar* b) {
+    return a->name() < b->name();
+  };
+  std::sort(CmdVars->begin(), CmdVars->end(), by_name);
+  std::sort(ConfigVars->begin(), ConfigVars->end(), by_name);
+
+  for (auto cmdVar : *CmdVars) {
     cmdVar->AddToLaunchOptions(&options);
   }
-  std::vector<IConfigVar*> vars;
-  for (const auto& s : *ConfigVars) vars.push_back(s.second);
-
-  for (auto& it : *ConfigVars) {
-    auto configVar = it.second;
+  for (auto configVar : *ConfigVars) {
     configVar->AddToLaunchOptions(&options);
   }
   try {
@@ -47,14 +53,12 @@ void ParseLaunchArguments(int argc, char** argv,
     if (result.count("help")) {
       PrintHelpAndExit();
     }
-    for (auto& it : *CmdVars) {
-      auto cmdVar = static_cast<ICommandVar*>(it.second);
+    for (auto cmdVar : *CmdVars) {
       if (result.count(cmdVar->name())) {
         cmdVar->LoadFromLaunchOptions(&result);
       }
     }
-    for (auto& it : *ConfigVars) {
-      auto configVar = static_cast<IConfigVar*>(it.second);
+    for (auto configVar : *ConfigVars) {
       if (result.count(configVar->name())) {
         configVar->LoadFromLaunchOptions(&result);
       }
@@ -10,7 +10,6 @@
 #ifndef XENIA_CVAR_H_
 #define XENIA_CVAR_H_
 
-#include <map>
 #include <string>
 #include <vector>
 
@@ -206,16 +205,20 @@ void ConfigVar<T>::SetGameConfigValue(T val) {
   UpdateValue();
 }
 
-extern std::map<std::string, ICommandVar*>* CmdVars;
-extern std::map<std::string, IConfigVar*>* ConfigVars;
+// Registration appends here during static init; ParseLaunchArguments
+// freezes both lists (sorts them by name) once registration is complete.
+// Hot paths never touch these - cvars:: values are plain globals that the
+// DEFINE_* macros hand out directly.
+extern std::vector<ICommandVar*>* CmdVars;
+extern std::vector<IConfigVar*>* ConfigVars;
 
 inline void AddConfigVar(IConfigVar* cv) {
-  if (!ConfigVars) ConfigVars = new std::map<std::string, IConfigVar*>();
-  ConfigVars->insert(std::pair<std::string, IConfigVar*>(cv->name(), cv));
+  if (!ConfigVars) ConfigVars = new std::vector<IConfigVar*>();
+  ConfigVars->push_back(cv);
 }
 inline void AddCommandVar(ICommandVar* cv) {
-  if (!CmdVars) CmdVars = new std::map<std::string, ICommandVar*>();
-  CmdVars->insert(std::pair<std::string, ICommandVar*>(cv->name(), cv));
+  if (!CmdVars) CmdVars = new std::vector<ICommandVar*>();
+  CmdVars->push_back(cv);
 }
 void ParseLaunchArguments(int argc, char** argv,
                           const std::string& positional_help,
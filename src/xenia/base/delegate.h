@@ -10,14 +10,20 @@
 #ifndef XENIA_BASE_DELEGATE_H_
 #define XENIA_BASE_DELEGATE_H_
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <vector>
 
 namespace xe {
 
-// TODO(benvanik): go lockfree, and don't hold the lock while emitting.
-
+// Multicast event delegate. Invocation walks a copy-on-write snapshot of the
+// listener list, so firing is lock-free and never contends with the (rare)
+// add/remove - and listeners may safely add or remove listeners from within
+// a callback. Mutators serialize on a mutex and publish a fresh list with
+// atomic shared_ptr stores; an in-flight invocation on another thread may
+// still see the previous list once after a mutation.
 template <typename... Args>
 class Delegate {
  public:
@@ -25,24 +31,38 @@ class Delegate {
 
   void AddListener(Listener const& listener) {
     std::lock_guard<std::mutex> guard(lock_);
-    listeners_.push_back(listener);
+    auto new_list = listeners_ ? std::make_shared<ListenerList>(*listeners_)
+                               : std::make_shared<ListenerList>();
+    new_list->push_back(listener);
+    std::atomic_store_explicit(
+        &listeners_, std::shared_ptr<const ListenerList>(std::move(new_list)),
+        std::memory_order_release);
   }
 
   void RemoveAllListeners() {
     std::lock_guard<std::mutex> guard(lock_);
-    listeners_.clear();
+    std::atomic_store_explicit(&listeners_,
+                               std::shared_ptr<const ListenerList>(),
+                               std::memory_order_release);
   }
 
   void operator()(Args... args) {
-    std::lock_guard<std::mutex> guard(lock_);
-    for (auto& listener : listeners_) {
+    auto listeners =
+        std::atomic_load_explicit(&listeners_, std::memory_order_acquire);
+    if (!listeners) {
+      return;
+    }
+    for (auto& listener : *listeners) {
       listener(args...);
     }
   }
 
  private:
+  typedef std::vector<Listener> ListenerList;
+
+  // Guards mutation only; invocation never takes it.
   std::mutex lock_;
-  std::vector<Listener> listeners_;
+  std::shared_ptr<const ListenerList> listeners_;
 };
 
 template <>
@@ -52,24 +72,38 @@ class Delegate<void> {
 
   void AddListener(Listener const& listener) {
     std::lock_guard<std::mutex> guard(lock_);
-    listeners_.push_back(listener);
+    auto new_list = listeners_ ? std::make_shared<ListenerList>(*listeners_)
+                               : std::make_shared<ListenerList>();
+    new_list->push_back(listener);
+    std::atomic_store_explicit(
+        &listeners_, std::shared_ptr<const ListenerList>(std::move(new_list)),
+        std::memory_order_release);
   }
 
   void RemoveAllListeners() {
     std::lock_guard<std::mutex> guard(lock_);
-    listeners_.clear();
+    std::atomic_store_explicit(&listeners_,
+                               std::shared_ptr<const ListenerList>(),
+                               std::memory_order_release);
   }
 
   void operator()() {
-    std::lock_guard<std::mutex> guard(lock_);
-    for (auto& listener : listeners_) {
+    auto listeners =
+        std::atomic_load_explicit(&listeners_, std::memory_order_acquire);
+    if (!listeners) {
+      return;
+    }
+    for (auto& listener : *listeners) {
       listener();
     }
   }
 
  private:
+  typedef std::vector<Listener> ListenerList;
+
+  // Guards mutation only; invocation never takes it.
   std::mutex lock_;
-  std::vector<Listener> listeners_;
+  std::shared_ptr<const ListenerList> listeners_;
 };
 
 }  // namespace xe
@@ -10,6 +10,7 @@
 #ifndef XENIA_BASE_FILESYSTEM_H_
 #define XENIA_BASE_FILESYSTEM_H_
 
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <string>
@@ -103,6 +104,10 @@ class FileHandle {
   // Flushes any pending write buffers to the underlying filesystem.
   virtual void Flush() = 0;
 
+  // Hints that the given byte range will be read soon so the host can start
+  // readahead. Best-effort; the default does nothing.
+  virtual void Prefetch(size_t offset, size_t length) {}
+
  protected:
   explicit FileHandle(std::wstring path) : path_(std::move(path)) {}
 
@@ -125,6 +130,15 @@ struct FileInfo {
 bool GetInfo(const std::wstring& path, FileInfo* out_info);
 std::vector<FileInfo> ListFiles(const std::wstring& path);
 
+// Streams the entries of a directory to the callback one at a time, skipping
+// "." and "..". Unlike ListFiles this materializes no vector, so callers
+// that build their own structures (such as VFS mounts of directories with
+// tens of thousands of files) avoid a full second copy. Return false from
+// the callback to stop enumerating. Returns false if the directory could not
+// be opened.
+bool EnumerateFiles(const std::wstring& path,
+                    const std::function<bool(const FileInfo&)>& callback);
+
 }  // namespace filesystem
 }  // namespace xe
 
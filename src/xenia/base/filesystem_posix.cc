@@ -148,6 +148,11 @@ class PosixFileHandle : public FileHandle {
     return ftruncate(handle_, length) >= 0 ? true : false;
   }
   void Flush() override { fsync(handle_); }
+  void Prefetch(size_t offset, size_t length) override {
+#if defined(POSIX_FADV_WILLNEED)
+    posix_fadvise(handle_, offset, length, POSIX_FADV_WILLNEED);
+#endif
+  }
 
  private:
   int handle_ = -1;
@@ -201,33 +206,49 @@ bool GetInfo(const std::wstring& path, FileInfo* out_info) {
   return false;
 }
 
-std::vector<FileInfo> ListFiles(const std::wstring& path) {
-  std::vector<FileInfo> result;
-
+bool EnumerateFiles(const std::wstring& path,
+                    const std::function<bool(const FileInfo&)>& callback) {
   DIR* dir = opendir(xe::to_string(path).c_str());
   if (!dir) {
-    return result;
+    return false;
   }
+  int dir_fd = dirfd(dir);
 
+  FileInfo info;
+  info.path = path;
   while (auto ent = readdir(dir)) {
-    FileInfo info;
-
+    if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) {
+      continue;
+    }
     info.name = xe::to_wstring(ent->d_name);
-    struct stat st;
-    stat((xe::to_string(path) + xe::to_string(info.name)).c_str(), &st);
+    // fstatat against the already-open directory avoids rebuilding and
+    // re-walking the full path string for every entry.
+    struct stat st = {};
+    fstatat(dir_fd, ent->d_name, &st, 0);
     info.create_timestamp = convertUnixtimeToWinFiletime(st.st_ctime);
     info.access_timestamp = convertUnixtimeToWinFiletime(st.st_atime);
     info.write_timestamp = convertUnixtimeToWinFiletime(st.st_mtime);
-    if (ent->d_type == DT_DIR) {
+    if (S_ISDIR(st.st_mode)) {
       info.type = FileInfo::Type::kDirectory;
       info.total_size = 0;
     } else {
       info.type = FileInfo::Type::kFile;
       info.total_size = st.st_size;
     }
-    result.push_back(info);
+    if (!callback(info)) {
+      break;
+    }
   }
+  closedir(dir);
+  return true;
+}
 
+std::vector<FileInfo> ListFiles(const std::wstring& path) {
+  std::vector<FileInfo> result;
+  EnumerateFiles(path, [&result](const FileInfo& info) {
+    result.push_back(info);
+    return true;
+  });
   return result;
 }
 
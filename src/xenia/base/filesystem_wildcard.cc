@@ -9,12 +9,49 @@
 
 #include "xenia/base/filesystem_wildcard.h"
 #include "xenia/base/assert.h"
+#include "xenia/base/platform.h"
 
 #include <algorithm>
+#include <cstring>
+
+#if XE_ARCH_AMD64
+#include <emmintrin.h>
+#endif  // XE_ARCH_AMD64
 
 namespace xe {
 namespace filesystem {
 
+namespace {
+
+// ASCII-lowercases length bytes of src into dst. Directory queries fold every
+// candidate name once per match, so this is the hot loop of wildcard searches.
+void CaseFoldAscii(const char* src, char* dst, size_t length) {
+#if XE_ARCH_AMD64
+  // Bytes in ['A','Z'] get 0x20 added; signed compares leave high-bit bytes
+  // untouched, matching scalar tolower on ASCII.
+  __m128i lower_bound = _mm_set1_epi8('A' - 1);
+  __m128i upper_bound = _mm_set1_epi8('Z' + 1);
+  __m128i fold_bit = _mm_set1_epi8(0x20);
+  while (length >= 16) {
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i is_upper =
+        _mm_and_si128(_mm_cmpgt_epi8(value, lower_bound),
+                      _mm_cmpgt_epi8(upper_bound, value));
+    value = _mm_add_epi8(value, _mm_and_si128(is_upper, fold_bit));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value);
+    src += 16;
+    dst += 16;
+    length -= 16;
+  }
+#endif  // XE_ARCH_AMD64
+  for (; length; --length) {
+    char c = *src++;
+    *dst++ = c >= 'A' && c <= 'Z' ? c + 0x20 : c;
+  }
+}
+
+}  // namespace
+
 WildcardFlags WildcardFlags::FIRST(true, false, false);
 WildcardFlags WildcardFlags::LAST(false, true, false);
 WildcardFlags WildcardFlags::ANY(false, false, true);
@@ -31,13 +68,13 @@ WildcardRule::WildcardRule(const std::string& str_match,
   std::transform(match.begin(), match.end(), match.begin(), tolower);
 }
 
-bool WildcardRule::Check(const std::string& str_lower,
+bool WildcardRule::Check(const char* str_lower, size_t str_length,
                          std::string::size_type* offset) const {
   if (match.empty()) {
     return true;
   }
 
-  if ((str_lower.size() - *offset) < match.size()) {
+  if ((str_length - *offset) < match.size()) {
     return false;
   }
 
@@ -46,14 +83,32 @@ bool WildcardRule::Check(const std::string& str_lower,
     return true;
   }
 
-  std::string::size_type result(str_lower.find(match, *offset));
+  // Find the first occurrence at or after the offset: skip to candidate
+  // positions of the leading character with memchr, then compare the rest.
+  std::string::size_type result = std::string::npos;
+  size_t last_start = str_length - match.size();
+  size_t pos = *offset;
+  while (pos <= last_start) {
+    const void* found =
+        std::memchr(str_lower + pos, match[0], last_start - pos + 1);
+    if (!found) {
+      break;
+    }
+    pos = static_cast<const char*>(found) - str_lower;
+    if (!std::memcmp(str_lower + pos + 1, match.data() + 1,
+                     match.size() - 1)) {
+      result = pos;
+      break;
+    }
+    ++pos;
+  }
 
   if (result != std::string::npos) {
     if (rules.FromStart && result != *offset) {
       return false;
     }
 
-    if (rules.ToEnd && result != (str_lower.size() - match.size())) {
+    if (rules.ToEnd && result != (str_length - match.size())) {
       return false;
     }
 
@@ -95,16 +150,31 @@ void WildcardEngine::PreparePattern(const std::string& pattern) {
 }
 
 void WildcardEngine::SetRule(const std::string& pattern) {
+  // Titles commonly re-issue the same query every few seconds; an unchanged
+  // pattern reuses the compiled rule list.
+  if (pattern == compiled_pattern_ && !rules.empty()) {
+    return;
+  }
   PreparePattern(pattern);
+  compiled_pattern_ = pattern;
 }
 
 bool WildcardEngine::Match(const std::string& str) const {
-  std::string str_lc;
-  std::transform(str.begin(), str.end(), std::back_inserter(str_lc), tolower);
+  // Case-fold into a stack buffer - this runs per directory child and a heap
+  // allocation per candidate dominates the match itself. Guest names are
+  // capped well below the buffer; spill to the heap just in case.
+  char stack_buffer[256];
+  std::unique_ptr<char[]> heap_buffer;
+  char* str_lower = stack_buffer;
+  if (str.size() > sizeof(stack_buffer)) {
+    heap_buffer.reset(new char[str.size()]);
+    str_lower = heap_buffer.get();
+  }
+  CaseFoldAscii(str.data(), str_lower, str.size());
 
   std::string::size_type offset(0);
   for (const auto& rule : rules) {
-    if (!(rule.Check(str_lc, &offset))) {
+    if (!(rule.Check(str_lower, str.size(), &offset))) {
       return false;
     }
   }
@@ -35,7 +35,7 @@ class WildcardFlags {
 class WildcardRule {
  public:
   WildcardRule(const std::string& str_match, const WildcardFlags& flags);
-  bool Check(const std::string& str_lower,
+  bool Check(const char* str_lower, size_t str_length,
              std::string::size_type* offset) const;
 
  private:
@@ -45,6 +45,8 @@ class WildcardRule {
 
 class WildcardEngine {
  public:
+  // Compiles the pattern, reusing the previous compilation when the pattern
+  // is unchanged (titles poll directory queries with the same wildcard).
   void SetRule(const std::string& pattern);
 
   // Always ignoring case
@@ -52,6 +54,7 @@ class WildcardEngine {
 
  private:
   std::vector<WildcardRule> rules;
+  std::string compiled_pattern_;
   void PreparePattern(const std::string& pattern);
 };
 
@@ -213,20 +213,20 @@ bool GetInfo(const std::wstring& path, FileInfo* out_info) {
   return true;
 }
 
-std::vector<FileInfo> ListFiles(const std::wstring& path) {
-  std::vector<FileInfo> result;
-
+bool EnumerateFiles(const std::wstring& path,
+                    const std::function<bool(const FileInfo&)>& callback) {
   WIN32_FIND_DATA ffd;
   HANDLE handle = FindFirstFile((path + L"\\*").c_str(), &ffd);
   if (handle == INVALID_HANDLE_VALUE) {
-    return result;
+    return false;
   }
+  FileInfo info;
+  info.path = path;
   do {
     if (std::wcscmp(ffd.cFileName, L".") == 0 ||
         std::wcscmp(ffd.cFileName, L"..") == 0) {
       continue;
     }
-    FileInfo info;
     if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
       info.type = FileInfo::Type::kDirectory;
       info.total_size = 0;
@@ -235,15 +235,24 @@ std::vector<FileInfo> ListFiles(const std::wstring& path) {
       info.total_size =
           (ffd.nFileSizeHigh * (size_t(MAXDWORD) + 1)) + ffd.nFileSizeLow;
     }
-    info.path = path;
     info.name = ffd.cFileName;
     info.create_timestamp = COMBINE_TIME(ffd.ftCreationTime);
     info.access_timestamp = COMBINE_TIME(ffd.ftLastAccessTime);
     info.write_timestamp = COMBINE_TIME(ffd.ftLastWriteTime);
-    result.push_back(info);
+    if (!callback(info)) {
+      break;
+    }
   } while (FindNextFile(handle, &ffd) != 0);
   FindClose(handle);
+  return true;
+}
 
+std::vector<FileInfo> ListFiles(const std::wstring& path) {
+  std::vector<FileInfo> result;
+  EnumerateFiles(path, [&result](const FileInfo& info) {
+    result.push_back(info);
+    return true;
+  });
   return result;
 }
 
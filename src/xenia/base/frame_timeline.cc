@@ -0,0 +1,99 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/base/frame_timeline.h"
+
+#include <algorithm>
+
+#include "xenia/base/clock.h"
+
+namespace xe {
+
+FrameTimeline* FrameTimeline::instance() {
+  static FrameTimeline instance;
+  return &instance;
+}
+
+FrameTimeline::Frame* FrameTimeline::GetFrame(uint64_t frame_id) {
+  if (!frame_id) {
+    return nullptr;
+  }
+  Frame& frame = frames_[frame_id % kFrameCount];
+  // The slot may have been recycled for a newer frame already.
+  return frame.frame_id == frame_id ? &frame : nullptr;
+}
+
+void FrameTimeline::RecordInputPoll() {
+  FrameTimeline* timeline = instance();
+  uint64_t tick = Clock::QueryHostTickCount();
+  std::lock_guard<std::mutex> lock(timeline->mutex_);
+  timeline->last_input_poll_tick_ = tick;
+}
+
+uint64_t FrameTimeline::RecordGuestSwap() {
+  FrameTimeline* timeline = instance();
+  uint64_t tick = Clock::QueryHostTickCount();
+  std::lock_guard<std::mutex> lock(timeline->mutex_);
+  uint64_t frame_id = timeline->next_frame_id_++;
+  Frame& frame = timeline->frames_[frame_id % kFrameCount];
+  frame.frame_id = frame_id;
+  frame.input_poll_tick = timeline->last_input_poll_tick_;
+  frame.guest_start_tick = timeline->last_guest_swap_tick_;
+  frame.guest_swap_tick = tick;
+  frame.gpu_completed_tick = 0;
+  frame.present_tick = 0;
+  timeline->last_guest_swap_tick_ = tick;
+  return frame_id;
+}
+
+void FrameTimeline::RecordGPUCompletion(uint64_t frame_id) {
+  if (!frame_id) {
+    return;
+  }
+  FrameTimeline* timeline = instance();
+  uint64_t tick = Clock::QueryHostTickCount();
+  std::lock_guard<std::mutex> lock(timeline->mutex_);
+  Frame* frame = timeline->GetFrame(frame_id);
+  if (frame) {
+    frame->gpu_completed_tick = tick;
+  }
+}
+
+void FrameTimeline::RecordPresent() {
+  FrameTimeline* timeline = instance();
+  uint64_t tick = Clock::QueryHostTickCount();
+  std::lock_guard<std::mutex> lock(timeline->mutex_);
+  // The host displays the contents of the latest swap, so the newest frame is
+  // the one being picked up. Older frames it left unpresented were overwritten
+  // before the host saw them - their present tick stays zero.
+  Frame* frame = timeline->GetFrame(timeline->next_frame_id_ - 1);
+  if (frame && !frame->present_tick) {
+    frame->present_tick = tick;
+  }
+}
+
+size_t FrameTimeline::CopyFrames(Frame* frames, size_t max_count) {
+  FrameTimeline* timeline = instance();
+  std::lock_guard<std::mutex> lock(timeline->mutex_);
+  uint64_t newest_frame_id = timeline->next_frame_id_ - 1;
+  uint64_t count =
+      std::min(newest_frame_id, std::min(uint64_t(max_count),
+                                         uint64_t(kFrameCount)));
+  size_t frames_written = 0;
+  for (uint64_t frame_id = newest_frame_id - count + 1;
+       frame_id <= newest_frame_id; ++frame_id) {
+    Frame* frame = timeline->GetFrame(frame_id);
+    if (frame) {
+      frames[frames_written++] = *frame;
+    }
+  }
+  return frames_written;
+}
+
+}  // namespace xe
@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_BASE_FRAME_TIMELINE_H_
+#define XENIA_BASE_FRAME_TIMELINE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace xe {
+
+// Stitches the stations one guest frame passes through - input polling, guest
+// production, the command processor swap, GPU execution and the host present -
+// into a single per-frame record, so input-to-photon latency can be read
+// directly instead of being inferred from per-subsystem timings that each
+// cover only their own slice. All timestamps are host ticks
+// (Clock::QueryHostTickCount), recorded from whichever thread the station
+// runs on; a small mutex-protected ring keeps the recent frames for display.
+//
+// Stations that a backend doesn't instrument simply leave their timestamp at
+// zero - the record is still useful for the stations that were hit.
+class FrameTimeline {
+ public:
+  struct Frame {
+    // Sequential guest swap number, zero while the slot is unused.
+    uint64_t frame_id;
+    // The latest input poll that happened before this frame's swap - the
+    // freshest user action the frame can possibly reflect. Zero if input was
+    // never polled.
+    uint64_t input_poll_tick;
+    // When the guest started producing the frame - approximated by the
+    // previous frame's swap. Zero for the first recorded frame.
+    uint64_t guest_start_tick;
+    // When the command processor reached the frame's swap.
+    uint64_t guest_swap_tick;
+    // When the GPU was observed to have finished the frame's submissions.
+    // Polled rather than signaled, so it overestimates by up to the gap until
+    // the backend next checks its fence. Zero if the backend doesn't report
+    // completion.
+    uint64_t gpu_completed_tick;
+    // When the host picked the frame up for presentation. Zero if a newer
+    // frame replaced it before the host got there (a dropped frame).
+    uint64_t present_tick;
+  };
+
+  // Number of recent frames kept - a couple of seconds at 60 FPS.
+  static constexpr size_t kFrameCount = 128;
+
+  // Called whenever the guest polls input.
+  static void RecordInputPoll();
+  // Called by the command processor when it executes a guest swap. Opens the
+  // frame's record and returns its id for later attribution.
+  static uint64_t RecordGuestSwap();
+  // Called by the GPU backend once the submissions of the given frame have
+  // completed on the GPU. Ignores a zero id.
+  static void RecordGPUCompletion(uint64_t frame_id);
+  // Called when the host consumes a pending swap for presentation. Attributed
+  // to the newest swapped frame not yet presented; swapped frames older than
+  // it were dropped.
+  static void RecordPresent();
+
+  // Copies up to max_count of the most recent frame records into frames,
+  // oldest first, and returns how many were written.
+  static size_t CopyFrames(Frame* frames, size_t max_count);
+
+ private:
+  static FrameTimeline* instance();
+
+  Frame* GetFrame(uint64_t frame_id);
+
+  std::mutex mutex_;
+  Frame frames_[kFrameCount] = {};
+  uint64_t next_frame_id_ = 1;
+  uint64_t last_input_poll_tick_ = 0;
+  uint64_t last_guest_swap_tick_ = 0;
+};
+
+}  // namespace xe
+
+#endif  // XENIA_BASE_FRAME_TIMELINE_H_
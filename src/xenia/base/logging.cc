@@ -16,7 +16,6 @@
 #include <mutex>
 #include <vector>
 
-#include "xenia/base/atomic.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/debugging.h"
 #include "xenia/base/filesystem.h"
@@ -94,49 +93,25 @@ class Logger {
     line.thread_id = thread_id;
     line.prefix_char = prefix_char;
 
-    // First, run a check and see if we can increment write
-    // head without any problems. If so, cmpxchg it to reserve some space in the
-    // ring. If someone beats us, loop around.
-    //
-    // Once we have a reservation, write our data and then increment the write
-    // tail.
-    size_t size = sizeof(LogLine) + buffer_length;
-    while (true) {
-      // Attempt to make a reservation.
-      size_t write_head = write_head_;
-      size_t read_head = read_head_;
-
-      RingBuffer rb(buffer_, kBufferSize);
-      rb.set_write_offset(write_head);
-      rb.set_read_offset(read_head);
-      if (rb.write_count() < size) {
-        xe::threading::MaybeYield();
-        continue;
-      }
-
-      // We have enough size to make a reservation!
-      rb.AdvanceWrite(size);
-      if (xe::atomic_cas(write_head, rb.write_offset(), &write_head_)) {
-        // Reservation made. Write out logline.
-        rb.set_write_offset(write_head);
-        rb.Write(&line, sizeof(LogLine));
-        rb.Write(buffer, buffer_length);
-
-        while (!xe::atomic_cas(write_head, rb.write_offset(), &write_tail_)) {
-          // Done writing. End the reservation.
-          xe::threading::MaybeYield();
-        }
-
-        break;
-      } else {
-        // Someone beat us to the chase. Loop around.
-        continue;
+    size_t full_attempts = 0;
+    while (!ring_.TryWrite(&line, sizeof(LogLine), buffer, buffer_length)) {
+      if (++full_attempts >= kMaxFullAttempts) {
+        // The write thread can't keep up - drop the line instead of
+        // stalling the producer, and let the write thread report how many
+        // lines were lost. Blocking here skews the timing of exactly the
+        // code paths being logged.
+        dropped_lines_.fetch_add(1, std::memory_order_relaxed);
+        return;
       }
+      xe::threading::MaybeYield();
     }
   }
 
  private:
   static const size_t kBufferSize = 8 * 1024 * 1024;
+  // How many times a producer retries a reservation on a full ring before
+  // dropping the line.
+  static const size_t kMaxFullAttempts = 64;
 
   struct LogLine {
     size_t buffer_length;
@@ -157,20 +132,21 @@ class Logger {
   }
 
   void WriteThread() {
-    RingBuffer rb(buffer_, kBufferSize);
+    // Log flushing should never contend with the emulator for CPU time or
+    // storage bandwidth.
+    xe::threading::EnterBackgroundMode();
     uint32_t idle_loops = 0;
     while (true) {
       bool did_write = false;
-      rb.set_write_offset(write_tail_);
-      if (!running_ && rb.empty()) {
+      if (!running_ && ring_.empty()) {
         break;
       }
-      while (!rb.empty()) {
+      while (ring_.read_count() >= sizeof(LogLine)) {
         did_write = true;
 
         // Read line header and write out the line prefix.
         LogLine line;
-        rb.Read(&line, sizeof(line));
+        ring_.Read(&line, sizeof(line));
         char prefix[] = {
             line.prefix_char,
             '>',
@@ -192,7 +168,7 @@ class Logger {
         if (line.buffer_length) {
           // Get access to the line data - which may be split in the ring buffer
           // - and write it out in parts.
-          auto line_range = rb.BeginRead(line.buffer_length);
+          auto line_range = ring_.BeginRead(line.buffer_length);
           Write(reinterpret_cast<const char*>(line_range.first),
                 line_range.first_length);
           if (line_range.second_length) {
@@ -207,14 +183,24 @@ class Logger {
             const char suffix[1] = {'\n'};
             Write(suffix, 1);
           }
-          rb.EndRead(std::move(line_range));
+          ring_.EndRead(std::move(line_range));
         } else {
           const char suffix[1] = {'\n'};
           Write(suffix, 1);
         }
-
-        rb.set_write_offset(write_tail_);
-        read_head_ = rb.read_offset();
+      }
+      size_t dropped = dropped_lines_.exchange(0, std::memory_order_relaxed);
+      if (dropped) {
+        char dropped_line[96];
+        int dropped_length = std::snprintf(
+            dropped_line, sizeof(dropped_line),
+            "w> 00000000 Dropped %zu log lines - the log writer couldn't "
+            "keep up\n",
+            dropped);
+        if (dropped_length > 0) {
+          Write(dropped_line, size_t(dropped_length));
+          did_write = true;
+        }
       }
       if (did_write) {
         if (cvars::flush_log) {
@@ -233,16 +219,23 @@ class Logger {
     }
   }
 
-  volatile size_t write_tail_ = 0;
-  size_t write_head_ = 0;
-  size_t read_head_ = 0;
   uint8_t buffer_[kBufferSize];
+  MpscRingBuffer ring_{buffer_, kBufferSize};
   FILE* file_ = nullptr;
 
   std::atomic<bool> running_;
+  std::atomic<size_t> dropped_lines_{0};
   std::unique_ptr<xe::threading::Thread> write_thread_;
 };
 
+// Checks the level before any formatting is done - filtered-out lines (such
+// as debug logging with the default log_level) shouldn't pay for vsnprintf on
+// the calling thread.
+bool ShouldLog(LogLevel log_level) {
+  return logger_ != nullptr &&
+         static_cast<int32_t>(log_level) <= cvars::log_level;
+}
+
 void InitializeLogging(const std::wstring& app_name) {
   auto mem = memory::AlignedAlloc<Logger>(0x10);
   logger_ = new (mem) Logger(app_name);
@@ -258,7 +251,7 @@ void ShutdownLogging() {
 
 void LogLineFormat(LogLevel log_level, const char prefix_char, const char* fmt,
                    ...) {
-  if (!logger_) {
+  if (!ShouldLog(log_level)) {
     return;
   }
 
@@ -278,7 +271,7 @@ void LogLineFormat(LogLevel log_level, const char prefix_char, const char* fmt,
 
 void LogLineVarargs(LogLevel log_level, const char prefix_char, const char* fmt,
                     va_list args) {
-  if (!logger_) {
+  if (!ShouldLog(log_level)) {
     return;
   }
 
@@ -296,7 +289,7 @@ void LogLineVarargs(LogLevel log_level, const char prefix_char, const char* fmt,
 
 void LogLine(LogLevel log_level, const char prefix_char, const char* str,
              size_t str_length) {
-  if (!logger_) {
+  if (!ShouldLog(log_level)) {
     return;
   }
 
@@ -307,7 +300,7 @@ void LogLine(LogLevel log_level, const char prefix_char, const char* str,
 
 void LogLine(LogLevel log_level, const char prefix_char,
              const std::string& str) {
-  if (!logger_) {
+  if (!ShouldLog(log_level)) {
     return;
   }
 
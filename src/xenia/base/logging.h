@@ -37,6 +37,12 @@ enum class LogLevel {
 void InitializeLogging(const std::wstring& app_name);
 void ShutdownLogging();
 
+// Returns true if a line at the given level would be written to the log.
+// Callers assembling expensive log lines by hand (rather than through the
+// XELOG* macros, which filter internally) should check this first so
+// filtered-out lines don't pay for formatting.
+bool ShouldLog(LogLevel log_level);
+
 // Appends a line to the log with printf-style formatting.
 void LogLineFormat(LogLevel log_level, const char prefix_char, const char* fmt,
                    ...);
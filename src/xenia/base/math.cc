@@ -9,6 +9,14 @@
 
 #include "xenia/base/math.h"
 
+#include <cstring>
+
+#include "xenia/base/platform.h"
+
+#if XE_ARCH_AMD64
+#include <immintrin.h>
+#endif  // XE_ARCH_AMD64
+
 namespace xe {
 
 // TODO(benvanik): replace with alternate implementation.
@@ -66,4 +74,99 @@ float half_to_float(uint16_t value) {
   return *reinterpret_cast<float*>(&Result);
 }
 
+#if XE_ARCH_AMD64
+
+// Like the AVX2 swap kernels in memory.cc, the F16C kernels are compiled with
+// the extension enabled regardless of the build target and are selected at
+// runtime. The partial final vector is converted through a zero-padded
+// temporary rather than the scalar routines so out-of-range values are
+// rounded the same way in the tail as in the body.
+
+#if XE_COMPILER_MSVC
+#define XE_TARGET_F16C
+#else
+#define XE_TARGET_F16C __attribute__((target("f16c")))
+#endif  // XE_COMPILER_MSVC
+
+namespace {
+
+bool DetectF16C() {
+#if XE_COMPILER_MSVC
+  int cpu_info[4];
+  __cpuid(cpu_info, 1);
+  return (cpu_info[2] & (1 << 29)) != 0;
+#else
+  return __builtin_cpu_supports("f16c");
+#endif  // XE_COMPILER_MSVC
+}
+
+bool SupportsF16C() {
+  static bool supported = DetectF16C();
+  return supported;
+}
+
+XE_TARGET_F16C void float_to_half_f16c(uint16_t* dest, const float* src,
+                                       size_t count) {
+  size_t i;
+  for (i = 0; i + 8 <= count; i += 8) {
+    __m128i output = _mm256_cvtps_ph(_mm256_loadu_ps(&src[i]),
+                                     _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]), output);
+  }
+  if (i < count) {
+    alignas(32) float src_tail[8] = {};
+    alignas(16) uint16_t dest_tail[8];
+    std::memcpy(src_tail, &src[i], (count - i) * sizeof(float));
+    __m128i output = _mm256_cvtps_ph(_mm256_load_ps(src_tail),
+                                     _MM_FROUND_TO_NEAREST_INT);
+    _mm_store_si128(reinterpret_cast<__m128i*>(dest_tail), output);
+    std::memcpy(&dest[i], dest_tail, (count - i) * sizeof(uint16_t));
+  }
+}
+
+XE_TARGET_F16C void half_to_float_f16c(float* dest, const uint16_t* src,
+                                       size_t count) {
+  size_t i;
+  for (i = 0; i + 8 <= count; i += 8) {
+    __m128i input =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+    _mm256_storeu_ps(&dest[i], _mm256_cvtph_ps(input));
+  }
+  if (i < count) {
+    alignas(16) uint16_t src_tail[8] = {};
+    alignas(32) float dest_tail[8];
+    std::memcpy(src_tail, &src[i], (count - i) * sizeof(uint16_t));
+    _mm256_store_ps(dest_tail,
+                    _mm256_cvtph_ps(
+                        _mm_load_si128(reinterpret_cast<__m128i*>(src_tail))));
+    std::memcpy(&dest[i], dest_tail, (count - i) * sizeof(float));
+  }
+}
+
+}  // namespace
+
+#endif  // XE_ARCH_AMD64
+
+void float_to_half(uint16_t* dest, const float* src, size_t count) {
+#if XE_ARCH_AMD64
+  if (count >= 8 && SupportsF16C()) {
+    return float_to_half_f16c(dest, src, count);
+  }
+#endif  // XE_ARCH_AMD64
+  for (size_t i = 0; i < count; ++i) {
+    dest[i] = float_to_half(src[i]);
+  }
+}
+
+void half_to_float(float* dest, const uint16_t* src, size_t count) {
+#if XE_ARCH_AMD64
+  if (count >= 8 && SupportsF16C()) {
+    return half_to_float_f16c(dest, src, count);
+  }
+#endif  // XE_ARCH_AMD64
+  for (size_t i = 0; i < count; ++i) {
+    dest[i] = half_to_float(src[i]);
+  }
+}
+
 }  // namespace xe
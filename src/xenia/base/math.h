@@ -249,6 +249,36 @@ inline bool bit_scan_forward(int64_t v, uint32_t* out_first_set_index) {
   return bit_scan_forward(static_cast<uint64_t>(v), out_first_set_index);
 }
 
+// BitScanReverse (bsr).
+// Search the value from most significant bit (MSB) to the least significant
+// bit (LSB) for a set bit (1).
+// Returns false if no bits are set and the output index is invalid.
+#if XE_PLATFORM_WIN32
+inline bool bit_scan_reverse(uint32_t v, uint32_t* out_last_set_index) {
+  return _BitScanReverse(reinterpret_cast<unsigned long*>(out_last_set_index),
+                         v) != 0;
+}
+inline bool bit_scan_reverse(uint64_t v, uint32_t* out_last_set_index) {
+  return _BitScanReverse64(
+             reinterpret_cast<unsigned long*>(out_last_set_index), v) != 0;
+}
+#else
+inline bool bit_scan_reverse(uint32_t v, uint32_t* out_last_set_index) {
+  if (!v) {
+    return false;
+  }
+  *out_last_set_index = 31 - __builtin_clz(v);
+  return true;
+}
+inline bool bit_scan_reverse(uint64_t v, uint32_t* out_last_set_index) {
+  if (!v) {
+    return false;
+  }
+  *out_last_set_index = 63 - __builtin_clzll(v);
+  return true;
+}
+#endif  // XE_PLATFORM_WIN32
+
 template <typename T>
 inline T log2_floor(T v) {
   return sizeof(T) * 8 - 1 - lzcnt(v);
@@ -332,6 +362,12 @@ int64_t m128_i64(const __m128& v) {
 uint16_t float_to_half(float value);
 float half_to_float(uint16_t value);
 
+// Batch conversion between tightly packed arrays of halfs and floats, for
+// texel and vertex data conversion. Uses F16C hardware conversion when the
+// CPU supports it, with the scalar routines above as the fallback.
+void float_to_half(uint16_t* dest, const float* src, size_t count);
+void half_to_float(float* dest, const uint16_t* src, size_t count);
+
 // https://locklessinc.com/articles/sat_arithmetic/
 template <typename T>
 inline T sat_add(T a, T b) {
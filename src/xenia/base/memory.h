@@ -53,6 +53,17 @@ enum class DeallocationType {
 void* AllocFixed(void* base_address, size_t length,
                  AllocationType allocation_type, PageAccess access);
 
+// Returns the NUMA node the calling thread is currently running on, or 0 on
+// single-node systems and platforms where the node cannot be queried.
+uint32_t current_numa_node();
+
+// AllocFixed, with the physical pages backing the region preferring the given
+// NUMA node. Advisory only: platforms without an explicit placement API
+// allocate normally and rely on first-touch placement, and Windows falls back
+// to other nodes when the preferred one is out of pages.
+void* AllocFixedOnNode(uint32_t numa_node, void* base_address, size_t length,
+                       AllocationType allocation_type, PageAccess access);
+
 // Deallocates and/or releases the given block of memory.
 // When releasing memory length must be zero, as all pages in the region are
 // released.
@@ -70,6 +81,12 @@ bool Protect(void* base_address, size_t length, PageAccess access,
 // the region.
 bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out);
 
+// Requests that the OS back the given region with large (2MB) pages where it
+// can, reducing TLB pressure on hot regions such as JIT code. Advisory only:
+// platforms that cannot honor the request keep regular pages and the region
+// behaves identically.
+void AdviseLargePages(void* base_address, size_t length);
+
 // Allocates a block of memory for a type with the given alignment.
 // The memory must be freed with AlignedFree.
 template <typename T>
@@ -103,6 +120,12 @@ void CloseFileMappingHandle(FileMappingHandle handle);
 void* MapFileView(FileMappingHandle handle, void* base_address, size_t length,
                   PageAccess access, size_t file_offset);
 bool UnmapFileView(FileMappingHandle handle, void* base_address, size_t length);
+// Returns the physical pages backing the given page-aligned range of a file
+// mapping to the OS, dropping them from every mapped view at once. The range
+// reads back as zeroes if touched again. Returns false on platforms without a
+// way to punch holes in a mapping, in which case the pages stay resident.
+bool DiscardFileViewRange(FileMappingHandle handle, size_t file_offset,
+                          size_t length);
 
 inline size_t hash_combine(size_t seed) { return seed; }
 
@@ -8,12 +8,17 @@
  */
 
 #include "xenia/base/memory.h"
+#include "xenia/base/platform.h"
 #include "xenia/base/string.h"
 
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>
 
+#if XE_PLATFORM_LINUX
+#include <sys/syscall.h>
+#endif  // XE_PLATFORM_LINUX
+
 namespace xe {
 namespace memory {
 
@@ -43,6 +48,25 @@ void* AllocFixed(void* base_address, size_t length,
   return mmap(base_address, length, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 }
 
+uint32_t current_numa_node() {
+#if XE_PLATFORM_LINUX
+  unsigned int cpu = 0;
+  unsigned int node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return node;
+  }
+#endif  // XE_PLATFORM_LINUX
+  return 0;
+}
+
+void* AllocFixedOnNode(uint32_t numa_node, void* base_address, size_t length,
+                       AllocationType allocation_type, PageAccess access) {
+  // Anonymous pages already land on the node of the first touching thread
+  // under the default first-touch policy, which is the placement callers of
+  // this function want; no explicit binding needed.
+  return AllocFixed(base_address, length, allocation_type, access);
+}
+
 bool DeallocFixed(void* base_address, size_t length,
                   DeallocationType deallocation_type) {
   return munmap(base_address, length) == 0;
@@ -61,6 +85,15 @@ bool QueryProtect(void* base_address, size_t& length, PageAccess& access_out) {
   return false;
 }
 
+void AdviseLargePages(void* base_address, size_t length) {
+#if defined(MADV_HUGEPAGE)
+  // Transparent huge pages: the kernel promotes aligned 2MB extents as they
+  // fault in when it has huge pages available, and silently keeps 4KB pages
+  // otherwise.
+  madvise(base_address, length, MADV_HUGEPAGE);
+#endif  // MADV_HUGEPAGE
+}
+
 FileMappingHandle CreateFileMappingHandle(std::wstring path, size_t length,
                                           PageAccess access, bool commit) {
   int oflag;
@@ -96,8 +129,15 @@ void CloseFileMappingHandle(FileMappingHandle handle) {
 void* MapFileView(FileMappingHandle handle, void* base_address, size_t length,
                   PageAccess access, size_t file_offset) {
   uint32_t prot = ToPosixProtectFlags(access);
-  return mmap64(base_address, length, prot, MAP_PRIVATE | MAP_ANONYMOUS,
-                reinterpret_cast<intptr_t>(handle), file_offset);
+  // MAP_SHARED on the shm fd so that multiple views of the same mapping
+  // alias the same physical pages, matching the Win32 section semantics.
+  int flags = MAP_SHARED;
+  if (base_address) {
+    flags |= MAP_FIXED;
+  }
+  void* result = mmap64(base_address, length, prot, flags,
+                        reinterpret_cast<intptr_t>(handle), file_offset);
+  return result == MAP_FAILED ? nullptr : result;
 }
 
 bool UnmapFileView(FileMappingHandle handle, void* base_address,
@@ -105,5 +145,16 @@ bool UnmapFileView(FileMappingHandle handle, void* base_address,
   return munmap(base_address, length) == 0;
 }
 
+bool DiscardFileViewRange(FileMappingHandle handle, size_t file_offset,
+                          size_t length) {
+#if defined(FALLOC_FL_PUNCH_HOLE)
+  return fallocate(int(reinterpret_cast<intptr_t>(handle)),
+                   FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                   off_t(file_offset), off_t(length)) == 0;
+#else
+  return false;
+#endif  // FALLOC_FL_PUNCH_HOLE
+}
+
 }  // namespace memory
 }  // namespace xe
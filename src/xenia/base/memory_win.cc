@@ -70,27 +70,47 @@ PageAccess ToXeniaProtectFlags(DWORD access) {
   }
 }
 
-void* AllocFixed(void* base_address, size_t length,
-                 AllocationType allocation_type, PageAccess access) {
-  DWORD alloc_type = 0;
+DWORD ToWin32AllocationType(AllocationType allocation_type) {
   switch (allocation_type) {
     case AllocationType::kReserve:
-      alloc_type = MEM_RESERVE;
-      break;
+      return MEM_RESERVE;
     case AllocationType::kCommit:
-      alloc_type = MEM_COMMIT;
-      break;
+      return MEM_COMMIT;
     case AllocationType::kReserveCommit:
-      alloc_type = MEM_RESERVE | MEM_COMMIT;
-      break;
+      return MEM_RESERVE | MEM_COMMIT;
     default:
       assert_unhandled_case(allocation_type);
-      break;
+      return 0;
   }
+}
+
+void* AllocFixed(void* base_address, size_t length,
+                 AllocationType allocation_type, PageAccess access) {
+  DWORD alloc_type = ToWin32AllocationType(allocation_type);
   DWORD protect = ToWin32ProtectFlags(access);
   return VirtualAlloc(base_address, length, alloc_type, protect);
 }
 
+uint32_t current_numa_node() {
+  PROCESSOR_NUMBER processor_number;
+  GetCurrentProcessorNumberEx(&processor_number);
+  USHORT node = 0;
+  if (!GetNumaProcessorNodeEx(&processor_number, &node)) {
+    return 0;
+  }
+  return node;
+}
+
+void* AllocFixedOnNode(uint32_t numa_node, void* base_address, size_t length,
+                       AllocationType allocation_type, PageAccess access) {
+  DWORD alloc_type = ToWin32AllocationType(allocation_type);
+  DWORD protect = ToWin32ProtectFlags(access);
+  // Preferred, not mandatory - the kernel falls back to other nodes when the
+  // requested one has no free pages.
+  return VirtualAllocExNuma(GetCurrentProcess(), base_address, length,
+                            alloc_type, protect, numa_node);
+}
+
 bool DeallocFixed(void* base_address, size_t length,
                   DeallocationType deallocation_type) {
   DWORD free_type = 0;
@@ -109,6 +129,12 @@ bool DeallocFixed(void* base_address, size_t length,
   return VirtualFree(base_address, length, free_type) ? true : false;
 }
 
+void AdviseLargePages(void* base_address, size_t length) {
+  // Windows only grants large pages at allocation time (MEM_LARGE_PAGES, which
+  // additionally requires SeLockMemoryPrivilege) and cannot promote an
+  // existing region, so there is nothing to do here.
+}
+
 bool Protect(void* base_address, size_t length, PageAccess access,
              PageAccess* out_old_access) {
   if (out_old_access) {
@@ -182,5 +208,12 @@ bool UnmapFileView(FileMappingHandle handle, void* base_address,
   return UnmapViewOfFile(base_address) ? true : false;
 }
 
+bool DiscardFileViewRange(FileMappingHandle handle, size_t file_offset,
+                          size_t length) {
+  // Win32 has no way to punch a hole in a section; freed ranges stay
+  // resident until the section is destroyed.
+  return false;
+}
+
 }  // namespace memory
 }  // namespace xe
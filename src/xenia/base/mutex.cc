@@ -9,6 +9,18 @@
 
 #include "xenia/base/mutex.h"
 
+#include "xenia/base/profiling.h"
+
+#if XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+#include <algorithm>
+#include <cinttypes>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "xenia/base/logging.h"
+#endif  // XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+
 namespace xe {
 
 std::recursive_mutex& global_critical_region::mutex() {
@@ -16,4 +28,68 @@ std::recursive_mutex& global_critical_region::mutex() {
   return global_mutex;
 }
 
+namespace {
+StatCounter count_contended_acquires(
+    "base/global_critical_region/contended_acquires");
+}  // namespace
+
+void global_critical_region::CountContendedAcquire() {
+  count_contended_acquires.Increment();
+}
+
+#if XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+
+namespace {
+
+struct GlobalLockSiteStats {
+  uint64_t acquire_count = 0;
+  uint64_t wait_us = 0;
+  uint64_t hold_us = 0;
+};
+
+std::mutex global_lock_stats_mutex_;
+// Keyed by the call site string pointer - callers pass literals, so pointer
+// identity is stable and cheaper than hashing the contents.
+std::unordered_map<const char*, GlobalLockSiteStats> global_lock_stats_;
+
+}  // namespace
+
+void RecordGlobalLockAcquire(const char* call_site, uint64_t wait_us) {
+  std::lock_guard<std::mutex> lock(global_lock_stats_mutex_);
+  auto& stats = global_lock_stats_[call_site];
+  ++stats.acquire_count;
+  stats.wait_us += wait_us;
+}
+
+void RecordGlobalLockRelease(const char* call_site, uint64_t hold_us) {
+  std::lock_guard<std::mutex> lock(global_lock_stats_mutex_);
+  global_lock_stats_[call_site].hold_us += hold_us;
+}
+
+void global_critical_region::LogContentionReport() {
+  std::vector<std::pair<const char*, GlobalLockSiteStats>> sites;
+  {
+    std::lock_guard<std::mutex> lock(global_lock_stats_mutex_);
+    sites.assign(global_lock_stats_.begin(), global_lock_stats_.end());
+  }
+  std::sort(sites.begin(), sites.end(),
+            [](const std::pair<const char*, GlobalLockSiteStats>& a,
+               const std::pair<const char*, GlobalLockSiteStats>& b) {
+              return a.second.hold_us > b.second.hold_us;
+            });
+  XELOGI("global_critical_region contention report:");
+  XELOGI("%12s %12s %12s  %s", "acquires", "wait us", "hold us", "call site");
+  for (const auto& site : sites) {
+    XELOGI("%12" PRIu64 " %12" PRIu64 " %12" PRIu64 "  %s",
+           site.second.acquire_count, site.second.wait_us, site.second.hold_us,
+           site.first ? site.first : "<unattributed>");
+  }
+}
+
+#else
+
+void global_critical_region::LogContentionReport() {}
+
+#endif  // XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+
 }  // namespace xe
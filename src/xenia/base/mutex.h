@@ -12,8 +12,81 @@
 
 #include <mutex>
 
+// When non-zero, global_critical_region acquisitions are timed and aggregated
+// per call site so the heaviest users of the global lock can be identified
+// (and migrated to a fine_grained_region). Adds two clock queries and a map
+// update to every acquisition - leave disabled except when investigating
+// contention.
+#ifndef XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+#define XE_GLOBAL_CRITICAL_REGION_INSTRUMENT 0
+#endif  // XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+
+#if XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+#include <chrono>
+#include <cstdint>
+#endif  // XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+
 namespace xe {
 
+#if XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+// Accumulates wait and hold times for one global critical region call site.
+// Sites are keyed by the string pointer passed to Acquire, so pass a literal
+// (typically __FUNCTION__).
+void RecordGlobalLockAcquire(const char* call_site, uint64_t wait_us);
+void RecordGlobalLockRelease(const char* call_site, uint64_t hold_us);
+
+// Instrumented replacement for std::unique_lock on the global mutex,
+// supporting the subset of its interface the call sites use.
+class global_lock_guard {
+ public:
+  global_lock_guard(std::recursive_mutex& mutex, const char* call_site,
+                    bool try_only)
+      : lock_(mutex, std::defer_lock), call_site_(call_site) {
+    if (try_only) {
+      if (lock_.try_lock()) {
+        RecordGlobalLockAcquire(call_site_, 0);
+        acquire_time_ = std::chrono::steady_clock::now();
+      }
+    } else {
+      lock();
+    }
+  }
+  global_lock_guard(global_lock_guard&& other) = default;
+  global_lock_guard& operator=(global_lock_guard&& other) = default;
+  global_lock_guard(const global_lock_guard&) = delete;
+  global_lock_guard& operator=(const global_lock_guard&) = delete;
+  ~global_lock_guard() {
+    if (lock_.owns_lock()) {
+      unlock();
+    }
+  }
+
+  void lock() {
+    auto wait_start = std::chrono::steady_clock::now();
+    lock_.lock();
+    acquire_time_ = std::chrono::steady_clock::now();
+    RecordGlobalLockAcquire(
+        call_site_, std::chrono::duration_cast<std::chrono::microseconds>(
+                        acquire_time_ - wait_start)
+                        .count());
+  }
+  void unlock() {
+    auto release_time = std::chrono::steady_clock::now();
+    lock_.unlock();
+    RecordGlobalLockRelease(
+        call_site_, std::chrono::duration_cast<std::chrono::microseconds>(
+                        release_time - acquire_time_)
+                        .count());
+  }
+  bool owns_lock() const { return lock_.owns_lock(); }
+
+ private:
+  std::unique_lock<std::recursive_mutex> lock_;
+  const char* call_site_;
+  std::chrono::steady_clock::time_point acquire_time_;
+};
+#endif  // XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+
 // The global critical region mutex singleton.
 // This must guard any operation that may suspend threads or be sensitive to
 // being suspended such as global table locks and such.
@@ -56,24 +129,79 @@ class global_critical_region {
  public:
   static std::recursive_mutex& mutex();
 
+  // Logs the accumulated per-call-site wait/hold statistics. No-op unless
+  // built with XE_GLOBAL_CRITICAL_REGION_INSTRUMENT.
+  static void LogContentionReport();
+
+  // Increments the always-on contended-acquisition telemetry counter. Out of
+  // line so the uncontended fast path stays a bare try_lock.
+  static void CountContendedAcquire();
+
+#if XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+  // The call_site string identifies the acquisition in the contention report;
+  // pass a literal such as __FUNCTION__. Unattributed acquisitions are
+  // aggregated under one bucket.
+  static global_lock_guard AcquireDirect(const char* call_site = nullptr) {
+    return global_lock_guard(mutex(), call_site, false);
+  }
+  inline global_lock_guard Acquire(const char* call_site = nullptr) {
+    return global_lock_guard(mutex(), call_site, false);
+  }
+  inline global_lock_guard TryAcquire(const char* call_site = nullptr) {
+    return global_lock_guard(mutex(), call_site, true);
+  }
+#else
   // Acquires a lock on the global critical section.
   // Use this when keeping an instance is not possible. Otherwise, prefer
   // to keep an instance of global_critical_region near the members requiring
   // it to keep things readable.
-  static std::unique_lock<std::recursive_mutex> AcquireDirect() {
-    return std::unique_lock<std::recursive_mutex>(mutex());
+  static std::unique_lock<std::recursive_mutex> AcquireDirect(
+      const char* call_site = nullptr) {
+    std::unique_lock<std::recursive_mutex> lock(mutex(), std::try_to_lock);
+    if (!lock.owns_lock()) {
+      CountContendedAcquire();
+      lock.lock();
+    }
+    return lock;
   }
 
   // Acquires a lock on the global critical section.
-  inline std::unique_lock<std::recursive_mutex> Acquire() {
-    return std::unique_lock<std::recursive_mutex>(mutex());
+  inline std::unique_lock<std::recursive_mutex> Acquire(
+      const char* call_site = nullptr) {
+    std::unique_lock<std::recursive_mutex> lock(mutex(), std::try_to_lock);
+    if (!lock.owns_lock()) {
+      CountContendedAcquire();
+      lock.lock();
+    }
+    return lock;
   }
 
   // Tries to acquire a lock on the glboal critical section.
   // Check owns_lock() to see if the lock was successfully acquired.
-  inline std::unique_lock<std::recursive_mutex> TryAcquire() {
+  inline std::unique_lock<std::recursive_mutex> TryAcquire(
+      const char* call_site = nullptr) {
     return std::unique_lock<std::recursive_mutex>(mutex(), std::try_to_lock);
   }
+#endif  // XE_GLOBAL_CRITICAL_REGION_INSTRUMENT
+};
+
+// A private critical region for state that has been audited not to interact
+// with thread suspension or any other global-lock-protected state. It exposes
+// the same interface as global_critical_region, so a call site identified as
+// hot by the contention report migrates by changing only the member type -
+// after verifying that nothing relies on the mutual exclusion the global
+// region provided against its other users.
+class fine_grained_region {
+ public:
+  std::unique_lock<std::recursive_mutex> Acquire() {
+    return std::unique_lock<std::recursive_mutex>(mutex_);
+  }
+  std::unique_lock<std::recursive_mutex> TryAcquire() {
+    return std::unique_lock<std::recursive_mutex>(mutex_, std::try_to_lock);
+  }
+
+ private:
+  std::recursive_mutex mutex_;
 };
 
 }  // namespace xe
@@ -7,7 +7,13 @@
  ******************************************************************************
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
 #include <string>
+#include <vector>
 
 // NOTE: this must be included before microprofile as macro expansion needs
 // XELOGI.
@@ -29,6 +35,7 @@
 
 #include "xenia/base/assert.h"
 #include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/profiling.h"
 #include "xenia/ui/window.h"
 
@@ -43,6 +50,21 @@
 
 DEFINE_bool(show_profiler, false, "Show profiling UI by default.", "UI");
 
+DEFINE_string(profile_trace_path, "",
+              "If non-empty, the profiler writes the most recent frames here "
+              "as chrome://tracing JSON when it dumps, so captures can be "
+              "pulled from headless runs without the overlay.",
+              "General");
+
+DEFINE_int32(profile_trace_frames, 120,
+             "Maximum number of frames to include in the exported trace.",
+             "General");
+
+DEFINE_int32(counter_log_interval, 0,
+             "Seconds between telemetry counter dumps to the log; 0 disables "
+             "periodic dumps (counters are still logged on shutdown).",
+             "General");
+
 namespace xe {
 
 #if XE_OPTION_PROFILING_UI
@@ -92,6 +114,132 @@ void Profiler::Dump() {
 #endif  // XE_OPTION_PROFILING_UI
   // MicroProfileDumpHtml("profile.html");
   // MicroProfileDumpHtmlToFile();
+  if (!cvars::profile_trace_path.empty()) {
+    SaveChromeTrace(xe::to_wstring(cvars::profile_trace_path),
+                    uint32_t(cvars::profile_trace_frames));
+  }
+  LogCounters();
+}
+
+namespace {
+
+// Writes str as a JSON string literal, escaping quotes and control bytes.
+void WriteJsonString(FILE* file, const char* str) {
+  fputc('"', file);
+  for (const char* p = str; *p; ++p) {
+    char c = *p;
+    if (c == '"' || c == '\\') {
+      fputc('\\', file);
+      fputc(c, file);
+    } else if (static_cast<uint8_t>(c) < 0x20) {
+      fprintf(file, "\\u%04x", c);
+    } else {
+      fputc(c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+}  // namespace
+
+bool Profiler::SaveChromeTrace(const std::wstring& path,
+                               uint32_t frame_count) {
+  auto file = xe::filesystem::OpenFile(path, "wb");
+  if (!file) {
+    XELOGE("Profiler: unable to open trace file %S", path.c_str());
+    return false;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(MicroProfileMutex());
+  auto& s = g_MicroProfile;
+
+  // Pause capture while the rings are walked, same as the HTML dump.
+  auto running = s.nRunning;
+  auto active_group = s.nActiveGroup;
+  s.nRunning = 0;
+  s.nActiveGroup = 0;
+
+  // The frame history is a ring the profiler is still appending to; export
+  // the newest frames and leave a few slots of headroom, mirroring
+  // MicroProfileDumpHtml.
+  uint32_t frame_cap =
+      MICROPROFILE_MAX_FRAME_HISTORY - MICROPROFILE_GPU_FRAME_DELAY - 3;
+  uint32_t num_frames = std::min(frame_count, frame_cap);
+  uint32_t first_frame =
+      (s.nFrameCurrent + MICROPROFILE_MAX_FRAME_HISTORY - num_frames) %
+      MICROPROFILE_MAX_FRAME_HISTORY;
+  int64_t tick_start = s.Frames[first_frame].nFrameStartCpu;
+  double ticks_to_us =
+      1000.0 * MicroProfileTickToMsMultiplier(MicroProfileTicksPerSecondCpu());
+
+  fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+  bool first_event = true;
+  auto begin_event = [&]() {
+    fputs(first_event ? "\n" : ",\n", file);
+    first_event = false;
+  };
+
+  // Thread name metadata so the viewer shows names instead of bare tids.
+  for (uint32_t j = 0; j < s.nNumLogs; ++j) {
+    auto log = s.Pool[j];
+    if (!log || !log->ThreadName[0]) {
+      continue;
+    }
+    begin_event();
+    fprintf(file,
+            "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,"
+            "\"tid\":%u,\"args\":{\"name\":",
+            j);
+    WriteJsonString(file, log->ThreadName);
+    fputs("}}", file);
+  }
+
+  for (uint32_t i = 0; i < num_frames; ++i) {
+    uint32_t frame_index = (first_frame + i) % MICROPROFILE_MAX_FRAME_HISTORY;
+    uint32_t frame_index_next =
+        (frame_index + 1) % MICROPROFILE_MAX_FRAME_HISTORY;
+    for (uint32_t j = 0; j < s.nNumLogs; ++j) {
+      auto log = s.Pool[j];
+      if (!log || log->nGpu) {
+        // GPU logs tick on a different clock, and xenia stubs out GPU
+        // timestamps anyway (MicroProfileGpuInsertTimeStamp returns 0).
+        continue;
+      }
+      uint32_t log_start = s.Frames[frame_index].nLogStart[j];
+      uint32_t log_end = s.Frames[frame_index_next].nLogStart[j];
+      for (uint32_t k = log_start; k != log_end;
+           k = (k + 1) % MICROPROFILE_BUFFER_SIZE) {
+        auto entry = log->Log[k];
+        uint64_t type = MicroProfileLogType(entry);
+        if (type != MP_LOG_ENTER && type != MP_LOG_LEAVE) {
+          // Meta/label entries carry no duration.
+          continue;
+        }
+        auto timer_index = uint32_t(MicroProfileLogTimerIndex(entry));
+        double ts_us =
+            ticks_to_us * MicroProfileLogTickDifference(tick_start, entry);
+        begin_event();
+        fprintf(file,
+                "{\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"name\":",
+                type == MP_LOG_ENTER ? 'B' : 'E', j, ts_us);
+        const auto& timer_info = s.TimerInfo[timer_index];
+        WriteJsonString(file, timer_info.pName);
+        fputs(",\"cat\":", file);
+        WriteJsonString(file, s.GroupInfo[timer_info.nGroupIndex].pName);
+        fputc('}', file);
+      }
+    }
+  }
+
+  fputs("\n]}\n", file);
+  fclose(file);
+
+  s.nActiveGroup = active_group;
+  s.nRunning = running;
+
+  XELOGI("Profiler: wrote %u frames of trace data to %S", num_frames,
+         path.c_str());
+  return true;
 }
 
 void Profiler::Shutdown() {
@@ -245,14 +393,24 @@ void Profiler::Present() {
 #endif  // XE_OPTION_PROFILING_UI
 }
 
-void Profiler::Flip() { MicroProfileFlip(); }
+void Profiler::Flip() {
+  MicroProfileFlip();
+  MaybeLogCounters();
+}
 
 #else
 
 bool Profiler::is_enabled() { return false; }
 bool Profiler::is_visible() { return false; }
 void Profiler::Initialize() {}
-void Profiler::Dump() {}
+void Profiler::Dump() {
+  LogCounters();
+  LogMemoryCounters();
+}
+bool Profiler::SaveChromeTrace(const std::wstring& path,
+                               uint32_t frame_count) {
+  return false;
+}
 void Profiler::Shutdown() {}
 uint32_t Profiler::GetColor(const char* str) { return 0; }
 void Profiler::ThreadEnter(const char* name) {}
@@ -267,10 +425,86 @@ void Profiler::ToggleDisplay() {}
 void Profiler::TogglePause() {}
 void Profiler::set_window(ui::Window* window) {}
 void Profiler::Present() {}
-void Profiler::Flip() {}
+void Profiler::Flip() { MaybeLogCounters(); }
 
 #endif  // XE_OPTION_PROFILING
 
+namespace {
+
+// Registration appends during static init, mirroring the cvar registries;
+// counters live for the process lifetime and are never unregistered.
+std::vector<StatCounter*>* stat_counters = nullptr;
+std::vector<MemoryCounter*>* memory_counters = nullptr;
+
+}  // namespace
+
+StatCounter::StatCounter(const char* name) : name_(name) {
+  if (!stat_counters) {
+    stat_counters = new std::vector<StatCounter*>();
+  }
+  stat_counters->push_back(this);
+}
+
+MemoryCounter::MemoryCounter(const char* name) : name_(name) {
+  if (!memory_counters) {
+    memory_counters = new std::vector<MemoryCounter*>();
+  }
+  memory_counters->push_back(this);
+}
+
+void Profiler::LogCounters() {
+  if (!stat_counters || stat_counters->empty()) {
+    return;
+  }
+  XELOGI("Telemetry counters:");
+  for (auto counter : *stat_counters) {
+    XELOGI("  %-48s %" PRIu64, counter->name(), counter->value());
+  }
+}
+
+void Profiler::LogMemoryCounters() {
+  if (!memory_counters || memory_counters->empty()) {
+    return;
+  }
+  XELOGI("Memory counters (live/peak):");
+  for (auto counter : *memory_counters) {
+    XELOGI("  %-40s %10.2f MiB %10.2f MiB", counter->name(),
+           double(counter->live()) / (1024.0 * 1024.0),
+           double(counter->peak()) / (1024.0 * 1024.0));
+  }
+}
+
+uint64_t Profiler::QueryCounter(const char* name) {
+  if (!stat_counters) {
+    return 0;
+  }
+  for (auto counter : *stat_counters) {
+    if (!std::strcmp(counter->name(), name)) {
+      return counter->value();
+    }
+  }
+  return 0;
+}
+
+void Profiler::MaybeLogCounters() {
+  if (cvars::counter_log_interval <= 0) {
+    return;
+  }
+  static std::atomic<int64_t> last_log_seconds = {0};
+  int64_t now_seconds = std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+  int64_t last = last_log_seconds.load(std::memory_order_relaxed);
+  if (now_seconds - last < cvars::counter_log_interval) {
+    return;
+  }
+  // One frame wins the race to log this interval.
+  if (!last_log_seconds.compare_exchange_strong(last, now_seconds)) {
+    return;
+  }
+  LogCounters();
+}
+
 }  // namespace xe
 
 uint32_t MicroProfileGpuInsertTimeStamp() { return 0; }
@@ -10,6 +10,8 @@
 #ifndef XENIA_BASE_PROFILING_H_
 #define XENIA_BASE_PROFILING_H_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 #include "xenia/base/string.h"
@@ -150,6 +152,66 @@ namespace xe {
 
 #endif  // XE_OPTION_PROFILING
 
+// Always-on telemetry counter: a relaxed atomic u64 registered by name
+// during static initialization. Unlike the COUNT_profile_* macros these are
+// compiled in on every platform and cost one relaxed add on the hot path,
+// so they are safe to leave in production paths. Profiler::LogCounters()
+// writes the current values to the log; with counter_log_interval set they
+// are logged periodically so soak tests produce trend data.
+//
+// Define one per tracked quantity at namespace scope:
+//   xe::StatCounter count_underruns("apu/audio_system/underruns");
+class StatCounter {
+ public:
+  explicit StatCounter(const char* name);
+
+  void Add(uint64_t amount) {
+    value_.fetch_add(amount, std::memory_order_relaxed);
+  }
+  void Increment() { Add(1); }
+  void Set(uint64_t value) { value_.store(value, std::memory_order_relaxed); }
+
+  const char* name() const { return name_; }
+  uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+ private:
+  const char* name_;
+  std::atomic<uint64_t> value_{0};
+};
+
+// Live/peak byte accounting for a named allocator or cache. Registered by
+// name like StatCounter and always compiled in; updates are a couple of
+// relaxed atomic operations, cheap enough for allocation paths. Call
+// Profiler::LogMemoryCounters() (bound to F6 in the emulator window) to see
+// which subsystem is holding memory on a long session.
+//
+// Define one per tracked allocator at namespace scope:
+//   xe::MemoryCounter texture_memory("gpu/d3d12/texture_cache");
+class MemoryCounter {
+ public:
+  explicit MemoryCounter(const char* name);
+
+  void Add(uint64_t bytes) {
+    uint64_t live = live_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    uint64_t peak = peak_.load(std::memory_order_relaxed);
+    while (live > peak && !peak_.compare_exchange_weak(
+                              peak, live, std::memory_order_relaxed)) {
+    }
+  }
+  void Remove(uint64_t bytes) {
+    live_.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  const char* name() const { return name_; }
+  uint64_t live() const { return live_.load(std::memory_order_relaxed); }
+  uint64_t peak() const { return peak_.load(std::memory_order_relaxed); }
+
+ private:
+  const char* name_;
+  std::atomic<uint64_t> live_{0};
+  std::atomic<uint64_t> peak_{0};
+};
+
 class Profiler {
  public:
   static bool is_enabled();
@@ -159,6 +221,20 @@ class Profiler {
   static void Initialize();
   // Dumps data to stdout.
   static void Dump();
+  // Writes the most recent frame_count profiler frames to the given file as
+  // chrome://tracing JSON (load via chrome://tracing or ui.perfetto.dev).
+  // Capture is paused while the thread logs are walked.
+  static bool SaveChromeTrace(const std::wstring& path, uint32_t frame_count);
+  // Logs every registered StatCounter.
+  static void LogCounters();
+  // Returns the current value of the named StatCounter, or 0 if no counter
+  // with that name is registered.
+  static uint64_t QueryCounter(const char* name);
+  // Logs live and peak bytes for every registered MemoryCounter.
+  static void LogMemoryCounters();
+  // Logs the counters if counter_log_interval seconds have passed since the
+  // last log; called once per frame from Flip.
+  static void MaybeLogCounters();
   // Cleans up profiling, releasing all memory.
   static void Shutdown();
 
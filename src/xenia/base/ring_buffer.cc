@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <cstring>
 
+#include "xenia/base/threading.h"
+
 namespace xe {
 
 RingBuffer::RingBuffer(uint8_t* buffer, size_t capacity)
@@ -115,4 +117,121 @@ size_t RingBuffer::Write(const uint8_t* buffer, size_t count) {
   return count;
 }
 
+bool SpscRingBuffer::TryWrite(const void* data, size_t count) {
+  size_t write_offset = write_offset_.load(std::memory_order_relaxed);
+  size_t read_offset = read_offset_.load(std::memory_order_acquire);
+  if (capacity_ - (write_offset - read_offset) < count) {
+    return false;
+  }
+  size_t wrapped = write_offset % capacity_;
+  if (wrapped + count <= capacity_) {
+    std::memcpy(buffer_ + wrapped, data, count);
+  } else {
+    size_t left_half = capacity_ - wrapped;
+    std::memcpy(buffer_ + wrapped, data, left_half);
+    std::memcpy(buffer_, static_cast<const uint8_t*>(data) + left_half,
+                count - left_half);
+  }
+  write_offset_.store(write_offset + count, std::memory_order_release);
+  return true;
+}
+
+bool SpscRingBuffer::TryRead(void* data, size_t count) {
+  size_t read_offset = read_offset_.load(std::memory_order_relaxed);
+  size_t write_offset = write_offset_.load(std::memory_order_acquire);
+  if (write_offset - read_offset < count) {
+    return false;
+  }
+  size_t wrapped = read_offset % capacity_;
+  if (wrapped + count <= capacity_) {
+    std::memcpy(data, buffer_ + wrapped, count);
+  } else {
+    size_t left_half = capacity_ - wrapped;
+    std::memcpy(data, buffer_ + wrapped, left_half);
+    std::memcpy(static_cast<uint8_t*>(data) + left_half, buffer_,
+                count - left_half);
+  }
+  read_offset_.store(read_offset + count, std::memory_order_release);
+  return true;
+}
+
+void MpscRingBuffer::WriteSplit(size_t offset, const void* data, size_t count) {
+  size_t wrapped = offset % capacity_;
+  if (wrapped + count <= capacity_) {
+    std::memcpy(buffer_ + wrapped, data, count);
+  } else {
+    size_t left_half = capacity_ - wrapped;
+    std::memcpy(buffer_ + wrapped, data, left_half);
+    std::memcpy(buffer_, static_cast<const uint8_t*>(data) + left_half,
+                count - left_half);
+  }
+}
+
+bool MpscRingBuffer::TryWrite(const void* part0, size_t part0_length,
+                              const void* part1, size_t part1_length) {
+  size_t total_length = part0_length + part1_length;
+  assert_true(total_length <= capacity_);
+  // Reserve [head, head + total_length).
+  size_t head = write_head_.load(std::memory_order_relaxed);
+  while (true) {
+    size_t read_offset = read_offset_.load(std::memory_order_acquire);
+    if (capacity_ - (head - read_offset) < total_length) {
+      return false;
+    }
+    if (write_head_.compare_exchange_weak(head, head + total_length,
+                                          std::memory_order_acq_rel)) {
+      break;
+    }
+    // head has been reloaded by the failed CAS; check the space again.
+  }
+  WriteSplit(head, part0, part0_length);
+  if (part1_length) {
+    WriteSplit(head + part0_length, part1, part1_length);
+  }
+  // Publish in reservation order - wait for any producer that reserved
+  // earlier to publish first.
+  size_t expected = head;
+  while (!write_tail_.compare_exchange_weak(expected, head + total_length,
+                                            std::memory_order_release)) {
+    expected = head;
+    xe::threading::MaybeYield();
+  }
+  return true;
+}
+
+void MpscRingBuffer::Read(void* data, size_t count) {
+  assert_true(read_count() >= count);
+  size_t read_offset = read_offset_.load(std::memory_order_relaxed);
+  size_t wrapped = read_offset % capacity_;
+  if (wrapped + count <= capacity_) {
+    std::memcpy(data, buffer_ + wrapped, count);
+  } else {
+    size_t left_half = capacity_ - wrapped;
+    std::memcpy(data, buffer_ + wrapped, left_half);
+    std::memcpy(static_cast<uint8_t*>(data) + left_half, buffer_,
+                count - left_half);
+  }
+  read_offset_.store(read_offset + count, std::memory_order_release);
+}
+
+RingBuffer::ReadRange MpscRingBuffer::BeginRead(size_t count) {
+  assert_true(read_count() >= count);
+  if (!count) {
+    return {0};
+  }
+  size_t wrapped = read_offset_.load(std::memory_order_relaxed) % capacity_;
+  if (wrapped + count <= capacity_) {
+    return {buffer_ + wrapped, count, nullptr, 0};
+  } else {
+    size_t left_half = capacity_ - wrapped;
+    return {buffer_ + wrapped, left_half, buffer_, count - left_half};
+  }
+}
+
+void MpscRingBuffer::EndRead(RingBuffer::ReadRange read_range) {
+  read_offset_.store(read_offset_.load(std::memory_order_relaxed) +
+                         read_range.first_length + read_range.second_length,
+                     std::memory_order_release);
+}
+
 }  // namespace xe
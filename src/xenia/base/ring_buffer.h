@@ -10,6 +10,7 @@
 #ifndef XENIA_BASE_RING_BUFFER_H_
 #define XENIA_BASE_RING_BUFFER_H_
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include <type_traits>
@@ -113,6 +114,97 @@ class RingBuffer {
   size_t write_offset_ = 0;
 };
 
+// Single-producer single-consumer lock-free byte ring over an external
+// buffer. The producer owns the write offset and the consumer the read
+// offset; each publishes with a release store, so the pointer handoff needs
+// no external locking. Offsets are free-running and wrapped on access
+// ((write - read) is always the queued byte count), and the two offsets live
+// on separate cache lines to avoid false sharing.
+class SpscRingBuffer {
+ public:
+  SpscRingBuffer(uint8_t* buffer, size_t capacity)
+      : buffer_(buffer), capacity_(capacity) {}
+
+  size_t capacity() const { return capacity_; }
+
+  // Producer side.
+  size_t write_count() const {
+    return capacity_ - (write_offset_.load(std::memory_order_relaxed) -
+                        read_offset_.load(std::memory_order_acquire));
+  }
+  // Appends count bytes as one batch, visible to the consumer all at once.
+  // Returns false without blocking if there isn't enough free space.
+  bool TryWrite(const void* data, size_t count);
+
+  // Consumer side.
+  size_t read_count() const {
+    return write_offset_.load(std::memory_order_acquire) -
+           read_offset_.load(std::memory_order_relaxed);
+  }
+  bool empty() const { return read_count() == 0; }
+  // Removes count bytes as one batch. Returns false without blocking if
+  // fewer than count bytes have been published.
+  bool TryRead(void* data, size_t count);
+
+ private:
+  uint8_t* buffer_ = nullptr;
+  size_t capacity_ = 0;
+  alignas(64) std::atomic<size_t> write_offset_ = {0};
+  alignas(64) std::atomic<size_t> read_offset_ = {0};
+};
+
+// Multi-producer single-consumer lock-free byte ring over an external
+// buffer. Producers reserve space with a CAS on the write head, copy their
+// payload, then publish by advancing the write tail in reservation order;
+// the consumer only ever sees fully published batches. This is the
+// reservation scheme the logger used to hand-roll, extracted for reuse.
+class MpscRingBuffer {
+ public:
+  MpscRingBuffer(uint8_t* buffer, size_t capacity)
+      : buffer_(buffer), capacity_(capacity) {}
+
+  size_t capacity() const { return capacity_; }
+
+  // Producer side. Appends the concatenation of the two parts (part1 may be
+  // null) as one batch, visible to the consumer all at once. Returns false
+  // without blocking if there isn't enough free space. The two-part form
+  // covers the common header + payload case without a gather copy.
+  bool TryWrite(const void* part0, size_t part0_length,
+                const void* part1 = nullptr, size_t part1_length = 0);
+
+  // Consumer side. Only one thread may consume.
+  size_t read_count() const {
+    return write_tail_.load(std::memory_order_acquire) -
+           read_offset_.load(std::memory_order_relaxed);
+  }
+  bool empty() const { return read_count() == 0; }
+  void Read(void* data, size_t count);
+  template <typename T>
+  T Read() {
+    static_assert(std::is_fundamental<T>::value,
+                  "Immediate read only supports basic types!");
+    T imm;
+    Read(&imm, sizeof(T));
+    return imm;
+  }
+  // Direct access to published data, which may be split across the wrap
+  // point; pass the range to EndRead to consume it.
+  RingBuffer::ReadRange BeginRead(size_t count);
+  void EndRead(RingBuffer::ReadRange read_range);
+
+ private:
+  void WriteSplit(size_t offset, const void* data, size_t count);
+
+  uint8_t* buffer_ = nullptr;
+  size_t capacity_ = 0;
+  // Reserved by producers; bytes in [write_tail_, write_head_) are still
+  // being copied.
+  alignas(64) std::atomic<size_t> write_head_ = {0};
+  // Published to the consumer.
+  alignas(64) std::atomic<size_t> write_tail_ = {0};
+  alignas(64) std::atomic<size_t> read_offset_ = {0};
+};
+
 }  // namespace xe
 
 #endif  // XENIA_BASE_RING_BUFFER_H_
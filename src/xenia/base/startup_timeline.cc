@@ -0,0 +1,74 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/base/startup_timeline.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/profiling.h"
+
+namespace xe {
+
+namespace {
+
+const char* const kPhaseNames[size_t(StartupTimeline::Phase::kCount)] = {
+    "emulator setup", "module load",  "precompile",
+    "first translation", "first draw", "first audio submit",
+};
+
+StatCounter count_startup_emulator_setup_ms("startup/emulator_setup_ms");
+StatCounter count_startup_module_load_ms("startup/module_load_ms");
+StatCounter count_startup_precompile_ms("startup/precompile_ms");
+StatCounter count_startup_first_translation_ms(
+    "startup/first_translation_ms");
+StatCounter count_startup_first_draw_ms("startup/first_draw_ms");
+StatCounter count_startup_first_audio_submit_ms(
+    "startup/first_audio_submit_ms");
+
+StatCounter* const kPhaseCounters[size_t(StartupTimeline::Phase::kCount)] = {
+    &count_startup_emulator_setup_ms,     &count_startup_module_load_ms,
+    &count_startup_precompile_ms,         &count_startup_first_translation_ms,
+    &count_startup_first_draw_ms,         &count_startup_first_audio_submit_ms,
+};
+
+std::atomic<uint64_t> begin_tick{0};
+std::atomic<uint64_t> phase_ticks[size_t(StartupTimeline::Phase::kCount)] = {};
+
+}  // namespace
+
+void StartupTimeline::Begin() {
+  uint64_t expected = 0;
+  begin_tick.compare_exchange_strong(expected, Clock::QueryHostTickCount(),
+                                     std::memory_order_relaxed);
+}
+
+void StartupTimeline::Mark(Phase phase) {
+  uint64_t begin = begin_tick.load(std::memory_order_relaxed);
+  if (!begin) {
+    // Setup never ran (tools that bypass the emulator shell).
+    return;
+  }
+  uint64_t expected = 0;
+  if (!phase_ticks[size_t(phase)].compare_exchange_strong(
+          expected, Clock::QueryHostTickCount(),
+          std::memory_order_relaxed)) {
+    // Already recorded; swap and audio submit call in every frame.
+    return;
+  }
+  uint64_t tick = phase_ticks[size_t(phase)].load(std::memory_order_relaxed);
+  uint64_t ms = (tick - begin) * 1000 / Clock::QueryHostTickFrequency();
+  kPhaseCounters[size_t(phase)]->Set(ms);
+  XELOGI("Startup: %s at %llu ms", kPhaseNames[size_t(phase)],
+         static_cast<unsigned long long>(ms));
+}
+
+}  // namespace xe
@@ -0,0 +1,42 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_BASE_STARTUP_TIMELINE_H_
+#define XENIA_BASE_STARTUP_TIMELINE_H_
+
+namespace xe {
+
+// One-shot startup phase timeline. Begin() anchors the clock at the start of
+// emulator setup; each phase records the first time it is reached, logs its
+// offset at INFO and publishes it in milliseconds through the counters
+// surface (startup/<phase>_ms), so startup work - cache loads, parallel
+// init, prewarm - has a stable measurement instead of a stopwatch. Marks
+// after the first are ignored, so hot paths (swap, audio submit) can call in
+// unconditionally.
+class StartupTimeline {
+ public:
+  enum class Phase {
+    kEmulatorSetup,     // Emulator::Setup returned.
+    kModuleLoad,        // Main module loaded and ready to launch.
+    kPrecompile,        // Precompile scan and translation drained.
+    kFirstTranslation,  // First guest function translated.
+    kFirstDraw,         // First frame handed to the host swap chain.
+    kFirstAudioSubmit,  // First audio frame submitted to the driver.
+    kCount,
+  };
+
+  // Anchors the timeline; later Begin() calls (title relaunch) are ignored.
+  static void Begin();
+  // Records the phase if this is its first occurrence, else does nothing.
+  static void Mark(Phase phase);
+};
+
+}  // namespace xe
+
+#endif  // XENIA_BASE_STARTUP_TIMELINE_H_
@@ -12,18 +12,38 @@
 #include <algorithm>
 #include <cstdarg>
 
+#include "xenia/base/arena.h"
 #include "xenia/base/math.h"
 
 namespace xe {
 
 StringBuffer::StringBuffer(size_t initial_capacity) {
-  buffer_capacity_ = std::max(initial_capacity, static_cast<size_t>(16 * 1024));
-  buffer_ = reinterpret_cast<char*>(malloc(buffer_capacity_));
+  if (initial_capacity > kInlineCapacity) {
+    buffer_capacity_ = initial_capacity;
+    buffer_ = reinterpret_cast<char*>(malloc(buffer_capacity_));
+  } else {
+    buffer_ = inline_buffer_;
+    buffer_capacity_ = kInlineCapacity;
+  }
+  buffer_[0] = 0;
+}
+
+StringBuffer::StringBuffer(Arena* arena, size_t initial_capacity)
+    : arena_(arena) {
+  if (initial_capacity > kInlineCapacity) {
+    buffer_capacity_ = initial_capacity;
+    buffer_ = reinterpret_cast<char*>(arena_->Alloc(buffer_capacity_));
+  } else {
+    buffer_ = inline_buffer_;
+    buffer_capacity_ = kInlineCapacity;
+  }
   buffer_[0] = 0;
 }
 
 StringBuffer::~StringBuffer() {
-  free(buffer_);
+  if (!is_inline() && !arena_) {
+    free(buffer_);
+  }
   buffer_ = nullptr;
 }
 
@@ -36,11 +56,23 @@ void StringBuffer::Grow(size_t additional_length) {
   if (buffer_offset_ + additional_length <= buffer_capacity_) {
     return;
   }
-  size_t old_capacity = buffer_capacity_;
   size_t new_capacity =
-      std::max(xe::round_up(buffer_offset_ + additional_length, 16 * 1024),
-               old_capacity * 2);
-  buffer_ = reinterpret_cast<char*>(realloc(buffer_, new_capacity));
+      std::max(xe::round_up(buffer_offset_ + additional_length,
+                            kInlineCapacity),
+               buffer_capacity_ * 2);
+  if (arena_) {
+    // Arena blocks can't be resized or freed individually; take a larger
+    // block and copy. The abandoned block is reclaimed at arena reset.
+    char* new_buffer = reinterpret_cast<char*>(arena_->Alloc(new_capacity));
+    std::memcpy(new_buffer, buffer_, buffer_offset_ + 1);
+    buffer_ = new_buffer;
+  } else if (is_inline()) {
+    char* new_buffer = reinterpret_cast<char*>(malloc(new_capacity));
+    std::memcpy(new_buffer, buffer_, buffer_offset_ + 1);
+    buffer_ = new_buffer;
+  } else {
+    buffer_ = reinterpret_cast<char*>(realloc(buffer_, new_capacity));
+  }
   buffer_capacity_ = new_capacity;
 }
 
@@ -66,7 +98,8 @@ void StringBuffer::AppendFormat(const char* format, ...) {
 void StringBuffer::AppendVarargs(const char* format, va_list args) {
   int length = vsnprintf(nullptr, 0, format, args);
   Grow(length + 1);
-  vsnprintf(buffer_ + buffer_offset_, buffer_capacity_, format, args);
+  vsnprintf(buffer_ + buffer_offset_, buffer_capacity_ - buffer_offset_,
+            format, args);
   buffer_offset_ += length;
   buffer_[buffer_offset_] = 0;
 }
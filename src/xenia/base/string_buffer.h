@@ -16,9 +16,16 @@
 
 namespace xe {
 
+class Arena;
+
 class StringBuffer {
  public:
   explicit StringBuffer(size_t initial_capacity = 0);
+  // Arena-backed mode: growth takes blocks from the arena instead of the
+  // heap and the destructor frees nothing - the storage is reclaimed when
+  // the arena resets. Use for bulk passes (disassembling a whole module)
+  // where per-buffer heap traffic would dominate.
+  explicit StringBuffer(Arena* arena, size_t initial_capacity = 0);
   ~StringBuffer();
 
   size_t length() const { return buffer_offset_; }
@@ -39,10 +46,17 @@ class StringBuffer {
 
  private:
   void Grow(size_t additional_length);
+  bool is_inline() const { return buffer_ == inline_buffer_; }
+
+  // Strings up to this length live in the object itself; typical log lines
+  // and single-instruction disassembly never touch the heap.
+  static const size_t kInlineCapacity = 256;
 
+  Arena* arena_ = nullptr;
   char* buffer_ = nullptr;
   size_t buffer_offset_ = 0;
   size_t buffer_capacity_ = 0;
+  char inline_buffer_[kInlineCapacity];
 };
 
 }  // namespace xe
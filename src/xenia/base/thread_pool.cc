@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2019 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/base/thread_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "xenia/base/math.h"
+
+namespace xe {
+namespace threading {
+
+ThreadPool* ThreadPool::shared() {
+  static ThreadPool shared_pool(logical_processor_count(), "xe::ThreadPool");
+  return &shared_pool;
+}
+
+ThreadPool::ThreadPool(uint32_t worker_count, const std::string& name) {
+  worker_count = std::max(worker_count, uint32_t(1));
+  workers_.reserve(worker_count);
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(worker_count);
+  for (uint32_t i = 0; i < worker_count; ++i) {
+    auto thread = Thread::Create({}, [this, i]() { WorkerMain(i); });
+    thread->set_name(name + " Worker");
+    threads_.push_back(std::move(thread));
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  work_available_.notify_all();
+  // Workers drain everything still queued before exiting, so no accepted task
+  // is lost.
+  for (auto& thread : threads_) {
+    Wait(thread.get(), false);
+  }
+  threads_.clear();
+}
+
+void ThreadPool::Enqueue(std::function<void()> fn, Priority priority,
+                         uint32_t affinity_hint) {
+  if (affinity_hint != kAnyWorker) {
+    Worker& worker = *workers_[affinity_hint % workers_.size()];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queue.push_back(std::move(fn));
+  } else {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shared_queues_[size_t(priority)].push_back(std::move(fn));
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_count_.fetch_add(1, std::memory_order_release);
+  }
+  work_available_.notify_one();
+}
+
+bool ThreadPool::PopTask(uint32_t worker_index, std::function<void()>& fn_out) {
+  // Own queue first, oldest task first.
+  {
+    Worker& own_worker = *workers_[worker_index];
+    std::lock_guard<std::mutex> lock(own_worker.mutex);
+    if (!own_worker.queue.empty()) {
+      fn_out = std::move(own_worker.queue.front());
+      own_worker.queue.pop_front();
+      return true;
+    }
+  }
+  // Then the shared queues, highest priority first.
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = xe::countof(shared_queues_); i-- > 0;) {
+      auto& queue = shared_queues_[i];
+      if (!queue.empty()) {
+        fn_out = std::move(queue.front());
+        queue.pop_front();
+        return true;
+      }
+    }
+  }
+  // Finally steal the newest task from another worker's queue - the owner
+  // takes its own queue from the front, so stealing from the back minimizes
+  // contention on the same task.
+  for (size_t i = 1; i < workers_.size(); ++i) {
+    Worker& victim = *workers_[(worker_index + i) % workers_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.queue.empty()) {
+      fn_out = std::move(victim.queue.back());
+      victim.queue.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::WorkerMain(uint32_t worker_index) {
+  while (true) {
+    std::function<void()> fn;
+    if (PopTask(worker_index, fn)) {
+      pending_count_.fetch_sub(1, std::memory_order_acq_rel);
+      fn();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_available_.wait(lock, [this]() {
+      return shutdown_ ||
+             pending_count_.load(std::memory_order_acquire) != 0;
+    });
+    if (shutdown_ && pending_count_.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+    // A task is (or just was) available - loop around and race to pop it.
+    // Losing the race simply puts the worker back to sleep.
+  }
+}
+
+void ThreadPool::ParallelFor(uint32_t count,
+                             const std::function<void(uint32_t)>& fn,
+                             uint32_t max_workers) {
+  if (!count) {
+    return;
+  }
+  uint32_t helper_count =
+      std::min(std::min(worker_count(), count - 1),
+               max_workers ? max_workers - 1 : 0);
+  if (!helper_count) {
+    for (uint32_t i = 0; i < count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+  std::atomic<uint32_t> next_index = {0};
+  std::atomic<uint32_t> helpers_remaining = {helper_count};
+  Fence done_fence;
+  for (uint32_t i = 0; i < helper_count; ++i) {
+    // High priority so short parallel bursts aren't queued behind bulk work;
+    // hinted to spread the helpers across distinct workers.
+    Enqueue(
+        [&next_index, &helpers_remaining, &done_fence, &fn, count]() {
+          uint32_t index;
+          while ((index = next_index.fetch_add(1)) < count) {
+            fn(index);
+          }
+          if (helpers_remaining.fetch_sub(1) == 1) {
+            done_fence.Signal();
+          }
+        },
+        Priority::kHigh, i);
+  }
+  uint32_t index;
+  while ((index = next_index.fetch_add(1)) < count) {
+    fn(index);
+  }
+  done_fence.Wait();
+}
+
+}  // namespace threading
+}  // namespace xe
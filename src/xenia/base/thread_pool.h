@@ -0,0 +1,101 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2019 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_BASE_THREAD_POOL_H_
+#define XENIA_BASE_THREAD_POOL_H_
+
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace threading {
+
+// General-purpose work-stealing task pool.
+//
+// Each worker owns a local queue - tasks enqueued with an affinity hint go to
+// that worker's queue and are taken by its owner in FIFO order, so related
+// tasks tend to stay on one core and share its caches. Unhinted tasks go to
+// shared per-priority queues. An idle worker first drains its own queue, then
+// the shared queues from highest priority down, and finally steals from the
+// back of other workers' queues.
+//
+// Subsystems needing burst parallelism should prefer the process-wide
+// shared() pool over spinning up dedicated threads - one pool sized to the
+// host core count doesn't oversubscribe the machine the way a per-subsystem
+// thread zoo does. Dedicated threads remain appropriate for workers that hold
+// long-lived per-thread state.
+class ThreadPool {
+ public:
+  enum class Priority {
+    kLow = 0,
+    kNormal = 1,
+    kHigh = 2,
+  };
+
+  static const uint32_t kAnyWorker = UINT_MAX;
+
+  // Returns the process-wide pool, created on first use with one worker per
+  // logical processor.
+  static ThreadPool* shared();
+
+  ThreadPool(uint32_t worker_count, const std::string& name);
+  ~ThreadPool();
+
+  uint32_t worker_count() const {
+    return static_cast<uint32_t>(workers_.size());
+  }
+
+  // Queues a task for execution. affinity_hint, if not kAnyWorker, biases the
+  // task towards the given worker (modulo worker_count()); this is a hint
+  // only - an idle worker may still steal it.
+  void Enqueue(std::function<void()> fn, Priority priority = Priority::kNormal,
+               uint32_t affinity_hint = kAnyWorker);
+
+  // Runs fn(index) for every index in [0, count), on the calling thread and
+  // up to max_workers - 1 pool workers, returning when all indices have
+  // completed. The calling thread always participates, so this makes progress
+  // even when all the workers are busy with long tasks.
+  void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& fn,
+                   uint32_t max_workers = UINT_MAX);
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> queue;
+  };
+
+  void WorkerMain(uint32_t worker_index);
+  bool PopTask(uint32_t worker_index, std::function<void()>& fn_out);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::unique_ptr<Thread>> threads_;
+
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::deque<std::function<void()>> shared_queues_[3];
+  // Tasks queued across all queues and not yet popped. Incremented under
+  // mutex_ so sleeping workers can't miss a wakeup; decremented lock-free.
+  std::atomic<uint32_t> pending_count_ = {0};
+  bool shutdown_ = false;
+};
+
+}  // namespace threading
+}  // namespace xe
+
+#endif  // XENIA_BASE_THREAD_POOL_H_
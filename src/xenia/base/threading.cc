@@ -9,6 +9,8 @@
 
 #include "xenia/base/threading.h"
 
+#include "xenia/base/math.h"
+
 namespace xe {
 namespace threading {
 
@@ -20,6 +22,45 @@ uint32_t logical_processor_count() {
   return value;
 }
 
+uint64_t largest_llc_group_affinity_mask() {
+  static const uint64_t mask = []() -> uint64_t {
+    const std::vector<LogicalProcessorInfo>& topology =
+        logical_processor_topology();
+    if (topology.empty() || topology.size() > 64) {
+      return 0;
+    }
+    uint32_t group_count = 0;
+    for (const LogicalProcessorInfo& processor : topology) {
+      group_count = std::max(group_count, processor.llc_group + 1);
+    }
+    if (group_count <= 1) {
+      return 0;
+    }
+    // Physical cores within each group, as bits - the core indices are dense
+    // and thus fit in 64 bits just like the logical processor indices.
+    std::vector<uint64_t> group_cores(group_count, 0);
+    for (const LogicalProcessorInfo& processor : topology) {
+      group_cores[processor.llc_group] |= uint64_t(1)
+                                          << processor.physical_core;
+    }
+    uint32_t best_group = 0;
+    for (uint32_t i = 1; i < group_count; ++i) {
+      if (xe::bit_count(group_cores[i]) >
+          xe::bit_count(group_cores[best_group])) {
+        best_group = i;
+      }
+    }
+    uint64_t group_mask = 0;
+    for (size_t i = 0; i < topology.size(); ++i) {
+      if (topology[i].llc_group == best_group) {
+        group_mask |= uint64_t(1) << i;
+      }
+    }
+    return group_mask;
+  }();
+  return mask;
+}
+
 thread_local uint32_t current_thread_id_ = UINT_MAX;
 
 uint32_t current_thread_id() {
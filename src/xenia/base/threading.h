@@ -52,6 +52,27 @@ class Fence {
 // Returns the total number of logical processors in the host system.
 uint32_t logical_processor_count();
 
+// Topology of one logical processor: the physical core it belongs to and the
+// last-level cache it shares (on multi-CCX/CCD CPUs, each core complex has
+// its own L3). Indices are dense and stable within a run, but otherwise
+// arbitrary.
+struct LogicalProcessorInfo {
+  uint32_t physical_core;
+  uint32_t llc_group;
+};
+
+// Returns the topology of all logical processors, indexed as in thread
+// affinity masks - enumerated once and cached. Empty if the topology can't be
+// queried on the host.
+const std::vector<LogicalProcessorInfo>& logical_processor_topology();
+
+// Returns the affinity mask of the last-level cache group containing the most
+// physical cores, for placing threads that communicate every frame (such as
+// the GPU command processor) so they don't bounce lines between LLC groups.
+// 0 if the topology is unknown, if all logical processors already share one
+// LLC, or if there are more than 64 logical processors.
+uint64_t largest_llc_group_affinity_mask();
+
 // Enables the current process to set thread affinity.
 // Must be called at startup before attempting to set thread affinity.
 void EnableAffinityConfiguration();
@@ -71,9 +92,24 @@ void set_name(const std::string& name);
 // Sets the target thread name.
 void set_name(std::thread::native_handle_type handle, const std::string& name);
 
+// Moves the calling thread into background scheduling: its CPU priority
+// and, where the host supports it (Windows background mode, Linux idle I/O
+// class), its disk I/O and memory priority are lowered. Housekeeping
+// threads (log writing, readahead, write-behind flushing) should run in
+// background mode so their I/O never competes with the game's streaming
+// reads or the GPU thread's paging for storage bandwidth.
+void EnterBackgroundMode();
+// Restores normal scheduling and I/O priority for the calling thread.
+void LeaveBackgroundMode();
+
 // Yields the current thread to the scheduler. Maybe.
 void MaybeYield();
 
+// Hints to the processor that this is a spin-wait loop iteration, backing
+// off the core's speculation so a sibling hyperthread (likely the one being
+// waited on) gets the execution resources. Does not yield to the scheduler.
+void Pause();
+
 // Memory barrier (request - may be ignored).
 void SyncMemory();
 
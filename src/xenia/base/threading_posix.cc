@@ -9,11 +9,17 @@
 
 #include "xenia/base/threading.h"
 
+#include <cstdio>
+#include <map>
+#include <utility>
+
 #include "xenia/base/assert.h"
 #include "xenia/base/logging.h"
 
 #include <pthread.h>
+#include <sched.h>
 #include <sys/eventfd.h>
+#include <sys/resource.h>
 #include <sys/syscall.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -26,6 +32,63 @@ namespace threading {
 // TODO(dougvj)
 void EnableAffinityConfiguration() {}
 
+namespace {
+
+// Reads a small decimal value from a per-processor sysfs topology file, -1 if
+// it can't be read.
+int ReadProcessorSysfsValue(uint32_t processor, const char* file) {
+  char path[96];
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/%s", processor,
+           file);
+  FILE* handle = fopen(path, "r");
+  if (!handle) {
+    return -1;
+  }
+  int value = -1;
+  if (fscanf(handle, "%d", &value) != 1) {
+    value = -1;
+  }
+  fclose(handle);
+  return value;
+}
+
+}  // namespace
+
+const std::vector<LogicalProcessorInfo>& logical_processor_topology() {
+  static const std::vector<LogicalProcessorInfo> topology = []() {
+    std::vector<LogicalProcessorInfo> processors;
+    uint32_t count = logical_processor_count();
+    std::map<std::pair<int, int>, uint32_t> core_indices;
+    std::map<int, uint32_t> llc_indices;
+    for (uint32_t i = 0; i < count; ++i) {
+      int package_id =
+          ReadProcessorSysfsValue(i, "topology/physical_package_id");
+      int core_id = ReadProcessorSysfsValue(i, "topology/core_id");
+      if (package_id < 0 || core_id < 0) {
+        processors.clear();
+        break;
+      }
+      // The L3 instance when exposed by the kernel - otherwise treat the
+      // whole package as sharing one last-level cache.
+      int llc_id = ReadProcessorSysfsValue(i, "cache/index3/id");
+      if (llc_id < 0) {
+        llc_id = package_id;
+      }
+      LogicalProcessorInfo info;
+      info.physical_core =
+          core_indices.emplace(std::make_pair(package_id, core_id),
+                               uint32_t(core_indices.size()))
+              .first->second;
+      info.llc_group =
+          llc_indices.emplace(llc_id, uint32_t(llc_indices.size()))
+              .first->second;
+      processors.push_back(info);
+    }
+    return processors;
+  }();
+  return topology;
+}
+
 // uint64_t ticks() { return mach_absolute_time(); }
 
 uint32_t current_thread_system_id() {
@@ -40,6 +103,41 @@ void set_name(std::thread::native_handle_type handle, const std::string& name) {
   pthread_setname_np(handle, name.c_str());
 }
 
+namespace {
+
+#if XE_PLATFORM_LINUX
+// From linux/ioprio.h, which isn't exported to userspace headers.
+constexpr int kIoprioWhoProcess = 1;
+constexpr int kIoprioClassShift = 13;
+constexpr int kIoprioClassBestEffort = 2;
+constexpr int kIoprioClassIdle = 3;
+
+void SetCurrentThreadIoPriority(int io_class, int level) {
+  // who = 0 targets the calling thread with IOPRIO_WHO_PROCESS.
+  syscall(SYS_ioprio_set, kIoprioWhoProcess, 0,
+          (io_class << kIoprioClassShift) | level);
+}
+#endif  // XE_PLATFORM_LINUX
+
+}  // namespace
+
+void EnterBackgroundMode() {
+#if XE_PLATFORM_LINUX
+  // Idle-class I/O is only serviced when no normal-class request is pending,
+  // keeping housekeeping off the device while the game streams. Nice values
+  // are per-thread on Linux, so this doesn't deprioritize the process.
+  SetCurrentThreadIoPriority(kIoprioClassIdle, 0);
+  setpriority(PRIO_PROCESS, 0, 19);
+#endif  // XE_PLATFORM_LINUX
+}
+
+void LeaveBackgroundMode() {
+#if XE_PLATFORM_LINUX
+  SetCurrentThreadIoPriority(kIoprioClassBestEffort, 4);
+  setpriority(PRIO_PROCESS, 0, 0);
+#endif  // XE_PLATFORM_LINUX
+}
+
 void MaybeYield() {
   pthread_yield();
   __sync_synchronize();
@@ -47,6 +145,12 @@ void MaybeYield() {
 
 void SyncMemory() { __sync_synchronize(); }
 
+void Pause() {
+#if XE_ARCH_AMD64
+  __builtin_ia32_pause();
+#endif  // XE_ARCH_AMD64
+}
+
 void Sleep(std::chrono::microseconds duration) {
   timespec rqtp = {time_t(duration.count() / 1000000),
                    time_t(duration.count() % 1000)};
@@ -371,9 +475,29 @@ class PosixThread : public PosixThreadHandle<Thread> {
 
   uint32_t system_id() const override { return 0; }
 
-  // TODO(DrChat)
-  uint64_t affinity_mask() override { return 0; }
-  void set_affinity_mask(uint64_t mask) override { assert_always(); }
+  uint64_t affinity_mask() override {
+    cpu_set_t cpu_set;
+    if (pthread_getaffinity_np(handle_, sizeof(cpu_set), &cpu_set) != 0) {
+      return 0;
+    }
+    uint64_t mask = 0;
+    for (uint32_t i = 0; i < 64; ++i) {
+      if (CPU_ISSET(i, &cpu_set)) {
+        mask |= uint64_t(1) << i;
+      }
+    }
+    return mask;
+  }
+  void set_affinity_mask(uint64_t mask) override {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (uint32_t i = 0; i < 64; ++i) {
+      if (mask & (uint64_t(1) << i)) {
+        CPU_SET(i, &cpu_set);
+      }
+    }
+    pthread_setaffinity_np(handle_, sizeof(cpu_set), &cpu_set);
+  }
 
   int priority() override {
     int policy;
@@ -29,6 +29,65 @@ uint32_t current_thread_system_id() {
   return static_cast<uint32_t>(GetCurrentThreadId());
 }
 
+const std::vector<LogicalProcessorInfo>& logical_processor_topology() {
+  static const std::vector<LogicalProcessorInfo> topology = []() {
+    std::vector<LogicalProcessorInfo> processors;
+    // Only processor group 0 is used - affinity masks are 64-bit.
+    processors.resize(std::min(logical_processor_count(), uint32_t(64)));
+    DWORD buffer_size = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &buffer_size);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER || !buffer_size) {
+      processors.clear();
+      return processors;
+    }
+    std::vector<uint8_t> buffer(buffer_size);
+    if (!GetLogicalProcessorInformationEx(
+            RelationAll,
+            reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(
+                buffer.data()),
+            &buffer_size)) {
+      processors.clear();
+      return processors;
+    }
+    uint32_t core_count = 0, llc_count = 0;
+    for (DWORD offset = 0; offset < buffer_size;) {
+      const auto& info =
+          *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(
+              buffer.data() + offset);
+      if (info.Relationship == RelationProcessorCore) {
+        const GROUP_AFFINITY& affinity = info.Processor.GroupMask[0];
+        if (affinity.Group == 0) {
+          for (uint32_t i = 0; i < processors.size(); ++i) {
+            if (affinity.Mask & (KAFFINITY(1) << i)) {
+              processors[i].physical_core = core_count;
+            }
+          }
+          ++core_count;
+        }
+      } else if (info.Relationship == RelationCache &&
+                 info.Cache.Level == 3 &&
+                 (info.Cache.Type == CacheUnified ||
+                  info.Cache.Type == CacheData)) {
+        const GROUP_AFFINITY& affinity = info.Cache.GroupMask;
+        if (affinity.Group == 0) {
+          for (uint32_t i = 0; i < processors.size(); ++i) {
+            if (affinity.Mask & (KAFFINITY(1) << i)) {
+              processors[i].llc_group = llc_count;
+            }
+          }
+          ++llc_count;
+        }
+      }
+      offset += info.Size;
+    }
+    if (!core_count) {
+      processors.clear();
+    }
+    return processors;
+  }();
+  return topology;
+}
+
 // https://msdn.microsoft.com/en-us/library/xcb2z8hs.aspx
 #pragma pack(push, 8)
 struct THREADNAME_INFO {
@@ -63,6 +122,16 @@ void set_name(std::thread::native_handle_type handle, const std::string& name) {
   set_name(GetThreadId(handle), name);
 }
 
+void EnterBackgroundMode() {
+  // Lowers CPU, I/O and memory priority together. Only valid on a handle to
+  // the calling thread.
+  SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+}
+
+void LeaveBackgroundMode() {
+  SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_END);
+}
+
 void MaybeYield() {
   SwitchToThread();
   MemoryBarrier();
@@ -70,6 +139,8 @@ void MaybeYield() {
 
 void SyncMemory() { MemoryBarrier(); }
 
+void Pause() { YieldProcessor(); }
+
 void Sleep(std::chrono::microseconds duration) {
   if (duration.count() < 100) {
     MaybeYield();
@@ -13,8 +13,16 @@
 #include <mutex>
 #include <vector>
 
+#include "xenia/base/profiling.h"
+
 namespace xe {
 
+// Shared live/peak accounting across all TypePool instantiations.
+inline MemoryCounter& TypePoolMemoryCounter() {
+  static MemoryCounter counter("base/type_pool");
+  return counter;
+}
+
 template <class T, typename A>
 class TypePool {
  public:
@@ -25,6 +33,7 @@ class TypePool {
     for (auto it = list_.begin(); it != list_.end(); ++it) {
       T* value = *it;
       delete value;
+      TypePoolMemoryCounter().Remove(sizeof(T));
     }
     list_.clear();
   }
@@ -40,6 +49,7 @@ class TypePool {
     }
     if (!result) {
       result = new T(arg0);
+      TypePoolMemoryCounter().Add(sizeof(T));
     }
     return result;
   }
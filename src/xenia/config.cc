@@ -1,4 +1,5 @@
 #include "config.h"
+#include <cstring>
 #include "cpptoml/include/cpptoml.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/filesystem.h"
@@ -24,6 +25,10 @@ namespace config {
 std::wstring config_name = L"xenia.config.toml";
 std::wstring config_folder;
 std::wstring config_path;
+std::wstring game_cache_folder;
+// Placeholder string config variables may use to refer to the per-title
+// cache directory, e.g. code_cache_dir = "{game_cache}/code".
+const char kGameCachePlaceholder[] = "{game_cache}";
 
 bool sortCvar(cvar::IConfigVar* a, cvar::IConfigVar* b) {
   if (a->category() < b->category()) return true;
@@ -44,8 +49,7 @@ std::shared_ptr<cpptoml::table> ParseConfig(const std::wstring& config_path) {
 
 void ReadConfig(const std::wstring& file_path) {
   const auto config = ParseConfig(file_path);
-  for (auto& it : *cvar::ConfigVars) {
-    auto config_var = static_cast<cvar::IConfigVar*>(it.second);
+  for (auto config_var : *cvar::ConfigVars) {
     auto config_key = config_var->category() + "." + config_var->name();
     if (config->contains_qualified(config_key)) {
       config_var->LoadConfigValue(config->get_qualified(config_key));
@@ -56,8 +60,7 @@ void ReadConfig(const std::wstring& file_path) {
 
 void ReadGameConfig(std::wstring file_path) {
   const auto config = ParseConfig(file_path);
-  for (auto& it : *cvar::ConfigVars) {
-    auto config_var = static_cast<cvar::IConfigVar*>(it.second);
+  for (auto config_var : *cvar::ConfigVars) {
     auto config_key = config_var->category() + "." + config_var->name();
     if (config->contains_qualified(config_key)) {
       config_var->LoadGameConfigValue(config->get_qualified(config_key));
@@ -67,8 +70,7 @@ void ReadGameConfig(std::wstring file_path) {
 }
 
 void SaveConfig() {
-  std::vector<cvar::IConfigVar*> vars;
-  for (const auto& s : *cvar::ConfigVars) vars.push_back(s.second);
+  std::vector<cvar::IConfigVar*> vars(*cvar::ConfigVars);
   std::sort(vars.begin(), vars.end(), sortCvar);
   // we use our own write logic because cpptoml doesn't
   // allow us to specify comments :(
@@ -157,6 +159,32 @@ void LoadGameConfig(const std::wstring& title_id) {
   if (xe::filesystem::PathExists(game_config_path)) {
     ReadGameConfig(game_config_path);
   }
+
+  // Establish the canonical per-title cache directory and expand the
+  // {game_cache} placeholder in string config variables as a per-title
+  // override layer, so one global config can point every disk cache at a
+  // title-local path.
+  const auto cache_folder = xe::join_paths(config_folder, L"cache");
+  game_cache_folder = xe::join_paths(cache_folder, title_id);
+  xe::filesystem::CreateFolder(cache_folder);
+  xe::filesystem::CreateFolder(game_cache_folder);
+  const auto game_cache_folder_utf8 = xe::to_string(game_cache_folder);
+  for (auto config_var : *cvar::ConfigVars) {
+    auto string_var = dynamic_cast<cvar::ConfigVar<std::string>*>(config_var);
+    if (!string_var) {
+      continue;
+    }
+    std::string value = *string_var->current_value();
+    auto pos = value.find(kGameCachePlaceholder);
+    if (pos == std::string::npos) {
+      continue;
+    }
+    value.replace(pos, std::strlen(kGameCachePlaceholder),
+                  game_cache_folder_utf8);
+    string_var->SetGameConfigValue(value);
+  }
 }
 
+std::wstring GetGameCacheFolder() { return game_cache_folder; }
+
 }  // namespace config
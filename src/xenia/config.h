@@ -5,6 +5,12 @@
 namespace config {
 void SetupConfig(const std::wstring& config_folder);
 void LoadGameConfig(const std::wstring& title_id);
+// Canonical per-title cache directory, <storage>/cache/<title id>, for disk
+// caches (translated code, function profiles, patched images, pipelines).
+// Created by LoadGameConfig; empty before a title has been loaded. String
+// config variables may reference it with the {game_cache} placeholder, which
+// is expanded when the title is loaded.
+std::wstring GetGameCacheFolder();
 }  // namespace config
 
 #endif  // XENIA_CONFIG_H_
@@ -33,6 +33,30 @@ class CodeCache {
 
   // Finds platform-specific function unwind info for the given host PC.
   virtual void* LookupUnwindInfo(uint64_t host_pc) = 0;
+
+  // Serializes all code placed so far to a cache file that LoadCache can
+  // restore on a later run. The key identifies the title the code belongs to.
+  // Returns false if the backend does not support persistence.
+  virtual bool SaveCache(const std::wstring& path, uint64_t key) {
+    return false;
+  }
+  // Restores a cache file previously written by SaveCache, skipping
+  // translation of the contained functions. The cache is rejected (returning
+  // false) if it was written for a different key or is otherwise unusable in
+  // this process.
+  virtual bool LoadCache(const std::wstring& path, uint64_t key) {
+    return false;
+  }
+
+  // Releases a retired code body previously returned by placement. The caller
+  // must guarantee that no thread is executing within the region and that no
+  // call site will reach it again (i.e. the indirection table has been
+  // repointed). The backend returns physical pages where the platform allows
+  // it; the address range itself is never reused. Returns false if the
+  // backend does not support reclamation.
+  virtual bool ReleaseGuestCode(void* code_address, size_t code_size) {
+    return false;
+  }
 };
 
 }  // namespace backend
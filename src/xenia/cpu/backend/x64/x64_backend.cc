@@ -30,6 +30,17 @@ DEFINE_bool(
     use_haswell_instructions, true,
     "Uses the AVX2/FMA/etc instructions on Haswell processors when available.",
     "CPU");
+DEFINE_bool(use_avx512_instructions, true,
+            "Uses AVX-512 instructions (single-instruction byte permutes/etc) "
+            "when available.",
+            "CPU");
+DEFINE_bool(flush_denormals, false,
+            "Treat denormal floats as zero (DAZ/FTZ) in guest code regardless "
+            "of the non-IEEE mode bit in FPSCR. Denormal inputs are handled "
+            "by microcode assists on most hosts, so titles that stream tiny "
+            "values through the FPU gain a lot; results differ from the "
+            "console only in the least significant bits of denormal math.",
+            "CPU");
 
 namespace xe {
 namespace cpu {
@@ -402,6 +413,11 @@ X64ThunkEmitter::X64ThunkEmitter(X64Backend* backend, XbyakAllocator* allocator)
 
 X64ThunkEmitter::~X64ThunkEmitter() {}
 
+// MXCSR states loaded by the host/guest transition thunks when
+// --flush_denormals is active.
+static const uint32_t mxcsr_default = 0x1F80;
+static const uint32_t mxcsr_flush_denormals = 0x9FC0;
+
 HostToGuestThunk X64ThunkEmitter::EmitHostToGuestThunk() {
   // rcx = target
   // rdx = arg0 (context)
@@ -431,6 +447,13 @@ HostToGuestThunk X64ThunkEmitter::EmitHostToGuestThunk() {
   // Save nonvolatile registers.
   EmitSaveNonvolatileRegs();
 
+  if (cvars::flush_denormals) {
+    // Enter guest code with DAZ/FTZ set; guest mtfsf keeps it set via the
+    // flush variant of the rounding mode table.
+    mov(rax, uintptr_t(&mxcsr_flush_denormals));
+    vldmxcsr(ptr[rax]);
+  }
+
   mov(rax, rcx);
   mov(rsi, rdx);  // context
   mov(rcx, r8);   // return address
@@ -438,6 +461,12 @@ HostToGuestThunk X64ThunkEmitter::EmitHostToGuestThunk() {
 
   EmitLoadNonvolatileRegs();
 
+  if (cvars::flush_denormals) {
+    // Host code expects the default IEEE environment back.
+    mov(rcx, uintptr_t(&mxcsr_default));
+    vldmxcsr(ptr[rcx]);
+  }
+
   code_offsets.epilog = getSize();
 
   add(rsp, stack_size);
@@ -16,6 +16,7 @@
 #include "xenia/cpu/backend/backend.h"
 
 DECLARE_bool(use_haswell_instructions);
+DECLARE_bool(use_avx512_instructions);
 
 namespace xe {
 class Exception;
@@ -9,6 +9,7 @@
 
 #include "xenia/cpu/backend/x64/x64_code_cache.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -19,17 +20,31 @@
 
 #include "xenia/base/assert.h"
 #include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
+#include "xenia/base/profiling.h"
 #include "xenia/cpu/function.h"
 #include "xenia/cpu/module.h"
 
+DEFINE_bool(code_cache_large_pages, true,
+            "Request 2MB large page backing for the JIT code cache and the "
+            "indirection table to reduce TLB misses in generated code. "
+            "Advisory; the OS falls back to regular pages where it can't "
+            "oblige.",
+            "CPU");
+
 namespace xe {
 namespace cpu {
 namespace backend {
 namespace x64 {
 
+namespace {
+MemoryCounter code_cache_memory("cpu/x64_code_cache");
+}  // namespace
+
 X64CodeCache::X64CodeCache() = default;
 
 X64CodeCache::~X64CodeCache() {
@@ -40,6 +55,10 @@ X64CodeCache::~X64CodeCache() {
 
   // Unmap all views and close mapping.
   if (mapping_) {
+    if (generated_code_write_base_) {
+      xe::memory::UnmapFileView(mapping_, generated_code_write_base_,
+                                kGeneratedCodeSize);
+    }
     xe::memory::UnmapFileView(mapping_, generated_code_base_,
                               kGeneratedCodeSize);
     xe::memory::CloseFileMappingHandle(mapping_);
@@ -84,9 +103,31 @@ bool X64CodeCache::Initialize() {
     return false;
   }
 
+  // Second, writable view of the same pages at an OS-chosen address. All
+  // code writes go through this view so they never touch the mapping guest
+  // threads are executing from.
+  generated_code_write_base_ =
+      reinterpret_cast<uint8_t*>(xe::memory::MapFileView(
+          mapping_, nullptr, kGeneratedCodeSize,
+          xe::memory::PageAccess::kReadWrite, 0));
+  if (!generated_code_write_base_) {
+    XELOGE("Unable to allocate code cache write view");
+    return false;
+  }
+
   // Preallocate the function map to a large, reasonable size.
   generated_code_map_.reserve(kMaximumFunctionCount);
 
+  // With tens of MB of hot generated code, 4KB pages thrash the iTLB; ask for
+  // 2MB pages where the OS will grant them.
+  if (cvars::code_cache_large_pages) {
+    if (indirection_table_base_) {
+      xe::memory::AdviseLargePages(indirection_table_base_,
+                                   kIndirectionTableSize);
+    }
+    xe::memory::AdviseLargePages(generated_code_base_, kGeneratedCodeSize);
+  }
+
   return true;
 }
 
@@ -134,23 +175,26 @@ void* X64CodeCache::PlaceHostCode(uint32_t guest_address, void* machine_code,
 void* X64CodeCache::PlaceGuestCode(uint32_t guest_address, void* machine_code,
                                    const EmitFunctionInfo& func_info,
                                    GuestFunction* function_info) {
-  // Hold a lock while we bump the pointers up. This is important as the
-  // unwind table requires entries AND code to be sorted in order.
-  size_t low_mark;
+  // Hold a lock only while we bump the pointers up. This is important as the
+  // unwind table requires entries AND code to be sorted in order - but once
+  // a range has been reserved it belongs exclusively to this thread, so
+  // filling it in can proceed concurrently with other placements and with
+  // guest execution.
   size_t high_mark;
   uint8_t* code_address;
+  uint8_t* tail_address;
+  uint8_t* end_address;
   UnwindReservation unwind_reservation;
   {
     auto global_lock = global_critical_region_.Acquire();
 
-    low_mark = generated_code_offset_;
-
     // Reserve code.
     // Always move the code to land on 16b alignment.
     code_address = generated_code_base_ + generated_code_offset_;
     generated_code_offset_ += xe::round_up(func_info.code_size.total, 16);
+    code_cache_memory.Add(xe::round_up(func_info.code_size.total, 16));
 
-    auto tail_address = generated_code_base_ + generated_code_offset_;
+    tail_address = generated_code_base_ + generated_code_offset_;
 
     // Reserve unwind info.
     // We go on the high size of the unwind info as we don't know how big we
@@ -159,7 +203,7 @@ void* X64CodeCache::PlaceGuestCode(uint32_t guest_address, void* machine_code,
         RequestUnwindReservation(generated_code_base_ + generated_code_offset_);
     generated_code_offset_ += xe::round_up(unwind_reservation.data_size, 16);
 
-    auto end_address = generated_code_base_ + generated_code_offset_;
+    end_address = generated_code_base_ + generated_code_offset_;
 
     high_mark = generated_code_offset_;
 
@@ -169,38 +213,43 @@ void* X64CodeCache::PlaceGuestCode(uint32_t guest_address, void* machine_code,
         (uint64_t(code_address - generated_code_base_) << 32) |
             generated_code_offset_,
         function_info);
-
-    // TODO(DrChat): The following code doesn't really need to be under the
-    // global lock except for PlaceCode (but it depends on the previous code
-    // already being ran)
-
-    // If we are going above the high water mark of committed memory, commit
-    // some more. It's ok if multiple threads do this, as redundant commits
-    // aren't harmful.
-    size_t old_commit_mark, new_commit_mark;
-    do {
-      old_commit_mark = generated_code_commit_mark_;
-      if (high_mark <= old_commit_mark) break;
-
-      new_commit_mark = old_commit_mark + 16 * 1024 * 1024;
-      xe::memory::AllocFixed(generated_code_base_, new_commit_mark,
-                             xe::memory::AllocationType::kCommit,
-                             xe::memory::PageAccess::kExecuteReadWrite);
-    } while (generated_code_commit_mark_.compare_exchange_weak(
-        old_commit_mark, new_commit_mark));
-
-    // Copy code.
-    std::memcpy(code_address, machine_code, func_info.code_size.total);
-
-    // Fill unused slots with 0xCC
-    std::memset(tail_address, 0xCC,
-                static_cast<size_t>(end_address - tail_address));
-
-    // Notify subclasses of placed code.
-    PlaceCode(guest_address, machine_code, func_info, code_address,
-              unwind_reservation);
   }
 
+  // If we are going above the high water mark of committed memory, commit
+  // some more. It's ok if multiple threads do this, as redundant commits
+  // aren't harmful.
+  size_t old_commit_mark, new_commit_mark;
+  do {
+    old_commit_mark = generated_code_commit_mark_;
+    if (high_mark <= old_commit_mark) break;
+
+    new_commit_mark = old_commit_mark + 16 * 1024 * 1024;
+    // Prefer the committing thread's NUMA node for the new pages - the thread
+    // emitting the code is also the one most likely to fetch it.
+    xe::memory::AllocFixedOnNode(xe::memory::current_numa_node(),
+                                 generated_code_base_, new_commit_mark,
+                                 xe::memory::AllocationType::kCommit,
+                                 xe::memory::PageAccess::kExecuteReadWrite);
+  } while (generated_code_commit_mark_.compare_exchange_weak(old_commit_mark,
+                                                             new_commit_mark));
+
+  // Copy code through the write view so the executable mapping guest threads
+  // run from is never written to.
+  uint8_t* write_address =
+      generated_code_write_base_ + (code_address - generated_code_base_);
+  std::memcpy(write_address, machine_code, func_info.code_size.total);
+
+  // Fill unused slots with 0xCC
+  std::memset(
+      generated_code_write_base_ + (tail_address - generated_code_base_), 0xCC,
+      static_cast<size_t>(end_address - tail_address));
+
+  // Notify subclasses of placed code. Unwind info is written into this
+  // function's own reservation, and the Win32 grow-table notification was
+  // already written to tolerate running outside the lock.
+  PlaceCode(guest_address, machine_code, func_info, code_address,
+            unwind_reservation);
+
 #if ENABLE_VTUNE
   if (iJIT_IsProfilingActive() == iJIT_SAMPLING_ON) {
     std::string method_name;
@@ -222,10 +271,13 @@ void* X64CodeCache::PlaceGuestCode(uint32_t guest_address, void* machine_code,
   }
 #endif
 
-  // Now that everything is ready, fix up the indirection table.
+  // Now that everything is ready, fix up the indirection table: a single
+  // aligned 32-bit store is the only publication point, with a release fence
+  // ordering it after the code bytes written above.
   // Note that we do support code that doesn't have an indirection fixup, so
   // ignore those when we see them.
   if (guest_address && indirection_table_base_) {
+    std::atomic_thread_fence(std::memory_order_release);
     uint32_t* indirection_slot = reinterpret_cast<uint32_t*>(
         indirection_table_base_ + (guest_address - kIndirectionTableBase));
     *indirection_slot = uint32_t(reinterpret_cast<uint64_t>(code_address));
@@ -245,6 +297,7 @@ uint32_t X64CodeCache::PlaceData(const void* data, size_t length) {
     // Always move the code to land on 16b alignment.
     data_address = generated_code_base_ + generated_code_offset_;
     generated_code_offset_ += xe::round_up(length, 16);
+    code_cache_memory.Add(xe::round_up(length, 16));
 
     high_mark = generated_code_offset_;
   }
@@ -258,9 +311,10 @@ uint32_t X64CodeCache::PlaceData(const void* data, size_t length) {
     if (high_mark <= old_commit_mark) break;
 
     new_commit_mark = old_commit_mark + 16 * 1024 * 1024;
-    xe::memory::AllocFixed(generated_code_base_, new_commit_mark,
-                           xe::memory::AllocationType::kCommit,
-                           xe::memory::PageAccess::kExecuteReadWrite);
+    xe::memory::AllocFixedOnNode(xe::memory::current_numa_node(),
+                                 generated_code_base_, new_commit_mark,
+                                 xe::memory::AllocationType::kCommit,
+                                 xe::memory::PageAccess::kExecuteReadWrite);
   } while (generated_code_commit_mark_.compare_exchange_weak(old_commit_mark,
                                                              new_commit_mark));
 
@@ -297,6 +351,265 @@ GuestFunction* X64CodeCache::LookupFunction(uint64_t host_pc) {
   }
 }
 
+bool X64CodeCache::ReleaseGuestCode(void* code_address, size_t code_size) {
+  uint8_t* code = reinterpret_cast<uint8_t*>(code_address);
+  if (code < generated_code_base_ ||
+      code + code_size > generated_code_base_ + generated_code_offset_) {
+    assert_always();
+    return false;
+  }
+  size_t offset = size_t(code - generated_code_base_);
+  size_t length = xe::round_up(code_size, 16);
+
+  // NOTE: besides the contract on the base class, inline cache resets below
+  // require that no guest thread is running at all - a resetting store can
+  // tear against a concurrent tag compare.
+  auto global_lock = global_critical_region_.Acquire();
+
+  // Unlink the function map entry so host PCs within the region no longer
+  // resolve. Erasing keeps the vector sorted for the bsearch in
+  // LookupFunction; releases are rare enough that the shift doesn't matter.
+  // The entry also covered the trailing unwind reservation, which stays
+  // committed as the platform unwind table may still reference it.
+  for (auto it = generated_code_map_.begin(); it != generated_code_map_.end();
+       ++it) {
+    if (size_t(it->first >> 32) == offset) {
+      generated_code_map_.erase(it);
+      break;
+    }
+  }
+
+  // Reset every inline cache that dispatched into the region and forget the
+  // slots that lived inside it.
+  uint32_t code_host_address = uint32_t(kGeneratedCodeBase + offset);
+  auto slot_it = std::remove_if(
+      inline_cache_tag_offsets_.begin(), inline_cache_tag_offsets_.end(),
+      [&](uint32_t tag_offset) {
+        if (tag_offset - offset < length) {
+          return true;
+        }
+        uint32_t target;
+        std::memcpy(&target, generated_code_write_base_ + tag_offset + 4,
+                    sizeof(target));
+        if (target - code_host_address < length) {
+          uint32_t empty_tag = 0xFFFFFFFF;
+          std::memcpy(generated_code_write_base_ + tag_offset, &empty_tag,
+                      sizeof(empty_tag));
+        }
+        return false;
+      });
+  inline_cache_tag_offsets_.erase(slot_it, inline_cache_tag_offsets_.end());
+
+  // Fill with int3 through the write view so anything that still reaches the
+  // region faults immediately, then return whole pages to the OS. Partially
+  // covered edge pages are shared with live neighbors and stay resident.
+  std::memset(generated_code_write_base_ + offset, 0xCC, length);
+  size_t page_mask = xe::memory::page_size() - 1;
+  size_t discard_start = (offset + page_mask) & ~page_mask;
+  size_t discard_end = (offset + length) & ~page_mask;
+  if (discard_end > discard_start) {
+    DiscardCodeRange(discard_start, discard_end - discard_start);
+  }
+
+  code_cache_memory.Remove(length);
+  return true;
+}
+
+void X64CodeCache::RegisterInlineCacheTags(void* code_address,
+                                           const uint32_t* offsets,
+                                           size_t count) {
+  if (!count) {
+    return;
+  }
+  uint32_t base_offset =
+      uint32_t(reinterpret_cast<uint8_t*>(code_address) - generated_code_base_);
+  auto global_lock = global_critical_region_.Acquire();
+  for (size_t i = 0; i < count; ++i) {
+    inline_cache_tag_offsets_.push_back(base_offset + offsets[i]);
+  }
+}
+
+namespace {
+
+// On-disk layout for SaveCache/LoadCache. The code region is dumped verbatim,
+// followed by the inline cache tag offsets, so entries only need enough
+// information to rebuild the indirection table.
+struct CacheFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t key;
+  uint64_t host_anchor;
+  uint64_t code_size;
+  uint32_t entry_count;
+  uint32_t inline_cache_count;
+};
+struct CacheFileEntry {
+  uint32_t guest_address;
+  uint32_t code_offset;
+};
+
+constexpr uint32_t kCacheFileMagic = 0x58434331;  // 'XCC1'
+constexpr uint32_t kCacheFileVersion = 2;
+
+// Generated code embeds raw host addresses (helper calls, the global lock
+// count, XMM constant pools), so a cache is only reusable when the emulator
+// image is mapped at the same base it was mapped at when the cache was
+// written. The anchor check below is only sound because every address the
+// emitter bakes in as an immediate has static storage duration: per-run heap
+// state (MMIO callback contexts, per-function profiling counters) must be
+// reached through statics in the image, never captured by value at
+// translation time.
+uint64_t host_relocation_anchor() {
+  return reinterpret_cast<uint64_t>(&host_relocation_anchor);
+}
+
+}  // namespace
+
+bool X64CodeCache::SaveCache(const std::wstring& path, uint64_t key) {
+  auto global_lock = global_critical_region_.Acquire();
+
+  std::vector<CacheFileEntry> entries;
+  entries.reserve(generated_code_map_.size());
+  for (auto& it : generated_code_map_) {
+    if (!it.second) {
+      // Host code (thunks/etc); regenerated before the cache is loaded.
+      continue;
+    }
+    if (it.second->tier() == GuestFunction::Tier::kBaseline) {
+      // Baseline bodies embed the address of their GuestFunction's execution
+      // counter, which won't exist next run. They're cheap to retranslate, so
+      // only the optimized tier is published on load.
+      continue;
+    }
+    CacheFileEntry entry;
+    entry.guest_address = it.second->address();
+    entry.code_offset = uint32_t(it.first >> 32);
+    entries.push_back(entry);
+  }
+
+  CacheFileHeader header = {};
+  header.magic = kCacheFileMagic;
+  header.version = kCacheFileVersion;
+  header.key = key;
+  header.host_anchor = host_relocation_anchor();
+  header.code_size = generated_code_offset_;
+  header.entry_count = uint32_t(entries.size());
+  header.inline_cache_count = uint32_t(inline_cache_tag_offsets_.size());
+
+  FILE* file = xe::filesystem::OpenFile(path, "wb");
+  if (!file) {
+    XELOGE("Unable to open code cache file for writing");
+    return false;
+  }
+  fwrite(&header, sizeof(header), 1, file);
+  fwrite(entries.data(), sizeof(CacheFileEntry), entries.size(), file);
+  fwrite(inline_cache_tag_offsets_.data(), sizeof(uint32_t),
+         inline_cache_tag_offsets_.size(), file);
+  fwrite(generated_code_base_, 1, generated_code_offset_, file);
+  fclose(file);
+
+  XELOGCPU("Saved code cache: %u functions, %lluKB of code",
+           header.entry_count, uint64_t(header.code_size / 1024));
+  return true;
+}
+
+bool X64CodeCache::LoadCache(const std::wstring& path, uint64_t key) {
+  FILE* file = xe::filesystem::OpenFile(path, "rb");
+  if (!file) {
+    // Cold launch; nothing to warm from.
+    return false;
+  }
+
+  CacheFileHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      header.magic != kCacheFileMagic ||
+      header.version != kCacheFileVersion || header.key != key ||
+      header.code_size > kGeneratedCodeSize) {
+    XELOGW("Ignoring code cache: incompatible file");
+    fclose(file);
+    return false;
+  }
+  if (header.host_anchor != host_relocation_anchor()) {
+    // Process image moved (ASLR/new build); embedded host addresses in the
+    // cached code would be dangling.
+    XELOGW("Ignoring code cache: emulator image base changed");
+    fclose(file);
+    return false;
+  }
+
+  std::vector<CacheFileEntry> entries(header.entry_count);
+  std::vector<uint32_t> inline_cache_offsets(header.inline_cache_count);
+  std::vector<uint8_t> code(size_t(header.code_size));
+  if (fread(entries.data(), sizeof(CacheFileEntry), entries.size(), file) !=
+          entries.size() ||
+      fread(inline_cache_offsets.data(), sizeof(uint32_t),
+            inline_cache_offsets.size(),
+            file) != inline_cache_offsets.size() ||
+      fread(code.data(), 1, code.size(), file) != code.size()) {
+    XELOGW("Ignoring code cache: truncated file");
+    fclose(file);
+    return false;
+  }
+  fclose(file);
+
+  for (uint32_t tag_offset : inline_cache_offsets) {
+    if (tag_offset + 8 > code.size()) {
+      XELOGW("Ignoring code cache: inline cache slot out of range");
+      return false;
+    }
+  }
+
+  auto global_lock = global_critical_region_.Acquire();
+
+  // Everything placed so far this run (backend thunks) must match the start
+  // of the saved region byte for byte, as the cached code calls into it by
+  // absolute address. Emission is deterministic, so a mismatch means a
+  // different build snuck past the anchor check.
+  if (generated_code_offset_ > code.size() ||
+      std::memcmp(generated_code_base_, code.data(), generated_code_offset_)) {
+    XELOGW("Ignoring code cache: emitted code prologue mismatch");
+    return false;
+  }
+
+  // Commit and restore the code region, then resume appending after it.
+  size_t commit_mark = xe::round_up(code.size(), 16 * 1024 * 1024);
+  xe::memory::AllocFixedOnNode(xe::memory::current_numa_node(),
+                               generated_code_base_, commit_mark,
+                               xe::memory::AllocationType::kCommit,
+                               xe::memory::PageAccess::kExecuteReadWrite);
+  generated_code_commit_mark_ = commit_mark;
+  std::memcpy(generated_code_base_ + generated_code_offset_,
+              code.data() + generated_code_offset_,
+              code.size() - generated_code_offset_);
+  generated_code_offset_ = code.size();
+
+  // Restored inline caches start cold: a saved slot may hold a target inside
+  // a body that isn't re-published below (baseline tier), and the miss path
+  // will re-prime it from the indirection table anyway. The offsets are
+  // adopted as this run's slot list so ReleaseGuestCode keeps flushing them;
+  // anything registered so far this run lies in the byte-identical prefix and
+  // so is already in the saved list.
+  inline_cache_tag_offsets_.assign(inline_cache_offsets.begin(),
+                                   inline_cache_offsets.end());
+  for (uint32_t tag_offset : inline_cache_tag_offsets_) {
+    uint64_t empty_slot = 0xFFFFFFFF;
+    std::memcpy(generated_code_write_base_ + tag_offset, &empty_slot,
+                sizeof(empty_slot));
+  }
+
+  // Point the indirection table at the restored code so guest-to-guest calls
+  // dispatch straight into it. Functions reached any other way (thread entry
+  // points, exports) are still translated on demand and simply appended.
+  for (const auto& entry : entries) {
+    AddIndirection(entry.guest_address,
+                   uint32_t(kGeneratedCodeBase + entry.code_offset));
+  }
+
+  XELOGCPU("Loaded code cache: %u functions, %lluKB of code",
+           header.entry_count, uint64_t(header.code_size / 1024));
+  return true;
+}
+
 }  // namespace x64
 }  // namespace backend
 }  // namespace cpu
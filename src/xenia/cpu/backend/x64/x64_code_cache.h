@@ -54,6 +54,7 @@ class X64CodeCache : public CodeCache {
   // TODO(benvanik): padding/guards/etc
 
   bool has_indirection_table() { return indirection_table_base_ != nullptr; }
+  uint32_t indirection_default() const { return indirection_default_value_; }
   void set_indirection_default(uint32_t default_value);
   void AddIndirection(uint32_t guest_address, uint32_t host_address);
 
@@ -66,8 +67,20 @@ class X64CodeCache : public CodeCache {
                        GuestFunction* function_info);
   uint32_t PlaceData(const void* data, size_t length);
 
+  bool ReleaseGuestCode(void* code_address, size_t code_size) override;
+
+  // Records the cache-relative offsets of the inline cache tag dwords emitted
+  // into the function placed at code_address. ReleaseGuestCode resets any
+  // inline cache whose cached target lies within a released region, so
+  // retired bodies are never reachable through a stale monomorphic cache.
+  void RegisterInlineCacheTags(void* code_address, const uint32_t* offsets,
+                               size_t count);
+
   GuestFunction* LookupFunction(uint64_t host_pc) override;
 
+  bool SaveCache(const std::wstring& path, uint64_t key) override;
+  bool LoadCache(const std::wstring& path, uint64_t key) override;
+
  protected:
   // All executable code falls within 0x80000000 to 0x9FFFFFFF, so we can
   // only map enough for lookups within that range.
@@ -98,6 +111,12 @@ class X64CodeCache : public CodeCache {
   virtual void PlaceCode(uint32_t guest_address, void* machine_code,
                          const EmitFunctionInfo& func_info, void* code_address,
                          UnwindReservation unwind_reservation) {}
+  // Returns the physical pages backing the given page-aligned range of the
+  // generated code region to the OS, where the platform supports punching
+  // holes in the mapping. The range reads back as zeroes afterwards. The
+  // default keeps the pages committed; ReleaseGuestCode still unlinks the
+  // region either way.
+  virtual void DiscardCodeRange(size_t offset, size_t length) {}
 
   std::wstring file_name_;
   xe::memory::FileMappingHandle mapping_ = nullptr;
@@ -116,6 +135,12 @@ class X64CodeCache : public CodeCache {
   // Fixed at kGeneratedCodeBase and holding all generated code, growing as
   // needed.
   uint8_t* generated_code_base_ = nullptr;
+  // Second view of the same physical pages as generated_code_base_, used for
+  // writing. Translator threads assemble functions through this view while
+  // guest threads execute from the view above; a function only becomes
+  // reachable via the indirection-table publish at the end of placement, so
+  // placement never stalls execution.
+  uint8_t* generated_code_write_base_ = nullptr;
   // Current offset to empty space in generated code.
   size_t generated_code_offset_ = 0;
   // Current high water mark of COMMITTED code.
@@ -124,6 +149,9 @@ class X64CodeCache : public CodeCache {
   // This can be used to bsearch on host PC to find the guest function.
   // The key is [start address | end address].
   std::vector<std::pair<uint64_t, GuestFunction*>> generated_code_map_;
+  // Cache-relative offsets of every inline cache tag dword placed so far, in
+  // placement order. Guarded by the global critical region.
+  std::vector<uint32_t> inline_cache_tag_offsets_;
 };
 
 }  // namespace x64
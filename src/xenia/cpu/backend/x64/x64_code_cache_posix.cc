@@ -9,6 +9,8 @@
 
 #include "xenia/cpu/backend/x64/x64_code_cache.h"
 
+#include <fcntl.h>
+
 namespace xe {
 namespace cpu {
 namespace backend {
@@ -23,6 +25,18 @@ class PosixX64CodeCache : public X64CodeCache {
 
   void* LookupUnwindInfo(uint64_t host_pc) override { return nullptr; }
 
+ protected:
+  void DiscardCodeRange(size_t offset, size_t length) override {
+#if defined(FALLOC_FL_PUNCH_HOLE)
+    // The code region is views of a shm file, so punching a hole in the file
+    // drops the backing pages out of every view at once. They fault back in
+    // as zeroes if ever touched again.
+    fallocate(int(reinterpret_cast<intptr_t>(mapping_)),
+              FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, off_t(offset),
+              off_t(length));
+#endif  // FALLOC_FL_PUNCH_HOLE
+  }
+
  private:
   /*
   UnwindReservation RequestUnwindReservation(uint8_t* entry_address) override;
@@ -40,6 +40,10 @@ DEFINE_bool(ignore_undefined_externs, true,
 DEFINE_bool(emit_source_annotations, false,
             "Add extra movs and nops to make disassembly easier to read.",
             "CPU");
+DEFINE_bool(indirect_call_inline_caches, true,
+            "Cache the last resolved target of each indirect guest call at "
+            "the call site, skipping the indirection table when it repeats.",
+            "CPU");
 
 namespace xe {
 namespace cpu {
@@ -78,6 +82,17 @@ X64Emitter::X64Emitter(X64Backend* backend, XbyakAllocator* allocator)
     feature_flags_ |= cpu_.has(Xbyak::util::Cpu::tF16C) ? kX64EmitF16C : 0;
     feature_flags_ |= cpu_.has(Xbyak::util::Cpu::tMOVBE) ? kX64EmitMovbe : 0;
   }
+  if (cvars::use_avx512_instructions) {
+    // Only 128-bit forms are emitted, so VL (and BW for the byte/word ops) is
+    // required alongside the base feature bit.
+    bool avx512_base = cpu_.has(Xbyak::util::Cpu::tAVX512F) &&
+                       cpu_.has(Xbyak::util::Cpu::tAVX512VL) &&
+                       cpu_.has(Xbyak::util::Cpu::tAVX512BW);
+    feature_flags_ |= avx512_base ? kX64EmitAVX512F : 0;
+    feature_flags_ |= avx512_base && cpu_.has(Xbyak::util::Cpu::tAVX512_VBMI)
+                          ? kX64EmitAVX512VBMI
+                          : 0;
+  }
 
   if (!cpu_.has(Xbyak::util::Cpu::tAVX)) {
     xe::FatalError(
@@ -101,6 +116,16 @@ bool X64Emitter::Emit(GuestFunction* function, HIRBuilder* builder,
   trace_data_ = &function->trace_data();
   source_map_arena_.Reset();
 
+  // Baseline-tier functions count their entries so the tier-up sweep can
+  // find the hot ones. When a profile directory is set all functions count,
+  // as the counts are persisted for the next launch.
+  execution_count_address_ = nullptr;
+  if ((cvars::tiered_compilation &&
+       function->tier() == GuestFunction::Tier::kBaseline) ||
+      !cvars::function_profile_dir.empty()) {
+    execution_count_address_ = function->execution_count_address();
+  }
+
   // Fill the generator with code.
   EmitFunctionInfo func_info = {};
   if (!Emit(builder, func_info)) {
@@ -136,6 +161,13 @@ void* X64Emitter::Emplace(const EmitFunctionInfo& func_info,
   ready();
   top_ = old_address;
   reset();
+  if (function && !inline_cache_tag_offsets_.empty()) {
+    // Now that the body has a final address, tell the code cache where the
+    // inline cache slots landed so it can flush them when code is reclaimed.
+    code_cache_->RegisterInlineCacheTags(new_address,
+                                         inline_cache_tag_offsets_.data(),
+                                         inline_cache_tag_offsets_.size());
+  }
   return new_address;
 }
 
@@ -143,6 +175,9 @@ bool X64Emitter::Emit(HIRBuilder* builder, EmitFunctionInfo& func_info) {
   Xbyak::Label epilog_label;
   epilog_label_ = &epilog_label;
 
+  inline_caches_.clear();
+  inline_cache_tag_offsets_.clear();
+
   // Calculate stack size. We need to align things to their natural sizes.
   // This could be much better (sort by type/etc).
   auto locals = builder->locals();
@@ -192,6 +227,12 @@ bool X64Emitter::Emit(HIRBuilder* builder, EmitFunctionInfo& func_info) {
   mov(qword[rsp + StackLayout::GUEST_RET_ADDR], rcx);
   mov(qword[rsp + StackLayout::GUEST_CALL_RET_ADDR], 0);
 
+  if (execution_count_address_) {
+    // Unsynchronized on purpose - only a heuristic.
+    mov(rax, uint64_t(execution_count_address_));
+    inc(dword[rax]);
+  }
+
   // Safe now to do some tracing.
   if (debug_info_flags_ & DebugInfoFlags::kDebugInfoTraceFunctions) {
     // We require 32-bit addresses.
@@ -265,6 +306,18 @@ bool X64Emitter::Emit(HIRBuilder* builder, EmitFunctionInfo& func_info) {
 
   code_offsets.tail = getSize();
 
+  // Inline cache slots for indirect call sites. Tags start at an impossible
+  // guest address (unaligned) so the first dispatch always misses. Each slot
+  // is an aligned qword - tag in the low dword, target in the high one - so
+  // guest threads always see the two move together.
+  for (auto& ic : inline_caches_) {
+    align(8);
+    L(ic->slot);
+    inline_cache_tag_offsets_.push_back(uint32_t(getSize()));
+    dd(0xFFFFFFFF);
+    dd(0);
+  }
+
   if (cvars::emit_source_annotations) {
     nop();
     nop();
@@ -394,17 +447,19 @@ void X64Emitter::Call(const hir::Instr* instr, GuestFunction* function) {
   assert_not_null(function);
   auto fn = static_cast<X64Function*>(function);
   // Resolve address to the function to call and store in rax.
-  if (fn->machine_code()) {
-    // TODO(benvanik): is it worth it to do this? It removes the need for
-    // a ResolveFunction call, but makes the table less useful.
-    assert_zero(uint64_t(fn->machine_code()) & 0xFFFFFFFF00000000);
-    mov(eax, uint32_t(uint64_t(fn->machine_code())));
-  } else if (code_cache_->has_indirection_table()) {
+  if (code_cache_->has_indirection_table()) {
     // Load the pointer to the indirection table maintained in X64CodeCache.
     // The target dword will either contain the address of the generated code
-    // or a thunk to ResolveAddress.
+    // or a thunk to ResolveAddress. Going through the table even when the
+    // callee's code address is already known costs one extra load, but means
+    // no call site ever pins a code version: when the callee is retranslated
+    // the repointed table entry takes effect everywhere at once and the old
+    // body can be reclaimed.
     mov(ebx, function->address());
     mov(eax, dword[ebx]);
+  } else if (fn->machine_code()) {
+    assert_zero(uint64_t(fn->machine_code()) & 0xFFFFFFFF00000000);
+    mov(eax, uint32_t(uint64_t(fn->machine_code())));
   } else {
     // Old-style resolve.
     // Not too important because indirection table is almost always available.
@@ -445,7 +500,38 @@ void X64Emitter::CallIndirect(const hir::Instr* instr,
     if (reg.cvt32() != ebx) {
       mov(ebx, reg.cvt32());
     }
-    mov(eax, dword[ebx]);
+    if (cvars::indirect_call_inline_caches) {
+      // Monomorphic inline cache: remember the last guest target dispatched
+      // from this call site and skip the indirection table load while it
+      // repeats. The cache slots live in the (writable) code cache and are
+      // updated by the miss path below.
+      auto ic = std::make_unique<InlineCache>();
+      Xbyak::Label ic_miss, ic_done;
+      // The slot packs tag (low dword) and target (high dword) in one
+      // aligned qword read and written with single 64-bit accesses, so a
+      // racing thread can never pair a matching tag with a stale target.
+      mov(rdx, qword[rip + ic->slot]);
+      cmp(edx, ebx);
+      jne(ic_miss);
+      mov(rax, rdx);
+      shr(rax, 32);
+      jmp(ic_done);
+      L(ic_miss);
+      mov(eax, dword[ebx]);
+      // Never cache the resolver thunk or this site would stick to the slow
+      // path after the target is translated.
+      cmp(eax, code_cache_->indirection_default());
+      je(ic_done);
+      mov(ecx, ebx);
+      mov(rdx, rax);
+      shl(rdx, 32);
+      or_(rdx, rcx);
+      mov(qword[rip + ic->slot], rdx);
+      L(ic_done);
+      inline_caches_.push_back(std::move(ic));
+    } else {
+      mov(eax, dword[ebx]);
+    }
   } else {
     // Old-style resolve.
     // Not too important because indirection table is almost always available.
@@ -10,6 +10,7 @@
 #ifndef XENIA_CPU_BACKEND_X64_X64_EMITTER_H_
 #define XENIA_CPU_BACKEND_X64_X64_EMITTER_H_
 
+#include <memory>
 #include <vector>
 
 #include "xenia/base/arena.h"
@@ -129,6 +130,9 @@ enum X64EmitterFeatureFlags {
   kX64EmitBMI2 = 1 << 4,
   kX64EmitF16C = 1 << 5,
   kX64EmitMovbe = 1 << 6,
+  // Implies AVX512VL+AVX512BW, as the emitter only uses 128-bit forms.
+  kX64EmitAVX512F = 1 << 7,
+  kX64EmitAVX512VBMI = 1 << 8,
 };
 
 class X64Emitter : public Xbyak::CodeGenerator {
@@ -179,6 +183,8 @@ class X64Emitter : public Xbyak::CodeGenerator {
 
   Xbyak::Label& epilog_label() { return *epilog_label_; }
 
+  uint32_t debug_info_flags() const { return debug_info_flags_; }
+
   void MarkSourceOffset(const hir::Instr* i);
 
   void DebugBreak();
@@ -248,8 +254,24 @@ class X64Emitter : public Xbyak::CodeGenerator {
   FunctionDebugInfo* debug_info_ = nullptr;
   uint32_t debug_info_flags_ = 0;
   FunctionTraceData* trace_data_ = nullptr;
+  // When non-null, the prolog increments this counter on entry (baseline
+  // tier profiling).
+  uint32_t* execution_count_address_ = nullptr;
   Arena source_map_arena_;
 
+  // Per-call-site inline cache slots for indirect calls. Referenced from the
+  // body as they are emitted and placed (and bound) in the function tail so
+  // they are never executed as code. Each slot is one align(8) qword packing
+  // the tag (low dword) and target (high dword) so dispatch and update move
+  // the pair with single 64-bit accesses.
+  struct InlineCache {
+    Xbyak::Label slot;
+  };
+  std::vector<std::unique_ptr<InlineCache>> inline_caches_;
+  // Function-relative offsets of the placed tag dwords, registered with the
+  // code cache after placement so reclamation can flush stale caches.
+  std::vector<uint32_t> inline_cache_tag_offsets_;
+
   size_t stack_size_ = 0;
 
   static const uint32_t gpr_reg_map_[GPR_COUNT];
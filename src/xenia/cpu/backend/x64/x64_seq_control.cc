@@ -447,9 +447,137 @@ EMITTER_OPCODE_TABLE(OPCODE_BRANCH, BRANCH);
 // ============================================================================
 // OPCODE_BRANCH_TRUE
 // ============================================================================
+
+// PPC cmp+bc pairs reach the backend as an integer OPCODE_COMPARE_* feeding
+// the branch directly once context promotion strips the dead CR stores. The
+// integer compare sequences end with the host cmp followed only by a setcc,
+// which doesn't write flags, so as long as nothing flag-clobbering was
+// emitted in between the branch can test the comparison condition directly
+// instead of rematerializing it from the i8 value with test.
+enum class FusedCompareCondition {
+  kNone,
+  kEQ,
+  kNE,
+  kSLT,
+  kSLE,
+  kSGT,
+  kSGE,
+  kULT,
+  kULE,
+  kUGT,
+  kUGE,
+};
+
+static FusedCompareCondition GetFusedCompareCondition(
+    X64Emitter& e, const hir::Instr* branch, const hir::Value* value) {
+  const hir::Instr* def = branch->prev;
+  // Skip over instructions that only emit flag-preserving code: register
+  // copies and source markers (unless coverage tracing makes those emit a
+  // lock inc).
+  while (def &&
+         (def->opcode->num == OPCODE_ASSIGN ||
+          def->opcode->num == OPCODE_NOP ||
+          (def->opcode->num == OPCODE_SOURCE_OFFSET &&
+           !(e.debug_info_flags() &
+             DebugInfoFlags::kDebugInfoTraceFunctionCoverage)))) {
+    def = def->prev;
+  }
+  if (!def || def->dest != value || def->opcode->num < OPCODE_COMPARE_EQ ||
+      def->opcode->num > OPCODE_COMPARE_UGE ||
+      def->src1.value->type > INT64_TYPE) {
+    return FusedCompareCondition::kNone;
+  }
+  static const FusedCompareCondition kConditions[] = {
+      FusedCompareCondition::kEQ,  FusedCompareCondition::kNE,
+      FusedCompareCondition::kSLT, FusedCompareCondition::kSLE,
+      FusedCompareCondition::kSGT, FusedCompareCondition::kSGE,
+      FusedCompareCondition::kULT, FusedCompareCondition::kULE,
+      FusedCompareCondition::kUGT, FusedCompareCondition::kUGE,
+  };
+  FusedCompareCondition condition =
+      kConditions[def->opcode->num - OPCODE_COMPARE_EQ];
+  if (def->src1.value->IsConstant()) {
+    // The compare helpers emit a constant lhs with the operands swapped.
+    switch (condition) {
+      case FusedCompareCondition::kSLT:
+        condition = FusedCompareCondition::kSGT;
+        break;
+      case FusedCompareCondition::kSLE:
+        condition = FusedCompareCondition::kSGE;
+        break;
+      case FusedCompareCondition::kSGT:
+        condition = FusedCompareCondition::kSLT;
+        break;
+      case FusedCompareCondition::kSGE:
+        condition = FusedCompareCondition::kSLE;
+        break;
+      case FusedCompareCondition::kULT:
+        condition = FusedCompareCondition::kUGT;
+        break;
+      case FusedCompareCondition::kULE:
+        condition = FusedCompareCondition::kUGE;
+        break;
+      case FusedCompareCondition::kUGT:
+        condition = FusedCompareCondition::kULT;
+        break;
+      case FusedCompareCondition::kUGE:
+        condition = FusedCompareCondition::kULE;
+        break;
+      default:
+        break;
+    }
+  }
+  return condition;
+}
+
+static void EmitFusedCompareJump(X64Emitter& e,
+                                 FusedCompareCondition condition,
+                                 bool jump_if_true, const char* label) {
+  switch (condition) {
+    case FusedCompareCondition::kEQ:
+      jump_if_true ? e.je(label, e.T_NEAR) : e.jne(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kNE:
+      jump_if_true ? e.jne(label, e.T_NEAR) : e.je(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kSLT:
+      jump_if_true ? e.jl(label, e.T_NEAR) : e.jge(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kSLE:
+      jump_if_true ? e.jle(label, e.T_NEAR) : e.jg(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kSGT:
+      jump_if_true ? e.jg(label, e.T_NEAR) : e.jle(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kSGE:
+      jump_if_true ? e.jge(label, e.T_NEAR) : e.jl(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kULT:
+      jump_if_true ? e.jb(label, e.T_NEAR) : e.jae(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kULE:
+      jump_if_true ? e.jbe(label, e.T_NEAR) : e.ja(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kUGT:
+      jump_if_true ? e.ja(label, e.T_NEAR) : e.jbe(label, e.T_NEAR);
+      break;
+    case FusedCompareCondition::kUGE:
+      jump_if_true ? e.jae(label, e.T_NEAR) : e.jb(label, e.T_NEAR);
+      break;
+    default:
+      assert_unhandled_case(condition);
+      break;
+  }
+}
+
 struct BRANCH_TRUE_I8
     : Sequence<BRANCH_TRUE_I8, I<OPCODE_BRANCH_TRUE, VoidOp, I8Op, LabelOp>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
+    auto condition = GetFusedCompareCondition(e, i.instr, i.instr->src1.value);
+    if (condition != FusedCompareCondition::kNone) {
+      EmitFusedCompareJump(e, condition, true, i.src2.value->name);
+      return;
+    }
     e.test(i.src1, i.src1);
     e.jnz(i.src2.value->name, e.T_NEAR);
   }
@@ -499,6 +627,11 @@ EMITTER_OPCODE_TABLE(OPCODE_BRANCH_TRUE, BRANCH_TRUE_I8, BRANCH_TRUE_I16,
 struct BRANCH_FALSE_I8
     : Sequence<BRANCH_FALSE_I8, I<OPCODE_BRANCH_FALSE, VoidOp, I8Op, LabelOp>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
+    auto condition = GetFusedCompareCondition(e, i.instr, i.instr->src1.value);
+    if (condition != FusedCompareCondition::kNone) {
+      EmitFusedCompareJump(e, condition, false, i.src2.value->name);
+      return;
+    }
     e.test(i.src1, i.src1);
     e.jz(i.src2.value->name, e.T_NEAR);
   }
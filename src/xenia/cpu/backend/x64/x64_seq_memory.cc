@@ -28,6 +28,77 @@ RegExp ComputeContextAddress(X64Emitter& e, const OffsetOp& offset) {
   return e.GetContextReg() + offset.value;
 }
 
+// Returns the smallest provable inclusive upper bound on a guest address
+// value, or UINT64_MAX when nothing can be proved. Walks the HIR def chain
+// through the operations the PPC frontend builds effective addresses from
+// (zero extension, constant adds, masking). A bound below 2^32 also proves
+// the upper 32 bits of the host register are zero, since the register holds
+// the exact value and the bound applies to it; a bound below the 0xE0000000
+// physical alias additionally proves the 4 KB page offset emulation can't
+// apply. ComputeMemoryAddress* use this to address through the guest
+// register directly instead of masking and range-checking through eax on
+// every access.
+static uint64_t GuestAddressUpperBound(const hir::Value* value,
+                                       int depth = 0) {
+  if (!value) {
+    return UINT64_MAX;
+  }
+  if (value->IsConstant()) {
+    switch (value->type) {
+      case INT8_TYPE:
+        return value->constant.u8;
+      case INT16_TYPE:
+        return value->constant.u16;
+      case INT32_TYPE:
+        return value->constant.u32;
+      case INT64_TYPE:
+        return value->constant.u64;
+      default:
+        return UINT64_MAX;
+    }
+  }
+  if (depth >= 8 || !value->def) {
+    return UINT64_MAX;
+  }
+  const hir::Instr* def = value->def;
+  switch (def->opcode->num) {
+    case OPCODE_ASSIGN:
+      return GuestAddressUpperBound(def->src1.value, depth + 1);
+    case OPCODE_ZERO_EXTEND: {
+      uint64_t type_bound;
+      switch (def->src1.value->type) {
+        case INT8_TYPE:
+          type_bound = UINT8_MAX;
+          break;
+        case INT16_TYPE:
+          type_bound = UINT16_MAX;
+          break;
+        case INT32_TYPE:
+          type_bound = UINT32_MAX;
+          break;
+        default:
+          return UINT64_MAX;
+      }
+      return std::min(type_bound,
+                      GuestAddressUpperBound(def->src1.value, depth + 1));
+    }
+    case OPCODE_AND:
+      // An unsigned AND result can't exceed either operand.
+      return std::min(GuestAddressUpperBound(def->src1.value, depth + 1),
+                      GuestAddressUpperBound(def->src2.value, depth + 1));
+    case OPCODE_ADD: {
+      uint64_t a = GuestAddressUpperBound(def->src1.value, depth + 1);
+      uint64_t b = GuestAddressUpperBound(def->src2.value, depth + 1);
+      if (a == UINT64_MAX || b == UINT64_MAX || a + b < a) {
+        return UINT64_MAX;
+      }
+      return a + b;
+    }
+    default:
+      return UINT64_MAX;
+  }
+}
+
 template <typename T>
 RegExp ComputeMemoryAddressOffset(X64Emitter& e, const T& guest,
                                   const T& offset) {
@@ -49,6 +120,15 @@ RegExp ComputeMemoryAddressOffset(X64Emitter& e, const T& guest,
       return e.GetMembaseReg() + e.rax;
     }
   } else {
+    uint64_t address_bound = GuestAddressUpperBound(guest.value);
+    if (address_bound <= UINT32_MAX &&
+        (xe::memory::allocation_granularity() <= 0x1000 ||
+         int64_t(address_bound) + offset_const < 0xE0000000)) {
+      // The address provably has clean upper bits and can't land in the
+      // physical alias needing the 4 KB offset (or the host mapping handles
+      // that); address through the guest register directly.
+      return e.GetMembaseReg() + guest.reg() + offset_const;
+    }
     if (xe::memory::allocation_granularity() > 0x1000) {
       // Emulate the 4 KB physical address offset in 0xE0000000+ when can't do
       // it via memory mapping.
@@ -86,6 +166,15 @@ RegExp ComputeMemoryAddress(X64Emitter& e, const T& guest) {
       return e.GetMembaseReg() + e.rax;
     }
   } else {
+    uint64_t address_bound = GuestAddressUpperBound(guest.value);
+    if (address_bound <= UINT32_MAX &&
+        (xe::memory::allocation_granularity() <= 0x1000 ||
+         address_bound < 0xE0000000)) {
+      // The address provably has clean upper bits and can't land in the
+      // physical alias needing the 4 KB offset (or the host mapping handles
+      // that); address through the guest register directly.
+      return e.GetMembaseReg() + guest.reg();
+    }
     if (xe::memory::allocation_granularity() > 0x1000) {
       // Emulate the 4 KB physical address offset in 0xE0000000+ when can't do
       // it via memory mapping.
@@ -549,16 +638,26 @@ EMITTER_OPCODE_TABLE(OPCODE_STORE_CONTEXT, STORE_CONTEXT_I8, STORE_CONTEXT_I16,
 // ============================================================================
 // OPCODE_LOAD_MMIO
 // ============================================================================
-// Note: all types are always aligned in the context.
+// MMIO accesses re-resolve their range through the global MMIOHandler on
+// every call instead of capturing callback_context at translation time. The
+// generated bytes may be persisted by the code cache and reused by a later
+// process, where the heap objects behind the callbacks live at different
+// addresses; only image-stable addresses may be baked in as immediates. The
+// lookup is noise next to the callback itself.
+static uint64_t LoadMMIO(void* raw_context, uint64_t address) {
+  auto mmio_range =
+      MMIOHandler::global_handler()->LookupRange(uint32_t(address));
+  assert_not_null(mmio_range);
+  return mmio_range->read(raw_context, mmio_range->callback_context,
+                          uint32_t(address));
+}
 struct LOAD_MMIO_I32
     : Sequence<LOAD_MMIO_I32, I<OPCODE_LOAD_MMIO, I32Op, OffsetOp, OffsetOp>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
     // uint64_t (context, addr)
-    auto mmio_range = reinterpret_cast<MMIORange*>(i.src1.value);
     auto read_address = uint32_t(i.src2.value);
-    e.mov(e.GetNativeParam(0), uint64_t(mmio_range->callback_context));
-    e.mov(e.GetNativeParam(1).cvt32(), read_address);
-    e.CallNativeSafe(reinterpret_cast<void*>(mmio_range->read));
+    e.mov(e.GetNativeParam(0).cvt32(), read_address);
+    e.CallNativeSafe(reinterpret_cast<void*>(LoadMMIO));
     e.bswap(e.eax);
     e.mov(i.dest, e.eax);
     if (IsTracingData()) {
@@ -573,23 +672,28 @@ EMITTER_OPCODE_TABLE(OPCODE_LOAD_MMIO, LOAD_MMIO_I32);
 // ============================================================================
 // OPCODE_STORE_MMIO
 // ============================================================================
-// Note: all types are always aligned on the stack.
+// See LoadMMIO above for why the range is resolved at execution time.
+static void StoreMMIO(void* raw_context, uint64_t address, uint64_t value) {
+  auto mmio_range =
+      MMIOHandler::global_handler()->LookupRange(uint32_t(address));
+  assert_not_null(mmio_range);
+  mmio_range->write(raw_context, mmio_range->callback_context,
+                    uint32_t(address), uint32_t(value));
+}
 struct STORE_MMIO_I32
     : Sequence<STORE_MMIO_I32,
                I<OPCODE_STORE_MMIO, VoidOp, OffsetOp, OffsetOp, I32Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
     // void (context, addr, value)
-    auto mmio_range = reinterpret_cast<MMIORange*>(i.src1.value);
     auto write_address = uint32_t(i.src2.value);
-    e.mov(e.GetNativeParam(0), uint64_t(mmio_range->callback_context));
-    e.mov(e.GetNativeParam(1).cvt32(), write_address);
+    e.mov(e.GetNativeParam(0).cvt32(), write_address);
     if (i.src3.is_constant) {
-      e.mov(e.GetNativeParam(2).cvt32(), xe::byte_swap(i.src3.constant()));
+      e.mov(e.GetNativeParam(1).cvt32(), xe::byte_swap(i.src3.constant()));
     } else {
-      e.mov(e.GetNativeParam(2).cvt32(), i.src3);
-      e.bswap(e.GetNativeParam(2).cvt32());
+      e.mov(e.GetNativeParam(1).cvt32(), i.src3);
+      e.bswap(e.GetNativeParam(1).cvt32());
     }
-    e.CallNativeSafe(reinterpret_cast<void*>(mmio_range->write));
+    e.CallNativeSafe(reinterpret_cast<void*>(StoreMMIO));
     if (IsTracingData()) {
       if (i.src3.is_constant) {
         e.mov(e.GetNativeParam(0).cvt32(), i.src3.constant());
@@ -1013,14 +1117,27 @@ struct STORE_V128
     : Sequence<STORE_V128, I<OPCODE_STORE, VoidOp, I64Op, V128Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
     auto addr = ComputeMemoryAddress(e, i.src1);
+    // Fused stores from MemorySequenceCombinationPass are only guaranteed
+    // 8-byte alignment, so they cannot use the alignment-checking form.
+    bool unaligned = (i.instr->flags & LoadStoreFlags::LOAD_STORE_UNALIGNED) != 0;
     if (i.instr->flags & LoadStoreFlags::LOAD_STORE_BYTE_SWAP) {
       assert_false(i.src2.is_constant);
       e.vpshufb(e.xmm0, i.src2, e.GetXmmConstPtr(XMMByteSwapMask));
-      e.vmovaps(e.ptr[addr], e.xmm0);
+      if (unaligned) {
+        e.vmovups(e.ptr[addr], e.xmm0);
+      } else {
+        e.vmovaps(e.ptr[addr], e.xmm0);
+      }
     } else {
       if (i.src2.is_constant) {
         e.LoadConstantXmm(e.xmm0, i.src2.constant());
-        e.vmovaps(e.ptr[addr], e.xmm0);
+        if (unaligned) {
+          e.vmovups(e.ptr[addr], e.xmm0);
+        } else {
+          e.vmovaps(e.ptr[addr], e.xmm0);
+        }
+      } else if (unaligned) {
+        e.vmovups(e.ptr[addr], i.src2);
       } else {
         e.vmovaps(e.ptr[addr], i.src2);
       }
@@ -1140,25 +1257,23 @@ struct MEMSET_I64_I8_I64
     assert_true(i.src2.constant() == 0);
     e.vpxor(e.xmm0, e.xmm0);
     auto addr = ComputeMemoryAddress(e, i.src1);
+    // These come from dcbz/dcbz128, so the address is always cache line
+    // aligned and full 256-bit stores are safe.
     switch (i.src3.constant()) {
       case 32:
-        e.vmovaps(e.ptr[addr + 0 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 1 * 16], e.xmm0);
+        e.vmovaps(e.ptr[addr + 0 * 32], e.ymm0);
         break;
       case 128:
-        e.vmovaps(e.ptr[addr + 0 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 1 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 2 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 3 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 4 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 5 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 6 * 16], e.xmm0);
-        e.vmovaps(e.ptr[addr + 7 * 16], e.xmm0);
+        e.vmovaps(e.ptr[addr + 0 * 32], e.ymm0);
+        e.vmovaps(e.ptr[addr + 1 * 32], e.ymm0);
+        e.vmovaps(e.ptr[addr + 2 * 32], e.ymm0);
+        e.vmovaps(e.ptr[addr + 3 * 32], e.ymm0);
         break;
       default:
         assert_unhandled_case(i.src3.constant());
         break;
     }
+    e.vzeroupper();
     if (IsTracingData()) {
       addr = ComputeMemoryAddress(e, i.src1);
       e.mov(e.GetNativeParam(2), i.src3.constant());
@@ -1666,6 +1666,32 @@ struct PERMUTE_V128
         e.vpcmpgtb(e.xmm0, e.xmm0, e.GetXmmConstPtr(XMMPermuteControl15));
         e.vpandn(i.dest, e.xmm0, i.dest);
       }
+    } else if (e.IsFeatureEnabled(kX64EmitAVX512VBMI)) {
+      // Single-instruction two-source byte permute. vpermi2b only reads the
+      // low five bits of each index byte, so the vpand with
+      // XMMPermuteByteMask is unnecessary here.
+      if (i.src1.is_constant) {
+        e.LoadConstantXmm(e.xmm2, i.src1.constant());
+        e.vxorps(e.xmm2, e.xmm2, e.GetXmmConstPtr(XMMSwapWordMask));
+      } else {
+        e.vxorps(e.xmm2, i.src1, e.GetXmmConstPtr(XMMSwapWordMask));
+      }
+      Xmm src2_reg = e.xmm0;
+      if (i.src2.value->IsConstantZero()) {
+        e.vpxor(src2_reg, src2_reg);
+      } else if (i.src2.is_constant) {
+        e.LoadConstantXmm(src2_reg, i.src2.constant());
+      } else {
+        src2_reg = i.src2;
+      }
+      Xmm src3_reg = e.xmm1;
+      if (i.src3.is_constant) {
+        e.LoadConstantXmm(src3_reg, i.src3.constant());
+      } else {
+        src3_reg = i.src3;
+      }
+      e.vpermi2b(e.xmm2, src2_reg, src3_reg);
+      e.vmovdqa(i.dest, e.xmm2);
     } else {
       // General permute.
       // Control mask needs to be shuffled.
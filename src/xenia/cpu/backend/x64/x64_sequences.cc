@@ -38,6 +38,8 @@
 #include "xenia/cpu/hir/hir_builder.h"
 #include "xenia/cpu/processor.h"
 
+DECLARE_bool(flush_denormals);
+
 namespace xe {
 namespace cpu {
 namespace backend {
@@ -3070,13 +3072,20 @@ EMITTER_OPCODE_TABLE(OPCODE_CNTLZ, CNTLZ_I8, CNTLZ_I16, CNTLZ_I32, CNTLZ_I64);
 static const uint32_t mxcsr_table[] = {
     0x1F80, 0x7F80, 0x5F80, 0x3F80, 0x9F80, 0xFF80, 0xDF80, 0xBF80,
 };
+// Same table with DAZ/FTZ forced in every mode, not just the non-IEEE ones,
+// for --flush_denormals.
+static const uint32_t mxcsr_table_flush_denormals[] = {
+    0x9FC0, 0xFFC0, 0xDFC0, 0xBFC0, 0x9FC0, 0xFFC0, 0xDFC0, 0xBFC0,
+};
 struct SET_ROUNDING_MODE_I32
     : Sequence<SET_ROUNDING_MODE_I32,
                I<OPCODE_SET_ROUNDING_MODE, VoidOp, I32Op>> {
   static void Emit(X64Emitter& e, const EmitArgType& i) {
     e.mov(e.rcx, i.src1);
     e.and_(e.rcx, 0x7);
-    e.mov(e.rax, uintptr_t(mxcsr_table));
+    e.mov(e.rax, uintptr_t(cvars::flush_denormals
+                               ? mxcsr_table_flush_denormals
+                               : mxcsr_table));
     e.vldmxcsr(e.ptr[e.rax + e.rcx * 4]);
   }
 };
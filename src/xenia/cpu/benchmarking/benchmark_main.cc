@@ -0,0 +1,370 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2019 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/main.h"
+#include "xenia/base/math.h"
+#include "xenia/base/memory.h"
+#include "xenia/base/platform.h"
+#include "xenia/base/vec128.h"
+#include "xenia/cpu/backend/x64/x64_backend.h"
+#include "xenia/cpu/cpu_flags.h"
+#include "xenia/cpu/ppc/ppc_context.h"
+#include "xenia/cpu/ppc/ppc_frontend.h"
+#include "xenia/cpu/processor.h"
+#include "xenia/cpu/raw_module.h"
+
+DEFINE_string(benchmark_output_path, "",
+              "File the JSON report is written to; stdout when empty.",
+              "Other");
+DEFINE_uint64(benchmark_iterations, 2000000,
+              "Initial loop iteration count per kernel; doubled until a run "
+              "lasts at least benchmark_min_runtime_ms.",
+              "Other");
+DEFINE_int32(benchmark_min_runtime_ms, 250,
+             "Minimum wall time of the measured run for each kernel.",
+             "Other");
+
+namespace xe {
+namespace cpu {
+namespace benchmark {
+
+using xe::cpu::ppc::PPCContext;
+
+const uint32_t START_ADDRESS = 0x80000000;
+// Each kernel is placed at its own 256 byte slot so translation time can be
+// attributed per kernel.
+const uint32_t kKernelStride = 0x100;
+// Scratch guest memory used by the streaming kernels.
+const uint32_t kScratchSource = 0x10001000;
+const uint32_t kScratchDest = 0x10003000;
+
+// A hand-assembled PPC loop. The first instruction is always mtctr r3, so
+// the host sets the iteration count in r3 before calling; every kernel ends
+// in blr.
+struct Kernel {
+  const char* name;
+  // Instruction words in PPC (big-endian) program order.
+  std::vector<uint32_t> code;
+  // Average instructions retired per loop iteration, used for MIPS.
+  double instructions_per_iteration;
+  // Optional per-run register/memory setup.
+  std::function<void(PPCContext*)> setup;
+};
+
+struct KernelResult {
+  const char* name;
+  uint64_t translation_us;
+  uint64_t iterations;
+  double elapsed_ms;
+  double mips;
+};
+
+std::vector<Kernel> BuildKernels() {
+  std::vector<Kernel> kernels;
+
+  // Dependency-free integer ALU chain: addi/xor pairs with the loop carried
+  // only through ctr.
+  kernels.push_back({"int_alu",
+                     {
+                         0x7C6903A6,  // mtctr r3
+                         0x38840001,  // addi r4, r4, 1
+                         0x7C852A78,  // xor r5, r4, r5
+                         0x4200FFF8,  // bdnz -8
+                         0x4E800020,  // blr
+                     },
+                     3.0,
+                     [](PPCContext* ctx) {
+                       ctx->r[4] = 0;
+                       ctx->r[5] = 0;
+                     }});
+
+  // Float-heavy DSP style body: a serial fmadd chain plus an independent
+  // multiply and accumulate.
+  kernels.push_back({"float_dsp",
+                     {
+                         0x7C6903A6,  // mtctr r3
+                         0xFC2118BA,  // fmadd f1, f1, f2, f3
+                         0xFCA501B2,  // fmul f5, f5, f6
+                         0xFC84082A,  // fadd f4, f4, f1
+                         0x4200FFF4,  // bdnz -12
+                         0x4E800020,  // blr
+                     },
+                     4.0,
+                     [](PPCContext* ctx) {
+                       // Multipliers sit just off 1.0 so values stay finite
+                       // over millions of iterations.
+                       ctx->f[1] = 1.0;
+                       ctx->f[2] = 1.0000001;
+                       ctx->f[3] = 0.0000001;
+                       ctx->f[4] = 0.0;
+                       ctx->f[5] = 1.0;
+                       ctx->f[6] = 0.9999999;
+                     }});
+
+  // Word-granular copy of a 1KB block per outer iteration, load/store
+  // addresses rematerialized each pass.
+  kernels.push_back({"memcpy_loop",
+                     {
+                         0x7C6903A6,  // mtctr r3
+                         0x3C801000,  // lis r4, 0x1000
+                         0x60841000,  // ori r4, r4, 0x1000
+                         0x3CA01000,  // lis r5, 0x1000
+                         0x60A53000,  // ori r5, r5, 0x3000
+                         0x38C00100,  // li r6, 256
+                         0x80E40000,  // lwz r7, 0(r4)
+                         0x90E50000,  // stw r7, 0(r5)
+                         0x38840004,  // addi r4, r4, 4
+                         0x38A50004,  // addi r5, r5, 4
+                         0x34C6FFFF,  // addic. r6, r6, -1
+                         0x4082FFEC,  // bne -20
+                         0x4200FFD4,  // bdnz -44
+                         0x4E800020,  // blr
+                     },
+                     5.0 + 256.0 * 6.0 + 1.0, nullptr});
+
+  // Data-dependent branch every iteration; the add is skipped on even
+  // counts so the branch flips direction each pass.
+  kernels.push_back({"branchy_dispatch",
+                     {
+                         0x7C6903A6,  // mtctr r3
+                         0x70860001,  // andi. r6, r4, 1
+                         0x41820008,  // beq +8
+                         0x38A50003,  // addi r5, r5, 3
+                         0x38840001,  // addi r4, r4, 1
+                         0x4200FFF0,  // bdnz -16
+                         0x4E800020,  // blr
+                     },
+                     4.5,
+                     [](PPCContext* ctx) {
+                       ctx->r[4] = 0;
+                       ctx->r[5] = 0;
+                     }});
+
+  // Altivec matrix-math style body: vmaddfp feeding a vector accumulate.
+  kernels.push_back({"vmx_madd",
+                     {
+                         0x7C6903A6,  // mtctr r3
+                         0x102118AE,  // vmaddfp v1, v1, v2, v3
+                         0x1084080A,  // vaddfp v4, v4, v1
+                         0x4200FFF8,  // bdnz -8
+                         0x4E800020,  // blr
+                     },
+                     3.0,
+                     [](PPCContext* ctx) {
+                       ctx->v[1] = vec128f(1.0f);
+                       ctx->v[2] = vec128f(1.0000001f);
+                       ctx->v[3] = vec128f(0.0000001f);
+                       ctx->v[4] = vec128f(0.0f);
+                     }});
+
+  return kernels;
+}
+
+class BenchmarkRunner {
+ public:
+  BenchmarkRunner() {
+    memory.reset(new Memory());
+    memory->Initialize();
+  }
+
+  ~BenchmarkRunner() {
+    thread_state.reset();
+    processor.reset();
+    memory.reset();
+  }
+
+  bool Setup(const std::vector<Kernel>& kernels) {
+    std::unique_ptr<xe::cpu::backend::Backend> backend;
+#if defined(XENIA_HAS_X64_BACKEND) && XENIA_HAS_X64_BACKEND
+    if (cvars::cpu == "x64" || cvars::cpu == "any") {
+      backend.reset(new xe::cpu::backend::x64::X64Backend());
+    }
+#endif  // XENIA_HAS_X64_BACKEND
+    if (!backend) {
+      XELOGE("No CPU backend available to benchmark");
+      return false;
+    }
+
+    processor.reset(new Processor(memory.get(), nullptr));
+    processor->Setup(std::move(backend));
+    processor->set_debug_info_flags(DebugInfoFlags::kDebugInfoNone);
+
+    // Back the code range with guest heap and copy the kernels in, each at
+    // its own slot.
+    const uint32_t code_size = 1024 * 1024;
+    if (!memory->LookupHeap(START_ADDRESS)
+             ->AllocFixed(START_ADDRESS, code_size, 0,
+                          kMemoryAllocationReserve | kMemoryAllocationCommit,
+                          kMemoryProtectRead | kMemoryProtectWrite)) {
+      XELOGE("Unable to allocate benchmark code range");
+      return false;
+    }
+    for (size_t i = 0; i < kernels.size(); ++i) {
+      uint32_t address = START_ADDRESS + uint32_t(i) * kKernelStride;
+      uint8_t* p = memory->TranslateVirtual(address);
+      for (uint32_t word : kernels[i].code) {
+        xe::store_and_swap<uint32_t>(p, word);
+        p += 4;
+      }
+    }
+
+    auto module = std::make_unique<xe::cpu::RawModule>(processor.get());
+    module->SetAddressRange(START_ADDRESS, code_size);
+    processor->AddModule(std::move(module));
+
+    processor->backend()->CommitExecutableRange(START_ADDRESS,
+                                                START_ADDRESS + code_size);
+
+    // Scratch space for the streaming kernels.
+    processor->memory()->LookupHeap(0)->AllocFixed(
+        0x10001000, 0xEFFF, 0,
+        kMemoryAllocationReserve | kMemoryAllocationCommit,
+        kMemoryProtectRead | kMemoryProtectWrite);
+    std::memset(memory->TranslateVirtual(kScratchSource), 0x3C, 1024);
+
+    // Simulate a thread.
+    uint32_t stack_size = 64 * 1024;
+    uint32_t stack_address = START_ADDRESS - stack_size;
+    uint32_t pcr_address = stack_address - 0x1000;
+    thread_state.reset(
+        new ThreadState(processor.get(), 0x100, stack_address, pcr_address));
+
+    return true;
+  }
+
+  bool Run(const Kernel& kernel, uint32_t address, KernelResult* out_result) {
+    // Time translation by resolving the function cold.
+    auto translate_start = std::chrono::steady_clock::now();
+    auto fn = processor->ResolveFunction(address);
+    auto translate_end = std::chrono::steady_clock::now();
+    if (!fn) {
+      XELOGE("Unable to resolve kernel %s", kernel.name);
+      return false;
+    }
+
+    // Warm the code and any lazy backend state before measuring.
+    CallKernel(kernel, fn, 1000);
+
+    // Grow the iteration count until the measured run is long enough to
+    // swamp call overhead and timer resolution.
+    uint64_t iterations = cvars::benchmark_iterations;
+    double elapsed_ms = 0.0;
+    while (true) {
+      auto run_start = std::chrono::steady_clock::now();
+      CallKernel(kernel, fn, iterations);
+      auto run_end = std::chrono::steady_clock::now();
+      elapsed_ms = std::chrono::duration<double, std::milli>(run_end -
+                                                             run_start)
+                       .count();
+      if (elapsed_ms >= cvars::benchmark_min_runtime_ms ||
+          iterations >= (1ull << 32)) {
+        break;
+      }
+      iterations *= 2;
+    }
+
+    out_result->name = kernel.name;
+    out_result->translation_us = uint64_t(
+        std::chrono::duration_cast<std::chrono::microseconds>(translate_end -
+                                                              translate_start)
+            .count());
+    out_result->iterations = iterations;
+    out_result->elapsed_ms = elapsed_ms;
+    double instructions =
+        double(iterations) * kernel.instructions_per_iteration;
+    out_result->mips = instructions / (elapsed_ms * 1000.0);
+    return true;
+  }
+
+  std::unique_ptr<Memory> memory;
+  std::unique_ptr<Processor> processor;
+  std::unique_ptr<ThreadState> thread_state;
+
+ private:
+  void CallKernel(const Kernel& kernel, Function* fn, uint64_t iterations) {
+    auto ctx = thread_state->context();
+    if (kernel.setup) {
+      kernel.setup(ctx);
+    }
+    ctx->r[3] = iterations;
+    ctx->lr = 0xBCBCBCBC;
+    fn->Call(thread_state.get(), uint32_t(ctx->lr));
+  }
+};
+
+void WriteReport(const std::vector<KernelResult>& results) {
+  FILE* file = stdout;
+  if (!cvars::benchmark_output_path.empty()) {
+    file = xe::filesystem::OpenFile(
+        xe::to_wstring(cvars::benchmark_output_path), "wb");
+    if (!file) {
+      XELOGE("Unable to open %s; writing to stdout",
+             cvars::benchmark_output_path.c_str());
+      file = stdout;
+    }
+  }
+
+  fprintf(file, "{\n  \"benchmarks\": [\n");
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto& result = results[i];
+    fprintf(file,
+            "    {\"name\": \"%s\", \"translation_us\": %" PRIu64
+            ", \"iterations\": %" PRIu64
+            ", \"elapsed_ms\": %.3f, \"mips\": %.1f}%s\n",
+            result.name, result.translation_us, result.iterations,
+            result.elapsed_ms, result.mips,
+            i + 1 < results.size() ? "," : "");
+  }
+  fprintf(file, "  ]\n}\n");
+
+  if (file != stdout) {
+    fclose(file);
+  }
+}
+
+int main(const std::vector<std::wstring>& args) {
+  auto kernels = BuildKernels();
+
+  BenchmarkRunner runner;
+  if (!runner.Setup(kernels)) {
+    return 1;
+  }
+
+  std::vector<KernelResult> results;
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    uint32_t address = START_ADDRESS + uint32_t(i) * kKernelStride;
+    KernelResult result;
+    if (!runner.Run(kernels[i], address, &result)) {
+      return 1;
+    }
+    XELOGI("%-16s translate %6" PRIu64 "us  %8.1f MIPS", result.name,
+           result.translation_us, result.mips);
+    results.push_back(result);
+  }
+
+  WriteReport(results);
+  return 0;
+}
+
+}  // namespace benchmark
+}  // namespace cpu
+}  // namespace xe
+
+DEFINE_ENTRY_POINT(L"xenia-cpu-benchmark", xe::cpu::benchmark::main, "");
@@ -0,0 +1,25 @@
+project_root = "../../../.."
+include(project_root.."/tools/build")
+
+group("benchmarks")
+project("xenia-cpu-benchmark")
+  uuid("8f1a4a29-6c93-4d52-8f6e-5c17b3f2a9d4")
+  kind("ConsoleApp")
+  language("C++")
+  links({
+    "xenia-core",
+    "xenia-cpu-backend-x64",
+    "xenia-cpu",
+    "xenia-base",
+    "capstone", -- cpu-backend-x64
+    "mspack",
+  })
+  files({
+    "benchmark_main.cc",
+    "../../base/main_"..platform_suffix..".cc",
+  })
+  filter("platforms:Windows")
+    debugdir(project_root)
+
+    -- xenia-base needs this
+    links({"xenia-ui"})
@@ -9,16 +9,35 @@
 
 #include "xenia/cpu/compiler/compiler.h"
 
+#include <chrono>
+#include <cinttypes>
+
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
 #include "xenia/base/profiling.h"
 #include "xenia/cpu/compiler/compiler_pass.h"
 
+DEFINE_bool(profile_compiler_passes, false,
+            "Record wall time spent in each compiler pass. Per-function "
+            "breakdowns go to the debug log and each translator logs an "
+            "aggregate report on shutdown.",
+            "CPU");
+
 namespace xe {
 namespace cpu {
 namespace compiler {
 
+namespace {
+// Total time spent running compiler passes, across all threads.
+StatCounter count_pass_time_us("cpu/compiler/pass_time_us");
+}  // namespace
+
 Compiler::Compiler(Processor* processor) : processor_(processor) {}
 
-Compiler::~Compiler() { Reset(); }
+Compiler::~Compiler() {
+  DumpPassTimings();
+  Reset();
+}
 
 void Compiler::AddPass(std::unique_ptr<CompilerPass> pass) {
   pass->Initialize(this);
@@ -30,17 +49,62 @@ void Compiler::Reset() {}
 bool Compiler::Compile(xe::cpu::hir::HIRBuilder* builder) {
   // TODO(benvanik): sophisticated stuff. Run passes in parallel, run until they
   //                 stop changing things, etc.
+  if (!cvars::profile_compiler_passes) {
+    for (size_t i = 0; i < passes_.size(); ++i) {
+      auto& pass = passes_[i];
+      scratch_arena_.Reset();
+      if (!pass->Run(builder)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if (pass_timings_.size() < passes_.size()) {
+    pass_timings_.resize(passes_.size());
+  }
+  uint64_t function_total_us = 0;
+  uint64_t slowest_us = 0;
+  size_t slowest_index = 0;
   for (size_t i = 0; i < passes_.size(); ++i) {
     auto& pass = passes_[i];
     scratch_arena_.Reset();
+    auto start = std::chrono::steady_clock::now();
     if (!pass->Run(builder)) {
       return false;
     }
+    uint64_t elapsed_us =
+        uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count());
+    pass_timings_[i].total_us += elapsed_us;
+    ++pass_timings_[i].run_count;
+    function_total_us += elapsed_us;
+    if (elapsed_us >= slowest_us) {
+      slowest_us = elapsed_us;
+      slowest_index = i;
+    }
   }
+  count_pass_time_us.Add(function_total_us);
+  XELOGD("Compiled function in %" PRIu64 "us; slowest pass %s (%" PRIu64
+         "us)",
+         function_total_us, passes_[slowest_index]->name(), slowest_us);
 
   return true;
 }
 
+void Compiler::DumpPassTimings() {
+  if (pass_timings_.empty()) {
+    return;
+  }
+  XELOGI("Compiler pass timing:");
+  for (size_t i = 0; i < passes_.size() && i < pass_timings_.size(); ++i) {
+    const auto& timing = pass_timings_[i];
+    XELOGI("  %2zu %-28s %10" PRIu64 "us over %" PRIu64 " runs", i,
+           passes_[i]->name(), timing.total_us, timing.run_count);
+  }
+}
+
 }  // namespace compiler
 }  // namespace cpu
 }  // namespace xe
@@ -42,11 +42,23 @@ class Compiler {
 
   bool Compile(hir::HIRBuilder* builder);
 
+  // Logs accumulated per-pass timing when profile_compiler_passes is set.
+  // Called automatically on destruction; totals are per Compiler instance
+  // (one per translator, so per thread).
+  void DumpPassTimings();
+
  private:
+  struct PassTiming {
+    uint64_t total_us = 0;
+    uint64_t run_count = 0;
+  };
+
   Processor* processor_;
   Arena scratch_arena_;
 
   std::vector<std::unique_ptr<CompilerPass>> passes_;
+  // Parallel to passes_; only populated when profile_compiler_passes is set.
+  std::vector<PassTiming> pass_timings_;
 };
 
 }  // namespace compiler
@@ -67,10 +67,20 @@ bool ContextPromotionPass::Run(HIRBuilder* builder) {
   // instead as it may be faster (at least on the block-level).
 
   // Promote loads to values.
-  // Process each block independently, for now.
+  // Blocks are processed in layout order, so when a block's only
+  // predecessor is the block immediately before it the value table already
+  // holds that predecessor's end-of-block state and promotion can continue
+  // across the boundary (an extended basic block). Merge points and loop
+  // headers still reload; real phi insertion would need backend support for
+  // it.
   auto block = builder->first_block();
   while (block) {
-    PromoteBlock(block);
+    bool carry_incoming_state = false;
+    auto in_edge = block->incoming_edge_head;
+    if (in_edge && !in_edge->incoming_next && in_edge->src == block->prev) {
+      carry_incoming_state = true;
+    }
+    PromoteBlock(block, carry_incoming_state);
     block = block->next;
   }
 
@@ -88,9 +98,12 @@ bool ContextPromotionPass::Run(HIRBuilder* builder) {
   return true;
 }
 
-void ContextPromotionPass::PromoteBlock(Block* block) {
+void ContextPromotionPass::PromoteBlock(Block* block,
+                                        bool carry_incoming_state) {
   auto& validity = context_validity_;
-  validity.reset();
+  if (!carry_incoming_state) {
+    validity.reset();
+  }
 
   Instr* i = block->instr_head;
   while (i) {
@@ -39,9 +39,10 @@ class ContextPromotionPass : public CompilerPass {
   bool Initialize(Compiler* compiler) override;
 
   bool Run(hir::HIRBuilder* builder) override;
+  const char* name() const override { return "ContextPromotion"; }
 
  private:
-  void PromoteBlock(hir::Block* block);
+  void PromoteBlock(hir::Block* block, bool carry_incoming_state);
   void RemoveDeadStoresBlock(hir::Block* block);
 
  private:
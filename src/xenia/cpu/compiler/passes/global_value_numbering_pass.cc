@@ -0,0 +1,193 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/global_value_numbering_pass.h"
+
+#include "xenia/base/profiling.h"
+#include "xenia/cpu/compiler/compiler.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::Block;
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+using xe::cpu::hir::Value;
+
+GlobalValueNumberingPass::GlobalValueNumberingPass() : CompilerPass() {}
+
+GlobalValueNumberingPass::~GlobalValueNumberingPass() {}
+
+uint64_t GlobalValueNumberingPass::CanonicalizeValue(Value* value) {
+  if (!value->IsConstant()) {
+    return reinterpret_cast<uint64_t>(value);
+  }
+  // Intern constants so that equal constants produced by different
+  // instructions compare equal in keys.
+  Key key = {};
+  key.opcode = UINT32_MAX;
+  key.type = uint16_t(value->type);
+  if (value->type == VEC128_TYPE) {
+    key.args[0] = value->constant.v128.low;
+    key.args[1] = value->constant.v128.high;
+  } else {
+    key.args[0] = value->constant.u64;
+  }
+  auto it = constant_map_.find(key);
+  if (it != constant_map_.end()) {
+    return reinterpret_cast<uint64_t>(it->second);
+  }
+  constant_map_.emplace(key, value);
+  return reinterpret_cast<uint64_t>(value);
+}
+
+bool GlobalValueNumberingPass::MakeKey(Instr* instr, Key* out_key) {
+  const OpcodeInfo* info = instr->opcode;
+  if (!instr->dest) {
+    return false;
+  }
+  if (info->flags &
+      (OPCODE_FLAG_VOLATILE | OPCODE_FLAG_MEMORY | OPCODE_FLAG_BRANCH |
+       OPCODE_FLAG_PAIRED_PREV)) {
+    return false;
+  }
+  switch (info->num) {
+    case OPCODE_ASSIGN:
+    case OPCODE_LOAD_CLOCK:
+    case OPCODE_LOAD_LOCAL:
+    case OPCODE_LOAD_CONTEXT:
+      // Context loads are handled separately; locals and the clock are
+      // never safe to renumber.
+      return false;
+    default:
+      break;
+  }
+
+  Key key = {};
+  key.opcode = uint32_t(info->num);
+  key.flags = instr->flags;
+  key.type = uint16_t(instr->dest->type);
+
+  uint32_t sig = info->signature;
+  const OpcodeSignatureType src_types[3] = {
+      GET_OPCODE_SIG_TYPE_SRC1(sig),
+      GET_OPCODE_SIG_TYPE_SRC2(sig),
+      GET_OPCODE_SIG_TYPE_SRC3(sig),
+  };
+  const Instr::Op* srcs[3] = {&instr->src1, &instr->src2, &instr->src3};
+  for (int i = 0; i < 3; ++i) {
+    switch (src_types[i]) {
+      case OPCODE_SIG_TYPE_X:
+        break;
+      case OPCODE_SIG_TYPE_V:
+        key.args[i] = CanonicalizeValue(srcs[i]->value);
+        break;
+      case OPCODE_SIG_TYPE_O:
+        key.args[i] = srcs[i]->offset;
+        break;
+      default:
+        // Labels/symbols (branches/calls) are never value numbered.
+        return false;
+    }
+  }
+  *out_key = key;
+  return true;
+}
+
+void GlobalValueNumberingPass::InvalidateContext(uint64_t offset,
+                                                 size_t size) {
+  for (auto it = context_map_.begin(); it != context_map_.end();) {
+    if (it->first < offset + size && offset < it->first + it->second.size) {
+      it = context_map_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+bool GlobalValueNumberingPass::Run(HIRBuilder* builder) {
+  SCOPE_profile_cpu_f("cpu");
+
+  for (auto block = builder->first_block(); block; block = block->next) {
+    // Tables survive from the previous block only when it's the sole
+    // predecessor, keeping numbering valid (its values dominate us).
+    bool inherits = block->prev && block->incoming_edge_head &&
+                    !block->incoming_edge_head->incoming_next &&
+                    block->incoming_edge_head->src == block->prev;
+    if (!inherits) {
+      pure_map_.clear();
+      context_map_.clear();
+    }
+
+    for (auto instr = block->instr_head; instr; instr = instr->next) {
+      auto opcode = instr->opcode->num;
+      if (opcode == OPCODE_LOAD_CONTEXT) {
+        uint64_t offset = instr->src1.offset;
+        auto it = context_map_.find(offset);
+        if (it != context_map_.end() &&
+            it->second.value->type == instr->dest->type) {
+          instr->Replace(&OPCODE_ASSIGN_info, 0);
+          instr->set_src1(it->second.value);
+        } else {
+          ContextValue entry = {GetTypeSize(instr->dest->type), instr->dest};
+          InvalidateContext(offset, entry.size);
+          context_map_[offset] = entry;
+        }
+        continue;
+      }
+      if (opcode == OPCODE_STORE_CONTEXT) {
+        InvalidateContext(instr->src1.offset,
+                          GetTypeSize(instr->src2.value->type));
+        continue;
+      }
+      switch (opcode) {
+        case OPCODE_CALL:
+        case OPCODE_CALL_TRUE:
+        case OPCODE_CALL_INDIRECT:
+        case OPCODE_CALL_INDIRECT_TRUE:
+        case OPCODE_CALL_EXTERN:
+        case OPCODE_CONTEXT_BARRIER:
+        case OPCODE_ATOMIC_EXCHANGE:
+        case OPCODE_ATOMIC_COMPARE_EXCHANGE:
+          // Anything that may write the context invalidates all loads.
+          context_map_.clear();
+          continue;
+        default:
+          break;
+      }
+
+      Key key;
+      if (!MakeKey(instr, &key)) {
+        continue;
+      }
+      auto it = pure_map_.find(key);
+      if (it != pure_map_.end()) {
+        instr->Replace(&OPCODE_ASSIGN_info, 0);
+        instr->set_src1(it->second);
+      } else {
+        pure_map_.emplace(key, instr->dest);
+      }
+    }
+  }
+
+  pure_map_.clear();
+  context_map_.clear();
+  constant_map_.clear();
+  return true;
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,84 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_COMPILER_PASSES_GLOBAL_VALUE_NUMBERING_PASS_H_
+#define XENIA_CPU_COMPILER_PASSES_GLOBAL_VALUE_NUMBERING_PASS_H_
+
+#include <unordered_map>
+
+#include "xenia/cpu/compiler/compiler_pass.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// Value-numbering CSE over extended basic blocks.
+// Pure instructions (and context loads, until clobbered) computing the same
+// operation over the same operands are replaced with assignments from the
+// first occurrence, removing the redundant lwz+byteswap/address chains the
+// 360 compiler is fond of. Tables carry across a block boundary when the
+// block is only reachable from the immediately preceding one, so fallthrough
+// chains are deduplicated as a unit.
+class GlobalValueNumberingPass : public CompilerPass {
+ public:
+  GlobalValueNumberingPass();
+  ~GlobalValueNumberingPass() override;
+
+  bool Run(hir::HIRBuilder* builder) override;
+  const char* name() const override { return "GlobalValueNumbering"; }
+
+ private:
+  struct Key {
+    uint32_t opcode;
+    uint16_t flags;
+    uint16_t type;
+    uint64_t args[3];
+
+    bool operator==(const Key& other) const {
+      return opcode == other.opcode && flags == other.flags &&
+             type == other.type && args[0] == other.args[0] &&
+             args[1] == other.args[1] && args[2] == other.args[2];
+    }
+  };
+  struct KeyHasher {
+    size_t operator()(const Key& key) const {
+      uint64_t h = key.opcode | (uint64_t(key.flags) << 32) |
+                   (uint64_t(key.type) << 48);
+      for (int i = 0; i < 3; ++i) {
+        h ^= key.args[i] + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+      }
+      return size_t(h);
+    }
+  };
+  struct ContextValue {
+    size_t size;
+    hir::Value* value;
+  };
+
+  // Returns the canonical Value* to use as a key argument, interning
+  // constants so equal constants compare equal.
+  uint64_t CanonicalizeValue(hir::Value* value);
+  // Builds a key for the instruction; returns false if the instruction is
+  // not eligible for value numbering.
+  bool MakeKey(hir::Instr* instr, Key* out_key);
+  // Removes context entries overlapping the given store.
+  void InvalidateContext(uint64_t offset, size_t size);
+
+  std::unordered_map<Key, hir::Value*, KeyHasher> pure_map_;
+  std::unordered_map<uint64_t, ContextValue> context_map_;
+  std::unordered_map<Key, hir::Value*, KeyHasher> constant_map_;
+};
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_COMPILER_PASSES_GLOBAL_VALUE_NUMBERING_PASS_H_
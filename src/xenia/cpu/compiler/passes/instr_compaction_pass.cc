@@ -0,0 +1,119 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2015 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/instr_compaction_pass.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "xenia/base/profiling.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+using xe::cpu::hir::Value;
+
+InstrCompactionPass::InstrCompactionPass() : CompilerPass() {}
+
+InstrCompactionPass::~InstrCompactionPass() {}
+
+bool InstrCompactionPass::Run(HIRBuilder* builder) {
+  // During construction Instr, Value and Use nodes interleave in the arena,
+  // so by the time the blocks are final the instruction list of a big
+  // function is scattered across cold memory and every later pass pays a
+  // cache miss per pointer chase. Relocate the instructions into sequential
+  // arena storage in program order: the list representation (and so every
+  // pass) is unchanged, but walking it becomes a mostly-linear scan. The old
+  // nodes stay behind as garbage until the arena resets after emission,
+  // which is the usual arena trade.
+  auto arena = builder->arena();
+
+  size_t instr_count = 0;
+  for (auto block = builder->first_block(); block; block = block->next) {
+    for (auto instr = block->instr_head; instr; instr = instr->next) {
+      ++instr_count;
+    }
+  }
+  if (!instr_count) {
+    return true;
+  }
+
+  // Copy in program order; consecutive Alloc calls pack tightly within each
+  // arena chunk.
+  std::unordered_map<Instr*, Instr*> relocated;
+  relocated.reserve(instr_count);
+  for (auto block = builder->first_block(); block; block = block->next) {
+    for (auto instr = block->instr_head; instr; instr = instr->next) {
+      auto copy = arena->Alloc<Instr>();
+      *copy = *instr;
+      relocated.emplace(instr, copy);
+    }
+  }
+  auto remap = [&relocated](Instr* instr) -> Instr* {
+    if (!instr) {
+      return nullptr;
+    }
+    auto it = relocated.find(instr);
+    return it != relocated.end() ? it->second : instr;
+  };
+
+  // Splice the copies into the block lists.
+  for (auto block = builder->first_block(); block; block = block->next) {
+    block->instr_head = remap(block->instr_head);
+    block->instr_tail = remap(block->instr_tail);
+    for (auto instr = block->instr_head; instr; instr = instr->next) {
+      instr->next = remap(instr->next);
+      instr->prev = remap(instr->prev);
+    }
+  }
+
+  // Point the value graph at the copies: defs, last uses and every use-list
+  // entry reference instructions by pointer. Each distinct value only needs
+  // fixing once however many operands mention it.
+  std::unordered_set<Value*> fixed_values;
+  auto fix_value = [&](Value* value) {
+    if (!value || !fixed_values.insert(value).second) {
+      return;
+    }
+    value->def = remap(value->def);
+    value->last_use = remap(value->last_use);
+    for (auto use = value->use_head; use; use = use->next) {
+      use->instr = remap(use->instr);
+    }
+  };
+  for (auto block = builder->first_block(); block; block = block->next) {
+    for (auto instr = block->instr_head; instr; instr = instr->next) {
+      fix_value(instr->dest);
+      uint32_t signature = instr->opcode->signature;
+      if (GET_OPCODE_SIG_TYPE_SRC1(signature) == OPCODE_SIG_TYPE_V) {
+        fix_value(instr->src1.value);
+      }
+      if (GET_OPCODE_SIG_TYPE_SRC2(signature) == OPCODE_SIG_TYPE_V) {
+        fix_value(instr->src2.value);
+      }
+      if (GET_OPCODE_SIG_TYPE_SRC3(signature) == OPCODE_SIG_TYPE_V) {
+        fix_value(instr->src3.value);
+      }
+    }
+  }
+
+  return true;
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,307 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/loop_invariant_code_motion_pass.h"
+
+#include <utility>
+
+#include "xenia/base/platform.h"
+#include "xenia/base/profiling.h"
+#include "xenia/cpu/compiler/compiler.h"
+
+#if XE_COMPILER_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#include <llvm/ADT/BitVector.h>
+#pragma warning(pop)
+#else
+#include <llvm/ADT/BitVector.h>
+#endif  // XE_COMPILER_MSVC
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::Block;
+using xe::cpu::hir::Edge;
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+using xe::cpu::hir::Value;
+
+namespace {
+
+// Per-loop context built once and shared by the hoisting loop.
+struct LoopInfo {
+  Block* header;
+  std::vector<Block*> blocks;
+  llvm::BitVector in_loop;
+  // Context byte ranges written somewhere in the loop.
+  std::vector<std::pair<uint64_t, size_t>> stored_context_ranges;
+  // True if a call/barrier/atomic may rewrite arbitrary context.
+  bool context_clobbered;
+};
+
+}  // namespace
+
+LoopInvariantCodeMotionPass::LoopInvariantCodeMotionPass() : CompilerPass() {}
+
+LoopInvariantCodeMotionPass::~LoopInvariantCodeMotionPass() {}
+
+bool LoopInvariantCodeMotionPass::IsSafeToHoist(Instr* instr) {
+  if (!instr->dest) {
+    return false;
+  }
+  const OpcodeInfo* info = instr->opcode;
+  if (info->flags &
+      (OPCODE_FLAG_VOLATILE | OPCODE_FLAG_MEMORY | OPCODE_FLAG_BRANCH |
+       OPCODE_FLAG_PAIRED_PREV)) {
+    return false;
+  }
+  switch (info->num) {
+    case OPCODE_LOAD_CLOCK:
+    case OPCODE_LOAD_LOCAL:
+      return false;
+    case OPCODE_DIV:
+      // May fault on a zero divisor; not safe to speculate on the entry
+      // path.
+      return false;
+    default:
+      break;
+  }
+  // Label/symbol operands never appear on eligible instructions, but guard
+  // anyway so a future opcode doesn't silently break this.
+  uint32_t sig = info->signature;
+  if (GET_OPCODE_SIG_TYPE_SRC1(sig) == OPCODE_SIG_TYPE_L ||
+      GET_OPCODE_SIG_TYPE_SRC1(sig) == OPCODE_SIG_TYPE_S ||
+      GET_OPCODE_SIG_TYPE_SRC2(sig) == OPCODE_SIG_TYPE_L ||
+      GET_OPCODE_SIG_TYPE_SRC2(sig) == OPCODE_SIG_TYPE_S ||
+      GET_OPCODE_SIG_TYPE_SRC3(sig) == OPCODE_SIG_TYPE_L ||
+      GET_OPCODE_SIG_TYPE_SRC3(sig) == OPCODE_SIG_TYPE_S) {
+    return false;
+  }
+  return true;
+}
+
+bool LoopInvariantCodeMotionPass::Run(HIRBuilder* builder) {
+  SCOPE_profile_cpu_f("cpu");
+
+  // Number the blocks for bitvector indexing.
+  std::vector<Block*> blocks;
+  for (auto block = builder->first_block(); block; block = block->next) {
+    block->ordinal = uint16_t(blocks.size());
+    blocks.push_back(block);
+  }
+  size_t block_count = blocks.size();
+  if (block_count < 2) {
+    return true;
+  }
+
+  // Iterative dominator computation; functions are small enough that the
+  // simple O(n^2) dataflow beats anything fancier here.
+  std::vector<llvm::BitVector> dom(block_count);
+  dom[0].resize(block_count);
+  dom[0].set(0);
+  for (size_t i = 1; i < block_count; ++i) {
+    dom[i].resize(block_count);
+    dom[i].set();
+  }
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (size_t i = 1; i < block_count; ++i) {
+      llvm::BitVector temp(block_count, true);
+      bool has_pred = false;
+      for (auto edge = blocks[i]->incoming_edge_head; edge;
+           edge = edge->incoming_next) {
+        temp &= dom[edge->src->ordinal];
+        has_pred = true;
+      }
+      if (!has_pred) {
+        temp.reset();
+      }
+      temp.set(i);
+      if (temp != dom[i]) {
+        dom[i] = temp;
+        changed = true;
+      }
+    }
+  }
+
+  // Find back edges, grouping latches by loop header.
+  std::vector<std::vector<Block*>> latches(block_count);
+  bool any_loops = false;
+  for (auto block : blocks) {
+    for (auto edge = block->outgoing_edge_head; edge;
+         edge = edge->outgoing_next) {
+      if (dom[block->ordinal].test(edge->dest->ordinal)) {
+        latches[edge->dest->ordinal].push_back(block);
+        any_loops = true;
+      }
+    }
+  }
+  if (!any_loops) {
+    return true;
+  }
+
+  for (size_t h = 0; h < block_count; ++h) {
+    if (latches[h].empty()) {
+      continue;
+    }
+    // Gather the natural loop body: everything that reaches a latch without
+    // passing through the header.
+    LoopInfo loop;
+    loop.header = blocks[h];
+    loop.in_loop.resize(block_count);
+    loop.in_loop.set(h);
+    std::vector<Block*> worklist = latches[h];
+    while (!worklist.empty()) {
+      Block* block = worklist.back();
+      worklist.pop_back();
+      if (loop.in_loop.test(block->ordinal)) {
+        continue;
+      }
+      loop.in_loop.set(block->ordinal);
+      for (auto edge = block->incoming_edge_head; edge;
+           edge = edge->incoming_next) {
+        worklist.push_back(edge->src);
+      }
+    }
+    for (auto block : blocks) {
+      if (loop.in_loop.test(block->ordinal)) {
+        loop.blocks.push_back(block);
+      }
+    }
+
+    // Scan for anything that invalidates hoisting context loads.
+    loop.context_clobbered = false;
+    for (auto block : loop.blocks) {
+      for (auto instr = block->instr_head; instr; instr = instr->next) {
+        switch (instr->opcode->num) {
+          case OPCODE_STORE_CONTEXT:
+            loop.stored_context_ranges.emplace_back(
+                instr->src1.offset, GetTypeSize(instr->src2.value->type));
+            break;
+          case OPCODE_CALL:
+          case OPCODE_CALL_TRUE:
+          case OPCODE_CALL_INDIRECT:
+          case OPCODE_CALL_INDIRECT_TRUE:
+          case OPCODE_CALL_EXTERN:
+          case OPCODE_CONTEXT_BARRIER:
+          case OPCODE_ATOMIC_EXCHANGE:
+          case OPCODE_ATOMIC_COMPARE_EXCHANGE:
+            loop.context_clobbered = true;
+            break;
+          default:
+            break;
+        }
+      }
+    }
+
+    // The loop must have exactly one entry edge from outside; its source
+    // block doubles as the preheader we hoist into.
+    Block* preheader = nullptr;
+    bool multiple_entries = false;
+    for (auto edge = loop.header->incoming_edge_head; edge;
+         edge = edge->incoming_next) {
+      if (loop.in_loop.test(edge->src->ordinal)) {
+        continue;
+      }
+      if (preheader) {
+        multiple_entries = true;
+        break;
+      }
+      preheader = edge->src;
+    }
+    if (!preheader || multiple_entries) {
+      continue;
+    }
+    // Insert before the preheader's terminator run (mirrors the walk in
+    // ControlFlowAnalysisPass). A block without a branch tail falls through
+    // somewhere odd; don't touch it.
+    Instr* insert_point = nullptr;
+    for (auto instr = preheader->instr_tail;
+         instr && (instr->opcode->flags & OPCODE_FLAG_BRANCH);
+         instr = instr->prev) {
+      insert_point = instr;
+    }
+    if (!insert_point) {
+      continue;
+    }
+
+    // Hoist to a fixpoint so chains of invariant computation all move.
+    bool moved = true;
+    while (moved) {
+      moved = false;
+      for (auto block : loop.blocks) {
+        Instr* instr = block->instr_head;
+        while (instr) {
+          Instr* next_instr = instr->next;
+          if (IsSafeToHoist(instr)) {
+            bool invariant = true;
+            if (instr->opcode->num == OPCODE_LOAD_CONTEXT) {
+              if (loop.context_clobbered) {
+                invariant = false;
+              } else {
+                uint64_t offset = instr->src1.offset;
+                size_t size = GetTypeSize(instr->dest->type);
+                for (auto& range : loop.stored_context_ranges) {
+                  if (offset < range.first + range.second &&
+                      range.first < offset + size) {
+                    invariant = false;
+                    break;
+                  }
+                }
+              }
+            } else {
+              uint32_t sig = instr->opcode->signature;
+              const OpcodeSignatureType src_types[3] = {
+                  GET_OPCODE_SIG_TYPE_SRC1(sig),
+                  GET_OPCODE_SIG_TYPE_SRC2(sig),
+                  GET_OPCODE_SIG_TYPE_SRC3(sig),
+              };
+              const Instr::Op* srcs[3] = {&instr->src1, &instr->src2,
+                                          &instr->src3};
+              for (int j = 0; j < 3; ++j) {
+                if (src_types[j] != OPCODE_SIG_TYPE_V) {
+                  continue;
+                }
+                Value* value = srcs[j]->value;
+                if (value->IsConstant()) {
+                  continue;
+                }
+                if (!value->def ||
+                    loop.in_loop.test(value->def->block->ordinal)) {
+                  invariant = false;
+                  break;
+                }
+              }
+            }
+            if (invariant) {
+              instr->MoveBefore(insert_point);
+              moved = true;
+            }
+          }
+          instr = next_instr;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
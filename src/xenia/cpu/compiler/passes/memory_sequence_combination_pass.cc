@@ -23,6 +23,37 @@ using xe::cpu::hir::HIRBuilder;
 using xe::cpu::hir::Instr;
 using xe::cpu::hir::Value;
 
+namespace {
+
+// Strips assignments and splits an address into a base value plus constant
+// displacement, matching the ADD base, <const> chains PPC D-form memory ops
+// produce. Addresses with no constant term decompose to (address, 0).
+void DecomposeAddress(Value* address, Value** out_base, uint64_t* out_offset) {
+  auto def = address->def;
+  while (def && def->opcode == &OPCODE_ASSIGN_info) {
+    def = def->src1.value->def;
+  }
+  if (def && def->opcode == &OPCODE_ADD_info &&
+      def->src2.value->IsConstant()) {
+    *out_base = def->src1.value;
+    *out_offset = def->src2.value->constant.u64;
+    return;
+  }
+  *out_base = address;
+  *out_offset = 0;
+}
+
+// Strips assignments from a value to find its real defining instruction.
+Instr* TraceDef(Value* value) {
+  auto def = value->def;
+  while (def && def->opcode == &OPCODE_ASSIGN_info) {
+    def = def->src1.value->def;
+  }
+  return def;
+}
+
+}  // namespace
+
 MemorySequenceCombinationPass::MemorySequenceCombinationPass()
     : CompilerPass() {}
 
@@ -41,6 +72,7 @@ bool MemorySequenceCombinationPass::Run(HIRBuilder* builder) {
       } else if (i->opcode == &OPCODE_STORE_info ||
                  i->opcode == &OPCODE_STORE_OFFSET_info) {
         CombineStoreSequence(i);
+        CombinePairedStoreSequence(builder, i);
       }
       i = i->next;
     }
@@ -150,6 +182,142 @@ void MemorySequenceCombinationPass::CombineStoreSequence(Instr* i) {
   // TODO(benvanik): extend/truncate.
 }
 
+void MemorySequenceCombinationPass::CombinePairedStoreSequence(HIRBuilder* builder,
+                                                               Instr* i) {
+  // Paired 64-bit swapped copy:
+  //   v1.i64 = load v10, [swap]
+  //   v2.i64 = load v11, [swap]     (v11 == v10 + 8)
+  //   store v20, v1.i64, [swap]
+  //   store v21, v2.i64, [swap]     (v21 == v20 + 8)
+  // becomes:
+  //   v3.v128 = load v10, [unaligned]
+  //   store v20, v3.v128, [unaligned]
+  // The paired swaps cancel, leaving a single raw 16-byte copy. This is the
+  // inner loop of memcpy-style routines streaming vertex/texture data, where
+  // the scalar form is 4x slower. The dead scalar loads are left for DCE.
+  //
+  // Called with the second store after CombineStoreSequence has run over
+  // both stores and both loads, so swaps (if any) are already folded into
+  // the flags.
+  if (i->opcode != &OPCODE_STORE_info) {
+    return;
+  }
+  if (i->flags != LOAD_STORE_BYTE_SWAP && i->flags != 0) {
+    return;
+  }
+  if (i->src2.value->type != INT64_TYPE || i->src2.value->IsConstant()) {
+    return;
+  }
+
+  // Find the preceding store. Nothing that touches memory (or could observe
+  // or reorder against it) may sit between the pair.
+  Instr* store_lo = nullptr;
+  auto instr = i->prev;
+  for (int n = 0; instr && n < 16; ++n, instr = instr->prev) {
+    if (instr->opcode->flags &
+        (OPCODE_FLAG_MEMORY | OPCODE_FLAG_VOLATILE | OPCODE_FLAG_BRANCH)) {
+      store_lo = instr;
+      break;
+    }
+  }
+  if (!store_lo || store_lo->opcode != &OPCODE_STORE_info ||
+      store_lo->flags != i->flags) {
+    return;
+  }
+  if (store_lo->src2.value->type != INT64_TYPE ||
+      store_lo->src2.value->IsConstant()) {
+    return;
+  }
+
+  // Stores must hit adjacent addresses off the same base.
+  Value* store_base_lo;
+  Value* store_base_hi;
+  uint64_t store_offset_lo;
+  uint64_t store_offset_hi;
+  DecomposeAddress(store_lo->src1.value, &store_base_lo, &store_offset_lo);
+  DecomposeAddress(i->src1.value, &store_base_hi, &store_offset_hi);
+  if (store_base_lo != store_base_hi ||
+      store_offset_hi != store_offset_lo + 8) {
+    return;
+  }
+
+  // Both values must come straight from same-swap loads of adjacent
+  // addresses, pairing low with low and high with high.
+  auto load_lo = TraceDef(store_lo->src2.value);
+  auto load_hi = TraceDef(i->src2.value);
+  if (!load_lo || !load_hi || load_lo == load_hi) {
+    return;
+  }
+  if (load_lo->opcode != &OPCODE_LOAD_info ||
+      load_hi->opcode != &OPCODE_LOAD_info) {
+    return;
+  }
+  if (load_lo->flags != i->flags || load_hi->flags != i->flags) {
+    return;
+  }
+  if (load_lo->block != i->block || load_hi->block != i->block) {
+    return;
+  }
+  Value* load_base_lo;
+  Value* load_base_hi;
+  uint64_t load_offset_lo;
+  uint64_t load_offset_hi;
+  DecomposeAddress(load_lo->src1.value, &load_base_lo, &load_offset_lo);
+  DecomposeAddress(load_hi->src1.value, &load_base_hi, &load_offset_hi);
+  if (load_base_lo != load_base_hi ||
+      load_offset_hi != load_offset_lo + 8) {
+    return;
+  }
+
+  // Both loads must precede the first store with nothing else touching
+  // memory in between, so widening the load at the store keeps the original
+  // read-everything-then-write-everything order.
+  int loads_found = 0;
+  instr = store_lo->prev;
+  for (int n = 0; instr && n < 16 && loads_found < 2;
+       ++n, instr = instr->prev) {
+    if (instr == load_lo || instr == load_hi) {
+      ++loads_found;
+      continue;
+    }
+    if (instr->opcode->flags &
+        (OPCODE_FLAG_MEMORY | OPCODE_FLAG_VOLATILE | OPCODE_FLAG_BRANCH)) {
+      return;
+    }
+  }
+  if (loads_found != 2) {
+    return;
+  }
+
+  // Synthesize the wide load just before the first store. The 128-bit
+  // access is only guaranteed 8-byte alignment, so flag it for the backend.
+  Value* vec = builder->AllocValue(VEC128_TYPE);
+  auto load = store_lo->block->arena->Alloc<Instr>();
+  load->block = store_lo->block;
+  load->opcode = &OPCODE_LOAD_info;
+  load->flags = LOAD_STORE_UNALIGNED;
+  load->dest = vec;
+  vec->def = load;
+  load->src1.value = load->src2.value = load->src3.value = nullptr;
+  load->src1_use = load->src2_use = load->src3_use = nullptr;
+  load->ordinal = UINT32_MAX;
+  load->prev = store_lo->prev;
+  load->next = store_lo;
+  if (store_lo->prev) {
+    store_lo->prev->next = load;
+  } else {
+    store_lo->block->instr_head = load;
+  }
+  store_lo->prev = load;
+  load->set_src1(load_lo->src1.value);
+
+  // The first store becomes the wide store; the second one dies here. The
+  // now-unused scalar loads and swap chains are swept up by DCE.
+  store_lo->flags = LOAD_STORE_UNALIGNED;
+  store_lo->set_src2(vec);
+  i->Remove();
+}
+
 }  // namespace passes
 }  // namespace compiler
 }  // namespace cpu
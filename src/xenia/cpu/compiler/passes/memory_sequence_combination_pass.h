@@ -23,11 +23,13 @@ class MemorySequenceCombinationPass : public CompilerPass {
   ~MemorySequenceCombinationPass() override;
 
   bool Run(hir::HIRBuilder* builder) override;
+  const char* name() const override { return "MemorySequenceCombination"; }
 
  private:
   void CombineMemorySequences(hir::HIRBuilder* builder);
   void CombineLoadSequence(hir::Instr* i);
   void CombineStoreSequence(hir::Instr* i);
+  void CombinePairedStoreSequence(hir::HIRBuilder* builder, hir::Instr* i);
 };
 
 }  // namespace passes
@@ -0,0 +1,232 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2026 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/compiler/passes/permute_combination_pass.h"
+
+#include "xenia/base/profiling.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+// TODO(benvanik): remove when enums redefined.
+using namespace xe::cpu::hir;
+
+using xe::cpu::hir::HIRBuilder;
+using xe::cpu::hir::Instr;
+using xe::cpu::hir::Value;
+
+namespace {
+
+// A byte-granular description of a constant shuffle: result guest byte d is
+// guest byte (selector[d] & 0xF) of src_a when selector[d] < 16, of src_b
+// otherwise. src_b is null for single-source shuffles (swizzles).
+// All indices are in guest element order, independent of how vec128_t lays
+// bytes out in host memory.
+struct ShuffleDesc {
+  uint8_t selector[16];
+  Value* src_a;
+  Value* src_b;
+};
+
+// Strips assignments from a value to find its real defining instruction.
+Instr* TraceDef(Value* value) {
+  auto def = value->def;
+  while (def && def->opcode == &OPCODE_ASSIGN_info) {
+    def = def->src1.value->def;
+  }
+  return def;
+}
+
+// vec128_t stores 32-bit words in guest order but swaps the bytes within
+// each word, so guest byte i lives at u8[i ^ 0x3].
+uint8_t GuestByte(const vec128_t& v, size_t i) { return v.u8[i ^ 0x3]; }
+void SetGuestByte(vec128_t* v, size_t i, uint8_t value) {
+  v->u8[i ^ 0x3] = value;
+}
+
+// Normalizes a constant-control PERMUTE or SWIZZLE into a byte selector.
+// Returns false for runtime controls and part types this doesn't model.
+bool ExtractShuffle(Instr* i, ShuffleDesc* out) {
+  if (i->opcode == &OPCODE_PERMUTE_info) {
+    auto control = i->src1.value;
+    if (!control->IsConstant()) {
+      return false;
+    }
+    switch (i->flags) {
+      case INT8_TYPE: {
+        const vec128_t& c = control->constant.v128;
+        for (size_t d = 0; d < 16; ++d) {
+          out->selector[d] = GuestByte(c, d) & 0x1F;
+        }
+        break;
+      }
+      case INT16_TYPE: {
+        const vec128_t& c = control->constant.v128;
+        for (size_t h = 0; h < 8; ++h) {
+          uint8_t s = uint8_t(c.u16[h ^ 0x1] & 0xF);
+          out->selector[h * 2 + 0] = s * 2 + 0;
+          out->selector[h * 2 + 1] = s * 2 + 1;
+        }
+        break;
+      }
+      case INT32_TYPE: {
+        // Word permutes take a packed immediate control (see PERMUTE_MASK),
+        // not a vec128 - anything else here is malformed.
+        if (control->type != INT32_TYPE) {
+          return false;
+        }
+        uint32_t c = control->constant.u32;
+        for (size_t d = 0; d < 4; ++d) {
+          uint8_t w = (c >> (d * 8)) & 0x3;
+          if ((c >> (d * 8 + 2)) & 0x1) {
+            w += 4;
+          }
+          for (size_t j = 0; j < 4; ++j) {
+            out->selector[d * 4 + j] = uint8_t(w * 4 + j);
+          }
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+    out->src_a = i->src2.value;
+    out->src_b = i->src3.value;
+    return true;
+  } else if (i->opcode == &OPCODE_SWIZZLE_info) {
+    if (i->flags != INT32_TYPE && i->flags != FLOAT32_TYPE) {
+      return false;
+    }
+    uint32_t mask = uint32_t(i->src2.offset);
+    for (size_t d = 0; d < 4; ++d) {
+      uint8_t w = (mask >> (d * 2)) & 0x3;
+      for (size_t j = 0; j < 4; ++j) {
+        out->selector[d * 4 + j] = uint8_t(w * 4 + j);
+      }
+    }
+    out->src_a = i->src1.value;
+    out->src_b = nullptr;
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+PermuteCombinationPass::PermuteCombinationPass() : CompilerPass() {}
+
+PermuteCombinationPass::~PermuteCombinationPass() = default;
+
+bool PermuteCombinationPass::Run(HIRBuilder* builder) {
+  // vperm/vsldoi/vmrg*/vpermwi128 chains show up stacked 3-5 deep in
+  // skinning and audio loops. Each constant-control shuffle reading another
+  // constant-control shuffle can instead read the inner shuffle's sources
+  // through a composed control, leaving the inner op for DCE if it has no
+  // other uses. Defs precede uses, so one forward walk composes whole chains:
+  // each combined instruction is itself a constant byte permute that its
+  // users then see.
+  auto block = builder->first_block();
+  while (block) {
+    auto i = block->instr_head;
+    while (i) {
+      if (i->opcode == &OPCODE_PERMUTE_info ||
+          i->opcode == &OPCODE_SWIZZLE_info) {
+        CombineShuffleSequence(builder, i);
+      }
+      i = i->next;
+    }
+    block = block->next;
+  }
+  return true;
+}
+
+bool PermuteCombinationPass::CombineShuffleSequence(HIRBuilder* builder,
+                                                    Instr* i) {
+  if (i->dest->type != VEC128_TYPE) {
+    return false;
+  }
+  ShuffleDesc outer;
+  if (!ExtractShuffle(i, &outer)) {
+    return false;
+  }
+  ShuffleDesc inner_a;
+  ShuffleDesc inner_b;
+  auto def_a = TraceDef(outer.src_a);
+  auto def_b = outer.src_b ? TraceDef(outer.src_b) : nullptr;
+  bool has_a = def_a && ExtractShuffle(def_a, &inner_a);
+  bool has_b = def_b && ExtractShuffle(def_b, &inner_b);
+  if (!has_a && !has_b) {
+    // Nothing to compose with; leave word shuffles on their cheap
+    // vpshufd/vshufps paths.
+    return false;
+  }
+
+  // Compose, tracking the distinct leaf sources referenced. More than two
+  // can't be expressed as a single PERMUTE.
+  Value* leaves[2] = {nullptr, nullptr};
+  size_t leaf_count = 0;
+  auto leaf_slot = [&](Value* leaf) -> int {
+    for (size_t j = 0; j < leaf_count; ++j) {
+      if (leaves[j] == leaf) {
+        return int(j);
+      }
+    }
+    if (leaf_count == 2) {
+      return -1;
+    }
+    leaves[leaf_count] = leaf;
+    return int(leaf_count++);
+  };
+  uint8_t combined[16];
+  for (size_t d = 0; d < 16; ++d) {
+    uint8_t s = outer.selector[d];
+    const ShuffleDesc* inner = nullptr;
+    Value* leaf = nullptr;
+    uint8_t byte;
+    if (s < 16) {
+      inner = has_a ? &inner_a : nullptr;
+      leaf = outer.src_a;
+    } else {
+      s -= 16;
+      inner = has_b ? &inner_b : nullptr;
+      leaf = outer.src_b;
+    }
+    if (inner) {
+      uint8_t t = inner->selector[s];
+      leaf = t < 16 ? inner->src_a : inner->src_b;
+      byte = t & 0xF;
+    } else {
+      byte = s;
+    }
+    int slot = leaf_slot(leaf);
+    if (slot < 0) {
+      return false;
+    }
+    combined[d] = uint8_t(slot * 16 + byte);
+  }
+
+  vec128_t control = vec128b(0);
+  for (size_t d = 0; d < 16; ++d) {
+    SetGuestByte(&control, d, combined[d]);
+  }
+  auto control_value = builder->AllocValue(VEC128_TYPE);
+  control_value->set_constant(control);
+  i->Replace(&OPCODE_PERMUTE_info, INT8_TYPE);
+  i->set_src1(control_value);
+  i->set_src2(leaves[0]);
+  i->set_src3(leaf_count > 1 ? leaves[1] : leaves[0]);
+  return true;
+}
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
@@ -0,0 +1,37 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2026 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_COMPILER_PASSES_PERMUTE_COMBINATION_PASS_H_
+#define XENIA_CPU_COMPILER_PASSES_PERMUTE_COMBINATION_PASS_H_
+
+#include "xenia/cpu/compiler/compiler_pass.h"
+
+namespace xe {
+namespace cpu {
+namespace compiler {
+namespace passes {
+
+class PermuteCombinationPass : public CompilerPass {
+ public:
+  PermuteCombinationPass();
+  ~PermuteCombinationPass() override;
+
+  bool Run(hir::HIRBuilder* builder) override;
+  const char* name() const override { return "PermuteCombination"; }
+
+ private:
+  bool CombineShuffleSequence(hir::HIRBuilder* builder, hir::Instr* i);
+};
+
+}  // namespace passes
+}  // namespace compiler
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_COMPILER_PASSES_PERMUTE_COMBINATION_PASS_H_
@@ -72,10 +72,13 @@ RegisterAllocationPass::~RegisterAllocationPass() {
 
 bool RegisterAllocationPass::Run(HIRBuilder* builder) {
   // Simple per-block allocator that operates on SSA form.
-  // Registers do not move across blocks, though this could be
-  // optimized with some intra-block analysis (dominators/etc).
-  // Really, it'd just be nice to have someone who knew what they
-  // were doing lower SSA and do this right.
+  // Values whose use lists extend past the current block (created by
+  // context promotion, GVN, and LICM) keep their register across the
+  // boundary: PrepareBlockState carries their tracking entries forward
+  // instead of resetting them, so later blocks cannot hand the register
+  // to someone else while the value is still live.
+
+  ResetState();
 
   uint16_t block_ordinal = 0;
   uint32_t instr_ordinal = 0;
@@ -116,9 +119,10 @@ bool RegisterAllocationPass::Run(HIRBuilder* builder) {
           !instr->src1.value->IsConstant()) {
         if (!instr->src1_use->next) {
           // Pull off preferred register. We will try to reuse this for the
-          // dest.
+          // dest, which helps the two-operand x64 forms where dest==src1
+          // saves a mov.
           // NOTE: set may be null if this is a store local.
-          if (preferred_reg.set) {
+          if (instr->src1.value->reg.set) {
             has_preferred_reg = true;
             preferred_reg = instr->src1.value->reg;
           }
@@ -195,7 +199,7 @@ void RegisterAllocationPass::DumpUsage(const char* name) {
 #endif
 }
 
-void RegisterAllocationPass::PrepareBlockState() {
+void RegisterAllocationPass::ResetState() {
   for (size_t i = 0; i < xe::countof(usage_sets_.all_sets); ++i) {
     auto usage_set = usage_sets_.all_sets[i];
     if (usage_set) {
@@ -203,6 +207,27 @@ void RegisterAllocationPass::PrepareBlockState() {
       usage_set->upcoming_uses.clear();
     }
   }
+}
+
+void RegisterAllocationPass::PrepareBlockState() {
+  for (size_t i = 0; i < xe::countof(usage_sets_.all_sets); ++i) {
+    auto usage_set = usage_sets_.all_sets[i];
+    if (!usage_set) {
+      continue;
+    }
+    // Values with pending uses in later blocks stay resident in their
+    // register across the boundary; everything else frees up.
+    usage_set->availability.set();
+    auto& upcoming_uses = usage_set->upcoming_uses;
+    for (size_t j = 0; j < upcoming_uses.size();) {
+      if (upcoming_uses[j].use) {
+        usage_set->availability.set(upcoming_uses[j].value->reg.index, false);
+        ++j;
+      } else {
+        upcoming_uses.erase(upcoming_uses.begin() + j);
+      }
+    }
+  }
   DumpUsage("PrepareBlockState");
 }
 
@@ -245,10 +270,10 @@ void RegisterAllocationPass::AdvanceUses(Instr* instr) {
           next_use = next_use->next;
         }
         // Remove the iterator.
+        // NOTE: the next use (and the def) may live in a later block; the
+        // entry is carried across boundaries by PrepareBlockState.
         auto value = upcoming_use.value;
         upcoming_uses.erase(upcoming_uses.begin() + j);
-        assert_true(next_use->instr->block == instr->block);
-        assert_true(value->def->block == instr->block);
         upcoming_uses.emplace_back(value, next_use);
         // i remains the same.
         continue;
@@ -315,15 +340,31 @@ bool RegisterAllocationPass::TryAllocateRegister(Value* value) {
   // Get the set this register is in.
   RegisterSetUsage* usage_set = RegisterSetForValue(value);
 
-  // Find the first free register, if any.
-  // We have to ensure it's a valid one (in our count).
-  uint32_t first_unused = 0;
-  bool none_used = xe::bit_scan_forward(
-      static_cast<uint32_t>(usage_set->availability.to_ulong()), &first_unused);
-  if (none_used && first_unused < usage_set->count) {
+  // Values that stay live for a long stretch of the block get registers from
+  // the top of the set and short-lived scratch values from the bottom. That
+  // keeps loop-carried-style values out of the registers that churn the most
+  // (and on x64 the high gpr indices map to callee-saved registers).
+  // The use list is sorted before allocation, so last_use is accurate.
+  uint32_t live_span = 0;
+  if (value->use_head && value->last_use && value->def) {
+    live_span = value->last_use->ordinal - value->def->ordinal;
+  }
+  const uint32_t kLongLivedSpan = 10;
+  bool prefer_high = live_span >= kLongLivedSpan;
+
+  uint32_t avail =
+      static_cast<uint32_t>(usage_set->availability.to_ulong()) &
+      ((1u << usage_set->count) - 1);
+  if (avail) {
+    uint32_t index = 0;
+    if (prefer_high) {
+      xe::bit_scan_reverse(avail, &index);
+    } else {
+      xe::bit_scan_forward(avail, &index);
+    }
     // Available! Use it!
     value->reg.set = usage_set->set;
-    value->reg.index = first_unused;
+    value->reg.index = index;
     MarkRegUsed(value->reg, value, value->use_head);
     return true;
   }
@@ -345,13 +386,20 @@ bool RegisterAllocationPass::SpillOneRegister(HIRBuilder* builder, Block* block,
   }
 
   DumpUsage("SpillOneRegister (pre)");
-  // Pick the one with the furthest next use.
+  // Pick the one with the furthest next use. When candidates tie, prefer one
+  // that already has a spill slot: since values are SSA the slot still holds
+  // the right bits and re-spilling it needs no store.
   assert_true(!usage_set->upcoming_uses.empty());
-  auto furthest_usage = std::max_element(usage_set->upcoming_uses.begin(),
-                                         usage_set->upcoming_uses.end(),
-                                         RegisterUsage::Comparer());
-  assert_true(furthest_usage->value->def->block == block);
-  assert_true(furthest_usage->use->instr->block == block);
+  auto furthest_usage = std::max_element(
+      usage_set->upcoming_uses.begin(), usage_set->upcoming_uses.end(),
+      [](const RegisterUsage& a, const RegisterUsage& b) {
+        uint32_t a_ordinal = a.use->instr->ordinal;
+        uint32_t b_ordinal = b.use->instr->ordinal;
+        if (a_ordinal != b_ordinal) {
+          return a_ordinal < b_ordinal;
+        }
+        return !a.value->local_slot && b.value->local_slot;
+      });
   auto spill_value = furthest_usage->value;
   Value::Use* prev_use = furthest_usage->use->prev;
   Value::Use* next_use = furthest_usage->use;
@@ -360,6 +408,20 @@ bool RegisterAllocationPass::SpillOneRegister(HIRBuilder* builder, Block* block,
   DumpUsage("SpillOneRegister (post)");
   const auto reg = spill_value->reg;
 
+  // Values that live across block boundaries take the conservative path:
+  // the backing store goes right after the def (whose block dominates every
+  // use) and each remaining use reloads in its own block, so no reload has
+  // to dominate a later use.
+  bool cross_block = spill_value->def->block != block;
+  for (auto use = next_use; !cross_block && use; use = use->next) {
+    if (use->instr->block != block) {
+      cross_block = true;
+    }
+  }
+  if (cross_block) {
+    return SpillCrossBlockValue(builder, spill_value, next_use, reg);
+  }
+
   // We know the spill_value use list is sorted, so we can cut it right now.
   // This makes it easier down below.
   auto new_head_use = next_use;
@@ -471,6 +533,71 @@ bool RegisterAllocationPass::SpillOneRegister(HIRBuilder* builder, Block* block,
   return true;
 }
 
+bool RegisterAllocationPass::SpillCrossBlockValue(HIRBuilder* builder,
+                                                  Value* spill_value,
+                                                  Value::Use* next_use,
+                                                  const RegAssignment& reg) {
+  // Allocate the local and store once, immediately after the def. Since the
+  // value is SSA the slot never goes stale, so a later spill of the same
+  // value is store-free.
+  if (!spill_value->local_slot) {
+    spill_value->local_slot = builder->AllocLocal(spill_value->type);
+    builder->StoreLocal(spill_value->local_slot, spill_value);
+    auto spill_store = builder->last_instr();
+    auto insert_before = spill_value->def->next;
+    while (insert_before &&
+           (insert_before->opcode->flags & OPCODE_FLAG_PAIRED_PREV)) {
+      insert_before = insert_before->next;
+    }
+    assert_not_null(insert_before);
+    spill_store->MoveBefore(insert_before);
+    spill_value->last_use = spill_store;
+  }
+
+  // Snapshot the remaining use sites; renaming operands below unlinks the
+  // uses from spill_value while we go. The list is sorted, so duplicate
+  // entries for one instruction are adjacent.
+  std::vector<Instr*> use_instrs;
+  for (auto use = next_use; use; use = use->next) {
+    if (use_instrs.empty() || use_instrs.back() != use->instr) {
+      use_instrs.push_back(use->instr);
+    }
+  }
+
+  for (auto instr : use_instrs) {
+    auto new_value = builder->LoadLocal(spill_value->local_slot);
+    new_value->local_slot = spill_value->local_slot;
+    auto spill_load = builder->last_instr();
+    // Keep paired sequences intact by reloading before the pair head.
+    auto insert_before = instr;
+    while (insert_before->prev &&
+           (insert_before->opcode->flags & OPCODE_FLAG_PAIRED_PREV)) {
+      insert_before = insert_before->prev;
+    }
+    spill_load->MoveBefore(insert_before);
+
+    uint32_t signature = instr->opcode->signature;
+    if (GET_OPCODE_SIG_TYPE_SRC1(signature) == OPCODE_SIG_TYPE_V &&
+        instr->src1.value == spill_value) {
+      instr->set_src1(new_value);
+    }
+    if (GET_OPCODE_SIG_TYPE_SRC2(signature) == OPCODE_SIG_TYPE_V &&
+        instr->src2.value == spill_value) {
+      instr->set_src2(new_value);
+    }
+    if (GET_OPCODE_SIG_TYPE_SRC3(signature) == OPCODE_SIG_TYPE_V &&
+        instr->src3.value == spill_value) {
+      instr->set_src3(new_value);
+    }
+    new_value->last_use = instr;
+  }
+
+  // Update tracking.
+  MarkRegAvailable(reg);
+
+  return true;
+}
+
 RegisterAllocationPass::RegisterSetUsage*
 RegisterAllocationPass::RegisterSetForValue(const Value* value) {
   if (value->type <= INT64_TYPE) {
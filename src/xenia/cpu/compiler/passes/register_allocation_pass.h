@@ -29,6 +29,7 @@ class RegisterAllocationPass : public CompilerPass {
   ~RegisterAllocationPass() override;
 
   bool Run(hir::HIRBuilder* builder) override;
+  const char* name() const override { return "RegisterAllocation"; }
 
  private:
   // TODO(benvanik): rewrite all this set shit -- too much indirection, the
@@ -54,6 +55,7 @@ class RegisterAllocationPass : public CompilerPass {
   };
 
   void DumpUsage(const char* name);
+  void ResetState();
   void PrepareBlockState();
   void AdvanceUses(hir::Instr* instr);
   bool IsRegInUse(const hir::RegAssignment& reg);
@@ -66,6 +68,9 @@ class RegisterAllocationPass : public CompilerPass {
   bool TryAllocateRegister(hir::Value* value);
   bool SpillOneRegister(hir::HIRBuilder* builder, hir::Block* block,
                         hir::TypeName required_type);
+  bool SpillCrossBlockValue(hir::HIRBuilder* builder, hir::Value* spill_value,
+                            hir::Value::Use* next_use,
+                            const hir::RegAssignment& reg);
 
   RegisterSetUsage* RegisterSetForValue(const hir::Value* value);
 
@@ -23,6 +23,7 @@ class SimplificationPass : public ConditionalGroupSubpass {
   ~SimplificationPass() override;
 
   bool Run(hir::HIRBuilder* builder, bool& result) override;
+  const char* name() const override { return "Simplification"; }
 
  private:
   bool EliminateConversions(hir::HIRBuilder* builder);
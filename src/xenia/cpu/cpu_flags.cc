@@ -17,6 +17,12 @@ DEFINE_string(
     "database.",
     "CPU");
 
+DEFINE_bool(substitute_crt_memory_routines, true,
+            "Replace the title's statically-linked memcpy/memmove/memset "
+            "with host implementations when the routines can be identified "
+            "(currently via --load_module_map symbol names).",
+            "CPU");
+
 DEFINE_bool(disassemble_functions, false,
             "Disassemble functions during generation.", "CPU");
 
@@ -38,6 +44,83 @@ DEFINE_bool(
 DEFINE_bool(validate_hir, false,
             "Perform validation checks on the HIR during compilation.", "CPU");
 
+DEFINE_bool(inline_leaf_functions, true,
+            "Inline tiny straight-line leaf functions into their callers "
+            "during translation, removing the call overhead. Disabled "
+            "automatically when debugging.",
+            "CPU");
+DEFINE_int32(inline_leaf_size, 32,
+             "Maximum byte size of a leaf function body considered for "
+             "inlining.",
+             "CPU");
+
+DEFINE_string(
+    code_cache_dir, "",
+    "Directory to persist translated code to, one cache file per title "
+    "(empty to disable). Caches are validated against the title and the "
+    "emulator build before reuse and rebuilt from scratch on mismatch. "
+    "{game_cache} expands to the per-title cache directory.",
+    "CPU");
+
+DEFINE_int32(
+    translation_threads, 0,
+    "Number of host threads to use for speculative background translation of "
+    "guest functions (0 to disable, -1 to use up to half of the logical "
+    "processors). Guest threads still translate on demand if they reach "
+    "untranslated code first.",
+    "CPU");
+
+DEFINE_bool(
+    tiered_compilation, false,
+    "Translate functions with a fast baseline pipeline first and retranslate "
+    "them through the full optimizing pipeline in the background once they "
+    "run hot. Requires (and implies) a background translation thread.",
+    "CPU");
+DEFINE_int32(tier_up_threshold, 1000,
+             "Number of calls after which a baseline-tier function is "
+             "retranslated with full optimization.",
+             "CPU");
+DEFINE_int32(code_gc_threshold_mb, 16,
+             "Megabytes of retired baseline code to accumulate before a "
+             "background translation thread suspends guest threads and frees "
+             "the old bodies that no stack still references. 0 disables "
+             "reclamation and retired code is kept forever.",
+             "CPU");
+
+DEFINE_string(
+    function_profile_dir, "",
+    "Directory to persist per-title execution profiles in. On later launches "
+    "the previous session's hottest functions are translated first, straight "
+    "at the optimized tier.",
+    "CPU");
+
+DEFINE_string(
+    xex_patch_cache_dir, "",
+    "Directory to persist fully patched XEX base images in, keyed by the "
+    "base and patch digests (empty to disable). Later launches restore the "
+    "patched image directly instead of reapplying every delta patch.",
+    "CPU");
+
+DEFINE_string(
+    stack_sample_report, "",
+    "Path to write a guest stack sampling report to on exit. When set, a "
+    "sampler thread periodically walks every guest thread's stack and "
+    "aggregates by guest function; the report is one "
+    "\"thread;frame;...;frame count\" line per unique stack (collapsed "
+    "format, ready for flame graph tooling). Empty disables sampling.",
+    "CPU");
+DEFINE_int32(stack_sample_rate, 100,
+             "Guest stack samples taken per second per thread when "
+             "--stack_sample_report is set.",
+             "CPU");
+
+DEFINE_bool(
+    precompile_modules, false,
+    "Translate every function discovered in a module before its entry point "
+    "runs instead of on first call. Boot takes longer, but gameplay never "
+    "stalls on translation.",
+    "CPU");
+
 // Breakpoints:
 DEFINE_uint64(break_on_instruction, 0,
               "int3 before the given guest address is executed.", "CPU");
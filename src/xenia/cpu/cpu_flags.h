@@ -15,6 +15,8 @@ DECLARE_string(cpu);
 
 DECLARE_string(load_module_map);
 
+DECLARE_bool(substitute_crt_memory_routines);
+
 DECLARE_bool(disassemble_functions);
 
 DECLARE_bool(trace_functions);
@@ -26,6 +28,25 @@ DECLARE_bool(disable_global_lock);
 
 DECLARE_bool(validate_hir);
 
+DECLARE_bool(inline_leaf_functions);
+DECLARE_int32(inline_leaf_size);
+
+DECLARE_string(code_cache_dir);
+
+DECLARE_int32(translation_threads);
+
+DECLARE_bool(precompile_modules);
+
+DECLARE_bool(tiered_compilation);
+DECLARE_int32(tier_up_threshold);
+DECLARE_int32(code_gc_threshold_mb);
+
+DECLARE_string(function_profile_dir);
+DECLARE_string(xex_patch_cache_dir);
+
+DECLARE_string(stack_sample_report);
+DECLARE_int32(stack_sample_rate);
+
 DECLARE_uint64(break_on_instruction);
 DECLARE_int32(break_condition_gpr);
 DECLARE_uint64(break_condition_value);
@@ -15,23 +15,96 @@
 namespace xe {
 namespace cpu {
 
-EntryTable::EntryTable() = default;
+namespace {
+
+// Large enough that most titles never grow during gameplay.
+constexpr size_t kInitialCapacity = 16 * 1024;
+
+size_t HashAddress(uint32_t address, size_t capacity) {
+  // Addresses are 4-byte aligned; Knuth multiplicative hash on the
+  // significant bits spreads sequential functions across the table.
+  return ((address >> 2) * 2654435761u) & (capacity - 1);
+}
+
+}  // namespace
+
+EntryTable::EntryTable() {
+  auto table = std::make_unique<Table>();
+  table->capacity = kInitialCapacity;
+  table->slots =
+      std::make_unique<std::atomic<Entry*>[]>(table->capacity);
+  for (size_t i = 0; i < table->capacity; ++i) {
+    table->slots[i].store(nullptr, std::memory_order_relaxed);
+  }
+  table_.store(table.get(), std::memory_order_release);
+  all_tables_.push_back(std::move(table));
+}
 
 EntryTable::~EntryTable() {
   auto global_lock = global_critical_region_.Acquire();
-  for (auto it : map_) {
-    Entry* entry = it.second;
+  Table* table = table_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < table->capacity; ++i) {
+    Entry* entry = table->slots[i].load(std::memory_order_relaxed);
     delete entry;
   }
 }
 
+Entry* EntryTable::Probe(Table* table, uint32_t address) {
+  size_t slot = HashAddress(address, table->capacity);
+  while (true) {
+    Entry* entry = table->slots[slot].load(std::memory_order_acquire);
+    if (!entry) {
+      return nullptr;
+    }
+    if (entry->address == address) {
+      return entry;
+    }
+    slot = (slot + 1) & (table->capacity - 1);
+  }
+}
+
+void EntryTable::Insert(Entry* entry) {
+  Table* table = table_.load(std::memory_order_relaxed);
+  size_t slot = HashAddress(entry->address, table->capacity);
+  while (table->slots[slot].load(std::memory_order_relaxed)) {
+    slot = (slot + 1) & (table->capacity - 1);
+  }
+  table->slots[slot].store(entry, std::memory_order_release);
+}
+
+void EntryTable::Grow() {
+  Table* old_table = table_.load(std::memory_order_relaxed);
+  auto new_table = std::make_unique<Table>();
+  new_table->capacity = old_table->capacity * 2;
+  new_table->slots =
+      std::make_unique<std::atomic<Entry*>[]>(new_table->capacity);
+  for (size_t i = 0; i < new_table->capacity; ++i) {
+    new_table->slots[i].store(nullptr, std::memory_order_relaxed);
+  }
+  for (size_t i = 0; i < old_table->capacity; ++i) {
+    Entry* entry = old_table->slots[i].load(std::memory_order_relaxed);
+    if (!entry) {
+      continue;
+    }
+    size_t slot = HashAddress(entry->address, new_table->capacity);
+    while (new_table->slots[slot].load(std::memory_order_relaxed)) {
+      slot = (slot + 1) & (new_table->capacity - 1);
+    }
+    new_table->slots[slot].store(entry, std::memory_order_relaxed);
+  }
+  // Publish; readers mid-probe on the old table are still valid as it is
+  // retired rather than freed.
+  table_.store(new_table.get(), std::memory_order_release);
+  all_tables_.push_back(std::move(new_table));
+}
+
 Entry* EntryTable::Get(uint32_t address) {
-  auto global_lock = global_critical_region_.Acquire();
-  const auto& it = map_.find(address);
-  Entry* entry = it != map_.end() ? it->second : nullptr;
+  Table* table = table_.load(std::memory_order_acquire);
+  Entry* entry = Probe(table, address);
   if (entry) {
     // TODO(benvanik): wait if needed?
-    if (entry->status != Entry::STATUS_READY) {
+    if (entry->status.load(std::memory_order_acquire) !=
+        Entry::STATUS_READY) {
       entry = nullptr;
     }
   }
@@ -39,47 +112,53 @@ Entry* EntryTable::Get(uint32_t address) {
 }
 
 Entry::Status EntryTable::GetOrCreate(uint32_t address, Entry** out_entry) {
-  // TODO(benvanik): replace with a map with wait-free for find.
-  // https://github.com/facebook/folly/blob/master/folly/AtomicHashMap.h
-
-  auto global_lock = global_critical_region_.Acquire();
-  const auto& it = map_.find(address);
-  Entry* entry = it != map_.end() ? it->second : nullptr;
-  Entry::Status status;
-  if (entry) {
-    // If we aren't ready yet spin and wait.
-    if (entry->status == Entry::STATUS_COMPILING) {
-      // Still compiling, so spin.
-      do {
-        global_lock.unlock();
-        // TODO(benvanik): sleep for less time?
-        xe::threading::Sleep(std::chrono::microseconds(10));
-        global_lock.lock();
-      } while (entry->status == Entry::STATUS_COMPILING);
+  // Fast path: no lock if the entry already exists.
+  Table* table = table_.load(std::memory_order_acquire);
+  Entry* entry = Probe(table, address);
+  if (!entry) {
+    auto global_lock = global_critical_region_.Acquire();
+    // Retry under the lock; another thread may have won the race.
+    entry = Probe(table_.load(std::memory_order_relaxed), address);
+    if (!entry) {
+      // Create and return for initialization.
+      if (count_ + 1 > table_.load(std::memory_order_relaxed)->capacity / 2) {
+        Grow();
+      }
+      entry = new Entry();
+      entry->address = address;
+      entry->end_address = 0;
+      entry->status = Entry::STATUS_COMPILING;
+      entry->function = nullptr;
+      Insert(entry);
+      ++count_;
+      *out_entry = entry;
+      return Entry::STATUS_NEW;
     }
-    status = entry->status;
-  } else {
-    // Create and return for initialization.
-    entry = new Entry();
-    entry->address = address;
-    entry->end_address = 0;
-    entry->status = Entry::STATUS_COMPILING;
-    entry->function = 0;
-    map_[address] = entry;
-    status = Entry::STATUS_NEW;
   }
-  global_lock.unlock();
+
+  // If the entry isn't ready yet spin and wait; the defining thread flips the
+  // status without taking any lock.
+  while (entry->status.load(std::memory_order_acquire) ==
+         Entry::STATUS_COMPILING) {
+    // TODO(benvanik): sleep for less time?
+    xe::threading::Sleep(std::chrono::microseconds(10));
+  }
   *out_entry = entry;
-  return status;
+  return entry->status.load(std::memory_order_acquire);
 }
 
 std::vector<Function*> EntryTable::FindWithAddress(uint32_t address) {
   auto global_lock = global_critical_region_.Acquire();
   std::vector<Function*> fns;
-  for (auto& it : map_) {
-    Entry* entry = it.second;
+  Table* table = table_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < table->capacity; ++i) {
+    Entry* entry = table->slots[i].load(std::memory_order_relaxed);
+    if (!entry) {
+      continue;
+    }
     if (address >= entry->address && address <= entry->end_address) {
-      if (entry->status == Entry::STATUS_READY) {
+      if (entry->status.load(std::memory_order_relaxed) ==
+          Entry::STATUS_READY) {
         fns.push_back(entry->function);
       }
     }
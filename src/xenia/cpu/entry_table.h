@@ -10,7 +10,8 @@
 #ifndef XENIA_CPU_ENTRY_TABLE_H_
 #define XENIA_CPU_ENTRY_TABLE_H_
 
-#include <unordered_map>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include "xenia/base/mutex.h"
@@ -30,10 +31,14 @@ typedef struct Entry_t {
 
   uint32_t address;
   uint32_t end_address;
-  Status status;
+  std::atomic<Status> status;
   Function* function;
 } Entry;
 
+// Maps guest addresses to function entries.
+// Lookups are lock-free so that guest threads resolving indirect call targets
+// never serialize on each other; only insertion (first resolution of an
+// address) takes the global lock. Entries are never removed.
 class EntryTable {
  public:
   EntryTable();
@@ -45,9 +50,30 @@ class EntryTable {
   std::vector<Function*> FindWithAddress(uint32_t address);
 
  private:
+  // Open-addressed hash table with linear probing. Slots transition from
+  // null to a fully-initialized Entry exactly once, which makes probing safe
+  // without a lock. Grown copies are published atomically and old tables are
+  // retired until destruction so racing readers never see freed memory.
+  struct Table {
+    size_t capacity;  // Always a power of two.
+    std::unique_ptr<std::atomic<Entry*>[]> slots;
+  };
+
+  // Probes the given table for an entry. Safe to call without the lock held.
+  Entry* Probe(Table* table, uint32_t address);
+  // Inserts into the current table. Must hold the global lock.
+  void Insert(Entry* entry);
+  // Doubles the table capacity and publishes the new table. Must hold the
+  // global lock.
+  void Grow();
+
+  // Serializes insertion and growth; never held for lookup.
   xe::global_critical_region global_critical_region_;
-  // TODO(benvanik): replace with a better data structure.
-  std::unordered_map<uint32_t, Entry*> map_;
+  std::atomic<Table*> table_;
+  // All tables ever published, including the current one. Retired tables are
+  // kept alive as concurrent readers may still be probing them.
+  std::vector<std::unique_ptr<Table>> all_tables_;
+  size_t count_ = 0;
 };
 
 }  // namespace cpu
@@ -58,20 +58,23 @@ void ExportResolver::RegisterTable(
       [](Export* a, Export* b) { return std::strcmp(a->name, b->name) <= 0; });
 }
 
-Export* ExportResolver::GetExportByOrdinal(const char* module_name,
-                                           uint16_t ordinal) {
+const ExportResolver::Table* ExportResolver::GetTable(
+    const char* module_name) const {
   for (const auto& table : tables_) {
     if (std::strncmp(module_name, table.module_name(),
                      std::strlen(table.module_name())) == 0) {
-      if (ordinal > table.exports_by_ordinal().size()) {
-        return nullptr;
-      }
-      return table.exports_by_ordinal().at(ordinal);
+      return &table;
     }
   }
   return nullptr;
 }
 
+Export* ExportResolver::GetExportByOrdinal(const char* module_name,
+                                           uint16_t ordinal) {
+  auto table = GetTable(module_name);
+  return table ? table->GetExportByOrdinal(ordinal) : nullptr;
+}
+
 void ExportResolver::SetVariableMapping(const char* module_name,
                                         uint16_t ordinal, uint32_t value) {
   auto export_entry = GetExportByOrdinal(module_name, ordinal);
@@ -127,6 +127,16 @@ class ExportResolver {
       return exports_by_name_;
     }
 
+    // Looks up an export by ordinal. The ordinal table is dense and indexed
+    // directly, so this is O(1); callers patching many imports should resolve
+    // the table once with ExportResolver::GetTable and use this.
+    Export* GetExportByOrdinal(uint16_t ordinal) const {
+      if (ordinal >= exports_by_ordinal_->size()) {
+        return nullptr;
+      }
+      return (*exports_by_ordinal_)[ordinal];
+    }
+
    private:
     char module_name_[32] = {0};
     const std::vector<Export*>* exports_by_ordinal_ = nullptr;
@@ -143,6 +153,10 @@ class ExportResolver {
     return all_exports_by_name_;
   }
 
+  // Returns the table registered for the given module name (with or without
+  // extension), or nullptr if none matches.
+  const Table* GetTable(const char* module_name) const;
+
   Export* GetExportByOrdinal(const char* module_name, uint16_t ordinal);
 
   void SetVariableMapping(const char* module_name, uint16_t ordinal,
@@ -100,6 +100,12 @@ class GuestFunction : public Function {
   typedef void (*ExternHandler)(ppc::PPCContext* ppc_context,
                                 kernel::KernelState* kernel_state);
 
+  // Optimization tier the current machine code was translated at.
+  enum class Tier {
+    kBaseline = 0,
+    kOptimized,
+  };
+
   GuestFunction(Module* module, uint32_t address);
   ~GuestFunction() override;
 
@@ -111,6 +117,14 @@ class GuestFunction : public Function {
   virtual uint8_t* machine_code() const = 0;
   virtual size_t machine_code_length() const = 0;
 
+  Tier tier() const { return tier_; }
+  void set_tier(Tier value) { tier_ = value; }
+  // Number of entries into the function observed while at the baseline tier.
+  // Incremented from the function prolog without synchronization; it only
+  // feeds the tier-up heuristic, so lost updates are acceptable.
+  uint32_t execution_count() const { return execution_count_; }
+  uint32_t* execution_count_address() { return &execution_count_; }
+
   FunctionDebugInfo* debug_info() const { return debug_info_.get(); }
   void set_debug_info(std::unique_ptr<FunctionDebugInfo> debug_info) {
     debug_info_ = std::move(debug_info);
@@ -141,6 +155,8 @@ class GuestFunction : public Function {
   std::vector<SourceMapEntry> source_map_;
   ExternHandler extern_handler_ = nullptr;
   Export* export_data_ = nullptr;
+  Tier tier_ = Tier::kBaseline;
+  uint32_t execution_count_ = 0;
 };
 
 }  // namespace cpu
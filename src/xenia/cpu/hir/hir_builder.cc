@@ -67,7 +67,15 @@ void HIRBuilder::Reset() {
 #if SCRIBBLE_ARENA_ON_RESET
   arena_->DebugFill();
 #endif
+  // The arena retains its chunks across resets, so once its capacity has
+  // grown past the largest function seen a translation allocates nothing
+  // from the heap. These gauges make warm-up growth (and any function that
+  // keeps growing the arena) visible in the profiler.
   arena_->Reset();
+  COUNT_profile_set("cpu/hir_builder/arena_capacity_bytes",
+                    arena_->capacity());
+  COUNT_profile_set("cpu/hir_builder/arena_high_water_bytes",
+                    arena_->high_water_mark());
 }
 
 bool HIRBuilder::Finalize() {
@@ -37,6 +37,10 @@ enum RoundMode {
 
 enum LoadStoreFlags {
   LOAD_STORE_BYTE_SWAP = 1 << 0,
+  // Address may not have the natural alignment of the access; backends must
+  // not use alignment-checking instructions. Set on accesses synthesized by
+  // MemorySequenceCombinationPass, which can only prove 8-byte alignment.
+  LOAD_STORE_UNALIGNED = 1 << 1,
 };
 
 enum CacheControlType {
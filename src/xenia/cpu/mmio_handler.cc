@@ -10,7 +10,12 @@
 #include "xenia/cpu/mmio_handler.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/byte_order.h"
@@ -273,6 +278,26 @@ bool TryDecodeMov(const uint8_t* p, DecodedMov* mov) {
   return true;
 }
 
+namespace {
+// Decode results for faulting load/store sites, keyed by host RIP. A title
+// polling an MMIO register (GPU status, interrupt acks) faults at the same
+// instruction millions of times, so re-parsing the mov on every fault is
+// wasted work; the fault counter also makes such hot polling sites visible
+// in the log so they can be given translation-time handling.
+struct MovCacheEntry {
+  DecodedMov mov;
+  std::atomic<uint64_t> fault_count;
+};
+// Shared lock for the common case of hitting an already decoded site, so
+// multiple guest threads polling MMIO registers don't serialize on every
+// fault; the exclusive lock is taken only to insert a new site. Entries are
+// heap-allocated so the pointer obtained under the shared lock stays valid
+// after a rehash caused by a concurrent insertion.
+std::shared_timed_mutex mov_cache_mutex_;
+std::unordered_map<uint64_t, std::unique_ptr<MovCacheEntry>> mov_cache_;
+const uint64_t kHotFaultSiteThreshold = 1000000;
+}  // namespace
+
 bool MMIOHandler::ExceptionCallbackThunk(Exception* ex, void* data) {
   return reinterpret_cast<MMIOHandler*>(data)->ExceptionCallback(ex);
 }
@@ -306,7 +331,7 @@ bool MMIOHandler::ExceptionCallback(Exception* ex) {
     // Recheck if the pages are still protected (race condition - another thread
     // clears the writewatch we just hit).
     // Do this under the lock so we don't introduce another race condition.
-    auto lock = global_critical_region_.Acquire();
+    auto lock = global_critical_region_.Acquire(__FUNCTION__);
     memory::PageAccess cur_access;
     size_t page_length = memory::page_size();
     memory::QueryProtect(fault_host_address, page_length, cur_access);
@@ -336,12 +361,38 @@ bool MMIOHandler::ExceptionCallback(Exception* ex) {
 
   auto rip = ex->pc();
   auto p = reinterpret_cast<const uint8_t*>(rip);
-  DecodedMov mov = {0};
-  bool decoded = TryDecodeMov(p, &mov);
-  if (!decoded) {
-    XELOGE("Unable to decode MMIO mov at %p", p);
-    assert_always("Unknown MMIO instruction type");
-    return false;
+  MovCacheEntry* entry = nullptr;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mov_cache_mutex_);
+    auto it = mov_cache_.find(rip);
+    if (it != mov_cache_.end()) {
+      entry = it->second.get();
+    }
+  }
+  if (!entry) {
+    // New site - decode outside of any lock, then publish the result.
+    DecodedMov decoded = {0};
+    if (!TryDecodeMov(p, &decoded)) {
+      XELOGE("Unable to decode MMIO mov at %p", p);
+      assert_always("Unknown MMIO instruction type");
+      return false;
+    }
+    std::unique_lock<std::shared_timed_mutex> lock(mov_cache_mutex_);
+    auto& slot = mov_cache_[rip];
+    if (!slot) {
+      slot.reset(new MovCacheEntry);
+      slot->mov = decoded;
+      slot->fault_count.store(0, std::memory_order_relaxed);
+    }
+    entry = slot.get();
+  }
+  DecodedMov mov = entry->mov;
+  if (entry->fault_count.fetch_add(1, std::memory_order_relaxed) + 1 ==
+      kHotFaultSiteThreshold) {
+    XELOGW(
+        "MMIO access at host %p has faulted %llu times - guest code is "
+        "likely polling an MMIO register in a loop",
+        p, kHotFaultSiteThreshold);
   }
 
   if (mov.is_load) {
@@ -81,6 +81,12 @@ int InstrEmit_branch(PPCHIRBuilder& f, const char* src, uint64_t cia,
           cond = f.IsFalse(cond);
         }
         f.CallTrue(cond, function, call_flags);
+      } else if (f.TryInlineFunction(function)) {
+        // Body was emitted in place of the call; a tail call still needs to
+        // return to the caller's caller afterwards.
+        if (call_flags & CALL_TAIL) {
+          f.Return();
+        }
       } else {
         f.Call(function, call_flags);
       }
@@ -127,7 +133,13 @@ int InstrEmit_branch(PPCHIRBuilder& f, const char* src, uint64_t cia,
     {
 #endif
     // Jump to pointer.
-    bool likely_return = !lk && nia_is_lr;
+    // Any indirect branch that doesn't set LR may be a return: blr is the
+    // common case, but some titles return through mtctr lr; bctr as well.
+    // The backend verifies the target against the return address recorded at
+    // the call site and turns a match into a host return (predicted by the
+    // hardware return address stack), falling back to the generic indirect
+    // dispatch on mismatch - so over-flagging only costs a compare.
+    bool likely_return = !lk;
     if (likely_return) {
       call_flags |= CALL_POSSIBLE_RETURN;
     }
@@ -41,6 +41,14 @@ void InitializeIfNeeded() {
 
 void CleanupOnShutdown() {}
 
+// Recursion count of the emulated global lock, shared by the builtins below.
+// This lives in static storage rather than in PPCFrontend because its address
+// is baked into generated code as an immediate: code restored by the backend's
+// persistent code cache in a later run must find it at the same image-relative
+// address, and heap objects move between runs. The mutex it shadows
+// (xe::global_critical_region) is process-wide anyway.
+int32_t global_lock_count_ = 0;
+
 PPCFrontend::PPCFrontend(Processor* processor) : processor_(processor) {
   InitializeIfNeeded();
 }
@@ -80,7 +88,7 @@ void LeaveGlobalLock(PPCContext* ppc_context, void* arg0, void* arg1) {
 
 bool PPCFrontend::Initialize() {
   void* arg0 = reinterpret_cast<void*>(&xe::global_critical_region::mutex());
-  void* arg1 = reinterpret_cast<void*>(&builtins_.global_lock_count);
+  void* arg1 = reinterpret_cast<void*>(&global_lock_count_);
   builtins_.check_global_lock =
       processor_->DefineBuiltin("CheckGlobalLock", CheckGlobalLock, arg0, arg1);
   builtins_.enter_global_lock =
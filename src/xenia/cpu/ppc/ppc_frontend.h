@@ -29,7 +29,6 @@ namespace ppc {
 class PPCTranslator;
 
 struct PPCBuiltins {
-  int32_t global_lock_count;
   Function* check_global_lock;
   Function* enter_global_lock;
   Function* leave_global_lock;
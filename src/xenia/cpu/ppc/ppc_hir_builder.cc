@@ -13,6 +13,7 @@
 #include <cstring>
 
 #include "xenia/base/byte_order.h"
+#include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
@@ -24,6 +25,14 @@
 #include "xenia/cpu/ppc/ppc_opcode_info.h"
 #include "xenia/cpu/processor.h"
 
+DEFINE_bool(
+    lazy_fpscr_updates, true,
+    "Skip the per-instruction FPSCR exception summary update. The emulated "
+    "summary bits are never raised by arithmetic anyway, so the read-"
+    "modify-write only ever clears what an explicit mtfsf/mtfsfi/mtfsb set; "
+    "disable to restore that clearing for titles that inspect FPSCR.",
+    "CPU");
+
 namespace xe {
 namespace cpu {
 namespace ppc {
@@ -39,6 +48,8 @@ using xe::cpu::hir::Value;
 // Accumulated across the entire run.
 uint32_t opcode_translation_counts[static_cast<int>(PPCOpcode::kInvalid)] = {0};
 
+StatCounter count_instructions_translated("cpu/ppc/instructions_translated");
+
 void DumpAllOpcodeCounts() {
   StringBuffer sb;
   sb.Append("Instruction translation counts:\n");
@@ -150,6 +161,7 @@ bool PPCHIRBuilder::Emit(GuestFunction* function, uint32_t flags) {
       continue;
     }
     ++opcode_translation_counts[static_cast<int>(opcode)];
+    count_instructions_translated.Increment();
 
     // Synchronize the PPC context as required.
     // This will ensure all registers are saved to the PPC context before this
@@ -238,6 +250,83 @@ Function* PPCHIRBuilder::LookupFunction(uint32_t address) {
   return frontend_->processor()->LookupFunction(address);
 }
 
+bool PPCHIRBuilder::TryInlineFunction(Function* function) {
+  if (!cvars::inline_leaf_functions || cvars::debug) {
+    return false;
+  }
+  if (!function || !function->is_guest() || function == function_) {
+    return false;
+  }
+  auto callee = static_cast<GuestFunction*>(function);
+  uint32_t start_address = callee->address();
+  uint32_t end_address = callee->end_address();
+  if (!end_address || end_address <= start_address) {
+    return false;
+  }
+  if (end_address - start_address > uint32_t(cvars::inline_leaf_size)) {
+    return false;
+  }
+
+  Memory* memory = frontend_->memory();
+
+  // The body must be straight-line code ending in a plain blr: no branches,
+  // traps, SPR accesses, or context-synchronizing instructions.
+  for (uint32_t address = start_address; address <= end_address;
+       address += 4) {
+    uint32_t code =
+        xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
+    auto opcode = LookupOpcode(code);
+    if (opcode == PPCOpcode::kInvalid) {
+      return false;
+    }
+    auto& opcode_info = GetOpcodeInfo(opcode);
+    if (address == end_address) {
+      if (code != 0x4E800020) {  // blr
+        return false;
+      }
+    } else if (opcode_info.group == PPCOpcodeGroup::kB ||
+               opcode_info.group == PPCOpcodeGroup::kC ||
+               opcode_info.type == PPCOpcodeType::kSync ||
+               !opcode_info.emit) {
+      return false;
+    }
+  }
+
+  // Emit the body (sans blr) in place of the call. Source offsets stay on
+  // the call site so the source map remains within the caller.
+  for (uint32_t address = start_address; address < end_address; address += 4) {
+    trace_info_.dest_count = 0;
+    uint32_t code =
+        xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
+    auto opcode = LookupOpcode(code);
+    auto& opcode_info = GetOpcodeInfo(opcode);
+
+    if (with_debug_info_) {
+      comment_buffer_.Reset();
+      comment_buffer_.AppendFormat("(inlined %.8X) %.8X ", address, code);
+      DisasmPPC(address, code, &comment_buffer_);
+      Comment(comment_buffer_);
+    }
+
+    ++opcode_translation_counts[static_cast<int>(opcode)];
+    count_instructions_translated.Increment();
+
+    InstrData i;
+    i.address = address;
+    i.code = code;
+    i.opcode = opcode;
+    i.opcode_info = &opcode_info;
+    if (opcode_info.emit(*this, i)) {
+      auto& disasm_info = GetOpcodeDisasmInfo(opcode);
+      XELOGE("Unimplemented instr %.8llX %.8X %s", address, code,
+             disasm_info.name);
+      Comment("UNIMPLEMENTED!");
+      DebugBreak();
+    }
+  }
+  return true;
+}
+
 Label* PPCHIRBuilder::LookupLabel(uint32_t address) {
   if (address < start_address_) {
     return nullptr;
@@ -443,6 +532,13 @@ void PPCHIRBuilder::UpdateFPSCR(Value* result, bool update_cr1) {
     StoreContext(offsetof(PPCContext, cr1.cr1_ox), ox);
   }
 
+  if (cvars::lazy_fpscr_updates) {
+    // The summary bits above are always zero, so there is nothing to fold
+    // into FPSCR; leave whatever an explicit move-to-FPSCR last wrote and
+    // spare every FP instruction the read-modify-write.
+    return;
+  }
+
   // Generate our new bits.
   Value* new_bits = Shl(ZeroExtend(fx, INT32_TYPE), 31);
   new_bits = Or(new_bits, Shl(ZeroExtend(fex, INT32_TYPE), 30));
@@ -44,6 +44,11 @@ class PPCHIRBuilder : public hir::HIRBuilder {
   Function* LookupFunction(uint32_t address);
   Label* LookupLabel(uint32_t address);
 
+  // Attempts to emit the body of the given callee inline at the current
+  // point instead of a call. Only tiny straight-line leaf functions ending
+  // in a plain blr qualify; returns false if the callee can't be inlined.
+  bool TryInlineFunction(Function* function);
+
   Value* LoadLR();
   void StoreLR(Value* value);
   Value* LoadCTR();
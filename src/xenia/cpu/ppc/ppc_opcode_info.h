@@ -145,6 +145,8 @@ struct PPCOpcodeDisasmInfo {
 };
 
 PPCOpcode LookupOpcode(uint32_t code);
+void LookupOpcodeBatch(const uint32_t* codes, size_t count,
+                       PPCOpcode* out_opcodes);
 
 const PPCOpcodeInfo& GetOpcodeInfo(PPCOpcode opcode);
 const PPCOpcodeDisasmInfo& GetOpcodeDisasmInfo(PPCOpcode opcode);
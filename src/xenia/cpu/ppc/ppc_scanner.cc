@@ -64,9 +64,27 @@ bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info) {
   size_t blocks_found = 0;
   bool in_block = false;
   bool starts_with_mfspr_lr = false;
+
+  // Decode one cache line of instructions at a time - the walk below is
+  // linear, so batching the table lookups amortizes the per-instruction
+  // load/swap and keeps the decode tables hot.
+  const uint32_t kBatchSize = 16;
+  uint32_t batch_base_address = ~uint32_t(0);
+  uint32_t batch_codes[kBatchSize];
+  PPCOpcode batch_opcodes[kBatchSize];
   while (true) {
-    uint32_t code =
-        xe::load_and_swap<uint32_t>(memory->TranslateVirtual(address));
+    if (address - batch_base_address >= kBatchSize * 4) {
+      batch_base_address = address & ~(kBatchSize * 4 - 1);
+      const uint8_t* batch_host_address =
+          memory->TranslateVirtual(batch_base_address);
+      for (uint32_t i = 0; i < kBatchSize; ++i) {
+        batch_codes[i] =
+            xe::load_and_swap<uint32_t>(batch_host_address + i * 4);
+      }
+      LookupOpcodeBatch(batch_codes, kBatchSize, batch_opcodes);
+    }
+    uint32_t batch_index = (address - batch_base_address) >> 2;
+    uint32_t code = batch_codes[batch_index];
 
     // If we fetched 0 assume that we somehow hit one of the awesome
     // 'no really we meant to end after that bl' functions.
@@ -77,7 +95,7 @@ bool PPCScanner::Scan(GuestFunction* function, FunctionDebugInfo* debug_info) {
       break;
     }
 
-    auto opcode = LookupOpcode(code);
+    PPCOpcode opcode = batch_opcodes[batch_index];
 
     PPCDecodeData d;
     d.address = address;
@@ -45,10 +45,16 @@ PPCTranslator::PPCTranslator(PPCFrontend* frontend) : frontend_(frontend) {
   // The CFG is required for simplification and dirtied by it.
   compiler_->AddPass(std::make_unique<passes::ControlFlowAnalysisPass>());
   compiler_->AddPass(std::make_unique<passes::ControlFlowSimplificationPass>());
+  // With the block structure settled, repack the instruction stream into
+  // program order so the list walks in every pass below are cache-linear.
+  compiler_->AddPass(std::make_unique<passes::InstrCompactionPass>());
 
   // Passes are executed in the order they are added. Multiple of the same
   // pass type may be used.
   if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+  // Context promotion carries values across single-predecessor edges and
+  // needs edges rebuilt after the merging above.
+  compiler_->AddPass(std::make_unique<passes::ControlFlowAnalysisPass>());
   compiler_->AddPass(std::make_unique<passes::ContextPromotionPass>());
   if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
 
@@ -71,16 +77,25 @@ PPCTranslator::PPCTranslator(PPCFrontend* frontend) : frontend_(frontend) {
   }
   compiler_->AddPass(std::make_unique<passes::SimplificationPass>());
   if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+  // Collapse stacked constant-control vector shuffles into single permutes;
+  // DCE below removes the inner shuffles this orphans.
+  compiler_->AddPass(std::make_unique<passes::PermuteCombinationPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+  // Deduplicate repeated loads/swaps/address math; DCE below sweeps up the
+  // assignments this leaves behind.
+  compiler_->AddPass(std::make_unique<passes::GlobalValueNumberingPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+  // Hoist invariant work out of loops. Needs fresh edges, as earlier passes
+  // may have dirtied the CFG built at the top of the pipeline.
+  compiler_->AddPass(std::make_unique<passes::ControlFlowAnalysisPass>());
+  compiler_->AddPass(std::make_unique<passes::LoopInvariantCodeMotionPass>());
+  if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
   // compiler_->AddPass(std::make_unique<passes::DeadStoreEliminationPass>());
   // if (validate)
   // compiler_->AddPass(std::make_unique<passes::ValidationPass>());
   compiler_->AddPass(std::make_unique<passes::DeadCodeEliminationPass>());
   if (validate) compiler_->AddPass(std::make_unique<passes::ValidationPass>());
 
-  //// Removes all unneeded variables. Try not to add new ones after this.
-  // compiler_->AddPass(new passes::ValueReductionPass());
-  // if (validate) compiler_->AddPass(new passes::ValidationPass());
-
   // Register allocation for the target backend.
   // Will modify the HIR to add loads/stores.
   // This should be the last pass before finalization, as after this all
@@ -91,6 +106,34 @@ PPCTranslator::PPCTranslator(PPCFrontend* frontend) : frontend_(frontend) {
 
   // Must come last. The HIR is not really HIR after this.
   compiler_->AddPass(std::make_unique<passes::FinalizationPass>());
+
+  if (cvars::tiered_compilation) {
+    // Baseline tier: just enough cleanup that register allocation produces
+    // sane code. Hot functions come back through the full pipeline above.
+    baseline_compiler_.reset(new Compiler(frontend->processor()));
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::ControlFlowAnalysisPass>());
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::ControlFlowSimplificationPass>());
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::ContextPromotionPass>());
+    baseline_compiler_->AddPass(std::make_unique<passes::SimplificationPass>());
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::ConstantPropagationPass>());
+    if (backend->machine_info()->supports_extended_load_store) {
+      baseline_compiler_->AddPass(
+          std::make_unique<passes::MemorySequenceCombinationPass>());
+    }
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::DeadCodeEliminationPass>());
+    if (validate) {
+      baseline_compiler_->AddPass(std::make_unique<passes::ValidationPass>());
+    }
+    baseline_compiler_->AddPass(
+        std::make_unique<passes::RegisterAllocationPass>(
+            backend->machine_info()));
+    baseline_compiler_->AddPass(std::make_unique<passes::FinalizationPass>());
+  }
 }
 
 PPCTranslator::~PPCTranslator() = default;
@@ -99,9 +142,17 @@ bool PPCTranslator::Translate(GuestFunction* function,
                               uint32_t debug_info_flags) {
   SCOPE_profile_cpu_f("cpu");
 
+  // Baseline tier until the function runs hot and comes back for
+  // reoptimization.
+  auto compiler = compiler_.get();
+  if (baseline_compiler_ &&
+      function->tier() == GuestFunction::Tier::kBaseline) {
+    compiler = baseline_compiler_.get();
+  }
+
   // Reset() all caching when we leave.
   xe::make_reset_scope(builder_);
-  xe::make_reset_scope(compiler_);
+  xe::make_reset_scope(compiler);
   xe::make_reset_scope(assembler_);
   xe::make_reset_scope(&string_buffer_);
 
@@ -176,7 +227,7 @@ bool PPCTranslator::Translate(GuestFunction* function,
   }
 
   // Compile/optimize/etc.
-  if (!compiler_->Compile(builder_.get())) {
+  if (!compiler->Compile(builder_.get())) {
     return false;
   }
 
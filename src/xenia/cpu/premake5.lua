@@ -20,5 +20,6 @@ project("xenia-cpu")
   local_platform_files("hir")
   local_platform_files("ppc")
 
+include("benchmarking")
 include("testing")
 include("ppc/testing")
@@ -9,6 +9,8 @@
 
 #include "xenia/cpu/processor.h"
 
+#include <algorithm>
+
 #include "xenia/base/assert.h"
 #include "xenia/base/atomic.h"
 #include "xenia/base/byte_order.h"
@@ -19,6 +21,8 @@
 #include "xenia/base/logging.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/startup_timeline.h"
+#include "xenia/base/thread_pool.h"
 #include "xenia/base/threading.h"
 #include "xenia/cpu/breakpoint.h"
 #include "xenia/cpu/cpu_flags.h"
@@ -26,6 +30,7 @@
 #include "xenia/cpu/module.h"
 #include "xenia/cpu/ppc/ppc_decode_data.h"
 #include "xenia/cpu/ppc/ppc_frontend.h"
+#include "xenia/cpu/sampling_profiler.h"
 #include "xenia/cpu/stack_walker.h"
 #include "xenia/cpu/thread.h"
 #include "xenia/cpu/thread_state.h"
@@ -54,6 +59,10 @@ class XThread;
 
 namespace cpu {
 
+namespace {
+StatCounter count_functions_translated("cpu/processor/functions_translated");
+}  // namespace
+
 using xe::cpu::ppc::PPCOpcode;
 using xe::kernel::XThread;
 
@@ -82,6 +91,15 @@ Processor::Processor(xe::Memory* memory, ExportResolver* export_resolver)
     : memory_(memory), export_resolver_(export_resolver) {}
 
 Processor::~Processor() {
+  if (sampling_profiler_) {
+    sampling_profiler_->Stop();
+    sampling_profiler_->WriteReport(
+        xe::to_wstring(cvars::stack_sample_report));
+    sampling_profiler_.reset();
+  }
+
+  StopTranslationThreads();
+
   {
     auto global_lock = global_critical_region_.Acquire();
     modules_.clear();
@@ -139,6 +157,13 @@ bool Processor::Setup(std::unique_ptr<backend::Backend> backend) {
     }
   }
 
+  // Start the guest stack sampler, if requested.
+  if (stack_walker_ && !cvars::stack_sample_report.empty()) {
+    sampling_profiler_ = std::make_unique<SamplingProfiler>(this);
+    sampling_profiler_->Start(
+        uint32_t(std::max(1, cvars::stack_sample_rate)));
+  }
+
   // Open the trace data path, if requested.
   functions_trace_path_ = xe::to_wstring(cvars::trace_function_data_path);
   if (!functions_trace_path_.empty()) {
@@ -146,9 +171,442 @@ bool Processor::Setup(std::unique_ptr<backend::Backend> backend) {
         functions_trace_path_, 32 * 1024 * 1024, true);
   }
 
+  StartTranslationThreads();
+
   return true;
 }
 
+void Processor::StartTranslationThreads() {
+  if (!cvars::translation_threads && !cvars::tiered_compilation) {
+    return;
+  }
+  uint32_t thread_count;
+  if (cvars::translation_threads < 0) {
+    thread_count = std::max(
+        xe::threading::logical_processor_count() >> 1, uint32_t(1));
+  } else {
+    thread_count = uint32_t(cvars::translation_threads);
+  }
+  // Tier-up retranslation rides on the worker pool, so it needs at least one
+  // thread even when speculative translation is off.
+  if (cvars::tiered_compilation) {
+    thread_count = std::max(thread_count, uint32_t(1));
+  }
+  thread_count = std::min(thread_count, uint32_t(16));
+  translation_threads_shutdown_ = false;
+  for (uint32_t i = 0; i < thread_count; ++i) {
+    auto translation_thread =
+        xe::threading::Thread::Create({}, [this]() { TranslationThread(); });
+    translation_thread->set_name("CPU Translation");
+    translation_threads_.push_back(std::move(translation_thread));
+  }
+  XELOGCPU("Started %u background translation threads", thread_count);
+}
+
+void Processor::StopTranslationThreads() {
+  if (translation_threads_.empty()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(translation_request_lock_);
+    translation_threads_shutdown_ = true;
+  }
+  translation_request_cond_.notify_all();
+  for (size_t i = 0; i < translation_threads_.size(); ++i) {
+    xe::threading::Wait(translation_threads_[i].get(), false);
+  }
+  translation_threads_.clear();
+}
+
+void Processor::TranslationThread() {
+  while (true) {
+    uint32_t address = 0;
+    bool have_address = false;
+    {
+      std::unique_lock<std::mutex> lock(translation_request_lock_);
+      // Wake periodically even when idle so the tier-up sweep runs.
+      translation_request_cond_.wait_for(
+          lock, std::chrono::milliseconds(100), [this]() {
+            return translation_threads_shutdown_ ||
+                   !translation_queue_.empty();
+          });
+      if (translation_threads_shutdown_) {
+        return;
+      }
+      if (!translation_queue_.empty()) {
+        address = translation_queue_.front();
+        translation_queue_.pop_front();
+        have_address = true;
+      }
+    }
+    if (have_address) {
+      // A guest thread may have reached the function first, in which case
+      // this hits the entry table and returns immediately. Failures are
+      // recorded in the entry table like on-demand failures, so bogus
+      // speculative targets are only ever attempted once.
+      ResolveFunction(address);
+    } else {
+      SweepTierCandidates();
+      ReclaimRetiredCode();
+    }
+  }
+}
+
+void Processor::SweepTierCandidates() {
+  if (!cvars::tiered_compilation) {
+    return;
+  }
+  while (true) {
+    GuestFunction* hot = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(translation_request_lock_);
+      for (auto it = tier_candidates_.begin(); it != tier_candidates_.end();
+           ++it) {
+        if ((*it)->execution_count() >= uint32_t(cvars::tier_up_threshold)) {
+          hot = *it;
+          tier_candidates_.erase(it);
+          break;
+        }
+      }
+    }
+    if (!hot) {
+      break;
+    }
+    XELOGCPU("Reoptimizing hot function %.8X after %u calls", hot->address(),
+             hot->execution_count());
+    RetranslateFunction(hot);
+  }
+}
+
+bool Processor::RetranslateFunction(GuestFunction* function) {
+  // Runs the full pipeline this time; the backend emplaces the new code and
+  // repoints the indirection table, so subsequent calls land in the optimized
+  // body. All call sites dispatch through the table, so the baseline body is
+  // only reachable from frames already inside it.
+  uint8_t* old_code = function->machine_code();
+  size_t old_length = function->machine_code_length();
+  function->set_tier(GuestFunction::Tier::kOptimized);
+  function->source_map().clear();
+  if (!frontend_->DefineFunction(function, debug_info_flags_)) {
+    XELOGE("Reoptimization of %.8X failed; keeping baseline code",
+           function->address());
+    return false;
+  }
+  // Re-patch any installed breakpoints into the new code body.
+  OnFunctionDefined(function);
+  if (cvars::code_gc_threshold_mb > 0 && old_code && old_length) {
+    // Queue the retired baseline body so the next safe-point pass can return
+    // its memory once no stack is executing it.
+    std::lock_guard<std::mutex> lock(translation_request_lock_);
+    retired_code_.push_back({old_code, old_length});
+    retired_code_bytes_ += old_length;
+  }
+  return true;
+}
+
+void Processor::ReclaimRetiredCode() {
+  if (cvars::code_gc_threshold_mb <= 0) {
+    return;
+  }
+  std::vector<RetiredCodeRange> pending;
+  {
+    std::lock_guard<std::mutex> lock(translation_request_lock_);
+    if (retired_code_bytes_ <
+        (size_t(cvars::code_gc_threshold_mb) << 20)) {
+      return;
+    }
+    pending.swap(retired_code_);
+    retired_code_bytes_ = 0;
+  }
+  // Don't fight the debugger over thread suspension; if it has the target
+  // stopped, the sweep runs on a later pass.
+  if (execution_state_ != ExecutionState::kRunning) {
+    std::lock_guard<std::mutex> lock(translation_request_lock_);
+    for (auto& range : pending) {
+      retired_code_.push_back(range);
+      retired_code_bytes_ += range.length;
+    }
+    return;
+  }
+
+  // Safe point: with every guest thread suspended, the host PCs on their
+  // stacks are the complete set of code a thread could still resume into.
+  SuspendAllThreads();
+  std::vector<uint64_t> live_pcs;
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    uint64_t frame_host_pcs[64];
+    for (auto& it : thread_debug_infos_) {
+      auto thread_info = it.second.get();
+      if (!thread_info->suspended) {
+        continue;
+      }
+      size_t count = stack_walker_->CaptureStackTrace(
+          thread_info->thread->thread()->native_handle(), frame_host_pcs, 0,
+          xe::countof(frame_host_pcs), nullptr, nullptr);
+      live_pcs.insert(live_pcs.end(), frame_host_pcs, frame_host_pcs + count);
+    }
+  }
+
+  size_t freed_bytes = 0;
+  std::vector<RetiredCodeRange> still_live;
+  for (auto& range : pending) {
+    bool live = false;
+    for (uint64_t pc : live_pcs) {
+      if (pc - reinterpret_cast<uint64_t>(range.code) < range.length) {
+        live = true;
+        break;
+      }
+    }
+    if (live) {
+      still_live.push_back(range);
+    } else if (backend_->code_cache()->ReleaseGuestCode(range.code,
+                                                        range.length)) {
+      freed_bytes += range.length;
+    }
+  }
+  ResumeAllThreads();
+
+  if (!still_live.empty()) {
+    std::lock_guard<std::mutex> lock(translation_request_lock_);
+    for (auto& range : still_live) {
+      retired_code_.push_back(range);
+      retired_code_bytes_ += range.length;
+    }
+  }
+  XELOGCPU("Code GC: freed %lluKB of retired code, %u bodies still on stacks",
+           uint64_t(freed_bytes / 1024), uint32_t(still_live.size()));
+}
+
+void Processor::QueueSpeculativeTargets(Function* function) {
+  if (translation_threads_.empty() || !function->is_guest()) {
+    return;
+  }
+  uint32_t start_address = function->address();
+  uint32_t end_address = function->end_address();
+  if (!end_address || end_address < start_address) {
+    return;
+  }
+  bool queued_any = false;
+  {
+    std::lock_guard<std::mutex> lock(translation_request_lock_);
+    for (uint32_t address = start_address; address <= end_address;
+         address += 4) {
+      uint32_t code =
+          xe::load_and_swap<uint32_t>(memory_->TranslateVirtual(address));
+      // Only direct calls: b with AA=0/LK=1 (opcode 18).
+      if ((code & 0xFC000003) != 0x48000001) {
+        continue;
+      }
+      // Sign-extended LI field, relative to the branch address.
+      uint32_t target =
+          address + (uint32_t(int32_t(code << 6) >> 6) & ~uint32_t(3));
+      if (entry_table_.Get(target)) {
+        continue;
+      }
+      if (translation_queued_addresses_.insert(target).second) {
+        translation_queue_.push_back(target);
+        queued_any = true;
+      }
+    }
+  }
+  if (queued_any) {
+    translation_request_cond_.notify_all();
+  }
+}
+
+void Processor::PrecompileRange(
+    uint32_t start_address, uint32_t end_address,
+    const std::vector<uint32_t>& root_addresses,
+    std::function<void(size_t, size_t)> progress_callback) {
+  // Scan for every direct branch in the range, then seed only the functions
+  // reachable from the given roots (entry point and exports) over the direct
+  // call graph. Dead code - debug routines, unused engine features - never
+  // runs, so translating it up front just bloats prewarm time and the
+  // persistent cache; anything reached another way (function pointers,
+  // vtables) still translates on demand at the baseline tier.
+  // The scan is read-only over the mapped image, so partition it across the
+  // shared pool - large titles have tens of MB of text to walk.
+  struct BranchSite {
+    uint32_t address;
+    uint32_t target;
+    bool is_link;
+  };
+  const uint32_t kScanChunkBytes = 256 * 1024;
+  uint32_t chunk_count =
+      (end_address - start_address + kScanChunkBytes - 1) / kScanChunkBytes;
+  std::vector<std::vector<BranchSite>> chunk_sites(chunk_count);
+  xe::threading::ThreadPool::shared()->ParallelFor(
+      chunk_count, [&](uint32_t chunk) {
+        uint32_t chunk_start = start_address + chunk * kScanChunkBytes;
+        uint32_t chunk_end =
+            std::min(end_address, chunk_start + kScanChunkBytes);
+        auto& sites = chunk_sites[chunk];
+        for (uint32_t address = chunk_start; address < chunk_end;
+             address += 4) {
+          uint32_t code =
+              xe::load_and_swap<uint32_t>(memory_->TranslateVirtual(address));
+          // b/bl with a relative target (AA clear).
+          if ((code & 0xFC000002) != 0x48000000) {
+            continue;
+          }
+          uint32_t target =
+              address + (uint32_t(int32_t(code << 6) >> 6) & ~uint32_t(3));
+          if (target < start_address || target >= end_address) {
+            continue;
+          }
+          sites.push_back({address, target, (code & 1) != 0});
+        }
+      });
+  std::vector<BranchSite> sites;
+  for (const auto& chunk : chunk_sites) {
+    sites.insert(sites.end(), chunk.begin(), chunk.end());
+  }
+
+  // Function starts are bl targets plus the roots; data words that happen to
+  // decode as bl contribute bogus starts, but those are only reached if a
+  // live call site appears to target them, same exposure as before.
+  std::vector<uint32_t> starts;
+  starts.reserve(sites.size());
+  for (const auto& site : sites) {
+    if (site.is_link) {
+      starts.push_back(site.target);
+    }
+  }
+  std::vector<uint32_t> roots;
+  for (uint32_t root : root_addresses) {
+    if (root >= start_address && root < end_address) {
+      roots.push_back(root);
+      starts.push_back(root);
+    }
+  }
+  std::sort(starts.begin(), starts.end());
+  starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+
+  std::vector<uint32_t> seeds;
+  if (roots.empty()) {
+    // No usable roots; fall back to translating every call target.
+    seeds = std::move(starts);
+  } else {
+    // Attribute each branch site to the nearest preceding function start and
+    // flood-fill from the roots. bl edges always lead to a start; plain b
+    // only counts when it lands on one (a tail call), since within a
+    // function it's just control flow.
+    std::sort(sites.begin(), sites.end(),
+              [](const BranchSite& a, const BranchSite& b) {
+                return a.address < b.address;
+              });
+    auto start_index_of = [&](uint32_t address) -> size_t {
+      auto it = std::upper_bound(starts.begin(), starts.end(), address);
+      return it == starts.begin() ? starts.size() : (it - starts.begin()) - 1;
+    };
+    std::vector<bool> reachable(starts.size());
+    std::vector<uint32_t> worklist;
+    for (uint32_t root : roots) {
+      size_t index = start_index_of(root);
+      if (index < starts.size() && !reachable[index]) {
+        reachable[index] = true;
+        worklist.push_back(starts[index]);
+      }
+    }
+    while (!worklist.empty()) {
+      uint32_t function_start = worklist.back();
+      worklist.pop_back();
+      size_t function_index = start_index_of(function_start);
+      uint32_t function_end = function_index + 1 < starts.size()
+                                  ? starts[function_index + 1]
+                                  : end_address;
+      auto site_it = std::lower_bound(
+          sites.begin(), sites.end(), function_start,
+          [](const BranchSite& site, uint32_t address) {
+            return site.address < address;
+          });
+      for (; site_it != sites.end() && site_it->address < function_end;
+           ++site_it) {
+        if (!site_it->is_link &&
+            !std::binary_search(starts.begin(), starts.end(),
+                                site_it->target)) {
+          continue;
+        }
+        size_t target_index = start_index_of(site_it->target);
+        if (target_index < starts.size() && !reachable[target_index] &&
+            starts[target_index] == site_it->target) {
+          reachable[target_index] = true;
+          worklist.push_back(site_it->target);
+        }
+      }
+    }
+    for (size_t i = 0; i < starts.size(); ++i) {
+      if (reachable[i]) {
+        seeds.push_back(starts[i]);
+      }
+    }
+    XELOGCPU("Precompile reachability: %u of %u discovered functions live",
+             uint32_t(seeds.size()), uint32_t(starts.size()));
+  }
+  size_t total = seeds.size();
+  XELOGCPU("Precompiling %u discovered functions...", uint32_t(total));
+
+  if (!translation_threads_.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(translation_request_lock_);
+      for (uint32_t address : seeds) {
+        if (entry_table_.Get(address)) {
+          continue;
+        }
+        if (translation_queued_addresses_.insert(address).second) {
+          translation_queue_.push_back(address);
+        }
+      }
+    }
+    translation_request_cond_.notify_all();
+    // Poll until the queue drains. Workers append speculative targets of
+    // their own as they go, which may extend the wait past the seed count.
+    while (true) {
+      size_t remaining;
+      {
+        std::lock_guard<std::mutex> lock(translation_request_lock_);
+        remaining = translation_queue_.size();
+      }
+      if (progress_callback) {
+        progress_callback(total - std::min(total, remaining), total);
+      }
+      if (!remaining) {
+        break;
+      }
+      xe::threading::Sleep(std::chrono::milliseconds(50));
+    }
+  } else {
+    for (size_t i = 0; i < total; ++i) {
+      ResolveFunction(seeds[i]);
+      if (progress_callback && ((i + 1) % 64 == 0 || i + 1 == total)) {
+        progress_callback(i + 1, total);
+      }
+    }
+  }
+}
+
+void Processor::MarkHotFunctions(const std::vector<uint32_t>& addresses) {
+  if (addresses.empty()) {
+    return;
+  }
+  bool queue = !translation_threads_.empty();
+  {
+    std::lock_guard<std::mutex> lock(translation_request_lock_);
+    // The list arrives hottest-first; push in reverse so the front of the
+    // queue ends up in profile order, ahead of any speculative targets.
+    for (auto it = addresses.rbegin(); it != addresses.rend(); ++it) {
+      hot_function_addresses_.insert(*it);
+      if (queue && translation_queued_addresses_.insert(*it).second) {
+        translation_queue_.push_front(*it);
+      }
+    }
+  }
+  if (queue) {
+    translation_request_cond_.notify_all();
+  }
+}
+
 void Processor::PreLaunch() {
   if (cvars::break_on_start) {
     // Start paused.
@@ -229,6 +687,15 @@ Function* Processor::ResolveFunction(uint32_t address) {
       return nullptr;
     }
 
+    // Functions a prior session proved hot skip the baseline tier.
+    if (function->is_guest() && !hot_function_addresses_.empty()) {
+      std::lock_guard<std::mutex> lock(translation_request_lock_);
+      if (hot_function_addresses_.count(address)) {
+        static_cast<GuestFunction*>(function)->set_tier(
+            GuestFunction::Tier::kOptimized);
+      }
+    }
+
     if (!DemandFunction(function)) {
       entry->status = Entry::STATUS_FAILED;
       return nullptr;
@@ -236,6 +703,19 @@ Function* Processor::ResolveFunction(uint32_t address) {
     entry->function = function;
     entry->end_address = function->end_address();
     status = entry->status = Entry::STATUS_READY;
+
+    // Hand anything this function directly calls to the background
+    // translation pool so other threads (or the next call) find it ready.
+    QueueSpeculativeTargets(function);
+
+    // Track baseline-tier functions for the tier-up sweep.
+    if (cvars::tiered_compilation && function->is_guest() &&
+        function->behavior() == Function::Behavior::kDefault &&
+        static_cast<GuestFunction*>(function)->tier() ==
+            GuestFunction::Tier::kBaseline) {
+      std::lock_guard<std::mutex> lock(translation_request_lock_);
+      tier_candidates_.push_back(static_cast<GuestFunction*>(function));
+    }
   }
   if (status == Entry::STATUS_READY) {
     // Ready to use.
@@ -303,6 +783,8 @@ bool Processor::DemandFunction(Function* function) {
 
     // Before we give the symbol back to the rest, let the debugger know.
     OnFunctionDefined(function);
+    count_functions_translated.Increment();
+    StartupTimeline::Mark(StartupTimeline::Phase::kFirstTranslation);
 
     function->set_status(Symbol::Status::kDefined);
     symbol_status = function->status();
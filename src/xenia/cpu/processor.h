@@ -10,14 +10,19 @@
 #ifndef XENIA_CPU_PROCESSOR_H_
 #define XENIA_CPU_PROCESSOR_H_
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "xenia/base/cvar.h"
 #include "xenia/base/mapped_memory.h"
 #include "xenia/base/mutex.h"
+#include "xenia/base/threading.h"
 #include "xenia/cpu/backend/backend.h"
 #include "xenia/cpu/debug_listener.h"
 #include "xenia/cpu/entry_table.h"
@@ -35,6 +40,7 @@ namespace xe {
 namespace cpu {
 
 class Breakpoint;
+class SamplingProfiler;
 class StackWalker;
 class XexModule;
 
@@ -115,6 +121,21 @@ class Processor {
   Function* LookupFunction(Module* module, uint32_t address);
   Function* ResolveFunction(uint32_t address);
 
+  // Translates every function in the given code range reachable from
+  // root_addresses (entry point, exports) over the direct call graph before
+  // returning, using the background translation workers when they are
+  // running. Unreachable functions are left to on-demand translation at the
+  // baseline tier. progress_callback, if provided, is invoked periodically
+  // with (completed, total).
+  void PrecompileRange(uint32_t start_address, uint32_t end_address,
+                       const std::vector<uint32_t>& root_addresses,
+                       std::function<void(size_t, size_t)> progress_callback);
+
+  // Marks guest addresses recorded hot in a previous session's profile:
+  // they are queued for background translation ahead of speculative targets
+  // and translate straight at the optimized tier.
+  void MarkHotFunctions(const std::vector<uint32_t>& addresses);
+
   bool Execute(ThreadState* thread_state, uint32_t address);
   bool ExecuteRaw(ThreadState* thread_state, uint32_t address);
   uint64_t Execute(ThreadState* thread_state, uint32_t address, uint64_t args[],
@@ -236,8 +257,29 @@ class Processor {
 
   bool DemandFunction(Function* function);
 
+  // Starts the background translation worker pool, if enabled.
+  void StartTranslationThreads();
+  // Stops and joins all background translation workers.
+  void StopTranslationThreads();
+  // Worker loop for background translation threads.
+  void TranslationThread();
+  // Queues all direct call targets of the given (just defined) function for
+  // speculative translation on the worker pool.
+  void QueueSpeculativeTargets(Function* function);
+  // Retranslates any baseline-tier functions whose execution counters have
+  // crossed the tier-up threshold. Run by idle translation workers.
+  void SweepTierCandidates();
+  // Retranslates the function through the full optimizing pipeline and
+  // repoints the indirection table at the new code.
+  bool RetranslateFunction(GuestFunction* function);
+  // Frees retired baseline code bodies once enough have accumulated. Runs on
+  // idle translation workers; suspends all guest threads so it can prove by
+  // stack walking that no thread is still executing a body before freeing it.
+  void ReclaimRetiredCode();
+
   Memory* memory_ = nullptr;
   std::unique_ptr<StackWalker> stack_walker_;
+  std::unique_ptr<SamplingProfiler> sampling_profiler_;
 
   std::function<DebugListener*(Processor*)> debug_listener_handler_;
   DebugListener* debug_listener_ = nullptr;
@@ -254,6 +296,31 @@ class Processor {
 
   EntryTable entry_table_;
   xe::global_critical_region global_critical_region_;
+
+  // Background translation worker pool. Workers pull addresses off
+  // translation_queue_ and run them through ResolveFunction, racing the guest
+  // threads to warm the entry table.
+  std::vector<std::unique_ptr<xe::threading::Thread>> translation_threads_;
+  std::deque<uint32_t> translation_queue_;
+  std::unordered_set<uint32_t> translation_queued_addresses_;
+  std::mutex translation_request_lock_;
+  std::condition_variable translation_request_cond_;
+  bool translation_threads_shutdown_ = false;
+  // Baseline-tier functions awaiting promotion, guarded by
+  // translation_request_lock_.
+  std::vector<GuestFunction*> tier_candidates_;
+  // Addresses known hot from a prior session's profile, guarded by
+  // translation_request_lock_.
+  std::unordered_set<uint32_t> hot_function_addresses_;
+  // Baseline code bodies replaced by retranslation, awaiting a safe point at
+  // which no stack references them; guarded by translation_request_lock_.
+  struct RetiredCodeRange {
+    uint8_t* code;
+    size_t length;
+  };
+  std::vector<RetiredCodeRange> retired_code_;
+  size_t retired_code_bytes_ = 0;
+
   ExecutionState execution_state_ = ExecutionState::kPaused;
   std::vector<std::unique_ptr<Module>> modules_;
   Module* builtin_module_ = nullptr;
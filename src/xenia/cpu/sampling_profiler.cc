@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2019 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/cpu/sampling_profiler.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "xenia/base/filesystem.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/math.h"
+#include "xenia/base/string_buffer.h"
+#include "xenia/cpu/processor.h"
+#include "xenia/cpu/stack_walker.h"
+#include "xenia/cpu/thread_debug_info.h"
+
+namespace xe {
+namespace cpu {
+
+SamplingProfiler::SamplingProfiler(Processor* processor)
+    : processor_(processor) {}
+
+SamplingProfiler::~SamplingProfiler() { Stop(); }
+
+bool SamplingProfiler::Start(uint32_t samples_per_second) {
+  if (running_ || !samples_per_second) {
+    return false;
+  }
+  sample_interval_millis_ =
+      std::max(uint32_t(1), uint32_t(1000 / samples_per_second));
+  running_ = true;
+  sampler_thread_ =
+      xe::threading::Thread::Create({}, [this]() { SamplerMain(); });
+  if (!sampler_thread_) {
+    running_ = false;
+    return false;
+  }
+  sampler_thread_->set_name("Stack Sampler");
+  return true;
+}
+
+void SamplingProfiler::Stop() {
+  if (!running_) {
+    return;
+  }
+  running_ = false;
+  xe::threading::Wait(sampler_thread_.get(), true);
+  sampler_thread_.reset();
+}
+
+void SamplingProfiler::SamplerMain() {
+  while (running_) {
+    CollectSamples();
+    xe::threading::Sleep(std::chrono::milliseconds(sample_interval_millis_));
+  }
+}
+
+void SamplingProfiler::CollectSamples() {
+  auto stack_walker = processor_->stack_walker();
+  if (!stack_walker) {
+    return;
+  }
+
+  uint64_t frame_host_pcs[64];
+  StackFrame cpu_frames[64];
+  StringBuffer folded;
+
+  auto global_lock = global_critical_region_.Acquire();
+  for (auto thread_info : processor_->QueryThreadDebugInfos()) {
+    if (thread_info->state != ThreadDebugInfo::State::kAlive) {
+      continue;
+    }
+    auto thread = thread_info->thread;
+    if (!thread || !thread->can_debugger_suspend()) {
+      continue;
+    }
+    auto host_thread = thread->thread();
+    if (!host_thread) {
+      continue;
+    }
+
+    // Keep the thread suspended only for the raw capture; symbolization and
+    // aggregation (which may allocate) run after it has resumed so we can't
+    // deadlock against locks the thread holds.
+    if (!host_thread->Suspend()) {
+      continue;
+    }
+    size_t count = stack_walker->CaptureStackTrace(
+        host_thread->native_handle(), frame_host_pcs, 0,
+        xe::countof(frame_host_pcs), nullptr, nullptr);
+    host_thread->Resume();
+    if (!count) {
+      continue;
+    }
+    stack_walker->ResolveStack(frame_host_pcs, cpu_frames, count);
+
+    // Fold outermost-first, rooted at the thread name.
+    folded.Reset();
+    folded.Append(thread->thread_name().c_str());
+    for (size_t i = count; i > 0; --i) {
+      auto& frame = cpu_frames[i - 1];
+      folded.Append(';');
+      if (frame.type == StackFrame::Type::kGuest) {
+        auto function = frame.guest_symbol.function;
+        if (function && !function->name().empty()) {
+          folded.Append(function->name().c_str());
+        } else {
+          folded.AppendFormat("guest_%.8X", frame.guest_pc);
+        }
+      } else {
+        folded.Append(frame.host_symbol.name[0] ? frame.host_symbol.name
+                                                : "[host]");
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(samples_mutex_);
+    ++folded_stacks_[std::string(folded.GetString(), folded.length())];
+    ++total_sample_count_;
+  }
+}
+
+bool SamplingProfiler::WriteReport(const std::wstring& path) {
+  std::lock_guard<std::mutex> lock(samples_mutex_);
+  FILE* file = xe::filesystem::OpenFile(path, "wb");
+  if (!file) {
+    XELOGE("Unable to open stack sample report for writing");
+    return false;
+  }
+  for (const auto& it : folded_stacks_) {
+    fprintf(file, "%s %" PRIu64 "\n", it.first.c_str(), it.second);
+  }
+  fclose(file);
+  XELOGCPU("Wrote %" PRIu64 " stack samples (%u unique stacks)",
+           total_sample_count_, uint32_t(folded_stacks_.size()));
+  return true;
+}
+
+}  // namespace cpu
+}  // namespace xe
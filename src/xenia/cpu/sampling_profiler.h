@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2019 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_CPU_SAMPLING_PROFILER_H_
+#define XENIA_CPU_SAMPLING_PROFILER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "xenia/base/mutex.h"
+#include "xenia/base/threading.h"
+
+namespace xe {
+namespace cpu {
+
+class Processor;
+
+// Sampling profiler for guest code. A timer thread periodically suspends
+// every guest thread, walks its stack with the existing StackWalker, and
+// aggregates the symbolized stacks by guest function. Stacks are folded into
+// "thread;outermost;...;leaf" strings, so the report is one
+// "stack count" line per unique stack - the collapsed format flame graph
+// tooling consumes directly. This answers "which guest function is hot right
+// now" without attaching an external profiler that only sees raw JIT blob
+// addresses.
+class SamplingProfiler {
+ public:
+  explicit SamplingProfiler(Processor* processor);
+  ~SamplingProfiler();
+
+  // Starts the sampler thread taking the given number of samples per second
+  // across all guest threads.
+  bool Start(uint32_t samples_per_second);
+
+  // Stops the sampler thread. Collected samples are retained and can still
+  // be written out.
+  void Stop();
+
+  // Writes the collected samples as collapsed stacks to the given path.
+  bool WriteReport(const std::wstring& path);
+
+ private:
+  void SamplerMain();
+  void CollectSamples();
+
+  Processor* processor_;
+
+  std::atomic<bool> running_{false};
+  uint32_t sample_interval_millis_ = 10;
+  std::unique_ptr<xe::threading::Thread> sampler_thread_;
+
+  // Held across a sampling pass so guest threads can't be created or
+  // destroyed while their stacks are being walked.
+  xe::global_critical_region global_critical_region_;
+
+  // Folded stack -> number of times it was observed.
+  std::mutex samples_mutex_;
+  std::unordered_map<std::string, uint64_t> folded_stacks_;
+  uint64_t total_sample_count_ = 0;
+};
+
+}  // namespace cpu
+}  // namespace xe
+
+#endif  // XENIA_CPU_SAMPLING_PROFILER_H_
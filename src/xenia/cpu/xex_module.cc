@@ -10,11 +10,14 @@
 #include "xenia/cpu/xex_module.h"
 
 #include <algorithm>
+#include <atomic>
 
 #include "xenia/base/byte_order.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
+#include "xenia/base/thread_pool.h"
 #include "xenia/cpu/cpu_flags.h"
 #include "xenia/cpu/export_resolver.h"
 #include "xenia/cpu/lzx.h"
@@ -26,6 +29,7 @@
 #include "third_party/crypto/rijndael-alg-fst.c"
 #include "third_party/crypto/rijndael-alg-fst.h"
 #include "third_party/pe/pe_image.h"
+#include "third_party/xxhash/xxhash.h"
 
 static const uint8_t xe_xex2_retail_key[16] = {
     0x20, 0xB1, 0x85, 0xA5, 0x9D, 0x28, 0xFD, 0xC3,
@@ -34,12 +38,12 @@ static const uint8_t xe_xex2_devkit_key[16] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-void aes_decrypt_buffer(const uint8_t* session_key, const uint8_t* input_buffer,
-                        const size_t input_size, uint8_t* output_buffer,
-                        const size_t output_size) {
-  uint32_t rk[4 * (MAXNR + 1)];
-  uint8_t ivec[16] = {0};
-  int32_t Nr = rijndaelKeySetupDec(rk, session_key, 128);
+static void aes_decrypt_cbc_run(const uint32_t* rk, int32_t Nr,
+                                const uint8_t* input_buffer,
+                                const size_t input_size,
+                                uint8_t* output_buffer, const uint8_t* iv) {
+  uint8_t ivec[16];
+  std::memcpy(ivec, iv, 16);
   const uint8_t* ct = input_buffer;
   uint8_t* pt = output_buffer;
   for (size_t n = 0; n < input_size; n += 16, ct += 16, pt += 16) {
@@ -54,6 +58,34 @@ void aes_decrypt_buffer(const uint8_t* session_key, const uint8_t* input_buffer,
   }
 }
 
+void aes_decrypt_buffer(const uint8_t* session_key, const uint8_t* input_buffer,
+                        const size_t input_size, uint8_t* output_buffer,
+                        const size_t output_size) {
+  uint32_t rk[4 * (MAXNR + 1)];
+  int32_t Nr = rijndaelKeySetupDec(rk, session_key, 128);
+  static const uint8_t zero_iv[16] = {0};
+  // CBC decryption has no chain dependency - each plaintext block is
+  // D(ct[n]) ^ ct[n-1] - so large basefiles can be split across the pool,
+  // seeding every chunk with the preceding ciphertext block as its IV.
+  const size_t kChunkSize = 1 * 1024 * 1024;
+  if (input_size > kChunkSize) {
+    uint32_t chunk_count =
+        static_cast<uint32_t>((input_size + kChunkSize - 1) / kChunkSize);
+    xe::threading::ThreadPool::shared()->ParallelFor(
+        chunk_count, [&](uint32_t chunk) {
+          size_t offset = chunk * kChunkSize;
+          size_t size = std::min(kChunkSize, input_size - offset);
+          const uint8_t* iv =
+              offset ? input_buffer + offset - 16 : zero_iv;
+          aes_decrypt_cbc_run(rk, Nr, input_buffer + offset, size,
+                              output_buffer + offset, iv);
+        });
+  } else {
+    aes_decrypt_cbc_run(rk, Nr, input_buffer, input_size, output_buffer,
+                        zero_iv);
+  }
+}
+
 namespace xe {
 namespace cpu {
 
@@ -156,6 +188,36 @@ uint32_t XexModule::GetProcAddress(uint16_t ordinal) const {
   return 0;
 }
 
+void XexModule::GetExportAddresses(std::vector<uint32_t>* out_addresses) const {
+  if (xex_security_info()->export_table) {
+    auto export_table = memory()->TranslateVirtual<const xex2_export_table*>(
+        xex_security_info()->export_table);
+    for (uint32_t i = 0; i < export_table->count; ++i) {
+      uint32_t ordinal_offset = export_table->ordOffset[i];
+      if (!ordinal_offset) {
+        continue;
+      }
+      out_addresses->push_back(ordinal_offset +
+                               (export_table->imagebaseaddr << 16));
+    }
+    return;
+  }
+
+  xex2_opt_data_directory* pe_export_directory = 0;
+  if (GetOptHeader(XEX_HEADER_EXPORTS_BY_NAME, &pe_export_directory)) {
+    auto e = memory()->TranslateVirtual<const X_IMAGE_EXPORT_DIRECTORY*>(
+        base_address_ + pe_export_directory->offset);
+    uint32_t* function_table =
+        reinterpret_cast<uint32_t*>(uintptr_t(e) + e->AddressOfFunctions);
+    for (uint32_t i = 0; i < e->NumberOfFunctions; ++i) {
+      if (!function_table[i]) {
+        continue;
+      }
+      out_addresses->push_back(base_address_ + function_table[i]);
+    }
+  }
+}
+
 uint32_t XexModule::GetProcAddress(const char* name) const {
   assert_not_zero(base_address_);
 
@@ -195,6 +257,191 @@ uint32_t XexModule::GetProcAddress(const char* name) const {
   return 0;
 }
 
+void XexModule::RebindSecurityInfo() {
+  if (xex_format_ == kFormatXex1) {
+    const xex1_security_info* xex1_sec_info =
+        reinterpret_cast<const xex1_security_info*>(
+            GetSecurityInfo(xex_header()));
+
+    security_info_.rsa_signature = xex1_sec_info->rsa_signature;
+    security_info_.aes_key = xex1_sec_info->aes_key;
+    security_info_.image_size = xex1_sec_info->image_size;
+    security_info_.image_flags = xex1_sec_info->image_flags;
+    security_info_.export_table = xex1_sec_info->export_table;
+    security_info_.load_address = xex1_sec_info->load_address;
+    security_info_.page_descriptor_count = xex1_sec_info->page_descriptor_count;
+    security_info_.page_descriptors = xex1_sec_info->page_descriptors;
+  } else if (xex_format_ == kFormatXex2) {
+    const xex2_security_info* xex2_sec_info =
+        reinterpret_cast<const xex2_security_info*>(
+            GetSecurityInfo(xex_header()));
+
+    security_info_.rsa_signature = xex2_sec_info->rsa_signature;
+    security_info_.aes_key = xex2_sec_info->aes_key;
+    security_info_.image_size = xex2_sec_info->image_size;
+    security_info_.image_flags = xex2_sec_info->image_flags;
+    security_info_.export_table = xex2_sec_info->export_table;
+    security_info_.load_address = xex2_sec_info->load_address;
+    security_info_.page_descriptor_count = xex2_sec_info->page_descriptor_count;
+    security_info_.page_descriptors = xex2_sec_info->page_descriptors;
+  }
+}
+
+namespace {
+
+// On-disk layout of a cached patched basefile image: this header, then the
+// patched XEX header, then the patched image bytes.
+struct PatchCacheFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t base_key;
+  uint64_t patch_key;
+  uint32_t header_size;
+  uint32_t image_size;
+};
+const uint32_t kPatchCacheFileMagic = 0x43505058;  // 'XPPC'
+const uint32_t kPatchCacheFileVersion = 1;
+
+}  // namespace
+
+std::wstring XexModule::patch_cache_path(uint64_t base_key,
+                                         uint64_t patch_key) {
+  auto file_name =
+      xe::format_string(L"%.16llX_%.16llX.xexpatch", base_key, patch_key);
+  return xe::join_paths(xe::to_wstring(cvars::xex_patch_cache_dir), file_name);
+}
+
+bool XexModule::ApplyPatchFromCache(XexModule* module, uint64_t base_key,
+                                    uint64_t patch_key) {
+  FILE* file =
+      xe::filesystem::OpenFile(patch_cache_path(base_key, patch_key), "rb");
+  if (!file) {
+    return false;
+  }
+  PatchCacheFileHeader file_header;
+  if (fread(&file_header, sizeof(file_header), 1, file) != 1 ||
+      file_header.magic != kPatchCacheFileMagic ||
+      file_header.version != kPatchCacheFileVersion ||
+      file_header.base_key != base_key ||
+      file_header.patch_key != patch_key ||
+      file_header.header_size < sizeof(xex2_header) ||
+      !file_header.image_size) {
+    fclose(file);
+    return false;
+  }
+
+  // Read everything into temporary storage first so a truncated or corrupt
+  // cache file never leaves the base module half-overwritten.
+  std::vector<uint8_t> header_mem(file_header.header_size);
+  std::vector<uint8_t> image_mem(file_header.image_size);
+  if (fread(header_mem.data(), 1, header_mem.size(), file) !=
+          header_mem.size() ||
+      fread(image_mem.data(), 1, image_mem.size(), file) != image_mem.size()) {
+    fclose(file);
+    return false;
+  }
+  fclose(file);
+
+  uint32_t original_image_size = module->image_size();
+
+  // Install the patched header; keep the previous one around so a bad cache
+  // entry can be rolled back and the delta path can run instead.
+  std::vector<uint8_t> previous_header_mem;
+  previous_header_mem.swap(module->xex_header_mem_);
+  module->xex_header_mem_ = std::move(header_mem);
+  module->RebindSecurityInfo();
+
+  // The restored header must describe exactly the image that was captured.
+  uint32_t new_image_size = module->image_size();
+  if (new_image_size != file_header.image_size) {
+    XELOGW("XEX patch cache entry is inconsistent, reapplying patch");
+    module->xex_header_mem_ = std::move(previous_header_mem);
+    module->RebindSecurityInfo();
+    return false;
+  }
+
+  // Check if we need to alloc new memory for the patched xex
+  if (new_image_size > original_image_size) {
+    uint32_t size_delta = new_image_size - original_image_size;
+    uint32_t addr_new_mem = module->base_address_ + original_image_size;
+
+    bool alloc_result =
+        memory()
+            ->LookupHeap(addr_new_mem)
+            ->AllocFixed(
+                addr_new_mem, size_delta, 4096,
+                xe::kMemoryAllocationReserve | xe::kMemoryAllocationCommit,
+                xe::kMemoryProtectRead | xe::kMemoryProtectWrite);
+    if (!alloc_result) {
+      XELOGE("Unable to allocate XEX memory at %.8X-%.8X.", addr_new_mem,
+             size_delta);
+      module->xex_header_mem_ = std::move(previous_header_mem);
+      module->RebindSecurityInfo();
+      return false;
+    }
+  }
+
+  uint8_t* base_exe = memory()->TranslateVirtual(module->base_address_);
+  std::memcpy(base_exe, image_mem.data(), new_image_size);
+
+  // Decommit unused pages if new image size is smaller than original
+  if (original_image_size > new_image_size) {
+    uint32_t size_delta = original_image_size - new_image_size;
+    uint32_t addr_free_mem = module->base_address_ + new_image_size;
+
+    bool free_result = memory()
+                           ->LookupHeap(addr_free_mem)
+                           ->Decommit(addr_free_mem, size_delta);
+    if (!free_result) {
+      XELOGE("Unable to decommit XEX memory at %.8X-%.8X.", addr_free_mem,
+             size_delta);
+      assert_always();
+    }
+  }
+
+  // The restored header carries the new base XEX key; rederive the session
+  // keys the same way the delta path does.
+  aes_decrypt_buffer(
+      module->is_dev_kit_ ? xe_xex2_devkit_key : xe_xex2_retail_key,
+      reinterpret_cast<const uint8_t*>(module->xex_security_info()->aes_key),
+      16, module->session_key_, 16);
+  aes_decrypt_buffer(
+      module->session_key_,
+      reinterpret_cast<const uint8_t*>(xex_security_info()->aes_key), 16,
+      session_key_, 16);
+
+  XELOGI("XEX patch restored from cache (%u byte image)", new_image_size);
+  return true;
+}
+
+void XexModule::SavePatchToCache(XexModule* module, uint64_t base_key,
+                                 uint64_t patch_key, uint32_t image_size) {
+  xe::filesystem::CreateFolder(xe::to_wstring(cvars::xex_patch_cache_dir));
+  FILE* file =
+      xe::filesystem::OpenFile(patch_cache_path(base_key, patch_key), "wb");
+  if (!file) {
+    return;
+  }
+  PatchCacheFileHeader file_header;
+  file_header.magic = kPatchCacheFileMagic;
+  file_header.version = kPatchCacheFileVersion;
+  file_header.base_key = base_key;
+  file_header.patch_key = patch_key;
+  file_header.header_size = uint32_t(module->xex_header_mem_.size());
+  file_header.image_size = image_size;
+  const uint8_t* base_exe = memory()->TranslateVirtual(module->base_address_);
+  bool written =
+      fwrite(&file_header, sizeof(file_header), 1, file) == 1 &&
+      fwrite(module->xex_header_mem_.data(), 1, module->xex_header_mem_.size(),
+             file) == module->xex_header_mem_.size() &&
+      fwrite(base_exe, 1, image_size, file) == image_size;
+  fclose(file);
+  if (!written) {
+    // Never leave a truncated entry behind for the next launch to trust.
+    xe::filesystem::DeleteFile(patch_cache_path(base_key, patch_key));
+  }
+}
+
 int XexModule::ApplyPatch(XexModule* module) {
   if (!is_patch()) {
     // This isn't a XEX2 patch.
@@ -219,6 +466,22 @@ int XexModule::ApplyPatch(XexModule* module) {
         "will likely fail!");
   }
 
+  // With a patch cache directory set, a fully patched base image saved by an
+  // earlier launch can be restored directly, skipping delta application.
+  // Both keys must be computed before patching mutates the base header.
+  uint64_t patch_cache_base_key = 0;
+  uint64_t patch_cache_patch_key = 0;
+  if (!cvars::xex_patch_cache_dir.empty()) {
+    patch_cache_base_key =
+        XXH64(module->xex_security_info()->rsa_signature, 0x100, 0);
+    patch_cache_patch_key =
+        XXH64(xexp_data_mem_.data(), xexp_data_mem_.size(), 0);
+    if (ApplyPatchFromCache(module, patch_cache_base_key,
+                            patch_cache_patch_key)) {
+      return 0;
+    }
+  }
+
   uint32_t size = module->xex_header()->header_size;
   if (patch_header->delta_headers_source_offset > size) {
     XELOGE("XEX header patch source is outside base XEX header area");
@@ -457,6 +720,11 @@ int XexModule::ApplyPatch(XexModule* module) {
         "version: %d.%d.%d.%d",
         source_ver.major, source_ver.minor, source_ver.build, source_ver.qfe,
         target_ver.major, target_ver.minor, target_ver.build, target_ver.qfe);
+
+    if (!cvars::xex_patch_cache_dir.empty()) {
+      SavePatchToCache(module, patch_cache_base_key, patch_cache_patch_key,
+                       new_image_size);
+    }
   } else {
     XELOGE("XEX patch application failed, error code %d", result_code);
   }
@@ -669,7 +937,6 @@ int XexModule::ReadImageCompressed(const void* xex_addr, size_t xex_length) {
   uint8_t* compress_buffer = NULL;
   const uint8_t* p = NULL;
   uint8_t* d = NULL;
-  sha1::SHA1 s;
 
   // Decrypt (if needed).
   bool free_input = false;
@@ -704,38 +971,68 @@ int XexModule::ReadImageCompressed(const void* xex_addr, size_t xex_length) {
   // De-block.
   int result_code = 0;
 
-  uint8_t block_calced_digest[0x14];
+  // Walk the block chain once to collect extents (each block's header lives
+  // at the start of the previous block, so the walk itself is serial but
+  // cheap), then verify the SHA-1 of every block in parallel - hashing is
+  // the bulk of the de-blocking cost on large basefiles. The LZX stream
+  // itself is a single sliding-window stream and must be decoded serially.
+  struct BlockExtent {
+    const uint8_t* data;
+    uint32_t size;
+    const uint8_t* expected_digest;
+  };
+  std::vector<BlockExtent> block_extents;
+  const uint8_t* input_end = input_buffer + input_size;
   while (cur_block->block_size) {
-    const uint8_t* pnext = p + cur_block->block_size;
-    const auto* next_block = (const xex2_compressed_block_info*)p;
-
-    // Compare block hash, if no match we probably used wrong decrypt key
-    s.reset();
-    s.processBytes(p, cur_block->block_size);
-    s.finalize(block_calced_digest);
-    if (memcmp(block_calced_digest, cur_block->block_hash, 0x14) != 0) {
+    // Block sizes are untrusted until the hash pass below has run - with the
+    // wrong decrypt key every chained header is garbage - so bound each step
+    // to the input extent before dereferencing the next header. Each block
+    // must at least hold the header of its successor.
+    if (cur_block->block_size > size_t(input_end - p) ||
+        cur_block->block_size < sizeof(xex2_compressed_block_info)) {
       result_code = 2;
       break;
     }
+    block_extents.push_back({p, cur_block->block_size, cur_block->block_hash});
+    const auto* next_block = (const xex2_compressed_block_info*)p;
+    p += cur_block->block_size;
+    cur_block = next_block;
+  }
 
-    // skip block info
-    p += 4;
-    p += 20;
+  if (!result_code) {
+    std::atomic<bool> hash_mismatch(false);
+    xe::threading::ThreadPool::shared()->ParallelFor(
+        static_cast<uint32_t>(block_extents.size()), [&](uint32_t index) {
+          const auto& block = block_extents[index];
+          sha1::SHA1 block_sha;
+          uint8_t block_calced_digest[0x14];
+          block_sha.processBytes(block.data, block.size);
+          block_sha.finalize(block_calced_digest);
+          if (memcmp(block_calced_digest, block.expected_digest, 0x14) != 0) {
+            // No match - we probably used the wrong decrypt key.
+            hash_mismatch = true;
+          }
+        });
+    if (hash_mismatch) {
+      result_code = 2;
+    } else {
+      for (const auto& block : block_extents) {
+        // skip block info
+        p = block.data + 4 + 20;
+
+        while (true) {
+          const size_t chunk_size = (p[0] << 8) | p[1];
+          p += 2;
+          if (!chunk_size) {
+            break;
+          }
 
-    while (true) {
-      const size_t chunk_size = (p[0] << 8) | p[1];
-      p += 2;
-      if (!chunk_size) {
-        break;
+          memcpy(d, p, chunk_size);
+          p += chunk_size;
+          d += chunk_size;
+        }
       }
-
-      memcpy(d, p, chunk_size);
-      p += chunk_size;
-      d += chunk_size;
     }
-
-    p = pnext;
-    cur_block = next_block;
   }
 
   if (!result_code) {
@@ -884,33 +1181,7 @@ bool XexModule::Load(const std::string& name, const std::string& path,
   xex_header_mem_.resize(src_header->header_size);
   std::memcpy(xex_header_mem_.data(), src_header, src_header->header_size);
 
-  if (xex_format_ == kFormatXex1) {
-    const xex1_security_info* xex1_sec_info =
-        reinterpret_cast<const xex1_security_info*>(
-            GetSecurityInfo(xex_header()));
-
-    security_info_.rsa_signature = xex1_sec_info->rsa_signature;
-    security_info_.aes_key = xex1_sec_info->aes_key;
-    security_info_.image_size = xex1_sec_info->image_size;
-    security_info_.image_flags = xex1_sec_info->image_flags;
-    security_info_.export_table = xex1_sec_info->export_table;
-    security_info_.load_address = xex1_sec_info->load_address;
-    security_info_.page_descriptor_count = xex1_sec_info->page_descriptor_count;
-    security_info_.page_descriptors = xex1_sec_info->page_descriptors;
-  } else if (xex_format_ == kFormatXex2) {
-    const xex2_security_info* xex2_sec_info =
-        reinterpret_cast<const xex2_security_info*>(
-            GetSecurityInfo(xex_header()));
-
-    security_info_.rsa_signature = xex2_sec_info->rsa_signature;
-    security_info_.aes_key = xex2_sec_info->aes_key;
-    security_info_.image_size = xex2_sec_info->image_size;
-    security_info_.image_flags = xex2_sec_info->image_flags;
-    security_info_.export_table = xex2_sec_info->export_table;
-    security_info_.load_address = xex2_sec_info->load_address;
-    security_info_.page_descriptor_count = xex2_sec_info->page_descriptor_count;
-    security_info_.page_descriptors = xex2_sec_info->page_descriptors;
-  }
+  RebindSecurityInfo();
 
   auto sec_header = xex_security_info();
 
@@ -1043,6 +1314,9 @@ bool XexModule::LoadContinue() {
     if (!ReadMap(cvars::load_module_map.c_str())) {
       return false;
     }
+    if (cvars::substitute_crt_memory_routines) {
+      SubstituteCrtMemoryRoutines();
+    }
   }
 
   // Setup memory protection.
@@ -1066,15 +1340,151 @@ bool XexModule::LoadContinue() {
     page += desc.page_count;
   }
 
+  // Restore translated code from a previous run, if persistence is enabled.
+  if (!cvars::code_cache_dir.empty() && !is_patch()) {
+    processor_->backend()->code_cache()->LoadCache(code_cache_path(),
+                                                   code_cache_key());
+  }
+
+  // Warm the previous session's hot set ahead of everything else.
+  if (!cvars::function_profile_dir.empty() && !is_patch()) {
+    LoadFunctionProfile();
+  }
+
   return true;
 }
 
+uint64_t XexModule::code_cache_key() const {
+  // The RSA signature covers the digest chain over all headers and pages, so
+  // it uniquely identifies the exact image, including applied patches.
+  return XXH64(security_info_.rsa_signature, 0x100, 0);
+}
+
+std::wstring XexModule::code_cache_path() const {
+  auto file_name = xe::format_string(L"%.16llX.codecache", code_cache_key());
+  return xe::join_paths(xe::to_wstring(cvars::code_cache_dir), file_name);
+}
+
+namespace {
+
+// On-disk layout of the per-title execution profile.
+struct ProfileFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t key;
+  uint32_t entry_count;
+  uint32_t reserved;
+};
+struct ProfileFileEntry {
+  uint32_t address;
+  uint32_t count;
+};
+const uint32_t kProfileFileMagic = 0x46525058;  // 'XPRF'
+const uint32_t kProfileFileVersion = 1;
+
+}  // namespace
+
+std::wstring XexModule::function_profile_path() const {
+  auto file_name = xe::format_string(L"%.16llX.profile", code_cache_key());
+  return xe::join_paths(xe::to_wstring(cvars::function_profile_dir),
+                        file_name);
+}
+
+void XexModule::LoadFunctionProfile() {
+  FILE* file = xe::filesystem::OpenFile(function_profile_path(), "rb");
+  if (!file) {
+    // First session with this title; nothing learned yet.
+    return;
+  }
+  ProfileFileHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      header.magic != kProfileFileMagic ||
+      header.version != kProfileFileVersion ||
+      header.key != code_cache_key() || !header.entry_count) {
+    XELOGW("Ignoring mismatched function profile");
+    fclose(file);
+    return;
+  }
+  std::vector<ProfileFileEntry> entries(header.entry_count);
+  if (fread(entries.data(), sizeof(ProfileFileEntry), entries.size(), file) !=
+      entries.size()) {
+    fclose(file);
+    return;
+  }
+  fclose(file);
+
+  // Entries were written hottest-first; preserve that order for warmup.
+  std::vector<uint32_t> addresses;
+  addresses.reserve(entries.size());
+  for (auto& entry : entries) {
+    if (entry.address >= low_address_ && entry.address < high_address_) {
+      addresses.push_back(entry.address);
+    }
+  }
+  XELOGCPU("Warming %u hot functions from the previous session",
+           uint32_t(addresses.size()));
+  processor_->MarkHotFunctions(addresses);
+}
+
+void XexModule::SaveFunctionProfile() {
+  std::vector<ProfileFileEntry> entries;
+  ForEachFunction([&entries](Function* function) {
+    if (!function->is_guest()) {
+      return;
+    }
+    auto count = static_cast<GuestFunction*>(function)->execution_count();
+    if (!count) {
+      return;
+    }
+    ProfileFileEntry entry = {function->address(), count};
+    entries.push_back(entry);
+  });
+  if (entries.empty()) {
+    return;
+  }
+  // Hottest first, so loading can just walk the list in order.
+  std::sort(entries.begin(), entries.end(),
+            [](const ProfileFileEntry& a, const ProfileFileEntry& b) {
+              return a.count > b.count;
+            });
+
+  ProfileFileHeader header = {};
+  header.magic = kProfileFileMagic;
+  header.version = kProfileFileVersion;
+  header.key = code_cache_key();
+  header.entry_count = uint32_t(entries.size());
+
+  FILE* file = xe::filesystem::OpenFile(function_profile_path(), "wb");
+  if (!file) {
+    XELOGE("Unable to open function profile for writing");
+    return;
+  }
+  fwrite(&header, sizeof(header), 1, file);
+  fwrite(entries.data(), sizeof(ProfileFileEntry), entries.size(), file);
+  fclose(file);
+  XELOGCPU("Saved execution profile covering %u functions",
+           header.entry_count);
+}
+
 bool XexModule::Unload() {
   if (!loaded_) {
     return true;
   }
   loaded_ = false;
 
+  // Persist everything translated this run for the next launch.
+  if (!cvars::code_cache_dir.empty() && !is_patch() && finished_load_) {
+    xe::filesystem::CreateFolder(xe::to_wstring(cvars::code_cache_dir));
+    processor_->backend()->code_cache()->SaveCache(code_cache_path(),
+                                                   code_cache_key());
+  }
+
+  // Remember which functions ran hottest for the next launch.
+  if (!cvars::function_profile_dir.empty() && !is_patch() && finished_load_) {
+    xe::filesystem::CreateFolder(xe::to_wstring(cvars::function_profile_dir));
+    SaveFunctionProfile();
+  }
+
   // If this isn't a patch, just deallocate the memory occupied by the exe
   if (!is_patch()) {
     assert_not_zero(base_address_);
@@ -1089,9 +1499,11 @@ bool XexModule::Unload() {
 
 bool XexModule::SetupLibraryImports(const char* name,
                                     const xex2_import_library* library) {
-  ExportResolver* kernel_resolver = nullptr;
+  // Resolve the kernel export table once up front; lookups inside the import
+  // loop below are then direct ordinal indexing.
+  const ExportResolver::Table* kernel_table = nullptr;
   if (kernel_state_->IsKernelModule(name)) {
-    kernel_resolver = processor_->export_resolver();
+    kernel_table = processor_->export_resolver()->GetTable(name);
   }
 
   auto user_module = kernel_state_->GetModule(name);
@@ -1124,8 +1536,8 @@ bool XexModule::SetupLibraryImports(const char* name,
     Export* kernel_export = nullptr;
     uint32_t user_export_addr = 0;
 
-    if (kernel_resolver) {
-      kernel_export = kernel_resolver->GetExportByOrdinal(name, ordinal);
+    if (kernel_table) {
+      kernel_export = kernel_table->GetExportByOrdinal(ordinal);
     } else if (user_module) {
       user_export_addr = user_module->GetProcAddressByOrdinal(ordinal);
     }
@@ -1277,6 +1689,80 @@ std::unique_ptr<Function> XexModule::CreateFunction(uint32_t address) {
       processor_->backend()->CreateGuestFunction(this, address));
 }
 
+namespace {
+
+// Host substitutes for the title's statically-linked CRT memory routines.
+// Calling conventions match the guest originals: r3 = dest, r4 = src/fill,
+// r5 = count, result in r3 (already the dest on entry, so the handlers only
+// touch memory). Lengths are guest 32-bit sizes.
+
+void CrtMemcpyHandler(ppc::PPCContext* ppc_context,
+                      kernel::KernelState* kernel_state) {
+  uint32_t dest = uint32_t(ppc_context->r[3]);
+  uint32_t src = uint32_t(ppc_context->r[4]);
+  uint32_t count = uint32_t(ppc_context->r[5]);
+  if (count) {
+    std::memcpy(ppc_context->virtual_membase + dest,
+                ppc_context->virtual_membase + src, count);
+  }
+}
+
+void CrtMemmoveHandler(ppc::PPCContext* ppc_context,
+                       kernel::KernelState* kernel_state) {
+  uint32_t dest = uint32_t(ppc_context->r[3]);
+  uint32_t src = uint32_t(ppc_context->r[4]);
+  uint32_t count = uint32_t(ppc_context->r[5]);
+  if (count) {
+    std::memmove(ppc_context->virtual_membase + dest,
+                 ppc_context->virtual_membase + src, count);
+  }
+}
+
+void CrtMemsetHandler(ppc::PPCContext* ppc_context,
+                      kernel::KernelState* kernel_state) {
+  uint32_t dest = uint32_t(ppc_context->r[3]);
+  uint32_t value = uint32_t(ppc_context->r[4]);
+  uint32_t count = uint32_t(ppc_context->r[5]);
+  if (count) {
+    std::memset(ppc_context->virtual_membase + dest, value, count);
+  }
+}
+
+}  // namespace
+
+void XexModule::SubstituteCrtMemoryRoutines() {
+  // Identified the same way kernel imports are patched: the body is replaced
+  // with sc+blr and the function dispatches to an extern handler. This runs
+  // before the section protections are applied, while the code pages are
+  // still writable.
+  static const struct {
+    const char* name;
+    GuestFunction::ExternHandler handler;
+  } kRoutines[] = {
+      {"memcpy", CrtMemcpyHandler},
+      {"memmove", CrtMemmoveHandler},
+      {"memset", CrtMemsetHandler},
+  };
+  ForEachFunction([this](Function* function) {
+    for (const auto& routine : kRoutines) {
+      if (function->name() != routine.name) {
+        continue;
+      }
+      if (function->status() != Symbol::Status::kDeclared) {
+        // Already defined (or failed); too late to swap the body out.
+        continue;
+      }
+      uint8_t* p = memory()->TranslateVirtual(function->address());
+      xe::store_and_swap<uint32_t>(p + 0x0, 0x44000002);  // sc
+      xe::store_and_swap<uint32_t>(p + 0x4, 0x4E800020);  // blr
+      function->set_end_address(function->address() + 4);
+      static_cast<GuestFunction*>(function)->SetupExtern(routine.handler);
+      XELOGI("Substituted host %s for guest code at %.8X", routine.name,
+             function->address());
+    }
+  });
+}
+
 bool XexModule::FindSaveRest() {
   // Special stack save/restore functions.
   // http://research.microsoft.com/en-us/um/redmond/projects/invisible/src/crt/md/ppc/xxx.s.htm
@@ -106,6 +106,10 @@ class XexModule : public xe::cpu::Module {
   const uint32_t base_address() const { return base_address_; }
   const bool is_dev_kit() const { return is_dev_kit_; }
 
+  // Bounds of the code sections; only valid once loading has finished.
+  uint32_t low_address() const { return low_address_; }
+  uint32_t high_address() const { return high_address_; }
+
   // Gets an optional header. Returns NULL if not found.
   // Special case: if key & 0xFF == 0x00, this function will return the value,
   // not a pointer! This assumes out_ptr points to uint32_t.
@@ -134,6 +138,10 @@ class XexModule : public xe::cpu::Module {
   uint32_t GetProcAddress(uint16_t ordinal) const;
   uint32_t GetProcAddress(const char* name) const;
 
+  // Appends the guest address of every exported function, from the xex2
+  // export table when present or the PE export directory otherwise.
+  void GetExportAddresses(std::vector<uint32_t>* out_addresses) const;
+
   int ApplyPatch(XexModule* module);
   bool Load(const std::string& name, const std::string& path,
             const void* xex_addr, size_t xex_length);
@@ -181,6 +189,34 @@ class XexModule : public xe::cpu::Module {
                            const xex2_import_library* library);
   bool FindSaveRest();
 
+  // Redirects the title's statically-linked CRT memory routines to host
+  // implementations. Requires the routines to be identified by name first
+  // (via --load_module_map).
+  void SubstituteCrtMemoryRoutines();
+
+  // Key and file path for the persistent code cache (--code_cache_dir).
+  uint64_t code_cache_key() const;
+  std::wstring code_cache_path() const;
+
+  // Per-title execution profile (--function_profile_dir): hottest functions
+  // from the previous session, warmed first on the next launch.
+  std::wstring function_profile_path() const;
+  void LoadFunctionProfile();
+  void SaveFunctionProfile();
+
+  // Points security_info_ at the security info inside the current header
+  // buffer. Must be called again whenever xex_header_mem_ is replaced.
+  void RebindSecurityInfo();
+
+  // Cache of fully patched base images (--xex_patch_cache_dir), keyed by the
+  // base image and patch digests. Called on the patch module, like
+  // ApplyPatch, with the base module as the target.
+  static std::wstring patch_cache_path(uint64_t base_key, uint64_t patch_key);
+  bool ApplyPatchFromCache(XexModule* module, uint64_t base_key,
+                           uint64_t patch_key);
+  void SavePatchToCache(XexModule* module, uint64_t base_key,
+                        uint64_t patch_key, uint32_t image_size);
+
   Processor* processor_ = nullptr;
   kernel::KernelState* kernel_state_ = nullptr;
   std::string name_;
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <map>
 #include <utility>
 
 #include "third_party/capstone/include/capstone/capstone.h"
@@ -19,6 +20,7 @@
 #include "third_party/imgui/imgui_internal.h"
 #include "third_party/yaml-cpp/include/yaml-cpp/yaml.h"
 #include "xenia/base/clock.h"
+#include "xenia/base/frame_timeline.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/platform.h"
@@ -195,6 +197,9 @@ void DebugWindow::DrawFrame() {
   ImGui::SameLine();
   ImGui::RadioButton("Memory", &state_.right_pane_tab,
                      ImState::kRightPaneMemory);
+  ImGui::SameLine();
+  ImGui::RadioButton("Timeline", &state_.right_pane_tab,
+                     ImState::kRightPaneTimeline);
   ImGui::EndGroup();
   ImGui::Separator();
   switch (state_.right_pane_tab) {
@@ -208,6 +213,11 @@ void DebugWindow::DrawFrame() {
       DrawMemoryPane();
       ImGui::EndChild();
       break;
+    case ImState::kRightPaneTimeline:
+      ImGui::BeginChild("##timeline_pane");
+      DrawTimelinePane();
+      ImGui::EndChild();
+      break;
   }
   ImGui::EndChild();
   ImGui::InvisibleButton("##hsplitter0", ImVec2(-1, kSplitterWidth));
@@ -989,6 +999,11 @@ void DebugWindow::DrawRegistersPane() {
 }
 
 void DebugWindow::DrawThreadsPane() {
+  // Snapshot the wait record ring once per frame; records are aggregated per
+  // thread below so each expanded header can attribute its recent stalls.
+  auto wait_records = emulator_->kernel_state()->CaptureWaitRecords();
+  double wait_ms_per_tick =
+      1000.0 / double(Clock::QueryHostTickFrequency());
   ImGui::BeginGroup();
   //   checkbox to show host threads
   //   expand all toggle
@@ -1082,6 +1097,67 @@ void DebugWindow::DrawThreadsPane() {
         }
       }
       ImGui::Unindent();
+      // Aggregate this thread's recent blocking waits by object so the
+      // dominant stall sources (and who relieved them) are visible at a
+      // glance.
+      struct WaitSummary {
+        uint32_t object_type;
+        uint32_t count;
+        uint64_t total_ticks;
+        uint32_t last_signaler;
+      };
+      std::map<uint32_t, WaitSummary> wait_summaries;
+      for (auto& record : wait_records) {
+        if (record.thread_id != thread_info->thread_id) {
+          continue;
+        }
+        auto& summary = wait_summaries[record.object_handle];
+        summary.object_type = record.object_type;
+        ++summary.count;
+        summary.total_ticks += record.duration_ticks;
+        if (record.signaler_thread_id) {
+          summary.last_signaler = record.signaler_thread_id;
+        }
+      }
+      if (!wait_summaries.empty()) {
+        ImGui::BulletText("Recent Waits");
+        ImGui::Indent();
+        for (auto& it : wait_summaries) {
+          const char* type_name = "object";
+          switch (XObject::Type(it.second.object_type)) {
+            case XObject::kTypeEvent:
+              type_name = "event";
+              break;
+            case XObject::kTypeFile:
+              type_name = "file";
+              break;
+            case XObject::kTypeMutant:
+              type_name = "mutant";
+              break;
+            case XObject::kTypeSemaphore:
+              type_name = "semaphore";
+              break;
+            case XObject::kTypeThread:
+              type_name = "thread";
+              break;
+            case XObject::kTypeTimer:
+              type_name = "timer";
+              break;
+            default:
+              break;
+          }
+          auto object = emulator_->kernel_state()
+                            ->object_table()
+                            ->LookupObject<XObject>(it.first);
+          ImGui::Text("%-9s hnd=%.4X %9.3fms x%-4u by=%.4X  %s", type_name,
+                      it.first, it.second.total_ticks * wait_ms_per_tick,
+                      it.second.count, it.second.last_signaler,
+                      object && !object->name().empty()
+                          ? object->name().c_str()
+                          : "");
+        }
+        ImGui::Unindent();
+      }
     }
     ImGui::PopStyleColor();
     ImGui::PopID();
@@ -1096,6 +1172,73 @@ void DebugWindow::DrawMemoryPane() {
   // https://github.com/ocornut/imgui/wiki/memory_editor_example
 }
 
+void DebugWindow::DrawTimelinePane() {
+  // One row per recent guest frame, newest first, with each leg of the
+  // frame's journey from input polling to the display as a duration.
+  FrameTimeline::Frame frames[FrameTimeline::kFrameCount];
+  size_t frame_count = FrameTimeline::CopyFrames(frames, xe::countof(frames));
+  if (!frame_count) {
+    ImGui::Text("No frames have been recorded yet.");
+    return;
+  }
+  double ms_per_tick = 1000.0 / double(Clock::QueryHostTickFrequency());
+  auto format_delta = [ms_per_tick](char* buffer, size_t buffer_count,
+                                    uint64_t from_tick, uint64_t to_tick) {
+    if (!from_tick || !to_tick || to_tick < from_tick) {
+      std::snprintf(buffer, buffer_count, "-");
+      return;
+    }
+    std::snprintf(buffer, buffer_count, "%.2fms",
+                  double(to_tick - from_tick) * ms_per_tick);
+  };
+  ImGui::Columns(6);
+  ImGui::Text("frame");
+  ImGui::NextColumn();
+  // Guest production time - from the previous swap to this frame's swap.
+  ImGui::Text("cpu");
+  ImGui::NextColumn();
+  // From the swap to the observed GPU completion of the frame's submissions.
+  ImGui::Text("gpu");
+  ImGui::NextColumn();
+  // From the swap to the host picking the frame up for presentation.
+  ImGui::Text("present");
+  ImGui::NextColumn();
+  // The headline number - from the last input poll the frame could reflect
+  // to its presentation.
+  ImGui::Text("input-photon");
+  ImGui::NextColumn();
+  ImGui::NextColumn();
+  ImGui::Separator();
+  char delta[32];
+  for (size_t i = frame_count; i != 0; --i) {
+    const FrameTimeline::Frame& frame = frames[i - 1];
+    ImGui::Text("%" PRIu64, frame.frame_id);
+    ImGui::NextColumn();
+    format_delta(delta, xe::countof(delta), frame.guest_start_tick,
+                 frame.guest_swap_tick);
+    ImGui::Text("%s", delta);
+    ImGui::NextColumn();
+    format_delta(delta, xe::countof(delta), frame.guest_swap_tick,
+                 frame.gpu_completed_tick);
+    ImGui::Text("%s", delta);
+    ImGui::NextColumn();
+    format_delta(delta, xe::countof(delta), frame.guest_swap_tick,
+                 frame.present_tick);
+    ImGui::Text("%s", delta);
+    ImGui::NextColumn();
+    format_delta(delta, xe::countof(delta), frame.input_poll_tick,
+                 frame.present_tick);
+    ImGui::Text("%s", delta);
+    ImGui::NextColumn();
+    if (!frame.present_tick) {
+      // The newest frame may simply not have reached the display yet.
+      ImGui::Text("%s", i == frame_count ? "pending" : "dropped");
+    }
+    ImGui::NextColumn();
+  }
+  ImGui::Columns(1);
+}
+
 void DebugWindow::DrawBreakpointsPane() {
   auto& state = state_.breakpoints;
 
@@ -21,8 +21,11 @@
 #include "xenia/base/exception_handler.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/mapped_memory.h"
+#include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/startup_timeline.h"
 #include "xenia/base/string.h"
+#include "xenia/base/thread_pool.h"
 #include "xenia/cpu/backend/code_cache.h"
 #include "xenia/cpu/backend/x64/x64_backend.h"
 #include "xenia/cpu/cpu_flags.h"
@@ -113,6 +116,8 @@ X_STATUS Emulator::Setup(
         input_driver_factory) {
   X_STATUS result = X_STATUS_UNSUCCESSFUL;
 
+  StartupTimeline::Begin();
+
   display_window_ = display_window;
 
   // Initialize clock.
@@ -159,54 +164,83 @@ X_STATUS Emulator::Setup(
     return X_STATUS_UNSUCCESSFUL;
   }
 
-  // Initialize the APU.
-  if (audio_system_factory) {
-    audio_system_ = audio_system_factory(processor_.get());
-    if (!audio_system_) {
-      return X_STATUS_NOT_IMPLEMENTED;
+  // The APU, GPU, and HID don't depend on each other until they are bound to
+  // the kernel state below, and their device creation/enumeration dominates
+  // startup time - bring them up on parallel tasks. The calling thread
+  // participates, so this makes progress even on a busy pool.
+  X_STATUS create_results[3] = {X_STATUS_SUCCESS, X_STATUS_SUCCESS,
+                                X_STATUS_SUCCESS};
+  xe::threading::ThreadPool::shared()->ParallelFor(3, [&](uint32_t index) {
+    switch (index) {
+      case 0: {
+        // Initialize the APU.
+        if (audio_system_factory) {
+          audio_system_ = audio_system_factory(processor_.get());
+          if (!audio_system_) {
+            create_results[0] = X_STATUS_NOT_IMPLEMENTED;
+          }
+        }
+        break;
+      }
+      case 1: {
+        // Initialize the GPU.
+        graphics_system_ = graphics_system_factory();
+        if (!graphics_system_) {
+          create_results[1] = X_STATUS_NOT_IMPLEMENTED;
+        }
+        break;
+      }
+      case 2: {
+        // Initialize the HID.
+        input_system_ = std::make_unique<xe::hid::InputSystem>(display_window_);
+        if (!input_system_) {
+          create_results[2] = X_STATUS_NOT_IMPLEMENTED;
+          break;
+        }
+        if (input_driver_factory) {
+          auto input_drivers = input_driver_factory(display_window_);
+          for (size_t i = 0; i < input_drivers.size(); ++i) {
+            input_system_->AddDriver(std::move(input_drivers[i]));
+          }
+        }
+        create_results[2] = input_system_->Setup();
+        break;
+      }
     }
-  }
-
-  // Initialize the GPU.
-  graphics_system_ = graphics_system_factory();
-  if (!graphics_system_) {
-    return X_STATUS_NOT_IMPLEMENTED;
-  }
-
-  // Initialize the HID.
-  input_system_ = std::make_unique<xe::hid::InputSystem>(display_window_);
-  if (!input_system_) {
-    return X_STATUS_NOT_IMPLEMENTED;
-  }
-  if (input_driver_factory) {
-    auto input_drivers = input_driver_factory(display_window_);
-    for (size_t i = 0; i < input_drivers.size(); ++i) {
-      input_system_->AddDriver(std::move(input_drivers[i]));
+  });
+  for (size_t i = 0; i < xe::countof(create_results); ++i) {
+    if (create_results[i]) {
+      return create_results[i];
     }
   }
 
-  result = input_system_->Setup();
-  if (result) {
-    return result;
-  }
-
   // Bring up the virtual filesystem used by the kernel.
   file_system_ = std::make_unique<xe::vfs::VirtualFileSystem>();
 
   // Shared kernel state.
   kernel_state_ = std::make_unique<xe::kernel::KernelState>(this);
 
-  // Setup the core components.
-  result = graphics_system_->Setup(processor_.get(), kernel_state_.get(),
-                                   display_window_);
-  if (result) {
-    return result;
-  }
-
-  if (audio_system_) {
-    result = audio_system_->Setup(kernel_state_.get());
-    if (result) {
-      return result;
+  // Setup the core components. Graphics and audio setup only share the
+  // (internally synchronized) kernel state, so they can also overlap.
+  X_STATUS setup_results[2] = {X_STATUS_SUCCESS, X_STATUS_SUCCESS};
+  xe::threading::ThreadPool::shared()->ParallelFor(2, [&](uint32_t index) {
+    switch (index) {
+      case 0: {
+        setup_results[0] = graphics_system_->Setup(
+            processor_.get(), kernel_state_.get(), display_window_);
+        break;
+      }
+      case 1: {
+        if (audio_system_) {
+          setup_results[1] = audio_system_->Setup(kernel_state_.get());
+        }
+        break;
+      }
+    }
+  });
+  for (size_t i = 0; i < xe::countof(setup_results); ++i) {
+    if (setup_results[i]) {
+      return setup_results[i];
     }
   }
 
@@ -229,6 +263,8 @@ X_STATUS Emulator::Setup(
     });
   }
 
+  StartupTimeline::Mark(StartupTimeline::Phase::kEmulatorSetup);
+
   return result;
 }
 
@@ -656,6 +692,7 @@ X_STATUS Emulator::CompleteLaunch(const std::wstring& path,
     XELOGE("Failed to load user module %S", path.c_str());
     return X_STATUS_NOT_FOUND;
   }
+  StartupTimeline::Mark(StartupTimeline::Phase::kModuleLoad);
 
   // Grab the current title ID.
   xex2_opt_execution_info* info = nullptr;
@@ -685,6 +722,26 @@ X_STATUS Emulator::CompleteLaunch(const std::wstring& path,
     }
   }
 
+  // Optionally translate everything reachable in the module before its entry
+  // point runs, so capture sessions never stall on the JIT. Reachability is
+  // rooted at the entry point and exports so dead code stays untranslated.
+  if (cvars::precompile_modules) {
+    auto xex_module = module->xex_module();
+    if (xex_module && xex_module->low_address()) {
+      std::vector<uint32_t> roots;
+      if (module->entry_point()) {
+        roots.push_back(module->entry_point());
+      }
+      xex_module->GetExportAddresses(&roots);
+      processor_->PrecompileRange(
+          xex_module->low_address(), xex_module->high_address(), roots,
+          [this](size_t completed, size_t total) {
+            on_precompile_progress(completed, total);
+          });
+      StartupTimeline::Mark(StartupTimeline::Phase::kPrecompile);
+    }
+  }
+
   auto main_thread = kernel_state_->LaunchModule(module);
   if (!main_thread) {
     return X_STATUS_UNSUCCESSFUL;
@@ -146,6 +146,9 @@ class Emulator {
 
  public:
   xe::Delegate<uint32_t, const std::wstring&> on_launch;
+  // Fired periodically with (completed, total) while a module is being
+  // precompiled at launch (--precompile_modules).
+  xe::Delegate<size_t, size_t> on_precompile_progress;
   xe::Delegate<> on_terminate;
   xe::Delegate<> on_exit;
 
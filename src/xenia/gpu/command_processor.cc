@@ -14,10 +14,16 @@
 #include <cmath>
 
 #include "xenia/base/byte_stream.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/frame_timeline.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/threading.h"
 #include "xenia/base/math.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/ring_buffer.h"
+#include "xenia/base/startup_timeline.h"
 #include "xenia/gpu/gpu_flags.h"
 #include "xenia/gpu/graphics_system.h"
 #include "xenia/gpu/sampler_info.h"
@@ -26,11 +32,26 @@
 #include "xenia/kernel/kernel_state.h"
 #include "xenia/kernel/user_module.h"
 
+DEFINE_bool(command_buffer_lookahead, true,
+            "Scan the command buffer ahead of the execution point so the "
+            "backend can start translating shaders for upcoming draws early.",
+            "GPU");
+
+DEFINE_int32(framerate_limit, 0,
+             "Maximum rate at which the guest may produce new frames, in "
+             "frames per second (for instance, 30 or 60). 0 means uncapped - "
+             "frames are swapped as soon as they are ready.",
+             "GPU");
+
 namespace xe {
 namespace gpu {
 
 using namespace xe::gpu::xenos;
 
+// Cap on PM4_INDIRECT_BUFFER nesting followed by the lookahead scan, against
+// malformed self-referencing buffers.
+constexpr uint32_t kPrescanMaxIndirectDepth = 4;
+
 CommandProcessor::CommandProcessor(GraphicsSystem* graphics_system,
                                    kernel::KernelState* kernel_state)
     : memory_(graphics_system->memory()),
@@ -74,6 +95,14 @@ bool CommandProcessor::Initialize(
       }));
   worker_thread_->set_name("GraphicsSystem Command Processor");
   worker_thread_->Create();
+  // Keep the command processor in the last-level cache group most of the
+  // other emulator threads will be running in - it exchanges data with guest
+  // threads and the presenter every frame, and crossing CCX/CCD boundaries
+  // costs frame time.
+  uint64_t llc_affinity_mask = xe::threading::largest_llc_group_affinity_mask();
+  if (llc_affinity_mask) {
+    worker_thread_->thread()->set_affinity_mask(llc_affinity_mask);
+  }
 
   return true;
 }
@@ -135,6 +164,8 @@ void CommandProcessor::CallInThread(std::function<void()> fn) {
 
 void CommandProcessor::ClearCaches() {}
 
+void CommandProcessor::ToggleResolutionScale() {}
+
 void CommandProcessor::WorkerThreadMain() {
   context_->MakeCurrent();
   if (!SetupContext()) {
@@ -178,6 +209,12 @@ void CommandProcessor::WorkerThreadMain() {
     }
     assert_true(read_ptr_index_ != write_ptr_index);
 
+    // Scan ahead of the execution point so the backend can start compiling
+    // shaders for upcoming draws while the preceding commands execute.
+    if (cvars::command_buffer_lookahead) {
+      PrescanPrimaryBuffer(write_ptr_index);
+    }
+
     // Execute. Note that we handle wraparound transparently.
     read_ptr_index_ = ExecutePrimaryBuffer(read_ptr_index_, write_ptr_index);
 
@@ -254,6 +291,7 @@ void CommandProcessor::ShutdownContext() { context_.reset(); }
 
 void CommandProcessor::InitializeRingBuffer(uint32_t ptr, uint32_t log2_size) {
   read_ptr_index_ = 0;
+  prescan_read_index_ = 0;
   primary_buffer_ptr_ = ptr;
   primary_buffer_size_ = 1 << log2_size;
 }
@@ -282,7 +320,9 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
     return;
   }
 
-  regs->values[index].u32 = value;
+  // Guest threads poll registers through the MMIO handler while the CP runs;
+  // publish through the wait-free word store so those reads stay torn-free.
+  regs->WriteWord(index, value);
   if (!regs->GetRegisterInfo(index)) {
     XELOGW("GPU: Write to unknown register (%.4X = %.8X)", index, value);
   }
@@ -291,7 +331,7 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   // This will block the command processor the next time it WAIT_MEM_REGs and
   // allow us to synchronize the memory.
   if (index == XE_GPU_REG_COHER_STATUS_HOST) {
-    regs->values[index].u32 |= 0x80000000ul;
+    regs->WriteWord(index, value | 0x80000000ul);
   }
 
   // Scratch register writeback.
@@ -306,6 +346,33 @@ void CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   }
 }
 
+void CommandProcessor::WriteRegisterRangeFromRing(RingBuffer* reader,
+                                                  uint32_t base,
+                                                  uint32_t num_registers) {
+  for (uint32_t i = 0; i < num_registers; ++i) {
+    uint32_t data = reader->ReadAndSwap<uint32_t>();
+    WriteRegister(base + i, data);
+  }
+}
+
+void CommandProcessor::CopyPlainRegisterRangeFromRing(RingBuffer* reader,
+                                                      uint32_t base,
+                                                      uint32_t num_registers) {
+  assert_true(base + num_registers <= RegisterFile::kRegisterCount);
+  RingBuffer::ReadRange range =
+      reader->BeginRead(num_registers * sizeof(uint32_t));
+  uint32_t num_registers_first =
+      uint32_t(range.first_length / sizeof(uint32_t));
+  xe::copy_and_swap_32_unaligned(&register_file_->values[base], range.first,
+                                 num_registers_first);
+  if (range.second_length != 0) {
+    xe::copy_and_swap_32_unaligned(
+        &register_file_->values[base + num_registers_first], range.second,
+        range.second_length / sizeof(uint32_t));
+  }
+  reader->EndRead(range);
+}
+
 void CommandProcessor::UpdateGammaRampValue(GammaRampType type,
                                             uint32_t value) {
   RegisterFile* regs = register_file_;
@@ -409,10 +476,43 @@ void CommandProcessor::IssueSwap(uint32_t frontbuffer_ptr,
           break;
         }
       }
-      xe::threading::MaybeYield();
+        xe::threading::MaybeYield();
+    }
+  }
+
+  // Pace the guest frame rate if requested. The display still presents at its
+  // own rate (the swap request only marks the new frame as pending) - this
+  // regulates how often new frames are produced, evening out the delivery of
+  // frames to the display.
+  int32_t framerate_limit = cvars::framerate_limit;
+  if (framerate_limit > 0) {
+    uint64_t tick_frequency = Clock::QueryHostTickFrequency();
+    uint64_t interval_ticks = tick_frequency / uint64_t(framerate_limit);
+    uint64_t tick_count = Clock::QueryHostTickCount();
+    if (swap_pacer_next_tick_ != 0 && tick_count < swap_pacer_next_tick_) {
+      xe::threading::Sleep(std::chrono::microseconds(
+          (swap_pacer_next_tick_ - tick_count) * 1000000 / tick_frequency));
+      tick_count = Clock::QueryHostTickCount();
     }
+    // Schedule relative to the previous target, not the actual wake-up time,
+    // so oversleeping doesn't accumulate - but resynchronize if more than a
+    // frame behind (or if the limit has just been enabled).
+    if (swap_pacer_next_tick_ == 0 ||
+        tick_count >= swap_pacer_next_tick_ + interval_ticks) {
+      swap_pacer_next_tick_ = tick_count + interval_ticks;
+    } else {
+      swap_pacer_next_tick_ += interval_ticks;
+    }
+  } else {
+    swap_pacer_next_tick_ = 0;
   }
 
+  // Open the frame's timeline record after pacing so the swap timestamp
+  // reflects when the frame was actually delivered. The id is kept for the
+  // backend to attribute GPU completion of the submissions closed by the swap.
+  swap_timeline_frame_id_ = FrameTimeline::RecordGuestSwap();
+  StartupTimeline::Mark(StartupTimeline::Phase::kFirstDraw);
+
   PerformSwap(frontbuffer_ptr, frontbuffer_width, frontbuffer_height);
 
   {
@@ -489,6 +589,331 @@ void CommandProcessor::ExecuteIndirectBuffer(uint32_t ptr, uint32_t count) {
   trace_writer_.WriteIndirectBufferEnd();
 }
 
+void CommandProcessor::PrescanPrimaryBuffer(uint32_t write_index) {
+  SCOPE_profile_cpu_f("gpu");
+
+  // Resume from wherever the previous scan stopped - everything before that
+  // has already been seen. Execution never outruns the scan front, so the
+  // register file, bin state and active shaders are all current as of
+  // prescan_read_index_ right now; seed the shadow state from them.
+  uint32_t start_index = prescan_read_index_;
+  prescan_read_index_ = write_index;
+  if (start_index == write_index) {
+    return;
+  }
+
+  SeedPrescanState();
+
+  RingBuffer reader(memory_->TranslatePhysical(primary_buffer_ptr_),
+                    primary_buffer_size_);
+  reader.set_read_offset(start_index * sizeof(uint32_t));
+  reader.set_write_offset(write_index * sizeof(uint32_t));
+  while (reader.read_count()) {
+    if (!PrescanPacket(&reader, 0)) {
+      // Unscannable packet - give up on the rest of this range. If it is
+      // actually malformed the executor will log the real error.
+      break;
+    }
+  }
+}
+
+void CommandProcessor::SeedPrescanState() {
+  prescan_sq_program_cntl_ =
+      register_file_->values[XE_GPU_REG_SQ_PROGRAM_CNTL].u32;
+  prescan_vgt_output_path_cntl_ =
+      register_file_->values[XE_GPU_REG_VGT_OUTPUT_PATH_CNTL].u32;
+  prescan_sq_program_cntl_valid_ = true;
+  prescan_vgt_output_path_cntl_valid_ = true;
+  prescan_bin_select_ = bin_select_;
+  prescan_bin_mask_ = bin_mask_;
+  prescan_vertex_shader_ = active_vertex_shader_;
+  prescan_pixel_shader_ = active_pixel_shader_;
+}
+
+void CommandProcessor::BeginTracePrescan() {
+  // Playback runs on this thread, so the register file and active shaders
+  // are exactly the state the first scanned packet will execute with; writes
+  // within the scanned packets are tracked by the shadow state.
+  SeedPrescanState();
+  prescan_from_trace_ = true;
+}
+
+void CommandProcessor::PrescanTracePacket(uint32_t ptr, uint32_t count) {
+  RingBuffer reader(memory_->TranslatePhysical(ptr),
+                    count * sizeof(uint32_t));
+  reader.set_write_offset(count * sizeof(uint32_t));
+  while (reader.read_count()) {
+    if (!PrescanPacket(&reader, 0)) {
+      break;
+    }
+  }
+}
+
+void CommandProcessor::EndTracePrescan() { prescan_from_trace_ = false; }
+
+bool CommandProcessor::PrescanPacket(RingBuffer* reader, uint32_t depth) {
+  const uint32_t packet = reader->ReadAndSwap<uint32_t>();
+  if (packet == 0) {
+    return true;
+  }
+  switch (packet >> 30) {
+    case 0x00: {
+      uint32_t count = ((packet >> 16) & 0x3FFF) + 1;
+      if (reader->read_count() < count * sizeof(uint32_t)) {
+        return false;
+      }
+      uint32_t base_index = (packet & 0x7FFF);
+      uint32_t write_one_reg = (packet >> 15) & 0x1;
+      for (uint32_t m = 0; m < count; m++) {
+        PrescanRegisterWrite(write_one_reg ? base_index : base_index + m,
+                             reader->ReadAndSwap<uint32_t>());
+      }
+      return true;
+    }
+    case 0x01: {
+      if (reader->read_count() < 2 * sizeof(uint32_t)) {
+        return false;
+      }
+      PrescanRegisterWrite(packet & 0x7FF, reader->ReadAndSwap<uint32_t>());
+      PrescanRegisterWrite((packet >> 11) & 0x7FF,
+                           reader->ReadAndSwap<uint32_t>());
+      return true;
+    }
+    case 0x02:
+      return true;
+    case 0x03:
+      return PrescanPacketType3(reader, packet, depth);
+    default:
+      return false;
+  }
+}
+
+bool CommandProcessor::PrescanPacketType3(RingBuffer* reader, uint32_t packet,
+                                          uint32_t depth) {
+  uint32_t opcode = (packet >> 8) & 0x7F;
+  uint32_t count = ((packet >> 16) & 0x3FFF) + 1;
+  if (reader->read_count() < count * sizeof(uint32_t)) {
+    return false;
+  }
+
+  // Take the same predication decision the executor will take when it gets
+  // here, using the shadowed bin state.
+  if (packet & 1) {
+    if ((prescan_bin_select_ & prescan_bin_mask_) == 0 ||
+        opcode == PM4_XE_SWAP) {
+      reader->AdvanceRead(count * sizeof(uint32_t));
+      return true;
+    }
+  }
+
+  uint32_t consumed = 0;
+  switch (opcode) {
+    case PM4_INDIRECT_BUFFER:
+    case PM4_INDIRECT_BUFFER_PFD: {
+      uint32_t list_ptr = CpuToGpu(reader->ReadAndSwap<uint32_t>());
+      uint32_t list_length = reader->ReadAndSwap<uint32_t>() & 0xFFFFF;
+      consumed = 2;
+      // The nested buffer has been fully written by the time it is linked
+      // into the primary buffer, so it is as stable as the primary contents.
+      if (depth < kPrescanMaxIndirectDepth) {
+        RingBuffer list_reader(memory_->TranslatePhysical(GpuToCpu(list_ptr)),
+                               list_length * sizeof(uint32_t));
+        list_reader.set_write_offset(list_length * sizeof(uint32_t));
+        while (list_reader.read_count()) {
+          if (!PrescanPacket(&list_reader, depth + 1)) {
+            return false;
+          }
+        }
+      }
+      break;
+    }
+    case PM4_REG_RMW: {
+      // The written value is recomputed from execution-time register state,
+      // so any shadow it targets can't be trusted anymore.
+      uint32_t rmw_info = reader->ReadAndSwap<uint32_t>();
+      consumed = 1;
+      uint32_t target = rmw_info & 0x1FFF;
+      if (target == XE_GPU_REG_SQ_PROGRAM_CNTL) {
+        prescan_sq_program_cntl_valid_ = false;
+      } else if (target == XE_GPU_REG_VGT_OUTPUT_PATH_CNTL) {
+        prescan_vgt_output_path_cntl_valid_ = false;
+      }
+      break;
+    }
+    case PM4_LOAD_ALU_CONSTANT: {
+      // Loads registers from memory the CPU may still write before the
+      // executor reads it - invalidate any shadow in the target range.
+      /* address */ reader->ReadAndSwap<uint32_t>();
+      uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
+      uint32_t size_dwords = reader->ReadAndSwap<uint32_t>() & 0xFFF;
+      consumed = 3;
+      uint32_t type = (offset_type >> 16) & 0xFF;
+      if (type == 4) {
+        // REGISTERS
+        uint32_t index = (offset_type & 0x7FF) + 0x2000;
+        if (XE_GPU_REG_SQ_PROGRAM_CNTL >= index &&
+            XE_GPU_REG_SQ_PROGRAM_CNTL < index + size_dwords) {
+          prescan_sq_program_cntl_valid_ = false;
+        }
+        if (XE_GPU_REG_VGT_OUTPUT_PATH_CNTL >= index &&
+            XE_GPU_REG_VGT_OUTPUT_PATH_CNTL < index + size_dwords) {
+          prescan_vgt_output_path_cntl_valid_ = false;
+        }
+      }
+      break;
+    }
+    case PM4_SET_CONSTANT: {
+      uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
+      consumed = 1;
+      uint32_t type = (offset_type >> 16) & 0xFF;
+      if (type == 4) {
+        // REGISTERS
+        uint32_t index = (offset_type & 0x7FF) + 0x2000;
+        for (uint32_t n = 0; n < count - 1; n++) {
+          PrescanRegisterWrite(index + n, reader->ReadAndSwap<uint32_t>());
+        }
+        consumed = count;
+      }
+      break;
+    }
+    case PM4_SET_CONSTANT2:
+    case PM4_SET_SHADER_CONSTANTS: {
+      uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
+      uint32_t index = offset_type & 0xFFFF;
+      for (uint32_t n = 0; n < count - 1; n++) {
+        PrescanRegisterWrite(index + n, reader->ReadAndSwap<uint32_t>());
+      }
+      consumed = count;
+      break;
+    }
+    case PM4_IM_LOAD: {
+      // The ucode could in theory still be rewritten before execution; the
+      // worst case is a translated shader that never gets used, as
+      // LoadShader keys shaders off a hash of the data.
+      uint32_t addr_type = reader->ReadAndSwap<uint32_t>();
+      auto shader_type = static_cast<ShaderType>(addr_type & 0x3);
+      uint32_t addr = addr_type & ~0x3;
+      uint32_t start_size = reader->ReadAndSwap<uint32_t>();
+      uint32_t size_dwords = start_size & 0xFFFF;
+      consumed = 2;
+      auto shader = LoadShader(shader_type, addr,
+                               memory_->TranslatePhysical<uint32_t*>(addr),
+                               size_dwords);
+      if (shader_type == ShaderType::kVertex) {
+        prescan_vertex_shader_ = shader;
+      } else if (shader_type == ShaderType::kPixel) {
+        prescan_pixel_shader_ = shader;
+      }
+      break;
+    }
+    case PM4_IM_LOAD_IMMEDIATE: {
+      auto shader_type =
+          static_cast<ShaderType>(reader->ReadAndSwap<uint32_t>());
+      uint32_t start_size = reader->ReadAndSwap<uint32_t>();
+      uint32_t size_dwords = start_size & 0xFFFF;
+      consumed = 2;
+      if (count < 2 + size_dwords ||
+          reader->read_count() < size_dwords * sizeof(uint32_t)) {
+        return false;
+      }
+      auto shader =
+          LoadShader(shader_type, uint32_t(reader->read_ptr()),
+                     reinterpret_cast<uint32_t*>(reader->read_ptr()),
+                     size_dwords);
+      reader->AdvanceRead(size_dwords * sizeof(uint32_t));
+      consumed += size_dwords;
+      if (shader_type == ShaderType::kVertex) {
+        prescan_vertex_shader_ = shader;
+      } else if (shader_type == ShaderType::kPixel) {
+        prescan_pixel_shader_ = shader;
+      }
+      break;
+    }
+    case PM4_DRAW_INDX: {
+      /* viz query */ reader->ReadAndSwap<uint32_t>();
+      uint32_t dword1 = reader->ReadAndSwap<uint32_t>();
+      consumed = 2;
+      PrescanDraw(static_cast<PrimitiveType>(dword1 & 0x3F));
+      break;
+    }
+    case PM4_DRAW_INDX_2: {
+      uint32_t dword0 = reader->ReadAndSwap<uint32_t>();
+      consumed = 1;
+      PrescanDraw(static_cast<PrimitiveType>(dword0 & 0x3F));
+      break;
+    }
+    case PM4_SET_BIN_MASK_LO: {
+      uint32_t value = reader->ReadAndSwap<uint32_t>();
+      consumed = 1;
+      prescan_bin_mask_ = (prescan_bin_mask_ & 0xFFFFFFFF00000000ull) | value;
+      break;
+    }
+    case PM4_SET_BIN_MASK_HI: {
+      uint32_t value = reader->ReadAndSwap<uint32_t>();
+      consumed = 1;
+      prescan_bin_mask_ = (prescan_bin_mask_ & 0xFFFFFFFFull) |
+                          (static_cast<uint64_t>(value) << 32);
+      break;
+    }
+    case PM4_SET_BIN_SELECT_LO: {
+      uint32_t value = reader->ReadAndSwap<uint32_t>();
+      consumed = 1;
+      prescan_bin_select_ =
+          (prescan_bin_select_ & 0xFFFFFFFF00000000ull) | value;
+      break;
+    }
+    case PM4_SET_BIN_SELECT_HI: {
+      uint32_t value = reader->ReadAndSwap<uint32_t>();
+      consumed = 1;
+      prescan_bin_select_ = (prescan_bin_select_ & 0xFFFFFFFFull) |
+                            (static_cast<uint64_t>(value) << 32);
+      break;
+    }
+    case PM4_SET_BIN_MASK: {
+      uint64_t val_hi = reader->ReadAndSwap<uint32_t>();
+      uint64_t val_lo = reader->ReadAndSwap<uint32_t>();
+      consumed = 2;
+      prescan_bin_mask_ = (val_hi << 32) | val_lo;
+      break;
+    }
+    case PM4_SET_BIN_SELECT: {
+      uint64_t val_hi = reader->ReadAndSwap<uint32_t>();
+      uint64_t val_lo = reader->ReadAndSwap<uint32_t>();
+      consumed = 2;
+      prescan_bin_select_ = (val_hi << 32) | val_lo;
+      break;
+    }
+    default:
+      // Anything else has no effect on the state the scan tracks - skip it.
+      break;
+  }
+
+  if (consumed < count) {
+    reader->AdvanceRead((count - consumed) * sizeof(uint32_t));
+  }
+  return true;
+}
+
+void CommandProcessor::PrescanRegisterWrite(uint32_t index, uint32_t value) {
+  if (index == XE_GPU_REG_SQ_PROGRAM_CNTL) {
+    prescan_sq_program_cntl_ = value;
+    prescan_sq_program_cntl_valid_ = true;
+  } else if (index == XE_GPU_REG_VGT_OUTPUT_PATH_CNTL) {
+    prescan_vgt_output_path_cntl_ = value;
+    prescan_vgt_output_path_cntl_valid_ = true;
+  }
+}
+
+void CommandProcessor::PrescanDraw(PrimitiveType prim_type) {
+  if (!prescan_vertex_shader_ || !prescan_sq_program_cntl_valid_ ||
+      !prescan_vgt_output_path_cntl_valid_) {
+    return;
+  }
+  OnPrescanDraw(prescan_vertex_shader_, prescan_pixel_shader_,
+                prescan_sq_program_cntl_, prescan_vgt_output_path_cntl_,
+                prim_type);
+}
+
 void CommandProcessor::ExecutePacket(uint32_t ptr, uint32_t count) {
   // Execute commands!
   RingBuffer reader(memory_->TranslatePhysical(ptr), count * sizeof(uint32_t));
@@ -502,9 +927,15 @@ void CommandProcessor::ExecutePacket(uint32_t ptr, uint32_t count) {
   } while (reader.read_count());
 }
 
+void CommandProcessor::ResetStatistics() {
+  packets_executed_ = 0;
+  draws_issued_ = 0;
+}
+
 bool CommandProcessor::ExecutePacket(RingBuffer* reader) {
   const uint32_t packet = reader->ReadAndSwap<uint32_t>();
   const uint32_t packet_type = packet >> 30;
+  ++packets_executed_;
   if (packet == 0) {
     trace_writer_.WritePacketStart(uint32_t(reader->read_ptr() - 4), 1);
     trace_writer_.WritePacketEnd();
@@ -542,10 +973,13 @@ bool CommandProcessor::ExecutePacketType0(RingBuffer* reader, uint32_t packet) {
 
   uint32_t base_index = (packet & 0x7FFF);
   uint32_t write_one_reg = (packet >> 15) & 0x1;
-  for (uint32_t m = 0; m < count; m++) {
-    uint32_t reg_data = reader->ReadAndSwap<uint32_t>();
-    uint32_t target_index = write_one_reg ? base_index : base_index + m;
-    WriteRegister(target_index, reg_data);
+  if (write_one_reg) {
+    for (uint32_t m = 0; m < count; m++) {
+      uint32_t reg_data = reader->ReadAndSwap<uint32_t>();
+      WriteRegister(base_index, reg_data);
+    }
+  } else {
+    WriteRegisterRangeFromRing(reader, base_index, count);
   }
 
   trace_writer_.WritePacketEnd();
@@ -1135,9 +1569,14 @@ bool CommandProcessor::ExecutePacketType3_EVENT_WRITE_ZPD(RingBuffer* reader,
   // Writeback initiator.
   WriteRegister(XE_GPU_REG_VGT_EVENT_INITIATOR, initiator & 0x3F);
 
-  // TODO: Flag the backend CP to write out zpass counters to
-  // REG_RB_SAMPLE_COUNT_ADDR (probably # pixels passed depth test).
-  // This applies to the last draw, I believe.
+  // Write the sample count of the last draw (probably # pixels passed depth
+  // test) to the address the guest placed in RB_SAMPLE_COUNT_ADDR. The
+  // backend may do this asynchronously, when the GPU produces the count.
+  uint32_t address =
+      register_file_->values[XE_GPU_REG_RB_SAMPLE_COUNT_ADDR].u32;
+  if (address != 0) {
+    WriteZPassSampleCount(address);
+  }
 
   return true;
 }
@@ -1184,6 +1623,7 @@ bool CommandProcessor::ExecutePacketType3_DRAW_INDX(RingBuffer* reader,
     assert_always();
   }
 
+  ++draws_issued_;
   bool success = IssueDraw(prim_type, index_count,
                            is_indexed ? &index_buffer_info : nullptr);
   if (!success) {
@@ -1209,6 +1649,7 @@ bool CommandProcessor::ExecutePacketType3_DRAW_INDX_2(RingBuffer* reader,
   // uint32_t index_ptr = reader->ptr();
   reader->AdvanceRead((count - 1) * sizeof(uint32_t));
 
+  ++draws_issued_;
   bool success = IssueDraw(prim_type, index_count, nullptr);
   if (!success) {
     XELOGE("PM4_DRAW_INDX_IMM(%d, %d): Failed in backend", index_count,
@@ -1248,10 +1689,7 @@ bool CommandProcessor::ExecutePacketType3_SET_CONSTANT(RingBuffer* reader,
       reader->AdvanceRead((count - 1) * sizeof(uint32_t));
       return true;
   }
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
@@ -1260,10 +1698,7 @@ bool CommandProcessor::ExecutePacketType3_SET_CONSTANT2(RingBuffer* reader,
                                                         uint32_t count) {
   uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
   uint32_t index = offset_type & 0xFFFF;
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
@@ -1311,10 +1746,7 @@ bool CommandProcessor::ExecutePacketType3_SET_SHADER_CONSTANTS(
     RingBuffer* reader, uint32_t packet, uint32_t count) {
   uint32_t offset_type = reader->ReadAndSwap<uint32_t>();
   uint32_t index = offset_type & 0xFFFF;
-  for (uint32_t n = 0; n < count - 1; n++, index++) {
-    uint32_t data = reader->ReadAndSwap<uint32_t>();
-    WriteRegister(index, data);
-  }
+  WriteRegisterRangeFromRing(reader, index, count - 1);
   return true;
 }
 
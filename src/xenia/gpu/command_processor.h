@@ -108,9 +108,41 @@ class CommandProcessor {
                    kernel::KernelState* kernel_state);
   virtual ~CommandProcessor();
 
+  kernel::KernelState* kernel_state() const { return kernel_state_; }
+
   uint32_t counter() const { return counter_; }
   void increment_counter() { counter_++; }
 
+  // Execution statistics since the last ResetStatistics call. Updated on the
+  // worker thread with no synchronization - read them only while the command
+  // processor is known to be idle, such as between trace playback passes.
+  uint64_t packets_executed() const { return packets_executed_; }
+  uint64_t draws_issued() const { return draws_issued_; }
+  void ResetStatistics();
+
+  // GPU duration of a single draw or resolve, captured by backends that
+  // support timestamp queries (see SetDrawTimingCaptureEnabled).
+  struct DrawTiming {
+    // Index of the draw within its frame, counting draw packets
+    // (PM4_DRAW_INDX and PM4_DRAW_INDX_2, which also initiate resolves) in
+    // execution order - the same order the trace tools list draw commands in.
+    uint32_t draw_index;
+    bool is_resolve;
+    // GPU time between the timestamps surrounding the draw, in microseconds.
+    // Zero for draws the backend skipped.
+    float duration_us;
+  };
+  // Requests timestamp queries around every draw and resolve, taking effect
+  // when the next frame is opened. Ignored by backends without support.
+  virtual void SetDrawTimingCaptureEnabled(bool enabled) {}
+  // Returns the draw timings of the last fully rendered frame that was
+  // captured. Awaits GPU completion of the frame - call only while the
+  // command processor is idle. Returns false if nothing was captured or the
+  // backend doesn't support draw timing.
+  virtual bool GetDrawTimings(std::vector<DrawTiming>& timings_out) {
+    return false;
+  }
+
   Shader* active_vertex_shader() const { return active_vertex_shader_; }
   Shader* active_pixel_shader() const { return active_pixel_shader_; }
 
@@ -121,6 +153,10 @@ class CommandProcessor {
 
   virtual void ClearCaches();
 
+  // Switches between 1x and 2x resolution scaling if the backend and the
+  // device support it. Takes effect at the next frame boundary.
+  virtual void ToggleResolutionScale();
+
   SwapState& swap_state() { return swap_state_; }
   void set_swap_mode(SwapMode swap_mode) { swap_mode_ = swap_mode; }
   void IssueSwap(uint32_t frontbuffer_ptr, uint32_t frontbuffer_width,
@@ -145,6 +181,16 @@ class CommandProcessor {
 
   void ExecutePacket(uint32_t ptr, uint32_t count);
 
+  // Prescan of packets applied from a trace instead of the primary buffer.
+  // The trace player brackets a playback range with Begin/EndTracePrescan and
+  // feeds every packet to PrescanTracePacket after applying its contents to
+  // the guest memory, before any of the range's packets execute - the shadow
+  // state persists across the packets of one session. Must be called on the
+  // worker thread.
+  void BeginTracePrescan();
+  void PrescanTracePacket(uint32_t ptr, uint32_t count);
+  void EndTracePrescan();
+
   bool is_paused() const { return paused_; }
   void Pause();
   void Resume();
@@ -166,6 +212,18 @@ class CommandProcessor {
   virtual void ShutdownContext() = 0;
 
   virtual void WriteRegister(uint32_t index, uint32_t value);
+  // Writes a range of consecutive registers from the ring buffer. The default
+  // implementation writes them one by one, backends can override it to
+  // coalesce writes to registers that don't need special handling into bulk
+  // copies to the register file.
+  virtual void WriteRegisterRangeFromRing(RingBuffer* reader, uint32_t base,
+                                          uint32_t num_registers);
+  // Performs a byte-swapped bulk copy of consecutive registers from the ring
+  // buffer directly to the register file, without invoking any per-register
+  // side effects - the caller is responsible for ensuring the range has none
+  // or for handling them separately.
+  void CopyPlainRegisterRangeFromRing(RingBuffer* reader, uint32_t base,
+                                      uint32_t num_registers);
 
   void UpdateGammaRampValue(GammaRampType type, uint32_t value);
 
@@ -178,6 +236,17 @@ class CommandProcessor {
 
   uint32_t ExecutePrimaryBuffer(uint32_t start_index, uint32_t end_index);
   void ExecuteIndirectBuffer(uint32_t ptr, uint32_t length);
+  // Read-only scan of the primary buffer between the lookahead front and the
+  // write pointer, run before execution catches up. Loads shaders referenced
+  // by upcoming IM_LOAD packets and reports upcoming draws via OnPrescanDraw
+  // so backends can start translating/compiling early.
+  void PrescanPrimaryBuffer(uint32_t write_index);
+  // Seeds the prescan shadow state from the current execution state.
+  void SeedPrescanState();
+  bool PrescanPacket(RingBuffer* reader, uint32_t depth);
+  bool PrescanPacketType3(RingBuffer* reader, uint32_t packet, uint32_t depth);
+  void PrescanRegisterWrite(uint32_t index, uint32_t value);
+  void PrescanDraw(PrimitiveType prim_type);
   bool ExecutePacket(RingBuffer* reader);
   bool ExecutePacketType0(RingBuffer* reader, uint32_t packet);
   bool ExecutePacketType1(RingBuffer* reader, uint32_t packet);
@@ -237,10 +306,27 @@ class CommandProcessor {
                              const uint32_t* host_address,
                              uint32_t dword_count) = 0;
 
+  // Called on the worker thread for each draw the lookahead scan finds ahead
+  // of the execution point, with the shaders and register values the draw
+  // will be issued with. Backends may use this to begin shader translation or
+  // pipeline creation early; they must not touch any execution state.
+  virtual void OnPrescanDraw(Shader* vertex_shader, Shader* pixel_shader,
+                             uint32_t sq_program_cntl,
+                             uint32_t vgt_output_path_cntl,
+                             PrimitiveType prim_type) {}
+
   virtual bool IssueDraw(PrimitiveType prim_type, uint32_t index_count,
                          IndexBufferInfo* index_buffer_info) = 0;
   virtual bool IssueCopy() = 0;
 
+  // Writes the sample count of the latest draw (the number of samples that
+  // passed the depth/stencil test), requested by the guest via a ZPASS_DONE
+  // event, to the given guest physical address (with the endianness in its
+  // lower bits). Backends with occlusion query support may perform the write
+  // asynchronously, when the GPU produces the count. The default
+  // implementation leaves the guest memory untouched.
+  virtual void WriteZPassSampleCount(uint32_t address) {}
+
   virtual void InitializeTrace() = 0;
   virtual void FinalizeTrace() = 0;
 
@@ -266,6 +352,12 @@ class CommandProcessor {
   SwapMode swap_mode_ = SwapMode::kNormal;
   SwapState swap_state_;
   std::function<void()> swap_request_handler_;
+  // Host tick count the next paced swap is scheduled for, when
+  // --framerate_limit is set. 0 until the first paced swap.
+  uint64_t swap_pacer_next_tick_ = 0;
+  // FrameTimeline id of the frame the latest guest swap closed, set before
+  // PerformSwap so backends can report the frame's GPU completion.
+  uint64_t swap_timeline_frame_id_ = 0;
   std::queue<std::function<void()>> pending_fns_;
 
   // MicroEngine binary from PM4_ME_INIT
@@ -273,6 +365,9 @@ class CommandProcessor {
 
   uint32_t counter_ = 0;
 
+  uint64_t packets_executed_ = 0;
+  uint64_t draws_issued_ = 0;
+
   uint32_t primary_buffer_ptr_ = 0;
   uint32_t primary_buffer_size_ = 0;
 
@@ -286,6 +381,25 @@ class CommandProcessor {
   uint64_t bin_select_ = 0xFFFFFFFFull;
   uint64_t bin_mask_ = 0xFFFFFFFFull;
 
+  // Lookahead scan state (see PrescanPrimaryBuffer). The scan front never
+  // falls behind the execution point, so the register file, bin state and
+  // active shaders are all current as of prescan_read_index_ whenever a scan
+  // begins; the shadow values below track writes found within the scanned
+  // range.
+  uint32_t prescan_read_index_ = 0;
+  uint32_t prescan_sq_program_cntl_ = 0;
+  uint32_t prescan_vgt_output_path_cntl_ = 0;
+  bool prescan_sq_program_cntl_valid_ = false;
+  bool prescan_vgt_output_path_cntl_valid_ = false;
+  uint64_t prescan_bin_select_ = 0xFFFFFFFFull;
+  uint64_t prescan_bin_mask_ = 0xFFFFFFFFull;
+  Shader* prescan_vertex_shader_ = nullptr;
+  Shader* prescan_pixel_shader_ = nullptr;
+  // Whether the current scan is of trace playback packets rather than of the
+  // primary buffer - trace tools need backends to translate ahead even when
+  // asynchronous translation for the live path is disabled.
+  bool prescan_from_trace_ = false;
+
   Shader* active_vertex_shader_ = nullptr;
   Shader* active_pixel_shader_ = nullptr;
 
@@ -10,12 +10,15 @@
 #include "third_party/xxhash/xxhash.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <cstring>
 
 #include "xenia/base/assert.h"
 #include "xenia/base/cvar.h"
+#include "xenia/base/frame_timeline.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
+#include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
 #include "xenia/gpu/d3d12/d3d12_command_processor.h"
 #include "xenia/gpu/d3d12/d3d12_graphics_system.h"
@@ -32,6 +35,17 @@ DEFINE_bool(d3d12_edram_rov, true,
 // disable half-pixel offset by setting this to false.
 DEFINE_bool(d3d12_half_pixel_offset, true,
             "Enable half-pixel vertex and VPOS offset.", "D3D12");
+DEFINE_bool(d3d12_draw_merging, true,
+            "Merge consecutive indexed draws that have identical state and "
+            "adjacent index buffer ranges (common in guest UI and particle "
+            "rendering) into single draw calls.",
+            "D3D12");
+DEFINE_bool(d3d12_occlusion_query_strict, false,
+            "Wait for the GPU when the guest requests the sample count of a "
+            "draw (ZPASS_DONE) instead of immediately returning the latest "
+            "count obtained for the same address and correcting it when the "
+            "GPU produces the real one. Accurate, but stalls the CPU.",
+            "D3D12");
 DEFINE_bool(d3d12_readback_memexport, false,
             "Read data written by memory export in shaders on the CPU. This "
             "may be needed in some games (but many only access exported data "
@@ -39,6 +53,14 @@ DEFINE_bool(d3d12_readback_memexport, false,
             "but causes mid-frame synchronization, so it has a huge "
             "performance impact.",
             "D3D12");
+DEFINE_bool(d3d12_readback_memexport_pipelined, true,
+            "With d3d12_readback_memexport, copy the exported data to a "
+            "readback ring right after the exporting draw and write it to the "
+            "guest memory when the GPU completes the submission, instead of "
+            "stalling the CPU after every such draw. The data arrives on the "
+            "CPU slightly later, but exporting draws no longer serialize the "
+            "CPU and the GPU.",
+            "D3D12");
 DEFINE_bool(d3d12_readback_resolve, false,
             "Read render-to-texture results on the CPU. This may be needed in "
             "some games, for instance, for screenshots in saved games, but "
@@ -50,6 +72,19 @@ DEFINE_bool(d3d12_ssaa_custom_sample_positions, false,
             "path where available instead of centers (experimental, not very "
             "high-quality).",
             "D3D12");
+DEFINE_int32(d3d12_replay_threads, 0,
+             "Number of additional threads to replay the deferred command "
+             "list into Direct3D 12 command lists on, 0 to replay serially on "
+             "the submission thread. The stream is split at render target "
+             "binding changes, so this is mostly useful with the RTV/DSV "
+             "output path in frames with high draw counts.",
+             "D3D12");
+DEFINE_int32(d3d12_queued_frames, 3,
+             "Maximum number of frames the CPU may run ahead of the GPU, 1 to "
+             "3. Higher values allow the CPU and the GPU to overlap more work "
+             "for a higher and more stable frame rate, lower values reduce "
+             "the input-to-display latency.",
+             "D3D12");
 
 namespace xe {
 namespace gpu {
@@ -64,7 +99,58 @@ constexpr uint32_t D3D12CommandProcessor::kScratchBufferSizeIncrement;
 
 D3D12CommandProcessor::D3D12CommandProcessor(
     D3D12GraphicsSystem* graphics_system, kernel::KernelState* kernel_state)
-    : CommandProcessor(graphics_system, kernel_state) {}
+    : CommandProcessor(graphics_system, kernel_state) {
+  // Mark the registers UpdateSystemConstantValues depends on, so writes to
+  // them can invalidate its cached inputs.
+  std::memset(system_constants_used_register_bits_, 0,
+              sizeof(system_constants_used_register_bits_));
+  auto mark_register = [this](uint32_t index) {
+    system_constants_used_register_bits_[index >> 6] |= uint64_t(1)
+                                                        << (index & 63);
+  };
+  const uint32_t used_registers[] = {
+      XE_GPU_REG_PA_CL_CLIP_CNTL,
+      XE_GPU_REG_PA_CL_VTE_CNTL,
+      XE_GPU_REG_PA_CL_VPORT_XSCALE,
+      XE_GPU_REG_PA_CL_VPORT_YSCALE,
+      XE_GPU_REG_PA_CL_VPORT_ZSCALE,
+      XE_GPU_REG_PA_CL_VPORT_ZOFFSET,
+      XE_GPU_REG_PA_SU_POINT_MINMAX,
+      XE_GPU_REG_PA_SU_POINT_SIZE,
+      XE_GPU_REG_PA_SU_SC_MODE_CNTL,
+      XE_GPU_REG_PA_SU_VTX_CNTL,
+      XE_GPU_REG_PA_SU_POLY_OFFSET_FRONT_SCALE,
+      XE_GPU_REG_PA_SU_POLY_OFFSET_FRONT_OFFSET,
+      XE_GPU_REG_PA_SU_POLY_OFFSET_BACK_SCALE,
+      XE_GPU_REG_PA_SU_POLY_OFFSET_BACK_OFFSET,
+      XE_GPU_REG_RB_ALPHA_REF,
+      XE_GPU_REG_RB_COLORCONTROL,
+      XE_GPU_REG_RB_DEPTH_INFO,
+      XE_GPU_REG_RB_DEPTHCONTROL,
+      XE_GPU_REG_RB_STENCILREFMASK,
+      XE_GPU_REG_RB_STENCILREFMASK_BF,
+      XE_GPU_REG_RB_SURFACE_INFO,
+      XE_GPU_REG_RB_BLEND_RED,
+      XE_GPU_REG_RB_BLEND_GREEN,
+      XE_GPU_REG_RB_BLEND_BLUE,
+      XE_GPU_REG_RB_BLEND_ALPHA,
+      XE_GPU_REG_SQ_CONTEXT_MISC,
+      XE_GPU_REG_SQ_PROGRAM_CNTL,
+      XE_GPU_REG_VGT_INDX_OFFSET,
+      XE_GPU_REG_VGT_HOS_MIN_TESS_LEVEL,
+      XE_GPU_REG_VGT_HOS_MAX_TESS_LEVEL,
+  };
+  for (uint32_t used_register : used_registers) {
+    mark_register(used_register);
+  }
+  for (uint32_t i = 0; i < 4; ++i) {
+    mark_register(reg::RB_COLOR_INFO::rt_register_indices[i]);
+    mark_register(reg::RB_BLENDCONTROL::rt_register_indices[i]);
+  }
+  for (uint32_t i = 0; i < 6 * 4; ++i) {
+    mark_register(XE_GPU_REG_PA_CL_UCP_0_X + i);
+  }
+}
 D3D12CommandProcessor::~D3D12CommandProcessor() = default;
 
 void D3D12CommandProcessor::ClearCaches() {
@@ -72,6 +158,15 @@ void D3D12CommandProcessor::ClearCaches() {
   cache_clear_requested_ = true;
 }
 
+void D3D12CommandProcessor::ToggleResolutionScale() {
+  if (texture_cache_ == nullptr ||
+      !texture_cache_->IsResolutionScale2XSupported()) {
+    XELOGGPU("2x resolution scale not supported by the device");
+    return;
+  }
+  resolution_scale_toggle_requested_ = true;
+}
+
 void D3D12CommandProcessor::RequestFrameTrace(const std::wstring& root_path) {
   // Capture with PIX if attached.
   if (GetD3D12Context()->GetD3D12Provider()->GetGraphicsAnalysis() != nullptr) {
@@ -524,10 +619,7 @@ ID3D12Resource* D3D12CommandProcessor::RequestScratchGPUBuffer(
     return nullptr;
   }
   if (scratch_buffer_ != nullptr) {
-    BufferForDeletion buffer_for_deletion;
-    buffer_for_deletion.buffer = scratch_buffer_;
-    buffer_for_deletion.last_usage_submission = submission_current_;
-    buffers_for_deletion_.push_back(buffer_for_deletion);
+    DeferResourceDeletion(scratch_buffer_);
   }
   scratch_buffer_ = buffer;
   scratch_buffer_size_ = size;
@@ -546,6 +638,13 @@ void D3D12CommandProcessor::ReleaseScratchGPUBuffer(
   }
 }
 
+void D3D12CommandProcessor::DeferResourceDeletion(IUnknown* resource) {
+  ResourceForDeletion resource_for_deletion;
+  resource_for_deletion.resource = resource;
+  resource_for_deletion.last_usage_submission = submission_current_;
+  resources_for_deletion_.push_back(resource_for_deletion);
+}
+
 void D3D12CommandProcessor::SetSamplePositions(MsaaSamples sample_positions) {
   if (current_sample_positions_ == sample_positions) {
     return;
@@ -660,33 +759,34 @@ std::wstring D3D12CommandProcessor::GetWindowTitleText() const {
 }
 
 std::unique_ptr<xe::ui::RawImage> D3D12CommandProcessor::Capture() {
+  const SwapTexture& swap_texture = GetCurrentSwapTexture();
   ID3D12Resource* readback_buffer =
-      RequestReadbackBuffer(uint32_t(swap_texture_copy_size_));
+      RequestReadbackBuffer(uint32_t(swap_texture.copy_size));
   if (!readback_buffer) {
     return nullptr;
   }
   BeginSubmission(false);
-  PushTransitionBarrier(swap_texture_,
+  PushTransitionBarrier(swap_texture.texture,
                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
                         D3D12_RESOURCE_STATE_COPY_SOURCE);
   SubmitBarriers();
   D3D12_TEXTURE_COPY_LOCATION location_source, location_dest;
-  location_source.pResource = swap_texture_;
+  location_source.pResource = swap_texture.texture;
   location_source.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
   location_source.SubresourceIndex = 0;
   location_dest.pResource = readback_buffer;
   location_dest.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
-  location_dest.PlacedFootprint = swap_texture_copy_footprint_;
+  location_dest.PlacedFootprint = swap_texture.copy_footprint;
   deferred_command_list_->CopyTexture(location_dest, location_source);
-  PushTransitionBarrier(swap_texture_, D3D12_RESOURCE_STATE_COPY_SOURCE,
+  PushTransitionBarrier(swap_texture.texture, D3D12_RESOURCE_STATE_COPY_SOURCE,
                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
   if (!EndSubmission(false)) {
     return nullptr;
   }
   AwaitAllSubmissionsCompletion();
   D3D12_RANGE readback_range;
-  readback_range.Begin = swap_texture_copy_footprint_.Offset;
-  readback_range.End = swap_texture_copy_size_;
+  readback_range.Begin = swap_texture.copy_footprint.Offset;
+  readback_range.End = swap_texture.copy_size;
   void* readback_mapping;
   if (FAILED(readback_buffer->Map(0, &readback_range, &readback_mapping))) {
     return nullptr;
@@ -699,16 +799,243 @@ std::unique_ptr<xe::ui::RawImage> D3D12CommandProcessor::Capture() {
   raw_image->data.resize(raw_image->stride * swap_texture_size.second);
   const uint8_t* readback_source_data =
       reinterpret_cast<const uint8_t*>(readback_mapping) +
-      swap_texture_copy_footprint_.Offset;
+      swap_texture.copy_footprint.Offset;
   for (uint32_t i = 0; i < swap_texture_size.second; ++i) {
     std::memcpy(raw_image->data.data() + i * raw_image->stride,
                 readback_source_data +
-                    i * swap_texture_copy_footprint_.Footprint.RowPitch,
+                    i * swap_texture.copy_footprint.Footprint.RowPitch,
                 raw_image->stride);
   }
   return raw_image;
 }
 
+bool D3D12CommandProcessor::BeginFrameCapture(
+    std::function<void(std::unique_ptr<xe::ui::RawImage>)> sink) {
+  std::lock_guard<std::mutex> lock(frame_capture_mutex_);
+  if (frame_capture_active_) {
+    return false;
+  }
+  if (frame_capture_fence_event_ == nullptr) {
+    frame_capture_fence_event_ = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (frame_capture_fence_event_ == nullptr) {
+      return false;
+    }
+  }
+  frame_capture_sink_ = std::move(sink);
+  frame_capture_shutdown_ = false;
+  frame_capture_dropped_frames_ = 0;
+  if (!frame_capture_thread_) {
+    frame_capture_thread_ =
+        xe::threading::Thread::Create({}, [this]() { FrameCaptureThread(); });
+    if (!frame_capture_thread_) {
+      frame_capture_sink_ = nullptr;
+      return false;
+    }
+    frame_capture_thread_->set_name("D3D12 Frame Capture");
+  }
+  frame_capture_active_ = true;
+  return true;
+}
+
+void D3D12CommandProcessor::EndFrameCapture() {
+  std::unique_ptr<xe::threading::Thread> thread;
+  {
+    std::lock_guard<std::mutex> lock(frame_capture_mutex_);
+    frame_capture_active_ = false;
+    if (!frame_capture_thread_) {
+      return;
+    }
+    frame_capture_shutdown_ = true;
+    thread = std::move(frame_capture_thread_);
+  }
+  frame_capture_cond_.notify_all();
+  // The capture thread drains the queued slots (awaiting their fence values)
+  // before exiting, so the buffers can be released safely after this.
+  xe::threading::Wait(thread.get(), true);
+  std::lock_guard<std::mutex> lock(frame_capture_mutex_);
+  for (uint32_t i = 0; i < kFrameCaptureSlotCount; ++i) {
+    ui::d3d12::util::ReleaseAndNull(frame_capture_slots_[i].readback_buffer);
+    frame_capture_slots_[i].buffer_size = 0;
+    frame_capture_slots_[i].pending = false;
+  }
+  frame_capture_sink_ = nullptr;
+  if (frame_capture_fence_event_ != nullptr) {
+    CloseHandle(frame_capture_fence_event_);
+    frame_capture_fence_event_ = nullptr;
+  }
+  if (frame_capture_dropped_frames_) {
+    XELOGGPU("Frame capture dropped %" PRIu64
+             " frames because the readback ring was full",
+             frame_capture_dropped_frames_);
+  }
+}
+
+void D3D12CommandProcessor::QueueFrameCapture() {
+  std::lock_guard<std::mutex> lock(frame_capture_mutex_);
+  if (!frame_capture_active_) {
+    return;
+  }
+  // Find a free slot - when the capture thread is behind, drop the frame
+  // rather than ever blocking the swap.
+  uint32_t slot_index = UINT32_MAX;
+  for (uint32_t i = 0; i < kFrameCaptureSlotCount; ++i) {
+    if (!frame_capture_slots_[i].pending) {
+      slot_index = i;
+      break;
+    }
+  }
+  if (slot_index == UINT32_MAX) {
+    ++frame_capture_dropped_frames_;
+    return;
+  }
+  FrameCaptureSlot& slot = frame_capture_slots_[slot_index];
+  const SwapTexture& swap_texture = GetCurrentSwapTexture();
+  if (slot.buffer_size < swap_texture.copy_size) {
+    auto device = GetD3D12Context()->GetD3D12Provider()->GetDevice();
+    D3D12_RESOURCE_DESC buffer_desc;
+    ui::d3d12::util::FillBufferResourceDesc(
+        buffer_desc, swap_texture.copy_size, D3D12_RESOURCE_FLAG_NONE);
+    ID3D12Resource* buffer;
+    if (FAILED(device->CreateCommittedResource(
+            &ui::d3d12::util::kHeapPropertiesReadback, D3D12_HEAP_FLAG_NONE,
+            &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+            IID_PPV_ARGS(&buffer)))) {
+      XELOGE("Failed to create a frame capture readback buffer");
+      return;
+    }
+    ui::d3d12::util::ReleaseAndNull(slot.readback_buffer);
+    slot.readback_buffer = buffer;
+    slot.buffer_size = swap_texture.copy_size;
+  }
+  PushTransitionBarrier(swap_texture.texture,
+                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                        D3D12_RESOURCE_STATE_COPY_SOURCE);
+  SubmitBarriers();
+  D3D12_TEXTURE_COPY_LOCATION location_source, location_dest;
+  location_source.pResource = swap_texture.texture;
+  location_source.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  location_source.SubresourceIndex = 0;
+  location_dest.pResource = slot.readback_buffer;
+  location_dest.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+  location_dest.PlacedFootprint = swap_texture.copy_footprint;
+  deferred_command_list_->CopyTexture(location_dest, location_source);
+  PushTransitionBarrier(swap_texture.texture, D3D12_RESOURCE_STATE_COPY_SOURCE,
+                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+  auto swap_texture_size = GetSwapTextureSize();
+  slot.width = swap_texture_size.first;
+  slot.height = swap_texture_size.second;
+  slot.footprint = swap_texture.copy_footprint;
+  // The copy completes when the submission being recorded is signaled.
+  slot.submission = submission_current_;
+  slot.pending = true;
+  frame_capture_ready_slots_.push_back(slot_index);
+  frame_capture_cond_.notify_one();
+}
+
+void D3D12CommandProcessor::FrameCaptureThread() {
+  while (true) {
+    uint32_t slot_index;
+    std::function<void(std::unique_ptr<xe::ui::RawImage>)> sink;
+    {
+      std::unique_lock<std::mutex> lock(frame_capture_mutex_);
+      frame_capture_cond_.wait(lock, [this]() {
+        return frame_capture_shutdown_ || !frame_capture_ready_slots_.empty();
+      });
+      if (frame_capture_ready_slots_.empty()) {
+        // Only exit once all queued copies have been consumed so their
+        // buffers aren't released while the GPU may still write them.
+        return;
+      }
+      slot_index = frame_capture_ready_slots_.front();
+      frame_capture_ready_slots_.pop_front();
+      sink = frame_capture_sink_;
+    }
+    FrameCaptureSlot& slot = frame_capture_slots_[slot_index];
+    // Wait for the copy on the GPU timeline with a separate event - the
+    // fence supports multiple waiters, so this doesn't interfere with
+    // submission tracking on the GPU thread.
+    if (submission_fence_->GetCompletedValue() < slot.submission) {
+      submission_fence_->SetEventOnCompletion(slot.submission,
+                                              frame_capture_fence_event_);
+      WaitForSingleObject(frame_capture_fence_event_, INFINITE);
+    }
+    D3D12_RANGE readback_range;
+    readback_range.Begin = slot.footprint.Offset;
+    readback_range.End = slot.buffer_size;
+    void* readback_mapping;
+    if (SUCCEEDED(
+            slot.readback_buffer->Map(0, &readback_range, &readback_mapping))) {
+      std::unique_ptr<xe::ui::RawImage> raw_image(new xe::ui::RawImage());
+      raw_image->width = slot.width;
+      raw_image->height = slot.height;
+      raw_image->stride = slot.width * 4;
+      raw_image->data.resize(raw_image->stride * slot.height);
+      const uint8_t* readback_source_data =
+          reinterpret_cast<const uint8_t*>(readback_mapping) +
+          slot.footprint.Offset;
+      for (uint32_t i = 0; i < slot.height; ++i) {
+        std::memcpy(
+            raw_image->data.data() + i * raw_image->stride,
+            readback_source_data + i * slot.footprint.Footprint.RowPitch,
+            raw_image->stride);
+      }
+      D3D12_RANGE written_range = {};
+      slot.readback_buffer->Unmap(0, &written_range);
+      if (sink) {
+        sink(std::move(raw_image));
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(frame_capture_mutex_);
+      slot.pending = false;
+    }
+  }
+}
+
+void D3D12CommandProcessor::SetDrawTimingCaptureEnabled(bool enabled) {
+  draw_timing_requested_ = enabled;
+  draw_timing_frame_first_draw_ = draws_issued();
+}
+
+bool D3D12CommandProcessor::GetDrawTimings(
+    std::vector<DrawTiming>& timings_out) {
+  timings_out.clear();
+  if (draw_timing_resolved_draws_.empty() || draw_timing_buffer_ == nullptr) {
+    return false;
+  }
+  AwaitAllSubmissionsCompletion();
+  size_t query_count = draw_timing_resolved_draws_.size() * 2;
+  D3D12_RANGE read_range;
+  read_range.Begin = 0;
+  read_range.End = query_count * sizeof(uint64_t);
+  void* mapping;
+  if (FAILED(draw_timing_buffer_->Map(0, &read_range, &mapping))) {
+    XELOGE("Failed to map the draw timestamp readback buffer");
+    return false;
+  }
+  const uint64_t* timestamps = reinterpret_cast<const uint64_t*>(mapping);
+  auto direct_queue = GetD3D12Context()->GetD3D12Provider()->GetDirectQueue();
+  uint64_t frequency = direct_queue->GetTimestampFrequency();
+  timings_out.reserve(draw_timing_resolved_draws_.size());
+  for (size_t i = 0; i < draw_timing_resolved_draws_.size(); ++i) {
+    const DrawTimingDraw& draw = draw_timing_resolved_draws_[i];
+    DrawTiming timing;
+    timing.draw_index = draw.draw_index;
+    timing.is_resolve = draw.is_resolve;
+    uint64_t timestamp_begin = timestamps[i * 2];
+    uint64_t timestamp_end = timestamps[i * 2 + 1];
+    timing.duration_us =
+        timestamp_end > timestamp_begin
+            ? float(double(timestamp_end - timestamp_begin) * 1000000.0 /
+                    double(frequency))
+            : 0.0f;
+    timings_out.push_back(timing);
+  }
+  D3D12_RANGE write_range = {};
+  draw_timing_buffer_->Unmap(0, &write_range);
+  return true;
+}
+
 bool D3D12CommandProcessor::SetupContext() {
   if (!CommandProcessor::SetupContext()) {
     XELOGE("Failed to initialize base command processor context");
@@ -738,6 +1065,8 @@ bool D3D12CommandProcessor::SetupContext() {
   frame_current_ = 1;
   frame_completed_ = 0;
   std::memset(closed_frame_submissions_, 0, sizeof(closed_frame_submissions_));
+  std::memset(closed_frame_timeline_ids_, 0,
+              sizeof(closed_frame_timeline_ids_));
 
   // Create the command list and one allocator because it's needed for a command
   // list.
@@ -766,8 +1095,41 @@ bool D3D12CommandProcessor::SetupContext() {
   command_list_->QueryInterface(IID_PPV_ARGS(&command_list_1_));
   deferred_command_list_ = std::make_unique<DeferredCommandList>(this);
 
-  constant_buffer_pool_ =
-      std::make_unique<ui::d3d12::UploadBufferPool>(device, 1024 * 1024);
+  // Create the command lists and the threads for parallel deferred command
+  // list replay if requested. Failures here only reduce the worker count.
+  uint32_t replay_thread_count = uint32_t(
+      std::min(std::max(cvars::d3d12_replay_threads, int32_t(0)), int32_t(15)));
+  for (uint32_t i = 0; i < replay_thread_count; ++i) {
+    auto replay_worker = std::make_unique<ReplayWorker>();
+    ID3D12CommandAllocator* replay_command_allocator;
+    if (FAILED(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            IID_PPV_ARGS(&replay_command_allocator)))) {
+      XELOGE("Failed to create a command allocator for a replay thread");
+      break;
+    }
+    replay_worker->allocators.push_back(
+        std::make_pair(replay_command_allocator, uint64_t(0)));
+    if (FAILED(device->CreateCommandList(
+            0, D3D12_COMMAND_LIST_TYPE_DIRECT, replay_command_allocator,
+            nullptr, IID_PPV_ARGS(&replay_worker->command_list)))) {
+      XELOGE("Failed to create a graphics command list for a replay thread");
+      replay_command_allocator->Release();
+      break;
+    }
+    replay_worker->command_list->Close();
+    replay_worker->command_list->QueryInterface(
+        IID_PPV_ARGS(&replay_worker->command_list_1));
+    replay_workers_.push_back(std::move(replay_worker));
+  }
+  for (uint32_t i = 0; i < uint32_t(replay_workers_.size()); ++i) {
+    replay_workers_[i]->thread =
+        xe::threading::Thread::Create({}, [this, i]() { ReplayThreadMain(i); });
+    replay_workers_[i]->thread->set_name("D3D12 Replay");
+  }
+
+  staging_memory_manager_ =
+      std::make_unique<ui::d3d12::StagingMemoryManager>(device);
   view_heap_pool_ = std::make_unique<ui::d3d12::DescriptorHeapPool>(
       device, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 32768);
   // Direct3D 12 only allows shader-visible heaps with no more than 2048
@@ -786,9 +1148,11 @@ bool D3D12CommandProcessor::SetupContext() {
     XELOGE("Failed to initialize shared memory");
     return false;
   }
+  shared_memory_global_watch_ = shared_memory_->RegisterGlobalWatch(
+      SharedMemoryGlobalWatchCallbackThunk, this);
 
-  texture_cache_ = std::make_unique<TextureCache>(this, register_file_,
-                                                  shared_memory_.get());
+  texture_cache_ = std::make_unique<TextureCache>(
+      this, register_file_, memory_, shared_memory_.get());
   if (!texture_cache_->Initialize()) {
     XELOGE("Failed to initialize the texture cache");
     return false;
@@ -865,70 +1229,80 @@ bool D3D12CommandProcessor::SetupContext() {
     return false;
   }
 
-  D3D12_RESOURCE_DESC swap_texture_desc;
-  swap_texture_desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
-  swap_texture_desc.Alignment = 0;
-  auto swap_texture_size = GetSwapTextureSize();
-  swap_texture_desc.Width = swap_texture_size.first;
-  swap_texture_desc.Height = swap_texture_size.second;
-  swap_texture_desc.DepthOrArraySize = 1;
-  swap_texture_desc.MipLevels = 1;
-  swap_texture_desc.Format = ui::d3d12::D3D12Context::kSwapChainFormat;
-  swap_texture_desc.SampleDesc.Count = 1;
-  swap_texture_desc.SampleDesc.Quality = 0;
-  swap_texture_desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
-  swap_texture_desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
-  // Can be sampled at any time, switch to render target when needed, then back.
-  if (FAILED(device->CreateCommittedResource(
-          &ui::d3d12::util::kHeapPropertiesDefault, D3D12_HEAP_FLAG_NONE,
-          &swap_texture_desc, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-          nullptr, IID_PPV_ARGS(&swap_texture_)))) {
-    XELOGE("Failed to create the command processor front buffer");
-    return false;
-  }
-  device->GetCopyableFootprints(&swap_texture_desc, 0, 1, 0,
-                                &swap_texture_copy_footprint_, nullptr, nullptr,
-                                &swap_texture_copy_size_);
-  D3D12_DESCRIPTOR_HEAP_DESC swap_descriptor_heap_desc;
-  swap_descriptor_heap_desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
-  swap_descriptor_heap_desc.NumDescriptors = 1;
-  swap_descriptor_heap_desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-  swap_descriptor_heap_desc.NodeMask = 0;
-  if (FAILED(device->CreateDescriptorHeap(
-          &swap_descriptor_heap_desc,
-          IID_PPV_ARGS(&swap_texture_rtv_descriptor_heap_)))) {
-    XELOGE("Failed to create the command processor front buffer RTV heap");
-    return false;
-  }
-  swap_texture_rtv_ =
-      swap_texture_rtv_descriptor_heap_->GetCPUDescriptorHandleForHeapStart();
-  D3D12_RENDER_TARGET_VIEW_DESC swap_rtv_desc;
-  swap_rtv_desc.Format = ui::d3d12::D3D12Context::kSwapChainFormat;
-  swap_rtv_desc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
-  swap_rtv_desc.Texture2D.MipSlice = 0;
-  swap_rtv_desc.Texture2D.PlaneSlice = 0;
-  device->CreateRenderTargetView(swap_texture_, &swap_rtv_desc,
-                                 swap_texture_rtv_);
-  swap_descriptor_heap_desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-  swap_descriptor_heap_desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-  if (FAILED(device->CreateDescriptorHeap(
-          &swap_descriptor_heap_desc,
-          IID_PPV_ARGS(&swap_texture_srv_descriptor_heap_)))) {
-    XELOGE("Failed to create the command processor front buffer SRV heap");
-    return false;
+  // Create both swap texture variants upfront - the UI thread may reference
+  // the current one at any time, so they can't be recreated when the
+  // resolution scale is switched.
+  uint32_t swap_texture_count =
+      texture_cache_->IsResolutionScale2XSupported() ? 2 : 1;
+  for (uint32_t i = 0; i < swap_texture_count; ++i) {
+    SwapTexture& swap_texture = swap_textures_[i];
+    D3D12_RESOURCE_DESC swap_texture_desc;
+    swap_texture_desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    swap_texture_desc.Alignment = 0;
+    swap_texture_desc.Width = kSwapTextureWidth << i;
+    swap_texture_desc.Height = kSwapTextureHeight << i;
+    swap_texture_desc.DepthOrArraySize = 1;
+    swap_texture_desc.MipLevels = 1;
+    swap_texture_desc.Format = ui::d3d12::D3D12Context::kSwapChainFormat;
+    swap_texture_desc.SampleDesc.Count = 1;
+    swap_texture_desc.SampleDesc.Quality = 0;
+    swap_texture_desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    swap_texture_desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+    // Can be sampled at any time, switch to render target when needed, then
+    // back.
+    if (FAILED(device->CreateCommittedResource(
+            &ui::d3d12::util::kHeapPropertiesDefault, D3D12_HEAP_FLAG_NONE,
+            &swap_texture_desc, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+            nullptr, IID_PPV_ARGS(&swap_texture.texture)))) {
+      XELOGE("Failed to create the command processor front buffer");
+      return false;
+    }
+    device->GetCopyableFootprints(&swap_texture_desc, 0, 1, 0,
+                                  &swap_texture.copy_footprint, nullptr,
+                                  nullptr, &swap_texture.copy_size);
+    D3D12_DESCRIPTOR_HEAP_DESC swap_descriptor_heap_desc;
+    swap_descriptor_heap_desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
+    swap_descriptor_heap_desc.NumDescriptors = 1;
+    swap_descriptor_heap_desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+    swap_descriptor_heap_desc.NodeMask = 0;
+    if (FAILED(device->CreateDescriptorHeap(
+            &swap_descriptor_heap_desc,
+            IID_PPV_ARGS(&swap_texture.rtv_descriptor_heap)))) {
+      XELOGE("Failed to create the command processor front buffer RTV heap");
+      return false;
+    }
+    swap_texture.rtv =
+        swap_texture.rtv_descriptor_heap->GetCPUDescriptorHandleForHeapStart();
+    D3D12_RENDER_TARGET_VIEW_DESC swap_rtv_desc;
+    swap_rtv_desc.Format = ui::d3d12::D3D12Context::kSwapChainFormat;
+    swap_rtv_desc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
+    swap_rtv_desc.Texture2D.MipSlice = 0;
+    swap_rtv_desc.Texture2D.PlaneSlice = 0;
+    device->CreateRenderTargetView(swap_texture.texture, &swap_rtv_desc,
+                                   swap_texture.rtv);
+    swap_descriptor_heap_desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+    swap_descriptor_heap_desc.Flags =
+        D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+    if (FAILED(device->CreateDescriptorHeap(
+            &swap_descriptor_heap_desc,
+            IID_PPV_ARGS(&swap_texture.srv_descriptor_heap)))) {
+      XELOGE("Failed to create the command processor front buffer SRV heap");
+      return false;
+    }
+    D3D12_SHADER_RESOURCE_VIEW_DESC swap_srv_desc;
+    swap_srv_desc.Format = ui::d3d12::D3D12Context::kSwapChainFormat;
+    swap_srv_desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    swap_srv_desc.Shader4ComponentMapping =
+        D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    swap_srv_desc.Texture2D.MostDetailedMip = 0;
+    swap_srv_desc.Texture2D.MipLevels = 1;
+    swap_srv_desc.Texture2D.PlaneSlice = 0;
+    swap_srv_desc.Texture2D.ResourceMinLODClamp = 0.0f;
+    device->CreateShaderResourceView(
+        swap_texture.texture, &swap_srv_desc,
+        swap_texture.srv_descriptor_heap
+            ->GetCPUDescriptorHandleForHeapStart());
   }
-  D3D12_SHADER_RESOURCE_VIEW_DESC swap_srv_desc;
-  swap_srv_desc.Format = ui::d3d12::D3D12Context::kSwapChainFormat;
-  swap_srv_desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-  swap_srv_desc.Shader4ComponentMapping =
-      D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-  swap_srv_desc.Texture2D.MostDetailedMip = 0;
-  swap_srv_desc.Texture2D.MipLevels = 1;
-  swap_srv_desc.Texture2D.PlaneSlice = 0;
-  swap_srv_desc.Texture2D.ResourceMinLODClamp = 0.0f;
-  device->CreateShaderResourceView(
-      swap_texture_, &swap_srv_desc,
-      swap_texture_srv_descriptor_heap_->GetCPUDescriptorHandleForHeapStart());
 
   pix_capture_requested_.store(false, std::memory_order_relaxed);
   pix_capturing_ = false;
@@ -938,37 +1312,73 @@ bool D3D12CommandProcessor::SetupContext() {
   // Force writing of new format data.
   std::memset(system_constants_color_formats_, 0xFF,
               sizeof(system_constants_color_formats_));
+  // Force a full system constant update after the reset.
+  system_constants_input_regs_dirty_ = true;
+  system_constants_last_inputs_valid_ = false;
 
   return true;
 }
 
 void D3D12CommandProcessor::ShutdownContext() {
+  EndFrameCapture();
+
   AwaitAllSubmissionsCompletion();
 
   ui::d3d12::util::ReleaseAndNull(readback_buffer_);
   readback_buffer_size_ = 0;
 
+  draw_timing_pending_draws_.clear();
+  draw_timing_resolved_draws_.clear();
+  draw_timing_frame_open_ = false;
+  draw_timing_draw_open_ = false;
+  ui::d3d12::util::ReleaseAndNull(draw_timing_buffer_);
+  ui::d3d12::util::ReleaseAndNull(draw_timing_query_heap_);
+
+  // Perform the sample count writes the completed submissions have produced,
+  // then drop the rest of the query state.
+  ProcessSampleCountWrites();
+  sample_count_writes_.clear();
+  sample_count_values_.clear();
+  sample_count_ring_next_ = 0;
+  occlusion_queries_armed_ = false;
+  occlusion_query_draw_open_ = false;
+  occlusion_query_draw_index_ = UINT32_MAX;
+  occlusion_query_next_index_ = 0;
+  ui::d3d12::util::ReleaseAndNull(sample_count_buffer_);
+  ui::d3d12::util::ReleaseAndNull(occlusion_query_heap_);
+
+  // Perform the memory export writes the completed submissions have produced,
+  // then drop the readback ring.
+  ProcessMemExportWrites();
+  memexport_readbacks_.clear();
+  memexport_ring_next_ = 0;
+  memexport_ring_pending_ = 0;
+  ui::d3d12::util::ReleaseAndNull(memexport_ring_buffer_);
+
   ui::d3d12::util::ReleaseAndNull(scratch_buffer_);
   scratch_buffer_size_ = 0;
 
-  for (auto& buffer_for_deletion : buffers_for_deletion_) {
-    buffer_for_deletion.buffer->Release();
+  for (auto& resource_for_deletion : resources_for_deletion_) {
+    resource_for_deletion.resource->Release();
   }
-  buffers_for_deletion_.clear();
+  resources_for_deletion_.clear();
 
-  if (swap_texture_srv_descriptor_heap_ != nullptr) {
-    {
-      std::lock_guard<std::mutex> lock(swap_state_.mutex);
-      swap_state_.pending = false;
-      swap_state_.front_buffer_texture = 0;
+  {
+    std::lock_guard<std::mutex> lock(swap_state_.mutex);
+    swap_state_.pending = false;
+    swap_state_.front_buffer_texture = 0;
+  }
+  for (uint32_t i = 0; i < xe::countof(swap_textures_); ++i) {
+    SwapTexture& swap_texture = swap_textures_[i];
+    if (swap_texture.srv_descriptor_heap != nullptr) {
+      // TODO(Triang3l): Ensure this is synchronized. The display context may
+      // not exist at this point, so awaiting its fence doesn't always work.
+      swap_texture.srv_descriptor_heap->Release();
+      swap_texture.srv_descriptor_heap = nullptr;
     }
-    // TODO(Triang3l): Ensure this is synchronized. The display context may not
-    // exist at this point, so awaiting its fence doesn't always work.
-    swap_texture_srv_descriptor_heap_->Release();
-    swap_texture_srv_descriptor_heap_ = nullptr;
+    ui::d3d12::util::ReleaseAndNull(swap_texture.rtv_descriptor_heap);
+    ui::d3d12::util::ReleaseAndNull(swap_texture.texture);
   }
-  ui::d3d12::util::ReleaseAndNull(swap_texture_rtv_descriptor_heap_);
-  ui::d3d12::util::ReleaseAndNull(swap_texture_);
 
   // Don't need the data anymore, so zero range.
   if (gamma_ramp_upload_mapping_ != nullptr) {
@@ -983,7 +1393,6 @@ void D3D12CommandProcessor::ShutdownContext() {
 
   sampler_heap_pool_.reset();
   view_heap_pool_.reset();
-  constant_buffer_pool_.reset();
 
   primitive_converter_.reset();
 
@@ -999,8 +1408,39 @@ void D3D12CommandProcessor::ShutdownContext() {
   }
   root_signatures_.clear();
 
+  if (shared_memory_global_watch_ != nullptr) {
+    shared_memory_->UnregisterGlobalWatch(shared_memory_global_watch_);
+    shared_memory_global_watch_ = nullptr;
+  }
   shared_memory_.reset();
 
+  // After all the consumers of the shared staging memory.
+  staging_memory_manager_.reset();
+
+  if (!replay_workers_.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(replay_mutex_);
+      replay_shutdown_ = true;
+    }
+    replay_cond_.notify_all();
+    for (auto& replay_worker : replay_workers_) {
+      xe::threading::Wait(replay_worker->thread.get(), false);
+      replay_worker->thread.reset();
+      ui::d3d12::util::ReleaseAndNull(replay_worker->command_list_1);
+      ui::d3d12::util::ReleaseAndNull(replay_worker->command_list);
+      for (auto& replay_allocator : replay_worker->allocators) {
+        replay_allocator.first->Release();
+      }
+      replay_worker->allocators.clear();
+    }
+    replay_workers_.clear();
+    replay_shutdown_ = false;
+    replay_generation_ = 0;
+    replay_outstanding_ = 0;
+  }
+  replay_chunks_.clear();
+  replay_execute_lists_.clear();
+
   deferred_command_list_.reset();
   ui::d3d12::util::ReleaseAndNull(command_list_1_);
   ui::d3d12::util::ReleaseAndNull(command_list_);
@@ -1010,6 +1450,8 @@ void D3D12CommandProcessor::ShutdownContext() {
   frame_current_ = 1;
   frame_completed_ = 0;
   std::memset(closed_frame_submissions_, 0, sizeof(closed_frame_submissions_));
+  std::memset(closed_frame_timeline_ids_, 0,
+              sizeof(closed_frame_timeline_ids_));
 
   // First release the fence since it may reference the event.
   ui::d3d12::util::ReleaseAndNull(submission_fence_);
@@ -1027,6 +1469,12 @@ void D3D12CommandProcessor::ShutdownContext() {
 void D3D12CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   CommandProcessor::WriteRegister(index, value);
 
+  if (index < RegisterFile::kRegisterCount &&
+      (system_constants_used_register_bits_[index >> 6] &
+       (uint64_t(1) << (index & 63)))) {
+    system_constants_input_regs_dirty_ = true;
+  }
+
   if (index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
       index <= XE_GPU_REG_SHADER_CONSTANT_511_W) {
     if (frame_open_) {
@@ -1051,6 +1499,9 @@ void D3D12CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   } else if (index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
              index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) {
     cbuffer_bindings_fetch_.up_to_date = false;
+    uint32_t vfetch_index = (index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 2;
+    current_vfetch_resident_[vfetch_index >> 6] &=
+        ~(1ull << (vfetch_index & 63));
     if (texture_cache_ != nullptr) {
       texture_cache_->TextureFetchConstantWritten(
           (index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6);
@@ -1064,6 +1515,156 @@ void D3D12CommandProcessor::WriteRegister(uint32_t index, uint32_t value) {
   }
 }
 
+void D3D12CommandProcessor::SharedMemoryGlobalWatchCallbackThunk(
+    void* context, uint32_t address_first, uint32_t address_last,
+    bool invalidated_by_gpu) {
+  D3D12CommandProcessor* command_processor =
+      reinterpret_cast<D3D12CommandProcessor*>(context);
+  command_processor->SharedMemoryGlobalWatchCallback(address_first,
+                                                     address_last,
+                                                     invalidated_by_gpu);
+}
+
+void D3D12CommandProcessor::SharedMemoryGlobalWatchCallback(
+    uint32_t address_first, uint32_t address_last, bool invalidated_by_gpu) {
+  // May be called from any thread writing to the guest memory, so just raise
+  // the flag for the next draw. Ranges aren't tracked per fetch constant, and
+  // invalidation is rare relative to draws, so dropping everything is fine.
+  vfetch_residency_invalidated_.store(true, std::memory_order_release);
+}
+
+void D3D12CommandProcessor::WriteRegisterRangeFromRing(RingBuffer* reader,
+                                                       uint32_t base,
+                                                       uint32_t num_registers) {
+  // Whether the register needs the full per-register processing with all the
+  // side effects (this includes registers the base class handles specially and
+  // the gamma ramp).
+  auto has_side_effects = [](uint32_t index) {
+    return index >= RegisterFile::kRegisterCount ||
+           index == XE_GPU_REG_COHER_STATUS_HOST ||
+           (index >= XE_GPU_REG_SCRATCH_REG0 &&
+            index <= XE_GPU_REG_SCRATCH_REG7) ||
+           index == XE_GPU_REG_DC_LUT_PWL_DATA ||
+           index == XE_GPU_REG_DC_LUT_30_COLOR ||
+           index == XE_GPU_REG_DC_LUT_RW_MODE;
+  };
+  // Whether the register is a shader constant, which can be written in bulk,
+  // but needs its own dirty flag updates afterwards.
+  auto is_constant = [](uint32_t index) {
+    return (index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
+            index <= XE_GPU_REG_SHADER_CONSTANT_511_W) ||
+           (index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031 &&
+            index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31) ||
+           (index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
+            index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5);
+  };
+  uint32_t end = base + num_registers;
+  uint32_t index = base;
+  while (index < end) {
+    if (index >= XE_GPU_REG_SHADER_CONSTANT_000_X &&
+        index <= XE_GPU_REG_SHADER_CONSTANT_511_W) {
+      uint32_t range_end =
+          std::min(end, uint32_t(XE_GPU_REG_SHADER_CONSTANT_511_W) + 1);
+      CopyPlainRegisterRangeFromRing(reader, index, range_end - index);
+      if (frame_open_) {
+        uint32_t float_constant_first =
+            (index - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
+        uint32_t float_constant_last =
+            (range_end - 1 - XE_GPU_REG_SHADER_CONSTANT_000_X) >> 2;
+        for (uint32_t i = float_constant_first; i <= float_constant_last; ++i) {
+          if (i >= 256) {
+            uint32_t float_constant_index = i - 256;
+            if (current_float_constant_map_pixel_[float_constant_index >> 6] &
+                (1ull << (float_constant_index & 63))) {
+              cbuffer_bindings_float_pixel_.up_to_date = false;
+            }
+          } else {
+            if (current_float_constant_map_vertex_[i >> 6] &
+                (1ull << (i & 63))) {
+              cbuffer_bindings_float_vertex_.up_to_date = false;
+            }
+          }
+        }
+      }
+      index = range_end;
+    } else if (index >= XE_GPU_REG_SHADER_CONSTANT_BOOL_000_031 &&
+               index <= XE_GPU_REG_SHADER_CONSTANT_LOOP_31) {
+      uint32_t range_end =
+          std::min(end, uint32_t(XE_GPU_REG_SHADER_CONSTANT_LOOP_31) + 1);
+      CopyPlainRegisterRangeFromRing(reader, index, range_end - index);
+      cbuffer_bindings_bool_loop_.up_to_date = false;
+      index = range_end;
+    } else if (index >= XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0 &&
+               index <= XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) {
+      uint32_t range_end =
+          std::min(end, uint32_t(XE_GPU_REG_SHADER_CONSTANT_FETCH_31_5) + 1);
+      CopyPlainRegisterRangeFromRing(reader, index, range_end - index);
+      cbuffer_bindings_fetch_.up_to_date = false;
+      uint32_t vfetch_first =
+          (index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 2;
+      uint32_t vfetch_last =
+          (range_end - 1 - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 2;
+      for (uint32_t i = vfetch_first; i <= vfetch_last; ++i) {
+        current_vfetch_resident_[i >> 6] &= ~(1ull << (i & 63));
+      }
+      if (texture_cache_ != nullptr) {
+        uint32_t fetch_constant_first =
+            (index - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6;
+        uint32_t fetch_constant_last =
+            (range_end - 1 - XE_GPU_REG_SHADER_CONSTANT_FETCH_00_0) / 6;
+        for (uint32_t i = fetch_constant_first; i <= fetch_constant_last; ++i) {
+          texture_cache_->TextureFetchConstantWritten(i);
+        }
+      }
+      index = range_end;
+    } else if (has_side_effects(index)) {
+      uint32_t data = reader->ReadAndSwap<uint32_t>();
+      WriteRegister(index, data);
+      ++index;
+    } else {
+      // Bulk copy plain registers up to the next register needing special
+      // handling.
+      uint32_t range_end = index + 1;
+      while (range_end < end && !has_side_effects(range_end) &&
+             !is_constant(range_end)) {
+        ++range_end;
+      }
+      CopyPlainRegisterRangeFromRing(reader, index, range_end - index);
+      if (IsSystemConstantsRegisterRangeUsed(index, range_end - index)) {
+        system_constants_input_regs_dirty_ = true;
+      }
+      index = range_end;
+    }
+  }
+}
+
+bool D3D12CommandProcessor::IsSystemConstantsRegisterRangeUsed(
+    uint32_t base, uint32_t num_registers) const {
+  uint32_t last = std::min(base + num_registers,
+                           uint32_t(RegisterFile::kRegisterCount));
+  if (base >= last) {
+    return false;
+  }
+  --last;
+  uint32_t word_first = base >> 6, word_last = last >> 6;
+  for (uint32_t i = word_first; i <= word_last; ++i) {
+    uint64_t word = system_constants_used_register_bits_[i];
+    if (!word) {
+      continue;
+    }
+    if (i == word_first) {
+      word &= ~((uint64_t(1) << (base & 63)) - 1);
+    }
+    if (i == word_last && (last & 63) != 63) {
+      word &= (uint64_t(1) << ((last & 63) + 1)) - 1;
+    }
+    if (word) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void D3D12CommandProcessor::PerformSwap(uint32_t frontbuffer_ptr,
                                         uint32_t frontbuffer_width,
                                         uint32_t frontbuffer_height) {
@@ -1168,7 +1769,8 @@ void D3D12CommandProcessor::PerformSwap(uint32_t frontbuffer_ptr,
 
       // The swap texture is kept as an SRV because the graphics system may draw
       // with it at any time. It's switched to RTV and back when needed.
-      PushTransitionBarrier(swap_texture_,
+      const SwapTexture& swap_texture = GetCurrentSwapTexture();
+      PushTransitionBarrier(swap_texture.texture,
                             D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
                             D3D12_RESOURCE_STATE_RENDER_TARGET);
       PushTransitionBarrier(gamma_ramp_texture_, gamma_ramp_texture_state_,
@@ -1179,7 +1781,7 @@ void D3D12CommandProcessor::PerformSwap(uint32_t frontbuffer_ptr,
       auto swap_texture_size = GetSwapTextureSize();
 
       // Draw the stretching rectangle.
-      deferred_command_list_->D3DOMSetRenderTargets(1, &swap_texture_rtv_, TRUE,
+      deferred_command_list_->D3DOMSetRenderTargets(1, &swap_texture.rtv, TRUE,
                                                     nullptr);
       D3D12_VIEWPORT viewport;
       viewport.TopLeftX = 0.0f;
@@ -1206,7 +1808,8 @@ void D3D12CommandProcessor::PerformSwap(uint32_t frontbuffer_ptr,
       // Ending the current frame anyway, so no need to reset the current render
       // targets when using ROV.
 
-      PushTransitionBarrier(swap_texture_, D3D12_RESOURCE_STATE_RENDER_TARGET,
+      PushTransitionBarrier(swap_texture.texture,
+                            D3D12_RESOURCE_STATE_RENDER_TARGET,
                             D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
       // Don't care about graphics state because the frame is ending anyway.
       {
@@ -1214,8 +1817,10 @@ void D3D12CommandProcessor::PerformSwap(uint32_t frontbuffer_ptr,
         swap_state_.width = swap_texture_size.first;
         swap_state_.height = swap_texture_size.second;
         swap_state_.front_buffer_texture =
-            reinterpret_cast<uintptr_t>(swap_texture_srv_descriptor_heap_);
+            reinterpret_cast<uintptr_t>(swap_texture.srv_descriptor_heap);
       }
+
+      QueueFrameCapture();
     }
   }
 
@@ -1230,6 +1835,32 @@ Shader* D3D12CommandProcessor::LoadShader(ShaderType shader_type,
                                      dword_count);
 }
 
+void D3D12CommandProcessor::OnPrescanDraw(Shader* vertex_shader,
+                                          Shader* pixel_shader,
+                                          uint32_t sq_program_cntl,
+                                          uint32_t vgt_output_path_cntl,
+                                          PrimitiveType prim_type) {
+  // Derive the tessellation state the same way IssueDraw will, from the
+  // register values the lookahead scan saw, so the queued translation
+  // matches the one the draw will request.
+  bool tessellated;
+  if (uint32_t(prim_type) >=
+      uint32_t(PrimitiveType::kExplicitMajorModeForceStart)) {
+    reg::VGT_OUTPUT_PATH_CNTL output_path_cntl;
+    output_path_cntl.value = vgt_output_path_cntl;
+    tessellated = output_path_cntl.path_select ==
+                  xenos::VGTOutputPath::kTessellationEnable;
+  } else {
+    tessellated = false;
+  }
+  reg::SQ_PROGRAM_CNTL program_cntl;
+  program_cntl.value = sq_program_cntl;
+  pipeline_cache_->QueueShaderTranslation(
+      static_cast<D3D12Shader*>(vertex_shader),
+      static_cast<D3D12Shader*>(pixel_shader), program_cntl, tessellated,
+      prim_type, prescan_from_trace_);
+}
+
 bool D3D12CommandProcessor::IssueDraw(PrimitiveType primitive_type,
                                       uint32_t index_count,
                                       IndexBufferInfo* index_buffer_info) {
@@ -1452,13 +2083,17 @@ bool D3D12CommandProcessor::IssueDraw(PrimitiveType primitive_type,
     return false;
   }
 
-  // Ensure vertex and index buffers are resident and draw.
-  // TODO(Triang3l): Cache residency for ranges in a way similar to how texture
-  // validity will be tracked.
-  uint64_t vertex_buffers_resident[2] = {};
+  // Ensure vertex and index buffers are resident and draw. Residency of each
+  // vertex fetch constant is cached across draws until the constant is
+  // rewritten or something is invalidated in the shared memory.
+  if (vfetch_residency_invalidated_.exchange(false,
+                                             std::memory_order_acquire)) {
+    std::memset(current_vfetch_resident_, 0,
+                sizeof(current_vfetch_resident_));
+  }
   for (const auto& vertex_binding : vertex_shader->vertex_bindings()) {
     uint32_t vfetch_index = vertex_binding.fetch_constant;
-    if (vertex_buffers_resident[vfetch_index >> 6] &
+    if (current_vfetch_resident_[vfetch_index >> 6] &
         (1ull << (vfetch_index & 63))) {
       continue;
     }
@@ -1477,16 +2112,13 @@ bool D3D12CommandProcessor::IssueDraw(PrimitiveType primitive_type,
           vfetch_constant.address << 2, vfetch_constant.size << 2);
       return false;
     }
-    vertex_buffers_resident[vfetch_index >> 6] |= 1ull << (vfetch_index & 63);
+    current_vfetch_resident_[vfetch_index >> 6] |= 1ull
+                                                   << (vfetch_index & 63);
   }
 
   // Gather memexport ranges and ensure the heaps for them are resident, and
   // also load the data surrounding the export and to fill the regions that
   // won't be modified by the shaders.
-  struct MemExportRange {
-    uint32_t base_address_dwords;
-    uint32_t size_dwords;
-  };
   MemExportRange memexport_ranges[512];
   uint32_t memexport_range_count = 0;
   if (memexport_used_vertex) {
@@ -1656,12 +2288,60 @@ bool D3D12CommandProcessor::IssueDraw(PrimitiveType primitive_type,
       shared_memory_->UseForReading();
     }
     SubmitBarriers();
-    if (adaptive_tessellation) {
-      // Index buffer used for per-edge factors.
-      deferred_command_list_->D3DDrawInstanced(index_count, 1, 0, 0);
+    // Consecutive draws reading adjacent index ranges with no state changes
+    // in between are merged into the previously recorded draw. Any state
+    // difference - pipeline, bindings, constants, barriers - would have
+    // recorded commands, so comparing the stream length covers all of it.
+    // Only list topologies can be concatenated, and only straight from the
+    // shared memory with the whole bound range drawn. Not done while
+    // per-draw timing is capturing, so its stats stay exact, or while draws
+    // are wrapped in occlusion queries, so counts stay per-draw.
+    uint32_t index_data_size = index_count * index_size;
+    bool draw_mergeable =
+        cvars::d3d12_draw_merging && !adaptive_tessellation &&
+        !memexport_used && scratch_index_buffer == nullptr &&
+        conversion_result ==
+            PrimitiveConverter::ConversionResult::kConversionNotNeeded &&
+        index_buffer_view.SizeInBytes == index_data_size &&
+        (primitive_topology == D3D_PRIMITIVE_TOPOLOGY_POINTLIST ||
+         primitive_topology == D3D_PRIMITIVE_TOPOLOGY_LINELIST ||
+         primitive_topology == D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST) &&
+        !draw_timing_frame_open_ && !occlusion_queries_armed_;
+    if (draw_mergeable && draw_merge_valid_ &&
+        deferred_command_list_->GetCommandStreamLength() ==
+            draw_merge_stream_length_ &&
+        index_buffer_view.Format == draw_merge_index_format_ &&
+        index_buffer_view.BufferLocation == draw_merge_next_index_location_) {
+      deferred_command_list_->MergeDrawIndexedInstanced(
+          draw_merge_index_buffer_args_offset_, draw_merge_draw_args_offset_,
+          index_count, index_data_size);
+      draw_merge_next_index_location_ += index_data_size;
     } else {
-      deferred_command_list_->D3DIASetIndexBuffer(&index_buffer_view);
-      deferred_command_list_->D3DDrawIndexedInstanced(index_count, 1, 0, 0, 0);
+      draw_merge_valid_ = false;
+      BeginDrawTiming(false);
+      BeginDrawOcclusionQuery();
+      if (adaptive_tessellation) {
+        // Index buffer used for per-edge factors.
+        deferred_command_list_->D3DDrawInstanced(index_count, 1, 0, 0);
+      } else {
+        size_t index_buffer_args_offset =
+            deferred_command_list_->D3DIASetIndexBuffer(&index_buffer_view);
+        size_t draw_args_offset =
+            deferred_command_list_->D3DDrawIndexedInstanced(index_count, 1, 0,
+                                                            0, 0);
+        if (draw_mergeable) {
+          draw_merge_valid_ = true;
+          draw_merge_stream_length_ =
+              deferred_command_list_->GetCommandStreamLength();
+          draw_merge_index_buffer_args_offset_ = index_buffer_args_offset;
+          draw_merge_draw_args_offset_ = draw_args_offset;
+          draw_merge_next_index_location_ =
+              index_buffer_view.BufferLocation + index_data_size;
+          draw_merge_index_format_ = index_buffer_view.Format;
+        }
+      }
+      EndDrawOcclusionQuery();
+      EndDrawTiming();
     }
     if (scratch_index_buffer != nullptr) {
       ReleaseScratchGPUBuffer(scratch_index_buffer,
@@ -1680,6 +2360,8 @@ bool D3D12CommandProcessor::IssueDraw(PrimitiveType primitive_type,
       shared_memory_->UseForReading();
     }
     SubmitBarriers();
+    BeginDrawTiming(false);
+    BeginDrawOcclusionQuery();
     if (conversion_gpu_address) {
       D3D12_INDEX_BUFFER_VIEW index_buffer_view;
       index_buffer_view.BufferLocation = conversion_gpu_address;
@@ -1691,6 +2373,8 @@ bool D3D12CommandProcessor::IssueDraw(PrimitiveType primitive_type,
     } else {
       deferred_command_list_->D3DDrawInstanced(index_count, 1, 0, 0);
     }
+    EndDrawOcclusionQuery();
+    EndDrawTiming();
   }
 
   if (memexport_used) {
@@ -1710,39 +2394,50 @@ bool D3D12CommandProcessor::IssueDraw(PrimitiveType primitive_type,
         memexport_total_size += memexport_ranges[i].size_dwords << 2;
       }
       if (memexport_total_size != 0) {
-        ID3D12Resource* readback_buffer =
-            RequestReadbackBuffer(memexport_total_size);
-        if (readback_buffer != nullptr) {
-          shared_memory_->UseAsCopySource();
-          SubmitBarriers();
-          ID3D12Resource* shared_memory_buffer = shared_memory_->GetBuffer();
-          uint32_t readback_buffer_offset = 0;
-          for (uint32_t i = 0; i < memexport_range_count; ++i) {
-            const MemExportRange& memexport_range = memexport_ranges[i];
-            uint32_t memexport_range_size = memexport_range.size_dwords << 2;
-            deferred_command_list_->D3DCopyBufferRegion(
-                readback_buffer, readback_buffer_offset, shared_memory_buffer,
-                memexport_range.base_address_dwords << 2, memexport_range_size);
-            readback_buffer_offset += memexport_range_size;
-          }
-          AwaitAllSubmissionsCompletion();
-          D3D12_RANGE readback_range;
-          readback_range.Begin = 0;
-          readback_range.End = memexport_total_size;
-          void* readback_mapping;
-          if (SUCCEEDED(readback_buffer->Map(0, &readback_range,
-                                             &readback_mapping))) {
-            const uint32_t* readback_dwords =
-                reinterpret_cast<const uint32_t*>(readback_mapping);
+        // Pre-initiate the readback right after the producing draw and
+        // perform the guest memory write when the GPU completes the
+        // submission, so exports don't serialize the CPU and the GPU.
+        bool readback_queued =
+            cvars::d3d12_readback_memexport_pipelined &&
+            QueueMemExportReadback(memexport_ranges, memexport_range_count,
+                                   memexport_total_size);
+        if (!readback_queued) {
+          ID3D12Resource* readback_buffer =
+              RequestReadbackBuffer(memexport_total_size);
+          if (readback_buffer != nullptr) {
+            shared_memory_->UseAsCopySource();
+            SubmitBarriers();
+            ID3D12Resource* shared_memory_buffer = shared_memory_->GetBuffer();
+            uint32_t readback_buffer_offset = 0;
             for (uint32_t i = 0; i < memexport_range_count; ++i) {
               const MemExportRange& memexport_range = memexport_ranges[i];
-              std::memcpy(memory_->TranslatePhysical(
-                              memexport_range.base_address_dwords << 2),
-                          readback_dwords, memexport_range.size_dwords << 2);
-              readback_dwords += memexport_range.size_dwords;
+              uint32_t memexport_range_size = memexport_range.size_dwords << 2;
+              deferred_command_list_->D3DCopyBufferRegion(
+                  readback_buffer, readback_buffer_offset,
+                  shared_memory_buffer,
+                  memexport_range.base_address_dwords << 2,
+                  memexport_range_size);
+              readback_buffer_offset += memexport_range_size;
+            }
+            AwaitAllSubmissionsCompletion();
+            D3D12_RANGE readback_range;
+            readback_range.Begin = 0;
+            readback_range.End = memexport_total_size;
+            void* readback_mapping;
+            if (SUCCEEDED(readback_buffer->Map(0, &readback_range,
+                                               &readback_mapping))) {
+              const uint32_t* readback_dwords =
+                  reinterpret_cast<const uint32_t*>(readback_mapping);
+              for (uint32_t i = 0; i < memexport_range_count; ++i) {
+                const MemExportRange& memexport_range = memexport_ranges[i];
+                std::memcpy(memory_->TranslatePhysical(
+                                memexport_range.base_address_dwords << 2),
+                            readback_dwords, memexport_range.size_dwords << 2);
+                readback_dwords += memexport_range.size_dwords;
+              }
+              D3D12_RANGE readback_write_range = {};
+              readback_buffer->Unmap(0, &readback_write_range);
             }
-            D3D12_RANGE readback_write_range = {};
-            readback_buffer->Unmap(0, &readback_write_range);
           }
         }
       }
@@ -1780,10 +2475,13 @@ bool D3D12CommandProcessor::IssueCopy() {
   SCOPE_profile_cpu_f("gpu");
 #endif  // FINE_GRAINED_DRAW_SCOPES
   BeginSubmission(true);
+  BeginDrawTiming(true);
   uint32_t written_address, written_length;
-  if (!render_target_cache_->Resolve(shared_memory_.get(), texture_cache_.get(),
-                                     memory_, written_address,
-                                     written_length)) {
+  bool resolved = render_target_cache_->Resolve(
+      shared_memory_.get(), texture_cache_.get(), memory_, written_address,
+      written_length);
+  EndDrawTiming();
+  if (!resolved) {
     return false;
   }
   if (cvars::d3d12_readback_resolve && !texture_cache_->IsResolutionScale2X() &&
@@ -1830,9 +2528,16 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
   // resources early) and specifically for frames (not to queue too many).
   submission_completed_ = submission_fence_->GetCompletedValue();
   if (is_opening_frame) {
-    // Await the availability of the current frame.
-    uint64_t frame_current_last_submission =
-        closed_frame_submissions_[frame_current_ % kQueueFrames];
+    // Await the availability of the current frame slot. With a lower
+    // --d3d12_queued_frames, await the completion of more recent frames too,
+    // so at most that many frames (including the one being opened) are in
+    // flight at once - at the slot of frame N - limit, the last stored
+    // submission is that of frame N - limit itself since later frames using
+    // the slot haven't been closed yet.
+    uint32_t queued_frames = uint32_t(std::min(
+        std::max(cvars::d3d12_queued_frames, 1), int32_t(kQueueFrames)));
+    uint64_t frame_current_last_submission = closed_frame_submissions_[
+        (frame_current_ + kQueueFrames - queued_frames) % kQueueFrames];
     if (frame_current_last_submission > submission_completed_) {
       submission_fence_->SetEventOnCompletion(
           frame_current_last_submission, submission_fence_completion_event_);
@@ -1842,6 +2547,7 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
     // Update the completed frame index, also obtaining the actual completed
     // frame number (since the CPU may be actually less than 3 frames behind)
     // before reclaiming resources tracked with the frame number.
+    uint64_t frame_completed_previously = frame_completed_;
     frame_completed_ =
         std::max(frame_current_, uint64_t(kQueueFrames)) - kQueueFrames;
     for (uint64_t frame = frame_completed_ + 1; frame < frame_current_;
@@ -1852,6 +2558,14 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
       }
       frame_completed_ = frame;
     }
+    // Report the GPU completion of the newly completed frames to the frame
+    // timeline - the tick recorded is when the completion was observed here,
+    // not when the fence was signaled.
+    for (uint64_t frame = frame_completed_previously + 1;
+         frame <= frame_completed_; ++frame) {
+      FrameTimeline::RecordGPUCompletion(
+          closed_frame_timeline_ids_[frame % kQueueFrames]);
+    }
   }
 
   // Reclaim command allocators.
@@ -1875,17 +2589,23 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
     command_allocator_submitted_last_ = nullptr;
   }
 
-  // Delete transient buffers marked for deletion.
-  auto erase_buffers_end = buffers_for_deletion_.begin();
-  while (erase_buffers_end != buffers_for_deletion_.end()) {
-    if (erase_buffers_end->last_usage_submission > submission_completed_) {
-      ++erase_buffers_end;
+  // Release the resources whose deletion was deferred until their last
+  // usage submission completed on the GPU.
+  auto erase_resources_end = resources_for_deletion_.begin();
+  while (erase_resources_end != resources_for_deletion_.end()) {
+    if (erase_resources_end->last_usage_submission > submission_completed_) {
       break;
     }
-    erase_buffers_end->buffer->Release();
-    ++erase_buffers_end;
+    erase_resources_end->resource->Release();
+    ++erase_resources_end;
   }
-  buffers_for_deletion_.erase(buffers_for_deletion_.begin(), erase_buffers_end);
+  resources_for_deletion_.erase(resources_for_deletion_.begin(),
+                                erase_resources_end);
+
+  // Perform the sample count and memory export writes whose submissions have
+  // been completed.
+  ProcessSampleCountWrites();
+  ProcessMemExportWrites();
 
   if (!submission_open_) {
     submission_open_ = true;
@@ -1908,6 +2628,11 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
     current_view_heap_ = nullptr;
     current_sampler_heap_ = nullptr;
     primitive_topology_ = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+    draw_merge_valid_ = false;
+    // Occlusion query heap slots are reused from the start in every
+    // submission, and queries of older submissions can't be resolved anymore.
+    occlusion_query_next_index_ = 0;
+    occlusion_query_draw_index_ = UINT32_MAX;
 
     shared_memory_->BeginSubmission();
 
@@ -1929,6 +2654,8 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
     cbuffer_bindings_float_pixel_.up_to_date = false;
     cbuffer_bindings_bool_loop_.up_to_date = false;
     cbuffer_bindings_fetch_.up_to_date = false;
+    std::memset(current_vfetch_resident_, 0,
+                sizeof(current_vfetch_resident_));
     draw_view_heap_index_ = ui::d3d12::DescriptorHeapPool::kHeapIndexInvalid;
     draw_sampler_heap_index_ = ui::d3d12::DescriptorHeapPool::kHeapIndexInvalid;
     texture_bindings_written_vertex_ = false;
@@ -1938,7 +2665,7 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
 
     // Reclaim pool pages - no need to do this every small submission since some
     // may be reused.
-    constant_buffer_pool_->Reclaim(frame_completed_);
+    staging_memory_manager_->Reclaim(frame_completed_);
     view_heap_pool_->Reclaim(frame_completed_);
     sampler_heap_pool_->Reclaim(frame_completed_);
 
@@ -1952,9 +2679,17 @@ void D3D12CommandProcessor::BeginSubmission(bool is_guest_command) {
       }
     }
 
+    shared_memory_->BeginFrame();
+
     texture_cache_->BeginFrame();
 
     primitive_converter_->BeginFrame();
+
+    if (draw_timing_requested_) {
+      // Start capturing the durations of the new frame's draws.
+      draw_timing_frame_open_ = EnsureDrawTimingResources();
+      draw_timing_pending_draws_.clear();
+    }
   }
 }
 
@@ -1990,21 +2725,85 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
 
     pipeline_cache_->EndSubmission();
 
+    if (is_closing_frame && draw_timing_frame_open_) {
+      // Gather the timestamps written throughout the frame with its last
+      // submission so GetDrawTimings can read them back after awaiting
+      // completion.
+      if (!draw_timing_pending_draws_.empty()) {
+        deferred_command_list_->D3DResolveQueryData(
+            draw_timing_query_heap_, D3D12_QUERY_TYPE_TIMESTAMP, 0,
+            UINT(draw_timing_pending_draws_.size() * 2), draw_timing_buffer_,
+            0);
+      }
+      draw_timing_resolved_draws_.swap(draw_timing_pending_draws_);
+      draw_timing_pending_draws_.clear();
+      draw_timing_frame_open_ = false;
+    }
+
     // Submit barriers now because resources with the queued barriers may be
     // destroyed between frames.
     SubmitBarriers();
 
+    // Execute the uploads recorded on the copy queue for this submission and
+    // make the direct queue wait for them.
+    shared_memory_->SubmitUploads();
+
     auto direct_queue = provider->GetDirectQueue();
 
-    // Submit the command list.
+    // Submit the command list, with parts of the deferred command list
+    // recorded on the replay threads if enabled and the stream could be split.
     ID3D12CommandAllocator* command_allocator =
         command_allocator_writable_first_->command_allocator;
     command_allocator->Reset();
     command_list_->Reset(command_allocator, nullptr);
-    deferred_command_list_->Execute(command_list_, command_list_1_);
-    command_list_->Close();
-    ID3D12CommandList* execute_command_lists[] = {command_list_};
-    direct_queue->ExecuteCommandLists(1, execute_command_lists);
+    uint32_t replay_chunk_count = 0;
+    if (!replay_workers_.empty()) {
+      deferred_command_list_->Partition(replay_workers_.size() + 1,
+                                        replay_chunks_);
+      replay_chunk_count = uint32_t(replay_chunks_.size());
+    }
+    bool submitted = false;
+    if (replay_chunk_count >= 2) {
+      {
+        std::lock_guard<std::mutex> lock(replay_mutex_);
+        replay_outstanding_ = replay_chunk_count - 1;
+        ++replay_generation_;
+      }
+      replay_cond_.notify_all();
+      deferred_command_list_->ExecuteChunk(command_list_, command_list_1_,
+                                           replay_chunks_[0]);
+      command_list_->Close();
+      {
+        std::unique_lock<std::mutex> lock(replay_mutex_);
+        replay_done_cond_.wait(lock,
+                               [this]() { return replay_outstanding_ == 0; });
+      }
+      bool replay_succeeded = true;
+      for (uint32_t i = 0; i < replay_chunk_count - 1; ++i) {
+        replay_succeeded &= replay_workers_[i]->succeeded;
+      }
+      if (replay_succeeded) {
+        replay_execute_lists_.clear();
+        replay_execute_lists_.push_back(command_list_);
+        for (uint32_t i = 0; i < replay_chunk_count - 1; ++i) {
+          replay_execute_lists_.push_back(replay_workers_[i]->command_list);
+        }
+        direct_queue->ExecuteCommandLists(replay_chunk_count,
+                                          replay_execute_lists_.data());
+        submitted = true;
+      } else {
+        // A worker couldn't record its chunk - nothing has been submitted to
+        // the queue yet, so replay the whole stream serially instead.
+        command_allocator->Reset();
+        command_list_->Reset(command_allocator, nullptr);
+      }
+    }
+    if (!submitted) {
+      deferred_command_list_->Execute(command_list_, command_list_1_);
+      command_list_->Close();
+      ID3D12CommandList* execute_command_lists[] = {command_list_};
+      direct_queue->ExecuteCommandLists(1, execute_command_lists);
+    }
     command_allocator_writable_first_->last_usage_submission =
         submission_current_;
     if (command_allocator_submitted_last_) {
@@ -2034,8 +2833,19 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
       }
       pix_capturing_ = false;
     }
+    if (draw_timing_frame_open_) {
+      // The frame was closed without a submission to resolve the timestamp
+      // queries in - drop the capture.
+      draw_timing_pending_draws_.clear();
+      draw_timing_frame_open_ = false;
+    }
+    // Draws recorded from now on belong to the next frame.
+    draw_timing_frame_first_draw_ = draws_issued();
+
     frame_open_ = false;
     // Submission already closed now, so minus 1.
+    closed_frame_timeline_ids_[frame_current_ % kQueueFrames] =
+        swap_timeline_frame_id_;
     closed_frame_submissions_[(frame_current_++) % kQueueFrames] =
         submission_current_ - 1;
 
@@ -2050,7 +2860,7 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
 
       sampler_heap_pool_->ClearCache();
       view_heap_pool_->ClearCache();
-      constant_buffer_pool_->ClearCache();
+      staging_memory_manager_->ClearCache();
 
       primitive_converter_->ClearCache();
 
@@ -2068,11 +2878,109 @@ bool D3D12CommandProcessor::EndSubmission(bool is_swap) {
       // TODO(Triang3l): Shared memory cache clear.
       // shared_memory_->ClearCache();
     }
+
+    if (resolution_scale_toggle_requested_) {
+      resolution_scale_toggle_requested_ = false;
+      // Toggled between frames with the GPU idle so nothing references
+      // resources of the old scale mid-frame. Cached pipelines, textures and
+      // resolve targets of both scales are keyed on the scale and survive
+      // switches; only the EDRAM contents are reinterpreted.
+      AwaitAllSubmissionsCompletion();
+      bool new_scale_2x = !texture_cache_->IsResolutionScale2X();
+      texture_cache_->SetResolutionScale2X(new_scale_2x);
+      render_target_cache_->SetResolutionScale2X(new_scale_2x);
+      pipeline_cache_->SetResolutionScale(new_scale_2x ? 2 : 1);
+      XELOGGPU("Resolution scale set to %ux", new_scale_2x ? 2 : 1);
+    }
   }
 
   return true;
 }
 
+void D3D12CommandProcessor::ReplayThreadMain(uint32_t worker_index) {
+  ReplayWorker& worker = *replay_workers_[worker_index];
+  uint64_t generation_handled = 0;
+  while (true) {
+    const DeferredCommandList::ExecutionChunk* chunk = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(replay_mutex_);
+      replay_cond_.wait(lock, [this, generation_handled]() {
+        return replay_shutdown_ || replay_generation_ != generation_handled;
+      });
+      if (replay_shutdown_) {
+        return;
+      }
+      generation_handled = replay_generation_;
+      // Chunk 0 is recorded by the submission thread.
+      if (worker_index + 1 < replay_chunks_.size()) {
+        chunk = &replay_chunks_[worker_index + 1];
+      }
+    }
+    if (chunk == nullptr) {
+      // More workers than chunks in this submission.
+      continue;
+    }
+    worker.succeeded = ReplayChunk(worker, *chunk);
+    {
+      std::lock_guard<std::mutex> lock(replay_mutex_);
+      if (--replay_outstanding_ == 0) {
+        replay_done_cond_.notify_all();
+      }
+    }
+  }
+}
+
+bool D3D12CommandProcessor::ReplayChunk(
+    ReplayWorker& worker, const DeferredCommandList::ExecutionChunk& chunk) {
+  // Get a command allocator not used by any submission still being executed.
+  uint64_t fence_completed = submission_fence_->GetCompletedValue();
+  std::pair<ID3D12CommandAllocator*, uint64_t>* allocator_entry = nullptr;
+  size_t allocator_oldest_index = SIZE_MAX;
+  for (size_t i = 0; i < worker.allocators.size(); ++i) {
+    auto& entry = worker.allocators[i];
+    if (allocator_oldest_index == SIZE_MAX ||
+        entry.second < worker.allocators[allocator_oldest_index].second) {
+      allocator_oldest_index = i;
+    }
+    if (entry.second <= fence_completed) {
+      allocator_entry = &entry;
+      break;
+    }
+  }
+  if (allocator_entry == nullptr) {
+    ID3D12CommandAllocator* new_allocator;
+    auto device = GetD3D12Context()->GetD3D12Provider()->GetDevice();
+    if (SUCCEEDED(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&new_allocator)))) {
+      worker.allocators.push_back(std::make_pair(new_allocator, uint64_t(0)));
+      allocator_entry = &worker.allocators.back();
+    } else if (allocator_oldest_index != SIZE_MAX) {
+      // Out of memory - awaiting the completion of the submission the oldest
+      // allocator was used in is better than dropping the chunk.
+      allocator_entry = &worker.allocators[allocator_oldest_index];
+      while (submission_fence_->GetCompletedValue() <
+             allocator_entry->second) {
+        xe::threading::MaybeYield();
+      }
+    } else {
+      return false;
+    }
+  }
+  allocator_entry->first->Reset();
+  if (FAILED(worker.command_list->Reset(allocator_entry->first, nullptr))) {
+    XELOGE("Failed to reset a replay thread command list");
+    return false;
+  }
+  deferred_command_list_->ExecuteChunk(worker.command_list,
+                                       worker.command_list_1, chunk);
+  if (FAILED(worker.command_list->Close())) {
+    XELOGE("Failed to close a replay thread command list");
+    return false;
+  }
+  allocator_entry->second = submission_current_;
+  return true;
+}
+
 void D3D12CommandProcessor::AwaitAllSubmissionsCompletion() {
   // May be called if shutting down without everything set up.
   if ((submission_completed_ + 1) >= submission_current_ ||
@@ -2278,6 +3186,27 @@ void D3D12CommandProcessor::UpdateSystemConstantValues(
   SCOPE_profile_cpu_f("gpu");
 #endif  // FINE_GRAINED_DRAW_SCOPES
 
+  // Skip the whole derivation if no register it depends on has been written
+  // since the last update and the non-register inputs are the same -
+  // system_constants_ already contains the correct values.
+  if (!system_constants_input_regs_dirty_ &&
+      system_constants_last_inputs_valid_) {
+    const SystemConstantInputs& last = system_constants_last_inputs_;
+    if (last.shared_memory_is_uav == shared_memory_is_uav &&
+        last.primitive_two_faced == primitive_two_faced &&
+        last.line_loop_closing_index == line_loop_closing_index &&
+        last.index_endian == index_endian &&
+        last.edge_factor_base == edge_factor_base && last.early_z == early_z &&
+        last.color_mask == color_mask &&
+        last.color_output_map[0] == render_targets[0].guest_render_target &&
+        last.color_output_map[1] == render_targets[1].guest_render_target &&
+        last.color_output_map[2] == render_targets[2].guest_render_target &&
+        last.color_output_map[3] == render_targets[3].guest_render_target) {
+      return;
+    }
+  }
+  system_constants_input_regs_dirty_ = false;
+
   auto pa_cl_clip_cntl = regs.Get<reg::PA_CL_CLIP_CNTL>();
   auto pa_cl_vte_cntl = regs.Get<reg::PA_CL_VTE_CNTL>();
   auto pa_su_point_minmax = regs.Get<reg::PA_SU_POINT_MINMAX>();
@@ -2830,6 +3759,20 @@ void D3D12CommandProcessor::UpdateSystemConstantValues(
         regs[XE_GPU_REG_RB_BLEND_ALPHA].f32;
   }
 
+  system_constants_last_inputs_.shared_memory_is_uav = shared_memory_is_uav;
+  system_constants_last_inputs_.primitive_two_faced = primitive_two_faced;
+  system_constants_last_inputs_.line_loop_closing_index =
+      line_loop_closing_index;
+  system_constants_last_inputs_.index_endian = index_endian;
+  system_constants_last_inputs_.edge_factor_base = edge_factor_base;
+  system_constants_last_inputs_.early_z = early_z;
+  system_constants_last_inputs_.color_mask = color_mask;
+  for (uint32_t i = 0; i < 4; ++i) {
+    system_constants_last_inputs_.color_output_map[i] =
+        render_targets[i].guest_render_target;
+  }
+  system_constants_last_inputs_valid_ = true;
+
   cbuffer_bindings_system_.up_to_date &= !dirty;
 }
 
@@ -2972,9 +3915,9 @@ bool D3D12CommandProcessor::UpdateBindings(
 
   // Update constant buffers.
   if (!cbuffer_bindings_system_.up_to_date) {
-    uint8_t* system_constants = constant_buffer_pool_->Request(
+    uint8_t* system_constants = staging_memory_manager_->Request(
         frame_current_, xe::align(uint32_t(sizeof(system_constants_)), 256u),
-        nullptr, nullptr, &cbuffer_bindings_system_.buffer_address);
+        256, nullptr, nullptr, &cbuffer_bindings_system_.buffer_address);
     if (system_constants == nullptr) {
       return false;
     }
@@ -2984,8 +3927,8 @@ bool D3D12CommandProcessor::UpdateBindings(
     write_system_constant_view = true;
   }
   if (!cbuffer_bindings_float_vertex_.up_to_date) {
-    uint8_t* float_constants = constant_buffer_pool_->Request(
-        frame_current_, float_constant_size_vertex, nullptr, nullptr,
+    uint8_t* float_constants = staging_memory_manager_->Request(
+        frame_current_, float_constant_size_vertex, 256, nullptr, nullptr,
         &cbuffer_bindings_float_vertex_.buffer_address);
     if (float_constants == nullptr) {
       return false;
@@ -3009,8 +3952,8 @@ bool D3D12CommandProcessor::UpdateBindings(
     write_float_constant_view_vertex = true;
   }
   if (!cbuffer_bindings_float_pixel_.up_to_date) {
-    uint8_t* float_constants = constant_buffer_pool_->Request(
-        frame_current_, float_constant_size_pixel, nullptr, nullptr,
+    uint8_t* float_constants = staging_memory_manager_->Request(
+        frame_current_, float_constant_size_pixel, 256, nullptr, nullptr,
         &cbuffer_bindings_float_pixel_.buffer_address);
     if (float_constants == nullptr) {
       return false;
@@ -3039,8 +3982,8 @@ bool D3D12CommandProcessor::UpdateBindings(
   }
   if (!cbuffer_bindings_bool_loop_.up_to_date) {
     uint32_t* bool_loop_constants =
-        reinterpret_cast<uint32_t*>(constant_buffer_pool_->Request(
-            frame_current_, 768, nullptr, nullptr,
+        reinterpret_cast<uint32_t*>(staging_memory_manager_->Request(
+            frame_current_, 768, 256, nullptr, nullptr,
             &cbuffer_bindings_bool_loop_.buffer_address));
     if (bool_loop_constants == nullptr) {
       return false;
@@ -3059,9 +4002,9 @@ bool D3D12CommandProcessor::UpdateBindings(
     write_bool_loop_constant_view = true;
   }
   if (!cbuffer_bindings_fetch_.up_to_date) {
-    uint8_t* fetch_constants =
-        constant_buffer_pool_->Request(frame_current_, 768, nullptr, nullptr,
-                                       &cbuffer_bindings_fetch_.buffer_address);
+    uint8_t* fetch_constants = staging_memory_manager_->Request(
+        frame_current_, 768, 256, nullptr, nullptr,
+        &cbuffer_bindings_fetch_.buffer_address);
     if (fetch_constants == nullptr) {
       return false;
     }
@@ -3428,6 +4371,313 @@ ID3D12Resource* D3D12CommandProcessor::RequestReadbackBuffer(uint32_t size) {
   return readback_buffer_;
 }
 
+bool D3D12CommandProcessor::EnsureDrawTimingResources() {
+  if (draw_timing_query_heap_ != nullptr) {
+    return true;
+  }
+  auto device = GetD3D12Context()->GetD3D12Provider()->GetDevice();
+  D3D12_QUERY_HEAP_DESC query_heap_desc;
+  query_heap_desc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+  query_heap_desc.Count = kDrawTimingMaxDraws * 2;
+  query_heap_desc.NodeMask = 0;
+  ID3D12QueryHeap* query_heap;
+  if (FAILED(device->CreateQueryHeap(&query_heap_desc,
+                                     IID_PPV_ARGS(&query_heap)))) {
+    XELOGE("Failed to create the draw timestamp query heap");
+    return false;
+  }
+  D3D12_RESOURCE_DESC buffer_desc;
+  ui::d3d12::util::FillBufferResourceDesc(
+      buffer_desc, kDrawTimingMaxDraws * 2 * sizeof(uint64_t),
+      D3D12_RESOURCE_FLAG_NONE);
+  ID3D12Resource* buffer;
+  if (FAILED(device->CreateCommittedResource(
+          &ui::d3d12::util::kHeapPropertiesReadback, D3D12_HEAP_FLAG_NONE,
+          &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+          IID_PPV_ARGS(&buffer)))) {
+    XELOGE("Failed to create the draw timestamp readback buffer");
+    query_heap->Release();
+    return false;
+  }
+  draw_timing_query_heap_ = query_heap;
+  draw_timing_buffer_ = buffer;
+  return true;
+}
+
+void D3D12CommandProcessor::BeginDrawTiming(bool is_resolve) {
+  if (!draw_timing_frame_open_ ||
+      draw_timing_pending_draws_.size() >= kDrawTimingMaxDraws) {
+    return;
+  }
+  DrawTimingDraw draw;
+  // The draw counter has already been incremented for the current draw.
+  draw.draw_index =
+      uint32_t(draws_issued() - draw_timing_frame_first_draw_ - 1);
+  draw.is_resolve = is_resolve;
+  uint32_t query_index = uint32_t(draw_timing_pending_draws_.size()) * 2;
+  draw_timing_pending_draws_.push_back(draw);
+  deferred_command_list_->D3DEndQuery(draw_timing_query_heap_,
+                                      D3D12_QUERY_TYPE_TIMESTAMP, query_index);
+  draw_timing_draw_open_ = true;
+}
+
+void D3D12CommandProcessor::EndDrawTiming() {
+  if (!draw_timing_draw_open_) {
+    return;
+  }
+  draw_timing_draw_open_ = false;
+  deferred_command_list_->D3DEndQuery(
+      draw_timing_query_heap_, D3D12_QUERY_TYPE_TIMESTAMP,
+      uint32_t(draw_timing_pending_draws_.size()) * 2 - 1);
+}
+
+void D3D12CommandProcessor::WriteZPassSampleCount(uint32_t address) {
+  auto endianness = static_cast<Endian>(address & 0x3);
+  uint32_t physical_address = address & ~uint32_t(3);
+  if (!EnsureOcclusionQueryResources()) {
+    return;
+  }
+  if (!occlusion_queries_armed_) {
+    // The first query of the title - start wrapping draws in occlusion
+    // queries. The draw this event refers to hasn't been wrapped yet, so the
+    // guest gets zero for it, like for a draw with no samples passing.
+    occlusion_queries_armed_ = true;
+    XELOGGPU("Title requests sample counts - enabling occlusion queries");
+  }
+
+  // Retire the writes the GPU has completed by now.
+  submission_completed_ = submission_fence_->GetCompletedValue();
+  ProcessSampleCountWrites();
+
+  // Queue the readback of the real count if the latest draw has been wrapped
+  // in a query in the currently open submission (the query slots of older,
+  // already closed submissions have been reused).
+  if (submission_open_ && occlusion_query_draw_index_ != UINT32_MAX &&
+      occlusion_query_draw_submission_ == submission_current_) {
+    if (sample_count_writes_.size() >= kSampleCountRingSize) {
+      // All ring slots hold pending writes - drop the oldest one; its guest
+      // address has already received the latency-compensated count, only the
+      // correction with the real one is lost. The resolve recorded for the
+      // new write is later in the queue order than the dropped one, so the
+      // slot will hold the new count when its submission completes.
+      sample_count_writes_.pop_front();
+    }
+    uint32_t ring_index = sample_count_ring_next_;
+    sample_count_ring_next_ =
+        (sample_count_ring_next_ + 1) % kSampleCountRingSize;
+    deferred_command_list_->D3DResolveQueryData(
+        occlusion_query_heap_, D3D12_QUERY_TYPE_OCCLUSION,
+        occlusion_query_draw_index_, 1, sample_count_buffer_,
+        ring_index * sizeof(uint64_t));
+    SampleCountWrite write;
+    write.address = address;
+    write.ring_index = ring_index;
+    write.submission = submission_current_;
+    sample_count_writes_.push_back(write);
+    if (cvars::d3d12_occlusion_query_strict) {
+      // Submit what has been recorded so far and wait for the real count -
+      // ProcessSampleCountWrites performs the guest memory write.
+      if (EndSubmission(false)) {
+        AwaitAllSubmissionsCompletion();
+        ProcessSampleCountWrites();
+        return;
+      }
+    }
+  }
+
+  // Return the last count obtained for this address immediately, without
+  // waiting for the GPU - the real count will overwrite it when its
+  // submission completes, for the next time the guest polls the address.
+  uint32_t value = 0;
+  auto it = sample_count_values_.find(physical_address);
+  if (it != sample_count_values_.end()) {
+    value = it->second;
+  }
+  xe::store(memory_->TranslatePhysical(physical_address),
+            GpuSwap(value, endianness));
+  trace_writer_.WriteMemoryWrite(CpuToGpu(physical_address), 4);
+}
+
+bool D3D12CommandProcessor::EnsureOcclusionQueryResources() {
+  if (occlusion_query_heap_ != nullptr) {
+    return true;
+  }
+  auto device = GetD3D12Context()->GetD3D12Provider()->GetDevice();
+  D3D12_QUERY_HEAP_DESC query_heap_desc;
+  query_heap_desc.Type = D3D12_QUERY_HEAP_TYPE_OCCLUSION;
+  query_heap_desc.Count = kOcclusionQueryCount;
+  query_heap_desc.NodeMask = 0;
+  ID3D12QueryHeap* query_heap;
+  if (FAILED(device->CreateQueryHeap(&query_heap_desc,
+                                     IID_PPV_ARGS(&query_heap)))) {
+    XELOGE("Failed to create the occlusion query heap");
+    return false;
+  }
+  D3D12_RESOURCE_DESC buffer_desc;
+  ui::d3d12::util::FillBufferResourceDesc(
+      buffer_desc, kSampleCountRingSize * sizeof(uint64_t),
+      D3D12_RESOURCE_FLAG_NONE);
+  ID3D12Resource* buffer;
+  if (FAILED(device->CreateCommittedResource(
+          &ui::d3d12::util::kHeapPropertiesReadback, D3D12_HEAP_FLAG_NONE,
+          &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+          IID_PPV_ARGS(&buffer)))) {
+    XELOGE("Failed to create the sample count readback buffer");
+    query_heap->Release();
+    return false;
+  }
+  occlusion_query_heap_ = query_heap;
+  sample_count_buffer_ = buffer;
+  return true;
+}
+
+void D3D12CommandProcessor::BeginDrawOcclusionQuery() {
+  if (!occlusion_queries_armed_ || occlusion_query_heap_ == nullptr ||
+      occlusion_query_next_index_ >= kOcclusionQueryCount) {
+    return;
+  }
+  deferred_command_list_->D3DBeginQuery(occlusion_query_heap_,
+                                        D3D12_QUERY_TYPE_OCCLUSION,
+                                        occlusion_query_next_index_);
+  occlusion_query_draw_open_ = true;
+}
+
+void D3D12CommandProcessor::EndDrawOcclusionQuery() {
+  if (!occlusion_query_draw_open_) {
+    return;
+  }
+  occlusion_query_draw_open_ = false;
+  deferred_command_list_->D3DEndQuery(occlusion_query_heap_,
+                                      D3D12_QUERY_TYPE_OCCLUSION,
+                                      occlusion_query_next_index_);
+  occlusion_query_draw_index_ = occlusion_query_next_index_++;
+  occlusion_query_draw_submission_ = submission_current_;
+}
+
+void D3D12CommandProcessor::ProcessSampleCountWrites() {
+  if (sample_count_writes_.empty() ||
+      sample_count_writes_.front().submission > submission_completed_) {
+    return;
+  }
+  D3D12_RANGE read_range;
+  read_range.Begin = 0;
+  read_range.End = kSampleCountRingSize * sizeof(uint64_t);
+  void* mapping;
+  if (FAILED(sample_count_buffer_->Map(0, &read_range, &mapping))) {
+    XELOGE("Failed to map the sample count readback buffer");
+    return;
+  }
+  const uint64_t* counts = reinterpret_cast<const uint64_t*>(mapping);
+  while (!sample_count_writes_.empty()) {
+    const SampleCountWrite& write = sample_count_writes_.front();
+    if (write.submission > submission_completed_) {
+      break;
+    }
+    uint32_t value =
+        uint32_t(std::min(counts[write.ring_index], uint64_t(UINT32_MAX)));
+    auto endianness = static_cast<Endian>(write.address & 0x3);
+    uint32_t physical_address = write.address & ~uint32_t(3);
+    sample_count_values_[physical_address] = value;
+    xe::store(memory_->TranslatePhysical(physical_address),
+              GpuSwap(value, endianness));
+    trace_writer_.WriteMemoryWrite(CpuToGpu(physical_address), 4);
+    sample_count_writes_.pop_front();
+  }
+  D3D12_RANGE write_range = {};
+  sample_count_buffer_->Unmap(0, &write_range);
+}
+
+bool D3D12CommandProcessor::QueueMemExportReadback(
+    const MemExportRange* ranges, uint32_t range_count, uint32_t total_size) {
+  if (total_size > kMemExportRingSize) {
+    return false;
+  }
+  if (memexport_ring_buffer_ == nullptr) {
+    auto device = GetD3D12Context()->GetD3D12Provider()->GetDevice();
+    D3D12_RESOURCE_DESC buffer_desc;
+    ui::d3d12::util::FillBufferResourceDesc(buffer_desc, kMemExportRingSize,
+                                            D3D12_RESOURCE_FLAG_NONE);
+    ID3D12Resource* buffer;
+    if (FAILED(device->CreateCommittedResource(
+            &ui::d3d12::util::kHeapPropertiesReadback, D3D12_HEAP_FLAG_NONE,
+            &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+            IID_PPV_ARGS(&buffer)))) {
+      XELOGE("Failed to create the memexport readback ring buffer");
+      return false;
+    }
+    memexport_ring_buffer_ = buffer;
+  }
+  // Retire the readbacks the GPU has completed by now to free ring space.
+  submission_completed_ = submission_fence_->GetCompletedValue();
+  ProcessMemExportWrites();
+  uint32_t wrap_padding = 0;
+  uint32_t ring_offset = memexport_ring_next_;
+  if (ring_offset + total_size > kMemExportRingSize) {
+    wrap_padding = kMemExportRingSize - ring_offset;
+    ring_offset = 0;
+  }
+  if (memexport_ring_pending_ + wrap_padding + total_size >
+      kMemExportRingSize) {
+    // All the space is held by readbacks from submissions still being
+    // executed - the caller will do the synchronous readback rather than
+    // overwrite data that hasn't reached the guest memory yet.
+    return false;
+  }
+  shared_memory_->UseAsCopySource();
+  SubmitBarriers();
+  ID3D12Resource* shared_memory_buffer = shared_memory_->GetBuffer();
+  MemExportReadback readback;
+  readback.submission = submission_current_;
+  readback.ring_offset = ring_offset;
+  readback.ring_bytes = wrap_padding + total_size;
+  readback.ranges.assign(ranges, ranges + range_count);
+  uint32_t range_offset = ring_offset;
+  for (uint32_t i = 0; i < range_count; ++i) {
+    uint32_t range_size = ranges[i].size_dwords << 2;
+    deferred_command_list_->D3DCopyBufferRegion(
+        memexport_ring_buffer_, range_offset, shared_memory_buffer,
+        ranges[i].base_address_dwords << 2, range_size);
+    range_offset += range_size;
+  }
+  memexport_ring_next_ = ring_offset + total_size;
+  memexport_ring_pending_ += readback.ring_bytes;
+  memexport_readbacks_.push_back(std::move(readback));
+  return true;
+}
+
+void D3D12CommandProcessor::ProcessMemExportWrites() {
+  if (memexport_readbacks_.empty() ||
+      memexport_readbacks_.front().submission > submission_completed_) {
+    return;
+  }
+  D3D12_RANGE read_range;
+  read_range.Begin = 0;
+  read_range.End = kMemExportRingSize;
+  void* mapping;
+  if (FAILED(memexport_ring_buffer_->Map(0, &read_range, &mapping))) {
+    XELOGE("Failed to map the memexport readback ring buffer");
+    return;
+  }
+  const uint8_t* ring_data = reinterpret_cast<const uint8_t*>(mapping);
+  while (!memexport_readbacks_.empty()) {
+    const MemExportReadback& readback = memexport_readbacks_.front();
+    if (readback.submission > submission_completed_) {
+      break;
+    }
+    const uint8_t* range_data = ring_data + readback.ring_offset;
+    for (const MemExportRange& range : readback.ranges) {
+      uint32_t range_size = range.size_dwords << 2;
+      std::memcpy(memory_->TranslatePhysical(range.base_address_dwords << 2),
+                  range_data, range_size);
+      range_data += range_size;
+    }
+    memexport_ring_pending_ -= readback.ring_bytes;
+    memexport_readbacks_.pop_front();
+  }
+  D3D12_RANGE write_range = {};
+  memexport_ring_buffer_->Unmap(0, &write_range);
+}
+
 }  // namespace d3d12
 }  // namespace gpu
 }  // namespace xe
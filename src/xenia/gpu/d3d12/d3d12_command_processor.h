@@ -11,12 +11,16 @@
 #define XENIA_GPU_D3D12_D3D12_COMMAND_PROCESSOR_H_
 
 #include <atomic>
+#include <condition_variable>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "xenia/base/threading.h"
 #include "xenia/gpu/command_processor.h"
 #include "xenia/gpu/d3d12/d3d12_graphics_system.h"
 #include "xenia/gpu/d3d12/deferred_command_list.h"
@@ -43,6 +47,8 @@ class D3D12CommandProcessor : public CommandProcessor {
 
   void ClearCaches() override;
 
+  void ToggleResolutionScale() override;
+
   void RequestFrameTrace(const std::wstring& root_path) override;
 
   void TracePlaybackWroteMemory(uint32_t base_ptr, uint32_t length) override;
@@ -95,8 +101,8 @@ class D3D12CommandProcessor : public CommandProcessor {
                                         const D3D12Shader* pixel_shader,
                                         bool tessellated);
 
-  ui::d3d12::UploadBufferPool* GetConstantBufferPool() const {
-    return constant_buffer_pool_.get();
+  ui::d3d12::StagingMemoryManager* GetStagingMemoryManager() const {
+    return staging_memory_manager_.get();
   }
   // Request and automatically rebind descriptors on the draw command list.
   // Refer to DescriptorHeapPool::Request for partial/full update explanation.
@@ -121,6 +127,12 @@ class D3D12CommandProcessor : public CommandProcessor {
   void ReleaseScratchGPUBuffer(ID3D12Resource* buffer,
                                D3D12_RESOURCE_STATES new_state);
 
+  // Schedules a GPU object used in the current submission for release once
+  // the GPU is done with it (when the submission fence passes its value).
+  // Never blocks - the reference is dropped from BeginSubmission as fence
+  // completions are observed. The caller's reference is taken over.
+  void DeferResourceDeletion(IUnknown* resource);
+
   // Sets the current SSAA sample positions, needs to be done before setting
   // render targets or copying to depth render targets.
   void SetSamplePositions(MsaaSamples sample_positions);
@@ -155,11 +167,28 @@ class D3D12CommandProcessor : public CommandProcessor {
 
   std::unique_ptr<xe::ui::RawImage> Capture();
 
+  // Asynchronous capture (GraphicsSystem::BeginFrameCapture). Swap frames
+  // are copied into a ring of readback slots inside the swap submission and
+  // delivered to the sink from a worker thread once the submission fence
+  // passes the copy, never blocking presentation.
+  bool BeginFrameCapture(
+      std::function<void(std::unique_ptr<xe::ui::RawImage>)> sink);
+  void EndFrameCapture();
+
+  void SetDrawTimingCaptureEnabled(bool enabled) override;
+  bool GetDrawTimings(std::vector<DrawTiming>& timings_out) override;
+
  protected:
   bool SetupContext() override;
   void ShutdownContext() override;
 
   void WriteRegister(uint32_t index, uint32_t value) override;
+  void WriteRegisterRangeFromRing(RingBuffer* reader, uint32_t base,
+                                  uint32_t num_registers) override;
+  // Whether any register in the range is an input of
+  // UpdateSystemConstantValues.
+  bool IsSystemConstantsRegisterRangeUsed(uint32_t base,
+                                          uint32_t num_registers) const;
 
   void PerformSwap(uint32_t frontbuffer_ptr, uint32_t frontbuffer_width,
                    uint32_t frontbuffer_height) override;
@@ -168,10 +197,16 @@ class D3D12CommandProcessor : public CommandProcessor {
                      const uint32_t* host_address,
                      uint32_t dword_count) override;
 
+  void OnPrescanDraw(Shader* vertex_shader, Shader* pixel_shader,
+                     uint32_t sq_program_cntl, uint32_t vgt_output_path_cntl,
+                     PrimitiveType prim_type) override;
+
   bool IssueDraw(PrimitiveType primitive_type, uint32_t index_count,
                  IndexBufferInfo* index_buffer_info) override;
   bool IssueCopy() override;
 
+  void WriteZPassSampleCount(uint32_t address) override;
+
   void InitializeTrace() override;
   void FinalizeTrace() override;
 
@@ -249,6 +284,16 @@ class D3D12CommandProcessor : public CommandProcessor {
                       const D3D12Shader* pixel_shader,
                       ID3D12RootSignature* root_signature);
 
+  // Drops the cached vertex buffer residency when shared memory ranges are
+  // invalidated.
+  static void SharedMemoryGlobalWatchCallbackThunk(void* context,
+                                                   uint32_t address_first,
+                                                   uint32_t address_last,
+                                                   bool invalidated_by_gpu);
+  void SharedMemoryGlobalWatchCallback(uint32_t address_first,
+                                       uint32_t address_last,
+                                       bool invalidated_by_gpu);
+
   // Returns dword count for one element for a memexport format, or 0 if it's
   // not supported by the D3D12 command processor (if it's smaller that 1 dword,
   // for instance).
@@ -256,11 +301,62 @@ class D3D12CommandProcessor : public CommandProcessor {
   // 32 bits per element.
   static uint32_t GetSupportedMemExportFormatSize(ColorFormat format);
 
+  // A memory region written by memory export in a draw, in dwords.
+  struct MemExportRange {
+    uint32_t base_address_dwords;
+    uint32_t size_dwords;
+  };
+  // Pipelined memory export readback (d3d12_readback_memexport_pipelined).
+  // Creates the readback ring buffer if it doesn't exist yet, records the
+  // copies of the exported ranges into the ring right after the exporting
+  // draw, and queues the guest memory writes for when the GPU completes the
+  // submission. Returns false if the readback couldn't be queued (the ring is
+  // full of data from submissions still being executed, for instance), in
+  // which case the caller falls back to the synchronous readback.
+  bool QueueMemExportReadback(const MemExportRange* ranges,
+                              uint32_t range_count, uint32_t total_size);
+  // Performs the deferred guest memory writes of the memory export readbacks
+  // whose submissions have been completed by the GPU.
+  void ProcessMemExportWrites();
+
   // Returns a buffer for reading GPU data back to the CPU. Assuming
   // synchronizing immediately after use. Always in COPY_DEST state.
   ID3D12Resource* RequestReadbackBuffer(uint32_t size);
 
+  // Asynchronous frame capture (BeginFrameCapture). QueueFrameCapture
+  // records the swap texture copy into the current submission when capture
+  // is active and a slot is free; FrameCaptureThread waits for the copies
+  // on the submission fence, maps the slots and invokes the sink.
+  void QueueFrameCapture();
+  void FrameCaptureThread();
+
+  // Draw duration capture (SetDrawTimingCaptureEnabled). Creates the timestamp
+  // query heap and its readback buffer if they don't exist yet.
+  bool EnsureDrawTimingResources();
+  // Bracket the draw or resolve currently being recorded with timestamp
+  // queries. BeginDrawTiming is a no-op when not capturing or when the query
+  // heap is exhausted; EndDrawTiming is a no-op without a matching begin, so
+  // both are safe to call unconditionally.
+  void BeginDrawTiming(bool is_resolve);
+  void EndDrawTiming();
+
+  // Sample count query feedback (WriteZPassSampleCount). Creates the
+  // occlusion query heap and the sample count readback ring if they don't
+  // exist yet.
+  bool EnsureOcclusionQueryResources();
+  // Bracket the guest draw currently being recorded with an occlusion query.
+  // BeginDrawOcclusionQuery is a no-op until the title issues its first
+  // sample count query or when the query heap is exhausted;
+  // EndDrawOcclusionQuery is a no-op without a matching begin, so both are
+  // safe to call unconditionally.
+  void BeginDrawOcclusionQuery();
+  void EndDrawOcclusionQuery();
+  // Performs the deferred guest memory writes of the sample count ring
+  // entries whose submissions have been completed by the GPU.
+  void ProcessSampleCountWrites();
+
   bool cache_clear_requested_ = false;
+  bool resolution_scale_toggle_requested_ = false;
 
   bool submission_open_ = false;
   // Values of submission_fence_.
@@ -276,6 +372,9 @@ class D3D12CommandProcessor : public CommandProcessor {
   uint64_t frame_completed_ = 0;
   // Submission indices of frames that have already been submitted.
   uint64_t closed_frame_submissions_[kQueueFrames] = {};
+  // FrameTimeline ids of the closed frames, for reporting GPU completion when
+  // the completed frame index passes them.
+  uint64_t closed_frame_timeline_ids_[kQueueFrames] = {};
 
   struct CommandAllocator {
     ID3D12CommandAllocator* command_allocator;
@@ -290,6 +389,37 @@ class D3D12CommandProcessor : public CommandProcessor {
   ID3D12GraphicsCommandList1* command_list_1_ = nullptr;
   std::unique_ptr<DeferredCommandList> deferred_command_list_ = nullptr;
 
+  // Parallel deferred command list replay (--d3d12_replay_threads). The
+  // deferred stream is partitioned at render target binding changes, the first
+  // chunk is recorded on the submission thread into command_list_, and the
+  // rest into the workers' command lists, all submitted in stream order.
+  struct ReplayWorker {
+    std::unique_ptr<xe::threading::Thread> thread;
+    ID3D12GraphicsCommandList* command_list = nullptr;
+    ID3D12GraphicsCommandList1* command_list_1 = nullptr;
+    // Command allocators and the submissions they were last used in.
+    std::vector<std::pair<ID3D12CommandAllocator*, uint64_t>> allocators;
+    // Whether the last requested chunk was recorded and closed successfully.
+    bool succeeded = false;
+  };
+  void ReplayThreadMain(uint32_t worker_index);
+  bool ReplayChunk(ReplayWorker& worker,
+                   const DeferredCommandList::ExecutionChunk& chunk);
+  std::vector<std::unique_ptr<ReplayWorker>> replay_workers_;
+  std::mutex replay_mutex_;
+  // Notified when replay_generation_ is incremented or replay_shutdown_ is
+  // set; worker i records chunk i + 1 of replay_chunks_ if it exists.
+  std::condition_variable replay_cond_;
+  // Notified when replay_outstanding_ reaches zero.
+  std::condition_variable replay_done_cond_;
+  // All protected with replay_mutex_.
+  uint64_t replay_generation_ = 0;
+  uint32_t replay_outstanding_ = 0;
+  bool replay_shutdown_ = false;
+  std::vector<DeferredCommandList::ExecutionChunk> replay_chunks_;
+  // Reused between submissions to avoid per-submission allocations.
+  std::vector<ID3D12CommandList*> replay_execute_lists_;
+
   std::unique_ptr<SharedMemory> shared_memory_ = nullptr;
 
   // Root signatures for different descriptor counts.
@@ -303,7 +433,11 @@ class D3D12CommandProcessor : public CommandProcessor {
 
   std::unique_ptr<PrimitiveConverter> primitive_converter_ = nullptr;
 
-  std::unique_ptr<ui::d3d12::UploadBufferPool> constant_buffer_pool_ = nullptr;
+  // Upload staging memory shared by all producers, tracked in frame index
+  // space because constant buffer and converted index addresses are cached
+  // until the frame is closed.
+  std::unique_ptr<ui::d3d12::StagingMemoryManager> staging_memory_manager_ =
+      nullptr;
   std::unique_ptr<ui::d3d12::DescriptorHeapPool> view_heap_pool_ = nullptr;
   std::unique_ptr<ui::d3d12::DescriptorHeapPool> sampler_heap_pool_ = nullptr;
 
@@ -325,21 +459,32 @@ class D3D12CommandProcessor : public CommandProcessor {
     }
     return std::make_pair(kSwapTextureWidth, kSwapTextureHeight);
   }
-  ID3D12Resource* swap_texture_ = nullptr;
-  D3D12_PLACED_SUBRESOURCE_FOOTPRINT swap_texture_copy_footprint_;
-  UINT64 swap_texture_copy_size_;
-  ID3D12DescriptorHeap* swap_texture_rtv_descriptor_heap_ = nullptr;
-  D3D12_CPU_DESCRIPTOR_HANDLE swap_texture_rtv_;
-  ID3D12DescriptorHeap* swap_texture_srv_descriptor_heap_ = nullptr;
+  // Two persistent swap texture variants - native and 2x-scaled (the latter
+  // created only when the device supports 2x scaling). Both live for the
+  // whole session rather than being recreated on resolution scale switches
+  // because the UI thread samples the current one asynchronously through the
+  // SRV heap published in the swap state.
+  struct SwapTexture {
+    ID3D12Resource* texture = nullptr;
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT copy_footprint;
+    UINT64 copy_size;
+    ID3D12DescriptorHeap* rtv_descriptor_heap = nullptr;
+    D3D12_CPU_DESCRIPTOR_HANDLE rtv;
+    ID3D12DescriptorHeap* srv_descriptor_heap = nullptr;
+  };
+  SwapTexture swap_textures_[2];
+  inline const SwapTexture& GetCurrentSwapTexture() const {
+    return swap_textures_[texture_cache_->IsResolutionScale2X() ? 1 : 0];
+  }
 
   // Unsubmitted barrier batch.
   std::vector<D3D12_RESOURCE_BARRIER> barriers_;
 
-  struct BufferForDeletion {
-    ID3D12Resource* buffer;
+  struct ResourceForDeletion {
+    IUnknown* resource;
     uint64_t last_usage_submission;
   };
-  std::deque<BufferForDeletion> buffers_for_deletion_;
+  std::deque<ResourceForDeletion> resources_for_deletion_;
 
   static constexpr uint32_t kScratchBufferSizeIncrement = 16 * 1024 * 1024;
   ID3D12Resource* scratch_buffer_ = nullptr;
@@ -351,6 +496,117 @@ class D3D12CommandProcessor : public CommandProcessor {
   ID3D12Resource* readback_buffer_ = nullptr;
   uint32_t readback_buffer_size_ = 0;
 
+  // Pipelined memory export readback (QueueMemExportReadback). Exported
+  // ranges are copied into the ring right after the producing draw, and
+  // written to the guest memory when the GPU completes the submission
+  // containing it, so by the time the title reads the export target, the data
+  // is resident without a mid-frame stall.
+  static constexpr uint32_t kMemExportRingSize = 16 * 1024 * 1024;
+  ID3D12Resource* memexport_ring_buffer_ = nullptr;
+  struct MemExportReadback {
+    // Submission the copies into the ring complete at.
+    uint64_t submission;
+    // Offset of the data in the ring.
+    uint32_t ring_offset;
+    // Ring bytes released when the readback is retired - the data plus the
+    // padding skipped at the end of the ring if the allocation wrapped.
+    uint32_t ring_bytes;
+    // The exported ranges, laid out in the ring back to back.
+    std::vector<MemExportRange> ranges;
+  };
+  // Recorded, but not yet GPU-completed, readbacks, in ring order.
+  std::deque<MemExportReadback> memexport_readbacks_;
+  uint32_t memexport_ring_next_ = 0;
+  // Ring bytes held by the readbacks in memexport_readbacks_.
+  uint32_t memexport_ring_pending_ = 0;
+
+  // Asynchronous frame capture (BeginFrameCapture). Slots are filled on the
+  // GPU thread inside swap submissions and consumed by the capture thread;
+  // a slot's contents belong to the capture thread while pending is set.
+  struct FrameCaptureSlot {
+    ID3D12Resource* readback_buffer = nullptr;
+    uint64_t buffer_size = 0;
+    // Submission fence value the copy into the slot completes at.
+    uint64_t submission = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+    bool pending = false;
+  };
+  static constexpr uint32_t kFrameCaptureSlotCount = 3;
+  std::mutex frame_capture_mutex_;
+  std::condition_variable frame_capture_cond_;
+  std::function<void(std::unique_ptr<xe::ui::RawImage>)> frame_capture_sink_;
+  FrameCaptureSlot frame_capture_slots_[kFrameCaptureSlotCount];
+  // Indices of filled slots in copy order, awaiting the capture thread.
+  std::deque<uint32_t> frame_capture_ready_slots_;
+  std::unique_ptr<xe::threading::Thread> frame_capture_thread_;
+  bool frame_capture_active_ = false;
+  bool frame_capture_shutdown_ = false;
+  HANDLE frame_capture_fence_event_ = nullptr;
+  uint64_t frame_capture_dropped_frames_ = 0;
+
+  // Draw duration capture (SetDrawTimingCaptureEnabled). The query heap holds
+  // a begin/end timestamp pair for every timed draw; at the end of a captured
+  // frame all the pairs are resolved into the readback buffer.
+  static constexpr uint32_t kDrawTimingMaxDraws = 4096;
+  bool draw_timing_requested_ = false;
+  // Whether the current frame is being captured.
+  bool draw_timing_frame_open_ = false;
+  // Whether a begin timestamp has been written without the end one yet.
+  bool draw_timing_draw_open_ = false;
+  ID3D12QueryHeap* draw_timing_query_heap_ = nullptr;
+  ID3D12Resource* draw_timing_buffer_ = nullptr;
+  // Total number of draws issued before the current frame, to make the
+  // captured draw indices frame-relative.
+  uint64_t draw_timing_frame_first_draw_ = 0;
+  struct DrawTimingDraw {
+    uint32_t draw_index;
+    bool is_resolve;
+  };
+  // Draws timed in the current frame, in query pair order.
+  std::vector<DrawTimingDraw> draw_timing_pending_draws_;
+  // Draws whose timestamps have been resolved into the readback buffer at the
+  // end of the last captured frame, for GetDrawTimings.
+  std::vector<DrawTimingDraw> draw_timing_resolved_draws_;
+
+  // Xenos sample count query (ZPASS_DONE) feedback. Once a title issues its
+  // first query, every guest draw is wrapped in an occlusion query, and each
+  // ZPASS_DONE event resolves the query of the latest draw into a slot of
+  // the sample count readback ring. The result is written to the guest
+  // address when the GPU completes the submission containing the draw; until
+  // then, the count previously resolved for the same address is returned
+  // immediately, so queries never stall the CPU (unless
+  // d3d12_occlusion_query_strict is enabled).
+  static constexpr uint32_t kOcclusionQueryCount = 4096;
+  static constexpr uint32_t kSampleCountRingSize = 2048;
+  bool occlusion_queries_armed_ = false;
+  ID3D12QueryHeap* occlusion_query_heap_ = nullptr;
+  ID3D12Resource* sample_count_buffer_ = nullptr;
+  // Next query slot in the heap - slots are reused from the start in every
+  // submission.
+  uint32_t occlusion_query_next_index_ = 0;
+  // Whether a query has been begun around the draw currently being recorded.
+  bool occlusion_query_draw_open_ = false;
+  // The query slot wrapping the latest recorded draw, and the submission it
+  // was recorded in (slots from older submissions have been reused already).
+  uint32_t occlusion_query_draw_index_ = UINT32_MAX;
+  uint64_t occlusion_query_draw_submission_ = 0;
+  struct SampleCountWrite {
+    // Guest physical address with the endianness in the lower bits.
+    uint32_t address;
+    // Slot in the sample count readback ring the query is resolved into.
+    uint32_t ring_index;
+    // Submission that resolves the query.
+    uint64_t submission;
+  };
+  // Resolved, but not yet GPU-completed, sample count writes, in ring order.
+  std::deque<SampleCountWrite> sample_count_writes_;
+  uint32_t sample_count_ring_next_ = 0;
+  // The last count resolved for each guest address, returned immediately for
+  // latency compensation while the new count is still in flight.
+  std::unordered_map<uint32_t, uint32_t> sample_count_values_;
+
   std::atomic<bool> pix_capture_requested_ = false;
   bool pix_capturing_;
 
@@ -390,6 +646,28 @@ class D3D12CommandProcessor : public CommandProcessor {
   DxbcShaderTranslator::SystemConstants system_constants_;
   ColorRenderTargetFormat system_constants_color_formats_[4];
 
+  // Bits of the registers UpdateSystemConstantValues derives the system
+  // constants from, and whether any of them has been written since the last
+  // update, so the whole derivation can be skipped when none of its inputs
+  // have changed between draws.
+  uint64_t system_constants_used_register_bits_[(RegisterFile::kRegisterCount +
+                                                 63) /
+                                                64];
+  bool system_constants_input_regs_dirty_ = true;
+  // Non-register inputs of the last system constant update.
+  struct SystemConstantInputs {
+    bool shared_memory_is_uav;
+    bool primitive_two_faced;
+    uint32_t line_loop_closing_index;
+    Endian index_endian;
+    uint32_t edge_factor_base;
+    bool early_z;
+    uint32_t color_mask;
+    uint32_t color_output_map[4];
+  };
+  SystemConstantInputs system_constants_last_inputs_;
+  bool system_constants_last_inputs_valid_ = false;
+
   // Float constant usage masks of the last draw call.
   uint64_t current_float_constant_map_vertex_[4];
   uint64_t current_float_constant_map_pixel_[4];
@@ -405,6 +683,17 @@ class D3D12CommandProcessor : public CommandProcessor {
   ConstantBufferBinding cbuffer_bindings_bool_loop_;
   ConstantBufferBinding cbuffer_bindings_fetch_;
 
+  // Bit per vertex fetch constant (two fetch constant dwords each), set when
+  // the vertex buffer it points to has been validated and requested in the
+  // shared memory, so unchanged bindings can skip the request in later draws.
+  // Bits are cleared when the fetch constants are written, and the whole set
+  // is dropped when shared memory ranges are invalidated - which may happen on
+  // another thread, thus through the invalidated flag - and when a frame is
+  // opened.
+  uint64_t current_vfetch_resident_[2] = {};
+  std::atomic<bool> vfetch_residency_invalidated_ = false;
+  SharedMemory::GlobalWatchHandle shared_memory_global_watch_ = nullptr;
+
   // Pages with the descriptors currently used for handling Xenos draw calls.
   uint64_t draw_view_heap_index_;
   uint64_t draw_sampler_heap_index_;
@@ -443,6 +732,20 @@ class D3D12CommandProcessor : public CommandProcessor {
 
   // Current primitive topology.
   D3D_PRIMITIVE_TOPOLOGY primitive_topology_;
+
+  // State for merging consecutive indexed draws with identical state and
+  // adjacent index buffer ranges into one recorded draw. The previous draw
+  // may be extended only if nothing was recorded to the deferred command
+  // list after it - any pipeline, binding, barrier or constant change
+  // records commands, so comparing the stream length covers all state.
+  bool draw_merge_valid_ = false;
+  size_t draw_merge_stream_length_;
+  size_t draw_merge_index_buffer_args_offset_;
+  size_t draw_merge_draw_args_offset_;
+  // End of the previous draw's index range - the next draw's range must
+  // start exactly here to be merged.
+  D3D12_GPU_VIRTUAL_ADDRESS draw_merge_next_index_location_;
+  DXGI_FORMAT draw_merge_index_format_;
 };
 
 }  // namespace d3d12
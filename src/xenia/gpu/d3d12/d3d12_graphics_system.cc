@@ -9,11 +9,19 @@
 
 #include "xenia/gpu/d3d12/d3d12_graphics_system.h"
 
+#include "xenia/base/cvar.h"
+#include "xenia/base/frame_timeline.h"
 #include "xenia/base/logging.h"
 #include "xenia/gpu/d3d12/d3d12_command_processor.h"
 #include "xenia/ui/d3d12/d3d12_util.h"
 #include "xenia/xbox.h"
 
+DEFINE_string(d3d12_present_filter, "bilinear",
+              "Filter used to scale the front buffer to the window: bilinear "
+              "or nearest (crisp unfiltered scaling for low-resolution "
+              "output).",
+              "GPU");
+
 namespace xe {
 namespace gpu {
 namespace d3d12 {
@@ -75,7 +83,18 @@ X_STATUS D3D12GraphicsSystem::Setup(cpu::Processor* processor,
       &stretch_root_texture_range;
   stretch_root_parameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
   D3D12_STATIC_SAMPLER_DESC stretch_sampler_desc;
+  // The filter is baked into the static sampler, so the whole present
+  // pipeline set is created once for the chosen configuration. With nearest
+  // filtering the gamma ramp LUT is point-sampled too; 8-bit front buffer
+  // values land exactly on the 256-entry ramp's texel centers, so only the
+  // PWL ramp and 10-bit sources lose a little interpolation.
   stretch_sampler_desc.Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
+  if (cvars::d3d12_present_filter == "nearest") {
+    stretch_sampler_desc.Filter = D3D12_FILTER_MIN_MAG_MIP_POINT;
+  } else if (cvars::d3d12_present_filter != "bilinear") {
+    XELOGW("Unknown --d3d12_present_filter value \"%s\", using bilinear",
+           cvars::d3d12_present_filter.c_str());
+  }
   stretch_sampler_desc.AddressU = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
   stretch_sampler_desc.AddressV = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
   stretch_sampler_desc.AddressW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
@@ -199,6 +218,23 @@ std::unique_ptr<xe::ui::RawImage> D3D12GraphicsSystem::Capture() {
   return d3d12_command_processor->Capture();
 }
 
+bool D3D12GraphicsSystem::BeginFrameCapture(FrameCaptureSink sink) {
+  auto d3d12_command_processor =
+      static_cast<D3D12CommandProcessor*>(command_processor());
+  if (!d3d12_command_processor) {
+    return false;
+  }
+  return d3d12_command_processor->BeginFrameCapture(std::move(sink));
+}
+
+void D3D12GraphicsSystem::EndFrameCapture() {
+  auto d3d12_command_processor =
+      static_cast<D3D12CommandProcessor*>(command_processor());
+  if (d3d12_command_processor) {
+    d3d12_command_processor->EndFrameCapture();
+  }
+}
+
 void D3D12GraphicsSystem::StretchTextureToFrontBuffer(
     D3D12_GPU_DESCRIPTOR_HANDLE handle,
     D3D12_GPU_DESCRIPTOR_HANDLE* gamma_ramp_handle, float gamma_ramp_inv_size,
@@ -254,8 +290,10 @@ void D3D12GraphicsSystem::Swap(xe::ui::UIEvent* e) {
 
   auto& swap_state = command_processor_->swap_state();
   ID3D12DescriptorHeap* swap_srv_heap;
+  bool swap_was_pending;
   {
     std::lock_guard<std::mutex> lock(swap_state.mutex);
+    swap_was_pending = swap_state.pending;
     swap_state.pending = false;
     swap_srv_heap = reinterpret_cast<ID3D12DescriptorHeap*>(
         swap_state.front_buffer_texture);
@@ -264,6 +302,12 @@ void D3D12GraphicsSystem::Swap(xe::ui::UIEvent* e) {
     // Not ready yet.
     return;
   }
+  if (swap_was_pending) {
+    // A new guest frame is being picked up, not the previous one redrawn.
+    FrameTimeline::RecordPresent();
+  }
+
+  UpdatePresentStatistics();
 
   auto command_list = display_context_->GetSwapCommandList();
   uint32_t swap_width, swap_height;
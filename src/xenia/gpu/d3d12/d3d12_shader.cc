@@ -9,6 +9,8 @@
 
 #include "xenia/gpu/d3d12/d3d12_shader.h"
 
+#include <cstring>
+
 #include "xenia/base/assert.h"
 #include "xenia/base/logging.h"
 #include "xenia/gpu/gpu_flags.h"
@@ -60,6 +62,94 @@ void D3D12Shader::SetTexturesAndSamplers(
   }
 }
 
+bool D3D12Shader::SerializeTranslation(std::vector<uint8_t>& data_out) const {
+  if (!Shader::SerializeTranslation(data_out)) {
+    return false;
+  }
+  auto append = [&data_out](const void* data, size_t size) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    data_out.insert(data_out.end(), bytes, bytes + size);
+  };
+  auto append_uint32 = [&append](uint32_t value) { append(&value, 4); };
+
+  append_uint32(uint32_t(texture_srvs_.size()));
+  if (!texture_srvs_.empty()) {
+    append(texture_srvs_.data(), sizeof(TextureSRV) * texture_srvs_.size());
+  }
+  append_uint32(uint32_t(sampler_bindings_.size()));
+  if (!sampler_bindings_.empty()) {
+    append(sampler_bindings_.data(),
+           sizeof(SamplerBinding) * sampler_bindings_.size());
+  }
+  append_uint32(uint32_t(forced_early_z_shader_.size()));
+  if (!forced_early_z_shader_.empty()) {
+    append(forced_early_z_shader_.data(), forced_early_z_shader_.size());
+  }
+  return true;
+}
+
+size_t D3D12Shader::DeserializeTranslation(const void* data,
+                                           size_t data_size) {
+  size_t offset = Shader::DeserializeTranslation(data, data_size);
+  if (!offset) {
+    return 0;
+  }
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  auto read = [bytes, data_size, &offset](void* out, size_t size) -> bool {
+    if (data_size - offset < size) {
+      return false;
+    }
+    std::memcpy(out, bytes + offset, size);
+    offset += size;
+    return true;
+  };
+  auto fail = [this]() -> size_t {
+    // The base class part has already been committed - make sure the shader
+    // gets fully retranslated instead of being used in a half-restored state.
+    is_valid_ = false;
+    is_translated_ = false;
+    return 0;
+  };
+
+  uint32_t texture_srv_count;
+  if (!read(&texture_srv_count, 4) || texture_srv_count > kMaxTextureSRVs) {
+    return fail();
+  }
+  texture_srvs_.resize(texture_srv_count);
+  if (texture_srv_count &&
+      !read(texture_srvs_.data(), sizeof(TextureSRV) * texture_srv_count)) {
+    return fail();
+  }
+  used_texture_mask_ = 0;
+  for (const TextureSRV& srv : texture_srvs_) {
+    used_texture_mask_ |= 1u << srv.fetch_constant;
+  }
+
+  uint32_t sampler_binding_count;
+  if (!read(&sampler_binding_count, 4) ||
+      sampler_binding_count > kMaxSamplerBindings) {
+    return fail();
+  }
+  sampler_bindings_.resize(sampler_binding_count);
+  if (sampler_binding_count &&
+      !read(sampler_bindings_.data(),
+            sizeof(SamplerBinding) * sampler_binding_count)) {
+    return fail();
+  }
+
+  uint32_t forced_early_z_size;
+  if (!read(&forced_early_z_size, 4)) {
+    return fail();
+  }
+  forced_early_z_shader_.resize(forced_early_z_size);
+  if (forced_early_z_size &&
+      !read(forced_early_z_shader_.data(), forced_early_z_size)) {
+    return fail();
+  }
+
+  return offset;
+}
+
 bool D3D12Shader::DisassembleDxbc(const ui::d3d12::D3D12Provider* provider) {
   if (!host_disassembly_.empty()) {
     return true;
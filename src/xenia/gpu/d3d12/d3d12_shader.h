@@ -44,6 +44,9 @@ class D3D12Shader : public Shader {
 
   bool DisassembleDxbc(const ui::d3d12::D3D12Provider* provider);
 
+  bool SerializeTranslation(std::vector<uint8_t>& data_out) const override;
+  size_t DeserializeTranslation(const void* data, size_t data_size) override;
+
   static constexpr uint32_t kMaxTextureSRVIndexBits =
       DxbcShaderTranslator::kMaxTextureSRVIndexBits;
   static constexpr uint32_t kMaxTextureSRVs =
@@ -27,11 +27,200 @@ DeferredCommandList::DeferredCommandList(
 
 void DeferredCommandList::Reset() { command_stream_.clear(); }
 
-void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
-                                  ID3D12GraphicsCommandList1* command_list_1) {
+void DeferredCommandList::Execute(
+    ID3D12GraphicsCommandList* command_list,
+    ID3D12GraphicsCommandList1* command_list_1) const {
+  ExecuteRange(command_list, command_list_1, command_stream_.data(),
+               command_stream_.size(), nullptr);
+}
+
+void DeferredCommandList::Partition(
+    size_t chunk_count_max, std::vector<ExecutionChunk>& chunks_out) const {
+  chunks_out.clear();
+  size_t stream_size = command_stream_.size();
+  if (stream_size == 0 || chunk_count_max == 0) {
+    return;
+  }
+  const size_t header_size = xe::align(2 * sizeof(uint32_t), kAlignment);
+  size_t chunk_size_target = (stream_size + chunk_count_max - 1) /
+                             chunk_count_max;
+
+  // Offsets of the latest commands setting each piece of command list state,
+  // SIZE_MAX if not set in the stream yet.
+  constexpr size_t kOffsetNone = SIZE_MAX;
+  size_t state_descriptor_heaps = kOffsetNone;
+  size_t state_compute_root_signature = kOffsetNone;
+  size_t state_graphics_root_signature = kOffsetNone;
+  size_t state_pipeline = kOffsetNone;
+  size_t state_index_buffer = kOffsetNone;
+  size_t state_primitive_topology = kOffsetNone;
+  size_t state_viewport = kOffsetNone;
+  size_t state_scissor = kOffsetNone;
+  size_t state_blend_factor = kOffsetNone;
+  size_t state_stencil_ref = kOffsetNone;
+  size_t state_sample_positions = kOffsetNone;
+  // The latest command setting each root parameter, invalidated when the
+  // respective root signature is changed. The command processor always writes
+  // the root constants of a parameter in a single command, so keeping only the
+  // latest one per parameter is enough.
+  constexpr size_t kRootParameterTrackedCount = 16;
+  size_t state_compute_root_parameters[kRootParameterTrackedCount];
+  size_t state_graphics_root_parameters[kRootParameterTrackedCount];
+  std::fill(state_compute_root_parameters,
+            state_compute_root_parameters + kRootParameterTrackedCount,
+            kOffsetNone);
+  std::fill(state_graphics_root_parameters,
+            state_graphics_root_parameters + kRootParameterTrackedCount,
+            kOffsetNone);
+
+  ExecutionChunk chunk;
+  chunk.offset = 0;
+
+  // Whether a query is open at the current command - a query must begin and
+  // end within a single command list, so no split may happen inside one.
+  bool query_open = false;
+
   const uint8_t* stream = command_stream_.data();
-  size_t stream_remaining = command_stream_.size();
+  size_t offset = 0;
+  while (offset < stream_size) {
+    const uint32_t* header = reinterpret_cast<const uint32_t*>(stream + offset);
+    Command command = Command(header[0]);
+    const uint8_t* args = stream + offset + header_size;
+
+    if (command == Command::kD3DOMSetRenderTargets && !query_open &&
+        offset - chunk.offset >= chunk_size_target &&
+        chunks_out.size() + 2 <= chunk_count_max) {
+      chunk.size = offset - chunk.offset;
+      chunks_out.push_back(std::move(chunk));
+      chunk = ExecutionChunk();
+      chunk.offset = offset;
+      // Build the prologue restoring the state at the split point. Descriptor
+      // heaps and root signatures must be replayed before root parameters, and
+      // sample positions before the render target binding the chunk starts
+      // with.
+      std::vector<size_t>& prologue = chunk.prologue_offsets;
+      auto prologue_append = [&prologue](size_t state_offset) {
+        if (state_offset != kOffsetNone) {
+          prologue.push_back(state_offset);
+        }
+      };
+      prologue_append(state_descriptor_heaps);
+      prologue_append(state_compute_root_signature);
+      for (size_t i = 0; i < kRootParameterTrackedCount; ++i) {
+        prologue_append(state_compute_root_parameters[i]);
+      }
+      prologue_append(state_graphics_root_signature);
+      for (size_t i = 0; i < kRootParameterTrackedCount; ++i) {
+        prologue_append(state_graphics_root_parameters[i]);
+      }
+      prologue_append(state_pipeline);
+      prologue_append(state_index_buffer);
+      prologue_append(state_primitive_topology);
+      prologue_append(state_viewport);
+      prologue_append(state_scissor);
+      prologue_append(state_blend_factor);
+      prologue_append(state_stencil_ref);
+      prologue_append(state_sample_positions);
+    }
+
+    switch (command) {
+      case Command::kD3DIASetIndexBuffer:
+        state_index_buffer = offset;
+        break;
+      case Command::kD3DIASetPrimitiveTopology:
+        state_primitive_topology = offset;
+        break;
+      case Command::kD3DOMSetBlendFactor:
+        state_blend_factor = offset;
+        break;
+      case Command::kD3DOMSetStencilRef:
+        state_stencil_ref = offset;
+        break;
+      case Command::kRSSetScissorRect:
+        state_scissor = offset;
+        break;
+      case Command::kRSSetViewport:
+        state_viewport = offset;
+        break;
+      case Command::kD3DSetComputeRoot32BitConstants:
+      case Command::kD3DSetComputeRootConstantBufferView:
+      case Command::kD3DSetComputeRootDescriptorTable: {
+        // All the root parameter argument structures begin with the parameter
+        // index.
+        UINT root_parameter_index = *reinterpret_cast<const UINT*>(args);
+        if (root_parameter_index < kRootParameterTrackedCount) {
+          state_compute_root_parameters[root_parameter_index] = offset;
+        }
+      } break;
+      case Command::kD3DSetGraphicsRoot32BitConstants:
+      case Command::kD3DSetGraphicsRootConstantBufferView:
+      case Command::kD3DSetGraphicsRootDescriptorTable: {
+        UINT root_parameter_index = *reinterpret_cast<const UINT*>(args);
+        if (root_parameter_index < kRootParameterTrackedCount) {
+          state_graphics_root_parameters[root_parameter_index] = offset;
+        }
+      } break;
+      case Command::kD3DSetComputeRootSignature:
+        state_compute_root_signature = offset;
+        std::fill(state_compute_root_parameters,
+                  state_compute_root_parameters + kRootParameterTrackedCount,
+                  kOffsetNone);
+        break;
+      case Command::kD3DSetGraphicsRootSignature:
+        state_graphics_root_signature = offset;
+        std::fill(state_graphics_root_parameters,
+                  state_graphics_root_parameters + kRootParameterTrackedCount,
+                  kOffsetNone);
+        break;
+      case Command::kSetDescriptorHeaps:
+        state_descriptor_heaps = offset;
+        break;
+      case Command::kD3DSetPipelineState:
+      case Command::kSetPipelineStateHandle:
+        state_pipeline = offset;
+        break;
+      case Command::kD3DSetSamplePositions:
+        state_sample_positions = offset;
+        break;
+      case Command::kD3DBeginQuery:
+        query_open = true;
+        break;
+      case Command::kD3DEndQuery:
+        query_open = false;
+        break;
+      default:
+        break;
+    }
+
+    offset += header_size + header[1];
+  }
+  chunk.size = stream_size - chunk.offset;
+  chunks_out.push_back(std::move(chunk));
+}
+
+void DeferredCommandList::ExecuteChunk(
+    ID3D12GraphicsCommandList* command_list,
+    ID3D12GraphicsCommandList1* command_list_1,
+    const ExecutionChunk& chunk) const {
+  const uint8_t* stream = command_stream_.data();
+  const size_t header_size = xe::align(2 * sizeof(uint32_t), kAlignment);
   ID3D12PipelineState* current_pipeline_state = nullptr;
+  for (size_t prologue_offset : chunk.prologue_offsets) {
+    const uint32_t* header =
+        reinterpret_cast<const uint32_t*>(stream + prologue_offset);
+    current_pipeline_state =
+        ExecuteRange(command_list, command_list_1, stream + prologue_offset,
+                     header_size + header[1], current_pipeline_state);
+  }
+  ExecuteRange(command_list, command_list_1, stream + chunk.offset, chunk.size,
+               current_pipeline_state);
+}
+
+ID3D12PipelineState* DeferredCommandList::ExecuteRange(
+    ID3D12GraphicsCommandList* command_list,
+    ID3D12GraphicsCommandList1* command_list_1, const uint8_t* stream,
+    size_t stream_remaining,
+    ID3D12PipelineState* current_pipeline_state) const {
   while (stream_remaining != 0) {
     const uint32_t* header = reinterpret_cast<const uint32_t*>(stream);
     const size_t header_size = xe::align(2 * sizeof(uint32_t), kAlignment);
@@ -62,6 +251,12 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
         auto& args = *reinterpret_cast<const CopyTextureArguments*>(stream);
         command_list->CopyTextureRegion(&args.dst, 0, 0, 0, &args.src, nullptr);
       } break;
+      case Command::kCopyTextureRegion: {
+        auto& args =
+            *reinterpret_cast<const CopyTextureRegionArguments*>(stream);
+        command_list->CopyTextureRegion(&args.dst, args.dst_x, args.dst_y,
+                                        args.dst_z, &args.src, &args.src_box);
+      } break;
       case Command::kD3DDispatch: {
         if (current_pipeline_state != nullptr) {
           auto& args = *reinterpret_cast<const D3DDispatchArguments*>(stream);
@@ -90,6 +285,16 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
               args.start_vertex_location, args.start_instance_location);
         }
       } break;
+      case Command::kD3DBeginQuery: {
+        auto& args =
+            *reinterpret_cast<const D3DBeginEndQueryArguments*>(stream);
+        command_list->BeginQuery(args.query_heap, args.type, args.index);
+      } break;
+      case Command::kD3DEndQuery: {
+        auto& args =
+            *reinterpret_cast<const D3DBeginEndQueryArguments*>(stream);
+        command_list->EndQuery(args.query_heap, args.type, args.index);
+      } break;
       case Command::kD3DIASetIndexBuffer: {
         auto view = reinterpret_cast<const D3D12_INDEX_BUFFER_VIEW*>(stream);
         command_list->IASetIndexBuffer(
@@ -113,6 +318,14 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
       case Command::kD3DOMSetStencilRef: {
         command_list->OMSetStencilRef(*reinterpret_cast<const UINT*>(stream));
       } break;
+      case Command::kD3DResolveQueryData: {
+        auto& args =
+            *reinterpret_cast<const D3DResolveQueryDataArguments*>(stream);
+        command_list->ResolveQueryData(args.query_heap, args.type,
+                                       args.start_index, args.num_queries,
+                                       args.destination_buffer,
+                                       args.aligned_destination_buffer_offset);
+      } break;
       case Command::kD3DResourceBarrier: {
         command_list->ResourceBarrier(
             *reinterpret_cast<const UINT*>(stream),
@@ -222,6 +435,7 @@ void DeferredCommandList::Execute(ID3D12GraphicsCommandList* command_list,
     stream += header[1];
     stream_remaining -= header[1];
   }
+  return current_pipeline_state;
 }
 
 void* DeferredCommandList::WriteCommand(Command command,
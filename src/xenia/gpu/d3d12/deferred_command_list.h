@@ -30,7 +30,32 @@ class DeferredCommandList {
 
   void Reset();
   void Execute(ID3D12GraphicsCommandList* command_list,
-               ID3D12GraphicsCommandList1* command_list_1);
+               ID3D12GraphicsCommandList1* command_list_1) const;
+
+  // Length of the stream recorded so far - comparing lengths from two points
+  // tells whether any commands were recorded between them.
+  size_t GetCommandStreamLength() const { return command_stream_.size(); }
+
+  // A portion of the stream that can be replayed into its own command list.
+  // Direct3D 12 command lists don't inherit state, so the prologue contains
+  // offsets of the state-setting commands that are in effect at the split
+  // point and must be replayed before the chunk. The offsets reference the
+  // stream - chunks are valid until Reset.
+  struct ExecutionChunk {
+    size_t offset;
+    size_t size;
+    std::vector<size_t> prologue_offsets;
+  };
+  // Splits the stream at render target binding changes into up to
+  // chunk_count_max chunks of roughly equal size, for replaying into separate
+  // command lists on multiple threads. The command lists must be submitted in
+  // chunk order. May return a single chunk (for instance, when the ROV output
+  // path is used and render target bindings rarely change).
+  void Partition(size_t chunk_count_max,
+                 std::vector<ExecutionChunk>& chunks_out) const;
+  void ExecuteChunk(ID3D12GraphicsCommandList* command_list,
+                    ID3D12GraphicsCommandList1* command_list_1,
+                    const ExecutionChunk& chunk) const;
 
   inline void D3DClearUnorderedAccessViewUint(
       D3D12_GPU_DESCRIPTOR_HANDLE view_gpu_handle_in_current_heap,
@@ -78,6 +103,20 @@ class DeferredCommandList {
     std::memcpy(&args.src, &src, sizeof(D3D12_TEXTURE_COPY_LOCATION));
   }
 
+  inline void CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION& dst,
+                                UINT dst_x, UINT dst_y, UINT dst_z,
+                                const D3D12_TEXTURE_COPY_LOCATION& src,
+                                const D3D12_BOX& src_box) {
+    auto& args = *reinterpret_cast<CopyTextureRegionArguments*>(WriteCommand(
+        Command::kCopyTextureRegion, sizeof(CopyTextureRegionArguments)));
+    std::memcpy(&args.dst, &dst, sizeof(D3D12_TEXTURE_COPY_LOCATION));
+    args.dst_x = dst_x;
+    args.dst_y = dst_y;
+    args.dst_z = dst_z;
+    std::memcpy(&args.src, &src, sizeof(D3D12_TEXTURE_COPY_LOCATION));
+    args.src_box = src_box;
+  }
+
   inline void D3DDispatch(UINT thread_group_count_x, UINT thread_group_count_y,
                           UINT thread_group_count_z) {
     auto& args = *reinterpret_cast<D3DDispatchArguments*>(
@@ -87,11 +126,13 @@ class DeferredCommandList {
     args.thread_group_count_z = thread_group_count_z;
   }
 
-  inline void D3DDrawIndexedInstanced(UINT index_count_per_instance,
-                                      UINT instance_count,
-                                      UINT start_index_location,
-                                      INT base_vertex_location,
-                                      UINT start_instance_location) {
+  // Returns the offset of the arguments in the command stream, usable for
+  // merging via MergeDrawIndexedInstanced until Reset.
+  inline size_t D3DDrawIndexedInstanced(UINT index_count_per_instance,
+                                        UINT instance_count,
+                                        UINT start_index_location,
+                                        INT base_vertex_location,
+                                        UINT start_instance_location) {
     auto& args = *reinterpret_cast<D3DDrawIndexedInstancedArguments*>(
         WriteCommand(Command::kD3DDrawIndexedInstanced,
                      sizeof(D3DDrawIndexedInstancedArguments)));
@@ -100,6 +141,22 @@ class DeferredCommandList {
     args.start_index_location = start_index_location;
     args.base_vertex_location = base_vertex_location;
     args.start_instance_location = start_instance_location;
+    return reinterpret_cast<const uint8_t*>(&args) - command_stream_.data();
+  }
+
+  // Appends a contiguous index range to previously recorded index buffer
+  // binding and draw commands (identified by the offsets returned when they
+  // were recorded) instead of recording a new draw, for merging consecutive
+  // draws with identical state.
+  inline void MergeDrawIndexedInstanced(size_t index_buffer_args_offset,
+                                        size_t draw_args_offset,
+                                        UINT index_count, UINT size_in_bytes) {
+    auto& view = *reinterpret_cast<D3D12_INDEX_BUFFER_VIEW*>(
+        command_stream_.data() + index_buffer_args_offset);
+    view.SizeInBytes += size_in_bytes;
+    auto& args = *reinterpret_cast<D3DDrawIndexedInstancedArguments*>(
+        command_stream_.data() + draw_args_offset);
+    args.index_count_per_instance += index_count;
   }
 
   inline void D3DDrawInstanced(UINT vertex_count_per_instance,
@@ -113,7 +170,27 @@ class DeferredCommandList {
     args.start_instance_location = start_instance_location;
   }
 
-  inline void D3DIASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* view) {
+  inline void D3DBeginQuery(ID3D12QueryHeap* query_heap, D3D12_QUERY_TYPE type,
+                            UINT index) {
+    auto& args = *reinterpret_cast<D3DBeginEndQueryArguments*>(WriteCommand(
+        Command::kD3DBeginQuery, sizeof(D3DBeginEndQueryArguments)));
+    args.query_heap = query_heap;
+    args.type = type;
+    args.index = index;
+  }
+
+  inline void D3DEndQuery(ID3D12QueryHeap* query_heap, D3D12_QUERY_TYPE type,
+                          UINT index) {
+    auto& args = *reinterpret_cast<D3DBeginEndQueryArguments*>(WriteCommand(
+        Command::kD3DEndQuery, sizeof(D3DBeginEndQueryArguments)));
+    args.query_heap = query_heap;
+    args.type = type;
+    args.index = index;
+  }
+
+  // Returns the offset of the arguments in the command stream, usable for
+  // merging via MergeDrawIndexedInstanced until Reset.
+  inline size_t D3DIASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* view) {
     auto& args = *reinterpret_cast<D3D12_INDEX_BUFFER_VIEW*>(WriteCommand(
         Command::kD3DIASetIndexBuffer, sizeof(D3D12_INDEX_BUFFER_VIEW)));
     if (view != nullptr) {
@@ -125,6 +202,7 @@ class DeferredCommandList {
       args.SizeInBytes = 0;
       args.Format = DXGI_FORMAT_UNKNOWN;
     }
+    return reinterpret_cast<const uint8_t*>(&args) - command_stream_.data();
   }
 
   inline void D3DIASetPrimitiveTopology(
@@ -191,6 +269,22 @@ class DeferredCommandList {
                 num_barriers * sizeof(D3D12_RESOURCE_BARRIER));
   }
 
+  inline void D3DResolveQueryData(ID3D12QueryHeap* query_heap,
+                                  D3D12_QUERY_TYPE type, UINT start_index,
+                                  UINT num_queries,
+                                  ID3D12Resource* destination_buffer,
+                                  UINT64 aligned_destination_buffer_offset) {
+    auto& args = *reinterpret_cast<D3DResolveQueryDataArguments*>(
+        WriteCommand(Command::kD3DResolveQueryData,
+                     sizeof(D3DResolveQueryDataArguments)));
+    args.query_heap = query_heap;
+    args.type = type;
+    args.start_index = start_index;
+    args.num_queries = num_queries;
+    args.destination_buffer = destination_buffer;
+    args.aligned_destination_buffer_offset = aligned_destination_buffer_offset;
+  }
+
   inline void RSSetScissorRect(const D3D12_RECT& rect) {
     auto& arg = *reinterpret_cast<D3D12_RECT*>(
         WriteCommand(Command::kRSSetScissorRect, sizeof(D3D12_RECT)));
@@ -325,14 +419,18 @@ class DeferredCommandList {
     kD3DCopyBufferRegion,
     kD3DCopyResource,
     kCopyTexture,
+    kCopyTextureRegion,
     kD3DDispatch,
     kD3DDrawIndexedInstanced,
     kD3DDrawInstanced,
+    kD3DBeginQuery,
+    kD3DEndQuery,
     kD3DIASetIndexBuffer,
     kD3DIASetPrimitiveTopology,
     kD3DOMSetBlendFactor,
     kD3DOMSetRenderTargets,
     kD3DOMSetStencilRef,
+    kD3DResolveQueryData,
     kD3DResourceBarrier,
     kRSSetScissorRect,
     kRSSetViewport,
@@ -379,6 +477,15 @@ class DeferredCommandList {
     D3D12_TEXTURE_COPY_LOCATION src;
   };
 
+  struct CopyTextureRegionArguments {
+    D3D12_TEXTURE_COPY_LOCATION dst;
+    UINT dst_x;
+    UINT dst_y;
+    UINT dst_z;
+    D3D12_TEXTURE_COPY_LOCATION src;
+    D3D12_BOX src_box;
+  };
+
   struct D3DDispatchArguments {
     UINT thread_group_count_x;
     UINT thread_group_count_y;
@@ -400,6 +507,12 @@ class DeferredCommandList {
     UINT start_instance_location;
   };
 
+  struct D3DBeginEndQueryArguments {
+    ID3D12QueryHeap* query_heap;
+    D3D12_QUERY_TYPE type;
+    UINT index;
+  };
+
   struct D3DOMSetRenderTargetsArguments {
     uint8_t num_render_target_descriptors;
     bool rts_single_handle_to_descriptor_range;
@@ -409,6 +522,15 @@ class DeferredCommandList {
     D3D12_CPU_DESCRIPTOR_HANDLE depth_stencil_descriptor;
   };
 
+  struct D3DResolveQueryDataArguments {
+    ID3D12QueryHeap* query_heap;
+    D3D12_QUERY_TYPE type;
+    UINT start_index;
+    UINT num_queries;
+    ID3D12Resource* destination_buffer;
+    UINT64 aligned_destination_buffer_offset;
+  };
+
   struct SetRoot32BitConstantsHeader {
     UINT root_parameter_index;
     UINT num_32bit_values_to_set;
@@ -438,6 +560,13 @@ class DeferredCommandList {
 
   void* WriteCommand(Command command, size_t arguments_size);
 
+  // Executes a part of the stream, returning the pipeline state bound after it
+  // (draws and dispatches are dropped while it's null).
+  ID3D12PipelineState* ExecuteRange(
+      ID3D12GraphicsCommandList* command_list,
+      ID3D12GraphicsCommandList1* command_list_1, const uint8_t* stream,
+      size_t stream_size, ID3D12PipelineState* current_pipeline_state) const;
+
   D3D12CommandProcessor* command_processor_;
 
   std::vector<uint8_t> command_stream_;
@@ -19,12 +19,14 @@
 
 #include "xenia/base/assert.h"
 #include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/string.h"
 #include "xenia/gpu/d3d12/d3d12_command_processor.h"
 #include "xenia/gpu/gpu_flags.h"
+#include "xenia/kernel/kernel_state.h"
 
 DEFINE_bool(d3d12_dxbc_disasm, false,
             "Disassemble DXBC shaders after generation.", "D3D12");
@@ -45,6 +47,20 @@ DEFINE_bool(
 DEFINE_bool(d3d12_tessellation_wireframe, false,
             "Display tessellated surfaces as wireframe for debugging.",
             "D3D12");
+DEFINE_bool(
+    d3d12_async_shader_translation, false,
+    "Translate Xenos shaders on the pipeline creation threads instead of the "
+    "command processor thread, skipping draws that need a shader until its "
+    "translation is done. Removes first-use hitches at the cost of objects "
+    "possibly missing for a frame when they first appear.",
+    "D3D12");
+DEFINE_string(
+    d3d12_pipeline_cache_dir, "",
+    "Directory to store pipeline descriptions and shader ucode in, one file "
+    "per title, so pipeline states can be recreated on the creation threads "
+    "at the next launch instead of hitching on first use. Empty to disable, "
+    "{game_cache} for the per-title cache directory.",
+    "D3D12");
 
 namespace xe {
 namespace gpu {
@@ -62,6 +78,11 @@ namespace d3d12 {
 #include "xenia/gpu/d3d12/shaders/dxbc/tessellation_quad_vs.h"
 #include "xenia/gpu/d3d12/shaders/dxbc/tessellation_triangle_vs.h"
 
+namespace {
+StatCounter count_draws("gpu/pipeline_cache/draws");
+StatCounter count_cache_hits("gpu/pipeline_cache/hits");
+}  // namespace
+
 PipelineCache::PipelineCache(D3D12CommandProcessor* command_processor,
                              RegisterFile* register_file, bool edram_rov_used,
                              uint32_t resolution_scale)
@@ -108,6 +129,8 @@ bool PipelineCache::Initialize() {
 }
 
 void PipelineCache::Shutdown() {
+  FlushShaderStorage();
+
   ClearCache();
 
   // Shut down all threads.
@@ -130,9 +153,11 @@ void PipelineCache::ClearCache() {
   current_pipeline_ = nullptr;
 
   if (!creation_threads_.empty()) {
-    // Empty the pipeline creation queue.
+    // Empty the translation and pipeline creation queues.
     {
       std::lock_guard<std::mutex> lock(creation_request_lock_);
+      translation_queue_.clear();
+      translation_pending_.clear();
       creation_queue_.clear();
       creation_completion_set_event_ = true;
     }
@@ -154,13 +179,259 @@ void PipelineCache::ClearCache() {
   shader_map_.clear();
 }
 
+// Storage file layout: header, then storage_shader_count_ shader records
+// (ShaderStoredHeader + ucode dwords + serialized translation results), then
+// pipeline description records.
+constexpr uint32_t kPipelineStorageMagic = 'XPSO';
+// Must be incremented whenever the stored structures, the serialization format
+// of Shader::SerializeTranslation or the output of DxbcShaderTranslator
+// change - stored translations are reused without consulting the translator.
+constexpr uint32_t kPipelineStorageVersion = 2;
+
+struct PipelineStorageFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t vendor_id;
+  uint32_t edram_rov_used;
+  uint32_t resolution_scale;
+  uint32_t shader_count;
+  uint32_t pipeline_count;
+};
+
+std::wstring PipelineCache::GetShaderStoragePath() const {
+  return xe::join_paths(
+      xe::to_wstring(cvars::d3d12_pipeline_cache_dir),
+      xe::format_string(L"%.8X.d3d12.xpso", storage_title_id_));
+}
+
+void PipelineCache::InitializeShaderStorage() {
+  if (cvars::d3d12_pipeline_cache_dir.empty()) {
+    return;
+  }
+  // The title ID is the storage key - can't persist anything before the
+  // launched module is known.
+  uint32_t title_id = command_processor_->kernel_state()->title_id();
+  if (!title_id) {
+    return;
+  }
+  storage_title_id_ = title_id;
+  storage_active_ = true;
+
+  FILE* file = xe::filesystem::OpenFile(GetShaderStoragePath(), "rb");
+  if (!file) {
+    return;
+  }
+  auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
+  PipelineStorageFileHeader file_header;
+  if (fread(&file_header, sizeof(file_header), 1, file) != 1 ||
+      file_header.magic != kPipelineStorageMagic ||
+      file_header.version != kPipelineStorageVersion ||
+      file_header.vendor_id != provider->GetAdapterVendorID() ||
+      file_header.edram_rov_used != uint32_t(edram_rov_used_) ||
+      file_header.resolution_scale != resolution_scale_) {
+    // Stale or foreign storage - drop it, it will be rewritten on shutdown.
+    XELOGGPU("Pipeline storage for title %.8X is incompatible; discarding",
+             title_id);
+    fclose(file);
+    return;
+  }
+
+  storage_loading_ = true;
+
+  // Restore all stored shaders, preferably from their serialized translation
+  // results, re-translating only when a stored translation is unusable.
+  uint32_t shaders_loaded = 0;
+  std::vector<uint32_t> ucode;
+  std::vector<uint8_t> translation_data;
+  for (uint32_t i = 0; i < file_header.shader_count; ++i) {
+    ShaderStoredHeader shader_header;
+    if (fread(&shader_header, sizeof(shader_header), 1, file) != 1 ||
+        !shader_header.ucode_dword_count ||
+        shader_header.ucode_dword_count > 64 * 1024 ||
+        shader_header.translation_data_size > 16 * 1024 * 1024) {
+      break;
+    }
+    ucode.resize(shader_header.ucode_dword_count);
+    if (fread(ucode.data(), sizeof(uint32_t) * shader_header.ucode_dword_count,
+              1, file) != 1) {
+      break;
+    }
+    translation_data.resize(shader_header.translation_data_size);
+    if (shader_header.translation_data_size &&
+        fread(translation_data.data(), shader_header.translation_data_size, 1,
+              file) != 1) {
+      break;
+    }
+
+    uint64_t data_hash =
+        XXH64(ucode.data(), shader_header.ucode_dword_count * sizeof(uint32_t),
+              0);
+    if (shader_map_.find(data_hash) == shader_map_.end()) {
+      D3D12Shader* shader = new D3D12Shader(shader_header.type, data_hash,
+                                            ucode.data(),
+                                            shader_header.ucode_dword_count);
+      shader_map_.insert({data_hash, shader});
+      if (!translation_data.empty() &&
+          shader->DeserializeTranslation(translation_data.data(),
+                                         translation_data.size())) {
+        ++shaders_loaded;
+      } else {
+        if (!translation_data.empty()) {
+          XELOGGPU("Stored translation of shader %.16" PRIX64
+                   " is unusable; re-translating",
+                   data_hash);
+          translation_data.clear();
+        }
+        reg::SQ_PROGRAM_CNTL sq_program_cntl;
+        sq_program_cntl.value = shader_header.sq_program_cntl;
+        if (TranslateShader(shader_translator_.get(), shader, sq_program_cntl,
+                            shader_header.tessellated != 0,
+                            shader_header.primitive_type)) {
+          ++shaders_loaded;
+          // Refresh the record so the next run doesn't translate either.
+          shader->SerializeTranslation(translation_data);
+        }
+      }
+    }
+
+    // Keep the record for the next flush regardless of whether this run could
+    // use it.
+    shader_header.translation_data_size = uint32_t(translation_data.size());
+    const uint8_t* record_begin =
+        reinterpret_cast<const uint8_t*>(&shader_header);
+    storage_shaders_data_.insert(storage_shaders_data_.end(), record_begin,
+                                 record_begin + sizeof(shader_header));
+    const uint8_t* ucode_begin = reinterpret_cast<const uint8_t*>(ucode.data());
+    storage_shaders_data_.insert(
+        storage_shaders_data_.end(), ucode_begin,
+        ucode_begin + sizeof(uint32_t) * shader_header.ucode_dword_count);
+    if (!translation_data.empty()) {
+      storage_shaders_data_.insert(storage_shaders_data_.end(),
+                                   translation_data.begin(),
+                                   translation_data.end());
+    }
+    ++storage_shader_count_;
+  }
+
+  // Recreate the pipelines on the creation threads - the title boots while
+  // the drivers chew through them, and the wait in EndSubmission keeps the
+  // first frame correct.
+  uint32_t pipelines_loaded = 0;
+  for (uint32_t i = 0; i < file_header.pipeline_count; ++i) {
+    PipelineStoredDescription stored;
+    if (fread(&stored, sizeof(stored), 1, file) != 1) {
+      break;
+    }
+    storage_pipelines_.push_back(stored);
+
+    auto vertex_shader_it = shader_map_.find(stored.vertex_shader_hash);
+    if (vertex_shader_it == shader_map_.end() ||
+        !vertex_shader_it->second->is_valid()) {
+      continue;
+    }
+    D3D12Shader* vertex_shader = vertex_shader_it->second;
+    D3D12Shader* pixel_shader = nullptr;
+    if (stored.pixel_shader_hash) {
+      auto pixel_shader_it = shader_map_.find(stored.pixel_shader_hash);
+      if (pixel_shader_it == shader_map_.end() ||
+          !pixel_shader_it->second->is_valid()) {
+        continue;
+      }
+      pixel_shader = pixel_shader_it->second;
+    }
+
+    PipelineDescription description;
+    std::memcpy(&description, &stored.description, sizeof(description));
+    description.vertex_shader = vertex_shader;
+    description.pixel_shader = pixel_shader;
+    bool tessellated =
+        description.tessellation_mode != PipelineTessellationMode::kNone;
+    description.root_signature = command_processor_->GetRootSignature(
+        vertex_shader, pixel_shader, tessellated);
+    if (description.root_signature == nullptr) {
+      continue;
+    }
+
+    uint64_t hash = XXH64(&description, sizeof(description), 0);
+    bool duplicate = false;
+    auto found_range = pipelines_.equal_range(hash);
+    for (auto iter = found_range.first; iter != found_range.second; ++iter) {
+      if (!std::memcmp(&iter->second->description, &description,
+                       sizeof(description))) {
+        duplicate = true;
+        break;
+      }
+    }
+    if (duplicate) {
+      continue;
+    }
+    Pipeline* new_pipeline = new Pipeline;
+    new_pipeline->state = nullptr;
+    std::memcpy(&new_pipeline->description, &description, sizeof(description));
+    pipelines_.insert(std::make_pair(hash, new_pipeline));
+    if (!creation_threads_.empty()) {
+      {
+        std::lock_guard<std::mutex> lock(creation_request_lock_);
+        creation_queue_.push_back(new_pipeline);
+      }
+      creation_request_cond_.notify_one();
+    } else {
+      new_pipeline->state = CreatePipelineState(description);
+    }
+    ++pipelines_loaded;
+  }
+  COUNT_profile_set("gpu/pipeline_cache/pipelines", pipelines_.size());
+
+  storage_loading_ = false;
+  fclose(file);
+  XELOGGPU(
+      "Pipeline storage for title %.8X: restored %u shaders, warming up %u "
+      "pipeline states",
+      title_id, shaders_loaded, pipelines_loaded);
+}
+
+void PipelineCache::FlushShaderStorage() {
+  if (!storage_active_) {
+    return;
+  }
+  xe::filesystem::CreateFolder(
+      xe::to_wstring(cvars::d3d12_pipeline_cache_dir));
+  FILE* file = xe::filesystem::OpenFile(GetShaderStoragePath(), "wb");
+  if (!file) {
+    XELOGE("Failed to write pipeline storage for title %.8X",
+           storage_title_id_);
+    return;
+  }
+  auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
+  PipelineStorageFileHeader file_header;
+  file_header.magic = kPipelineStorageMagic;
+  file_header.version = kPipelineStorageVersion;
+  file_header.vendor_id = provider->GetAdapterVendorID();
+  file_header.edram_rov_used = uint32_t(edram_rov_used_);
+  file_header.resolution_scale = resolution_scale_;
+  file_header.shader_count = storage_shader_count_;
+  file_header.pipeline_count = uint32_t(storage_pipelines_.size());
+  fwrite(&file_header, sizeof(file_header), 1, file);
+  if (!storage_shaders_data_.empty()) {
+    fwrite(storage_shaders_data_.data(), storage_shaders_data_.size(), 1,
+           file);
+  }
+  if (!storage_pipelines_.empty()) {
+    fwrite(storage_pipelines_.data(),
+           sizeof(PipelineStoredDescription) * storage_pipelines_.size(), 1,
+           file);
+  }
+  fclose(file);
+}
+
 void PipelineCache::EndSubmission() {
   if (!creation_threads_.empty()) {
     // Await creation of all queued pipelines.
     bool await_event = false;
     {
       std::lock_guard<std::mutex> lock(creation_request_lock_);
-      if (!creation_queue_.empty() || creation_threads_busy_ != 0) {
+      if (!translation_queue_.empty() || !creation_queue_.empty() ||
+          creation_threads_busy_ != 0) {
         creation_completion_event_->Reset();
         creation_completion_set_event_ = true;
         await_event = true;
@@ -218,21 +489,99 @@ bool PipelineCache::EnsureShadersTranslated(D3D12Shader* vertex_shader,
                   xenos::VertexShaderExportMode::kMultipass);
   assert_false(sq_program_cntl.gen_index_vtx);
 
+  if (cvars::d3d12_async_shader_translation && !creation_threads_.empty()) {
+    // Queue translation of whatever isn't ready to the creation threads and
+    // skip the draw for this frame - the command processor thread must not
+    // stall on translation.
+    bool translations_pending = false;
+    for (D3D12Shader* shader : {vertex_shader, pixel_shader}) {
+      if (shader == nullptr || shader->is_translated()) {
+        continue;
+      }
+      translations_pending = true;
+      {
+        std::lock_guard<std::mutex> lock(creation_request_lock_);
+        if (translation_pending_.find(shader) != translation_pending_.end()) {
+          continue;
+        }
+        translation_pending_.insert(shader);
+        TranslationRequest request;
+        request.shader = shader;
+        request.sq_program_cntl = sq_program_cntl;
+        request.tessellated = tessellated;
+        request.primitive_type = primitive_type;
+        translation_queue_.push_back(request);
+      }
+      creation_request_cond_.notify_one();
+    }
+    if (translations_pending) {
+      return false;
+    }
+    // Everything translated on a previous frame - fail the same way the
+    // synchronous path does if translation wasn't successful.
+    return vertex_shader->is_valid() &&
+           (pixel_shader == nullptr || pixel_shader->is_valid());
+  }
+
+  // Wait for translations the trace playback prescan handed to the creation
+  // threads - while a shader is in the pending set a worker owns it, so it
+  // must not be translated inline; the others keep translating on the pool
+  // in the meantime.
+  if (!creation_threads_.empty()) {
+    std::unique_lock<std::mutex> lock(creation_request_lock_);
+    while (translation_pending_.count(vertex_shader) != 0 ||
+           (pixel_shader != nullptr &&
+            translation_pending_.count(pixel_shader) != 0)) {
+      translation_completion_cond_.wait(lock);
+    }
+  }
+
   if (!vertex_shader->is_translated() &&
-      !TranslateShader(vertex_shader, sq_program_cntl, tessellated,
-                       primitive_type)) {
+      !TranslateShader(shader_translator_.get(), vertex_shader,
+                       sq_program_cntl, tessellated, primitive_type)) {
     XELOGE("Failed to translate the vertex shader!");
     return false;
   }
   if (pixel_shader != nullptr && !pixel_shader->is_translated() &&
-      !TranslateShader(pixel_shader, sq_program_cntl, tessellated,
-                       primitive_type)) {
+      !TranslateShader(shader_translator_.get(), pixel_shader, sq_program_cntl,
+                       tessellated, primitive_type)) {
     XELOGE("Failed to translate the pixel shader!");
     return false;
   }
   return true;
 }
 
+void PipelineCache::QueueShaderTranslation(D3D12Shader* vertex_shader,
+                                           D3D12Shader* pixel_shader,
+                                           reg::SQ_PROGRAM_CNTL sq_program_cntl,
+                                           bool tessellated,
+                                           PrimitiveType primitive_type,
+                                           bool even_when_synchronous) {
+  if ((!cvars::d3d12_async_shader_translation && !even_when_synchronous) ||
+      creation_threads_.empty()) {
+    return;
+  }
+  for (D3D12Shader* shader : {vertex_shader, pixel_shader}) {
+    if (shader == nullptr || shader->is_translated()) {
+      continue;
+    }
+    {
+      std::lock_guard<std::mutex> lock(creation_request_lock_);
+      if (translation_pending_.find(shader) != translation_pending_.end()) {
+        continue;
+      }
+      translation_pending_.insert(shader);
+      TranslationRequest request;
+      request.shader = shader;
+      request.sq_program_cntl = sq_program_cntl;
+      request.tessellated = tessellated;
+      request.primitive_type = primitive_type;
+      translation_queue_.push_back(request);
+    }
+    creation_request_cond_.notify_one();
+  }
+}
+
 bool PipelineCache::ConfigurePipeline(
     D3D12Shader* vertex_shader, D3D12Shader* pixel_shader, bool tessellated,
     PrimitiveType primitive_type, IndexFormat index_format, bool early_z,
@@ -245,6 +594,15 @@ bool PipelineCache::ConfigurePipeline(
   assert_not_null(pipeline_handle_out);
   assert_not_null(root_signature_out);
 
+  count_draws.Increment();
+
+  // By the first draw the launched title is known - open the storage for it
+  // and warm up everything stored during previous runs.
+  if (!storage_checked_) {
+    storage_checked_ = true;
+    InitializeShaderStorage();
+  }
+
   PipelineDescription description;
   if (!GetCurrentStateDescription(vertex_shader, pixel_shader, tessellated,
                                   primitive_type, index_format, early_z,
@@ -255,6 +613,7 @@ bool PipelineCache::ConfigurePipeline(
   if (current_pipeline_ != nullptr &&
       !std::memcmp(&current_pipeline_->description, &description,
                    sizeof(description))) {
+    count_cache_hits.Increment();
     *pipeline_handle_out = current_pipeline_;
     *root_signature_out = description.root_signature;
     return true;
@@ -267,6 +626,7 @@ bool PipelineCache::ConfigurePipeline(
     Pipeline* found_pipeline = iter->second;
     if (!std::memcmp(&found_pipeline->description, &description,
                      sizeof(description))) {
+      count_cache_hits.Increment();
       current_pipeline_ = found_pipeline;
       *pipeline_handle_out = found_pipeline;
       *root_signature_out = found_pipeline->description.root_signature;
@@ -285,6 +645,18 @@ bool PipelineCache::ConfigurePipeline(
   pipelines_.insert(std::make_pair(hash, new_pipeline));
   COUNT_profile_set("gpu/pipeline_cache/pipelines", pipelines_.size());
 
+  if (storage_active_) {
+    PipelineStoredDescription stored;
+    stored.vertex_shader_hash = vertex_shader->ucode_data_hash();
+    stored.pixel_shader_hash =
+        pixel_shader ? pixel_shader->ucode_data_hash() : 0;
+    std::memcpy(&stored.description, &description, sizeof(description));
+    stored.description.root_signature = nullptr;
+    stored.description.vertex_shader = nullptr;
+    stored.description.pixel_shader = nullptr;
+    storage_pipelines_.push_back(stored);
+  }
+
   if (!creation_threads_.empty()) {
     // Submit the pipeline for creation to any available thread.
     {
@@ -302,12 +674,13 @@ bool PipelineCache::ConfigurePipeline(
   return true;
 }
 
-bool PipelineCache::TranslateShader(D3D12Shader* shader,
+bool PipelineCache::TranslateShader(DxbcShaderTranslator* translator,
+                                    D3D12Shader* shader,
                                     reg::SQ_PROGRAM_CNTL cntl, bool tessellated,
                                     PrimitiveType primitive_type) {
   // Perform translation.
   // If this fails the shader will be marked as invalid and ignored later.
-  if (!shader_translator_->Translate(
+  if (!translator->Translate(
           shader, tessellated ? primitive_type : PrimitiveType::kNone, cntl)) {
     XELOGE("Shader %.16" PRIX64 " translation failed; marking as ignored",
            shader->ucode_data_hash());
@@ -316,10 +689,10 @@ bool PipelineCache::TranslateShader(D3D12Shader* shader,
 
   uint32_t texture_srv_count;
   const DxbcShaderTranslator::TextureSRV* texture_srvs =
-      shader_translator_->GetTextureSRVs(texture_srv_count);
+      translator->GetTextureSRVs(texture_srv_count);
   uint32_t sampler_binding_count;
   const DxbcShaderTranslator::SamplerBinding* sampler_bindings =
-      shader_translator_->GetSamplerBindings(sampler_binding_count);
+      translator->GetSamplerBindings(sampler_binding_count);
   shader->SetTexturesAndSamplers(texture_srvs, texture_srv_count,
                                  sampler_bindings, sampler_binding_count);
 
@@ -354,6 +727,38 @@ bool PipelineCache::TranslateShader(D3D12Shader* shader,
     shader->Dump(cvars::dump_shaders, "d3d12");
   }
 
+  if (storage_active_ && !storage_loading_ && shader->is_valid()) {
+    // Record the ucode, the translation inputs and the translation results for
+    // the next run. With asynchronous translation, multiple creation threads
+    // may append at once.
+    std::vector<uint8_t> translation_data;
+    shader->SerializeTranslation(translation_data);
+    std::lock_guard<std::mutex> storage_lock(storage_write_lock_);
+    ShaderStoredHeader stored_header;
+    stored_header.type = shader->type();
+    stored_header.sq_program_cntl = cntl.value;
+    stored_header.tessellated = tessellated ? 1 : 0;
+    stored_header.primitive_type =
+        tessellated ? primitive_type : PrimitiveType::kNone;
+    stored_header.ucode_dword_count = uint32_t(shader->ucode_dword_count());
+    stored_header.translation_data_size = uint32_t(translation_data.size());
+    const uint8_t* record_begin =
+        reinterpret_cast<const uint8_t*>(&stored_header);
+    storage_shaders_data_.insert(storage_shaders_data_.end(), record_begin,
+                                 record_begin + sizeof(stored_header));
+    const uint8_t* ucode_begin =
+        reinterpret_cast<const uint8_t*>(shader->ucode_dwords());
+    storage_shaders_data_.insert(
+        storage_shaders_data_.end(), ucode_begin,
+        ucode_begin + sizeof(uint32_t) * shader->ucode_dword_count());
+    if (!translation_data.empty()) {
+      storage_shaders_data_.insert(storage_shaders_data_.end(),
+                                   translation_data.begin(),
+                                   translation_data.end());
+    }
+    ++storage_shader_count_;
+  }
+
   return shader->is_valid();
 }
 
@@ -1072,16 +1477,25 @@ ID3D12PipelineState* PipelineCache::CreatePipelineState(
 }
 
 void PipelineCache::CreationThread() {
+  // Each thread translates with its own translator - the reusable translator
+  // keeps per-translation state and must not be shared.
+  auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
+  DxbcShaderTranslator translator(provider->GetAdapterVendorID(),
+                                  edram_rov_used_);
+
   while (true) {
+    TranslationRequest translation_request;
+    translation_request.shader = nullptr;
     Pipeline* pipeline_to_create = nullptr;
 
     // Check if need to shut down or set the completion event and dequeue the
-    // pipeline if there is any.
+    // translation request or the pipeline if there is any.
     {
       std::unique_lock<std::mutex> lock(creation_request_lock_);
-      if (creation_threads_shutdown_ || creation_queue_.empty()) {
+      if (creation_threads_shutdown_ ||
+          (translation_queue_.empty() && creation_queue_.empty())) {
         if (creation_completion_set_event_ && creation_threads_busy_ == 0) {
-          // Last pipeline in the queue created - signal the event if requested.
+          // Last request in the queue handled - signal the event if requested.
           creation_completion_set_event_ = false;
           creation_completion_event_->Set();
         }
@@ -1091,15 +1505,38 @@ void PipelineCache::CreationThread() {
         creation_request_cond_.wait(lock);
         continue;
       }
-      // Take the pipeline from the queue and increment the busy thread count
-      // until the pipeline in created - other threads must be able to dequeue
-      // requests, but can't set the completion event until the pipelines are
-      // fully created (rather than just started creating).
-      pipeline_to_create = creation_queue_.front();
-      creation_queue_.pop_front();
+      // Shader translation unblocks draws that were skipped, so it's handled
+      // ahead of pipeline creation. Increment the busy thread count until the
+      // request is fully handled - other threads must be able to dequeue
+      // requests, but can't set the completion event until the work is fully
+      // done (rather than just started).
+      if (!translation_queue_.empty()) {
+        translation_request = translation_queue_.front();
+        translation_queue_.pop_front();
+      } else {
+        pipeline_to_create = creation_queue_.front();
+        creation_queue_.pop_front();
+      }
       ++creation_threads_busy_;
     }
 
+    if (translation_request.shader != nullptr) {
+      // Translate the shader.
+      TranslateShader(&translator, translation_request.shader,
+                      translation_request.sq_program_cntl,
+                      translation_request.tessellated,
+                      translation_request.primitive_type);
+      {
+        std::unique_lock<std::mutex> lock(creation_request_lock_);
+        // Erased only now that is_translated() is visible - while the shader
+        // is in the set, the command processor won't re-queue it.
+        translation_pending_.erase(translation_request.shader);
+        --creation_threads_busy_;
+        translation_completion_cond_.notify_all();
+      }
+      continue;
+    }
+
     // Create the pipeline.
     pipeline_to_create->state =
         CreatePipelineState(pipeline_to_create->description);
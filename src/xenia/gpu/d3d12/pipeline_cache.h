@@ -14,8 +14,10 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "xenia/base/threading.h"
@@ -44,6 +46,15 @@ class PipelineCache {
 
   void EndSubmission();
 
+  // Shader translations don't depend on the resolution scale (it's read from
+  // a system constant), and the scale only affects new pipeline descriptions
+  // through the slope-scaled depth bias, which is part of the hashed
+  // description - so pipelines of both scales coexist in the cache and this
+  // may be switched between frames without flushing anything.
+  void SetResolutionScale(uint32_t resolution_scale) {
+    resolution_scale_ = resolution_scale;
+  }
+
   D3D12Shader* LoadShader(ShaderType shader_type, uint32_t guest_address,
                           const uint32_t* host_address, uint32_t dword_count);
 
@@ -52,6 +63,20 @@ class PipelineCache {
                                D3D12Shader* pixel_shader, bool tessellated,
                                PrimitiveType primitive_type);
 
+  // Queues asynchronous translation of shaders an upcoming draw was seen
+  // using by the command buffer lookahead scan, so they are more likely to
+  // be ready by the time the draw is actually issued. No-op when
+  // d3d12_async_shader_translation is disabled unless even_when_synchronous
+  // is set (trace playback prescan) - in that case EnsureShadersTranslated
+  // waits for the queued translation instead of skipping the draw, so draws
+  // are never dropped while translation still fans out across the creation
+  // threads.
+  void QueueShaderTranslation(D3D12Shader* vertex_shader,
+                              D3D12Shader* pixel_shader,
+                              reg::SQ_PROGRAM_CNTL sq_program_cntl,
+                              bool tessellated, PrimitiveType primitive_type,
+                              bool even_when_synchronous = false);
+
   bool ConfigurePipeline(
       D3D12Shader* vertex_shader, D3D12Shader* pixel_shader, bool tessellated,
       PrimitiveType primitive_type, IndexFormat index_format, bool early_z,
@@ -171,8 +196,38 @@ class PipelineCache {
     PipelineRenderTarget render_targets[4];
   };
 
-  bool TranslateShader(D3D12Shader* shader, reg::SQ_PROGRAM_CNTL cntl,
-                       bool tessellated, PrimitiveType primitive_type);
+  // On-disk pipeline storage (--d3d12_pipeline_cache_dir): the raw ucode and
+  // the serialized translation results of every successfully translated
+  // shader, followed by the description of every pipeline, so the next run of
+  // the same title can restore the shaders without invoking the translator and
+  // recreate the pipelines on the creation threads before the title hits them
+  // mid-frame.
+  struct ShaderStoredHeader {
+    ShaderType type;
+    uint32_t sq_program_cntl;
+    uint32_t tessellated;
+    PrimitiveType primitive_type;
+    uint32_t ucode_dword_count;
+    // Size of the Shader::SerializeTranslation data following the ucode, or 0
+    // if only the ucode was stored (in this case the translation inputs above
+    // are used to re-translate it when loading).
+    uint32_t translation_data_size;
+  };
+  struct PipelineStoredDescription {
+    uint64_t vertex_shader_hash;
+    uint64_t pixel_shader_hash;
+    // Pointer fields (root signature, shaders) are written as null and
+    // re-resolved from the hashes when loading.
+    PipelineDescription description;
+  };
+
+  void InitializeShaderStorage();
+  void FlushShaderStorage();
+  std::wstring GetShaderStoragePath() const;
+
+  bool TranslateShader(DxbcShaderTranslator* translator, D3D12Shader* shader,
+                       reg::SQ_PROGRAM_CNTL cntl, bool tessellated,
+                       PrimitiveType primitive_type);
 
   bool GetCurrentStateDescription(
       D3D12Shader* vertex_shader, D3D12Shader* pixel_shader, bool tessellated,
@@ -212,6 +267,23 @@ class PipelineCache {
   // changed.
   Pipeline* current_pipeline_ = nullptr;
 
+  // Pipeline storage state. The serialized records are kept in memory (they
+  // survive ClearCache, which destroys the shader/pipeline objects they were
+  // built from) and rewritten as a whole in FlushShaderStorage.
+  bool storage_checked_ = false;
+  bool storage_active_ = false;
+  // Set while loading the storage file so TranslateShader doesn't re-append
+  // records that came from it.
+  bool storage_loading_ = false;
+  uint32_t storage_title_id_ = 0;
+  std::vector<uint8_t> storage_shaders_data_;
+  uint32_t storage_shader_count_ = 0;
+  std::vector<PipelineStoredDescription> storage_pipelines_;
+
+  // Serializes appends to the shader storage blob - with asynchronous
+  // translation, multiple creation threads may finish translating at once.
+  std::mutex storage_write_lock_;
+
   // Pipeline creation threads.
   void CreationThread();
   std::mutex creation_request_lock_;
@@ -219,6 +291,24 @@ class PipelineCache {
   // Protected with creation_request_lock_, notify_one creation_request_cond_
   // when set.
   std::deque<Pipeline*> creation_queue_;
+  // Asynchronous shader translation (--d3d12_async_shader_translation):
+  // requests are serviced by the creation threads ahead of pipeline creation,
+  // and draws using a still-untranslated shader are skipped for the frame.
+  // Both protected with creation_request_lock_, notify_one
+  // creation_request_cond_ on push.
+  struct TranslationRequest {
+    D3D12Shader* shader;
+    reg::SQ_PROGRAM_CNTL sq_program_cntl;
+    bool tessellated;
+    PrimitiveType primitive_type;
+  };
+  std::deque<TranslationRequest> translation_queue_;
+  std::unordered_set<D3D12Shader*> translation_pending_;
+  // Notified (with creation_request_lock_ held) every time a creation thread
+  // finishes a translation and erases it from translation_pending_, for the
+  // synchronous path of EnsureShadersTranslated to wait on shaders the trace
+  // prescan handed to the workers.
+  std::condition_variable translation_completion_cond_;
   // Number of threads that are currently creating a pipeline - incremented when
   // a pipeline is dequeued (the completion event can't be triggered before this
   // is zero). Protected with creation_request_lock_.
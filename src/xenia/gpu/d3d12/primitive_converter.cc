@@ -21,6 +21,8 @@
 #include "xenia/gpu/d3d12/d3d12_command_processor.h"
 #include "xenia/ui/d3d12/d3d12_util.h"
 
+#include "third_party/xxhash/xxhash.h"
+
 DEFINE_bool(d3d12_convert_quads_to_triangles, false,
             "Convert quad lists to triangle lists on the CPU instead of using "
             "a geometry shader. Not recommended for playing, for debugging "
@@ -38,6 +40,7 @@ constexpr uint32_t PrimitiveConverter::kStaticIBTriangleFanCount;
 constexpr uint32_t PrimitiveConverter::kStaticIBQuadOffset;
 constexpr uint32_t PrimitiveConverter::kStaticIBQuadCount;
 constexpr uint32_t PrimitiveConverter::kStaticIBTotalCount;
+constexpr size_t PrimitiveConverter::kConvertedIndicesDataCacheLimit;
 
 PrimitiveConverter::PrimitiveConverter(D3D12CommandProcessor* command_processor,
                                        RegisterFile* register_file,
@@ -56,12 +59,6 @@ bool PrimitiveConverter::Initialize() {
   auto device =
       command_processor_->GetD3D12Context()->GetD3D12Provider()->GetDevice();
 
-  // There can be at most 65535 indices in a Xenos draw call, but they can be up
-  // to 4 bytes large, and conversion can add more indices (almost triple the
-  // count for triangle strips, for instance).
-  buffer_pool_ =
-      std::make_unique<ui::d3d12::UploadBufferPool>(device, 4 * 1024 * 1024);
-
   // Create the static index buffer for non-indexed drawing.
   D3D12_RESOURCE_DESC static_ib_desc;
   ui::d3d12::util::FillBufferResourceDesc(
@@ -137,10 +134,12 @@ void PrimitiveConverter::Shutdown() {
   }
   ui::d3d12::util::ReleaseAndNull(static_ib_);
   ui::d3d12::util::ReleaseAndNull(static_ib_upload_);
-  buffer_pool_.reset();
 }
 
-void PrimitiveConverter::ClearCache() { buffer_pool_->ClearCache(); }
+void PrimitiveConverter::ClearCache() {
+  converted_indices_data_cache_.clear();
+  converted_indices_data_bytes_ = 0;
+}
 
 void PrimitiveConverter::BeginSubmission() {
   // Got a command list now - upload and transition the static index buffer if
@@ -164,7 +163,6 @@ void PrimitiveConverter::BeginSubmission() {
 }
 
 void PrimitiveConverter::BeginFrame() {
-  buffer_pool_->Reclaim(command_processor_->GetCompletedFrame());
   converted_indices_cache_.clear();
   memory_regions_used_ = 0;
 }
@@ -296,6 +294,46 @@ PrimitiveConverter::ConversionResult PrimitiveConverter::ConvertPrimitives(
   };
   source = memory_->TranslatePhysical(address);
 
+  // Check if this exact index data has already been converted in a previous
+  // frame. The hash is recomputed from the current contents of the memory, so
+  // a hit means the data is identical and only the upload to this frame's
+  // buffer has to be redone - guest writes make old entries unreachable rather
+  // than stale.
+  uint64_t data_hash =
+      XXH64(source, index_buffer_size,
+            converted_indices.key.value ^ (reset ? reset_index : 0));
+  auto data_cached_iter = converted_indices_data_cache_.find(data_hash);
+  if (data_cached_iter != converted_indices_data_cache_.end()) {
+    const ConvertedIndicesData& data_cached = data_cached_iter->second;
+    trace_writer_->WriteMemoryRead(address, index_buffer_size);
+    converted_indices.converted_index_count = data_cached.converted_index_count;
+    if (!data_cached.conversion_needed ||
+        data_cached.converted_index_count == 0) {
+      converted_indices.gpu_address = 0;
+      converted_indices_cache_.insert(
+          std::make_pair(converted_indices.key.value, converted_indices));
+      memory_regions_used_ |= memory_regions_used_bits;
+      return data_cached.converted_index_count == 0
+                 ? ConversionResult::kPrimitiveEmpty
+                 : ConversionResult::kConversionNotNeeded;
+    }
+    D3D12_GPU_VIRTUAL_ADDRESS cached_gpu_address;
+    void* cached_target = AllocateIndices(
+        index_format, data_cached.converted_index_count, 0, cached_gpu_address);
+    if (cached_target == nullptr) {
+      return ConversionResult::kFailed;
+    }
+    std::memcpy(cached_target, data_cached.data.data(),
+                data_cached.data.size());
+    converted_indices.gpu_address = cached_gpu_address;
+    converted_indices_cache_.insert(
+        std::make_pair(converted_indices.key.value, converted_indices));
+    memory_regions_used_ |= memory_regions_used_bits;
+    gpu_address_out = cached_gpu_address;
+    index_count_out = data_cached.converted_index_count;
+    return ConversionResult::kConverted;
+  }
+
   // Calculate the new index count, and also check if there's nothing to convert
   // in the buffer (for instance, if not using actually primitive reset).
   uint32_t converted_index_count = 0;
@@ -343,7 +381,6 @@ PrimitiveConverter::ConversionResult PrimitiveConverter::ConvertPrimitives(
     };
     check_source = source;
     uint32_t check_indices_remaining = index_count;
-    alignas(16) uint64_t check_result[2];
     if (index_format == IndexFormat::kInt32) {
       while (check_indices_remaining != 0 && (check_source_uintptr & 15)) {
         --check_indices_remaining;
@@ -355,10 +392,11 @@ PrimitiveConverter::ConversionResult PrimitiveConverter::ConvertPrimitives(
       __m128i check_reset_index_vector = _mm_set1_epi32(reset_index);
       while (check_indices_remaining >= 4) {
         check_indices_remaining -= 4;
-        _mm_store_si128(reinterpret_cast<__m128i*>(&check_result),
-                        _mm_cmpeq_epi32(_mm_load_si128(check_source_128++),
-                                        check_reset_index_vector));
-        if (check_result[0] || check_result[1]) {
+        // Compare-equal + movemask keeps the result in registers instead of
+        // round-tripping the comparison mask through memory.
+        if (_mm_movemask_epi8(
+                _mm_cmpeq_epi32(_mm_load_si128(check_source_128++),
+                                check_reset_index_vector))) {
           conversion_needed = true;
           check_indices_remaining = 0;
         }
@@ -381,10 +419,9 @@ PrimitiveConverter::ConversionResult PrimitiveConverter::ConvertPrimitives(
       __m128i check_reset_index_vector = _mm_set1_epi16(reset_index);
       while (check_indices_remaining >= 8) {
         check_indices_remaining -= 8;
-        _mm_store_si128(reinterpret_cast<__m128i*>(&check_result),
-                        _mm_cmpeq_epi16(_mm_load_si128(check_source_128++),
-                                        check_reset_index_vector));
-        if (check_result[0] || check_result[1]) {
+        if (_mm_movemask_epi8(
+                _mm_cmpeq_epi16(_mm_load_si128(check_source_128++),
+                                check_reset_index_vector))) {
           conversion_needed = true;
           check_indices_remaining = 0;
         }
@@ -454,6 +491,12 @@ PrimitiveConverter::ConversionResult PrimitiveConverter::ConvertPrimitives(
     converted_indices_cache_.insert(
         std::make_pair(converted_indices.key.value, converted_indices));
     memory_regions_used_ |= memory_regions_used_bits;
+    // Remember the scan result across frames too, so strips that don't
+    // actually use the reset index aren't rescanned every frame.
+    ConvertedIndicesData& data_to_cache =
+        converted_indices_data_cache_[data_hash];
+    data_to_cache.conversion_needed = conversion_needed;
+    data_to_cache.converted_index_count = converted_index_count;
     return converted_index_count == 0 ? ConversionResult::kPrimitiveEmpty
                                       : ConversionResult::kConversionNotNeeded;
   }
@@ -665,6 +708,25 @@ PrimitiveConverter::ConversionResult PrimitiveConverter::ConvertPrimitives(
     }
   }
 
+  // Store the converted indices for reuse in future frames. When the limit is
+  // reached, drop the whole data cache - unreachable entries can't be detected
+  // individually, and titles rarely churn through this much converted
+  // geometry.
+  uint32_t converted_data_size = converted_index_count * index_size;
+  if (converted_indices_data_bytes_ + converted_data_size >
+      kConvertedIndicesDataCacheLimit) {
+    converted_indices_data_cache_.clear();
+    converted_indices_data_bytes_ = 0;
+  }
+  ConvertedIndicesData& data_to_cache =
+      converted_indices_data_cache_[data_hash];
+  data_to_cache.conversion_needed = true;
+  data_to_cache.converted_index_count = converted_index_count;
+  data_to_cache.data.assign(
+      reinterpret_cast<const uint8_t*>(target),
+      reinterpret_cast<const uint8_t*>(target) + converted_data_size);
+  converted_indices_data_bytes_ += converted_data_size;
+
   // Cache and return the indices.
   converted_indices.gpu_address = gpu_address;
   converted_indices_cache_.insert(
@@ -694,9 +756,9 @@ void* PrimitiveConverter::AllocateIndices(
     size += 16;
   }
   D3D12_GPU_VIRTUAL_ADDRESS gpu_address;
-  uint8_t* mapping =
-      buffer_pool_->Request(command_processor_->GetCurrentFrame(), size,
-                            nullptr, nullptr, &gpu_address);
+  uint8_t* mapping = command_processor_->GetStagingMemoryManager()->Request(
+      command_processor_->GetCurrentFrame(), size, 16, nullptr, nullptr,
+      &gpu_address);
   if (mapping == nullptr) {
     XELOGE("Failed to allocate space for %u converted %u-bit vertex indices",
            count, format == IndexFormat::kInt32 ? 32 : 16);
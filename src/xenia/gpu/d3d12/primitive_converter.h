@@ -13,13 +13,13 @@
 #include <atomic>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "xenia/gpu/register_file.h"
 #include "xenia/gpu/trace_writer.h"
 #include "xenia/gpu/xenos.h"
 #include "xenia/memory.h"
 #include "xenia/ui/d3d12/d3d12_context.h"
-#include "xenia/ui/d3d12/pools.h"
 
 namespace xe {
 namespace gpu {
@@ -105,8 +105,6 @@ class PrimitiveConverter {
   Memory* memory_;
   TraceWriter* trace_writer_;
 
-  std::unique_ptr<ui::d3d12::UploadBufferPool> buffer_pool_ = nullptr;
-
   // Static index buffers for emulating unsupported primitive types when drawing
   // without an index buffer.
   // CPU-side, used only for uploading - destroyed once the copy commands have
@@ -171,6 +169,30 @@ class PrimitiveConverter {
   // Cache for a single frame.
   std::unordered_multimap<uint64_t, ConvertedIndices> converted_indices_cache_;
 
+  // Cross-frame cache of conversion results, keyed with the XXH64 of the
+  // guest index data (seeded with the conversion parameters). Since the hash
+  // is recomputed from the current contents of the memory every draw, entries
+  // can never become stale - guest writes simply make them unreachable - so
+  // no write watching is needed for this cache, only a size limit. On a hit,
+  // the pre-converted indices are memcpy'd to the frame's upload buffer
+  // instead of re-running the conversion (and, for strips, the reset index
+  // scan).
+  struct ConvertedIndicesData {
+    // If false, the source buffer can be used directly (no reset index found
+    // in it) - data is empty in this case, as well as when the primitive is
+    // empty (converted_index_count is 0).
+    bool conversion_needed;
+    uint32_t converted_index_count;
+    std::vector<uint8_t> data;
+  };
+  std::unordered_map<uint64_t, ConvertedIndicesData>
+      converted_indices_data_cache_;
+  // Total size of the data in converted_indices_data_cache_ - when it exceeds
+  // the limit, the whole cache is dropped (very coarse, but unreachable
+  // entries can't be detected individually anyway).
+  size_t converted_indices_data_bytes_ = 0;
+  static constexpr size_t kConvertedIndicesDataCacheLimit = 32 * 1024 * 1024;
+
   // Very coarse cache invalidation - if something is modified in a 8 MB portion
   // of the physical memory and converted indices are also there, invalidate all
   // the cache.
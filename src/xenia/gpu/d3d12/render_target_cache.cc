@@ -63,6 +63,18 @@ namespace d3d12 {
 #include "xenia/gpu/d3d12/shaders/dxbc/resolve_ps.h"
 #include "xenia/gpu/d3d12/shaders/dxbc/resolve_vs.h"
 
+namespace {
+// Resolves are done entirely on the GPU timeline - these count how often each
+// path is taken, and how many resolves had to be dropped because there's no
+// pipeline for the destination format (there is no CPU fallback for those, so
+// any non-zero dropped count means visible corruption to investigate).
+StatCounter count_resolves_compute(
+    "gpu/render_target_cache/resolves_compute");
+StatCounter count_resolves_draw("gpu/render_target_cache/resolves_draw");
+StatCounter count_resolves_dropped(
+    "gpu/render_target_cache/resolves_dropped");
+}  // namespace
+
 #if 0
 constexpr uint32_t RenderTargetCache::kHeap4MBPages;
 #endif
@@ -109,9 +121,12 @@ RenderTargetCache::RenderTargetCache(D3D12CommandProcessor* command_processor,
 RenderTargetCache::~RenderTargetCache() { Shutdown(); }
 
 bool RenderTargetCache::Initialize(const TextureCache* texture_cache) {
-  // EDRAM buffer size depends on this.
+  // EDRAM buffer size depends on this - sized for the largest scale the
+  // device can do, so the scale can be switched without recreating it.
+  resolution_scale_2x_supported_ =
+      texture_cache->IsResolutionScale2XSupported();
   resolution_scale_2x_ = texture_cache->IsResolutionScale2X();
-  assert_false(resolution_scale_2x_ &&
+  assert_false(resolution_scale_2x_supported_ &&
                !command_processor_->IsROVUsedForEDRAM());
 
   auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
@@ -254,7 +269,8 @@ bool RenderTargetCache::Initialize(const TextureCache* texture_cache) {
     // samples within host pixels) doesn't always exist for each mode - depth is
     // not resolved using drawing, for example.
     bool load_2x_resolve_pipeline_used =
-        resolution_scale_2x_ && mode_info.load_2x_resolve_shader != nullptr;
+        resolution_scale_2x_supported_ &&
+        mode_info.load_2x_resolve_shader != nullptr;
     if (load_2x_resolve_pipeline_used) {
       edram_load_2x_resolve_pipelines_[i] =
           ui::d3d12::util::CreateComputePipeline(
@@ -1377,6 +1393,7 @@ bool RenderTargetCache::ResolveCopy(SharedMemory* shared_memory,
     // Raw copy
     // *************************************************************************
     XELOGGPU("Resolve: Copying using a compute shader");
+    count_resolves_compute.Increment();
 
     // Calculate the size of the region that specifically is being resolved.
     // Can't just use the texture height for size calculation because it's
@@ -1522,6 +1539,7 @@ bool RenderTargetCache::ResolveCopy(SharedMemory* shared_memory,
     // Conversion and AA resolving
     // *************************************************************************
     XELOGGPU("Resolve: Copying via drawing");
+    count_resolves_draw.Increment();
 
     // Get everything we need for the conversion.
 
@@ -1533,12 +1551,14 @@ bool RenderTargetCache::ResolveCopy(SharedMemory* shared_memory,
           "No resolve pipeline for destination format %s - tell Xenia "
           "developers!",
           FormatInfo::Get(dest_format)->name);
+      count_resolves_dropped.Increment();
       return false;
     }
     // Resolve pipeline.
     ID3D12PipelineState* resolve_pipeline =
         GetResolvePipeline(dest_dxgi_format);
     if (resolve_pipeline == nullptr) {
+      count_resolves_dropped.Increment();
       return false;
     }
     RenderTargetKey render_target_key;
@@ -1945,6 +1965,8 @@ bool RenderTargetCache::ResolveClear(uint32_t edram_base,
   command_list->D3DDispatch(row_width_ss_div_80, rows, 1);
   CommitEDRAMBufferUAVWrites(true);
 
+  MarkEDRAMTilesWritten(edram_base, rows * surface_pitch_tiles);
+
   return true;
 }
 
@@ -2163,6 +2185,17 @@ void RenderTargetCache::WriteEDRAMUint32UAVDescriptor(
       D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 }
 
+void RenderTargetCache::SetResolutionScale2X(bool enabled) {
+  enabled = enabled && resolution_scale_2x_supported_;
+  if (resolution_scale_2x_ == enabled) {
+    return;
+  }
+  resolution_scale_2x_ = enabled;
+  // Resolve target keys include the scale, so targets of the old scale stay
+  // cached for switching back. Bindings only exist without ROV, and scaling
+  // requires ROV, so there's nothing currently attached to drop.
+}
+
 ColorRenderTargetFormat RenderTargetCache::GetBaseColorFormat(
     ColorRenderTargetFormat format) {
   switch (format) {
@@ -2280,6 +2313,8 @@ void RenderTargetCache::RestoreEDRAMSnapshot(const void* snapshot) {
   command_processor_->SubmitBarriers();
   command_list->D3DCopyBufferRegion(edram_buffer_, 0, upload_buffer,
                                     upload_buffer_offset, kEDRAMSize);
+  // The snapshot may contain meaningful data anywhere in EDRAM.
+  MarkEDRAMTilesWritten(0, 2048);
   if (!command_processor_->IsROVUsedForEDRAM()) {
     // Clear and ignore the old 32-bit float depth - the non-ROV path is
     // inaccurate anyway, and this is backend-specific, not a part of a guest
@@ -2321,7 +2356,9 @@ uint32_t RenderTargetCache::GetEDRAMBufferSize() const {
     // drawing without precision loss in case of EDRAM store/load.
     size *= 2;
   }
-  if (resolution_scale_2x_) {
+  if (resolution_scale_2x_supported_) {
+    // Sized for the largest scale upfront so runtime scale switches don't
+    // need to recreate the buffer and its descriptors.
     size *= 4;
   }
   return size;
@@ -2344,6 +2381,32 @@ void RenderTargetCache::CommitEDRAMBufferUAVWrites(bool force) {
   edram_buffer_modified_ = false;
 }
 
+void RenderTargetCache::MarkEDRAMTilesWritten(uint32_t base,
+                                              uint32_t tile_count) {
+  uint32_t tile_last = std::min(base + tile_count, 2048u);
+  for (uint32_t i = base; i < tile_last; ++i) {
+    edram_tiles_written_[i >> 6] |= uint64_t(1) << (i & 63);
+  }
+}
+
+uint32_t RenderTargetCache::GetEDRAMWrittenRows(uint32_t base,
+                                                uint32_t pitch_tiles,
+                                                uint32_t row_count) const {
+  if (pitch_tiles == 0) {
+    return 0;
+  }
+  uint32_t tile_count = std::min(base + row_count * pitch_tiles, 2048u) - base;
+  // Find the last written tile in the region - everything up to and including
+  // the row it belongs to must be loaded.
+  for (uint32_t i = base + tile_count; i > base;) {
+    --i;
+    if (edram_tiles_written_[i >> 6] & (uint64_t(1) << (i & 63))) {
+      return (i - base) / pitch_tiles + 1;
+    }
+  }
+  return 0;
+}
+
 void RenderTargetCache::WriteEDRAMRawSRVDescriptor(
     D3D12_CPU_DESCRIPTOR_HANDLE handle) {
   auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
@@ -2694,22 +2757,53 @@ void RenderTargetCache::StoreRenderTargetsToEDRAM() {
   // copy sources and calculate copy buffer size.
   uint32_t store_bindings[5];
   uint32_t store_binding_count = 0;
-  uint32_t copy_buffer_size = 0;
   for (uint32_t i = 0; i < 5; ++i) {
     const RenderTargetBinding& binding = current_bindings_[i];
     RenderTarget* render_target = binding.render_target;
     if (!binding.is_bound || render_target == nullptr ||
-        binding.edram_dirty_rows < 0) {
+        binding.edram_dirty_rows == 0) {
       continue;
     }
     store_bindings[store_binding_count++] = i;
-    copy_buffer_size =
-        std::max(copy_buffer_size, render_target->copy_buffer_size);
   }
   if (store_binding_count == 0) {
     return;
   }
 
+  // Sort the bindings in ascending order of EDRAM base so data in the render
+  // targets placed farther in EDRAM isn't lost in case of overlap.
+  std::sort(store_bindings, store_bindings + store_binding_count,
+            [this](uint32_t a, uint32_t b) {
+              uint32_t base_a = current_bindings_[a].edram_base;
+              uint32_t base_b = current_bindings_[b].edram_base;
+              if (base_a == base_b) {
+                // If EDRAM bases are the same (not really a valid usage, but
+                // happens in Banjo-Tooie - in case color writing was enabled
+                // for invalid render targets in some draw call), treat the
+                // render targets with the lowest index as more important (it's
+                // the primary one after all, while the rest are additional).
+                // Depth buffer has lower priority, otherwise the Xbox Live
+                // Arcade logo disappears.
+                return a > b;
+              }
+              return base_a < base_b;
+            });
+
+  // Give each render target its own region of the copy buffer so all the
+  // texture-to-buffer copies can be done in one pass with a single transition
+  // to a shader resource afterwards, rather than ping-ponging the buffer state
+  // for every render target.
+  uint32_t store_copy_offsets[5];
+  uint32_t copy_buffer_size = 0;
+  for (uint32_t i = 0; i < store_binding_count; ++i) {
+    const RenderTarget* render_target =
+        current_bindings_[store_bindings[i]].render_target;
+    store_copy_offsets[i] = copy_buffer_size;
+    copy_buffer_size +=
+        xe::align(render_target->copy_buffer_size,
+                  uint32_t(D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT));
+  }
+
   // Allocate descriptors for the buffers.
   D3D12_CPU_DESCRIPTOR_HANDLE descriptor_cpu_start;
   D3D12_GPU_DESCRIPTOR_HANDLE descriptor_gpu_start;
@@ -2750,25 +2844,6 @@ void RenderTargetCache::StoreRenderTargetsToEDRAM() {
       provider->OffsetViewDescriptor(descriptor_cpu_start, 1));
   command_list->D3DSetComputeRootDescriptorTable(1, descriptor_gpu_start);
 
-  // Sort the bindings in ascending order of EDRAM base so data in the render
-  // targets placed farther in EDRAM isn't lost in case of overlap.
-  std::sort(store_bindings, store_bindings + store_binding_count,
-            [this](uint32_t a, uint32_t b) {
-              uint32_t base_a = current_bindings_[a].edram_base;
-              uint32_t base_b = current_bindings_[b].edram_base;
-              if (base_a == base_b) {
-                // If EDRAM bases are the same (not really a valid usage, but
-                // happens in Banjo-Tooie - in case color writing was enabled
-                // for invalid render targets in some draw call), treat the
-                // render targets with the lowest index as more important (it's
-                // the primary one after all, while the rest are additional).
-                // Depth buffer has lower priority, otherwise the Xbox Live
-                // Arcade logo disappears.
-                return a > b;
-              }
-              return base_a < base_b;
-            });
-
   // Calculate the dispatch width.
   uint32_t surface_pitch_ss =
       current_surface_pitch_ *
@@ -2776,19 +2851,12 @@ void RenderTargetCache::StoreRenderTargetsToEDRAM() {
   uint32_t surface_pitch_tiles = (surface_pitch_ss + 79) / 80;
   assert_true(surface_pitch_tiles != 0);
 
-  // Store each render target.
+  // Copy all the render targets to the copy buffer in one pass.
+  command_processor_->SubmitBarriers();
   for (uint32_t i = 0; i < store_binding_count; ++i) {
     const RenderTargetBinding& binding = current_bindings_[store_bindings[i]];
     const RenderTarget* render_target = binding.render_target;
-    bool is_64bpp = false;
-
-    // Transition the copy buffer to copy destination.
-    command_processor_->PushTransitionBarrier(copy_buffer, copy_buffer_state,
-                                              D3D12_RESOURCE_STATE_COPY_DEST);
-    copy_buffer_state = D3D12_RESOURCE_STATE_COPY_DEST;
-    command_processor_->SubmitBarriers();
-
-    // Copy from the render target planes and set up the layout.
+    uint32_t copy_offset = store_copy_offsets[i];
     D3D12_TEXTURE_COPY_LOCATION location_source, location_dest;
     location_source.pResource = render_target->resource;
     location_source.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
@@ -2796,8 +2864,45 @@ void RenderTargetCache::StoreRenderTargetsToEDRAM() {
     location_dest.pResource = copy_buffer;
     location_dest.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
     location_dest.PlacedFootprint = render_target->footprints[0];
-    // TODO(Triang3l): Box for color render targets.
-    command_list->CopyTexture(location_dest, location_source);
+    location_dest.PlacedFootprint.Offset += copy_offset;
+    if (render_target->key.is_depth) {
+      // Partial box copies of depth-stencil planes aren't allowed in Direct3D
+      // 12, copy the whole subresources.
+      command_list->CopyTexture(location_dest, location_source);
+      location_source.SubresourceIndex = 1;
+      location_dest.PlacedFootprint = render_target->footprints[1];
+      location_dest.PlacedFootprint.Offset += copy_offset;
+      command_list->CopyTexture(location_dest, location_source);
+    } else {
+      // Only the dirty part of the color render target is stored, so only copy
+      // the rows the store will actually read.
+      D3D12_BOX source_box;
+      source_box.left = 0;
+      source_box.top = 0;
+      source_box.front = 0;
+      source_box.right = location_dest.PlacedFootprint.Footprint.Width;
+      source_box.bottom =
+          std::min(binding.edram_dirty_rows << 4,
+                   location_dest.PlacedFootprint.Footprint.Height);
+      source_box.back = 1;
+      command_list->CopyTextureRegion(location_dest, 0, 0, 0, location_source,
+                                      source_box);
+    }
+  }
+
+  // Transition the copy buffer to SRV.
+  command_processor_->PushTransitionBarrier(
+      copy_buffer, copy_buffer_state,
+      D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+  copy_buffer_state = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+
+  // Store each render target.
+  uint32_t stored_tile_first = UINT32_MAX, stored_tile_end = 0;
+  for (uint32_t i = 0; i < store_binding_count; ++i) {
+    const RenderTargetBinding& binding = current_bindings_[store_bindings[i]];
+    const RenderTarget* render_target = binding.render_target;
+    uint32_t copy_offset = store_copy_offsets[i];
+
     EDRAMLoadStoreRootConstants root_constants;
     uint32_t rt_pitch_tiles = surface_pitch_tiles;
     if (!render_target->key.is_depth &&
@@ -2809,28 +2914,30 @@ void RenderTargetCache::StoreRenderTargetsToEDRAM() {
     root_constants.base_samples_2x_depth_pitch =
         binding.edram_base | (rt_pitch_tiles << 16);
     root_constants.rt_color_depth_offset =
-        uint32_t(location_dest.PlacedFootprint.Offset);
+        uint32_t(render_target->footprints[0].Offset) + copy_offset;
     root_constants.rt_color_depth_pitch =
-        location_dest.PlacedFootprint.Footprint.RowPitch;
+        render_target->footprints[0].Footprint.RowPitch;
     if (render_target->key.is_depth) {
       root_constants.base_samples_2x_depth_pitch |= 1 << 15;
-      location_source.SubresourceIndex = 1;
-      location_dest.PlacedFootprint = render_target->footprints[1];
-      command_list->CopyTexture(location_dest, location_source);
       root_constants.rt_stencil_offset =
-          uint32_t(location_dest.PlacedFootprint.Offset);
+          uint32_t(render_target->footprints[1].Offset) + copy_offset;
       root_constants.rt_stencil_pitch =
-          location_dest.PlacedFootprint.Footprint.RowPitch;
+          render_target->footprints[1].Footprint.RowPitch;
     }
 
-    // Transition the copy buffer to SRV.
-    command_processor_->PushTransitionBarrier(
-        copy_buffer, copy_buffer_state,
-        D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-    copy_buffer_state = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
-    command_processor_->SubmitBarriers();
+    // A UAV barrier is only needed between stores to overlapping EDRAM ranges -
+    // stores to disjoint ranges can go back to back.
+    uint32_t tile_first = binding.edram_base;
+    uint32_t tile_end = std::min(
+        tile_first + binding.edram_dirty_rows * rt_pitch_tiles, 2048u);
+    if (tile_first < stored_tile_end && stored_tile_first < tile_end) {
+      CommitEDRAMBufferUAVWrites(true);
+    }
+    stored_tile_first = std::min(stored_tile_first, tile_first);
+    stored_tile_end = std::max(stored_tile_end, tile_end);
 
     // Store the data.
+    command_processor_->SubmitBarriers();
     command_list->D3DSetComputeRoot32BitConstants(
         0, sizeof(root_constants) / sizeof(uint32_t), &root_constants, 0);
     EDRAMLoadStoreMode mode = GetLoadStoreMode(render_target->key.is_depth,
@@ -2840,10 +2947,12 @@ void RenderTargetCache::StoreRenderTargetsToEDRAM() {
     // 1 group per 80x16 samples.
     command_list->D3DDispatch(surface_pitch_tiles, binding.edram_dirty_rows, 1);
 
-    // Commit the UAV write.
-    CommitEDRAMBufferUAVWrites(true);
+    MarkEDRAMTilesWritten(tile_first, tile_end - tile_first);
   }
 
+  // Commit the UAV writes.
+  CommitEDRAMBufferUAVWrites(true);
+
   command_processor_->ReleaseScratchGPUBuffer(copy_buffer, copy_buffer_state);
 }
 
@@ -2857,6 +2966,65 @@ void RenderTargetCache::LoadRenderTargetsFromEDRAM(
 
   auto command_list = command_processor_->GetDeferredCommandList();
 
+  // Select the render targets that actually need to be loaded - only the rows
+  // up to the last EDRAM tile ever written need to be filled, the rest of the
+  // EDRAM has never received anything from the guest, so its contents (and thus
+  // the contents of the corresponding rows of the render target) are undefined
+  // to it. Also give each render target its own region of the copy buffer so
+  // all the load dispatches can write concurrently (to disjoint ranges, without
+  // UAV barriers in between), followed by all the buffer-to-texture copies
+  // after a single transition.
+  uint32_t load_indices[5];
+  uint32_t load_rows[5];
+  uint32_t load_copy_offsets[5];
+  uint32_t load_count = 0;
+  uint32_t copy_buffer_size = 0;
+  for (uint32_t i = 0; i < render_target_count; ++i) {
+    if (edram_bases[i] >= 2048) {
+      // Something is wrong with the load.
+      continue;
+    }
+    const RenderTarget* render_target = render_targets[i];
+
+    // Get the number of EDRAM tiles per row.
+    uint32_t edram_pitch_tiles = render_target->key.width_ss_div_80;
+    if (!render_target->key.is_depth &&
+        IsColorFormat64bpp(
+            ColorRenderTargetFormat(render_target->key.format))) {
+      edram_pitch_tiles *= 2;
+    }
+    // Clamp the height if somehow requested a render target that is too large.
+    uint32_t edram_rows =
+        std::min(render_target->key.height_ss_div_16,
+                 (2048u - edram_bases[i]) / edram_pitch_tiles);
+    if (edram_rows == 0) {
+      continue;
+    }
+    // Skip the rows that have never been written. For depth render targets,
+    // however, load the entire clamped height if anything was written - the
+    // depth and stencil planes must be copied as whole subresources, so the
+    // whole copy buffer region must contain meaningful data.
+    uint32_t written_rows =
+        GetEDRAMWrittenRows(edram_bases[i], edram_pitch_tiles, edram_rows);
+    if (written_rows == 0) {
+      continue;
+    }
+    if (render_target->key.is_depth) {
+      written_rows = edram_rows;
+    }
+
+    load_indices[load_count] = i;
+    load_rows[load_count] = written_rows;
+    load_copy_offsets[load_count] = copy_buffer_size;
+    copy_buffer_size +=
+        xe::align(render_target->copy_buffer_size,
+                  uint32_t(D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT));
+    ++load_count;
+  }
+  if (load_count == 0) {
+    return;
+  }
+
   // Allocate descriptors for the buffers.
   D3D12_CPU_DESCRIPTOR_HANDLE descriptor_cpu_start;
   D3D12_GPU_DESCRIPTOR_HANDLE descriptor_gpu_start;
@@ -2868,11 +3036,6 @@ void RenderTargetCache::LoadRenderTargetsFromEDRAM(
   }
 
   // Get the buffer for copying.
-  uint32_t copy_buffer_size = 0;
-  for (uint32_t i = 0; i < render_target_count; ++i) {
-    copy_buffer_size =
-        std::max(copy_buffer_size, render_targets[i]->copy_buffer_size);
-  }
   D3D12_RESOURCE_STATES copy_buffer_state =
       D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
   ID3D12Resource* copy_buffer = command_processor_->RequestScratchGPUBuffer(
@@ -2883,8 +3046,8 @@ void RenderTargetCache::LoadRenderTargetsFromEDRAM(
 
   // Transition the render targets to copy destinations and the EDRAM buffer to
   // a SRV.
-  for (uint32_t i = 0; i < render_target_count; ++i) {
-    RenderTarget* render_target = render_targets[i];
+  for (uint32_t i = 0; i < load_count; ++i) {
+    RenderTarget* render_target = render_targets[load_indices[i]];
     command_processor_->PushTransitionBarrier(render_target->resource,
                                               render_target->state,
                                               D3D12_RESOURCE_STATE_COPY_DEST);
@@ -2902,48 +3065,30 @@ void RenderTargetCache::LoadRenderTargetsFromEDRAM(
       copy_buffer, copy_buffer_size);
   command_list->D3DSetComputeRootDescriptorTable(1, descriptor_gpu_start);
 
-  // Load each render target.
-  for (uint32_t i = 0; i < render_target_count; ++i) {
-    if (edram_bases[i] >= 2048) {
-      // Something is wrong with the load.
-      continue;
-    }
-    const RenderTarget* render_target = render_targets[i];
-
-    // Get the number of EDRAM tiles per row.
+  // Load all the render targets to the copy buffer in one pass.
+  command_processor_->SubmitBarriers();
+  for (uint32_t i = 0; i < load_count; ++i) {
+    const RenderTarget* render_target = render_targets[load_indices[i]];
+    uint32_t edram_base = edram_bases[load_indices[i]];
+    uint32_t copy_offset = load_copy_offsets[i];
     uint32_t edram_pitch_tiles = render_target->key.width_ss_div_80;
     if (!render_target->key.is_depth &&
         IsColorFormat64bpp(
             ColorRenderTargetFormat(render_target->key.format))) {
       edram_pitch_tiles *= 2;
     }
-    // Clamp the height if somehow requested a render target that is too large.
-    uint32_t edram_rows =
-        std::min(render_target->key.height_ss_div_16,
-                 (2048u - edram_bases[i]) / edram_pitch_tiles);
-    if (edram_rows == 0) {
-      continue;
-    }
-
-    // Transition the copy buffer back to UAV if it's not the first load.
-    command_processor_->PushTransitionBarrier(
-        copy_buffer, copy_buffer_state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-    copy_buffer_state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-
-    // Load the data.
-    command_processor_->SubmitBarriers();
     EDRAMLoadStoreRootConstants root_constants;
     // TODO(Triang3l): log2(sample count, resolution scale).
     root_constants.base_samples_2x_depth_pitch =
-        edram_bases[i] | (edram_pitch_tiles << 16);
+        edram_base | (edram_pitch_tiles << 16);
     root_constants.rt_color_depth_offset =
-        uint32_t(render_target->footprints[0].Offset);
+        uint32_t(render_target->footprints[0].Offset) + copy_offset;
     root_constants.rt_color_depth_pitch =
         render_target->footprints[0].Footprint.RowPitch;
     if (render_target->key.is_depth) {
       root_constants.base_samples_2x_depth_pitch |= 1 << 15;
       root_constants.rt_stencil_offset =
-          uint32_t(render_target->footprints[1].Offset);
+          uint32_t(render_target->footprints[1].Offset) + copy_offset;
       root_constants.rt_stencil_pitch =
           render_target->footprints[1].Footprint.RowPitch;
     }
@@ -2953,29 +3098,52 @@ void RenderTargetCache::LoadRenderTargetsFromEDRAM(
                                                render_target->key.format);
     command_processor_->SetComputePipeline(edram_load_pipelines_[size_t(mode)]);
     // 1 group per 80x16 samples.
-    command_list->D3DDispatch(render_target->key.width_ss_div_80, edram_rows,
+    command_list->D3DDispatch(render_target->key.width_ss_div_80, load_rows[i],
                               1);
+  }
 
-    // Commit the UAV write and transition the copy buffer to copy source now.
-    command_processor_->PushUAVBarrier(copy_buffer);
-    command_processor_->PushTransitionBarrier(copy_buffer, copy_buffer_state,
-                                              D3D12_RESOURCE_STATE_COPY_SOURCE);
-    copy_buffer_state = D3D12_RESOURCE_STATE_COPY_SOURCE;
+  // Commit the UAV writes and transition the copy buffer to copy source.
+  command_processor_->PushUAVBarrier(copy_buffer);
+  command_processor_->PushTransitionBarrier(copy_buffer, copy_buffer_state,
+                                            D3D12_RESOURCE_STATE_COPY_SOURCE);
+  copy_buffer_state = D3D12_RESOURCE_STATE_COPY_SOURCE;
+  command_processor_->SubmitBarriers();
 
-    // Copy to the render target planes.
-    command_processor_->SubmitBarriers();
+  // Copy to the render target planes.
+  for (uint32_t i = 0; i < load_count; ++i) {
+    const RenderTarget* render_target = render_targets[load_indices[i]];
+    uint32_t copy_offset = load_copy_offsets[i];
     D3D12_TEXTURE_COPY_LOCATION location_source, location_dest;
     location_source.pResource = copy_buffer;
     location_source.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
     location_source.PlacedFootprint = render_target->footprints[0];
+    location_source.PlacedFootprint.Offset += copy_offset;
     location_dest.pResource = render_target->resource;
     location_dest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
     location_dest.SubresourceIndex = 0;
-    command_list->CopyTexture(location_dest, location_source);
     if (render_target->key.is_depth) {
+      // Partial box copies of depth-stencil planes aren't allowed in Direct3D
+      // 12, copy the whole subresources.
+      command_list->CopyTexture(location_dest, location_source);
       location_source.PlacedFootprint = render_target->footprints[1];
+      location_source.PlacedFootprint.Offset += copy_offset;
       location_dest.SubresourceIndex = 1;
       command_list->CopyTexture(location_dest, location_source);
+    } else {
+      // Only the rows that were actually loaded contain meaningful data in the
+      // copy buffer - leave the rest of the texture as is, the guest has never
+      // written anything to the corresponding part of EDRAM.
+      D3D12_BOX source_box;
+      source_box.left = 0;
+      source_box.top = 0;
+      source_box.front = 0;
+      source_box.right = location_source.PlacedFootprint.Footprint.Width;
+      source_box.bottom =
+          std::min(load_rows[i] << 4,
+                   location_source.PlacedFootprint.Footprint.Height);
+      source_box.back = 1;
+      command_list->CopyTextureRegion(location_dest, 0, 0, 0, location_source,
+                                      source_box);
     }
   }
 
@@ -282,6 +282,10 @@ class RenderTargetCache {
   // special.
   void FlushAndUnbindRenderTargets();
   void WriteEDRAMUint32UAVDescriptor(D3D12_CPU_DESCRIPTOR_HANDLE handle);
+  // May be called only between frames, when the GPU is idle, after the
+  // texture cache has switched. The EDRAM buffer contents are reinterpreted
+  // at the new scale - the next draws will overwrite them anyway.
+  void SetResolutionScale2X(bool enabled);
 
   // Totally necessary to rely on the base format - Too Human switches between
   // 2_10_10_10_FLOAT and 2_10_10_10_FLOAT_AS_16_16_16_16 every draw.
@@ -433,6 +437,16 @@ class RenderTargetCache {
   void TransitionEDRAMBuffer(D3D12_RESOURCE_STATES new_state);
   void CommitEDRAMBufferUAVWrites(bool force);
 
+  // Marks a contiguous range of EDRAM tiles as potentially containing data
+  // written by the GPU (via a render target store, a resolve clear or a
+  // snapshot restore).
+  void MarkEDRAMTilesWritten(uint32_t base, uint32_t tile_count);
+  // Returns the number of 16-sample rows, from the first one, of a region with
+  // the specified layout that contain tiles ever written, so loading can be
+  // clamped to the part of the render target that may hold meaningful data.
+  uint32_t GetEDRAMWrittenRows(uint32_t base, uint32_t pitch_tiles,
+                               uint32_t row_count) const;
+
   void WriteEDRAMRawSRVDescriptor(D3D12_CPU_DESCRIPTOR_HANDLE handle);
   void WriteEDRAMRawUAVDescriptor(D3D12_CPU_DESCRIPTOR_HANDLE handle);
 
@@ -483,7 +497,9 @@ class RenderTargetCache {
   void StoreRenderTargetsToEDRAM();
 
   // Must be in a frame to call. Loads the render targets from the EDRAM buffer,
-  // filling all the rows the render target can hold.
+  // filling the rows of each render target up to the last EDRAM tile that has
+  // ever been written (the contents of never-written tiles are undefined to the
+  // guest, so they don't need to be loaded).
   void LoadRenderTargetsFromEDRAM(uint32_t render_target_count,
                                   RenderTarget* const* render_targets,
                                   const uint32_t* edram_bases);
@@ -517,8 +533,10 @@ class RenderTargetCache {
   TraceWriter* trace_writer_;
 
   // Whether 1 guest pixel is rendered as 2x2 host pixels (currently only
-  // supported with ROV).
+  // supported with ROV). Switchable at runtime while the following is fixed
+  // at initialization and sizes the EDRAM buffer for the largest scale.
   bool resolution_scale_2x_ = false;
+  bool resolution_scale_2x_supported_ = false;
 
   // The EDRAM buffer allowing color and depth data to be reinterpreted.
   ID3D12Resource* edram_buffer_ = nullptr;
@@ -526,6 +544,10 @@ class RenderTargetCache {
   // Whether there have been any outstanding UAV writes and a UAV barrier is
   // needed before accessing the EDRAM buffer in an unordered way again.
   bool edram_buffer_modified_ = false;
+  // Bit vector of the EDRAM tiles that have ever been written by the GPU, for
+  // skipping the loading of rows the guest has never submitted anything to -
+  // their contents are undefined to it anyway.
+  uint64_t edram_tiles_written_[2048 / 64] = {};
 
   // Non-shader-visible descriptor heap containing pre-created SRV and UAV
   // descriptors of the EDRAM buffer, for faster binding (via copying rather
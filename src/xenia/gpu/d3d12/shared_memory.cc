@@ -28,6 +28,30 @@ DEFINE_bool(d3d12_tiled_shared_memory, true,
             "created - but allows graphics debuggers that don't support tiled "
             "resources to work.",
             "D3D12");
+DEFINE_bool(
+    d3d12_upload_copy_queue, true,
+    "Upload guest memory modified by the CPU to the shared memory buffer on "
+    "the dedicated copy queue instead of the graphics queue, so uploads run "
+    "on the DMA engine rather than stealing graphics queue time. Ranges also "
+    "written by the GPU within the same submission still go through the "
+    "graphics queue for ordering.",
+    "D3D12");
+DEFINE_int32(
+    d3d12_shared_memory_invalidate_kb, 256,
+    "Initial maximum size of the range invalidated in the GPU copy of the "
+    "memory when the CPU writes to it, in kilobytes (rounded to whole 64-page "
+    "blocks, at least one block). Adjusted at runtime per 4 MB region based "
+    "on the observed fault rate, between one block and "
+    "--d3d12_shared_memory_invalidate_max_kb. Reuploading a bigger range is "
+    "much cheaper than servicing thousands of separate access violations when "
+    "titles stream data, but invalidates more data that may still be valid.",
+    "D3D12");
+DEFINE_int32(
+    d3d12_shared_memory_invalidate_max_kb, 2048,
+    "Upper bound of the per-region CPU write invalidation size when a region "
+    "is promoted to coarser invalidation due to a high fault rate, in "
+    "kilobytes.",
+    "D3D12");
 
 namespace xe {
 namespace gpu {
@@ -41,6 +65,15 @@ constexpr uint32_t SharedMemory::kWatchBucketSizeLog2;
 constexpr uint32_t SharedMemory::kWatchBucketCount;
 constexpr uint32_t SharedMemory::kWatchRangePoolSize;
 constexpr uint32_t SharedMemory::kWatchNodePoolSize;
+constexpr uint32_t SharedMemory::kInvalidateRegionSizeLog2;
+constexpr uint32_t SharedMemory::kInvalidateRegionCount;
+constexpr uint32_t SharedMemory::kInvalidateRegionPromoteFaults;
+constexpr uint32_t SharedMemory::kInvalidateRegionDemoteFaults;
+
+namespace {
+StatCounter count_watch_faults("gpu/shared_memory/watch_faults");
+MemoryCounter shared_memory_heaps("gpu/d3d12/shared_memory");
+}  // namespace
 
 SharedMemory::SharedMemory(D3D12CommandProcessor* command_processor,
                            Memory* memory, TraceWriter* trace_writer)
@@ -54,6 +87,24 @@ SharedMemory::SharedMemory(D3D12CommandProcessor* command_processor,
 
   // Two interleaved bit arrays.
   valid_and_gpu_written_pages_.resize(page_bitmap_length << 1);
+
+  // All regions start at the configured invalidation width and adapt from
+  // there as faults are observed.
+  invalidate_base_blocks_ = std::max(
+      uint32_t(std::max(cvars::d3d12_shared_memory_invalidate_kb, 0)) >>
+          (page_size_log2_ + 6 - 10),
+      uint32_t(1));
+  invalidate_max_blocks_ = std::max(
+      uint32_t(std::max(cvars::d3d12_shared_memory_invalidate_max_kb, 0)) >>
+          (page_size_log2_ + 6 - 10),
+      invalidate_base_blocks_);
+  std::fill(region_invalidate_blocks_,
+            region_invalidate_blocks_ + kInvalidateRegionCount,
+            invalidate_base_blocks_);
+  std::memset(region_frame_write_callbacks_, 0,
+              sizeof(region_frame_write_callbacks_));
+  std::memset(region_frame_watches_fired_, 0,
+              sizeof(region_frame_watches_fired_));
 }
 
 SharedMemory::~SharedMemory() { Shutdown(); }
@@ -128,8 +179,39 @@ bool SharedMemory::Initialize() {
   std::memset(valid_and_gpu_written_pages_.data(), 0,
               valid_and_gpu_written_pages_.size() * sizeof(uint64_t));
 
-  upload_buffer_pool_ =
-      std::make_unique<ui::d3d12::UploadBufferPool>(device, 4 * 1024 * 1024);
+  // Create the copy queue upload objects. Failure is not fatal - uploads
+  // fall back to the graphics queue.
+  if (cvars::d3d12_upload_copy_queue &&
+      provider->GetCopyQueue() != nullptr) {
+    ID3D12CommandAllocator* copy_command_allocator;
+    if (SUCCEEDED(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_COPY,
+            IID_PPV_ARGS(&copy_command_allocator)))) {
+      if (SUCCEEDED(device->CreateCommandList(
+              0, D3D12_COMMAND_LIST_TYPE_COPY, copy_command_allocator,
+              nullptr, IID_PPV_ARGS(&copy_command_list_)))) {
+        // Command lists are created open.
+        copy_command_list_->Close();
+        copy_command_allocators_.push_back({copy_command_allocator, 0});
+        if (FAILED(device->CreateFence(0, D3D12_FENCE_FLAG_NONE,
+                                       IID_PPV_ARGS(&copy_sync_fence_))) ||
+            FAILED(device->CreateFence(0, D3D12_FENCE_FLAG_NONE,
+                                       IID_PPV_ARGS(&copy_fence_)))) {
+          XELOGE("Shared memory: Failed to create the copy queue fences");
+          ui::d3d12::util::ReleaseAndNull(copy_sync_fence_);
+          ui::d3d12::util::ReleaseAndNull(copy_fence_);
+          ui::d3d12::util::ReleaseAndNull(copy_command_list_);
+          copy_command_allocator->Release();
+          copy_command_allocators_.clear();
+        }
+      } else {
+        XELOGE("Shared memory: Failed to create the copy command list");
+        copy_command_allocator->Release();
+      }
+    } else {
+      XELOGE("Shared memory: Failed to create a copy command allocator");
+    }
+  }
 
   physical_write_watch_handle_ =
       memory_->RegisterPhysicalWriteWatch(MemoryWriteCallbackThunk, this);
@@ -149,7 +231,20 @@ void SharedMemory::Shutdown() {
     physical_write_watch_handle_ = nullptr;
   }
 
-  upload_buffer_pool_.reset();
+  // The command processor awaits submission completion before shutting down,
+  // and the last submission's graphics work waited for the copy queue, so
+  // the copy objects are idle here.
+  if (copy_command_list_open_) {
+    copy_command_list_->Close();
+    copy_command_list_open_ = false;
+  }
+  ui::d3d12::util::ReleaseAndNull(copy_fence_);
+  ui::d3d12::util::ReleaseAndNull(copy_sync_fence_);
+  ui::d3d12::util::ReleaseAndNull(copy_command_list_);
+  for (auto& copy_command_allocator : copy_command_allocators_) {
+    copy_command_allocator.command_allocator->Release();
+  }
+  copy_command_allocators_.clear();
 
   ui::d3d12::util::ReleaseAndNull(buffer_descriptor_heap_);
 
@@ -158,6 +253,9 @@ void SharedMemory::Shutdown() {
 
   if (AreTiledResourcesUsed()) {
     for (uint32_t i = 0; i < xe::countof(heaps_); ++i) {
+      if (heaps_[i] != nullptr) {
+        shared_memory_heaps.Remove(kHeapSize);
+      }
       ui::d3d12::util::ReleaseAndNull(heaps_[i]);
     }
     heap_count_ = 0;
@@ -166,7 +264,132 @@ void SharedMemory::Shutdown() {
 }
 
 void SharedMemory::BeginSubmission() {
-  upload_buffer_pool_->Reclaim(command_processor_->GetCompletedSubmission());
+  gpu_written_submission_ranges_.clear();
+}
+
+bool SharedMemory::AreCopyQueueUploadsUsed() const {
+  return copy_fence_ != nullptr;
+}
+
+bool SharedMemory::IsRangeGPUWrittenInSubmission(uint32_t page_first,
+                                                 uint32_t page_count) const {
+  uint32_t page_last = page_first + page_count - 1;
+  for (const auto& range : gpu_written_submission_ranges_) {
+    if (page_first <= range.first + range.second - 1 &&
+        page_last >= range.first) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SharedMemory::EnsureCopyCommandListOpen() {
+  if (copy_command_list_open_) {
+    return true;
+  }
+  uint64_t completed_submission = command_processor_->GetCompletedSubmission();
+  size_t allocator_index = SIZE_MAX;
+  for (size_t i = 0; i < copy_command_allocators_.size(); ++i) {
+    if (copy_command_allocators_[i].last_usage_submission <=
+        completed_submission) {
+      allocator_index = i;
+      break;
+    }
+  }
+  if (allocator_index == SIZE_MAX) {
+    // All allocators still in flight - create another one.
+    auto device = command_processor_->GetD3D12Context()
+                      ->GetD3D12Provider()
+                      ->GetDevice();
+    ID3D12CommandAllocator* command_allocator;
+    if (FAILED(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_COPY,
+            IID_PPV_ARGS(&command_allocator)))) {
+      XELOGE("Shared memory: Failed to create a copy command allocator");
+      return false;
+    }
+    allocator_index = copy_command_allocators_.size();
+    copy_command_allocators_.push_back({command_allocator, 0});
+  } else {
+    copy_command_allocators_[allocator_index].command_allocator->Reset();
+  }
+  if (FAILED(copy_command_list_->Reset(
+          copy_command_allocators_[allocator_index].command_allocator,
+          nullptr))) {
+    XELOGE("Shared memory: Failed to reset the copy command list");
+    return false;
+  }
+  copy_command_allocator_current_ = allocator_index;
+  copy_command_list_open_ = true;
+  copy_command_list_used_ = false;
+  return true;
+}
+
+void SharedMemory::SubmitUploads() {
+  if (!copy_command_list_open_) {
+    return;
+  }
+  copy_command_list_->Close();
+  copy_command_list_open_ = false;
+  if (!copy_command_list_used_) {
+    return;
+  }
+  copy_command_allocators_[copy_command_allocator_current_]
+      .last_usage_submission = command_processor_->GetCurrentSubmission();
+  auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
+  auto direct_queue = provider->GetDirectQueue();
+  auto copy_queue = provider->GetCopyQueue();
+  // Order the uploads after everything previously enqueued on the direct
+  // queue - the previous submissions reading the buffer as well as the tile
+  // mapping updates for newly resident heaps.
+  direct_queue->Signal(copy_sync_fence_, ++copy_sync_fence_value_);
+  copy_queue->Wait(copy_sync_fence_, copy_sync_fence_value_);
+  ID3D12CommandList* execute_command_lists[] = {copy_command_list_};
+  copy_queue->ExecuteCommandLists(1, execute_command_lists);
+  copy_queue->Signal(copy_fence_, ++copy_fence_value_);
+  // The submission being executed next on the direct queue consumes the
+  // uploaded data.
+  direct_queue->Wait(copy_fence_, copy_fence_value_);
+}
+
+void SharedMemory::BeginFrame() {
+  auto global_lock = global_critical_region_.Acquire();
+  COUNT_profile_set("gpu/shared_memory/frame_cpu_write_callbacks",
+                    frame_write_callback_count_);
+  COUNT_profile_set("gpu/shared_memory/frame_cpu_invalidated_kb",
+                    frame_invalidated_page_count_ << page_size_log2_ >> 10);
+  COUNT_profile_set("gpu/shared_memory/frame_watches_fired",
+                    frame_watches_fired_count_);
+  frame_write_callback_count_ = 0;
+  frame_invalidated_page_count_ = 0;
+  frame_watches_fired_count_ = 0;
+
+  // Retune the invalidation width of each region using the statistics of the
+  // frame that just ended.
+  uint32_t coarse_region_count = 0;
+  for (uint32_t i = 0; i < kInvalidateRegionCount; ++i) {
+    uint32_t faults = region_frame_write_callbacks_[i];
+    uint32_t watches_fired = region_frame_watches_fired_[i];
+    uint32_t blocks = region_invalidate_blocks_[i];
+    if (faults >= kInvalidateRegionPromoteFaults && watches_fired <= faults) {
+      // Heavy faulting with little watched data being hit - streaming-like
+      // churn, widen the invalidation to collapse the faults.
+      blocks = std::min(blocks << 1, invalidate_max_blocks_);
+    } else if (faults < kInvalidateRegionDemoteFaults ||
+               watches_fired > faults) {
+      // Either the churn has passed, or wide invalidation keeps knocking out
+      // ranges the GPU is actively using - narrow back down.
+      blocks = std::max(blocks >> 1, uint32_t(1));
+    }
+    region_invalidate_blocks_[i] = blocks;
+    if (blocks > invalidate_base_blocks_) {
+      ++coarse_region_count;
+    }
+    region_frame_write_callbacks_[i] = 0;
+    region_frame_watches_fired_[i] = 0;
+  }
+  COUNT_profile_set("gpu/shared_memory/coarse_invalidate_regions",
+                    coarse_region_count);
 }
 
 SharedMemory::GlobalWatchHandle SharedMemory::RegisterGlobalWatch(
@@ -304,6 +527,7 @@ bool SharedMemory::MakeTilesResident(uint32_t start, uint32_t length) {
       return false;
     }
     ++heap_count_;
+    shared_memory_heaps.Add(kHeapSize);
     COUNT_profile_set("gpu/shared_memory/used_mb",
                       heap_count_ << kHeapSizeLog2 >> 20);
     D3D12_TILED_RESOURCE_COORDINATE region_start_coordinates;
@@ -356,20 +580,35 @@ bool SharedMemory::RequestRange(uint32_t start, uint32_t length) {
   if (upload_ranges_.size() == 0) {
     return true;
   }
-  TransitionBuffer(D3D12_RESOURCE_STATE_COPY_DEST);
-  command_processor_->SubmitBarriers();
+  bool copy_queue_available = AreCopyQueueUploadsUsed();
+  bool graphics_transition_done = false;
   for (auto upload_range : upload_ranges_) {
     uint32_t upload_range_start = upload_range.first;
     uint32_t upload_range_length = upload_range.second;
+    // Ranges the GPU wrote during this submission must be copied inline on
+    // the graphics queue, after the write - the copy queue runs before all
+    // of the submission's graphics work.
+    bool use_copy_queue =
+        copy_queue_available &&
+        !IsRangeGPUWrittenInSubmission(upload_range_start,
+                                       upload_range_length) &&
+        EnsureCopyCommandListOpen();
+    if (!use_copy_queue && !graphics_transition_done) {
+      TransitionBuffer(D3D12_RESOURCE_STATE_COPY_DEST);
+      command_processor_->SubmitBarriers();
+      graphics_transition_done = true;
+    }
     trace_writer_->WriteMemoryRead(upload_range_start << page_size_log2_,
                                    upload_range_length << page_size_log2_);
     while (upload_range_length != 0) {
       ID3D12Resource* upload_buffer;
       uint32_t upload_buffer_offset, upload_buffer_size;
-      uint8_t* upload_buffer_mapping = upload_buffer_pool_->RequestPartial(
-          command_processor_->GetCurrentSubmission(),
-          upload_range_length << page_size_log2_, &upload_buffer,
-          &upload_buffer_offset, &upload_buffer_size, nullptr);
+      uint8_t* upload_buffer_mapping =
+          command_processor_->GetStagingMemoryManager()->RequestPartial(
+              command_processor_->GetCurrentFrame(),
+              upload_range_length << page_size_log2_, 1 << page_size_log2_,
+              &upload_buffer, &upload_buffer_offset, &upload_buffer_size,
+              nullptr);
       if (upload_buffer_mapping == nullptr) {
         XELOGE("Shared memory: Failed to get an upload buffer");
         return false;
@@ -380,9 +619,19 @@ bool SharedMemory::RequestRange(uint32_t start, uint32_t length) {
           upload_buffer_mapping,
           memory_->TranslatePhysical(upload_range_start << page_size_log2_),
           upload_buffer_size);
-      command_list->D3DCopyBufferRegion(
-          buffer_, upload_range_start << page_size_log2_, upload_buffer,
-          upload_buffer_offset, upload_buffer_size);
+      if (use_copy_queue) {
+        // The buffer decays to the common state after every direct queue
+        // submission and is promoted to the copy destination state on the
+        // copy queue, so no explicit transition is needed here.
+        copy_command_list_->CopyBufferRegion(
+            buffer_, upload_range_start << page_size_log2_, upload_buffer,
+            upload_buffer_offset, upload_buffer_size);
+        copy_command_list_used_ = true;
+      } else {
+        command_list->D3DCopyBufferRegion(
+            buffer_, upload_range_start << page_size_log2_, upload_buffer,
+            upload_buffer_offset, upload_buffer_size);
+      }
       upload_range_start += upload_buffer_pages;
       upload_range_length -= upload_buffer_pages;
     }
@@ -419,6 +668,14 @@ void SharedMemory::FireWatches(uint32_t page_first, uint32_t page_last,
         range->callback(range->callback_context, range->callback_data,
                         range->callback_argument, invalidated_by_gpu);
         UnlinkWatchRange(range);
+        ++frame_watches_fired_count_;
+        if (!invalidated_by_gpu) {
+          // A CPU-invalidated watch means data the GPU was using was thrown
+          // away - the cost signal for the invalidation width tuning.
+          ++region_frame_watches_fired_[page_first >>
+                                        (kInvalidateRegionSizeLog2 -
+                                         page_size_log2_)];
+        }
       }
     }
   }
@@ -440,6 +697,38 @@ void SharedMemory::RangeWrittenByGPU(uint32_t start, uint32_t length) {
   // Mark the range as valid (so pages are not reuploaded until modified by the
   // CPU) and watch it so the CPU can reuse it and this will be caught.
   MakeRangeValid(page_first, page_last - page_first + 1, true);
+
+  // If the CPU overwrites these pages before the end of the submission, the
+  // reupload must stay on the graphics queue to happen after this GPU write.
+  gpu_written_submission_ranges_.push_back(
+      std::make_pair(page_first, page_last - page_first + 1));
+}
+
+bool SharedMemory::IsRangeWrittenByGPU(uint32_t start, uint32_t length) {
+  if (length == 0 || start >= kBufferSize) {
+    return false;
+  }
+  length = std::min(length, kBufferSize - start);
+  uint32_t page_first = start >> page_size_log2_;
+  uint32_t page_last = (start + length - 1) >> page_size_log2_;
+  uint32_t block_first = page_first >> 6;
+  uint32_t block_last = page_last >> 6;
+
+  auto global_lock = global_critical_region_.Acquire();
+
+  for (uint32_t i = block_first; i <= block_last; ++i) {
+    uint64_t block_gpu_written = valid_and_gpu_written_pages_[(i << 1) + 1];
+    if (i == block_first) {
+      block_gpu_written &= ~((1ull << (page_first & 63)) - 1);
+    }
+    if (i == block_last && (page_last & 63) != 63) {
+      block_gpu_written &= (1ull << ((page_last & 63) + 1)) - 1;
+    }
+    if (block_gpu_written != 0) {
+      return true;
+    }
+  }
+  return false;
 }
 
 bool SharedMemory::AreTiledResourcesUsed() const {
@@ -578,11 +867,14 @@ std::pair<uint32_t, uint32_t> SharedMemory::MemoryWriteCallbackThunk(
 
 std::pair<uint32_t, uint32_t> SharedMemory::MemoryWriteCallback(
     uint32_t physical_address_start, uint32_t length, bool exact_range) {
+  count_watch_faults.Increment();
   uint32_t page_first = physical_address_start >> page_size_log2_;
   uint32_t page_last = (physical_address_start + length - 1) >> page_size_log2_;
   assert_true(page_first < page_count_ && page_last < page_count_);
   uint32_t block_first = page_first >> 6;
   uint32_t block_last = page_last >> 6;
+  uint32_t fault_region =
+      page_first >> (kInvalidateRegionSizeLog2 - page_size_log2_);
 
   auto global_lock = global_critical_region_.Acquire();
 
@@ -608,8 +900,38 @@ std::pair<uint32_t, uint32_t> SharedMemory::MemoryWriteCallback(
       page_last = (page_last & ~uint32_t(63)) +
                   (std::max(xe::tzcnt(gpu_written_end), uint8_t(1)) - 1);
     }
+
+    // Also widen in whole 64-page blocks containing no GPU-written pages, up
+    // to the faulting region's current invalidation width, on the sides where
+    // the range hasn't been clipped by GPU-written pages in its boundary
+    // blocks. Streaming titles write large buffers with many separate
+    // accesses, and coalescing those here collapses thousands of adjacent
+    // faults into a handful of callbacks. The width is retuned per region in
+    // BeginFrame from the fault rate observed in it.
+    uint32_t invalidate_blocks_max = region_invalidate_blocks_[fault_region];
+    uint32_t block_count = page_count_ >> 6;
+    if (page_first == (block_first << 6)) {
+      while (block_last - block_first + 1 < invalidate_blocks_max &&
+             block_first != 0 &&
+             !valid_and_gpu_written_pages_[((block_first - 1) << 1) + 1]) {
+        --block_first;
+      }
+      page_first = block_first << 6;
+    }
+    if (page_last == ((block_last << 6) | 63)) {
+      while (block_last - block_first + 1 < invalidate_blocks_max &&
+             block_last + 1 < block_count &&
+             !valid_and_gpu_written_pages_[((block_last + 1) << 1) + 1]) {
+        ++block_last;
+      }
+      page_last = (block_last << 6) | 63;
+    }
   }
 
+  ++frame_write_callback_count_;
+  frame_invalidated_page_count_ += page_last - page_first + 1;
+  ++region_frame_write_callbacks_[fault_region];
+
   for (uint32_t i = block_first; i <= block_last; ++i) {
     uint64_t invalidate_bits = UINT64_MAX;
     if (i == block_first) {
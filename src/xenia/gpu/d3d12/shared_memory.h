@@ -19,7 +19,6 @@
 #include "xenia/gpu/trace_writer.h"
 #include "xenia/memory.h"
 #include "xenia/ui/d3d12/d3d12_api.h"
-#include "xenia/ui/d3d12/pools.h"
 
 namespace xe {
 namespace gpu {
@@ -45,6 +44,13 @@ class SharedMemory {
   }
 
   void BeginSubmission();
+  // Publishes and resets the per-frame CPU write fault statistics.
+  void BeginFrame();
+  // Submits uploads recorded on the copy queue for the current submission,
+  // making the graphics queue wait for their completion. Must be called by
+  // the command processor right before executing the submission's command
+  // lists on the direct queue.
+  void SubmitUploads();
 
   typedef void (*GlobalWatchCallback)(void* context, uint32_t address_first,
                                       uint32_t address_last,
@@ -114,6 +120,11 @@ class SharedMemory {
   // protecting it.
   void RangeWrittenByGPU(uint32_t start, uint32_t length);
 
+  // Returns whether any page overlapping the range currently contains
+  // GPU-generated data (such as resolves). The CPU-side contents of such
+  // ranges are stale and don't identify what the GPU will actually read.
+  bool IsRangeWrittenByGPU(uint32_t start, uint32_t length);
+
   // Makes the buffer usable for vertices, indices and texture untiling.
   inline void UseForReading() {
     // Vertex fetch is also allowed in pixel shaders.
@@ -144,6 +155,17 @@ class SharedMemory {
   void MakeRangeValid(uint32_t valid_page_first, uint32_t valid_page_count,
                       bool written_by_gpu);
 
+  // Whether uploads may go to the copy queue at all.
+  bool AreCopyQueueUploadsUsed() const;
+  // Whether any page of the range was written by the GPU during the current
+  // submission - such ranges must be uploaded inline on the graphics queue
+  // since the copy queue runs before all of the submission's GPU work.
+  bool IsRangeGPUWrittenInSubmission(uint32_t page_first,
+                                     uint32_t page_count) const;
+  // Opens the copy command list if not open yet, picking (or creating) a
+  // command allocator not in flight anymore.
+  bool EnsureCopyCommandListOpen();
+
   D3D12CommandProcessor* command_processor_;
   Memory* memory_;
   TraceWriter* trace_writer_;
@@ -182,6 +204,32 @@ class SharedMemory {
   ID3D12DescriptorHeap* buffer_descriptor_heap_ = nullptr;
   D3D12_CPU_DESCRIPTOR_HANDLE buffer_descriptor_heap_start_;
 
+  // Copy queue upload machinery (--d3d12_upload_copy_queue). Uploads for a
+  // submission are recorded into copy_command_list_ as ranges are requested
+  // and executed on the copy queue right before the submission itself, with
+  // fences ordering them after the previous submission's graphics work (and
+  // tile mapping updates) and before the current one's.
+  struct CopyCommandAllocator {
+    ID3D12CommandAllocator* command_allocator;
+    uint64_t last_usage_submission;
+  };
+  std::vector<CopyCommandAllocator> copy_command_allocators_;
+  size_t copy_command_allocator_current_ = 0;
+  ID3D12GraphicsCommandList* copy_command_list_ = nullptr;
+  bool copy_command_list_open_ = false;
+  bool copy_command_list_used_ = false;
+  // Signaled on the direct queue before executing the copy command list so
+  // the copy queue starts after all previously enqueued graphics work.
+  ID3D12Fence* copy_sync_fence_ = nullptr;
+  uint64_t copy_sync_fence_value_ = 0;
+  // Signaled on the copy queue after the uploads, awaited on the direct
+  // queue before the submission consuming them.
+  ID3D12Fence* copy_fence_ = nullptr;
+  uint64_t copy_fence_value_ = 0;
+  // Page ranges written by the GPU during the current submission; accessed
+  // only on the command processor thread.
+  std::vector<std::pair<uint32_t, uint32_t>> gpu_written_submission_ranges_;
+
   // Handle of the physical memory write callback.
   void* physical_write_watch_handle_ = nullptr;
 
@@ -262,6 +310,37 @@ class SharedMemory {
   // Unlinks and frees the range and its nodes. Call this with the mutex locked.
   void UnlinkWatchRange(WatchRange* range);
 
+  // Per-frame statistics, collected between BeginFrame calls and published via
+  // the profiler, to see the CPU write fault rate and how much data it
+  // invalidates.
+  uint32_t frame_write_callback_count_ = 0;
+  uint32_t frame_invalidated_page_count_ = 0;
+  uint32_t frame_watches_fired_count_ = 0;
+
+  // Self-tuning invalidation granularity. The buffer is split into regions,
+  // and the maximum width of the range invalidated on a CPU write fault is
+  // tracked per region and adjusted between BeginFrame calls: regions with a
+  // high fault rate (streaming destinations) are promoted to coarser
+  // invalidation to collapse the faults, and regions where wide invalidation
+  // keeps knocking out watched ranges the GPU is still using are demoted back
+  // to finer invalidation. No single fixed width fits all titles - or even
+  // all regions within one title.
+  static constexpr uint32_t kInvalidateRegionSizeLog2 = 22;
+  static constexpr uint32_t kInvalidateRegionCount =
+      1 << (kBufferSizeLog2 - kInvalidateRegionSizeLog2);
+  // Write callback counts per frame that promote (double) or demote (halve)
+  // the region's invalidation width at the next BeginFrame.
+  static constexpr uint32_t kInvalidateRegionPromoteFaults = 64;
+  static constexpr uint32_t kInvalidateRegionDemoteFaults = 8;
+  // Current maximum invalidation width of each region, in 64-page blocks.
+  uint32_t region_invalidate_blocks_[kInvalidateRegionCount];
+  // Per-frame, per-region statistics driving the adjustment.
+  uint32_t region_frame_write_callbacks_[kInvalidateRegionCount];
+  uint32_t region_frame_watches_fired_[kInvalidateRegionCount];
+  // Bounds for region_invalidate_blocks_, from the invalidate size cvars.
+  uint32_t invalidate_base_blocks_;
+  uint32_t invalidate_max_blocks_;
+
   // ***************************************************************************
   // Things above should be protected by global_critical_region.
   // ***************************************************************************
@@ -273,7 +352,6 @@ class SharedMemory {
   std::vector<UploadRange> upload_ranges_;
   void GetRangesToUpload(uint32_t request_page_first,
                          uint32_t request_page_last);
-  std::unique_ptr<ui::d3d12::UploadBufferPool> upload_buffer_pool_ = nullptr;
 
   void TransitionBuffer(D3D12_RESOURCE_STATES new_state);
 
@@ -27,8 +27,9 @@
 #include "xenia/ui/d3d12/pools.h"
 
 DEFINE_int32(d3d12_resolution_scale, 1,
-             "Scale of rendering width and height (currently only 1 and 2 "
-             "are available).",
+             "Initial scale of rendering width and height (currently only 1 "
+             "and 2 are available) - can be toggled at runtime from the GPU "
+             "menu.",
              "D3D12");
 DEFINE_int32(d3d12_texture_cache_limit_soft, 384,
              "Maximum host texture memory usage (in megabytes) above which old "
@@ -46,6 +47,12 @@ DEFINE_int32(d3d12_texture_cache_limit_hard, 768,
              "textures will be destroyed as soon as possible. If using 2x "
              "resolution scale, 1.25x of this is used.",
              "D3D12");
+DEFINE_bool(d3d12_texture_dedup, true,
+            "Share the GPU storage of guest textures with identical content "
+            "at different addresses (texture atlases, double-buffered "
+            "streaming), identified by a hash of the guest data. Saves video "
+            "memory and conversion work in streaming-heavy titles.",
+            "D3D12");
 
 namespace xe {
 namespace gpu {
@@ -99,6 +106,10 @@ constexpr uint32_t TextureCache::kScaledResolveBufferSize;
 constexpr uint32_t TextureCache::kScaledResolveHeapSizeLog2;
 constexpr uint32_t TextureCache::kScaledResolveHeapSize;
 
+namespace {
+MemoryCounter texture_cache_memory("gpu/d3d12/texture_cache");
+}  // namespace
+
 // For formats with less than 4 components, assuming the last component is
 // replicated into the non-existent ones, similar to what is done for unused
 // components of operands in shaders.
@@ -903,10 +914,11 @@ const TextureCache::ResolveTileModeInfo
 };
 
 TextureCache::TextureCache(D3D12CommandProcessor* command_processor,
-                           RegisterFile* register_file,
+                           RegisterFile* register_file, Memory* memory,
                            SharedMemory* shared_memory)
     : command_processor_(command_processor),
       register_file_(register_file),
+      memory_(memory),
       shared_memory_(shared_memory) {}
 
 TextureCache::~TextureCache() { Shutdown(); }
@@ -915,11 +927,13 @@ bool TextureCache::Initialize() {
   auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
   auto device = provider->GetDevice();
 
-  // Try to create the tiled buffer 2x resolution scaling.
+  // Try to create the tiled buffer for 2x resolution scaling. Created
+  // whenever the hardware supports it, not only when the scale is requested
+  // at launch - it only reserves address space until resolves actually
+  // happen, and having it allows switching the scale at runtime.
   // Not currently supported with the RTV/DSV output path for various reasons.
   // As of November 27th, 2018, PIX doesn't support tiled buffers.
-  if (cvars::d3d12_resolution_scale >= 2 &&
-      command_processor_->IsROVUsedForEDRAM() &&
+  if (command_processor_->IsROVUsedForEDRAM() &&
       provider->GetTiledResourcesTier() >= 1 &&
       provider->GetGraphicsAnalysis() == nullptr &&
       provider->GetVirtualAddressBitsPerResource() >=
@@ -945,6 +959,8 @@ bool TextureCache::Initialize() {
   }
   std::memset(scaled_resolve_heaps_, 0, sizeof(scaled_resolve_heaps_));
   scaled_resolve_heap_count_ = 0;
+  resolution_scale_2x_enabled_ =
+      scaled_resolve_buffer_ != nullptr && cvars::d3d12_resolution_scale >= 2;
 
   // Create the loading root signature.
   D3D12_ROOT_PARAMETER root_parameters[2];
@@ -1007,7 +1023,7 @@ bool TextureCache::Initialize() {
       Shutdown();
       return false;
     }
-    if (IsResolutionScale2X() && mode_info.shader_2x != nullptr) {
+    if (IsResolutionScale2XSupported() && mode_info.shader_2x != nullptr) {
       load_pipelines_2x_[i] = ui::d3d12::util::CreateComputePipeline(
           device, mode_info.shader_2x, mode_info.shader_2x_size,
           load_root_signature_);
@@ -1088,7 +1104,7 @@ bool TextureCache::Initialize() {
       provider->OffsetViewDescriptor(null_srv_descriptor_heap_start_,
                                      uint32_t(NullSRVDescriptorIndex::kCube)));
 
-  if (IsResolutionScale2X()) {
+  if (IsResolutionScale2XSupported()) {
     scaled_resolve_global_watch_handle_ = shared_memory_->RegisterGlobalWatch(
         ScaledResolveGlobalWatchCallbackThunk, this);
   }
@@ -1136,11 +1152,15 @@ void TextureCache::ClearCache() {
   for (auto texture_pair : textures_) {
     Texture* texture = texture_pair.second;
     shared_memory_->UnwatchMemoryRange(texture->base_watch_handle);
-    shared_memory_->UnwatchMemoryRange(texture->mip_watch_handle);
-    texture->resource->Release();
+    for (uint32_t i = 0; i < xe::countof(texture->mip_watch_handles); ++i) {
+      shared_memory_->UnwatchMemoryRange(texture->mip_watch_handles[i]);
+    }
+    ReleaseTextureStorage(texture->storage, false);
     delete texture;
   }
   textures_.clear();
+  assert_true(texture_storages_by_hash_.empty());
+  texture_storages_by_hash_.clear();
   COUNT_profile_set("gpu/texture_cache/textures", 0);
   textures_total_size_ = 0;
   COUNT_profile_set("gpu/texture_cache/total_size_mb", 0);
@@ -1152,12 +1172,32 @@ void TextureCache::ClearCache() {
     page.heap->Release();
   }
   srv_descriptor_cache_.clear();
+
+  // Clear sampler descriptor cache.
+  sampler_descriptor_cache_map_.clear();
+  for (auto& page : sampler_descriptor_cache_) {
+    page.heap->Release();
+  }
+  sampler_descriptor_cache_.clear();
 }
 
 void TextureCache::TextureFetchConstantWritten(uint32_t index) {
   texture_keys_in_sync_ &= ~(1u << index);
 }
 
+void TextureCache::SetResolutionScale2X(bool enabled) {
+  enabled = enabled && scaled_resolve_buffer_ != nullptr;
+  if (resolution_scale_2x_enabled_ == enabled) {
+    return;
+  }
+  resolution_scale_2x_enabled_ = enabled;
+  // Texture keys carry the scaled_resolve bit, so textures of the previously
+  // active scale remain cached and become reachable again on the next switch.
+  // Bindings refer to textures of the old scale though - make sure the next
+  // frame rebuilds them from the fetch constants.
+  ClearBindings();
+}
+
 void TextureCache::BeginFrame() {
   // In case there was a failure creating something in the previous frame, make
   // sure bindings are reset so a new attempt will surely be made if the texture
@@ -1187,13 +1227,15 @@ void TextureCache::BeginFrame() {
       break;
     }
     Texture* texture = texture_used_first_;
-    if (texture->last_usage_frame > completed_frame) {
-      break;
-    }
-    if (!limit_hard_exceeded &&
-        (texture->last_usage_time + limit_soft_lifetime) >
-            texture_current_usage_time_) {
-      break;
+    bool in_flight = texture->last_usage_frame > completed_frame;
+    if (!limit_hard_exceeded) {
+      // Under the soft limit, only destroy textures the GPU is done with and
+      // that haven't been demanded for a while.
+      if (in_flight ||
+          (texture->last_usage_time + limit_soft_lifetime) >
+              texture_current_usage_time_) {
+        break;
+      }
     }
     destroyed_any = true;
     // Remove the texture from the map.
@@ -1211,22 +1253,30 @@ void TextureCache::BeginFrame() {
     } else {
       texture_used_last_ = nullptr;
     }
-    // Exclude the texture from the memory usage counter.
-    textures_total_size_ -= texture->resource_size;
     // Destroy the texture.
     if (texture->cached_srv_descriptor_swizzle !=
         Texture::kCachedSRVDescriptorSwizzleMissing) {
       srv_descriptor_cache_free_.push_back(texture->cached_srv_descriptor);
     }
     shared_memory_->UnwatchMemoryRange(texture->base_watch_handle);
-    shared_memory_->UnwatchMemoryRange(texture->mip_watch_handle);
-    texture->resource->Release();
+    for (uint32_t i = 0; i < xe::countof(texture->mip_watch_handles); ++i) {
+      shared_memory_->UnwatchMemoryRange(texture->mip_watch_handles[i]);
+    }
+    // Excludes the storage from the memory usage counter when the last
+    // reference is dropped. If in flight, still potentially referenced by
+    // queued submissions - the resource is released exactly when the frame
+    // fence passes its last usage instead of waiting for it here. Bindings
+    // were dropped in ClearBindings above.
+    ReleaseTextureStorage(texture->storage, in_flight);
     delete texture;
+    ++texture_evictions_;
   }
   if (destroyed_any) {
     COUNT_profile_set("gpu/texture_cache/textures", textures_.size());
     COUNT_profile_set("gpu/texture_cache/total_size_mb",
                       uint32_t(textures_total_size_ >> 20));
+    COUNT_profile_set("gpu/texture_cache/evictions",
+                      uint32_t(texture_evictions_));
   }
 }
 
@@ -1355,16 +1405,17 @@ void TextureCache::RequestTextures(uint32_t used_vertex_texture_mask,
     if (binding.texture != nullptr) {
       // Will be referenced by the command list, so mark as used.
       MarkTextureUsed(binding.texture);
-      command_processor_->PushTransitionBarrier(binding.texture->resource,
-                                                binding.texture->state, state);
-      binding.texture->state = state;
+      command_processor_->PushTransitionBarrier(
+          binding.texture->storage->resource, binding.texture->storage->state,
+          state);
+      binding.texture->storage->state = state;
     }
     if (binding.texture_signed != nullptr) {
       MarkTextureUsed(binding.texture_signed);
       command_processor_->PushTransitionBarrier(
-          binding.texture_signed->resource, binding.texture_signed->state,
-          state);
-      binding.texture_signed->state = state;
+          binding.texture_signed->storage->resource,
+          binding.texture_signed->storage->state, state);
+      binding.texture_signed->storage->state = state;
     }
   }
 }
@@ -1386,6 +1437,18 @@ uint64_t TextureCache::GetDescriptorHashForActiveTextures(
     const TextureBinding& binding =
         texture_bindings_[texture_srv.fetch_constant];
     XXH64_update(&hash_state, &binding.key, sizeof(binding.key));
+    // The same key may refer to a different resource after invalidation -
+    // content dedup adoption or a copy-on-write replace the storage - and the
+    // descriptors reference the resource, so they must be rewritten then.
+    ID3D12Resource* resource =
+        binding.texture != nullptr ? binding.texture->storage->resource
+                                   : nullptr;
+    XXH64_update(&hash_state, &resource, sizeof(resource));
+    ID3D12Resource* resource_signed =
+        binding.texture_signed != nullptr
+            ? binding.texture_signed->storage->resource
+            : nullptr;
+    XXH64_update(&hash_state, &resource_signed, sizeof(resource_signed));
     XXH64_update(&hash_state, &binding.swizzle, sizeof(binding.swizzle));
     XXH64_update(&hash_state, &binding.has_unsigned,
                  sizeof(binding.has_unsigned));
@@ -1413,7 +1476,7 @@ void TextureCache::WriteTextureSRV(const D3D12Shader::TextureSRV& texture_srv,
       texture = binding.texture;
     }
     if (texture != nullptr) {
-      resource = texture->resource;
+      resource = texture->storage->resource;
     }
 
     if (texture_srv.is_signed) {
@@ -1633,7 +1696,19 @@ TextureCache::SamplerParameters TextureCache::GetSamplerParameters(
 }
 
 void TextureCache::WriteSampler(SamplerParameters parameters,
-                                D3D12_CPU_DESCRIPTOR_HANDLE handle) const {
+                                D3D12_CPU_DESCRIPTOR_HANDLE handle) {
+  auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
+  auto device = provider->GetDevice();
+  // Try to copy an existing cached descriptor first - games use the same few
+  // parameter combinations for most of their samplers, and copying is much
+  // cheaper than creating the sampler anew for every fetch constant of every
+  // draw.
+  auto it = sampler_descriptor_cache_map_.find(parameters.value);
+  if (it != sampler_descriptor_cache_map_.end()) {
+    device->CopyDescriptorsSimple(1, handle, it->second,
+                                  D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+    return;
+  }
   D3D12_SAMPLER_DESC desc;
   if (parameters.aniso_filter != AnisoFilter::kDisabled) {
     desc.Filter = D3D12_FILTER_ANISOTROPIC;
@@ -1684,9 +1759,44 @@ void TextureCache::WriteSampler(SamplerParameters parameters,
   }
   desc.MinLOD = float(parameters.mip_min_level);
   desc.MaxLOD = float(parameters.mip_max_level);
-  auto device =
-      command_processor_->GetD3D12Context()->GetD3D12Provider()->GetDevice();
-  device->CreateSampler(&desc, handle);
+  // Create the sampler in the persistent cache if possible so later draws
+  // using these parameters only need a descriptor copy.
+  bool cached_handle_available = false;
+  D3D12_CPU_DESCRIPTOR_HANDLE cached_handle = {};
+  if (sampler_descriptor_cache_.empty() ||
+      sampler_descriptor_cache_.back().current_usage >=
+          SamplerDescriptorCachePage::kHeapSize) {
+    D3D12_DESCRIPTOR_HEAP_DESC new_heap_desc;
+    new_heap_desc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER;
+    new_heap_desc.NumDescriptors = SamplerDescriptorCachePage::kHeapSize;
+    new_heap_desc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+    new_heap_desc.NodeMask = 0;
+    ID3D12DescriptorHeap* new_heap;
+    if (SUCCEEDED(device->CreateDescriptorHeap(&new_heap_desc,
+                                               IID_PPV_ARGS(&new_heap)))) {
+      SamplerDescriptorCachePage new_page;
+      new_page.heap = new_heap;
+      new_page.heap_start = new_heap->GetCPUDescriptorHandleForHeapStart();
+      new_page.current_usage = 1;
+      cached_handle_available = true;
+      cached_handle = new_page.heap_start;
+      sampler_descriptor_cache_.push_back(new_page);
+    }
+  } else {
+    SamplerDescriptorCachePage& page = sampler_descriptor_cache_.back();
+    cached_handle_available = true;
+    cached_handle =
+        provider->OffsetSamplerDescriptor(page.heap_start, page.current_usage);
+    ++page.current_usage;
+  }
+  if (cached_handle_available) {
+    device->CreateSampler(&desc, cached_handle);
+    sampler_descriptor_cache_map_.insert({parameters.value, cached_handle});
+    device->CopyDescriptorsSimple(1, handle, cached_handle,
+                                  D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+  } else {
+    device->CreateSampler(&desc, handle);
+  }
 }
 
 void TextureCache::MarkRangeAsResolved(uint32_t start_unscaled,
@@ -2034,9 +2144,9 @@ bool TextureCache::RequestSwapTexture(D3D12_CPU_DESCRIPTOR_HANDLE handle,
   }
   MarkTextureUsed(texture);
   command_processor_->PushTransitionBarrier(
-      texture->resource, texture->state,
+      texture->storage->resource, texture->storage->state,
       D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-  texture->state = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+  texture->storage->state = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
   D3D12_SHADER_RESOURCE_VIEW_DESC srv_desc;
   srv_desc.Format = GetDXGIUnormFormat(key);
   srv_desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
@@ -2049,7 +2159,8 @@ bool TextureCache::RequestSwapTexture(D3D12_CPU_DESCRIPTOR_HANDLE handle,
   srv_desc.Texture2D.ResourceMinLODClamp = 0.0f;
   auto device =
       command_processor_->GetD3D12Context()->GetD3D12Provider()->GetDevice();
-  device->CreateShaderResourceView(texture->resource, &srv_desc, handle);
+  device->CreateShaderResourceView(texture->storage->resource, &srv_desc,
+                                   handle);
   format_out = key.format;
   return true;
 }
@@ -2315,10 +2426,14 @@ TextureCache::Texture* TextureCache::FindOrCreateTexture(TextureKey key) {
   // Create the texture object and add it to the map.
   Texture* texture = new Texture;
   texture->key = key;
-  texture->resource = resource;
-  texture->resource_size =
+  TextureStorage* storage = new TextureStorage;
+  storage->resource = resource;
+  storage->resource_size =
       device->GetResourceAllocationInfo(0, 1, &desc).SizeInBytes;
-  texture->state = state;
+  storage->state = state;
+  storage->refs = 1;
+  storage->content_hash = 0;
+  texture->storage = storage;
   texture->last_usage_frame = command_processor_->GetCurrentFrame();
   texture->last_usage_time = texture_current_usage_time_;
   texture->used_previous = texture_used_last_;
@@ -2375,7 +2490,13 @@ TextureCache::Texture* TextureCache::FindOrCreateTexture(TextureKey key) {
       texture->slice_sizes[i] = texture->slice_sizes[mip_max_storage_level];
       texture->pitches[i] = texture->pitches[mip_max_storage_level];
     }
-    texture->mips_in_sync = false;
+    // Watches and invalidation ranges are per guest storage level, and the
+    // levels above mip_max_storage_level alias it - clamp to 1 so the mip
+    // storage level argument is never confused with the base level.
+    texture->mip_max_storage_level = std::max(mip_max_storage_level, 1u);
+    texture->mips_in_sync = 0;
+    texture->mips_mask =
+        ((uint32_t(1) << (key.mip_max_level + 1)) - 1) & ~uint32_t(1);
   } else {
     std::memset(&texture->mip_offsets[1], 0,
                 (xe::countof(texture->mip_offsets) - 1) * sizeof(uint32_t));
@@ -2384,15 +2505,19 @@ TextureCache::Texture* TextureCache::FindOrCreateTexture(TextureKey key) {
     std::memset(&texture->pitches[1], 0,
                 (xe::countof(texture->pitches) - 1) * sizeof(uint32_t));
     // Never try to upload the mipmaps if there are none.
-    texture->mips_in_sync = true;
+    texture->mip_max_storage_level = 0;
+    texture->mips_in_sync = 0;
+    texture->mips_mask = 0;
   }
   texture->base_watch_handle = nullptr;
-  texture->mip_watch_handle = nullptr;
+  std::memset(texture->mip_watch_handles, 0,
+              sizeof(texture->mip_watch_handles));
   texture->cached_srv_descriptor_swizzle =
       Texture::kCachedSRVDescriptorSwizzleMissing;
   textures_.insert(std::make_pair(map_key, texture));
   COUNT_profile_set("gpu/texture_cache/textures", textures_.size());
-  textures_total_size_ += texture->resource_size;
+  textures_total_size_ += storage->resource_size;
+  texture_cache_memory.Add(storage->resource_size);
   COUNT_profile_set("gpu/texture_cache/total_size_mb",
                     uint32_t(textures_total_size_ >> 20));
   LogTextureAction(texture, "Created");
@@ -2402,16 +2527,53 @@ TextureCache::Texture* TextureCache::FindOrCreateTexture(TextureKey key) {
 
 bool TextureCache::LoadTextureData(Texture* texture) {
   // See what we need to upload.
-  bool base_in_sync, mips_in_sync;
+  bool base_in_sync;
+  uint32_t mips_in_sync;
   {
     auto watch_lock = shared_memory_->LockWatchMutex();
     base_in_sync = texture->base_in_sync;
     mips_in_sync = texture->mips_in_sync;
   }
-  if (base_in_sync && mips_in_sync) {
+  // Bits of the mips that need to be reloaded from the guest memory.
+  uint32_t mips_outdated = texture->mips_mask & ~mips_in_sync;
+  if (base_in_sync && !mips_outdated) {
     return true;
   }
 
+  // Content dedup (d3d12_texture_dedup) - when nothing already loaded into
+  // the storage needs to be preserved, the texture can adopt the storage of a
+  // content-identical texture at a different guest address (an atlas copy or
+  // a double-buffered stream) instead of converting the same data again.
+  uint64_t content_hash =
+      cvars::d3d12_texture_dedup ? HashTextureContent(texture) : 0;
+  bool fully_outdated =
+      mips_in_sync == 0 && (texture->key.base_page == 0 || !base_in_sync);
+  if (content_hash != 0 && fully_outdated) {
+    auto found_range = texture_storages_by_hash_.equal_range(content_hash);
+    for (auto iter = found_range.first; iter != found_range.second; ++iter) {
+      TextureStorage* found_storage = iter->second;
+      if (found_storage == texture->storage) {
+        continue;
+      }
+      // The content hash covers all the key bits except for the addresses, so
+      // the resources are interchangeable.
+      ReleaseTextureStorage(texture->storage, true);
+      texture->storage = found_storage;
+      ++found_storage->refs;
+      // The cached SRV descriptor references the old resource.
+      if (texture->cached_srv_descriptor_swizzle !=
+          Texture::kCachedSRVDescriptorSwizzleMissing) {
+        srv_descriptor_cache_free_.push_back(texture->cached_srv_descriptor);
+        texture->cached_srv_descriptor_swizzle =
+            Texture::kCachedSRVDescriptorSwizzleMissing;
+      }
+      MarkTextureUsed(texture);
+      WatchTexture(texture, !base_in_sync, mips_outdated);
+      LogTextureAction(texture, "Deduplicated");
+      return true;
+    }
+  }
+
   auto command_list = command_processor_->GetDeferredCommandList();
   auto provider = command_processor_->GetD3D12Context()->GetD3D12Provider();
   auto device = provider->GetDevice();
@@ -2441,10 +2603,27 @@ bool TextureCache::LoadTextureData(Texture* texture) {
       return false;
     }
   }
-  if (!mips_in_sync) {
-    if (!shared_memory_->RequestRange(texture->key.mip_page << 12,
-                                      texture->mip_size)) {
-      return false;
+  if (mips_outdated) {
+    // Request only the outdated guest storage levels - the packed mip tail
+    // shares the storage of mip_max_storage_level.
+    uint32_t mip_array_size =
+        texture->key.dimension != Dimension::k3D ? texture->key.depth : 1;
+    uint32_t mips_request = mips_outdated;
+    uint32_t mip_request_level;
+    while (xe::bit_scan_forward(mips_request, &mip_request_level)) {
+      uint32_t storage_level =
+          std::min(mip_request_level, texture->mip_max_storage_level);
+      if (storage_level == texture->mip_max_storage_level) {
+        mips_request &= (uint32_t(1) << storage_level) - 1;
+      } else {
+        mips_request &= ~(uint32_t(1) << mip_request_level);
+      }
+      if (!shared_memory_->RequestRange(
+              (texture->key.mip_page << 12) +
+                  texture->mip_offsets[storage_level],
+              texture->slice_sizes[storage_level] * mip_array_size)) {
+        return false;
+      }
     }
   }
   if (scaled_resolve) {
@@ -2459,6 +2638,50 @@ bool TextureCache::LoadTextureData(Texture* texture) {
     }
   }
 
+  // If the storage is shared with other textures, give this texture a private
+  // copy before overwriting it - the other textures keep the current content.
+  if (texture->storage->refs > 1) {
+    TextureStorage* shared_storage = texture->storage;
+    D3D12_RESOURCE_DESC shared_desc = shared_storage->resource->GetDesc();
+    ID3D12Resource* private_resource;
+    if (FAILED(device->CreateCommittedResource(
+            &ui::d3d12::util::kHeapPropertiesDefault, D3D12_HEAP_FLAG_NONE,
+            &shared_desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr,
+            IID_PPV_ARGS(&private_resource)))) {
+      LogTextureAction(texture, "Failed to create a private copy of");
+      return false;
+    }
+    TextureStorage* private_storage = new TextureStorage;
+    private_storage->resource = private_resource;
+    private_storage->resource_size = shared_storage->resource_size;
+    private_storage->state = D3D12_RESOURCE_STATE_COPY_DEST;
+    private_storage->refs = 1;
+    private_storage->content_hash = 0;
+    if (!fully_outdated) {
+      // Carry over the levels that are still in sync.
+      command_processor_->PushTransitionBarrier(
+          shared_storage->resource, shared_storage->state,
+          D3D12_RESOURCE_STATE_COPY_SOURCE);
+      shared_storage->state = D3D12_RESOURCE_STATE_COPY_SOURCE;
+      command_processor_->SubmitBarriers();
+      command_list->D3DCopyResource(private_resource,
+                                    shared_storage->resource);
+    }
+    --shared_storage->refs;
+    texture->storage = private_storage;
+    textures_total_size_ += private_storage->resource_size;
+    texture_cache_memory.Add(private_storage->resource_size);
+    COUNT_profile_set("gpu/texture_cache/total_size_mb",
+                      uint32_t(textures_total_size_ >> 20));
+    // The cached SRV descriptor references the shared resource.
+    if (texture->cached_srv_descriptor_swizzle !=
+        Texture::kCachedSRVDescriptorSwizzleMissing) {
+      srv_descriptor_cache_free_.push_back(texture->cached_srv_descriptor);
+      texture->cached_srv_descriptor_swizzle =
+          Texture::kCachedSRVDescriptorSwizzleMissing;
+    }
+  }
+
   // Update LRU caching because the texture will be used by the command list.
   MarkTextureUsed(texture);
 
@@ -2474,7 +2697,7 @@ bool TextureCache::LoadTextureData(Texture* texture) {
   uint32_t block_height = guest_format_info->block_height;
 
   // Get the host layout and the buffer.
-  D3D12_RESOURCE_DESC resource_desc = texture->resource->GetDesc();
+  D3D12_RESOURCE_DESC resource_desc = texture->storage->resource->GetDesc();
   D3D12_PLACED_SUBRESOURCE_FOOTPRINT host_layouts[D3D12_REQ_MIP_LEVELS];
   UINT64 host_slice_size;
   device->GetCopyableFootprints(&resource_desc, 0, resource_desc.MipLevels, 0,
@@ -2496,8 +2719,13 @@ bool TextureCache::LoadTextureData(Texture* texture) {
   }
 
   // Begin loading.
-  uint32_t mip_first = base_in_sync ? 1 : 0;
-  uint32_t mip_last = mips_in_sync ? 0 : resource_desc.MipLevels - 1;
+  uint32_t mip_first = 0, mip_last = 0;
+  if (base_in_sync) {
+    // Bit 0 is never set in mips_outdated, and it's non-zero here since
+    // there's something to upload.
+    xe::bit_scan_forward(mips_outdated, &mip_first);
+  }
+  xe::bit_scan_reverse(mips_outdated, &mip_last);
   // Can't address more than 512 MB directly on Nvidia - need two separate UAV
   // descriptors for base and mips.
   bool separate_base_and_mips_descriptors =
@@ -2551,10 +2779,11 @@ bool TextureCache::LoadTextureData(Texture* texture) {
   }
 
   // Submit commands.
-  command_processor_->PushTransitionBarrier(texture->resource, texture->state,
+  command_processor_->PushTransitionBarrier(texture->storage->resource,
+                                            texture->storage->state,
                                             D3D12_RESOURCE_STATE_COPY_DEST);
-  texture->state = D3D12_RESOURCE_STATE_COPY_DEST;
-  auto cbuffer_pool = command_processor_->GetConstantBufferPool();
+  texture->storage->state = D3D12_RESOURCE_STATE_COPY_DEST;
+  auto staging_memory = command_processor_->GetStagingMemoryManager();
   LoadConstants load_constants;
   load_constants.is_3d = is_3d ? 1 : 0;
   load_constants.endianness = uint32_t(texture->key.endianness);
@@ -2569,6 +2798,9 @@ bool TextureCache::LoadTextureData(Texture* texture) {
         copy_buffer, copy_buffer_state, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
     copy_buffer_state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
     for (uint32_t j = mip_first; j <= mip_last; ++j) {
+      if (j != 0 && !(mips_outdated & (uint32_t(1) << j))) {
+        continue;
+      }
       if (scaled_resolve) {
         // Offset already applied in the buffer because more than 512 MB can't
         // be directly addresses on Nvidia.
@@ -2613,10 +2845,10 @@ bool TextureCache::LoadTextureData(Texture* texture) {
                                          load_constants.guest_mip_offset[2]);
       }
       D3D12_GPU_VIRTUAL_ADDRESS cbuffer_gpu_address;
-      uint8_t* cbuffer_mapping = cbuffer_pool->Request(
+      uint8_t* cbuffer_mapping = staging_memory->Request(
           command_processor_->GetCurrentFrame(),
-          xe::align(uint32_t(sizeof(load_constants)), 256u), nullptr, nullptr,
-          &cbuffer_gpu_address);
+          xe::align(uint32_t(sizeof(load_constants)), 256u), 256, nullptr,
+          nullptr, &cbuffer_gpu_address);
       if (cbuffer_mapping == nullptr) {
         command_processor_->ReleaseScratchGPUBuffer(copy_buffer,
                                                     copy_buffer_state);
@@ -2654,11 +2886,14 @@ bool TextureCache::LoadTextureData(Texture* texture) {
     command_processor_->SubmitBarriers();
     UINT slice_first_subresource = i * resource_desc.MipLevels;
     for (uint32_t j = mip_first; j <= mip_last; ++j) {
+      if (j != 0 && !(mips_outdated & (uint32_t(1) << j))) {
+        continue;
+      }
       D3D12_TEXTURE_COPY_LOCATION location_source, location_dest;
       location_source.pResource = copy_buffer;
       location_source.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
       location_source.PlacedFootprint = host_layouts[j];
-      location_dest.pResource = texture->resource;
+      location_dest.pResource = texture->storage->resource;
       location_dest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
       location_dest.SubresourceIndex = slice_first_subresource + j;
       command_list->CopyTexture(location_dest, location_source);
@@ -2671,19 +2906,25 @@ bool TextureCache::LoadTextureData(Texture* texture) {
   // resolves as well to detect when the CPU wants to reuse the memory for a
   // regular texture or a vertex buffer, and thus the scaled resolve version is
   // not up to date anymore.
-  {
-    auto watch_lock = shared_memory_->LockWatchMutex();
-    texture->base_in_sync = true;
-    texture->mips_in_sync = true;
-    if (!base_in_sync) {
-      texture->base_watch_handle = shared_memory_->WatchMemoryRange(
-          texture->key.base_page << 12, texture->base_size, WatchCallbackThunk,
-          this, texture, 0);
+  WatchTexture(texture, !base_in_sync, mips_outdated);
+
+  // Make the now fully loaded storage available for content dedup.
+  if (cvars::d3d12_texture_dedup &&
+      texture->storage->content_hash != content_hash) {
+    TextureStorage* storage = texture->storage;
+    if (storage->content_hash != 0) {
+      auto hash_range =
+          texture_storages_by_hash_.equal_range(storage->content_hash);
+      for (auto iter = hash_range.first; iter != hash_range.second; ++iter) {
+        if (iter->second == storage) {
+          texture_storages_by_hash_.erase(iter);
+          break;
+        }
+      }
     }
-    if (!mips_in_sync) {
-      texture->mip_watch_handle = shared_memory_->WatchMemoryRange(
-          texture->key.mip_page << 12, texture->mip_size, WatchCallbackThunk,
-          this, texture, 1);
+    storage->content_hash = content_hash;
+    if (content_hash != 0) {
+      texture_storages_by_hash_.insert(std::make_pair(content_hash, storage));
     }
   }
 
@@ -2691,6 +2932,107 @@ bool TextureCache::LoadTextureData(Texture* texture) {
   return true;
 }
 
+void TextureCache::WatchTexture(Texture* texture, bool watch_base,
+                                uint32_t watch_mips) {
+  uint32_t slice_count =
+      texture->key.dimension == Dimension::k3D ? 1 : texture->key.depth;
+  auto watch_lock = shared_memory_->LockWatchMutex();
+  texture->base_in_sync = true;
+  texture->mips_in_sync = texture->mips_mask;
+  if (watch_base) {
+    texture->base_watch_handle = shared_memory_->WatchMemoryRange(
+        texture->key.base_page << 12, texture->base_size, WatchCallbackThunk,
+        this, texture, 0);
+  }
+  // Watch each reloaded guest storage level separately, so a write to one
+  // mip doesn't invalidate the others - the storage level is passed as the
+  // argument (never 0, which means the base level).
+  uint32_t mips_watch = watch_mips;
+  uint32_t mip_watch_level;
+  while (xe::bit_scan_forward(mips_watch, &mip_watch_level)) {
+    uint32_t storage_level =
+        std::min(mip_watch_level, texture->mip_max_storage_level);
+    if (storage_level == texture->mip_max_storage_level) {
+      mips_watch &= (uint32_t(1) << storage_level) - 1;
+    } else {
+      mips_watch &= ~(uint32_t(1) << mip_watch_level);
+    }
+    texture->mip_watch_handles[storage_level] = shared_memory_->WatchMemoryRange(
+        (texture->key.mip_page << 12) + texture->mip_offsets[storage_level],
+        texture->slice_sizes[storage_level] * slice_count, WatchCallbackThunk,
+        this, texture, storage_level);
+  }
+}
+
+uint64_t TextureCache::HashTextureContent(const Texture* texture) {
+  // Scaled resolve data lives in the GPU-local scaled buffer rather than in
+  // the guest memory.
+  if (texture->key.scaled_resolve) {
+    return 0;
+  }
+  // GPU-written ranges (resolves) have stale CPU-side contents - hashing them
+  // wouldn't identify what the texture is actually loaded from.
+  if (texture->key.base_page != 0 &&
+      shared_memory_->IsRangeWrittenByGPU(texture->key.base_page << 12,
+                                          texture->base_size)) {
+    return 0;
+  }
+  if (texture->key.mip_page != 0 &&
+      shared_memory_->IsRangeWrittenByGPU(texture->key.mip_page << 12,
+                                          texture->mip_size)) {
+    return 0;
+  }
+  XXH64_state_t hash_state;
+  XXH64_reset(&hash_state, 0);
+  // The key bits that affect the converted representation - textures with the
+  // same guest bytes but a different format, layout or endianness have
+  // different host contents. The addresses are excluded, only the presence of
+  // the base and the mips matters.
+  TextureKey content_key = texture->key;
+  content_key.base_page = texture->key.base_page != 0 ? 1 : 0;
+  content_key.mip_page = texture->key.mip_page != 0 ? 1 : 0;
+  XXH64_update(&hash_state, &content_key, sizeof(content_key));
+  if (texture->key.base_page != 0) {
+    XXH64_update(&hash_state,
+                 memory_->TranslatePhysical(texture->key.base_page << 12),
+                 texture->base_size);
+  }
+  if (texture->key.mip_page != 0) {
+    XXH64_update(&hash_state,
+                 memory_->TranslatePhysical(texture->key.mip_page << 12),
+                 texture->mip_size);
+  }
+  uint64_t hash = XXH64_digest(&hash_state);
+  // 0 is reserved for "not hashed".
+  return hash != 0 ? hash : 1;
+}
+
+void TextureCache::ReleaseTextureStorage(TextureStorage* storage,
+                                         bool in_flight) {
+  assert_not_zero(storage->refs);
+  if (--storage->refs != 0) {
+    return;
+  }
+  if (storage->content_hash != 0) {
+    auto hash_range =
+        texture_storages_by_hash_.equal_range(storage->content_hash);
+    for (auto iter = hash_range.first; iter != hash_range.second; ++iter) {
+      if (iter->second == storage) {
+        texture_storages_by_hash_.erase(iter);
+        break;
+      }
+    }
+  }
+  textures_total_size_ -= storage->resource_size;
+  texture_cache_memory.Remove(storage->resource_size);
+  if (in_flight) {
+    command_processor_->DeferResourceDeletion(storage->resource);
+  } else {
+    storage->resource->Release();
+  }
+  delete storage;
+}
+
 void TextureCache::MarkTextureUsed(Texture* texture) {
   uint64_t current_frame = command_processor_->GetCurrentFrame();
   // This is called very frequently, don't relink unless needed for caching.
@@ -2720,14 +3062,20 @@ void TextureCache::WatchCallbackThunk(void* context, void* data,
                                       uint64_t argument,
                                       bool invalidated_by_gpu) {
   TextureCache* texture_cache = reinterpret_cast<TextureCache*>(context);
-  texture_cache->WatchCallback(reinterpret_cast<Texture*>(data), argument != 0);
+  texture_cache->WatchCallback(reinterpret_cast<Texture*>(data),
+                               uint32_t(argument));
 }
 
-void TextureCache::WatchCallback(Texture* texture, bool is_mip) {
+void TextureCache::WatchCallback(Texture* texture, uint32_t mip_storage_level) {
   // Mutex already locked here.
-  if (is_mip) {
-    texture->mips_in_sync = false;
-    texture->mip_watch_handle = nullptr;
+  if (mip_storage_level != 0) {
+    uint32_t mips_invalidated = uint32_t(1) << mip_storage_level;
+    if (mip_storage_level == texture->mip_max_storage_level) {
+      // The packed mip tail is stored within the last storage level.
+      mips_invalidated = ~((uint32_t(1) << mip_storage_level) - 1);
+    }
+    texture->mips_in_sync &= ~mips_invalidated;
+    texture->mip_watch_handles[mip_storage_level] = nullptr;
   } else {
     texture->base_in_sync = false;
     texture->base_watch_handle = nullptr;
@@ -93,7 +93,8 @@ class TextureCache {
   };
 
   TextureCache(D3D12CommandProcessor* command_processor,
-               RegisterFile* register_file, SharedMemory* shared_memory);
+               RegisterFile* register_file, Memory* memory,
+               SharedMemory* shared_memory);
   ~TextureCache();
 
   bool Initialize();
@@ -124,7 +125,7 @@ class TextureCache {
   SamplerParameters GetSamplerParameters(
       const D3D12Shader::SamplerBinding& binding) const;
   void WriteSampler(SamplerParameters parameters,
-                    D3D12_CPU_DESCRIPTOR_HANDLE handle) const;
+                    D3D12_CPU_DESCRIPTOR_HANDLE handle);
 
   void MarkRangeAsResolved(uint32_t start_unscaled, uint32_t length_unscaled);
   static inline DXGI_FORMAT GetResolveDXGIFormat(TextureFormat format) {
@@ -141,9 +142,21 @@ class TextureCache {
                            uint32_t* written_address_out,
                            uint32_t* written_length_out);
 
+  // Whether 2x resolution scaling is currently active. Textures, resolve
+  // targets and pipelines are all keyed on the scale, so variants for both
+  // scales stay cached across switches.
   inline bool IsResolutionScale2X() const {
+    return resolution_scale_2x_enabled_;
+  }
+  // Whether the device can do 2x resolution scaling at all (the tiled scaled
+  // resolve buffer exists - it only reserves address space until resolves
+  // actually happen, so it's created whenever the hardware allows).
+  inline bool IsResolutionScale2XSupported() const {
     return scaled_resolve_buffer_ != nullptr;
   }
+  // May be called only between frames, when the GPU is not using any
+  // resources from the cache.
+  void SetResolutionScale2X(bool enabled);
   ID3D12Resource* GetScaledResolveBuffer() const {
     return scaled_resolve_buffer_;
   }
@@ -337,11 +350,24 @@ class TextureCache {
     }
   };
 
-  struct Texture {
-    TextureKey key;
+  // GPU storage of a texture, shareable by multiple content-identical
+  // textures at different guest addresses (d3d12_texture_dedup). The resource
+  // state is per-resource, so it lives here rather than in the textures.
+  struct TextureStorage {
     ID3D12Resource* resource;
     uint64_t resource_size;
     D3D12_RESOURCE_STATES state;
+    // Number of textures pointing at this storage.
+    uint32_t refs;
+    // XXH64 of the guest texture data and the conversion-affecting key bits,
+    // the key in texture_storages_by_hash_. 0 if the storage has never been
+    // fully loaded or its content can't be hashed on the CPU.
+    uint64_t content_hash;
+  };
+
+  struct Texture {
+    TextureKey key;
+    TextureStorage* storage;
 
     uint64_t last_usage_frame;
     uint64_t last_usage_time;
@@ -370,15 +396,23 @@ class TextureCache {
     uint32_t cached_srv_descriptor_swizzle;
 
     // Watch handles for the memory ranges (protected by the shared memory watch
-    // mutex).
+    // mutex). Mips are watched per guest storage level, so a write to one mip
+    // only invalidates that level rather than the whole mip tail.
     SharedMemory::WatchHandle base_watch_handle;
-    SharedMemory::WatchHandle mip_watch_handle;
+    SharedMemory::WatchHandle mip_watch_handles[14];
     // Whether the recent base level data has been loaded from the memory
     // (protected by the shared memory watch mutex).
     bool base_in_sync;
-    // Whether the recent mip data has been loaded from the memory (protected by
-    // the shared memory watch mutex).
-    bool mips_in_sync;
+    // Bits for mips 1 to mip_max_level - whether the recent data for the mip
+    // has been loaded from the memory (protected by the shared memory watch
+    // mutex).
+    uint32_t mips_in_sync;
+    // Bits set for all the mips the texture has (1 to mip_max_level), for
+    // comparison with mips_in_sync.
+    uint32_t mips_mask;
+    // The last mip level that has its own guest memory storage - packed mips
+    // above it are stored within it.
+    uint32_t mip_max_storage_level;
   };
 
   struct SRVDescriptorCachePage {
@@ -388,6 +422,13 @@ class TextureCache {
     uint32_t current_usage;
   };
 
+  struct SamplerDescriptorCachePage {
+    static constexpr uint32_t kHeapSize = 2048;
+    ID3D12DescriptorHeap* heap;
+    D3D12_CPU_DESCRIPTOR_HANDLE heap_start;
+    uint32_t current_usage;
+  };
+
   struct LoadConstants {
     // vec4 0.
     uint32_t guest_base;
@@ -512,16 +553,34 @@ class TextureCache {
   // allocates descriptors and copies!
   bool LoadTextureData(Texture* texture);
 
+  // Computes the XXH64 content hash of the guest data of the texture and the
+  // key bits that affect its converted representation, for storage sharing
+  // between content-identical textures. Returns 0 if the content can't be
+  // identified from the CPU - if the guest data contains GPU-written pages
+  // (such as resolves), or for 2x-scaled resolve textures, whose source is
+  // the GPU-local scaled buffer.
+  uint64_t HashTextureContent(const Texture* texture);
+  // Releases one reference to the storage, and when the last one is dropped,
+  // removes the storage from the hash map, excludes it from the memory usage
+  // counter and destroys the resource - deferred until the GPU completes the
+  // last submission potentially referencing it if in_flight is true.
+  void ReleaseTextureStorage(TextureStorage* storage, bool in_flight);
+  // Marks the texture as fully in sync with the guest memory and watches its
+  // guest ranges for invalidation - the tail of a data load, also done when
+  // adopting the storage of a content-identical texture instead of loading.
+  void WatchTexture(Texture* texture, bool watch_base, uint32_t watch_mips);
+
   // For LRU caching - updates the last usage frame and moves the texture to
   // the end of the usage queue. Must be called any time the texture is
   // referenced by any command list to make sure it's not destroyed while still
   // in use.
   void MarkTextureUsed(Texture* texture);
 
-  // Shared memory callback for texture data invalidation.
+  // Shared memory callback for texture data invalidation. The argument is the
+  // modified guest mip storage level, 0 meaning the base level.
   static void WatchCallbackThunk(void* context, void* data, uint64_t argument,
                                  bool invalidated_by_gpu);
-  void WatchCallback(Texture* texture, bool is_mip);
+  void WatchCallback(Texture* texture, uint32_t mip_storage_level);
 
   // Makes all bindings invalid. Also requesting textures after calling this
   // will cause another attempt to create a texture or to untile it if there was
@@ -547,6 +606,7 @@ class TextureCache {
 
   D3D12CommandProcessor* command_processor_;
   RegisterFile* register_file_;
+  Memory* memory_;
   SharedMemory* shared_memory_;
 
   static const LoadModeInfo load_mode_info_[];
@@ -560,7 +620,14 @@ class TextureCache {
       resolve_tile_pipelines_[size_t(ResolveTileMode::kCount)] = {};
 
   std::unordered_multimap<uint64_t, Texture*> textures_;
+  // Storages of fully loaded textures by their content hash, for sharing GPU
+  // storage between content-identical textures (d3d12_texture_dedup).
+  std::unordered_multimap<uint64_t, TextureStorage*> texture_storages_by_hash_;
+  // Total size of the resources of all the texture storages - shared storages
+  // are counted once.
   uint64_t textures_total_size_ = 0;
+  // Number of textures destroyed over the cache limits since creation.
+  uint64_t texture_evictions_ = 0;
   Texture* texture_used_first_ = nullptr;
   Texture* texture_used_last_ = nullptr;
   uint64_t texture_current_usage_time_;
@@ -569,6 +636,13 @@ class TextureCache {
   // Cached descriptors used by deleted textures, for reuse.
   std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> srv_descriptor_cache_free_;
 
+  std::vector<SamplerDescriptorCachePage> sampler_descriptor_cache_;
+  // Sampler descriptors created for the parameter sets encountered so far
+  // (the key is SamplerParameters::value), so draws only copy them instead of
+  // creating the sampler for every fetch constant again.
+  std::unordered_map<uint64_t, D3D12_CPU_DESCRIPTOR_HANDLE>
+      sampler_descriptor_cache_map_;
+
   enum class NullSRVDescriptorIndex {
     k2DArray,
     k3D,
@@ -607,6 +681,9 @@ class TextureCache {
   ID3D12Resource* scaled_resolve_buffer_ = nullptr;
   D3D12_RESOURCE_STATES scaled_resolve_buffer_state_ =
       D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+  // Whether new resolves and texture loads use the scaled path. Switched at
+  // runtime between frames; cached resources of the inactive scale are kept.
+  bool resolution_scale_2x_enabled_ = false;
   // Not very big heaps (16 MB) because they are needed pretty sparsely. One
   // scaled 1280x720x32bpp texture is slighly bigger than 14 MB.
   static constexpr uint32_t kScaledResolveHeapSizeLog2 = 24;
@@ -9,6 +9,8 @@
 
 #include "xenia/gpu/graphics_system.h"
 
+#include <cstdlib>
+
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/clock.h"
 #include "xenia/base/logging.h"
@@ -35,6 +37,14 @@ __declspec(dllexport) uint32_t AmdPowerXpressRequestHighPerformance = 1;
 }  // extern "C"
 #endif  // XE_PLATFORM_WIN32
 
+namespace {
+// Every guest MMIO register access lands here through a host page fault, so
+// these make the rate of such accesses (typically status spin-polls) visible
+// in the profiler.
+StatCounter count_register_reads("gpu/mmio/register_reads");
+StatCounter count_register_writes("gpu/mmio/register_writes");
+}  // namespace
+
 GraphicsSystem::GraphicsSystem() : vsync_worker_running_(false) {}
 
 GraphicsSystem::~GraphicsSystem() = default;
@@ -160,6 +170,23 @@ void GraphicsSystem::Reset() {
   xe::FatalError("Graphics device lost (probably due to an internal error)");
 }
 
+void GraphicsSystem::UpdatePresentStatistics() {
+  uint64_t tick_count = Clock::QueryHostTickCount();
+  if (present_last_tick_count_ != 0) {
+    int64_t interval_us =
+        int64_t((tick_count - present_last_tick_count_) * 1000000 /
+                Clock::QueryHostTickFrequency());
+    COUNT_profile_set("gpu/present/interval_us", uint32_t(interval_us));
+    if (present_last_interval_us_ != 0) {
+      int64_t jitter_us = interval_us - present_last_interval_us_;
+      COUNT_profile_set("gpu/present/jitter_us",
+                        uint32_t(std::abs(jitter_us)));
+    }
+    present_last_interval_us_ = interval_us;
+  }
+  present_last_tick_count_ = tick_count;
+}
+
 uint32_t GraphicsSystem::ReadRegisterThunk(void* ppc_context,
                                            GraphicsSystem* gs, uint32_t addr) {
   return gs->ReadRegister(addr);
@@ -172,6 +199,7 @@ void GraphicsSystem::WriteRegisterThunk(void* ppc_context, GraphicsSystem* gs,
 
 uint32_t GraphicsSystem::ReadRegister(uint32_t addr) {
   uint32_t r = (addr & 0xFFFF) / 4;
+  count_register_reads.Increment();
 
   switch (r) {
     case 0x0F00:  // RB_EDRAM_TIMING
@@ -187,17 +215,22 @@ uint32_t GraphicsSystem::ReadRegister(uint32_t addr) {
                   // maximum [width(0x0FFF), height(0x0FFF)]
       return 0x050002D0;
     default:
-      if (!register_file_.GetRegisterInfo(r)) {
+      // Log only the first read of each unknown register - titles spin-poll
+      // these thousands of times per frame.
+      if (r < RegisterFile::kRegisterCount && !unknown_reads_logged_[r] &&
+          !register_file_.GetRegisterInfo(r)) {
+        unknown_reads_logged_[r] = true;
         XELOGE("GPU: Read from unknown register (%.4X)", r);
       }
   }
 
   assert_true(r < RegisterFile::kRegisterCount);
-  return register_file_.values[r].u32;
+  return register_file_.ReadWord(r);
 }
 
 void GraphicsSystem::WriteRegister(uint32_t addr, uint32_t value) {
   uint32_t r = (addr & 0xFFFF) / 4;
+  count_register_writes.Increment();
 
   switch (r) {
     case 0x01C5:  // CP_RB_WPTR
@@ -206,12 +239,15 @@ void GraphicsSystem::WriteRegister(uint32_t addr, uint32_t value) {
     case 0x1844:  // AVIVO_D1GRPH_PRIMARY_SURFACE_ADDRESS
       break;
     default:
-      XELOGW("Unknown GPU register %.4X write: %.8X", r, value);
+      if (r < RegisterFile::kRegisterCount && !unknown_writes_logged_[r]) {
+        unknown_writes_logged_[r] = true;
+        XELOGW("Unknown GPU register %.4X write: %.8X", r, value);
+      }
       break;
   }
 
   assert_true(r < RegisterFile::kRegisterCount);
-  register_file_.values[r].u32 = value;
+  register_file_.WriteWord(r, value);
 }
 
 void GraphicsSystem::InitializeRingBuffer(uint32_t ptr, uint32_t log2_size) {
@@ -269,6 +305,11 @@ void GraphicsSystem::ClearCaches() {
       [&]() { command_processor_->ClearCaches(); });
 }
 
+void GraphicsSystem::ToggleResolutionScale() {
+  command_processor_->CallInThread(
+      [&]() { command_processor_->ToggleResolutionScale(); });
+}
+
 void GraphicsSystem::RequestFrameTrace() {
   command_processor_->RequestFrameTrace(
       xe::to_wstring(cvars::trace_gpu_prefix));
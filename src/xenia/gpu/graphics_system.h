@@ -11,6 +11,8 @@
 #define XENIA_GPU_GRAPHICS_SYSTEM_H_
 
 #include <atomic>
+#include <bitset>
+#include <functional>
 #include <memory>
 #include <thread>
 
@@ -49,6 +51,16 @@ class GraphicsSystem {
 
   virtual std::unique_ptr<xe::ui::RawImage> Capture() { return nullptr; }
 
+  // Asynchronous frame capture. While enabled, every presented frame is
+  // copied to a small staging ring on the GPU timeline and handed to the
+  // sink from a worker thread once the copy completes, without stalling
+  // presentation; frames are dropped when the ring is full. Returns false
+  // if the backend doesn't support it.
+  using FrameCaptureSink =
+      std::function<void(std::unique_ptr<xe::ui::RawImage> frame)>;
+  virtual bool BeginFrameCapture(FrameCaptureSink sink) { return false; }
+  virtual void EndFrameCapture() {}
+
   RegisterFile* register_file() { return &register_file_; }
   CommandProcessor* command_processor() const {
     return command_processor_.get();
@@ -61,6 +73,7 @@ class GraphicsSystem {
   void DispatchInterruptCallback(uint32_t source, uint32_t cpu);
 
   virtual void ClearCaches();
+  void ToggleResolutionScale();
 
   void RequestFrameTrace();
   void BeginTracing();
@@ -87,6 +100,9 @@ class GraphicsSystem {
 
   void MarkVblank();
   virtual void Swap(xe::ui::UIEvent* e) = 0;
+  // Called by the backends when presenting a frame - reports the
+  // present-to-present interval and its jitter to the profiler.
+  void UpdatePresentStatistics();
 
   Memory* memory_ = nullptr;
   cpu::Processor* processor_ = nullptr;
@@ -103,6 +119,16 @@ class GraphicsSystem {
   RegisterFile register_file_;
   std::unique_ptr<CommandProcessor> command_processor_;
 
+  // Present timing, for jitter reporting in UpdatePresentStatistics.
+  uint64_t present_last_tick_count_ = 0;
+  int64_t present_last_interval_us_ = 0;
+
+  // Registers that have already been reported as unknown, so a title polling
+  // an unhandled register doesn't flood the log with thousands of identical
+  // messages per frame. Unsynchronized - a race at worst logs a duplicate.
+  std::bitset<RegisterFile::kRegisterCount> unknown_reads_logged_;
+  std::bitset<RegisterFile::kRegisterCount> unknown_writes_logged_;
+
   bool paused_ = false;
 };
 
@@ -16,6 +16,22 @@ namespace gpu {
 
 using namespace xe::gpu::xenos;
 
+namespace {
+
+// Allocates the packet's action array from the arena, or returns null when
+// the caller asked for header-only disassembly.
+PacketAction* AllocActions(Arena* arena, PacketInfo* out_info, size_t count) {
+  if (!arena || !count) {
+    return nullptr;
+  }
+  out_info->actions = reinterpret_cast<PacketAction*>(
+      arena->Alloc(sizeof(PacketAction) * count));
+  out_info->action_count = count;
+  return out_info->actions;
+}
+
+}  // namespace
+
 PacketCategory PacketDisassembler::GetPacketCategory(const uint8_t* base_ptr) {
   const uint32_t packet = xe::load_and_swap<uint32_t>(base_ptr);
   const uint32_t packet_type = packet >> 30;
@@ -46,7 +62,7 @@ PacketCategory PacketDisassembler::GetPacketCategory(const uint8_t* base_ptr) {
 
 bool PacketDisassembler::DisasmPacketType0(const uint8_t* base_ptr,
                                            uint32_t packet,
-                                           PacketInfo* out_info) {
+                                           PacketInfo* out_info, Arena* arena) {
   static const PacketTypeInfo type_0_info = {PacketCategory::kGeneric,
                                              "PM4_TYPE0"};
   out_info->type_info = &type_0_info;
@@ -57,12 +73,13 @@ bool PacketDisassembler::DisasmPacketType0(const uint8_t* base_ptr,
 
   uint32_t base_index = (packet & 0x7FFF);
   uint32_t write_one_reg = (packet >> 15) & 0x1;
-  for (uint32_t m = 0; m < count; m++) {
-    uint32_t reg_data = xe::load_and_swap<uint32_t>(ptr);
-    uint32_t target_index = write_one_reg ? base_index : base_index + m;
-    out_info->actions.emplace_back(
-        PacketAction::RegisterWrite(target_index, reg_data));
-    ptr += 4;
+  if (PacketAction* actions = AllocActions(arena, out_info, count)) {
+    for (uint32_t m = 0; m < count; m++) {
+      uint32_t reg_data = xe::load_and_swap<uint32_t>(ptr);
+      uint32_t target_index = write_one_reg ? base_index : base_index + m;
+      actions[m] = PacketAction::RegisterWrite(target_index, reg_data);
+      ptr += 4;
+    }
   }
 
   return true;
@@ -70,7 +87,7 @@ bool PacketDisassembler::DisasmPacketType0(const uint8_t* base_ptr,
 
 bool PacketDisassembler::DisasmPacketType1(const uint8_t* base_ptr,
                                            uint32_t packet,
-                                           PacketInfo* out_info) {
+                                           PacketInfo* out_info, Arena* arena) {
   static const PacketTypeInfo type_1_info = {PacketCategory::kGeneric,
                                              "PM4_TYPE1"};
   out_info->type_info = &type_1_info;
@@ -82,17 +99,17 @@ bool PacketDisassembler::DisasmPacketType1(const uint8_t* base_ptr,
   uint32_t reg_index_2 = (packet >> 11) & 0x7FF;
   uint32_t reg_data_1 = xe::load_and_swap<uint32_t>(ptr);
   uint32_t reg_data_2 = xe::load_and_swap<uint32_t>(ptr + 4);
-  out_info->actions.emplace_back(
-      PacketAction::RegisterWrite(reg_index_1, reg_data_1));
-  out_info->actions.emplace_back(
-      PacketAction::RegisterWrite(reg_index_2, reg_data_2));
+  if (PacketAction* actions = AllocActions(arena, out_info, 2)) {
+    actions[0] = PacketAction::RegisterWrite(reg_index_1, reg_data_1);
+    actions[1] = PacketAction::RegisterWrite(reg_index_2, reg_data_2);
+  }
 
   return true;
 }
 
 bool PacketDisassembler::DisasmPacketType2(const uint8_t* base_ptr,
                                            uint32_t packet,
-                                           PacketInfo* out_info) {
+                                           PacketInfo* out_info, Arena* arena) {
   static const PacketTypeInfo type_2_info = {PacketCategory::kGeneric,
                                              "PM4_TYPE2"};
   out_info->type_info = &type_2_info;
@@ -104,7 +121,7 @@ bool PacketDisassembler::DisasmPacketType2(const uint8_t* base_ptr,
 
 bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
                                            uint32_t packet,
-                                           PacketInfo* out_info) {
+                                           PacketInfo* out_info, Arena* arena) {
   static const PacketTypeInfo type_3_unknown_info = {PacketCategory::kGeneric,
                                                      "PM4_TYPE3_UNKNOWN"};
   out_info->type_info = &type_3_unknown_info;
@@ -305,10 +322,11 @@ bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
           result = false;
           break;
       }
-      for (uint32_t n = 0; n < count - 1; n++, index++) {
-        uint32_t data = xe::load_and_swap<uint32_t>(ptr + 4 + n * 4);
-        out_info->actions.emplace_back(
-            PacketAction::RegisterWrite(index, data));
+      if (PacketAction* actions = AllocActions(arena, out_info, count - 1)) {
+        for (uint32_t n = 0; n < count - 1; n++, index++) {
+          uint32_t data = xe::load_and_swap<uint32_t>(ptr + 4 + n * 4);
+          actions[n] = PacketAction::RegisterWrite(index, data);
+        }
       }
       break;
     }
@@ -318,10 +336,11 @@ bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
       out_info->type_info = &op_info;
       uint32_t offset_type = xe::load_and_swap<uint32_t>(ptr + 0);
       uint32_t index = offset_type & 0xFFFF;
-      for (uint32_t n = 0; n < count - 1; n++, index++) {
-        uint32_t data = xe::load_and_swap<uint32_t>(ptr + 4 + n * 4);
-        out_info->actions.emplace_back(
-            PacketAction::RegisterWrite(index, data));
+      if (PacketAction* actions = AllocActions(arena, out_info, count - 1)) {
+        for (uint32_t n = 0; n < count - 1; n++, index++) {
+          uint32_t data = xe::load_and_swap<uint32_t>(ptr + 4 + n * 4);
+          actions[n] = PacketAction::RegisterWrite(index, data);
+        }
       }
       return true;
       break;
@@ -358,12 +377,13 @@ bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
           assert_always();
           return true;
       }
-      for (uint32_t n = 0; n < size_dwords; n++, index++) {
-        // Hrm, ?
-        // xe::load_and_swap<uint32_t>(membase_ + GpuToCpu(address + n * 4));
-        uint32_t data = 0xDEADBEEF;
-        out_info->actions.emplace_back(
-            PacketAction::RegisterWrite(index, data));
+      if (PacketAction* actions = AllocActions(arena, out_info, size_dwords)) {
+        for (uint32_t n = 0; n < size_dwords; n++, index++) {
+          // Hrm, ?
+          // xe::load_and_swap<uint32_t>(membase_ + GpuToCpu(address + n * 4));
+          uint32_t data = 0xDEADBEEF;
+          actions[n] = PacketAction::RegisterWrite(index, data);
+        }
       }
       break;
     }
@@ -373,10 +393,11 @@ bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
       out_info->type_info = &op_info;
       uint32_t offset_type = xe::load_and_swap<uint32_t>(ptr + 0);
       uint32_t index = offset_type & 0xFFFF;
-      for (uint32_t n = 0; n < count - 1; n++, index++) {
-        uint32_t data = xe::load_and_swap<uint32_t>(ptr + 4 + n * 4);
-        out_info->actions.emplace_back(
-            PacketAction::RegisterWrite(index, data));
+      if (PacketAction* actions = AllocActions(arena, out_info, count - 1)) {
+        for (uint32_t n = 0; n < count - 1; n++, index++) {
+          uint32_t data = xe::load_and_swap<uint32_t>(ptr + 4 + n * 4);
+          actions[n] = PacketAction::RegisterWrite(index, data);
+        }
       }
       return true;
     }
@@ -422,7 +443,9 @@ bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
       out_info->type_info = &op_info;
       uint32_t value = xe::load_and_swap<uint32_t>(ptr);
       // bin_mask_ = (bin_mask_ & 0xFFFFFFFF00000000ull) | value;
-      out_info->actions.emplace_back(PacketAction::SetBinMask(value));
+      if (PacketAction* actions = AllocActions(arena, out_info, 1)) {
+        actions[0] = PacketAction::SetBinMask(value);
+      }
       break;
     }
     case PM4_SET_BIN_MASK_HI: {
@@ -440,7 +463,9 @@ bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
       out_info->type_info = &op_info;
       uint32_t value = xe::load_and_swap<uint32_t>(ptr);
       // bin_select_ = (bin_select_ & 0xFFFFFFFF00000000ull) | value;
-      out_info->actions.emplace_back(PacketAction::SetBinSelect(value));
+      if (PacketAction* actions = AllocActions(arena, out_info, 1)) {
+        actions[0] = PacketAction::SetBinSelect(value);
+      }
       break;
     }
     case PM4_SET_BIN_SELECT_HI: {
@@ -477,18 +502,20 @@ bool PacketDisassembler::DisasmPacketType3(const uint8_t* base_ptr,
 }
 
 bool PacketDisassembler::DisasmPacket(const uint8_t* base_ptr,
-                                      PacketInfo* out_info) {
+                                      PacketInfo* out_info, Arena* arena) {
+  out_info->actions = nullptr;
+  out_info->action_count = 0;
   const uint32_t packet = xe::load_and_swap<uint32_t>(base_ptr);
   const uint32_t packet_type = packet >> 30;
   switch (packet_type) {
     case 0x00:
-      return DisasmPacketType0(base_ptr, packet, out_info);
+      return DisasmPacketType0(base_ptr, packet, out_info, arena);
     case 0x01:
-      return DisasmPacketType1(base_ptr, packet, out_info);
+      return DisasmPacketType1(base_ptr, packet, out_info, arena);
     case 0x02:
-      return DisasmPacketType2(base_ptr, packet, out_info);
+      return DisasmPacketType2(base_ptr, packet, out_info, arena);
     case 0x03:
-      return DisasmPacketType3(base_ptr, packet, out_info);
+      return DisasmPacketType3(base_ptr, packet, out_info, arena);
     default:
       assert_unhandled_case(packet_type);
       return false;
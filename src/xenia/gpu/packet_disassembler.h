@@ -10,8 +10,9 @@
 #ifndef XENIA_GPU_PACKET_DISASSEMBLER_H_
 #define XENIA_GPU_PACKET_DISASSEMBLER_H_
 
-#include <vector>
+#include <cstddef>
 
+#include "xenia/base/arena.h"
 #include "xenia/gpu/register_file.h"
 #include "xenia/gpu/trace_protocol.h"
 #include "xenia/gpu/trace_reader.h"
@@ -79,22 +80,31 @@ struct PacketInfo {
   const PacketTypeInfo* type_info;
   bool predicated;
   uint32_t count;
-  std::vector<PacketAction> actions;
+  // Disassembled actions, allocated from the arena passed to DisasmPacket and
+  // valid until it's reset. Null/zero when action materialization was skipped.
+  PacketAction* actions;
+  size_t action_count;
 };
 
+// Disassembly is allocation-free: actions are written into the caller-owned
+// arena, which the caller resets once per walked frame, and passing a null
+// arena skips action materialization entirely - enough for the packet name,
+// predication and size, so a UI can disassemble actions lazily for just the
+// packets it actually expands.
 class PacketDisassembler {
  public:
   static PacketCategory GetPacketCategory(const uint8_t* base_ptr);
 
   static bool DisasmPacketType0(const uint8_t* base_ptr, uint32_t packet,
-                                PacketInfo* out_info);
+                                PacketInfo* out_info, Arena* arena);
   static bool DisasmPacketType1(const uint8_t* base_ptr, uint32_t packet,
-                                PacketInfo* out_info);
+                                PacketInfo* out_info, Arena* arena);
   static bool DisasmPacketType2(const uint8_t* base_ptr, uint32_t packet,
-                                PacketInfo* out_info);
+                                PacketInfo* out_info, Arena* arena);
   static bool DisasmPacketType3(const uint8_t* base_ptr, uint32_t packet,
-                                PacketInfo* out_info);
-  static bool DisasmPacket(const uint8_t* base_ptr, PacketInfo* out_info);
+                                PacketInfo* out_info, Arena* arena);
+  static bool DisasmPacket(const uint8_t* base_ptr, PacketInfo* out_info,
+                           Arena* arena);
 };
 
 }  // namespace gpu
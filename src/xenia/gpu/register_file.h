@@ -42,6 +42,20 @@ class RegisterFile {
 
   RegisterValue& operator[](uint32_t reg) { return values[reg]; }
   RegisterValue& operator[](Register reg) { return values[reg]; }
+
+  // Wait-free cross-thread word access for the MMIO boundary: guest threads
+  // spin-poll single registers while the CP thread owns the file. Every
+  // register is an independent aligned 32-bit word, so a volatile word
+  // load/store is torn-free on the hosts we target and never blocks the
+  // writer - no lock (or multi-word seqlock) is needed at this granularity.
+  // CP-internal accesses stay plain; only the cross-thread endpoints route
+  // through these.
+  uint32_t ReadWord(uint32_t reg) const {
+    return *reinterpret_cast<const volatile uint32_t*>(&values[reg].u32);
+  }
+  void WriteWord(uint32_t reg, uint32_t value) {
+    *reinterpret_cast<volatile uint32_t*>(&values[reg].u32) = value;
+  }
   template <typename T>
   T& Get(uint32_t reg) {
     return *reinterpret_cast<T*>(&values[reg]);
@@ -9,6 +9,7 @@
 
 #include "xenia/gpu/shader.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 
@@ -16,6 +17,7 @@
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/string.h"
+#include "xenia/gpu/shader_translator.h"
 #include "xenia/gpu/ucode.h"
 
 namespace xe {
@@ -32,6 +34,25 @@ Shader::Shader(ShaderType shader_type, uint64_t ucode_data_hash,
 
 Shader::~Shader() = default;
 
+const std::string& Shader::ucode_disassembly() {
+  if (ucode_disassembly_.empty() && !ucode_data_.empty()) {
+    // Translation skips disassembly, so generate it here on the first
+    // request and keep it for later ones. The pass runs on a throwaway
+    // shader so it can't disturb the translation state of this one. The
+    // constructor byte swaps to host endianness, so hand the throwaway
+    // guest-endian words again.
+    std::vector<uint32_t> guest_dwords(ucode_data_.size());
+    xe::copy_and_swap(guest_dwords.data(), ucode_data_.data(),
+                      ucode_data_.size());
+    Shader scratch_shader(shader_type_, ucode_data_hash_, guest_dwords.data(),
+                          guest_dwords.size());
+    UcodeShaderTranslator translator;
+    translator.Translate(&scratch_shader, PrimitiveType::kNone);
+    ucode_disassembly_ = std::move(scratch_shader.ucode_disassembly_);
+  }
+  return ucode_disassembly_;
+}
+
 std::string Shader::GetTranslatedBinaryString() const {
   std::string result;
   result.resize(translated_binary_.size());
@@ -86,5 +107,210 @@ std::pair<std::string, std::string> Shader::Dump(const std::string& base_path,
   return {std::string(txt_file_name), std::string(bin_file_name)};
 }
 
+namespace {
+
+// opcode_name in parsed fetch instructions points to string literals chosen
+// during ucode parsing - instructions restored from data serialized by a
+// previous run must have the pointers re-resolved in this process.
+const char* GetTextureFetchOpcodeName(FetchOpcode opcode,
+                                      TextureDimension dimension) {
+  int dimension_index =
+      std::min(static_cast<int>(dimension), int(TextureDimension::kCube));
+  switch (opcode) {
+    case FetchOpcode::kTextureFetch: {
+      static const char* kNames[] = {"tfetch1D", "tfetch2D", "tfetch3D",
+                                     "tfetchCube"};
+      return kNames[dimension_index];
+    }
+    case FetchOpcode::kGetTextureBorderColorFrac: {
+      static const char* kNames[] = {"getBCF1D", "getBCF2D", "getBCF3D",
+                                     "getBCFCube"};
+      return kNames[dimension_index];
+    }
+    case FetchOpcode::kGetTextureComputedLod: {
+      static const char* kNames[] = {"getCompTexLOD1D", "getCompTexLOD2D",
+                                     "getCompTexLOD3D", "getCompTexLODCube"};
+      return kNames[dimension_index];
+    }
+    case FetchOpcode::kGetTextureGradients:
+      return "getGradients";
+    case FetchOpcode::kGetTextureWeights: {
+      static const char* kNames[] = {"getWeights1D", "getWeights2D",
+                                     "getWeights3D", "getWeightsCube"};
+      return kNames[dimension_index];
+    }
+    case FetchOpcode::kSetTextureLod:
+      return "setTexLOD";
+    case FetchOpcode::kSetTextureGradientsHorz:
+      return "setGradientH";
+    case FetchOpcode::kSetTextureGradientsVert:
+      return "setGradientV";
+    default:
+      return "tfetch?";
+  }
+}
+
+}  // namespace
+
+bool Shader::SerializeTranslation(std::vector<uint8_t>& data_out) const {
+  if (!is_translated_ || !is_valid_) {
+    return false;
+  }
+  auto append = [&data_out](const void* data, size_t size) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    data_out.insert(data_out.end(), bytes, bytes + size);
+  };
+  auto append_uint32 = [&append](uint32_t value) { append(&value, 4); };
+
+  append_uint32(uint32_t(patch_primitive_type_));
+  uint32_t flags = 0;
+  for (uint32_t i = 0; i < 4; ++i) {
+    flags |= (writes_color_targets_[i] ? 1 : 0) << i;
+  }
+  flags |= (writes_depth_ ? 1 : 0) << 4;
+  flags |= (implicit_early_z_allowed_ ? 1 : 0) << 5;
+  append_uint32(flags);
+  append(&constant_register_map_, sizeof(constant_register_map_));
+
+  append_uint32(uint32_t(vertex_bindings_.size()));
+  for (const VertexBinding& vertex_binding : vertex_bindings_) {
+    append_uint32(uint32_t(vertex_binding.binding_index));
+    append_uint32(vertex_binding.fetch_constant);
+    append_uint32(vertex_binding.stride_words);
+    append_uint32(uint32_t(vertex_binding.attributes.size()));
+    for (const VertexBinding::Attribute& attribute :
+         vertex_binding.attributes) {
+      append(&attribute, sizeof(attribute));
+    }
+  }
+
+  append_uint32(uint32_t(texture_bindings_.size()));
+  for (const TextureBinding& texture_binding : texture_bindings_) {
+    append_uint32(uint32_t(texture_binding.binding_index));
+    append_uint32(texture_binding.fetch_constant);
+    append(&texture_binding.fetch_instr, sizeof(texture_binding.fetch_instr));
+  }
+
+  append_uint32(uint32_t(memexport_stream_constants_.size()));
+  if (!memexport_stream_constants_.empty()) {
+    append(memexport_stream_constants_.data(),
+           sizeof(uint32_t) * memexport_stream_constants_.size());
+  }
+
+  append_uint32(uint32_t(translated_binary_.size()));
+  if (!translated_binary_.empty()) {
+    append(translated_binary_.data(), translated_binary_.size());
+  }
+
+  return true;
+}
+
+size_t Shader::DeserializeTranslation(const void* data, size_t data_size) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  size_t offset = 0;
+  auto read = [bytes, data_size, &offset](void* out, size_t size) -> bool {
+    if (data_size - offset < size) {
+      return false;
+    }
+    std::memcpy(out, bytes + offset, size);
+    offset += size;
+    return true;
+  };
+  auto read_uint32 = [&read](uint32_t& value_out) -> bool {
+    return read(&value_out, 4);
+  };
+
+  // Parse everything into locals first so a truncated blob doesn't leave the
+  // shader partially restored.
+  uint32_t patch_primitive_type, flags;
+  ConstantRegisterMap constant_register_map;
+  if (!read_uint32(patch_primitive_type) || !read_uint32(flags) ||
+      !read(&constant_register_map, sizeof(constant_register_map))) {
+    return 0;
+  }
+
+  uint32_t vertex_binding_count;
+  if (!read_uint32(vertex_binding_count) || vertex_binding_count > 96) {
+    return 0;
+  }
+  std::vector<VertexBinding> vertex_bindings(vertex_binding_count);
+  for (VertexBinding& vertex_binding : vertex_bindings) {
+    uint32_t binding_index, attribute_count;
+    if (!read_uint32(binding_index) ||
+        !read_uint32(vertex_binding.fetch_constant) ||
+        !read_uint32(vertex_binding.stride_words) ||
+        !read_uint32(attribute_count) || attribute_count > 0x10000) {
+      return 0;
+    }
+    vertex_binding.binding_index = int(binding_index);
+    vertex_binding.attributes.resize(attribute_count);
+    for (VertexBinding::Attribute& attribute : vertex_binding.attributes) {
+      if (!read(&attribute, sizeof(attribute))) {
+        return 0;
+      }
+      attribute.fetch_instr.opcode_name =
+          attribute.fetch_instr.is_mini_fetch ? "vfetch_mini" : "vfetch_full";
+    }
+  }
+
+  uint32_t texture_binding_count;
+  if (!read_uint32(texture_binding_count) || texture_binding_count > 0x10000) {
+    return 0;
+  }
+  std::vector<TextureBinding> texture_bindings(texture_binding_count);
+  for (TextureBinding& texture_binding : texture_bindings) {
+    uint32_t binding_index;
+    if (!read_uint32(binding_index) ||
+        !read_uint32(texture_binding.fetch_constant) ||
+        !read(&texture_binding.fetch_instr,
+              sizeof(texture_binding.fetch_instr))) {
+      return 0;
+    }
+    texture_binding.binding_index = binding_index;
+    texture_binding.fetch_instr.opcode_name = GetTextureFetchOpcodeName(
+        texture_binding.fetch_instr.opcode,
+        texture_binding.fetch_instr.dimension);
+  }
+
+  uint32_t memexport_stream_constant_count;
+  if (!read_uint32(memexport_stream_constant_count) ||
+      memexport_stream_constant_count > 0x10000) {
+    return 0;
+  }
+  std::vector<uint32_t> memexport_stream_constants(
+      memexport_stream_constant_count);
+  if (memexport_stream_constant_count &&
+      !read(memexport_stream_constants.data(),
+            sizeof(uint32_t) * memexport_stream_constant_count)) {
+    return 0;
+  }
+
+  uint32_t translated_binary_size;
+  if (!read_uint32(translated_binary_size)) {
+    return 0;
+  }
+  std::vector<uint8_t> translated_binary(translated_binary_size);
+  if (translated_binary_size &&
+      !read(translated_binary.data(), translated_binary_size)) {
+    return 0;
+  }
+
+  patch_primitive_type_ = PrimitiveType(patch_primitive_type);
+  for (uint32_t i = 0; i < 4; ++i) {
+    writes_color_targets_[i] = (flags & (1 << i)) != 0;
+  }
+  writes_depth_ = (flags & (1 << 4)) != 0;
+  implicit_early_z_allowed_ = (flags & (1 << 5)) != 0;
+  constant_register_map_ = constant_register_map;
+  vertex_bindings_ = std::move(vertex_bindings);
+  texture_bindings_ = std::move(texture_bindings);
+  memexport_stream_constants_ = std::move(memexport_stream_constants);
+  translated_binary_ = std::move(translated_binary);
+  errors_.clear();
+  is_valid_ = true;
+  is_translated_ = true;
+  return offset;
+}
+
 }  //  namespace gpu
 }  //  namespace xe
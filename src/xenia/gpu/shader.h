@@ -641,8 +641,9 @@ class Shader {
   // Errors that occurred during translation.
   const std::vector<Error>& errors() const { return errors_; }
 
-  // Microcode disassembly in D3D format.
-  const std::string& ucode_disassembly() const { return ucode_disassembly_; }
+  // Microcode disassembly in D3D format. Generated lazily on the first
+  // request (translation skips it) and cached on the shader afterwards.
+  const std::string& ucode_disassembly();
 
   // Translated shader binary (or text).
   const std::vector<uint8_t>& translated_binary() const {
@@ -669,6 +670,20 @@ class Shader {
   std::pair<std::string, std::string> Dump(const std::string& base_path,
                                            const char* path_prefix);
 
+  // Appends the results of a successful translation (the translated binary,
+  // the bindings and the register maps) to data_out, so a later run can
+  // restore them with DeserializeTranslation without invoking the shader
+  // translator. The ucode and host disassembly are not included. Returns false
+  // if the shader doesn't have a valid translation to serialize.
+  virtual bool SerializeTranslation(std::vector<uint8_t>& data_out) const;
+  // Restores translation results previously written by SerializeTranslation,
+  // marking the shader as translated and valid. Returns the number of bytes
+  // consumed, or 0 if the data is truncated or malformed - in this case the
+  // shader is left untranslated and the caller should fall back to translating
+  // the ucode. The caller is responsible for versioning the serialized data -
+  // the format is not self-describing.
+  virtual size_t DeserializeTranslation(const void* data, size_t data_size);
+
  protected:
   friend class ShaderTranslator;
 
@@ -44,7 +44,8 @@ using namespace ucode;
 
 constexpr uint32_t ShaderTranslator::kMaxMemExports;
 
-ShaderTranslator::ShaderTranslator() = default;
+ShaderTranslator::ShaderTranslator(bool ucode_disasm_enabled)
+    : ucode_disasm_enabled_(ucode_disasm_enabled) {}
 
 ShaderTranslator::~ShaderTranslator() = default;
 
@@ -193,7 +194,9 @@ bool ShaderTranslator::TranslateInternal(Shader* shader,
 
   shader->errors_ = std::move(errors_);
   shader->translated_binary_ = CompleteTranslation();
-  shader->ucode_disassembly_ = ucode_disasm_buffer_.to_string();
+  if (ucode_disasm_enabled_) {
+    shader->ucode_disassembly_ = ucode_disasm_buffer_.to_string();
+  }
   shader->patch_primitive_type_ = patch_primitive_type_;
   shader->vertex_bindings_ = std::move(vertex_bindings_);
   shader->texture_bindings_ = std::move(texture_bindings_);
@@ -223,6 +226,9 @@ bool ShaderTranslator::TranslateInternal(Shader* shader,
 }
 
 void ShaderTranslator::MarkUcodeInstruction(uint32_t dword_offset) {
+  if (!ucode_disasm_enabled_) {
+    return;
+  }
   auto disasm = ucode_disasm_buffer_.GetString();
   size_t current_offset = ucode_disasm_buffer_.length();
   for (size_t i = previous_ucode_disasm_scan_offset_; i < current_offset; ++i) {
@@ -234,14 +240,23 @@ void ShaderTranslator::MarkUcodeInstruction(uint32_t dword_offset) {
 }
 
 void ShaderTranslator::AppendUcodeDisasm(char c) {
+  if (!ucode_disasm_enabled_) {
+    return;
+  }
   ucode_disasm_buffer_.Append(c);
 }
 
 void ShaderTranslator::AppendUcodeDisasm(const char* value) {
+  if (!ucode_disasm_enabled_) {
+    return;
+  }
   ucode_disasm_buffer_.Append(value);
 }
 
 void ShaderTranslator::AppendUcodeDisasmFormat(const char* format, ...) {
+  if (!ucode_disasm_enabled_) {
+    return;
+  }
   va_list va;
   va_start(va, format);
   ucode_disasm_buffer_.AppendVarargs(format, va);
@@ -632,7 +647,9 @@ void ShaderTranslator::TranslateControlFlowInstruction(
 
 void ShaderTranslator::TranslateControlFlowNop(
     const ControlFlowInstruction& cf) {
-  ucode_disasm_buffer_.Append("      cnop\n");
+  if (ucode_disasm_enabled_) {
+    ucode_disasm_buffer_.Append("      cnop\n");
+  }
 
   ProcessControlFlowNopInstruction(cf_index_);
 }
@@ -718,7 +735,9 @@ void ShaderTranslator::TranslateControlFlowLoopStart(
   i.is_repeat = cf.is_repeat();
   i.loop_skip_address = cf.address();
 
-  i.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    i.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessLoopStartInstruction(i);
 }
@@ -733,7 +752,9 @@ void ShaderTranslator::TranslateControlFlowLoopEnd(
   constant_register_map_.int_bitmap |= 1 << i.loop_constant_index;
   i.loop_body_address = cf.address();
 
-  i.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    i.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessLoopEndInstruction(i);
 }
@@ -756,7 +777,9 @@ void ShaderTranslator::TranslateControlFlowCondCall(
     i.condition = cf.condition();
   }
 
-  i.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    i.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessCallInstruction(i);
 }
@@ -766,7 +789,9 @@ void ShaderTranslator::TranslateControlFlowReturn(
   ParsedReturnInstruction i;
   i.dword_index = cf_index_;
 
-  i.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    i.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessReturnInstruction(i);
 }
@@ -789,7 +814,9 @@ void ShaderTranslator::TranslateControlFlowCondJmp(
     i.condition = cf.condition();
   }
 
-  i.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    i.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessJumpInstruction(i);
 }
@@ -802,14 +829,18 @@ void ShaderTranslator::TranslateControlFlowAlloc(
   i.count = cf.size();
   i.is_vertex_shader = is_vertex_shader();
 
-  i.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    i.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessAllocInstruction(i);
 }
 
 void ShaderTranslator::TranslateExecInstructions(
     const ParsedExecInstruction& instr) {
-  instr.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    instr.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessExecInstructionBegin(instr);
 
@@ -877,7 +908,9 @@ void ShaderTranslator::TranslateVertexFetchInstruction(
     const VertexFetchInstruction& op) {
   ParsedVertexFetchInstruction instr;
   ParseVertexFetchInstruction(op, &instr);
-  instr.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    instr.Disassemble(&ucode_disasm_buffer_);
+  }
   ProcessVertexFetchInstruction(instr);
 }
 
@@ -934,7 +967,9 @@ void ShaderTranslator::TranslateTextureFetchInstruction(
     const TextureFetchInstruction& op) {
   ParsedTextureFetchInstruction instr;
   ParseTextureFetchInstruction(op, &instr);
-  instr.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    instr.Disassemble(&ucode_disasm_buffer_);
+  }
   ProcessTextureFetchInstruction(instr);
 }
 
@@ -1148,7 +1183,9 @@ void ShaderTranslator::TranslateAluInstruction(const AluInstruction& op) {
   ParseAluVectorOperation(op, instr);
   ParseAluScalarOperation(op, instr);
 
-  instr.Disassemble(&ucode_disasm_buffer_);
+  if (ucode_disasm_enabled_) {
+    instr.Disassemble(&ucode_disasm_buffer_);
+  }
 
   ProcessAluInstruction(instr);
 }
@@ -38,7 +38,10 @@ class ShaderTranslator {
   bool Translate(Shader* shader, PrimitiveType patch_type);
 
  protected:
-  ShaderTranslator();
+  // Disassembling every shader costs real time even when nothing will ever
+  // display it, so ucode disassembly accumulation is opt-in; shaders
+  // disassemble themselves lazily on first request instead.
+  explicit ShaderTranslator(bool ucode_disasm_enabled = false);
 
   // Resets translator state before beginning translation.
   virtual void Reset();
@@ -101,7 +104,8 @@ class ShaderTranslator {
 
   // Current line number in the ucode disassembly.
   size_t ucode_disasm_line_number() const { return ucode_disasm_line_number_; }
-  // Ucode disassembly buffer accumulated during translation.
+  // Ucode disassembly buffer accumulated during translation. Empty unless
+  // the translator was constructed with ucode disassembly enabled.
   StringBuffer& ucode_disasm_buffer() { return ucode_disasm_buffer_; }
   // Emits a translation error that will be passed back in the result.
   virtual void EmitTranslationError(const char* message);
@@ -242,7 +246,10 @@ class ShaderTranslator {
   // Current control flow dword index.
   uint32_t cf_index_ = 0;
 
+  // Whether ucode disassembly is accumulated during translation.
+  bool ucode_disasm_enabled_;
   // Microcode disassembly buffer, accumulated throughout the translation.
+  // The buffer storage is reused across translations on this translator.
   StringBuffer ucode_disasm_buffer_;
   // Current line number in the disasm, which can be used for source annotation.
   size_t ucode_disasm_line_number_ = 0;
@@ -278,7 +285,7 @@ class ShaderTranslator {
 
 class UcodeShaderTranslator : public ShaderTranslator {
  public:
-  UcodeShaderTranslator() = default;
+  UcodeShaderTranslator() : ShaderTranslator(true) {}
 
  protected:
   std::vector<uint8_t> CompleteTranslation() override;
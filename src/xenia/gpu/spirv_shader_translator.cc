@@ -391,11 +391,14 @@ void SpirvShaderTranslator::StartTranslation() {
       b.createNoResultOp(spv::Op::OpCopyMemory, std::vector<Id>({r_a, i_a}));
     }
 
-    // Setup ps_param_gen
-    auto ps_param_gen_idx_ptr = b.createAccessChain(
-        spv::StorageClass::StorageClassPushConstant, push_consts_,
-        std::vector<Id>({b.makeUintConstant(5)}));
-    auto ps_param_gen_idx = b.createLoad(ps_param_gen_idx_ptr);
+    // Setup ps_param_gen. The interpolator index is a specialization constant
+    // rather than a push constant read so the driver can fold all of the
+    // selects below away at pipeline creation once the real index (or
+    // 0xFFFFFFFF when PsParamGen is disabled) is known - without requiring a
+    // retranslation per variant.
+    auto ps_param_gen_idx = b.makeUintConstant(0xFFFFFFFFu, true);
+    b.addDecoration(ps_param_gen_idx, spv::Decoration::DecorationSpecId,
+                    kSpirvSpecConstPsParamGen);
 
     auto frag_coord = b.createVariable(spv::StorageClass::StorageClassInput,
                                        vec4_float_type_, "gl_FragCoord");
@@ -53,6 +53,15 @@ constexpr uint32_t kSpirvPushConstantFragmentRangeSize =
     (sizeof(float) * 4) + sizeof(uint32_t);
 constexpr uint32_t kSpirvPushConstantsSize = sizeof(SpirvPushConstants);
 
+// Specialization constant IDs for values that would otherwise be baked into
+// the generated code per variant. One translated module covers all variants -
+// the pipeline cache supplies the actual values at pipeline creation time
+// through VkSpecializationInfo.
+// Fragment shader: interpolator index to replace with the pixel parameters
+// (point coordinates and screen position), or 0xFFFFFFFF when PsParamGen is
+// disabled.
+constexpr uint32_t kSpirvSpecConstPsParamGen = 0;
+
 class SpirvShaderTranslator : public ShaderTranslator {
  public:
   SpirvShaderTranslator();
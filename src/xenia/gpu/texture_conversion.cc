@@ -13,6 +13,10 @@
 #include <cmath>
 #include <cstring>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
@@ -108,6 +112,100 @@ static uint32_t TiledOffset2DColumn(uint32_t x, uint32_t y, uint32_t log2_bpp,
          ((y & 16) << 7) + (((((y & 8) >> 2) + (x >> 3)) & 3) << 6);
 }
 
+namespace {
+
+// Precomputed untiling layout of one (offset, size, pitch, bpp) tuple. The
+// tiled offset math depends only on the layout, not on the texel data, so
+// it's evaluated once here and every subsequent upload of a texture with the
+// same layout walks a flat run list instead of redoing the address scramble
+// per block. Runs are maximal spans of blocks with consecutive tiled offsets
+// (within a micro-tile they form 16-byte spans).
+struct UntileLayout {
+  struct Run {
+    uint32_t input_block_offset;
+    uint16_t output_x;
+    uint16_t output_y;
+    uint32_t block_count;
+  };
+  std::vector<Run> runs;
+};
+
+struct UntileLayoutKey {
+  uint32_t offset_x;
+  uint32_t offset_y;
+  uint32_t width;
+  uint32_t height;
+  uint32_t input_pitch;
+  uint32_t log2_bpp;
+};
+
+std::mutex untile_layout_mutex;
+std::unordered_map<uint64_t, std::shared_ptr<UntileLayout>> untile_layouts;
+// Games cycle through a bounded set of texture layouts; if the cache somehow
+// outgrows this, dropping it only costs rebuilding the layouts still in use.
+constexpr size_t kUntileLayoutCacheCapacity = 128;
+
+std::shared_ptr<UntileLayout> GetUntileLayout(const UntileInfo* untile_info,
+                                              uint32_t log2_bpp) {
+  UntileLayoutKey key = {};
+  key.offset_x = untile_info->offset_x;
+  key.offset_y = untile_info->offset_y;
+  key.width = untile_info->width;
+  key.height = untile_info->height;
+  key.input_pitch = untile_info->input_pitch;
+  key.log2_bpp = log2_bpp;
+  uint64_t key_hash = XXH64(&key, sizeof(key), 0);
+  {
+    std::lock_guard<std::mutex> lock(untile_layout_mutex);
+    auto it = untile_layouts.find(key_hash);
+    if (it != untile_layouts.end()) {
+      return it->second;
+    }
+  }
+
+  // Built outside the lock - concurrent builders of the same layout would
+  // just produce identical tables, the last one winning.
+  auto layout = std::make_shared<UntileLayout>();
+  for (uint32_t y = 0; y < key.height; y++) {
+    uint32_t input_row_offset =
+        TiledOffset2DRow(key.offset_y + y, key.input_pitch, log2_bpp);
+    uint32_t run_input_offset = 0;
+    uint32_t run_start_x = 0;
+    uint32_t run_length = 0;
+    for (uint32_t x = 0; x < key.width; x++) {
+      uint32_t input_offset = TiledOffset2DColumn(
+          key.offset_x + x, key.offset_y + y, log2_bpp, input_row_offset);
+      input_offset >>= log2_bpp;
+      if (run_length != 0 && input_offset == run_input_offset + run_length) {
+        ++run_length;
+      } else {
+        if (run_length != 0) {
+          layout->runs.push_back({run_input_offset, uint16_t(run_start_x),
+                                  uint16_t(y), run_length});
+        }
+        run_input_offset = input_offset;
+        run_start_x = x;
+        run_length = 1;
+      }
+    }
+    if (run_length != 0) {
+      layout->runs.push_back(
+          {run_input_offset, uint16_t(run_start_x), uint16_t(y), run_length});
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(untile_layout_mutex);
+    if (untile_layouts.size() >= kUntileLayoutCacheCapacity) {
+      untile_layouts.clear();
+    }
+    untile_layouts[key_hash] = layout;
+  }
+  return layout;
+}
+
+}  // namespace
+
 void Untile(uint8_t* output_buffer, const uint8_t* input_buffer,
             const UntileInfo* untile_info) {
   SCOPE_profile_cpu_f("gpu");
@@ -125,30 +223,39 @@ void Untile(uint8_t* output_buffer, const uint8_t* input_buffer,
   auto log2_bpp = (input_bytes_per_block / 4) +
                   ((input_bytes_per_block / 2) >> (input_bytes_per_block / 4));
 
-  // Offset to the current row, in bytes.
-  uint32_t output_row_offset = 0;
-  for (uint32_t y = 0; y < untile_info->height; y++) {
-    auto input_row_offset = TiledOffset2DRow(
-        untile_info->offset_y + y, untile_info->input_pitch, log2_bpp);
-
-    // Go block-by-block on this row.
-    uint32_t output_offset = output_row_offset;
+  std::shared_ptr<UntileLayout> layout = GetUntileLayout(untile_info, log2_bpp);
 
-    for (uint32_t x = 0; x < untile_info->width; x++) {
-      auto input_offset = TiledOffset2DColumn(untile_info->offset_x + x,
-                                              untile_info->offset_y + y,
-                                              log2_bpp, input_row_offset);
-      input_offset >>= log2_bpp;
+  if (untile_info->copy_is_plain_swap &&
+      input_bytes_per_block == output_bytes_per_block) {
+    // Fast path for formats that are copied 1:1 - every run goes through the
+    // vectorized swap routines in one call, so untiling is a table-driven
+    // streaming copy.
+    Endian endian = untile_info->endianness;
+    for (const UntileLayout::Run& run : layout->runs) {
+      CopySwapBlock(endian,
+                    &output_buffer[run.output_y * output_pitch +
+                                   run.output_x * output_bytes_per_block],
+                    &input_buffer[run.input_block_offset *
+                                  input_bytes_per_block],
+                    run.block_count * output_bytes_per_block);
+    }
+    return;
+  }
 
+  // Texel conversion - still block-by-block through the callback, but with
+  // the tiled offsets read from the layout table.
+  for (const UntileLayout::Run& run : layout->runs) {
+    uint32_t output_offset =
+        run.output_y * output_pitch + run.output_x * output_bytes_per_block;
+    uint32_t input_block_offset = run.input_block_offset;
+    for (uint32_t i = 0; i < run.block_count; ++i) {
       untile_info->copy_callback(
           &output_buffer[output_offset],
-          &input_buffer[input_offset * input_bytes_per_block],
+          &input_buffer[input_block_offset * input_bytes_per_block],
           output_bytes_per_block);
-
       output_offset += output_bytes_per_block;
+      ++input_block_offset;
     }
-
-    output_row_offset += output_pitch;
   }
 }
 
@@ -44,6 +44,13 @@ typedef struct UntileInfo {
   const FormatInfo* input_format_info;
   const FormatInfo* output_format_info;
   UntileCopyBlockCallback copy_callback;
+  // When the block copy is a plain CopySwapBlock (no texel conversion),
+  // setting this along with the source endianness lets Untile merge blocks
+  // with consecutive tiled offsets into single swap-copies that go through
+  // the vectorized copy_and_swap routines, instead of invoking copy_callback
+  // once per block.
+  bool copy_is_plain_swap;
+  Endian endianness;
 } UntileInfo;
 
 void Untile(uint8_t* output_buffer, const uint8_t* input_buffer,
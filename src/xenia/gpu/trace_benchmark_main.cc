@@ -0,0 +1,133 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2019 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/main.h"
+#include "xenia/base/platform.h"
+#include "xenia/base/string.h"
+#include "xenia/emulator.h"
+#include "xenia/gpu/command_processor.h"
+#include "xenia/gpu/graphics_system.h"
+#include "xenia/gpu/trace_player.h"
+
+// Available graphics systems:
+#include "xenia/gpu/null/null_graphics_system.h"
+#include "xenia/gpu/vk/vulkan_graphics_system.h"
+#include "xenia/gpu/vulkan/vulkan_graphics_system.h"
+#if XE_PLATFORM_WIN32
+#include "xenia/gpu/d3d12/d3d12_graphics_system.h"
+#endif  // XE_PLATFORM_WIN32
+
+DEFINE_string(target_trace_file, "", "Specifies the trace file to load.",
+              "GPU");
+DEFINE_string(gpu, "null",
+              "Graphics system to replay through. Use: [d3d12, vulkan, vk, "
+              "null]",
+              "GPU");
+DEFINE_int32(benchmark_iterations, 10,
+             "Number of times the trace is replayed. The first iteration "
+             "includes shader translation and cache population - discard it "
+             "when measuring steady-state throughput.",
+             "GPU");
+
+namespace xe {
+namespace gpu {
+
+std::unique_ptr<GraphicsSystem> CreateGraphicsSystem() {
+#if XE_PLATFORM_WIN32
+  if (cvars::gpu.compare("d3d12") == 0) {
+    return std::unique_ptr<GraphicsSystem>(new d3d12::D3D12GraphicsSystem());
+  }
+#endif  // XE_PLATFORM_WIN32
+  if (cvars::gpu.compare("vulkan") == 0) {
+    return std::unique_ptr<GraphicsSystem>(new vulkan::VulkanGraphicsSystem());
+  }
+  if (cvars::gpu.compare("vk") == 0) {
+    return std::unique_ptr<GraphicsSystem>(new vk::VulkanGraphicsSystem());
+  }
+  if (cvars::gpu.compare("null") == 0) {
+    return std::unique_ptr<GraphicsSystem>(new null::NullGraphicsSystem());
+  }
+  XELOGE("Unknown graphics system: %s", cvars::gpu.c_str());
+  return nullptr;
+}
+
+int trace_benchmark_main(const std::vector<std::wstring>& args) {
+  // Grab path from the flag or unnamed argument.
+  std::wstring path;
+  if (!cvars::target_trace_file.empty()) {
+    path = xe::to_wstring(cvars::target_trace_file);
+  } else if (args.size() >= 2) {
+    path = args[1];
+  }
+  if (path.empty()) {
+    XELOGE("No trace file specified");
+    return 5;
+  }
+  auto abs_path = xe::to_absolute_path(path);
+  XELOGI("Loading trace file %ls...", abs_path.c_str());
+
+  auto emulator = std::make_unique<Emulator>(L"", L"");
+  X_STATUS result = emulator->Setup(
+      nullptr, nullptr, []() { return CreateGraphicsSystem(); }, nullptr);
+  if (XFAILED(result)) {
+    XELOGE("Failed to setup emulator: %.8X", result);
+    return 4;
+  }
+  GraphicsSystem* graphics_system = emulator->graphics_system();
+  auto player = std::make_unique<TracePlayer>(nullptr, graphics_system);
+  if (!player->Open(abs_path)) {
+    XELOGE("Could not load trace file");
+    return 5;
+  }
+
+  CommandProcessor* command_processor = graphics_system->command_processor();
+  int32_t iteration_count = std::max(cvars::benchmark_iterations, 1);
+  uint64_t tick_frequency = Clock::QueryHostTickFrequency();
+  int frame_count = player->frame_count();
+
+  // Results go to stdout as CSV so they can be diffed and plotted directly;
+  // everything else goes through the log.
+  printf("iteration,time_ms,frames,packets,draws,packets_per_sec");
+  printf(",draws_per_sec\n");
+  for (int32_t iteration = 0; iteration < iteration_count; ++iteration) {
+    command_processor->ResetStatistics();
+    uint64_t start_ticks = Clock::QueryHostTickCount();
+    for (int frame = 0; frame < frame_count; ++frame) {
+      player->SeekFrame(frame);
+      player->WaitOnPlayback();
+    }
+    uint64_t elapsed_ticks =
+        std::max(Clock::QueryHostTickCount() - start_ticks, uint64_t(1));
+    double elapsed_seconds = double(elapsed_ticks) / double(tick_frequency);
+    uint64_t packets = command_processor->packets_executed();
+    uint64_t draws = command_processor->draws_issued();
+    printf("%" PRId32 ",%.3f,%d,%" PRIu64 ",%" PRIu64 ",%.0f,%.0f\n",
+           iteration, elapsed_seconds * 1000.0, frame_count, packets, draws,
+           double(packets) / elapsed_seconds, double(draws) / elapsed_seconds);
+  }
+
+  player.reset();
+  emulator.reset();
+  return 0;
+}
+
+}  // namespace gpu
+}  // namespace xe
+
+DEFINE_ENTRY_POINT(L"xenia-gpu-trace-benchmark", xe::gpu::trace_benchmark_main,
+                   "some.trace", "target_trace_file");
@@ -9,7 +9,14 @@
 
 #include "xenia/gpu/trace_dump.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
 #include "third_party/stb/stb_image_write.h"
+#include "third_party/xxhash/xxhash.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/profiling.h"
 #include "xenia/base/string.h"
@@ -29,6 +36,12 @@
 DEFINE_string(target_trace_file, "", "Specifies the trace file to load.",
               "GPU");
 DEFINE_string(trace_dump_path, "", "Output path for dumped files.", "GPU");
+DEFINE_string(target_trace_folder, "",
+              "Specifies a folder of .xtr files to replay in batch benchmark "
+              "mode - every trace in the folder is replayed headlessly, with "
+              "one CSV row per trace (replay time, packet and draw counts, "
+              "framebuffer hash) written to stdout for regression diffing.",
+              "GPU");
 
 namespace xe {
 namespace gpu {
@@ -40,6 +53,15 @@ TraceDump::TraceDump() = default;
 TraceDump::~TraceDump() = default;
 
 int TraceDump::Main(const std::vector<std::wstring>& args) {
+  if (!cvars::target_trace_folder.empty()) {
+    if (!Setup()) {
+      XELOGE("Unable to setup trace dump tool");
+      return 4;
+    }
+    return RunBatch(xe::to_absolute_path(
+        xe::fix_path_separators(xe::to_wstring(cvars::target_trace_folder))));
+  }
+
   // Grab path from the flag or unnamed argument.
   std::wstring path;
   std::wstring output_path;
@@ -151,5 +173,74 @@ int TraceDump::Run() {
   return result;
 }
 
+int TraceDump::RunBatch(const std::wstring& folder) {
+  std::vector<std::wstring> trace_paths;
+  for (const auto& entry : xe::filesystem::ListFiles(folder)) {
+    if (entry.type != xe::filesystem::FileInfo::Type::kFile) {
+      continue;
+    }
+    auto last_dot = entry.name.find_last_of(L'.');
+    if (last_dot == std::wstring::npos ||
+        entry.name.substr(last_dot) != L".xtr") {
+      continue;
+    }
+    trace_paths.push_back(xe::join_paths(entry.path, entry.name));
+  }
+  // Results must be diffable between runs regardless of the directory order.
+  std::sort(trace_paths.begin(), trace_paths.end());
+  if (trace_paths.empty()) {
+    XELOGE("No trace files found in %ls", folder.c_str());
+    return 5;
+  }
+
+  CommandProcessor* command_processor = graphics_system_->command_processor();
+  uint64_t tick_frequency = Clock::QueryHostTickFrequency();
+
+  // The hash is of the raw captured framebuffer rather than of the PNG so it
+  // doesn't depend on the encoder.
+  printf("trace,frames,time_ms,ms_per_frame,packets,draws,framebuffer_hash\n");
+  int failed_count = 0;
+  for (const auto& trace_path : trace_paths) {
+    if (!player_->Open(trace_path)) {
+      XELOGE("Could not load trace file %ls", trace_path.c_str());
+      ++failed_count;
+      continue;
+    }
+    BeginHostCapture();
+    command_processor->ResetStatistics();
+    uint64_t start_ticks = Clock::QueryHostTickCount();
+    int frame_count = player_->frame_count();
+    for (int frame = 0; frame < frame_count; ++frame) {
+      player_->SeekFrame(frame);
+      player_->WaitOnPlayback();
+    }
+    uint64_t elapsed_ticks =
+        std::max(Clock::QueryHostTickCount() - start_ticks, uint64_t(1));
+    EndHostCapture();
+    double time_ms = double(elapsed_ticks) * 1000.0 / double(tick_frequency);
+    uint64_t framebuffer_hash = 0;
+    auto raw_image = graphics_system_->Capture();
+    if (raw_image) {
+      framebuffer_hash =
+          XXH64(raw_image->data.data(), raw_image->data.size(), 0);
+    } else {
+      ++failed_count;
+    }
+    std::string trace_name =
+        xe::to_string(xe::find_name_from_path(trace_path));
+    printf("%s,%d,%.3f,%.3f,%" PRIu64 ",%" PRIu64 ",%.16" PRIX64 "\n",
+           trace_name.c_str(), frame_count, time_ms,
+           time_ms / std::max(frame_count, 1),
+           command_processor->packets_executed(),
+           command_processor->draws_issued(), framebuffer_hash);
+    // Don't carry caches populated by one trace into the timing of the next.
+    command_processor->ClearCaches();
+  }
+
+  player_.reset();
+  emulator_.reset();
+  return failed_count != 0 ? 1 : 0;
+}
+
 }  //  namespace gpu
 }  //  namespace xe
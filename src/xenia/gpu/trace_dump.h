@@ -54,6 +54,9 @@ class TraceDump {
   bool Setup();
   bool Load(std::wstring trace_file_path);
   int Run();
+  // Batch benchmark mode (--target_trace_folder): replays every trace in the
+  // folder headlessly and writes one CSV row per trace to stdout.
+  int RunBatch(const std::wstring& folder);
 
   std::wstring trace_file_path_;
   std::wstring base_output_path_;
@@ -9,6 +9,10 @@
 
 #include "xenia/gpu/trace_player.h"
 
+#include <algorithm>
+
+#include "third_party/snappy/snappy.h"
+
 #include "xenia/gpu/command_processor.h"
 #include "xenia/gpu/graphics_system.h"
 #include "xenia/memory.h"
@@ -30,9 +34,351 @@ TracePlayer::TracePlayer(xe::ui::Loop* loop, GraphicsSystem* graphics_system)
                    kMemoryProtectRead | kMemoryProtectWrite);
 
   playback_event_ = xe::threading::Event::CreateAutoResetEvent(false);
+
+  uint32_t decompression_thread_count = std::min(
+      std::max(xe::threading::logical_processor_count() / 2, uint32_t(1)),
+      uint32_t(8));
+  for (uint32_t i = 0; i < decompression_thread_count; ++i) {
+    std::unique_ptr<xe::threading::Thread> decompression_thread =
+        xe::threading::Thread::Create({}, [this]() { DecompressionThread(); });
+    decompression_thread->set_name("Trace Decompression");
+    decompression_threads_.push_back(std::move(decompression_thread));
+  }
+}
+
+TracePlayer::~TracePlayer() {
+  {
+    std::lock_guard<std::mutex> lock(decompression_request_lock_);
+    decompression_threads_shutdown_ = true;
+  }
+  decompression_request_cond_.notify_all();
+  for (size_t i = 0; i < decompression_threads_.size(); ++i) {
+    xe::threading::Wait(decompression_threads_[i].get(), false);
+  }
+  decompression_threads_.clear();
+
+  delete[] edram_snapshot_;
+}
+
+void TracePlayer::DecompressionThread() {
+  while (true) {
+    DecompressionRequest request;
+    {
+      std::unique_lock<std::mutex> lock(decompression_request_lock_);
+      decompression_request_cond_.wait(lock, [this]() {
+        return decompression_threads_shutdown_ ||
+               !decompression_queue_.empty();
+      });
+      if (decompression_threads_shutdown_) {
+        return;
+      }
+      request = decompression_queue_.front();
+      decompression_queue_.pop_front();
+      ++decompression_threads_busy_;
+    }
+    DecompressMemory(request.encoding_format, request.src, request.src_size,
+                     request.dest, request.dest_size);
+    {
+      std::lock_guard<std::mutex> lock(decompression_request_lock_);
+      --decompression_threads_busy_;
+      if (!decompression_threads_busy_ && decompression_queue_.empty()) {
+        decompression_completion_cond_.notify_all();
+      }
+    }
+  }
+}
+
+void TracePlayer::AwaitDecompression() {
+  std::unique_lock<std::mutex> lock(decompression_request_lock_);
+  decompression_completion_cond_.wait(lock, [this]() {
+    return !decompression_threads_busy_ && decompression_queue_.empty();
+  });
+}
+
+void TracePlayer::AddWrittenRange(uint32_t base_ptr, uint32_t length) {
+  if (!length) {
+    return;
+  }
+  uint32_t begin = base_ptr;
+  uint32_t end = base_ptr + length;
+  // First existing range ending at or after the new range's start.
+  auto it = std::lower_bound(
+      written_ranges_.begin(), written_ranges_.end(), begin,
+      [](const std::pair<uint32_t, uint32_t>& range, uint32_t value) {
+        return range.first + range.second < value;
+      });
+  if (it == written_ranges_.end() || end < it->first) {
+    written_ranges_.insert(it, {begin, length});
+    return;
+  }
+  // Merge with every range overlapping or adjacent to the new one.
+  uint32_t merged_begin = std::min(begin, it->first);
+  uint32_t merged_end = end;
+  auto last = it;
+  while (last != written_ranges_.end() && last->first <= end) {
+    merged_end = std::max(merged_end, last->first + last->second);
+    ++last;
+  }
+  it->first = merged_begin;
+  it->second = merged_end - merged_begin;
+  written_ranges_.erase(it + 1, last);
+}
+
+void TracePlayer::ScheduleKeyframeCaptures(const uint8_t* begin,
+                                           const uint8_t* end) {
+  std::lock_guard<std::mutex> lock(keyframes_lock_);
+  for (int i = kKeyframeFrameInterval; i < frame_count();
+       i += kKeyframeFrameInterval) {
+    // A boundary at the range start needs no capture - the state there is
+    // what the walk is starting from, which is already a keyframe or the
+    // trace start.
+    const uint8_t* boundary = frame(i)->start_ptr;
+    if (boundary <= begin || boundary > end) {
+      continue;
+    }
+    bool exists = false;
+    for (const auto& keyframe : keyframes_) {
+      if (keyframe->frame_index == i) {
+        exists = true;
+        break;
+      }
+    }
+    if (!exists) {
+      pending_keyframe_captures_.push_back({i, boundary});
+    }
+  }
+}
+
+void TracePlayer::CaptureMemoryKeyframe(int frame_index) {
+  auto memory = graphics_system_->memory();
+  auto keyframe = std::make_unique<MemoryKeyframe>();
+  keyframe->frame_index = frame_index;
+  keyframe->ranges = written_ranges_;
+  keyframe->edram_snapshot_command = current_edram_snapshot_command_;
+  size_t total_size = 0;
+  for (const auto& range : keyframe->ranges) {
+    total_size += range.second;
+  }
+  keyframe->uncompressed_size = total_size;
+  if (total_size) {
+    std::vector<uint8_t> staging(total_size);
+    uint8_t* dest = staging.data();
+    for (const auto& range : keyframe->ranges) {
+      std::memcpy(dest, memory->TranslatePhysical(range.first), range.second);
+      dest += range.second;
+    }
+    keyframe->compressed_data.resize(snappy::MaxCompressedLength(total_size));
+    size_t compressed_size;
+    snappy::RawCompress(
+        reinterpret_cast<const char*>(staging.data()), total_size,
+        reinterpret_cast<char*>(keyframe->compressed_data.data()),
+        &compressed_size);
+    keyframe->compressed_data.resize(compressed_size);
+    keyframe->compressed_data.shrink_to_fit();
+  }
+  std::lock_guard<std::mutex> lock(keyframes_lock_);
+  keyframes_.push_back(std::move(keyframe));
+}
+
+const TracePlayer::MemoryKeyframe* TracePlayer::FindKeyframe(
+    int target_frame) {
+  std::lock_guard<std::mutex> lock(keyframes_lock_);
+  const MemoryKeyframe* best = nullptr;
+  for (const auto& keyframe : keyframes_) {
+    if (keyframe->frame_index <= target_frame &&
+        (!best || keyframe->frame_index > best->frame_index)) {
+      best = keyframe.get();
+    }
+  }
+  return best;
+}
+
+void TracePlayer::RestoreKeyframe(const MemoryKeyframe& keyframe) {
+  auto memory = graphics_system_->memory();
+  auto command_processor = graphics_system_->command_processor();
+  if (keyframe.uncompressed_size) {
+    std::vector<uint8_t> staging(keyframe.uncompressed_size);
+    snappy::RawUncompress(
+        reinterpret_cast<const char*>(keyframe.compressed_data.data()),
+        keyframe.compressed_data.size(),
+        reinterpret_cast<char*>(staging.data()));
+    const uint8_t* src = staging.data();
+    for (const auto& range : keyframe.ranges) {
+      std::memcpy(memory->TranslatePhysical(range.first), src, range.second);
+      command_processor->TracePlaybackWroteMemory(range.first, range.second);
+      src += range.second;
+    }
+  }
+  if (keyframe.edram_snapshot_command) {
+    auto cmd = keyframe.edram_snapshot_command;
+    const size_t kEDRAMSize = 10 * 1024 * 1024;
+    if (!edram_snapshot_) {
+      edram_snapshot_ = new uint8_t[kEDRAMSize];
+    }
+    DecompressMemory(cmd->encoding_format,
+                     reinterpret_cast<const uint8_t*>(cmd) + sizeof(*cmd),
+                     cmd->encoded_length, edram_snapshot_, kEDRAMSize);
+    command_processor->RestoreEDRAMSnapshot(edram_snapshot_);
+  }
+  current_edram_snapshot_command_ = keyframe.edram_snapshot_command;
+}
+
+const uint8_t* TracePlayer::PlayMemoryReadRun(const uint8_t* trace_ptr,
+                                              const uint8_t* trace_end) {
+  auto memory = graphics_system_->memory();
+  auto command_processor = graphics_system_->command_processor();
+
+  // Gather the whole run of consecutive memory reads (the texture and buffer
+  // uploads recorded between packets) so their payloads can be decompressed
+  // in parallel on the worker threads - each command targets its own physical
+  // range. A command overlapping an earlier one in the run ends the batch so
+  // memory is written in trace order.
+  const uint8_t* run_ptr = trace_ptr;
+  std::vector<const MemoryCommand*> run_commands;
+  bool overlaps = false;
+  while (run_ptr < trace_end &&
+         static_cast<TraceCommandType>(xe::load<uint32_t>(run_ptr)) ==
+             TraceCommandType::kMemoryRead) {
+    auto cmd = reinterpret_cast<const MemoryCommand*>(run_ptr);
+    for (const MemoryCommand* other : run_commands) {
+      if (cmd->base_ptr < other->base_ptr + other->decoded_length &&
+          other->base_ptr < cmd->base_ptr + cmd->decoded_length) {
+        overlaps = true;
+        break;
+      }
+    }
+    if (overlaps) {
+      break;
+    }
+    run_commands.push_back(cmd);
+    run_ptr += sizeof(*cmd) + cmd->encoded_length;
+  }
+  if (run_commands.size() > 1) {
+    {
+      std::lock_guard<std::mutex> lock(decompression_request_lock_);
+      for (const MemoryCommand* cmd : run_commands) {
+        DecompressionRequest request;
+        request.encoding_format = cmd->encoding_format;
+        request.src = reinterpret_cast<const uint8_t*>(cmd) + sizeof(*cmd);
+        request.src_size = cmd->encoded_length;
+        request.dest = memory->TranslatePhysical(cmd->base_ptr);
+        request.dest_size = cmd->decoded_length;
+        decompression_queue_.push_back(request);
+      }
+    }
+    decompression_request_cond_.notify_all();
+    AwaitDecompression();
+  } else {
+    const MemoryCommand* cmd = run_commands.front();
+    DecompressMemory(cmd->encoding_format,
+                     reinterpret_cast<const uint8_t*>(cmd) + sizeof(*cmd),
+                     cmd->encoded_length,
+                     memory->TranslatePhysical(cmd->base_ptr),
+                     cmd->decoded_length);
+  }
+  for (const MemoryCommand* cmd : run_commands) {
+    AddWrittenRange(cmd->base_ptr, cmd->decoded_length);
+    command_processor->TracePlaybackWroteMemory(cmd->base_ptr,
+                                                cmd->decoded_length);
+  }
+  return run_ptr;
 }
 
-TracePlayer::~TracePlayer() { delete[] edram_snapshot_; }
+void TracePlayer::ApplyMemoryCommands(const uint8_t* trace_data,
+                                      size_t trace_size, bool prescan_draws) {
+  auto memory = graphics_system_->memory();
+  auto command_processor = graphics_system_->command_processor();
+
+  // Walk the range applying only what changes guest memory or the EDRAM -
+  // packets are not executed, making catching up to a distant frame far
+  // cheaper than a full replay of everything before it.
+  auto trace_ptr = trace_data;
+  auto trace_end = trace_data + trace_size;
+  while (trace_ptr < trace_end) {
+    // Capture any keyframes whose frame boundary has been crossed, while the
+    // guest memory holds exactly the state at that boundary.
+    while (!pending_keyframe_captures_.empty() &&
+           pending_keyframe_captures_.front().second <= trace_ptr) {
+      CaptureMemoryKeyframe(pending_keyframe_captures_.front().first);
+      pending_keyframe_captures_.pop_front();
+    }
+    auto type = static_cast<TraceCommandType>(xe::load<uint32_t>(trace_ptr));
+    switch (type) {
+      case TraceCommandType::kPrimaryBufferStart: {
+        auto cmd =
+            reinterpret_cast<const PrimaryBufferStartCommand*>(trace_ptr);
+        trace_ptr += sizeof(*cmd) + cmd->count * 4;
+        break;
+      }
+      case TraceCommandType::kPrimaryBufferEnd: {
+        trace_ptr += sizeof(PrimaryBufferEndCommand);
+        break;
+      }
+      case TraceCommandType::kIndirectBufferStart: {
+        auto cmd =
+            reinterpret_cast<const IndirectBufferStartCommand*>(trace_ptr);
+        trace_ptr += sizeof(*cmd) + cmd->count * 4;
+        break;
+      }
+      case TraceCommandType::kIndirectBufferEnd: {
+        trace_ptr += sizeof(IndirectBufferEndCommand);
+        break;
+      }
+      case TraceCommandType::kPacketStart: {
+        auto cmd = reinterpret_cast<const PacketStartCommand*>(trace_ptr);
+        trace_ptr += sizeof(*cmd);
+        std::memcpy(memory->TranslatePhysical(cmd->base_ptr), trace_ptr,
+                    cmd->count * 4);
+        AddWrittenRange(cmd->base_ptr, cmd->count * 4);
+        trace_ptr += cmd->count * 4;
+        if (prescan_draws) {
+          // The guest memory now holds exactly what the packet will execute
+          // with, so the scan sees the same shaders the draws will use.
+          command_processor->PrescanTracePacket(cmd->base_ptr, cmd->count);
+        }
+        break;
+      }
+      case TraceCommandType::kPacketEnd: {
+        trace_ptr += sizeof(PacketEndCommand);
+        break;
+      }
+      case TraceCommandType::kMemoryRead: {
+        trace_ptr = PlayMemoryReadRun(trace_ptr, trace_end);
+        break;
+      }
+      case TraceCommandType::kMemoryWrite: {
+        auto cmd = reinterpret_cast<const MemoryCommand*>(trace_ptr);
+        trace_ptr += sizeof(*cmd) + cmd->encoded_length;
+        break;
+      }
+      case TraceCommandType::kEDRAMSnapshot: {
+        auto cmd = reinterpret_cast<const EDRAMSnapshotCommand*>(trace_ptr);
+        trace_ptr += sizeof(*cmd);
+        const size_t kEDRAMSize = 10 * 1024 * 1024;
+        if (!edram_snapshot_) {
+          edram_snapshot_ = new uint8_t[kEDRAMSize];
+        }
+        DecompressMemory(cmd->encoding_format, trace_ptr, cmd->encoded_length,
+                         edram_snapshot_, kEDRAMSize);
+        trace_ptr += cmd->encoded_length;
+        command_processor->RestoreEDRAMSnapshot(edram_snapshot_);
+        current_edram_snapshot_command_ = cmd;
+        break;
+      }
+      case TraceCommandType::kEvent: {
+        trace_ptr += sizeof(EventCommand);
+        break;
+      }
+    }
+  }
+  // A boundary at the very end of the range (the sought frame itself) is
+  // only reached after the last command.
+  while (!pending_keyframe_captures_.empty() &&
+         pending_keyframe_captures_.front().second <= trace_ptr) {
+    CaptureMemoryKeyframe(pending_keyframe_captures_.front().first);
+    pending_keyframe_captures_.pop_front();
+  }
+}
 
 const TraceReader::Frame* TracePlayer::current_frame() const {
   if (current_frame_index_ >= frame_count()) {
@@ -45,13 +391,46 @@ void TracePlayer::SeekFrame(int target_frame) {
   if (current_frame_index_ == target_frame) {
     return;
   }
+  int previous_frame_index = current_frame_index_;
   current_frame_index_ = target_frame;
   auto frame = current_frame();
   current_command_index_ = int(frame->commands.size()) - 1;
 
   assert_true(frame->start_ptr <= frame->end_ptr);
+  // Seeking anywhere but to the immediately following frame needs the memory
+  // contents recorded in the frames being skipped over - memory reads are
+  // deduplicated across the whole trace, so a late frame may reference
+  // uploads only present in earlier ones. Catch up by applying the memory
+  // commands of the skipped range (from the trace start when seeking
+  // backward, as later frames may have overwritten earlier contents) without
+  // executing its packets.
+  const uint8_t* catch_up_data = nullptr;
+  size_t catch_up_size = 0;
+  if (target_frame != previous_frame_index + 1) {
+    // When seeking forward, also reapply the previously current frame - it
+    // may have been only partially played through SeekCommand, and memory
+    // application is idempotent.
+    const uint8_t* catch_up_start;
+    if (target_frame > previous_frame_index) {
+      catch_up_start = this->frame(previous_frame_index)->start_ptr;
+    } else {
+      // Seeking backward: restore the newest keyframe at or before the
+      // target instead of reapplying everything from the trace start, and
+      // catch up only over the frames past it.
+      const MemoryKeyframe* keyframe = FindKeyframe(target_frame);
+      if (keyframe) {
+        pending_keyframe_restore_ = keyframe;
+        catch_up_start = this->frame(keyframe->frame_index)->start_ptr;
+      } else {
+        catch_up_start = this->frame(0)->start_ptr;
+      }
+    }
+    catch_up_data = catch_up_start;
+    catch_up_size = frame->start_ptr - catch_up_start;
+  }
   PlayTrace(frame->start_ptr, frame->end_ptr - frame->start_ptr,
-            TracePlaybackMode::kBreakOnSwap, false);
+            TracePlaybackMode::kBreakOnSwap, false, catch_up_data,
+            catch_up_size);
 }
 
 void TracePlayer::SeekCommand(int target_command) {
@@ -84,18 +463,22 @@ void TracePlayer::WaitOnPlayback() {
 }
 
 void TracePlayer::PlayTrace(const uint8_t* trace_data, size_t trace_size,
-                            TracePlaybackMode playback_mode,
-                            bool clear_caches) {
+                            TracePlaybackMode playback_mode, bool clear_caches,
+                            const uint8_t* catch_up_data,
+                            size_t catch_up_size) {
   playing_trace_ = true;
   graphics_system_->command_processor()->CallInThread([=]() {
-    PlayTraceOnThread(trace_data, trace_size, playback_mode, clear_caches);
+    PlayTraceOnThread(trace_data, trace_size, playback_mode, clear_caches,
+                      catch_up_data, catch_up_size);
   });
 }
 
 void TracePlayer::PlayTraceOnThread(const uint8_t* trace_data,
                                     size_t trace_size,
                                     TracePlaybackMode playback_mode,
-                                    bool clear_caches) {
+                                    bool clear_caches,
+                                    const uint8_t* catch_up_data,
+                                    size_t catch_up_size) {
   auto memory = graphics_system_->memory();
   auto command_processor = graphics_system_->command_processor();
 
@@ -103,6 +486,25 @@ void TracePlayer::PlayTraceOnThread(const uint8_t* trace_data,
     command_processor->ClearCaches();
   }
 
+  if (pending_keyframe_restore_) {
+    RestoreKeyframe(*pending_keyframe_restore_);
+    pending_keyframe_restore_ = nullptr;
+  }
+
+  command_processor->BeginTracePrescan();
+  if (catch_up_size) {
+    ScheduleKeyframeCaptures(catch_up_data, catch_up_data + catch_up_size);
+    ApplyMemoryCommands(catch_up_data, catch_up_size, true);
+    pending_keyframe_captures_.clear();
+  }
+  // Also pre-pass the range about to be played. Its memory gets applied
+  // ahead of time (idempotent - the playback loop below reapplies the same
+  // bytes at the same points of the stream), and translation of every shader
+  // it references is queued to the backend workers, running while the
+  // commands preceding each draw are executed instead of stalling the draw.
+  ApplyMemoryCommands(trace_data, trace_size, true);
+  command_processor->EndTracePrescan();
+
   command_processor->set_swap_mode(SwapMode::kIgnored);
   playback_percent_ = 0;
   auto trace_end = trace_data + trace_size;
@@ -149,6 +551,7 @@ void TracePlayer::PlayTraceOnThread(const uint8_t* trace_data,
         trace_ptr += sizeof(*cmd);
         std::memcpy(memory->TranslatePhysical(cmd->base_ptr), trace_ptr,
                     cmd->count * 4);
+        AddWrittenRange(cmd->base_ptr, cmd->count * 4);
         trace_ptr += cmd->count * 4;
         pending_packet = cmd;
         break;
@@ -168,14 +571,7 @@ void TracePlayer::PlayTraceOnThread(const uint8_t* trace_data,
         break;
       }
       case TraceCommandType::kMemoryRead: {
-        auto cmd = reinterpret_cast<const MemoryCommand*>(trace_ptr);
-        trace_ptr += sizeof(*cmd);
-        DecompressMemory(cmd->encoding_format, trace_ptr, cmd->encoded_length,
-                         memory->TranslatePhysical(cmd->base_ptr),
-                         cmd->decoded_length);
-        trace_ptr += cmd->encoded_length;
-        command_processor->TracePlaybackWroteMemory(cmd->base_ptr,
-                                                    cmd->decoded_length);
+        trace_ptr = PlayMemoryReadRun(trace_ptr, trace_data + trace_size);
         break;
       }
       case TraceCommandType::kMemoryWrite: {
@@ -197,6 +593,7 @@ void TracePlayer::PlayTraceOnThread(const uint8_t* trace_data,
                          edram_snapshot_, kEDRAMSize);
         trace_ptr += cmd->encoded_length;
         command_processor->RestoreEDRAMSnapshot(edram_snapshot_);
+        current_edram_snapshot_command_ = cmd;
         break;
       }
       case TraceCommandType::kEvent: {
@@ -11,7 +11,13 @@
 #define XENIA_GPU_TRACE_PLAYER_H_
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "xenia/base/threading.h"
 #include "xenia/gpu/trace_protocol.h"
@@ -49,10 +55,72 @@ class TracePlayer : public TraceReader {
   void WaitOnPlayback();
 
  private:
+  // A memory payload from the trace queued for decompression into the guest
+  // memory on the worker threads.
+  struct DecompressionRequest {
+    MemoryEncodingFormat encoding_format;
+    const uint8_t* src;
+    size_t src_size;
+    uint8_t* dest;
+    size_t dest_size;
+  };
+
+  // Snapshot of every guest range the trace has written up to the start of a
+  // frame, captured while catching up through the trace so backward seeks
+  // restore memory state directly instead of reapplying the whole trace
+  // prefix, which is O(trace length).
+  struct MemoryKeyframe {
+    int frame_index;
+    // Touched physical ranges (base, length) in address order; their
+    // contents are concatenated and snappy-compressed in compressed_data.
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    size_t uncompressed_size;
+    std::vector<uint8_t> compressed_data;
+    // The EDRAM snapshot in effect at the keyframe, or nullptr if none has
+    // been applied yet. Points into the trace data owned by the reader, so
+    // the 10 MB payload isn't duplicated per keyframe.
+    const EDRAMSnapshotCommand* edram_snapshot_command;
+  };
+
+  // catch_up_data, when provided, is a range of trace commands preceding
+  // trace_data whose memory contents (but not packets) are applied before
+  // playback, so a frame can be sought directly while still seeing the
+  // uploads recorded in the frames being skipped over.
   void PlayTrace(const uint8_t* trace_data, size_t trace_size,
-                 TracePlaybackMode playback_mode, bool clear_caches);
+                 TracePlaybackMode playback_mode, bool clear_caches,
+                 const uint8_t* catch_up_data = nullptr,
+                 size_t catch_up_size = 0);
   void PlayTraceOnThread(const uint8_t* trace_data, size_t trace_size,
-                         TracePlaybackMode playback_mode, bool clear_caches);
+                         TracePlaybackMode playback_mode, bool clear_caches,
+                         const uint8_t* catch_up_data, size_t catch_up_size);
+  // Applies the memory contents (memory reads, packet data, EDRAM snapshots)
+  // of a trace range to the guest without executing any packets. When
+  // prescan_draws is set, every applied packet is also fed to the command
+  // processor's trace prescan so shader translation for the upcoming draws
+  // fans out across the backend worker threads while the memory loads.
+  void ApplyMemoryCommands(const uint8_t* trace_data, size_t trace_size,
+                           bool prescan_draws = false);
+  // Plays a run of consecutive memory read commands starting at trace_ptr,
+  // decompressing independent payloads in parallel on the worker threads.
+  // Returns the pointer past the last command played.
+  const uint8_t* PlayMemoryReadRun(const uint8_t* trace_ptr,
+                                   const uint8_t* trace_end);
+
+  void DecompressionThread();
+  // Waits for all queued decompression requests to complete.
+  void AwaitDecompression();
+
+  // Records a guest physical range written during playback or catch-up in
+  // the merged set keyframes snapshot.
+  void AddWrittenRange(uint32_t base_ptr, uint32_t length);
+  // Queues keyframe captures for the frame boundaries at the keyframe
+  // interval within the catch-up range that don't have a keyframe yet.
+  void ScheduleKeyframeCaptures(const uint8_t* begin, const uint8_t* end);
+  void CaptureMemoryKeyframe(int frame_index);
+  // Returns the newest keyframe at or before the target frame, if any.
+  const MemoryKeyframe* FindKeyframe(int target_frame);
+  // Writes the keyframe contents back to the guest memory and the EDRAM.
+  void RestoreKeyframe(const MemoryKeyframe& keyframe);
 
   xe::ui::Loop* loop_;
   GraphicsSystem* graphics_system_;
@@ -62,6 +130,34 @@ class TracePlayer : public TraceReader {
   std::atomic<uint32_t> playback_percent_ = {0};
   std::unique_ptr<xe::threading::Event> playback_event_;
   uint8_t* edram_snapshot_ = nullptr;
+
+  // Decompression worker threads. Runs of consecutive memory commands write
+  // to disjoint guest ranges, so their payloads are decompressed in parallel
+  // while playback is waiting on them anyway.
+  std::vector<std::unique_ptr<xe::threading::Thread>> decompression_threads_;
+  std::mutex decompression_request_lock_;
+  std::condition_variable decompression_request_cond_;
+  std::condition_variable decompression_completion_cond_;
+  std::deque<DecompressionRequest> decompression_queue_;
+  uint32_t decompression_threads_busy_ = 0;
+  bool decompression_threads_shutdown_ = false;
+
+  // Memory state keyframes; see MemoryKeyframe. Captured and restored on the
+  // command processor thread, looked up from the UI thread - the lock covers
+  // the keyframe list, everything else is playback-thread state.
+  static const int kKeyframeFrameInterval = 8;
+  std::mutex keyframes_lock_;
+  std::vector<std::unique_ptr<MemoryKeyframe>> keyframes_;
+  // Merged, address-ordered set of (base, length) physical ranges the trace
+  // has written so far.
+  std::vector<std::pair<uint32_t, uint32_t>> written_ranges_;
+  // Frame boundaries to capture at during the current catch-up walk, in
+  // trace order.
+  std::deque<std::pair<int, const uint8_t*>> pending_keyframe_captures_;
+  // Keyframe to restore before the next playback, requested by SeekFrame.
+  const MemoryKeyframe* pending_keyframe_restore_ = nullptr;
+  // The EDRAM snapshot command most recently applied to the guest.
+  const EDRAMSnapshotCommand* current_edram_snapshot_command_ = nullptr;
 };
 
 }  // namespace gpu
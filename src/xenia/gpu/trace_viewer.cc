@@ -9,9 +9,10 @@
 
 #include "xenia/gpu/trace_viewer.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <cstdio>
 
-#include "third_party/half/include/half.hpp"
 #include "third_party/imgui/imgui.h"
 #include "xenia/base/clock.h"
 #include "xenia/base/logging.h"
@@ -198,6 +199,7 @@ void TraceViewer::DrawUI() {
   DrawCommandListUI();
   DrawStateUI();
   DrawPacketDisassemblerUI();
+  DrawTimingUI();
 }
 
 void TraceViewer::DrawControllerUI() {
@@ -248,6 +250,101 @@ void TraceViewer::DrawControllerUI() {
   ImGui::End();
 }
 
+void TraceViewer::ProfileCurrentFrame() {
+  auto frame = player_->current_frame();
+  if (!frame || frame->commands.empty()) {
+    return;
+  }
+  auto command_processor = graphics_system_->command_processor();
+  command_processor->SetDrawTimingCaptureEnabled(true);
+  // Full replay of the frame, including the swap that completes the capture.
+  player_->SeekCommand(-1);
+  player_->SeekCommand(int(frame->commands.size()) - 1);
+  player_->WaitOnPlayback();
+  command_processor->SetDrawTimingCaptureEnabled(false);
+
+  draw_timings_.clear();
+  draw_timing_command_ids_.clear();
+  draw_timings_unsupported_ =
+      !command_processor->GetDrawTimings(draw_timings_);
+  if (draw_timings_unsupported_) {
+    draw_timings_frame_index_ = -1;
+    return;
+  }
+  // Most expensive first.
+  std::sort(draw_timings_.begin(), draw_timings_.end(),
+            [](const CommandProcessor::DrawTiming& a,
+               const CommandProcessor::DrawTiming& b) {
+              return a.duration_us > b.duration_us;
+            });
+  // Captured draw indices count only draw packets - map them back to indices
+  // in the frame command list, which also contains swaps.
+  for (int i = 0; i < int(frame->commands.size()); ++i) {
+    if (frame->commands[i].type == TraceReader::Frame::Command::Type::kDraw) {
+      draw_timing_command_ids_.push_back(i);
+    }
+  }
+  draw_timings_frame_index_ = player_->current_frame_index();
+}
+
+void TraceViewer::DrawTimingUI() {
+  ImGui::SetNextWindowCollapsed(true, ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowPos(ImVec2(5, 70), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2(340, 300), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("GPU Timing", nullptr)) {
+    ImGui::End();
+    return;
+  }
+  if (ImGui::Button("Profile frame") && !player_->is_playing_trace()) {
+    ProfileCurrentFrame();
+  }
+  if (ImGui::IsItemHovered()) {
+    ImGui::SetTooltip(
+        "Replay the current frame with GPU timestamps around every draw and "
+        "resolve");
+  }
+  if (draw_timings_unsupported_) {
+    ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f),
+                       "Not supported by this graphics backend");
+    ImGui::End();
+    return;
+  }
+  if (draw_timings_frame_index_ < 0) {
+    ImGui::End();
+    return;
+  }
+  double total_us = 0.0;
+  for (const auto& timing : draw_timings_) {
+    total_us += timing.duration_us;
+  }
+  ImGui::Text("Frame %d: %d draws, %.0fus total draw GPU time",
+              draw_timings_frame_index_, int(draw_timings_.size()), total_us);
+  ImGui::BeginChild("#draw_timings");
+  ImGui::Columns(3);
+  for (const auto& timing : draw_timings_) {
+    int command_id =
+        timing.draw_index < draw_timing_command_ids_.size()
+            ? draw_timing_command_ids_[timing.draw_index]
+            : -1;
+    char label[16];
+    std::snprintf(label, xe::countof(label), "%d", command_id);
+    if (ImGui::Selectable(label, false,
+                          ImGuiSelectableFlags_SpanAllColumns) &&
+        command_id >= 0 && !player_->is_playing_trace() &&
+        draw_timings_frame_index_ == player_->current_frame_index()) {
+      player_->SeekCommand(command_id);
+    }
+    ImGui::NextColumn();
+    ImGui::Text("%s", timing.is_resolve ? "resolve" : "draw");
+    ImGui::NextColumn();
+    ImGui::Text("%.1fus", timing.duration_us);
+    ImGui::NextColumn();
+  }
+  ImGui::Columns(1);
+  ImGui::EndChild();
+  ImGui::End();
+}
+
 void TraceViewer::DrawPacketDisassemblerUI() {
   ImGui::SetNextWindowCollapsed(true, ImGuiCond_FirstUseEver);
   ImGui::SetNextWindowPos(ImVec2(float(window_->width()) - 500 - 5, 5),
@@ -272,6 +369,8 @@ void TraceViewer::DrawPacketDisassemblerUI() {
               player_->current_command_index());
   ImGui::Separator();
   ImGui::BeginChild("packet_disassembler_list");
+  // All actions materialized during this walk live until the next one.
+  packet_disasm_arena_.Reset();
   const PacketStartCommand* pending_packet = nullptr;
   auto trace_ptr = start_ptr;
   while (trace_ptr < end_ptr) {
@@ -313,45 +412,55 @@ void TraceViewer::DrawPacketDisassemblerUI() {
         auto cmd = reinterpret_cast<const PacketEndCommand*>(trace_ptr);
         trace_ptr += sizeof(*cmd);
         if (pending_packet) {
+          const uint8_t* packet_ptr =
+              reinterpret_cast<const uint8_t*>(pending_packet) +
+              sizeof(PacketStartCommand);
+          // Header-only disassembly for the collapsed line - the actions are
+          // only materialized, into the per-walk arena, for the packets that
+          // are actually expanded.
           PacketInfo packet_info = {0};
-          if (PacketDisassembler::DisasmPacket(
-                  reinterpret_cast<const uint8_t*>(pending_packet) +
-                      sizeof(PacketStartCommand),
-                  &packet_info)) {
+          if (PacketDisassembler::DisasmPacket(packet_ptr, &packet_info,
+                                               nullptr)) {
             if (packet_info.predicated) {
               ImGui::PushStyleColor(ImGuiCol_Text, kColorIgnored);
             }
-            ImGui::BulletText("%s", packet_info.type_info->name);
-            ImGui::TreePush((const char*)0);
-            for (auto action : packet_info.actions) {
-              switch (action.type) {
-                case PacketAction::Type::kRegisterWrite: {
-                  auto register_info = xe::gpu::RegisterFile::GetRegisterInfo(
-                      action.register_write.index);
-                  ImGui::Columns(2);
-                  ImGui::Text("%.4X %s", action.register_write.index,
-                              register_info ? register_info->name : "???");
-                  ImGui::NextColumn();
-                  if (!register_info ||
-                      register_info->type == RegisterInfo::Type::kDword) {
-                    ImGui::Text("%.8X", action.register_write.value.u32);
-                  } else {
-                    ImGui::Text("%8f", action.register_write.value.f32);
+            if (ImGui::TreeNode(pending_packet, "%s",
+                                packet_info.type_info->name)) {
+              if (PacketDisassembler::DisasmPacket(packet_ptr, &packet_info,
+                                                   &packet_disasm_arena_)) {
+                for (size_t i = 0; i < packet_info.action_count; ++i) {
+                  const PacketAction& action = packet_info.actions[i];
+                  switch (action.type) {
+                    case PacketAction::Type::kRegisterWrite: {
+                      auto register_info =
+                          xe::gpu::RegisterFile::GetRegisterInfo(
+                              action.register_write.index);
+                      ImGui::Columns(2);
+                      ImGui::Text("%.4X %s", action.register_write.index,
+                                  register_info ? register_info->name : "???");
+                      ImGui::NextColumn();
+                      if (!register_info ||
+                          register_info->type == RegisterInfo::Type::kDword) {
+                        ImGui::Text("%.8X", action.register_write.value.u32);
+                      } else {
+                        ImGui::Text("%8f", action.register_write.value.f32);
+                      }
+                      ImGui::Columns(1);
+                      break;
+                    }
+                    case PacketAction::Type::kSetBinMask: {
+                      ImGui::Text("%.16" PRIX64, action.set_bin_mask.value);
+                      break;
+                    }
+                    case PacketAction::Type::kSetBinSelect: {
+                      ImGui::Text("%.16" PRIX64, action.set_bin_select.value);
+                      break;
+                    }
                   }
-                  ImGui::Columns(1);
-                  break;
-                }
-                case PacketAction::Type::kSetBinMask: {
-                  ImGui::Text("%.16" PRIX64, action.set_bin_mask.value);
-                  break;
-                }
-                case PacketAction::Type::kSetBinSelect: {
-                  ImGui::Text("%.16" PRIX64, action.set_bin_select.value);
-                  break;
                 }
               }
+              ImGui::TreePop();
             }
-            ImGui::TreePop();
             if (packet_info.predicated) {
               ImGui::PopStyleColor();
             }
@@ -853,10 +962,10 @@ void TraceViewer::DrawVertexFetcher(Shader* shader,
         case VertexFormat::k_16_16_FLOAT: {
           auto e0 = LOADEL(uint32_t, 0);
           ImGui::Text("%.2f",
-                      half_float::detail::half2float((e0 >> 16) & 0xFFFF));
+                      xe::half_to_float((e0 >> 16) & 0xFFFF));
           ImGui::NextColumn();
           ImGui::Text("%.2f",
-                      half_float::detail::half2float((e0 >> 0) & 0xFFFF));
+                      xe::half_to_float((e0 >> 0) & 0xFFFF));
           ImGui::NextColumn();
         } break;
         case VertexFormat::k_32_32:
@@ -929,16 +1038,16 @@ void TraceViewer::DrawVertexFetcher(Shader* shader,
           auto e0 = LOADEL(uint32_t, 0);
           auto e1 = LOADEL(uint32_t, 1);
           ImGui::Text("%.2f",
-                      half_float::detail::half2float((e0 >> 16) & 0xFFFF));
+                      xe::half_to_float((e0 >> 16) & 0xFFFF));
           ImGui::NextColumn();
           ImGui::Text("%.2f",
-                      half_float::detail::half2float((e0 >> 0) & 0xFFFF));
+                      xe::half_to_float((e0 >> 0) & 0xFFFF));
           ImGui::NextColumn();
           ImGui::Text("%.2f",
-                      half_float::detail::half2float((e1 >> 16) & 0xFFFF));
+                      xe::half_to_float((e1 >> 16) & 0xFFFF));
           ImGui::NextColumn();
           ImGui::Text("%.2f",
-                      half_float::detail::half2float((e1 >> 0) & 0xFFFF));
+                      xe::half_to_float((e1 >> 0) & 0xFFFF));
           ImGui::NextColumn();
         } break;
         case VertexFormat::k_32_32_32_32_FLOAT:
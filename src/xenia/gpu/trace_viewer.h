@@ -11,8 +11,11 @@
 #define XENIA_GPU_TRACE_VIEWER_H_
 
 #include <string>
+#include <vector>
 
+#include "xenia/base/arena.h"
 #include "xenia/emulator.h"
+#include "xenia/gpu/command_processor.h"
 #include "xenia/gpu/shader.h"
 #include "xenia/gpu/trace_player.h"
 #include "xenia/gpu/trace_protocol.h"
@@ -80,6 +83,10 @@ class TraceViewer {
   void DrawUI();
   void DrawControllerUI();
   void DrawPacketDisassemblerUI();
+  // Replays the current frame in full with every draw and resolve bracketed
+  // in GPU timestamp queries, and stores the sorted results for DrawTimingUI.
+  void ProfileCurrentFrame();
+  void DrawTimingUI();
   int RecursiveDrawCommandBufferUI(const TraceReader::Frame* frame,
                                    TraceReader::CommandBuffer* buffer);
   void DrawCommandListUI();
@@ -98,6 +105,18 @@ class TraceViewer {
   void DrawVertexFetcher(Shader* shader,
                          const Shader::VertexBinding& vertex_binding,
                          const xenos::xe_gpu_vertex_fetch_t* fetch);
+
+  // Per-draw GPU durations of the last profiled frame, most expensive first.
+  std::vector<CommandProcessor::DrawTiming> draw_timings_;
+  // Frame command index of each draw, by draw index (draw indices count only
+  // draw packets while the frame command list also contains swaps).
+  std::vector<int> draw_timing_command_ids_;
+  int draw_timings_frame_index_ = -1;
+  bool draw_timings_unsupported_ = false;
+
+  // Backing store for the actions of the packets expanded in the packet
+  // disassembler, reset at the start of every walk.
+  Arena packet_disasm_arena_;
 };
 
 }  // namespace gpu
@@ -11,7 +11,6 @@
 
 #include <cstring>
 
-#include "third_party/snappy/snappy-sinksource.h"
 #include "third_party/snappy/snappy.h"
 
 #include "build/version.h"
@@ -22,10 +21,20 @@
 namespace xe {
 namespace gpu {
 
+namespace {
+
+// Chunks are handed to the writer thread once they grow past this; large
+// memory payloads may push a single chunk well beyond it.
+const size_t kChunkTargetSize = 1 * 1024 * 1024;
+// Capture thread fills one chunk while the writer drains the others.
+const size_t kChunkCount = 3;
+
+}  // namespace
+
 TraceWriter::TraceWriter(uint8_t* membase)
     : membase_(membase), file_(nullptr) {}
 
-TraceWriter::~TraceWriter() = default;
+TraceWriter::~TraceWriter() { Close(); }
 
 bool TraceWriter::Open(const std::wstring& path, uint32_t title_id) {
   Close();
@@ -41,7 +50,8 @@ bool TraceWriter::Open(const std::wstring& path, uint32_t title_id) {
     return false;
   }
 
-  // Write header first. Must be at the top of the file.
+  // Write header first. Must be at the top of the file. The writer thread is
+  // not running yet, so this can go to the file directly.
   TraceHeader header;
   header.version = kTraceFormatVersion;
   std::memcpy(header.build_commit_sha, XE_BUILD_COMMIT,
@@ -50,11 +60,27 @@ bool TraceWriter::Open(const std::wstring& path, uint32_t title_id) {
   fwrite(&header, sizeof(header), 1, file_);
 
   cached_memory_reads_.clear();
+
+  // Serialization, compression and disk writes all happen on the writer
+  // thread so the command processor only pays for staging copies.
+  active_chunk_.clear();
+  active_chunk_.reserve(kChunkTargetSize);
+  for (size_t i = 1; i < kChunkCount; ++i) {
+    std::vector<uint8_t> chunk;
+    chunk.reserve(kChunkTargetSize);
+    free_chunks_.push_back(std::move(chunk));
+  }
+  writer_shutdown_ = false;
+  writer_thread_ =
+      xe::threading::Thread::Create({}, [this]() { WriterThread(); });
+  writer_thread_->set_name("GPU Trace Writer");
   return true;
 }
 
 void TraceWriter::Flush() {
   if (file_) {
+    SubmitActiveChunk();
+    AwaitWriter();
     fflush(file_);
   }
 }
@@ -63,12 +89,147 @@ void TraceWriter::Close() {
   if (file_) {
     cached_memory_reads_.clear();
 
+    SubmitActiveChunk();
+    {
+      std::lock_guard<std::mutex> lock(chunk_lock_);
+      writer_shutdown_ = true;
+    }
+    chunk_submitted_cond_.notify_all();
+    xe::threading::Wait(writer_thread_.get(), false);
+    writer_thread_.reset();
+    filled_chunks_.clear();
+    free_chunks_.clear();
+
     fflush(file_);
     fclose(file_);
     file_ = nullptr;
   }
 }
 
+void TraceWriter::AppendRecord(ChunkRecordType type, const void* data,
+                               size_t length, const void* data2,
+                               size_t length2) {
+  ChunkRecord record;
+  record.type = type;
+  record.length = uint32_t(length + length2);
+  size_t offset = active_chunk_.size();
+  active_chunk_.resize(offset + sizeof(record) + length + length2);
+  std::memcpy(active_chunk_.data() + offset, &record, sizeof(record));
+  std::memcpy(active_chunk_.data() + offset + sizeof(record), data, length);
+  if (length2) {
+    std::memcpy(active_chunk_.data() + offset + sizeof(record) + length, data2,
+                length2);
+  }
+  if (active_chunk_.size() >= kChunkTargetSize) {
+    SubmitActiveChunk();
+  }
+}
+
+void TraceWriter::SubmitActiveChunk() {
+  if (active_chunk_.empty()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(chunk_lock_);
+  filled_chunks_.push_back(std::move(active_chunk_));
+  chunk_submitted_cond_.notify_one();
+  if (free_chunks_.empty()) {
+    // Writer has the whole ring in flight - block rather than letting staged
+    // memory grow without bound.
+    chunk_retired_cond_.wait(lock, [this]() { return !free_chunks_.empty(); });
+  }
+  active_chunk_ = std::move(free_chunks_.back());
+  free_chunks_.pop_back();
+  active_chunk_.clear();
+}
+
+void TraceWriter::AwaitWriter() {
+  std::unique_lock<std::mutex> lock(chunk_lock_);
+  chunk_retired_cond_.wait(
+      lock, [this]() { return filled_chunks_.empty() && !writer_busy_; });
+}
+
+void TraceWriter::WriterThread() {
+  while (true) {
+    std::vector<uint8_t> chunk;
+    {
+      std::unique_lock<std::mutex> lock(chunk_lock_);
+      chunk_submitted_cond_.wait(lock, [this]() {
+        return writer_shutdown_ || !filled_chunks_.empty();
+      });
+      if (filled_chunks_.empty()) {
+        // Shutdown, and nothing left to drain.
+        return;
+      }
+      chunk = std::move(filled_chunks_.front());
+      filled_chunks_.pop_front();
+      writer_busy_ = true;
+    }
+    WriteChunk(chunk);
+    {
+      std::lock_guard<std::mutex> lock(chunk_lock_);
+      chunk.clear();
+      free_chunks_.push_back(std::move(chunk));
+      writer_busy_ = false;
+      chunk_retired_cond_.notify_all();
+    }
+  }
+}
+
+void TraceWriter::WriteChunk(const std::vector<uint8_t>& chunk) {
+  size_t offset = 0;
+  while (offset < chunk.size()) {
+    ChunkRecord record;
+    std::memcpy(&record, chunk.data() + offset, sizeof(record));
+    offset += sizeof(record);
+    const uint8_t* payload = chunk.data() + offset;
+    offset += record.length;
+    switch (record.type) {
+      case ChunkRecordType::kRaw: {
+        fwrite(payload, 1, record.length, file_);
+        break;
+      }
+      case ChunkRecordType::kMemoryPayload: {
+        MemoryCommand cmd;
+        std::memcpy(&cmd, payload, sizeof(cmd));
+        const uint8_t* data = payload + sizeof(cmd);
+        if (compress_output_ && cmd.decoded_length > compression_threshold_) {
+          size_t compressed_length = Compress(data, cmd.decoded_length);
+          // Keep incompressible buffers raw - snappy may expand them.
+          if (compressed_length < cmd.decoded_length) {
+            cmd.encoding_format = MemoryEncodingFormat::kSnappy;
+            cmd.encoded_length = static_cast<uint32_t>(compressed_length);
+            fwrite(&cmd, 1, sizeof(cmd), file_);
+            fwrite(compression_buffer_.data(), 1, compressed_length, file_);
+            break;
+          }
+        }
+        fwrite(&cmd, 1, sizeof(cmd), file_);
+        fwrite(data, 1, cmd.decoded_length, file_);
+        break;
+      }
+      case ChunkRecordType::kEDRAMPayload: {
+        EDRAMSnapshotCommand cmd;
+        cmd.type = TraceCommandType::kEDRAMSnapshot;
+        if (compress_output_) {
+          size_t compressed_length = Compress(payload, record.length);
+          if (compressed_length < record.length) {
+            cmd.encoding_format = MemoryEncodingFormat::kSnappy;
+            cmd.encoded_length = static_cast<uint32_t>(compressed_length);
+            fwrite(&cmd, 1, sizeof(cmd), file_);
+            fwrite(compression_buffer_.data(), 1, compressed_length, file_);
+            break;
+          }
+        }
+        cmd.encoding_format = MemoryEncodingFormat::kNone;
+        cmd.encoded_length = record.length;
+        fwrite(&cmd, 1, sizeof(cmd), file_);
+        fwrite(payload, 1, record.length, file_);
+        break;
+      }
+    }
+  }
+}
+
 void TraceWriter::WritePrimaryBufferStart(uint32_t base_ptr, uint32_t count) {
   if (!file_) {
     return;
@@ -78,7 +239,7 @@ void TraceWriter::WritePrimaryBufferStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       0,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendRecord(ChunkRecordType::kRaw, &cmd, sizeof(cmd));
 }
 
 void TraceWriter::WritePrimaryBufferEnd() {
@@ -88,7 +249,7 @@ void TraceWriter::WritePrimaryBufferEnd() {
   PrimaryBufferEndCommand cmd = {
       TraceCommandType::kPrimaryBufferEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendRecord(ChunkRecordType::kRaw, &cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteIndirectBufferStart(uint32_t base_ptr, uint32_t count) {
@@ -100,7 +261,7 @@ void TraceWriter::WriteIndirectBufferStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       0,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendRecord(ChunkRecordType::kRaw, &cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteIndirectBufferEnd() {
@@ -110,7 +271,7 @@ void TraceWriter::WriteIndirectBufferEnd() {
   IndirectBufferEndCommand cmd = {
       TraceCommandType::kIndirectBufferEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendRecord(ChunkRecordType::kRaw, &cmd, sizeof(cmd));
 }
 
 void TraceWriter::WritePacketStart(uint32_t base_ptr, uint32_t count) {
@@ -122,8 +283,8 @@ void TraceWriter::WritePacketStart(uint32_t base_ptr, uint32_t count) {
       base_ptr,
       count,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
-  fwrite(membase_ + base_ptr, 4, count, file_);
+  AppendRecord(ChunkRecordType::kRaw, &cmd, sizeof(cmd), membase_ + base_ptr,
+               count * 4);
 }
 
 void TraceWriter::WritePacketEnd() {
@@ -133,7 +294,7 @@ void TraceWriter::WritePacketEnd() {
   PacketEndCommand cmd = {
       TraceCommandType::kPacketEnd,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendRecord(ChunkRecordType::kRaw, &cmd, sizeof(cmd));
 }
 
 void TraceWriter::WriteMemoryRead(uint32_t base_ptr, size_t length,
@@ -178,17 +339,14 @@ void TraceWriter::WriteMemoryWrite(uint32_t base_ptr, size_t length,
                      host_ptr);
 }
 
-class SnappySink : public snappy::Sink {
- public:
-  SnappySink(FILE* file) : file_(file) {}
-
-  void Append(const char* bytes, size_t n) override {
-    fwrite(bytes, 1, n, file_);
-  }
-
- private:
-  FILE* file_ = nullptr;
-};
+size_t TraceWriter::Compress(const void* host_ptr, size_t length) {
+  compression_buffer_.resize(snappy::MaxCompressedLength(length));
+  size_t compressed_length;
+  snappy::RawCompress(reinterpret_cast<const char*>(host_ptr), length,
+                      reinterpret_cast<char*>(compression_buffer_.data()),
+                      &compressed_length);
+  return compressed_length;
+}
 
 void TraceWriter::WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr,
                                      size_t length, const void* host_ptr) {
@@ -202,62 +360,20 @@ void TraceWriter::WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr,
     host_ptr = membase_ + cmd.base_ptr;
   }
 
-  bool compress = compress_output_ && length > compression_threshold_;
-  if (compress) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
-    cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(
-        reinterpret_cast<const char*>(host_ptr), cmd.decoded_length);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length =
-        static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length,
-               SEEK_SET);
-  } else {
-    // Uncompressed - write buffer directly to the file.
-    cmd.encoding_format = MemoryEncodingFormat::kNone;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(host_ptr, 1, cmd.decoded_length, file_);
-  }
+  // Stage a snapshot copy of the memory with the command; the writer thread
+  // compresses it and patches the command on the way out. Copying here rather
+  // than referencing guest memory also fixes the payload at command time - the
+  // guest is free to scribble over it before the writer catches up.
+  AppendRecord(ChunkRecordType::kMemoryPayload, &cmd, sizeof(cmd), host_ptr,
+               length);
 }
 
 void TraceWriter::WriteEDRAMSnapshot(const void* snapshot) {
-  const uint32_t kEDRAMSize = 10 * 1024 * 1024;
-  EDRAMSnapshotCommand cmd;
-  cmd.type = TraceCommandType::kEDRAMSnapshot;
-  if (compress_output_) {
-    // Write the header now so we reserve space in the buffer.
-    long header_position = std::ftell(file_);
-    cmd.encoding_format = MemoryEncodingFormat::kSnappy;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-
-    // Stream the content right to the buffer.
-    snappy::ByteArraySource snappy_source(
-        reinterpret_cast<const char*>(snapshot), kEDRAMSize);
-    SnappySink snappy_sink(file_);
-    cmd.encoded_length =
-        static_cast<uint32_t>(snappy::Compress(&snappy_source, &snappy_sink));
-
-    // Seek back and overwrite the header with our final size.
-    std::fseek(file_, header_position, SEEK_SET);
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    std::fseek(file_, header_position + sizeof(cmd) + cmd.encoded_length,
-               SEEK_SET);
-  } else {
-    // Uncompressed - write buffer directly to the file.
-    cmd.encoding_format = MemoryEncodingFormat::kNone;
-    cmd.encoded_length = kEDRAMSize;
-    fwrite(&cmd, 1, sizeof(cmd), file_);
-    fwrite(snapshot, 1, kEDRAMSize, file_);
+  if (!file_) {
+    return;
   }
+  const uint32_t kEDRAMSize = 10 * 1024 * 1024;
+  AppendRecord(ChunkRecordType::kEDRAMPayload, snapshot, kEDRAMSize);
 }
 
 void TraceWriter::WriteEvent(EventCommand::Type event_type) {
@@ -268,7 +384,7 @@ void TraceWriter::WriteEvent(EventCommand::Type event_type) {
       TraceCommandType::kEvent,
       event_type,
   };
-  fwrite(&cmd, 1, sizeof(cmd), file_);
+  AppendRecord(ChunkRecordType::kRaw, &cmd, sizeof(cmd));
 }
 
 }  //  namespace gpu
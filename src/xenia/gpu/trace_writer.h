@@ -10,10 +10,16 @@
 #ifndef XENIA_GPU_TRACE_WRITER_H_
 #define XENIA_GPU_TRACE_WRITER_H_
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "xenia/base/filesystem.h"
+#include "xenia/base/threading.h"
 #include "xenia/gpu/trace_protocol.h"
 
 namespace xe {
@@ -46,13 +52,61 @@ class TraceWriter {
   void WriteEvent(EventCommand::Type event_type);
 
  private:
+  // Chunks staged for the writer thread are a sequence of framed records so
+  // the writer knows which byte runs still need the compression pass.
+  enum class ChunkRecordType : uint32_t {
+    // Payload is final file bytes, written through as-is.
+    kRaw,
+    // Payload is a MemoryCommand followed by its uncompressed data; the
+    // writer compresses the data and patches the command before writing.
+    kMemoryPayload,
+    // Payload is an uncompressed EDRAM snapshot; the writer builds the
+    // command around it.
+    kEDRAMPayload,
+  };
+  struct ChunkRecord {
+    ChunkRecordType type;
+    uint32_t length;
+  };
+
+  // Compresses a buffer into compression_buffer_, returning the compressed
+  // size. Writer thread only.
+  size_t Compress(const void* host_ptr, size_t length);
   void WriteMemoryCommand(TraceCommandType type, uint32_t base_ptr,
                           size_t length, const void* host_ptr = nullptr);
 
+  // Appends a framed record to the active chunk, handing the chunk to the
+  // writer thread when it reaches the target size.
+  void AppendRecord(ChunkRecordType type, const void* data, size_t length,
+                    const void* data2 = nullptr, size_t length2 = 0);
+  // Queues the active chunk for the writer thread, blocking for a free chunk
+  // if the writer has fallen more than the whole ring behind.
+  void SubmitActiveChunk();
+  // Blocks until the writer thread has drained every queued chunk.
+  void AwaitWriter();
+  void WriterThread();
+  // Writes one staged chunk to the file. Writer thread only.
+  void WriteChunk(const std::vector<uint8_t>& chunk);
+
   std::set<uint64_t> cached_memory_reads_;
+  // Reused between commands to avoid reallocation.
+  std::vector<uint8_t> compression_buffer_;
   uint8_t* membase_;
   FILE* file_;
 
+  // Chunk ring shared with the writer thread. The capture thread fills
+  // active_chunk_ without locking; only the filled/free lists and the
+  // shutdown flag are under chunk_lock_.
+  std::unique_ptr<xe::threading::Thread> writer_thread_;
+  std::vector<uint8_t> active_chunk_;
+  std::deque<std::vector<uint8_t>> filled_chunks_;
+  std::vector<std::vector<uint8_t>> free_chunks_;
+  std::mutex chunk_lock_;
+  std::condition_variable chunk_submitted_cond_;
+  std::condition_variable chunk_retired_cond_;
+  bool writer_busy_ = false;
+  bool writer_shutdown_ = false;
+
   bool compress_output_ = true;
   size_t compression_threshold_ = 1024;  // Min. number of bytes to compress.
 };
@@ -421,13 +421,6 @@ std::pair<VkDeviceSize, VkDeviceSize> BufferCache::UploadConstantRegisters(
 std::pair<VkBuffer, VkDeviceSize> BufferCache::UploadIndexBuffer(
     VkCommandBuffer command_buffer, uint32_t source_addr,
     uint32_t source_length, IndexFormat format, VkFence fence) {
-  // Allocate space in the buffer for our data.
-  auto offset = AllocateTransientData(source_length, fence);
-  if (offset == VK_WHOLE_SIZE) {
-    // OOM.
-    return {nullptr, VK_WHOLE_SIZE};
-  }
-
   const void* source_ptr = memory_->TranslatePhysical(source_addr);
 
   uint32_t prim_reset_index =
@@ -435,6 +428,28 @@ std::pair<VkBuffer, VkDeviceSize> BufferCache::UploadIndexBuffer(
   bool prim_reset_enabled =
       !!(register_file_->values[XE_GPU_REG_PA_SU_SC_MODE_CNTL].u32 & (1 << 21));
 
+  // Check for an identical upload already in the transient buffer. The
+  // transform parameters are folded into the seed since they change what
+  // ends up in the buffer.
+  uint64_t content_hash = 0;
+  if (source_length <= kMaxTransientContentLength) {
+    uint64_t content_seed = (uint64_t(format) << 33) |
+                            (uint64_t(prim_reset_enabled) << 32) |
+                            (prim_reset_enabled ? prim_reset_index : 0);
+    content_hash = XXH64(source_ptr, source_length, content_seed);
+    VkDeviceSize cached_offset = FindCachedTransientContent(content_hash);
+    if (cached_offset != VK_WHOLE_SIZE) {
+      return {transient_buffer_->gpu_buffer(), cached_offset};
+    }
+  }
+
+  // Allocate space in the buffer for our data.
+  auto offset = AllocateTransientData(source_length, fence);
+  if (offset == VK_WHOLE_SIZE) {
+    // OOM.
+    return {nullptr, VK_WHOLE_SIZE};
+  }
+
   // Copy data into the buffer. If primitive reset is enabled, translate any
   // primitive reset indices to something Vulkan understands.
   // TODO(benvanik): memcpy then use compute shaders to swap?
@@ -480,6 +495,10 @@ std::pair<VkBuffer, VkDeviceSize> BufferCache::UploadIndexBuffer(
                        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 0, nullptr, 1,
                        &barrier, 0, nullptr);
 
+  if (source_length <= kMaxTransientContentLength) {
+    CacheTransientContent(content_hash, offset);
+  }
+
   return {transient_buffer_->gpu_buffer(), offset};
 }
 
@@ -503,6 +522,20 @@ std::pair<VkBuffer, VkDeviceSize> BufferCache::UploadVertexBuffer(
   assert(upload_base <= source_addr);
   uint32_t source_offset = source_addr - upload_base;
 
+  const void* upload_ptr = memory_->TranslatePhysical(upload_base);
+
+  // The same data is often uploaded from a different location - UI quads
+  // rebuilt every frame, for instance - so also dedup by content.
+  uint64_t content_hash = 0;
+  if (upload_size <= kMaxTransientContentLength) {
+    content_hash = XXH64(upload_ptr, upload_size, uint64_t(endian));
+    VkDeviceSize cached_offset = FindCachedTransientContent(content_hash);
+    if (cached_offset != VK_WHOLE_SIZE) {
+      CacheTransientData(upload_base, upload_size, cached_offset);
+      return {transient_buffer_->gpu_buffer(), cached_offset + source_offset};
+    }
+  }
+
   // Allocate space in the buffer for our data.
   offset = AllocateTransientData(upload_size, fence);
   if (offset == VK_WHOLE_SIZE) {
@@ -514,8 +547,6 @@ std::pair<VkBuffer, VkDeviceSize> BufferCache::UploadVertexBuffer(
     return {nullptr, VK_WHOLE_SIZE};
   }
 
-  const void* upload_ptr = memory_->TranslatePhysical(upload_base);
-
   // Copy data into the buffer.
   // TODO(benvanik): memcpy then use compute shaders to swap?
   if (endian == Endian::k8in32) {
@@ -548,6 +579,9 @@ std::pair<VkBuffer, VkDeviceSize> BufferCache::UploadVertexBuffer(
                        &barrier, 0, nullptr);
 
   CacheTransientData(upload_base, upload_size, offset);
+  if (upload_size <= kMaxTransientContentLength) {
+    CacheTransientContent(content_hash, offset);
+  }
   return {transient_buffer_->gpu_buffer(), offset + source_offset};
 }
 
@@ -726,6 +760,19 @@ VkDeviceSize BufferCache::FindCachedTransientData(uint32_t guest_address,
   return VK_WHOLE_SIZE;
 }
 
+VkDeviceSize BufferCache::FindCachedTransientContent(uint64_t content_hash) {
+  auto it = transient_content_cache_.find(content_hash);
+  if (it != transient_content_cache_.end()) {
+    return it->second;
+  }
+  return VK_WHOLE_SIZE;
+}
+
+void BufferCache::CacheTransientContent(uint64_t content_hash,
+                                        VkDeviceSize offset) {
+  transient_content_cache_[content_hash] = offset;
+}
+
 void BufferCache::CacheTransientData(uint32_t guest_address,
                                      uint32_t guest_length,
                                      VkDeviceSize offset) {
@@ -767,14 +814,19 @@ void BufferCache::InvalidateCache() {
   // Called by VulkanCommandProcessor::MakeCoherent()
   // Discard everything?
   transient_cache_.clear();
+  transient_content_cache_.clear();
 }
 
-void BufferCache::ClearCache() { transient_cache_.clear(); }
+void BufferCache::ClearCache() {
+  transient_cache_.clear();
+  transient_content_cache_.clear();
+}
 
 void BufferCache::Scavenge() {
   SCOPE_profile_cpu_f("gpu");
 
   transient_cache_.clear();
+  transient_content_cache_.clear();
   transient_buffer_->Scavenge();
 
   // TODO(DrChat): These could persist across frames, we just need a smart way
@@ -145,6 +145,14 @@ class BufferCache {
   void CacheTransientData(uint32_t guest_address, uint32_t guest_length,
                           VkDeviceSize offset);
 
+  // Content-hash dedup for small transient uploads. Looks up/registers data
+  // by a hash of its post-transform identity (source bytes plus the
+  // transform parameters), so identical repeated uploads - UI quads pushing
+  // the same data every draw - reuse one copy. Entries only live until the
+  // next Scavenge, like the address-based transient cache.
+  VkDeviceSize FindCachedTransientContent(uint64_t content_hash);
+  void CacheTransientContent(uint64_t content_hash, VkDeviceSize offset);
+
   RegisterFile* register_file_ = nullptr;
   Memory* memory_ = nullptr;
   ui::vulkan::VulkanDevice* device_ = nullptr;
@@ -156,6 +164,10 @@ class BufferCache {
   // plan on keeping past the current frame.
   std::unique_ptr<ui::vulkan::CircularBuffer> transient_buffer_ = nullptr;
   std::map<uint32_t, std::pair<uint32_t, VkDeviceSize>> transient_cache_;
+  // Uploads at most this long are considered for content-hash dedup;
+  // hashing large streaming uploads would cost more than it saves.
+  static constexpr uint32_t kMaxTransientContentLength = 4096;
+  std::unordered_map<uint64_t, VkDeviceSize> transient_content_cache_;
 
   // Vertex buffer descriptors
   std::unique_ptr<ui::vulkan::DescriptorPool> vertex_descriptor_pool_ = nullptr;
@@ -10,15 +10,28 @@
 #include "xenia/gpu/vulkan/pipeline_cache.h"
 
 #include "third_party/xxhash/xxhash.h"
+#include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/string.h"
 #include "xenia/gpu/gpu_flags.h"
 #include "xenia/gpu/vulkan/vulkan_gpu_flags.h"
+#include "xenia/kernel/kernel_state.h"
 
 #include <cinttypes>
+#include <cstring>
 #include <string>
+#include <vector>
+
+DEFINE_string(
+    vulkan_pipeline_cache_dir, "",
+    "Directory where the driver pipeline cache blob is stored per title "
+    "(created if it doesn't exist), so most pipelines can be reused by the "
+    "driver on the next run of the same title. Empty to disable; the "
+    "{game_cache} placeholder is supported.",
+    "Vulkan");
 
 namespace xe {
 namespace gpu {
@@ -33,9 +46,27 @@ using xe::ui::vulkan::CheckResult;
 #include "xenia/gpu/vulkan/shaders/bin/quad_list_geom.h"
 #include "xenia/gpu/vulkan/shaders/bin/rect_list_geom.h"
 
+constexpr uint32_t kPipelineCacheStorageMagic = 'VPSO';
+constexpr uint32_t kPipelineCacheStorageVersion = 1;
+
+// Stored before the driver blob in the on-disk pipeline cache file. The blob
+// itself starts with a driver-validated header too, but checking these fields
+// here avoids passing a foreign blob to vkCreatePipelineCache at all.
+struct PipelineCacheStorageHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t vendor_id;
+  uint32_t device_id;
+  uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+  uint32_t data_size;
+};
+
 PipelineCache::PipelineCache(RegisterFile* register_file,
-                             ui::vulkan::VulkanDevice* device)
-    : register_file_(register_file), device_(device) {
+                             ui::vulkan::VulkanDevice* device,
+                             kernel::KernelState* kernel_state)
+    : register_file_(register_file),
+      device_(device),
+      kernel_state_(kernel_state) {
   shader_translator_.reset(new SpirvShaderTranslator());
 }
 
@@ -169,6 +200,8 @@ VkResult PipelineCache::Initialize(
 }
 
 void PipelineCache::Shutdown() {
+  FlushStorage();
+
   ClearCache();
 
   // Destroy geometry shaders.
@@ -287,8 +320,124 @@ void PipelineCache::ClearCache() {
   shader_map_.clear();
 }
 
+std::wstring PipelineCache::GetStoragePath() const {
+  return xe::join_paths(
+      xe::to_wstring(cvars::vulkan_pipeline_cache_dir),
+      xe::format_string(L"%.8X.vulkan.vkpso", storage_title_id_));
+}
+
+void PipelineCache::InitializeStorage() {
+  if (cvars::vulkan_pipeline_cache_dir.empty()) {
+    return;
+  }
+  // The title ID is the storage key - can't persist anything before the
+  // launched module is known.
+  uint32_t title_id = kernel_state_->title_id();
+  if (!title_id) {
+    return;
+  }
+  storage_title_id_ = title_id;
+  storage_active_ = true;
+
+  FILE* file = xe::filesystem::OpenFile(GetStoragePath(), "rb");
+  if (!file) {
+    return;
+  }
+  const VkPhysicalDeviceProperties& device_properties =
+      device_->device_info().properties;
+  PipelineCacheStorageHeader file_header;
+  std::vector<uint8_t> data;
+  bool data_valid = false;
+  if (fread(&file_header, sizeof(file_header), 1, file) == 1 &&
+      file_header.magic == kPipelineCacheStorageMagic &&
+      file_header.version == kPipelineCacheStorageVersion &&
+      file_header.vendor_id == device_properties.vendorID &&
+      file_header.device_id == device_properties.deviceID &&
+      !std::memcmp(file_header.pipeline_cache_uuid,
+                   device_properties.pipelineCacheUUID, VK_UUID_SIZE) &&
+      file_header.data_size != 0) {
+    data.resize(file_header.data_size);
+    data_valid = fread(data.data(), file_header.data_size, 1, file) == 1;
+  }
+  fclose(file);
+  if (!data_valid) {
+    // Stale or foreign blob (most likely a driver update) - drop it, it will
+    // be rewritten on shutdown.
+    XELOGGPU("Pipeline cache blob for title %.8X is incompatible; discarding",
+             title_id);
+    return;
+  }
+
+  // Merge the stored blob into the live cache instead of recreating it with
+  // initial data, so pipelines created before the title ID became known are
+  // kept as well.
+  VkPipelineCacheCreateInfo cache_info;
+  cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  cache_info.pNext = nullptr;
+  cache_info.flags = 0;
+  cache_info.initialDataSize = data.size();
+  cache_info.pInitialData = data.data();
+  VkPipelineCache stored_cache;
+  if (vkCreatePipelineCache(*device_, &cache_info, nullptr, &stored_cache) !=
+      VK_SUCCESS) {
+    return;
+  }
+  vkMergePipelineCaches(*device_, pipeline_cache_, 1, &stored_cache);
+  vkDestroyPipelineCache(*device_, stored_cache, nullptr);
+  XELOGGPU("Pipeline cache blob for title %.8X loaded (%u bytes)", title_id,
+           uint32_t(data.size()));
+}
+
+void PipelineCache::FlushStorage() {
+  if (!storage_active_ || !pipeline_cache_) {
+    return;
+  }
+  storage_active_ = false;
+  size_t data_size = 0;
+  if (vkGetPipelineCacheData(*device_, pipeline_cache_, &data_size, nullptr) !=
+          VK_SUCCESS ||
+      !data_size) {
+    return;
+  }
+  std::vector<uint8_t> data(data_size);
+  if (vkGetPipelineCacheData(*device_, pipeline_cache_, &data_size,
+                             data.data()) != VK_SUCCESS) {
+    return;
+  }
+  xe::filesystem::CreateFolder(
+      xe::to_wstring(cvars::vulkan_pipeline_cache_dir));
+  FILE* file = xe::filesystem::OpenFile(GetStoragePath(), "wb");
+  if (!file) {
+    XELOGE("Failed to write the pipeline cache blob for title %.8X",
+           storage_title_id_);
+    return;
+  }
+  const VkPhysicalDeviceProperties& device_properties =
+      device_->device_info().properties;
+  PipelineCacheStorageHeader file_header;
+  file_header.magic = kPipelineCacheStorageMagic;
+  file_header.version = kPipelineCacheStorageVersion;
+  file_header.vendor_id = device_properties.vendorID;
+  file_header.device_id = device_properties.deviceID;
+  std::memcpy(file_header.pipeline_cache_uuid,
+              device_properties.pipelineCacheUUID, VK_UUID_SIZE);
+  file_header.data_size = uint32_t(data_size);
+  fwrite(&file_header, sizeof(file_header), 1, file);
+  fwrite(data.data(), data_size, 1, file);
+  fclose(file);
+  XELOGGPU("Pipeline cache blob for title %.8X written (%u bytes)",
+           storage_title_id_, uint32_t(data_size));
+}
+
 VkPipeline PipelineCache::GetPipeline(const RenderState* render_state,
                                       uint64_t hash_key) {
+  // By the first pipeline creation the launched title is known - merge in the
+  // driver pipeline cache blob stored by the previous runs of the title.
+  if (!storage_checked_) {
+    storage_checked_ = true;
+    InitializeStorage();
+  }
+
   // Lookup the pipeline in the cache.
   auto it = cached_pipelines_.find(hash_key);
   if (it != cached_pipelines_.end()) {
@@ -1050,6 +1199,7 @@ PipelineCache::UpdateStatus PipelineCache::UpdateShaderStages(
   bool dirty = false;
   dirty |= SetShadowRegister(&regs.pa_su_sc_mode_cntl,
                              XE_GPU_REG_PA_SU_SC_MODE_CNTL);
+  dirty |= SetShadowRegister(&regs.sq_context_misc, XE_GPU_REG_SQ_CONTEXT_MISC);
   dirty |= SetShadowRegister(&regs.sq_program_cntl.value,
                              XE_GPU_REG_SQ_PROGRAM_CNTL);
   dirty |= regs.vertex_shader != vertex_shader;
@@ -1109,6 +1259,27 @@ PipelineCache::UpdateStatus PipelineCache::UpdateShaderStages(
     geometry_pipeline_stage.pSpecializationInfo = nullptr;
   }
 
+  // Specialize the pixel shader for the PsParamGen interpolator index - the
+  // module is translated once, the actual value is baked into the pipeline by
+  // the driver. Entries not present in the module (such as in the dummy pixel
+  // shader) are ignored.
+  uint32_t ps_param_gen = (regs.sq_context_misc >> 8) & 0xFF;
+  update_shader_stages_pixel_spec_constants_[0] =
+      regs.sq_program_cntl.param_gen ? ps_param_gen : 0xFFFFFFFFu;
+  auto& ps_param_gen_map_entry =
+      update_shader_stages_pixel_spec_map_entries_[0];
+  ps_param_gen_map_entry.constantID = kSpirvSpecConstPsParamGen;
+  ps_param_gen_map_entry.offset = 0;
+  ps_param_gen_map_entry.size = sizeof(uint32_t);
+  update_shader_stages_pixel_spec_info_.mapEntryCount = static_cast<uint32_t>(
+      xe::countof(update_shader_stages_pixel_spec_map_entries_));
+  update_shader_stages_pixel_spec_info_.pMapEntries =
+      update_shader_stages_pixel_spec_map_entries_;
+  update_shader_stages_pixel_spec_info_.dataSize =
+      sizeof(update_shader_stages_pixel_spec_constants_);
+  update_shader_stages_pixel_spec_info_.pData =
+      update_shader_stages_pixel_spec_constants_;
+
   auto& pixel_pipeline_stage =
       update_shader_stages_info_[update_shader_stages_stage_count_++];
   pixel_pipeline_stage.sType =
@@ -1119,7 +1290,8 @@ PipelineCache::UpdateStatus PipelineCache::UpdateShaderStages(
   pixel_pipeline_stage.module =
       pixel_shader ? pixel_shader->shader_module() : dummy_pixel_shader_;
   pixel_pipeline_stage.pName = "main";
-  pixel_pipeline_stage.pSpecializationInfo = nullptr;
+  pixel_pipeline_stage.pSpecializationInfo =
+      &update_shader_stages_pixel_spec_info_;
 
   return UpdateStatus::kMismatch;
 }
@@ -10,6 +10,7 @@
 #ifndef XENIA_GPU_VULKAN_PIPELINE_CACHE_H_
 #define XENIA_GPU_VULKAN_PIPELINE_CACHE_H_
 
+#include <string>
 #include <unordered_map>
 
 #include "third_party/xxhash/xxhash.h"
@@ -24,6 +25,9 @@
 #include "xenia/ui/vulkan/vulkan_device.h"
 
 namespace xe {
+namespace kernel {
+class KernelState;
+}  // namespace kernel
 namespace gpu {
 namespace vulkan {
 
@@ -38,7 +42,8 @@ class PipelineCache {
     kError,
   };
 
-  PipelineCache(RegisterFile* register_file, ui::vulkan::VulkanDevice* device);
+  PipelineCache(RegisterFile* register_file, ui::vulkan::VulkanDevice* device,
+                kernel::KernelState* kernel_state);
   ~PipelineCache();
 
   VkResult Initialize(VkDescriptorSetLayout uniform_descriptor_set_layout,
@@ -78,6 +83,13 @@ class PipelineCache {
   // state.
   VkPipeline GetPipeline(const RenderState* render_state, uint64_t hash_key);
 
+  // Driver pipeline cache blob storage (--vulkan_pipeline_cache_dir) - the
+  // blob is loaded and merged into pipeline_cache_ once the launched title is
+  // known, and written back on shutdown.
+  std::wstring GetStoragePath() const;
+  void InitializeStorage();
+  void FlushStorage();
+
   bool TranslateShader(VulkanShader* shader, reg::SQ_PROGRAM_CNTL cntl);
 
   void DumpShaderDisasmAMD(VkPipeline pipeline);
@@ -89,6 +101,7 @@ class PipelineCache {
                                    bool is_line_mode);
 
   RegisterFile* register_file_ = nullptr;
+  kernel::KernelState* kernel_state_ = nullptr;
   ui::vulkan::VulkanDevice* device_ = nullptr;
 
   // Reusable shader translator.
@@ -98,9 +111,17 @@ class PipelineCache {
   // All loaded shaders mapped by their guest hash key.
   std::unordered_map<uint64_t, VulkanShader*> shader_map_;
 
-  // Vulkan pipeline cache, which in theory helps us out.
-  // This can be serialized to disk and reused, if we want.
+  // Vulkan pipeline cache, giving the driver a chance to reuse previously
+  // compiled pipelines - persisted to disk per title when
+  // --vulkan_pipeline_cache_dir is set.
   VkPipelineCache pipeline_cache_ = nullptr;
+  // Whether loading the stored pipeline cache blob has been attempted - the
+  // title ID isn't known yet during Initialize, so it's done lazily on the
+  // first pipeline creation.
+  bool storage_checked_ = false;
+  // Whether the blob should be written back on shutdown.
+  bool storage_active_ = false;
+  uint32_t storage_title_id_ = 0;
   // Layout used for all pipelines describing our uniforms, textures, and push
   // constants.
   VkPipelineLayout pipeline_layout_ = nullptr;
@@ -169,6 +190,7 @@ class PipelineCache {
   struct UpdateShaderStagesRegisters {
     PrimitiveType primitive_type;
     uint32_t pa_su_sc_mode_cntl;
+    uint32_t sq_context_misc;
     reg::SQ_PROGRAM_CNTL sq_program_cntl;
     VulkanShader* vertex_shader;
     VulkanShader* pixel_shader;
@@ -178,6 +200,11 @@ class PipelineCache {
   } update_shader_stages_regs_;
   VkPipelineShaderStageCreateInfo update_shader_stages_info_[3];
   uint32_t update_shader_stages_stage_count_ = 0;
+  // Pixel shader specialization constants, provided at pipeline creation so
+  // one translated module covers all variants.
+  uint32_t update_shader_stages_pixel_spec_constants_[1];
+  VkSpecializationMapEntry update_shader_stages_pixel_spec_map_entries_[1];
+  VkSpecializationInfo update_shader_stages_pixel_spec_info_;
 
   struct UpdateVertexInputStateRegisters {
     VulkanShader* vertex_shader;
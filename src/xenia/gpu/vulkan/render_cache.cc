@@ -668,8 +668,19 @@ const RenderState* RenderCache::BeginRenderPass(VkCommandBuffer command_buffer,
   SCOPE_profile_cpu_f("gpu");
 #endif  // FINE_GRAINED_DRAW_SCOPES
 
-  assert_null(current_command_buffer_);
-  current_command_buffer_ = command_buffer;
+  // A render pass may still be open from the previous draw - it's either kept
+  // open (when the new state resolves to the same pass and framebuffer) or
+  // ended below once the new configuration is known.
+  bool previous_pass_open = current_command_buffer_ != nullptr;
+  CachedRenderPass* previous_render_pass =
+      previous_pass_open ? current_state_.render_pass : nullptr;
+  CachedFramebuffer* previous_framebuffer =
+      previous_pass_open ? current_state_.framebuffer : nullptr;
+  if (previous_pass_open) {
+    assert_true(current_command_buffer_ == command_buffer);
+  } else {
+    current_command_buffer_ = command_buffer;
+  }
 
   // Lookup or construct a render pass compatible with our current state.
   auto config = &current_state_.config;
@@ -703,12 +714,18 @@ const RenderState* RenderCache::BeginRenderPass(VkCommandBuffer command_buffer,
   } else {
     // Re-parse configuration.
     if (!ParseConfiguration(config)) {
+      if (previous_pass_open) {
+        EndRenderPass();
+      }
       return nullptr;
     }
 
     // Lookup or generate a new render pass and framebuffer for the new state.
     if (!ConfigureRenderPass(command_buffer, config, &render_pass,
                              &framebuffer)) {
+      if (previous_pass_open) {
+        EndRenderPass();
+      }
       return nullptr;
     }
 
@@ -737,9 +754,23 @@ const RenderState* RenderCache::BeginRenderPass(VkCommandBuffer command_buffer,
     */
   }
   if (!render_pass) {
+    if (previous_pass_open) {
+      EndRenderPass();
+    }
     return nullptr;
   }
 
+  if (previous_pass_open) {
+    if (render_pass == previous_render_pass &&
+        framebuffer == previous_framebuffer) {
+      // The new state draws to the same attachments through the same pass -
+      // merge the draws into the pass that is already open.
+      return &current_state_;
+    }
+    // Incompatible - the open pass has to be ended before beginning a new one.
+    vkCmdEndRenderPass(command_buffer);
+  }
+
   // Setup render pass in command buffer.
   // This is meant to preserve previous contents as we may be called
   // repeatedly.
@@ -290,6 +290,12 @@ class RenderCache {
 
   // Begins a render pass targeting the state-specified framebuffer formats.
   // The command buffer will be transitioned into the render pass phase.
+  // May be called with a render pass still open in the same command buffer -
+  // if the new state resolves to the same render pass and framebuffer, the
+  // open pass is kept and no begin/end is recorded, otherwise the open pass is
+  // ended first. Merging passes this way avoids needless attachment load/store
+  // round trips on tile-based hardware and driver overhead everywhere when
+  // only draw state (such as the window scissor) has changed between draws.
   const RenderState* BeginRenderPass(VkCommandBuffer command_buffer,
                                      VulkanShader* vertex_shader,
                                      VulkanShader* pixel_shader);
@@ -11,6 +11,8 @@
 #include "xenia/gpu/vulkan/texture_config.h"
 
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
@@ -25,6 +27,13 @@
 
 DECLARE_bool(texture_dump);
 
+DEFINE_int32(vulkan_texture_cache_limit, 512,
+             "Maximum host texture memory usage (in megabytes) above which "
+             "the least recently used textures will be evicted at the end of "
+             "the frame. Evicted textures are re-uploaded from guest memory "
+             "if they are needed again.",
+             "Vulkan");
+
 namespace xe {
 namespace gpu {
 
@@ -37,6 +46,10 @@ using xe::ui::vulkan::CheckResult;
 constexpr uint32_t kMaxTextureSamplers = 32;
 constexpr VkDeviceSize kStagingBufferSize = 64 * 1024 * 1024;
 
+namespace {
+MemoryCounter texture_cache_memory("gpu/vulkan/texture_cache");
+}  // namespace
+
 const char* get_dimension_name(Dimension dimension) {
   static const char* names[] = {
       "1D",
@@ -303,6 +316,12 @@ TextureCache::Texture* TextureCache::AllocateTexture(
   texture->usage_flags = image_info.usage;
   texture->is_watched = false;
   texture->texture_info = texture_info;
+  texture->last_usage_frame = current_frame_;
+
+  textures_total_size_ += texture->alloc_info.size;
+  texture_cache_memory.Add(texture->alloc_info.size);
+  COUNT_profile_set("gpu/texture_cache/total_size_mb",
+                    uint32_t(textures_total_size_ >> 20));
   return texture;
 }
 
@@ -340,6 +359,10 @@ bool TextureCache::FreeTexture(Texture* texture) {
   }
 
   vmaDestroyImage(mem_allocator_, texture->image, texture->alloc);
+  textures_total_size_ -= texture->alloc_info.size;
+  texture_cache_memory.Remove(texture->alloc_info.size);
+  COUNT_profile_set("gpu/texture_cache/total_size_mb",
+                    uint32_t(textures_total_size_ >> 20));
   delete texture;
   return true;
 }
@@ -496,6 +519,7 @@ TextureCache::Texture* TextureCache::DemandResolveTexture(
                                              texture_info.memory.mip_size);
       }
 
+      MarkTextureUsed(it->second);
       return it->second;
     }
   }
@@ -555,6 +579,7 @@ TextureCache::Texture* TextureCache::Demand(const TextureInfo& texture_info,
         trace_writer_->WriteMemoryReadCached(texture_info.memory.mip_address,
                                              texture_info.memory.mip_size);
       }
+      MarkTextureUsed(it->second);
       return it->second;
     }
   }
@@ -721,9 +746,11 @@ TextureCache::Sampler* TextureCache::Demand(const SamplerInfo& sampler_info) {
   for (auto it = samplers_.find(sampler_hash); it != samplers_.end(); ++it) {
     if (it->second->sampler_info == sampler_info) {
       // Found a compatible sampler.
+      ++sampler_hits_;
       return it->second;
     }
   }
+  ++sampler_misses_;
 
   VkResult status = VK_SUCCESS;
 
@@ -848,6 +875,7 @@ TextureCache::Sampler* TextureCache::Demand(const SamplerInfo& sampler_info) {
   sampler->sampler = vk_sampler;
   sampler->sampler_info = sampler_info;
   samplers_[sampler_hash] = sampler;
+  COUNT_profile_set("gpu/texture_cache/samplers", samplers_.size());
 
   return sampler;
 }
@@ -870,6 +898,7 @@ TextureCache::Texture* TextureCache::Lookup(const TextureInfo& texture_info) {
   auto texture_hash = texture_info.hash();
   for (auto it = textures_.find(texture_hash); it != textures_.end(); ++it) {
     if (it->second->texture_info == texture_info) {
+      MarkTextureUsed(it->second);
       return it->second;
     }
   }
@@ -903,6 +932,7 @@ TextureCache::Texture* TextureCache::Lookup(const TextureInfo& texture_info) {
     COMPARE_FIELD(block_height);
     COMPARE_FIELD(bits_per_pixel);
 #undef COMPARE_FIELD*/
+    MarkTextureUsed(it->second);
     return it->second;
   }
 
@@ -931,6 +961,7 @@ TextureCache::Texture* TextureCache::LookupAddress(uint32_t guest_address,
         }
       }
 
+      MarkTextureUsed(it->second);
       return it->second;
     }
 
@@ -942,6 +973,7 @@ TextureCache::Texture* TextureCache::LookupAddress(uint32_t guest_address,
         out_offset->y = 0;
       }
 
+      MarkTextureUsed(it->second);
       return it->second;
     }
   }
@@ -1024,7 +1056,13 @@ bool TextureCache::ConvertTexture(uint8_t* dest, VkBufferImageCopy* copy_region,
     }
   } else {
     // Untile image.
-    // We could do this in a shader to speed things up, as this is pretty slow.
+    // This is the last remaining CPU-side untiling path - the D3D12 backend
+    // already reads raw tiled guest memory and does the address translation
+    // and endian swap in the texture_load_* compute shaders
+    // (d3d12/texture_cache.cc). Doing the same here needs equivalent SPIR-V
+    // kernels (generated with `xb genspirv`) dispatched into staging_buffer_
+    // before the buffer-to-image copy; until then the batched swap path in
+    // Untile keeps this tolerable.
     for (uint32_t face = 0; face < dst_extent.depth; face++) {
       texture_conversion::UntileInfo untile_info;
       std::memset(&untile_info, 0, sizeof(untile_info));
@@ -1039,6 +1077,13 @@ bool TextureCache::ConvertTexture(uint8_t* dest, VkBufferImageCopy* copy_region,
       untile_info.copy_callback = [=](auto o, auto i, auto l) {
         copy_block(src.endianness, o, i, l);
       };
+      // CTX1 and DXT3A are the only formats whose copy does more than an
+      // endian swap (see GetFormatCopyBlock) - everything else can take the
+      // batched swap path in Untile.
+      untile_info.copy_is_plain_swap =
+          src.format != TextureFormat::k_CTX1 &&
+          src.format != TextureFormat::k_DXT3A;
+      untile_info.endianness = src.endianness;
       texture_conversion::Untile(dest, src_mem, &untile_info);
       src_mem += src_pitch * src_extent.block_pitch_v;
       dest += dst_pitch * dst_extent.block_pitch_v;
@@ -1552,6 +1597,7 @@ bool TextureCache::SetupTextureBinding(VkCommandBuffer command_buffer,
   image_info->imageLayout = texture->image_layout;
   image_info->sampler = sampler->sampler;
   texture->in_flight_fence = completion_fence;
+  MarkTextureUsed(texture);
 
   return true;
 }
@@ -1585,6 +1631,64 @@ void TextureCache::RemoveInvalidatedTextures() {
   }
 }
 
+void TextureCache::MarkTextureUsed(Texture* texture) {
+  texture->last_usage_frame = current_frame_;
+}
+
+void TextureCache::EvictTexturesUntilUnderBudget() {
+  uint64_t limit =
+      uint64_t(std::max(cvars::vulkan_texture_cache_limit, 0)) << 20;
+  if (textures_total_size_ <= limit) {
+    return;
+  }
+
+  // Gather the eviction candidates - everything not demanded or bound this
+  // frame - and queue the least recently used ones for deletion until the
+  // cache is back under its budget. The guest copy in physical memory
+  // remains the backing store, so an evicted texture is simply re-uploaded
+  // if it's ever demanded again.
+  std::vector<std::pair<uint64_t, Texture*>> candidates;
+  candidates.reserve(textures_.size());
+  for (const auto& texture_pair : textures_) {
+    Texture* texture = texture_pair.second;
+    if (texture->last_usage_frame < current_frame_ &&
+        !texture->pending_invalidation) {
+      candidates.push_back({texture_pair.first, texture});
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<uint64_t, Texture*>& a,
+               const std::pair<uint64_t, Texture*>& b) {
+              return a.second->last_usage_frame < b.second->last_usage_frame;
+            });
+
+  // Deletion (and the total size update) happens once the texture's last
+  // usage fence signals, so track the evicted size separately.
+  uint64_t evicted_size = 0;
+  size_t evicted_count = 0;
+  for (const auto& candidate : candidates) {
+    if (textures_total_size_ - evicted_size <= limit) {
+      break;
+    }
+    textures_.erase(candidate.first);
+    pending_delete_textures_.push_back(candidate.second);
+    evicted_size += candidate.second->alloc_info.size;
+    ++evicted_count;
+  }
+  if (evicted_count != 0) {
+    texture_evictions_ += evicted_count;
+    XELOGGPU(
+        "Texture Cache: Evicted %u textures (%uMB) over the %uMB budget",
+        uint32_t(evicted_count), uint32_t(evicted_size >> 20),
+        uint32_t(limit >> 20));
+    COUNT_profile_set("gpu/texture_cache/textures", textures_.size());
+    COUNT_profile_set("gpu/texture_cache/pending_deletes",
+                      pending_delete_textures_.size());
+    COUNT_profile_set("gpu/texture_cache/evictions",
+                      uint32_t(texture_evictions_));
+  }
+}
+
 void TextureCache::ClearCache() {
   RemoveInvalidatedTextures();
   for (auto it = textures_.begin(); it != textures_.end(); ++it) {
@@ -1601,11 +1705,21 @@ void TextureCache::ClearCache() {
     delete it->second;
   }
   samplers_.clear();
+  COUNT_profile_set("gpu/texture_cache/samplers", 0);
 }
 
 void TextureCache::Scavenge() {
   SCOPE_profile_cpu_f("gpu");
 
+  // Report and reset the per-frame sampler demand hit rate. Most titles use
+  // only a few dozen unique samplers, so nearly all of the thousands of
+  // demands in a frame should be hits.
+  COUNT_profile_set("gpu/texture_cache/sampler_demand_hits", sampler_hits_);
+  COUNT_profile_set("gpu/texture_cache/sampler_demand_misses",
+                    sampler_misses_);
+  sampler_hits_ = 0;
+  sampler_misses_ = 0;
+
   // Close any open descriptor pool batches
   if (descriptor_pool_->has_open_batch()) {
     descriptor_pool_->EndBatch();
@@ -1620,6 +1734,10 @@ void TextureCache::Scavenge() {
 
   // Kill all pending delete textures.
   RemoveInvalidatedTextures();
+  // If the cache has outgrown its budget, queue the least recently used
+  // textures for deletion as well.
+  EvictTexturesUntilUnderBudget();
+  ++current_frame_;
   if (!pending_delete_textures_.empty()) {
     for (auto it = pending_delete_textures_.begin();
          it != pending_delete_textures_.end();) {
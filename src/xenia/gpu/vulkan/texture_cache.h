@@ -58,6 +58,9 @@ class TextureCache {
 
     // Pointer to the latest usage fence.
     VkFence in_flight_fence;
+
+    // Frame the texture was last demanded or bound in, for LRU eviction.
+    uint64_t last_usage_frame;
   };
 
   struct TextureView {
@@ -200,6 +203,13 @@ class TextureCache {
   // Removes invalidated textures from the cache, queues them for delete.
   void RemoveInvalidatedTextures();
 
+  // Updates the last usage frame of the texture for LRU eviction.
+  void MarkTextureUsed(Texture* texture);
+  // Queues the least recently used textures for deletion until host texture
+  // memory usage is back under the vulkan_texture_cache_limit budget.
+  // Textures used in the current frame are never evicted.
+  void EvictTexturesUntilUnderBudget();
+
   Memory* memory_ = nullptr;
 
   RegisterFile* register_file_ = nullptr;
@@ -217,7 +227,17 @@ class TextureCache {
   ui::vulkan::CircularBuffer staging_buffer_;
   ui::vulkan::CircularBuffer wb_staging_buffer_;
   std::unordered_map<uint64_t, Texture*> textures_;
+  // Total allocation size of the textures in textures_, in bytes.
+  uint64_t textures_total_size_ = 0;
+  // Monotonic frame index, incremented in Scavenge; used for last-use
+  // tracking of textures.
+  uint64_t current_frame_ = 1;
+  // Number of textures evicted over the budget since creation.
+  uint64_t texture_evictions_ = 0;
   std::unordered_map<uint64_t, Sampler*> samplers_;
+  // Per-frame sampler demand statistics, reported and reset in Scavenge.
+  uint32_t sampler_hits_ = 0;
+  uint32_t sampler_misses_ = 0;
   std::list<Texture*> pending_delete_textures_;
 
   void* physical_write_watch_handle_ = nullptr;
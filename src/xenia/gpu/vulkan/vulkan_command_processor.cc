@@ -108,7 +108,8 @@ bool VulkanCommandProcessor::SetupContext() {
     return false;
   }
 
-  pipeline_cache_ = std::make_unique<PipelineCache>(register_file_, device_);
+  pipeline_cache_ =
+      std::make_unique<PipelineCache>(register_file_, device_, kernel_state_);
   status = pipeline_cache_->Initialize(
       buffer_cache_->constant_descriptor_set_layout(),
       texture_cache_->texture_descriptor_set_layout(),
@@ -647,13 +648,11 @@ bool VulkanCommandProcessor::IssueDraw(PrimitiveType primitive_type,
 
   // Begin the render pass.
   // This will setup our framebuffer and begin the pass in the command buffer.
-  // This reuses a previous render pass if one is already open.
+  // This reuses a previous render pass if one is already open, including when
+  // registers have changed but the new state still resolves to the same pass
+  // and framebuffer - in that case the render cache merges the draws into the
+  // open pass instead of ending and beginning it again.
   if (render_cache_->dirty() || !current_render_state_) {
-    if (current_render_state_) {
-      render_cache_->EndRenderPass();
-      current_render_state_ = nullptr;
-    }
-
     full_update = true;
     current_render_state_ = render_cache_->BeginRenderPass(
         command_buffer, vertex_shader, pixel_shader);
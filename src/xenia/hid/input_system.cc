@@ -9,18 +9,141 @@
 
 #include "xenia/hid/input_system.h"
 
+#include <cstring>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/filesystem.h"
+#include "xenia/base/frame_timeline.h"
+#include "xenia/base/logging.h"
 #include "xenia/base/profiling.h"
+#include "xenia/base/string.h"
 #include "xenia/hid/hid_flags.h"
 #include "xenia/hid/input_driver.h"
 
+DEFINE_string(input_record_file, "",
+              "File to record guest input queries to, stamped with guest "
+              "time, for later deterministic replay (empty to disable).",
+              "HID");
+DEFINE_string(input_replay_file, "",
+              "Input trace to replay instead of reading real devices. Guest "
+              "input queries are answered from the trace according to guest "
+              "time, so a recorded session plays back deterministically.",
+              "HID");
+
 namespace xe {
 namespace hid {
 
+namespace {
+
+const uint32_t kInputTraceMagic = 0x58495452;  // 'XITR'
+const uint32_t kInputTraceVersion = 1;
+
+struct InputTraceHeader {
+  uint32_t magic;
+  uint32_t version;
+};
+
+}  // namespace
+
 InputSystem::InputSystem(xe::ui::Window* window) : window_(window) {}
 
-InputSystem::~InputSystem() = default;
+InputSystem::~InputSystem() {
+  if (record_file_) {
+    fclose(record_file_);
+    record_file_ = nullptr;
+  }
+}
+
+X_STATUS InputSystem::Setup() {
+  if (!cvars::input_replay_file.empty()) {
+    if (LoadReplayTrace()) {
+      replay_active_ = true;
+      XELOGI("Replaying input from %s", cvars::input_replay_file.c_str());
+    } else {
+      XELOGE("Failed to load input trace %s",
+             cvars::input_replay_file.c_str());
+    }
+  } else if (!cvars::input_record_file.empty()) {
+    record_file_ = xe::filesystem::OpenFile(
+        xe::to_wstring(cvars::input_record_file), "wb");
+    if (record_file_) {
+      InputTraceHeader header;
+      header.magic = kInputTraceMagic;
+      header.version = kInputTraceVersion;
+      fwrite(&header, sizeof(header), 1, record_file_);
+      XELOGI("Recording input to %s", cvars::input_record_file.c_str());
+    } else {
+      XELOGE("Failed to open input trace %s for writing",
+             cvars::input_record_file.c_str());
+    }
+  }
+  return X_STATUS_SUCCESS;
+}
+
+bool InputSystem::LoadReplayTrace() {
+  FILE* file = xe::filesystem::OpenFile(
+      xe::to_wstring(cvars::input_replay_file), "rb");
+  if (!file) {
+    return false;
+  }
+  InputTraceHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1 ||
+      header.magic != kInputTraceMagic ||
+      header.version != kInputTraceVersion) {
+    fclose(file);
+    return false;
+  }
+  InputTraceRecord record;
+  while (fread(&record, sizeof(record), 1, file) == 1) {
+    if (record.user_index >= kMaxTraceUsers) {
+      continue;
+    }
+    replay_records_[record.user_index].push_back(record);
+  }
+  fclose(file);
+  return true;
+}
+
+void InputSystem::RecordState(uint32_t user_index, X_RESULT result,
+                              const X_INPUT_STATE* state) {
+  InputTraceRecord record;
+  record.guest_ticks = Clock::QueryGuestTickCount();
+  record.user_index = user_index;
+  record.result = result;
+  if (result == X_ERROR_SUCCESS) {
+    record.state = *state;
+  } else {
+    std::memset(&record.state, 0, sizeof(record.state));
+  }
+  std::lock_guard<std::mutex> lock(trace_mutex_);
+  if (record_file_) {
+    fwrite(&record, sizeof(record), 1, record_file_);
+  }
+}
 
-X_STATUS InputSystem::Setup() { return X_STATUS_SUCCESS; }
+X_RESULT InputSystem::GetReplayState(uint32_t user_index,
+                                     X_INPUT_STATE* out_state) {
+  std::lock_guard<std::mutex> lock(trace_mutex_);
+  auto& records = replay_records_[user_index];
+  size_t& cursor = replay_cursors_[user_index];
+  uint64_t now_ticks = Clock::QueryGuestTickCount();
+  while (cursor < records.size() &&
+         records[cursor].guest_ticks <= now_ticks) {
+    ++cursor;
+  }
+  if (!cursor) {
+    // Nothing recorded for this pad yet at this point of the session.
+    return X_ERROR_DEVICE_NOT_CONNECTED;
+  }
+  // Hold the last passed record - both its state and its result, so
+  // disconnects replay too.
+  const InputTraceRecord& record = records[cursor - 1];
+  if (record.result == X_ERROR_SUCCESS) {
+    *out_state = record.state;
+  }
+  return record.result;
+}
 
 void InputSystem::AddDriver(std::unique_ptr<InputDriver> driver) {
   drivers_.push_back(std::move(driver));
@@ -30,6 +153,27 @@ X_RESULT InputSystem::GetCapabilities(uint32_t user_index, uint32_t flags,
                                       X_INPUT_CAPABILITIES* out_caps) {
   SCOPE_profile_cpu_f("hid");
 
+  if (replay_active_) {
+    // Report a standard gamepad for every pad present in the trace.
+    if (user_index >= kMaxTraceUsers ||
+        replay_records_[user_index].empty()) {
+      return X_ERROR_DEVICE_NOT_CONNECTED;
+    }
+    std::memset(out_caps, 0, sizeof(*out_caps));
+    out_caps->type = 0x01;      // XINPUT_DEVTYPE_GAMEPAD
+    out_caps->sub_type = 0x01;  // XINPUT_DEVSUBTYPE_GAMEPAD
+    out_caps->gamepad.buttons = 0xFFFF;
+    out_caps->gamepad.left_trigger = 0xFF;
+    out_caps->gamepad.right_trigger = 0xFF;
+    out_caps->gamepad.thumb_lx = int16_t(0xFFC0);
+    out_caps->gamepad.thumb_ly = int16_t(0xFFC0);
+    out_caps->gamepad.thumb_rx = int16_t(0xFFC0);
+    out_caps->gamepad.thumb_ry = int16_t(0xFFC0);
+    out_caps->vibration.left_motor_speed = 0xFFFF;
+    out_caps->vibration.right_motor_speed = 0xFFFF;
+    return X_ERROR_SUCCESS;
+  }
+
   bool any_connected = false;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->GetCapabilities(user_index, flags, out_caps);
@@ -46,23 +190,47 @@ X_RESULT InputSystem::GetCapabilities(uint32_t user_index, uint32_t flags,
 X_RESULT InputSystem::GetState(uint32_t user_index, X_INPUT_STATE* out_state) {
   SCOPE_profile_cpu_f("hid");
 
+  // The latest poll before a swap bounds how fresh that frame's input can be.
+  FrameTimeline::RecordInputPoll();
+
+  if (replay_active_) {
+    if (user_index >= kMaxTraceUsers) {
+      return X_ERROR_DEVICE_NOT_CONNECTED;
+    }
+    return GetReplayState(user_index, out_state);
+  }
+
   bool any_connected = false;
+  X_RESULT combined_result = X_ERROR_DEVICE_NOT_CONNECTED;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->GetState(user_index, out_state);
     if (result != X_ERROR_DEVICE_NOT_CONNECTED) {
       any_connected = true;
     }
     if (result == X_ERROR_SUCCESS) {
-      return result;
+      combined_result = result;
+      break;
     }
   }
-  return any_connected ? X_ERROR_EMPTY : X_ERROR_DEVICE_NOT_CONNECTED;
+  if (combined_result != X_ERROR_SUCCESS) {
+    combined_result = any_connected ? X_ERROR_EMPTY
+                                    : X_ERROR_DEVICE_NOT_CONNECTED;
+  }
+  if (record_file_ && user_index < kMaxTraceUsers) {
+    RecordState(user_index, combined_result, out_state);
+  }
+  return combined_result;
 }
 
 X_RESULT InputSystem::SetState(uint32_t user_index,
                                X_INPUT_VIBRATION* vibration) {
   SCOPE_profile_cpu_f("hid");
 
+  if (replay_active_) {
+    // Swallow vibration during replay; there is no device to rumble.
+    return X_ERROR_SUCCESS;
+  }
+
   bool any_connected = false;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->SetState(user_index, vibration);
@@ -80,6 +248,11 @@ X_RESULT InputSystem::GetKeystroke(uint32_t user_index, uint32_t flags,
                                    X_INPUT_KEYSTROKE* out_keystroke) {
   SCOPE_profile_cpu_f("hid");
 
+  if (replay_active_) {
+    // Keystrokes aren't traced; titles fall back to polling GetState.
+    return X_ERROR_EMPTY;
+  }
+
   bool any_connected = false;
   for (auto& driver : drivers_) {
     X_RESULT result = driver->GetKeystroke(user_index, flags, out_keystroke);
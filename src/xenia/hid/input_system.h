@@ -10,7 +10,9 @@
 #ifndef XENIA_HID_INPUT_SYSTEM_H_
 #define XENIA_HID_INPUT_SYSTEM_H_
 
+#include <cstdio>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "xenia/hid/input.h"
@@ -45,9 +47,33 @@ class InputSystem {
                         X_INPUT_KEYSTROKE* out_keystroke);
 
  private:
+  // One guest input query captured to (or replayed from) an input trace
+  // (input_record_file / input_replay_file), stamped with the guest tick
+  // count so replay follows guest time, including time scaling.
+  struct InputTraceRecord {
+    uint64_t guest_ticks;
+    uint32_t user_index;
+    uint32_t result;
+    X_INPUT_STATE state;
+  };
+  static const uint32_t kMaxTraceUsers = 4;
+
+  bool LoadReplayTrace();
+  void RecordState(uint32_t user_index, X_RESULT result,
+                   const X_INPUT_STATE* state);
+  X_RESULT GetReplayState(uint32_t user_index, X_INPUT_STATE* out_state);
+
   xe::ui::Window* window_ = nullptr;
 
   std::vector<std::unique_ptr<InputDriver>> drivers_;
+
+  std::mutex trace_mutex_;
+  FILE* record_file_ = nullptr;
+  bool replay_active_ = false;
+  // Per-user records in guest tick order with a cursor at the last record
+  // whose time has passed.
+  std::vector<InputTraceRecord> replay_records_[kMaxTraceUsers];
+  size_t replay_cursors_[kMaxTraceUsers] = {};
 };
 
 }  // namespace hid
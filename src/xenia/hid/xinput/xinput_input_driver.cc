@@ -14,12 +14,41 @@
 
 #include <xinput.h>  // NOLINT(build/include_order)
 
+#include <algorithm>
+#include <chrono>
+
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
 #include "xenia/hid/hid_flags.h"
 
+DEFINE_int32(xinput_poll_hz, 240,
+             "Rate at which a background thread samples pads for timestamped "
+             "state-change events. Guest input reads are then served from the "
+             "freshest sample instead of a blocking XInput call. 0 disables "
+             "the thread and samples synchronously.",
+             "HID")
+
 namespace xe {
 namespace hid {
 namespace xinput {
 
+namespace {
+
+void CopyGamepadState(const XINPUT_STATE& native_state,
+                      X_INPUT_STATE* out_state) {
+  out_state->packet_number = native_state.dwPacketNumber;
+  out_state->gamepad.buttons = native_state.Gamepad.wButtons;
+  out_state->gamepad.left_trigger = native_state.Gamepad.bLeftTrigger;
+  out_state->gamepad.right_trigger = native_state.Gamepad.bRightTrigger;
+  out_state->gamepad.thumb_lx = native_state.Gamepad.sThumbLX;
+  out_state->gamepad.thumb_ly = native_state.Gamepad.sThumbLY;
+  out_state->gamepad.thumb_rx = native_state.Gamepad.sThumbRX;
+  out_state->gamepad.thumb_ry = native_state.Gamepad.sThumbRY;
+}
+
+}  // namespace
+
 XInputInputDriver::XInputInputDriver(xe::ui::Window* window)
     : InputDriver(window),
       module_(nullptr),
@@ -30,6 +59,11 @@ XInputInputDriver::XInputInputDriver(xe::ui::Window* window)
       XInputEnable_(nullptr) {}
 
 XInputInputDriver::~XInputInputDriver() {
+  if (polling_thread_) {
+    polling_running_ = false;
+    xe::threading::Wait(polling_thread_.get(), true);
+    polling_thread_.reset();
+  }
   if (module_) {
     FreeLibrary((HMODULE)module_);
     module_ = nullptr;
@@ -71,9 +105,119 @@ X_STATUS XInputInputDriver::Setup() {
   XInputGetKeystroke_ = xigk;
   XInputSetState_ = xiss;
   XInputEnable_ = xie;
+
+  if (cvars::xinput_poll_hz > 0) {
+    polling_running_ = true;
+    polling_thread_ =
+        xe::threading::Thread::Create({}, [this]() { PollingThreadMain(); });
+    if (polling_thread_) {
+      polling_thread_->set_name("XInput Poll");
+    } else {
+      polling_running_ = false;
+    }
+  }
+
   return X_STATUS_SUCCESS;
 }
 
+void XInputInputDriver::PollingThreadMain() {
+  auto xigs = (decltype(&XInputGetState))XInputGetState_;
+  uint64_t tick_frequency = Clock::QueryHostTickFrequency();
+  auto poll_interval = std::chrono::microseconds(
+      1000000 / std::max(cvars::xinput_poll_hz, int32_t(1)));
+
+  uint32_t last_packet_number[kMaxUserCount] = {0};
+  bool last_connected[kMaxUserCount] = {false};
+  bool pad_primed[kMaxUserCount] = {false};
+  uint64_t next_reconnect_ticks[kMaxUserCount] = {0};
+
+  while (polling_running_) {
+    uint64_t now_ticks = Clock::QueryHostTickCount();
+    for (uint32_t i = 0; i < kMaxUserCount; ++i) {
+      // XInputGetState is expensive for empty slots; revisit disconnected
+      // pads roughly once a second instead of every tick.
+      if (pad_primed[i] && !last_connected[i] &&
+          now_ticks < next_reconnect_ticks[i]) {
+        continue;
+      }
+      XINPUT_STATE native_state;
+      DWORD result = xigs(i, &native_state);
+      if (result == ERROR_DEVICE_NOT_CONNECTED) {
+        next_reconnect_ticks[i] = now_ticks + tick_frequency;
+        if (!pad_primed[i] || last_connected[i]) {
+          StateEvent evt = {};
+          evt.user_index = i;
+          evt.connected = false;
+          evt.timestamp_ticks = now_ticks;
+          PushStateEvent(evt);
+          last_connected[i] = false;
+          pad_primed[i] = true;
+        }
+        continue;
+      } else if (result != ERROR_SUCCESS) {
+        continue;
+      }
+      if (pad_primed[i] && last_connected[i] &&
+          native_state.dwPacketNumber == last_packet_number[i]) {
+        continue;
+      }
+      StateEvent evt = {};
+      evt.user_index = i;
+      evt.connected = true;
+      evt.timestamp_ticks = now_ticks;
+      CopyGamepadState(native_state, &evt.state);
+      PushStateEvent(evt);
+      last_packet_number[i] = native_state.dwPacketNumber;
+      last_connected[i] = true;
+      pad_primed[i] = true;
+    }
+    xe::threading::Sleep(poll_interval);
+  }
+}
+
+void XInputInputDriver::PushStateEvent(const StateEvent& evt) {
+  uint64_t write_count = event_write_count_.load(std::memory_order_relaxed);
+  uint64_t read_count = event_read_count_.load(std::memory_order_acquire);
+  if (write_count - read_count >= kEventRingSize) {
+    // Consumer stalled; drop the event and force a resynchronization on the
+    // next drain instead of overwriting entries it may still be reading.
+    event_overflow_.store(true, std::memory_order_release);
+    return;
+  }
+  event_ring_[write_count & (kEventRingSize - 1)] = evt;
+  event_write_count_.store(write_count + 1, std::memory_order_release);
+}
+
+void XInputInputDriver::DrainStateEvents() {
+  uint64_t read_count = event_read_count_.load(std::memory_order_relaxed);
+  uint64_t write_count = event_write_count_.load(std::memory_order_acquire);
+  while (read_count != write_count) {
+    const StateEvent& evt = event_ring_[read_count & (kEventRingSize - 1)];
+    latest_connected_[evt.user_index] = evt.connected;
+    latest_timestamp_ticks_[evt.user_index] = evt.timestamp_ticks;
+    if (evt.connected) {
+      latest_state_[evt.user_index] = evt.state;
+    }
+    ++read_count;
+  }
+  event_read_count_.store(read_count, std::memory_order_release);
+
+  if (event_overflow_.exchange(false, std::memory_order_acq_rel)) {
+    // The polling thread dropped events while no one was draining; resample
+    // directly so the cached view can't stay stale.
+    auto xigs = (decltype(&XInputGetState))XInputGetState_;
+    for (uint32_t i = 0; i < kMaxUserCount; ++i) {
+      XINPUT_STATE native_state;
+      DWORD result = xigs(i, &native_state);
+      latest_connected_[i] = result == ERROR_SUCCESS;
+      latest_timestamp_ticks_[i] = Clock::QueryHostTickCount();
+      if (result == ERROR_SUCCESS) {
+        CopyGamepadState(native_state, &latest_state_[i]);
+      }
+    }
+  }
+}
+
 X_RESULT XInputInputDriver::GetCapabilities(uint32_t user_index, uint32_t flags,
                                             X_INPUT_CAPABILITIES* out_caps) {
   XINPUT_CAPABILITIES native_caps;
@@ -102,6 +246,18 @@ X_RESULT XInputInputDriver::GetCapabilities(uint32_t user_index, uint32_t flags,
 
 X_RESULT XInputInputDriver::GetState(uint32_t user_index,
                                      X_INPUT_STATE* out_state) {
+  // The polling thread keeps a fresh snapshot for the standard user slots so
+  // guest input queries never stall on the native XInput call.
+  if (polling_thread_ && user_index < kMaxUserCount) {
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+    DrainStateEvents();
+    if (!latest_connected_[user_index]) {
+      return X_ERROR_DEVICE_NOT_CONNECTED;
+    }
+    *out_state = latest_state_[user_index];
+    return X_ERROR_SUCCESS;
+  }
+
   XINPUT_STATE native_state;
   auto xigs = (decltype(&XInputGetState))XInputGetState_;
   DWORD result = xigs(user_index, &native_state);
@@ -109,14 +265,7 @@ X_RESULT XInputInputDriver::GetState(uint32_t user_index,
     return result;
   }
 
-  out_state->packet_number = native_state.dwPacketNumber;
-  out_state->gamepad.buttons = native_state.Gamepad.wButtons;
-  out_state->gamepad.left_trigger = native_state.Gamepad.bLeftTrigger;
-  out_state->gamepad.right_trigger = native_state.Gamepad.bRightTrigger;
-  out_state->gamepad.thumb_lx = native_state.Gamepad.sThumbLX;
-  out_state->gamepad.thumb_ly = native_state.Gamepad.sThumbLY;
-  out_state->gamepad.thumb_rx = native_state.Gamepad.sThumbRX;
-  out_state->gamepad.thumb_ry = native_state.Gamepad.sThumbRY;
+  CopyGamepadState(native_state, out_state);
 
   return result;
 }
@@ -10,6 +10,11 @@
 #ifndef XENIA_HID_XINPUT_XINPUT_INPUT_DRIVER_H_
 #define XENIA_HID_XINPUT_XINPUT_INPUT_DRIVER_H_
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "xenia/base/threading.h"
 #include "xenia/hid/input_driver.h"
 
 namespace xe {
@@ -37,6 +42,46 @@ class XInputInputDriver : public InputDriver {
   void* XInputGetKeystroke_;
   void* XInputSetState_;
   void* XInputEnable_;
+
+ private:
+  // One pad snapshot queued by the polling thread when the native packet
+  // number changes or a pad connects/disconnects. timestamp_ticks is the
+  // host tick count at which the polling thread observed the change.
+  struct StateEvent {
+    uint32_t user_index;
+    bool connected;
+    uint64_t timestamp_ticks;
+    X_INPUT_STATE state;
+  };
+
+  void PollingThreadMain();
+  void PushStateEvent(const StateEvent& evt);
+  // Applies all queued events to the latest_* snapshot. Must be called with
+  // drain_mutex_ held.
+  void DrainStateEvents();
+
+  static const uint32_t kMaxUserCount = 4;
+  // Must be a power of two; the ring is indexed with count & (size - 1).
+  static const uint32_t kEventRingSize = 256;
+
+  std::atomic<bool> polling_running_ = {false};
+  std::unique_ptr<xe::threading::Thread> polling_thread_;
+
+  // Single-producer (polling thread) single-consumer ring of pad events.
+  // The producer never blocks or takes locks; when the ring fills it sets
+  // event_overflow_ and the next drain resynchronizes with a direct
+  // XInputGetState call instead of trusting the cached snapshot.
+  StateEvent event_ring_[kEventRingSize] = {};
+  std::atomic<uint64_t> event_write_count_ = {0};
+  std::atomic<uint64_t> event_read_count_ = {0};
+  std::atomic<bool> event_overflow_ = {false};
+
+  // Consumer-side view of the freshest sampled pad state, guarded by
+  // drain_mutex_ as multiple guest threads may query input concurrently.
+  std::mutex drain_mutex_;
+  X_INPUT_STATE latest_state_[kMaxUserCount] = {};
+  uint64_t latest_timestamp_ticks_[kMaxUserCount] = {};
+  bool latest_connected_[kMaxUserCount] = {};
 };
 
 }  // namespace xinput
@@ -9,6 +9,7 @@
 
 #include "xenia/kernel/kernel_state.h"
 
+#include <algorithm>
 #include <string>
 
 #include "xenia/base/assert.h"
@@ -60,6 +61,8 @@ KernelState::KernelState(Emulator* emulator)
   // Hardcoded maximum of 2048 TLS slots.
   tls_bitmap_.Resize(2048);
 
+  dispatch_event_ = xe::threading::Event::CreateAutoResetEvent(false);
+
   xam::AppManager::RegisterApps(this, app_manager_.get());
 }
 
@@ -68,9 +71,13 @@ KernelState::~KernelState() {
 
   if (dispatch_thread_running_) {
     dispatch_thread_running_ = false;
-    dispatch_cond_.notify_all();
+    dispatch_event_->Set();
     dispatch_thread_->Wait(0, 0, 0, nullptr);
   }
+  // Free any work that was still queued when the dispatch thread exited.
+  while (DispatchEntry* entry = PopDispatchEntry()) {
+    delete entry;
+  }
 
   executable_module_.reset();
   user_modules_.clear();
@@ -327,16 +334,16 @@ void KernelState::SetExecutableModule(object_ref<UserModule> module) {
           dispatch_thread_->set_can_debugger_suspend(true);
 
           while (dispatch_thread_running_) {
-            auto global_lock = global_critical_region_.Acquire();
-            if (dispatch_queue_.empty()) {
-              dispatch_cond_.wait(global_lock);
-              if (!dispatch_thread_running_) {
-                break;
-              }
+            DispatchEntry* entry = PopDispatchEntry();
+            if (!entry) {
+              xe::threading::Wait(dispatch_event_.get(), false);
+              continue;
             }
-            auto fn = std::move(dispatch_queue_.front());
-            dispatch_queue_.pop_front();
-            fn();
+            // Note that the work runs without any locks held: completion
+            // callbacks sleep to emulate latency and take the global lock
+            // themselves as needed.
+            entry->fn();
+            delete entry;
           }
           return 0;
         }));
@@ -568,6 +575,35 @@ object_ref<XThread> KernelState::GetThreadByID(uint32_t thread_id) {
   return retain_object(thread);
 }
 
+void KernelState::RecordWait(XObject* object, X_STATUS result,
+                             uint64_t start_ticks, uint64_t duration_ticks) {
+  auto current_thread = XThread::GetCurrentThread();
+  WaitRecord record;
+  record.thread_id = current_thread ? current_thread->thread_id() : 0;
+  record.object_handle = object->handle();
+  record.object_type = uint32_t(object->type());
+  record.signaler_thread_id = object->last_signal_thread_id();
+  record.result = result;
+  record.start_ticks = start_ticks;
+  record.duration_ticks = duration_ticks;
+  std::lock_guard<std::mutex> lock(wait_record_mutex_);
+  wait_records_[wait_record_count_ % kWaitRecordCapacity] = record;
+  ++wait_record_count_;
+}
+
+std::vector<KernelState::WaitRecord> KernelState::CaptureWaitRecords() {
+  std::lock_guard<std::mutex> lock(wait_record_mutex_);
+  uint64_t record_count =
+      std::min<uint64_t>(wait_record_count_, kWaitRecordCapacity);
+  std::vector<WaitRecord> records;
+  records.reserve(size_t(record_count));
+  for (uint64_t i = wait_record_count_ - record_count;
+       i < wait_record_count_; ++i) {
+    records.push_back(wait_records_[i % kWaitRecordCapacity]);
+  }
+  return records;
+}
+
 void KernelState::RegisterNotifyListener(XNotifyListener* listener) {
   auto global_lock = global_critical_region_.Acquire();
   notify_listeners_.push_back(retain_object(listener));
@@ -604,10 +640,17 @@ void KernelState::UnregisterNotifyListener(XNotifyListener* listener) {
 }
 
 void KernelState::BroadcastNotification(XNotificationID id, uint32_t data) {
-  auto global_lock = global_critical_region_.Acquire();
-  for (auto it = notify_listeners_.begin(); it != notify_listeners_.end();
-       ++it) {
-    (*it)->EnqueueNotification(id, data);
+  // Snapshot the listener list under the global lock but enqueue outside it;
+  // each listener has its own queue lock, so a notification storm never
+  // contends with guest threads polling other listeners (or holding the
+  // global lock at all).
+  std::vector<object_ref<XNotifyListener>> listeners;
+  {
+    auto global_lock = global_critical_region_.Acquire();
+    listeners = notify_listeners_;
+  }
+  for (const auto& listener : listeners) {
+    listener->EnqueueNotification(id, data);
   }
 }
 
@@ -671,15 +714,57 @@ void KernelState::CompleteOverlappedDeferredEx(
   auto ptr = memory()->TranslateVirtual(overlapped_ptr);
   XOverlappedSetResult(ptr, X_ERROR_IO_PENDING);
   XOverlappedSetContext(ptr, XThread::GetCurrentThreadHandle());
-  auto global_lock = global_critical_region_.Acquire();
-  dispatch_queue_.push_back([this, completion_callback, overlapped_ptr, result,
-                             extended_error, length]() {
+  auto entry = new DispatchEntry();
+  entry->fn = [this, completion_callback, overlapped_ptr, result,
+               extended_error, length]() {
     xe::threading::Sleep(
         std::chrono::milliseconds(kDeferredOverlappedDelayMillis));
     completion_callback();
     CompleteOverlappedEx(overlapped_ptr, result, extended_error, length);
-  });
-  dispatch_cond_.notify_all();
+  };
+  PushDispatchEntry(entry);
+}
+
+void KernelState::PushDispatchEntry(DispatchEntry* entry) {
+  entry->next.store(nullptr, std::memory_order_relaxed);
+  DispatchEntry* prev =
+      dispatch_queue_head_.exchange(entry, std::memory_order_acq_rel);
+  // Between the exchange and this store the queue is briefly unlinked; the
+  // consumer detects that and treats it as empty until the event fires.
+  prev->next.store(entry, std::memory_order_release);
+  dispatch_event_->Set();
+}
+
+KernelState::DispatchEntry* KernelState::PopDispatchEntry() {
+  DispatchEntry* tail = dispatch_queue_tail_;
+  DispatchEntry* next = tail->next.load(std::memory_order_acquire);
+  if (tail == &dispatch_queue_stub_) {
+    if (!next) {
+      return nullptr;
+    }
+    // Skip past the stub to the first real entry.
+    dispatch_queue_tail_ = next;
+    tail = next;
+    next = next->next.load(std::memory_order_acquire);
+  }
+  if (next) {
+    dispatch_queue_tail_ = next;
+    return tail;
+  }
+  if (tail != dispatch_queue_head_.load(std::memory_order_acquire)) {
+    // A producer has exchanged the head but not linked yet; it will signal
+    // the event once it does.
+    return nullptr;
+  }
+  // Single entry left: recycle the stub behind it so the queue is never empty
+  // from the producers' point of view, then detach it.
+  PushDispatchEntry(&dispatch_queue_stub_);
+  next = tail->next.load(std::memory_order_acquire);
+  if (next) {
+    dispatch_queue_tail_ = next;
+    return tail;
+  }
+  return nullptr;
 }
 
 bool KernelState::Save(ByteStream* stream) {
@@ -11,15 +11,15 @@
 #define XENIA_KERNEL_KERNEL_STATE_H_
 
 #include <atomic>
-#include <condition_variable>
 #include <functional>
-#include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "xenia/base/bit_map.h"
 #include "xenia/base/cvar.h"
 #include "xenia/base/mutex.h"
+#include "xenia/base/threading.h"
 #include "xenia/cpu/export_resolver.h"
 #include "xenia/kernel/util/native_list.h"
 #include "xenia/kernel/util/object_table.h"
@@ -155,6 +155,24 @@ class KernelState {
   void OnThreadExit(XThread* thread);
   object_ref<XThread> GetThreadByID(uint32_t thread_id);
 
+  // One entry per slow-path (actually blocking) kernel object wait, kept in
+  // a fixed ring so the debugger can attribute stalls to the objects and
+  // signaling threads involved. The user-mode TryWait fast path is not
+  // recorded - only waits that went to the host kernel.
+  struct WaitRecord {
+    uint32_t thread_id;
+    X_HANDLE object_handle;
+    uint32_t object_type;  // XObject::Type.
+    uint32_t signaler_thread_id;
+    X_STATUS result;
+    uint64_t start_ticks;     // Host ticks when the wait began.
+    uint64_t duration_ticks;  // Host ticks spent blocked.
+  };
+  void RecordWait(XObject* object, X_STATUS result, uint64_t start_ticks,
+                  uint64_t duration_ticks);
+  // Returns a snapshot of the wait ring, oldest record first.
+  std::vector<WaitRecord> CaptureWaitRecords();
+
   void RegisterNotifyListener(XNotifyListener* listener);
   void UnregisterNotifyListener(XNotifyListener* listener);
   void BroadcastNotification(XNotificationID id, uint32_t data);
@@ -208,11 +226,34 @@ class KernelState {
   object_ref<XHostThread> dispatch_thread_;
   // Must be guarded by the global critical region.
   util::NativeList dpc_list_;
-  std::condition_variable_any dispatch_cond_;
-  std::list<std::function<void()>> dispatch_queue_;
+
+  // Intrusive multi-producer/single-consumer dispatch queue in the classic
+  // two-pointer-plus-stub arrangement. Guest threads enqueue kernel work with
+  // two atomic stores and an event signal - never a lock - and only the
+  // dispatch thread pops. The stub entry carries no work; it just keeps the
+  // queue non-empty so producers always have a predecessor to link onto.
+  struct DispatchEntry {
+    std::atomic<DispatchEntry*> next = {nullptr};
+    std::function<void()> fn;
+  };
+  void PushDispatchEntry(DispatchEntry* entry);
+  // Returns the next completed entry, or nullptr if the queue is empty (or a
+  // producer is mid-push; the event is always signaled after linking, so
+  // waiting on it never loses work). Dispatch thread only.
+  DispatchEntry* PopDispatchEntry();
+  DispatchEntry dispatch_queue_stub_;
+  std::atomic<DispatchEntry*> dispatch_queue_head_ = {&dispatch_queue_stub_};
+  DispatchEntry* dispatch_queue_tail_ = &dispatch_queue_stub_;
+  std::unique_ptr<xe::threading::Event> dispatch_event_;
 
   BitMap tls_bitmap_;
 
+  static constexpr uint32_t kWaitRecordCapacity = 512;
+  std::mutex wait_record_mutex_;
+  // Must be guarded by wait_record_mutex_.
+  WaitRecord wait_records_[kWaitRecordCapacity] = {};
+  uint64_t wait_record_count_ = 0;
+
   friend class XObject;
 };
 
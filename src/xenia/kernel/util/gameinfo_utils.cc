@@ -26,12 +26,23 @@ GameInfoWrapper::GameInfoWrapper(const uint8_t* data, size_t data_size)
   const GameInfoBlockHeader* block_header(nullptr);
   size_t data_offset(0);
   while (data_offset < data_size_) {
+    if (data_size_ - data_offset < sizeof(GameInfoBlockHeader)) {
+      // Truncated block header.
+      data_ = nullptr;
+      return;
+    }
     block_header =
         reinterpret_cast<const GameInfoBlockHeader*>(data_ + data_offset);
     data_offset += sizeof(GameInfoBlockHeader);
 
     switch (block_header->magic) {
       case kGameInfoExecMagic:
+        if (data_size_ - data_offset < exec_.VirtualTitleIdLength + 1 +
+                                           exec_.ModuleNameLength + 1 +
+                                           exec_.BuildDescriptionLength + 1) {
+          data_ = nullptr;
+          return;
+        }
         exec_.virtual_titleid =
             reinterpret_cast<const char*>(data_ + data_offset);
         data_offset += exec_.VirtualTitleIdLength + 1;
@@ -43,11 +54,19 @@ GameInfoWrapper::GameInfoWrapper(const uint8_t* data, size_t data_size)
         break;
       case kGameInfoCommMagic:
         assert_true(block_header->block_size == sizeof(GameInfoBlockComm));
+        if (data_size_ - data_offset < sizeof(GameInfoBlockComm)) {
+          data_ = nullptr;
+          return;
+        }
         comm_ = reinterpret_cast<const GameInfoBlockComm*>(data_ + data_offset);
         data_offset += block_header->block_size;
         break;
       case kGameInfoTitlMagic:
         assert_true(block_header->block_size == sizeof(GameInfoBlockTitl));
+        if (data_size_ - data_offset < sizeof(GameInfoBlockTitl)) {
+          data_ = nullptr;
+          return;
+        }
         titl_ = reinterpret_cast<const GameInfoBlockTitl*>(data_ + data_offset);
         data_offset += block_header->block_size;
         break;
@@ -77,6 +96,18 @@ std::string GameInfo::module_name() const {
   return std::string(exec_.module_name, exec_.module_name + module_name_length);
 }
 
+std::unique_ptr<GameInfoFile> GameInfoFile::Open(const std::wstring& path) {
+  auto mapping = MappedMemory::Open(path, MappedMemory::Mode::kRead);
+  if (!mapping) {
+    return nullptr;
+  }
+  std::unique_ptr<GameInfoFile> file(new GameInfoFile(std::move(mapping)));
+  if (!file->info().is_valid()) {
+    return nullptr;
+  }
+  return file;
+}
+
 }  // namespace util
 }  // namespace kernel
 }  // namespace xe
@@ -10,9 +10,11 @@
 #ifndef XENIA_KERNEL_UTIL_GAMEINFO_UTILS_H_
 #define XENIA_KERNEL_UTIL_GAMEINFO_UTILS_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "xenia/base/mapped_memory.h"
 #include "xenia/base/memory.h"
 
 namespace xe {
@@ -68,12 +70,33 @@ class GameInfo : public GameInfoWrapper {
   GameInfo(const std::vector<uint8_t>& data)
       : GameInfoWrapper(reinterpret_cast<const uint8_t*>(data.data()),
                         data.size()) {}
+  GameInfo(const uint8_t* data, size_t data_size)
+      : GameInfoWrapper(data, data_size) {}
 
   uint32_t title_id() const;
   std::string virtual_title_id() const;
   std::string module_name() const;
 };
 
+// Memory-maps a gameinfo file and provides access over the mapping, without
+// reading the whole file into a buffer first.
+class GameInfoFile {
+ public:
+  // Returns nullptr if the file can't be opened or is not a valid gameinfo
+  // instance.
+  static std::unique_ptr<GameInfoFile> Open(const std::wstring& path);
+
+  const GameInfo& info() const { return info_; }
+
+ private:
+  explicit GameInfoFile(std::unique_ptr<MappedMemory> mapping)
+      : mapping_(std::move(mapping)),
+        info_(mapping_->data(), mapping_->size()) {}
+
+  std::unique_ptr<MappedMemory> mapping_;
+  GameInfo info_;
+};
+
 }  // namespace util
 }  // namespace kernel
 }  // namespace xe
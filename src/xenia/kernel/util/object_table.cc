@@ -29,40 +29,70 @@ void ObjectTable::Reset() {
   auto global_lock = global_critical_region_.Acquire();
 
   // Release all objects.
-  for (uint32_t n = 0; n < table_capacity_; n++) {
-    ObjectTableEntry& entry = table_[n];
+  auto table = table_.load(std::memory_order_relaxed);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+  for (uint32_t n = 0; n < table_capacity; n++) {
+    ObjectTableEntry& entry = table[n];
     if (entry.object) {
       entry.object->Release();
     }
   }
 
-  table_capacity_ = 0;
+  table_capacity_.store(0, std::memory_order_relaxed);
   last_free_entry_ = 0;
-  free(table_);
-  table_ = nullptr;
+  free_slot_cache_.clear();
+  table_.store(nullptr, std::memory_order_relaxed);
+  free(table);
+
+  // Only safe at shutdown, when no lookups can still be in flight.
+  for (auto retired_table : retired_tables_) {
+    free(retired_table);
+  }
+  retired_tables_.clear();
 }
 
 X_STATUS ObjectTable::FindFreeSlot(uint32_t* out_slot) {
-  // Find a free slot.
+  auto table = table_.load(std::memory_order_relaxed);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+
+  // Drain the reserved batch first. A cached slot may have been occupied out
+  // from under the cache by RestoreHandle, which writes arbitrary slots, so
+  // recheck occupancy; a stale entry is simply discarded.
+  while (!free_slot_cache_.empty()) {
+    uint32_t slot = free_slot_cache_.back();
+    free_slot_cache_.pop_back();
+    if (slot < table_capacity && !table[slot].object) {
+      *out_slot = slot;
+      return X_STATUS_SUCCESS;
+    }
+  }
+
+  // Cache empty: scan the table once, reserving a batch of free slots so the
+  // following additions don't scan at all.
   uint32_t slot = last_free_entry_;
   uint32_t scan_count = 0;
-  while (scan_count < table_capacity_) {
-    ObjectTableEntry& entry = table_[slot];
+  while (scan_count < table_capacity &&
+         free_slot_cache_.size() < kFreeSlotBatchSize) {
+    ObjectTableEntry& entry = table[slot];
     if (!entry.object) {
-      *out_slot = slot;
-      return X_STATUS_SUCCESS;
+      free_slot_cache_.push_back(slot);
     }
     scan_count++;
-    slot = (slot + 1) % table_capacity_;
+    slot = (slot + 1) % table_capacity;
     if (slot == 0) {
       // Never allow 0 handles.
       scan_count++;
       slot++;
     }
   }
+  if (!free_slot_cache_.empty()) {
+    *out_slot = free_slot_cache_.back();
+    free_slot_cache_.pop_back();
+    return X_STATUS_SUCCESS;
+  }
 
   // Table out of slots, expand.
-  uint32_t new_table_capacity = std::max(16 * 1024u, table_capacity_ * 2);
+  uint32_t new_table_capacity = std::max(16 * 1024u, table_capacity * 2);
   if (!Resize(new_table_capacity)) {
     return X_STATUS_NO_MEMORY;
   }
@@ -76,22 +106,26 @@ X_STATUS ObjectTable::FindFreeSlot(uint32_t* out_slot) {
 
 bool ObjectTable::Resize(uint32_t new_capacity) {
   uint32_t new_size = new_capacity * sizeof(ObjectTableEntry);
-  uint32_t old_size = table_capacity_ * sizeof(ObjectTableEntry);
-  auto new_table =
-      reinterpret_cast<ObjectTableEntry*>(realloc(table_, new_size));
+  auto new_table = reinterpret_cast<ObjectTableEntry*>(calloc(1, new_size));
   if (!new_table) {
     return false;
   }
 
-  // Zero out new entries.
-  if (new_size > old_size) {
-    std::memset(reinterpret_cast<uint8_t*>(new_table) + old_size, 0,
-                new_size - old_size);
+  auto old_table = table_.load(std::memory_order_relaxed);
+  uint32_t old_capacity = table_capacity_.load(std::memory_order_relaxed);
+  if (old_table) {
+    std::memcpy(new_table, old_table,
+                old_capacity * sizeof(ObjectTableEntry));
+    // Lock-free lookups may still be walking the old array; retire it
+    // instead of freeing it. It is reclaimed in Reset.
+    retired_tables_.push_back(old_table);
   }
 
-  last_free_entry_ = table_capacity_;
-  table_capacity_ = new_capacity;
-  table_ = new_table;
+  // Publish the new table before the new capacity: lookups load the capacity
+  // first, so they can never see a capacity larger than their table.
+  table_.store(new_table, std::memory_order_release);
+  table_capacity_.store(new_capacity, std::memory_order_release);
+  last_free_entry_ = old_capacity;
 
   return true;
 }
@@ -107,11 +141,15 @@ X_STATUS ObjectTable::AddHandle(XObject* object, X_HANDLE* out_handle) {
     uint32_t slot = 0;
     result = FindFreeSlot(&slot);
 
-    // Stash.
+    // Stash. The shard lock orders the store against lookups of this slot.
     if (XSUCCEEDED(result)) {
-      ObjectTableEntry& entry = table_[slot];
-      entry.object = object;
-      entry.handle_ref_count = 1;
+      ObjectTableEntry& entry = table_.load(std::memory_order_relaxed)[slot];
+      {
+        std::lock_guard<std::mutex> shard_lock(
+            lookup_shard_locks_[slot % kLookupShardCount]);
+        entry.handle_ref_count = 1;
+        entry.object = object;
+      }
 
       handle = slot << 2;
       object->handles().push_back(handle);
@@ -185,15 +223,24 @@ X_STATUS ObjectTable::RemoveHandle(X_HANDLE handle) {
     return X_STATUS_INVALID_HANDLE;
   }
 
+  // Hold the global lock across the table lookup so a concurrent resize
+  // cannot retire the array the entry points into.
+  auto global_lock = global_critical_region_.Acquire();
+
   ObjectTableEntry* entry = LookupTable(handle);
   if (!entry) {
     return X_STATUS_INVALID_HANDLE;
   }
 
-  auto global_lock = global_critical_region_.Acquire();
   if (entry->object) {
     auto object = entry->object;
-    entry->object = nullptr;
+    {
+      // Fence out lookups of this slot so they either retain the object
+      // before we release it or miss entirely.
+      std::lock_guard<std::mutex> shard_lock(
+          lookup_shard_locks_[(handle >> 2) % kLookupShardCount]);
+      entry->object = nullptr;
+    }
     assert_zero(entry->handle_ref_count);
     entry->handle_ref_count = 0;
 
@@ -206,6 +253,11 @@ X_STATUS ObjectTable::RemoveHandle(X_HANDLE handle) {
 
     XELOGI("Removed handle:%08X for %s", handle, typeid(*object).name());
 
+    // Make the slot immediately reusable without a table scan.
+    if (free_slot_cache_.size() < kFreeSlotBatchSize) {
+      free_slot_cache_.push_back(handle >> 2);
+    }
+
     // Release now that the object has been removed from the table.
     object->Release();
   }
@@ -217,8 +269,10 @@ std::vector<object_ref<XObject>> ObjectTable::GetAllObjects() {
   auto lock = global_critical_region_.Acquire();
   std::vector<object_ref<XObject>> results;
 
-  for (uint32_t slot = 0; slot < table_capacity_; slot++) {
-    auto& entry = table_[slot];
+  auto table = table_.load(std::memory_order_relaxed);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+  for (uint32_t slot = 0; slot < table_capacity; slot++) {
+    auto& entry = table[slot];
     if (entry.object && std::find(results.begin(), results.end(),
                                   entry.object) == results.end()) {
       entry.object->Retain();
@@ -231,13 +285,22 @@ std::vector<object_ref<XObject>> ObjectTable::GetAllObjects() {
 
 void ObjectTable::PurgeAllObjects() {
   auto lock = global_critical_region_.Acquire();
-  for (uint32_t slot = 0; slot < table_capacity_; slot++) {
-    auto& entry = table_[slot];
+  auto table = table_.load(std::memory_order_relaxed);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+  for (uint32_t slot = 0; slot < table_capacity; slot++) {
+    auto& entry = table[slot];
     if (entry.object && !entry.object->is_host_object()) {
-      entry.handle_ref_count = 0;
-      entry.object->Release();
-
-      entry.object = nullptr;
+      auto object = entry.object;
+      {
+        std::lock_guard<std::mutex> shard_lock(
+            lookup_shard_locks_[slot % kLookupShardCount]);
+        entry.handle_ref_count = 0;
+        entry.object = nullptr;
+      }
+      if (free_slot_cache_.size() < kFreeSlotBatchSize) {
+        free_slot_cache_.push_back(slot);
+      }
+      object->Release();
     }
   }
 }
@@ -248,12 +311,14 @@ ObjectTable::ObjectTableEntry* ObjectTable::LookupTable(X_HANDLE handle) {
     return nullptr;
   }
 
+  // Callers mutating the entry must themselves hold the global lock so the
+  // returned pointer stays valid across a resize.
   auto global_lock = global_critical_region_.Acquire();
 
   // Lower 2 bits are ignored.
   uint32_t slot = handle >> 2;
-  if (slot <= table_capacity_) {
-    return &table_[slot];
+  if (slot < table_capacity_.load(std::memory_order_relaxed)) {
+    return &table_.load(std::memory_order_relaxed)[slot];
   }
 
   return nullptr;
@@ -273,39 +338,43 @@ XObject* ObjectTable::LookupObject(X_HANDLE handle, bool already_locked) {
     return nullptr;
   }
 
-  XObject* object = nullptr;
-  if (!already_locked) {
-    global_critical_region_.mutex().lock();
-  }
-
   // Lower 2 bits are ignored.
   uint32_t slot = handle >> 2;
 
-  // Verify slot.
-  if (slot < table_capacity_) {
-    ObjectTableEntry& entry = table_[slot];
+  // Lookups never take the global lock - this is the hottest path in the
+  // kernel (every NtWaitForSingleObject/NtSetEvent resolves a handle) and
+  // guest threads would serialize on it. Only the shard covering this slot
+  // is locked, so lookups of different handles proceed in parallel and only
+  // collide with removal of the same slot. already_locked (the global lock)
+  // is fine either way: writers take the global lock before shard locks.
+  XObject* object = nullptr;
+  std::lock_guard<std::mutex> shard_lock(
+      lookup_shard_locks_[slot % kLookupShardCount]);
+
+  // Load the capacity before the table so a racing resize can only make the
+  // snapshot under-read, never index out of bounds.
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_acquire);
+  if (slot < table_capacity) {
+    ObjectTableEntry& entry = table_.load(std::memory_order_acquire)[slot];
     if (entry.object) {
+      // Safe to retain even if the snapshot is stale: the entry's table
+      // reference is only dropped by RemoveHandle, which needs our shard
+      // lock.
       object = entry.object;
+      object->Retain();
     }
   }
 
-  // Retain the object pointer.
-  if (object) {
-    object->Retain();
-  }
-
-  if (!already_locked) {
-    global_critical_region_.mutex().unlock();
-  }
-
   return object;
 }
 
 void ObjectTable::GetObjectsByType(XObject::Type type,
                                    std::vector<object_ref<XObject>>* results) {
   auto global_lock = global_critical_region_.Acquire();
-  for (uint32_t slot = 0; slot < table_capacity_; ++slot) {
-    auto& entry = table_[slot];
+  auto table = table_.load(std::memory_order_relaxed);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+  for (uint32_t slot = 0; slot < table_capacity; ++slot) {
+    auto& entry = table[slot];
     if (entry.object) {
       if (entry.object->type() == type) {
         entry.object->Retain();
@@ -381,9 +450,11 @@ X_STATUS ObjectTable::GetObjectByName(const std::string& name,
 }
 
 bool ObjectTable::Save(ByteStream* stream) {
-  stream->Write<uint32_t>(table_capacity_);
-  for (uint32_t i = 0; i < table_capacity_; i++) {
-    auto& entry = table_[i];
+  auto table = table_.load(std::memory_order_relaxed);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+  stream->Write<uint32_t>(table_capacity);
+  for (uint32_t i = 0; i < table_capacity; i++) {
+    auto& entry = table[i];
     stream->Write<int32_t>(entry.handle_ref_count);
   }
 
@@ -392,8 +463,10 @@ bool ObjectTable::Save(ByteStream* stream) {
 
 bool ObjectTable::Restore(ByteStream* stream) {
   Resize(stream->Read<uint32_t>());
-  for (uint32_t i = 0; i < table_capacity_; i++) {
-    auto& entry = table_[i];
+  auto table = table_.load(std::memory_order_relaxed);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+  for (uint32_t i = 0; i < table_capacity; i++) {
+    auto& entry = table[i];
     // entry.object = nullptr;
     entry.handle_ref_count = stream->Read<int32_t>();
   }
@@ -403,10 +476,11 @@ bool ObjectTable::Restore(ByteStream* stream) {
 
 X_STATUS ObjectTable::RestoreHandle(X_HANDLE handle, XObject* object) {
   uint32_t slot = handle >> 2;
-  assert_true(table_capacity_ >= slot);
+  uint32_t table_capacity = table_capacity_.load(std::memory_order_relaxed);
+  assert_true(table_capacity > slot);
 
-  if (table_capacity_ >= slot) {
-    auto& entry = table_[slot];
+  if (table_capacity > slot) {
+    auto& entry = table_.load(std::memory_order_relaxed)[slot];
     entry.object = object;
     object->Retain();
   }
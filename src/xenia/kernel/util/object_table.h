@@ -10,6 +10,8 @@
 #ifndef XENIA_KERNEL_UTIL_OBJECT_TABLE_H_
 #define XENIA_KERNEL_UTIL_OBJECT_TABLE_H_
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -95,10 +97,32 @@ class ObjectTable {
   X_STATUS FindFreeSlot(uint32_t* out_slot);
   bool Resize(uint32_t new_capacity);
 
+  // All writes (handle create/close/resize) synchronize on the global
+  // critical region, as before. Lookups only take the shard lock covering
+  // their slot: the entry array and capacity are published with
+  // release/acquire ordering and old arrays are retired instead of freed on
+  // resize, so a lookup holding a stale snapshot stays in bounds, and
+  // removal of a slot takes the same shard lock as lookups of that slot, so
+  // an object cannot be released out from under a lookup retaining it.
+  static const uint32_t kLookupShardCount = 64;
+  // Free slots reserved per table scan in FindFreeSlot.
+  static const uint32_t kFreeSlotBatchSize = 64;
+
   xe::global_critical_region global_critical_region_;
-  uint32_t table_capacity_ = 0;
-  ObjectTableEntry* table_ = nullptr;
+  std::mutex lookup_shard_locks_[kLookupShardCount];
+  std::atomic<uint32_t> table_capacity_ = {0};
+  std::atomic<ObjectTableEntry*> table_ = {nullptr};
+  // Previous entry arrays, kept alive until Reset for the benefit of
+  // in-flight lookups. Capacity doubles on each resize, so these total less
+  // than the live table.
+  std::vector<ObjectTableEntry*> retired_tables_;
   uint32_t last_free_entry_ = 0;
+  // Free slots reserved in bulk - refilled by one table scan in FindFreeSlot
+  // and by handle removal - so handle creation storms (title boot makes
+  // hundreds of objects back to back) take one scan per batch instead of one
+  // per handle. Guarded by the global critical region like the rest of the
+  // write-path state.
+  std::vector<uint32_t> free_slot_cache_;
   std::unordered_map<std::string, X_HANDLE> name_table_;
 };
 
@@ -486,19 +486,22 @@ StringBuffer* thread_local_string_buffer();
 
 template <typename Tuple>
 void PrintKernelCall(cpu::Export* export_entry, const Tuple& params) {
+  // Pick the level first and bail before formatting if the line would be
+  // dropped anyway - argument stringification is the bulk of the per-call
+  // overhead of a logged export.
+  bool important = (export_entry->tags & xe::cpu::ExportTag::kImportant) != 0;
+  auto log_level = important ? xe::LogLevel::Info : xe::LogLevel::Debug;
+  if (!xe::ShouldLog(log_level)) {
+    return;
+  }
   auto& string_buffer = *thread_local_string_buffer();
   string_buffer.Reset();
   string_buffer.Append(export_entry->name);
   string_buffer.Append('(');
   AppendKernelCallParams(string_buffer, export_entry, params);
   string_buffer.Append(')');
-  if (export_entry->tags & xe::cpu::ExportTag::kImportant) {
-    xe::LogLine(xe::LogLevel::Info, 'i', string_buffer.GetString(),
-                string_buffer.length());
-  } else {
-    xe::LogLine(xe::LogLevel::Debug, 'd', string_buffer.GetString(),
-                string_buffer.length());
-  }
+  xe::LogLine(log_level, important ? 'i' : 'd', string_buffer.GetString(),
+              string_buffer.length());
 }
 
 template <typename F, typename Tuple, std::size_t... I>
@@ -33,6 +33,15 @@ XdbfWrapper::XdbfWrapper(const uint8_t* data, size_t data_size)
     return;
   }
 
+  // The entry and free space tables must fit in the data before anything is
+  // looked up in them.
+  size_t table_size = sizeof(XbdfEntry) * header_->entry_count +
+                      sizeof(XbdfFileLoc) * header_->free_count;
+  if (data_size - sizeof(XbdfHeader) < table_size) {
+    data_ = nullptr;
+    return;
+  }
+
   entries_ = reinterpret_cast<const XbdfEntry*>(ptr);
   ptr += sizeof(XbdfEntry) * header_->entry_count;
 
@@ -43,9 +52,15 @@ XdbfWrapper::XdbfWrapper(const uint8_t* data, size_t data_size)
 }
 
 XdbfBlock XdbfWrapper::GetEntry(XdbfSection section, uint64_t id) const {
+  size_t content_size = data_size_ - (content_offset_ - data_);
   for (uint32_t i = 0; i < header_->entry_used; ++i) {
     auto& entry = entries_[i];
     if (entry.section == static_cast<uint16_t>(section) && entry.id == id) {
+      if (entry.offset >= content_size ||
+          entry.size > content_size - entry.offset) {
+        // The entry points past the end of the data (truncated read).
+        return {0};
+      }
       XdbfBlock block;
       block.buffer = content_offset_ + entry.offset;
       block.size = entry.size;
@@ -69,9 +84,16 @@ std::string XdbfWrapper::GetStringTableEntry(XdbfLocale locale,
   assert_true(xstr_head->version == 1);
 
   const uint8_t* ptr = language_block.buffer + sizeof(XdbfXstrHeader);
+  const uint8_t* end = language_block.buffer + language_block.size;
   for (uint16_t i = 0; i < xstr_head->string_count; ++i) {
+    if (end - ptr < ptrdiff_t(sizeof(XdbfStringTableEntry))) {
+      break;
+    }
     auto entry = reinterpret_cast<const XdbfStringTableEntry*>(ptr);
     ptr += sizeof(XdbfStringTableEntry);
+    if (end - ptr < ptrdiff_t(entry->string_length)) {
+      break;
+    }
     if (entry->id == string_id) {
       return std::string(reinterpret_cast<const char*>(ptr),
                          entry->string_length);
@@ -102,6 +124,20 @@ std::string XdbfGameData::title() const {
   return GetStringTableEntry(default_language(), kXdbfIdTitle);
 }
 
+std::unique_ptr<XdbfGameDataFile> XdbfGameDataFile::Open(
+    const std::wstring& path) {
+  auto mapping = MappedMemory::Open(path, MappedMemory::Mode::kRead);
+  if (!mapping) {
+    return nullptr;
+  }
+  std::unique_ptr<XdbfGameDataFile> file(
+      new XdbfGameDataFile(std::move(mapping)));
+  if (!file->data().is_valid()) {
+    return nullptr;
+  }
+  return file;
+}
+
 }  // namespace util
 }  // namespace kernel
 }  // namespace xe
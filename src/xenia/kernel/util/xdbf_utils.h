@@ -10,9 +10,11 @@
 #ifndef XENIA_KERNEL_UTIL_XDBF_UTILS_H_
 #define XENIA_KERNEL_UTIL_XDBF_UTILS_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "xenia/base/mapped_memory.h"
 #include "xenia/base/memory.h"
 
 namespace xe {
@@ -139,6 +141,28 @@ class XdbfGameData : public XdbfWrapper {
   std::string title() const;
 };
 
+// Memory-maps an XDBF (SPA) file and provides game data access over the
+// mapping. Only the pages actually touched - the header, the entry directory
+// and the requested entries - are read from disk, so enumerating the titles
+// of a large library doesn't pull whole databases with all their images into
+// memory.
+class XdbfGameDataFile {
+ public:
+  // Returns nullptr if the file can't be opened or is not a valid XDBF
+  // instance.
+  static std::unique_ptr<XdbfGameDataFile> Open(const std::wstring& path);
+
+  const XdbfGameData& data() const { return data_; }
+
+ private:
+  explicit XdbfGameDataFile(std::unique_ptr<MappedMemory> mapping)
+      : mapping_(std::move(mapping)),
+        data_(mapping_->data(), mapping_->size()) {}
+
+  std::unique_ptr<MappedMemory> mapping_;
+  XdbfGameData data_;
+};
+
 }  // namespace util
 }  // namespace kernel
 }  // namespace xe
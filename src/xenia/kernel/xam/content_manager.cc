@@ -105,6 +105,22 @@ std::vector<XCONTENT_DATA> ContentManager::ListContent(uint32_t device_id,
   // Search path:
   // content_root/title_id/type_name/*
   auto package_root = ResolvePackageRoot(content_type);
+
+  // Titles enumerate content repeatedly (at boot and around every save), so
+  // serve from the cache while the package root is unchanged on disk.
+  auto global_lock = global_critical_region_.Acquire();
+  xe::filesystem::FileInfo root_info;
+  bool have_root_info = xe::filesystem::GetInfo(package_root, &root_info);
+  auto cache_it = content_cache_.find(content_type);
+  if (have_root_info && cache_it != content_cache_.end() &&
+      cache_it->second.root_write_timestamp == root_info.write_timestamp) {
+    result = cache_it->second.content;
+    for (auto& content_data : result) {
+      content_data.device_id = device_id;
+    }
+    return result;
+  }
+
   auto file_infos = xe::filesystem::ListFiles(package_root);
   for (const auto& file_info : file_infos) {
     if (file_info.type != xe::filesystem::FileInfo::Type::kDirectory) {
@@ -119,6 +135,10 @@ std::vector<XCONTENT_DATA> ContentManager::ListContent(uint32_t device_id,
     result.emplace_back(std::move(content_data));
   }
 
+  if (have_root_info) {
+    content_cache_[content_type] = {root_info.write_timestamp, result};
+  }
+
   return result;
 }
 
@@ -160,6 +180,9 @@ X_RESULT ContentManager::CreateContent(std::string root_name,
     return X_ERROR_ACCESS_DENIED;
   }
 
+  // Don't rely on timestamp granularity to catch our own writes.
+  content_cache_.erase(data.content_type);
+
   auto package = ResolvePackage(root_name, data);
   assert_not_null(package);
 
@@ -248,6 +271,7 @@ X_RESULT ContentManager::DeleteContent(const XCONTENT_DATA& data) {
   auto package_path = ResolvePackagePath(data);
   if (xe::filesystem::PathExists(package_path)) {
     xe::filesystem::DeleteFolder(package_path);
+    content_cache_.erase(data.content_type);
     return X_ERROR_SUCCESS;
   } else {
     return X_ERROR_FILE_NOT_FOUND;
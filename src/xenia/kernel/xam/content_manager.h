@@ -96,6 +96,15 @@ class ContentManager {
   // TODO(benvanik): remove use of global lock, it's bad here!
   xe::global_critical_region global_critical_region_;
   std::unordered_map<std::string, ContentPackage*> open_packages_;
+
+  // Cached enumeration results per content type, validated against the
+  // package root directory's write timestamp so that changes made outside
+  // of the emulator are picked up on the next enumeration.
+  struct ContentCacheEntry {
+    uint64_t root_write_timestamp;
+    std::vector<XCONTENT_DATA> content;
+  };
+  std::unordered_map<uint32_t, ContentCacheEntry> content_cache_;
 };
 
 }  // namespace xam
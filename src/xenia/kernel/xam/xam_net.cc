@@ -310,25 +310,20 @@ dword_result_t NetDll_WSASendTo(dword_t caller, dword_t socket_handle,
     return -1;
   }
 
-  // Our sockets implementation doesn't support multiple buffers, so we need
-  // to combine the buffers the game has given us!
-  std::vector<uint8_t> combined_buffer_mem;
-  uint32_t combined_buffer_size = 0;
-  uint32_t combined_buffer_offset = 0;
+  // Translate the WSABUF array in place and let the host socket API gather
+  // the spans directly out of guest memory - no combine buffer needed.
+  std::vector<XSocket::BufferSpan> spans(num_buffers);
   for (uint32_t i = 0; i < num_buffers; i++) {
-    combined_buffer_size += buffers[i].len;
-    combined_buffer_mem.resize(combined_buffer_size);
-    uint8_t* combined_buffer = combined_buffer_mem.data();
-
-    std::memcpy(combined_buffer + combined_buffer_offset,
-                kernel_memory()->TranslateVirtual(buffers[i].buf_ptr),
-                buffers[i].len);
-    combined_buffer_offset += buffers[i].len;
+    spans[i].data = kernel_memory()->TranslateVirtual(buffers[i].buf_ptr);
+    spans[i].length = buffers[i].len;
   }
 
   N_XSOCKADDR_IN native_to(to_ptr);
-  socket->SendTo(combined_buffer_mem.data(), combined_buffer_size, flags,
-                 &native_to, to_len);
+  int ret = socket->SendTo(spans.data(), num_buffers, flags, &native_to,
+                           to_len);
+  if (ret >= 0 && num_bytes_sent) {
+    *num_bytes_sent = uint32_t(ret);
+  }
 
   // TODO: Instantly complete overlapped
 
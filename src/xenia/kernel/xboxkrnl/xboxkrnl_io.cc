@@ -19,6 +19,7 @@
 #include "xenia/kernel/xsymboliclink.h"
 #include "xenia/kernel/xthread.h"
 #include "xenia/vfs/device.h"
+#include "xenia/vfs/stream_prefetcher.h"
 #include "xenia/xbox.h"
 
 namespace xe {
@@ -168,7 +169,7 @@ dword_result_t NtReadFile(dword_t file_handle, dword_t event_handle,
   }
 
   if (XSUCCEEDED(result)) {
-    if (true || file->is_synchronous()) {
+    if (file->is_synchronous()) {
       // some games NtReadFile() directly into texture memory
       auto heap = kernel_memory()->LookupHeap(buffer.guest_address());
       if (heap && heap->IsGuestPhysicalHeap()) {
@@ -177,11 +178,28 @@ dword_result_t NtReadFile(dword_t file_handle, dword_t event_handle,
       }
 
       // Synchronous.
+      size_t read_offset = byte_offset_ptr
+                               ? static_cast<uint64_t>(*byte_offset_ptr)
+                               : file->position();
       size_t bytes_read = 0;
       result = file->Read(
           buffer, buffer_length,
           byte_offset_ptr ? static_cast<uint64_t>(*byte_offset_ptr) : -1,
           &bytes_read, apc_context);
+
+      // Physically-backed destinations feed hardware-style consumers (XMA,
+      // the GPU); register the mapping so the prefetcher can stage the bytes
+      // the next refill will ask for.
+      if (XSUCCEEDED(result) && bytes_read && heap &&
+          heap->IsGuestPhysicalHeap()) {
+        uint32_t physical_address =
+            kernel_memory()->GetPhysicalAddress(buffer.guest_address());
+        if (physical_address != UINT32_MAX) {
+          vfs::StreamPrefetcher::NotifyRead(file->file(), physical_address,
+                                            uint32_t(bytes_read), read_offset);
+        }
+      }
+
       if (io_status_block) {
         io_status_block->status = result;
         io_status_block->information = static_cast<uint32_t>(bytes_read);
@@ -198,31 +216,28 @@ dword_result_t NtReadFile(dword_t file_handle, dword_t event_handle,
         }
       }
 
-      if (!file->is_synchronous()) {
-        result = X_STATUS_PENDING;
-      }
-
       // Mark that we should signal the event now. We do this after
       // we have written the info out.
       signal_event = true;
     } else {
-      // TODO(benvanik): async.
-
-      // X_STATUS_PENDING if not returning immediately.
-      // XFile is waitable and signalled after each async req completes.
-      // reset the input event (->Reset())
-      /*xeNtReadFileState* call_state = new xeNtReadFileState();
-      XAsyncRequest* request = new XAsyncRequest(
-      state, file,
-      (XAsyncRequest::CompletionCallback)xeNtReadFileCompleted,
-      call_state);*/
-      // result = file->Read(buffer, buffer_length, byte_offset, request);
+      // Asynchronous: the read is serviced on the file's I/O thread so
+      // streaming reads don't stall the issuing guest thread. The worker
+      // writes the status block and signals the event/APC/completion ports
+      // when it finishes.
       if (io_status_block) {
         io_status_block->status = X_STATUS_PENDING;
         io_status_block->information = 0;
       }
+      if (ev) {
+        // The event is reset when the I/O starts and set on completion.
+        ev->Reset();
+      }
 
-      result = X_STATUS_PENDING;
+      result = file->ReadAsync(
+          buffer.guest_address(), buffer_length,
+          byte_offset_ptr ? static_cast<uint64_t>(*byte_offset_ptr) : -1,
+          static_cast<uint32_t>(apc_routine_ptr), apc_context,
+          io_status_block.guest_address(), std::move(ev));
     }
   }
 
@@ -430,9 +430,11 @@ void RtlEnterCriticalSection(pointer_t<X_RTL_CRITICAL_SECTION> cs) {
     return;
   }
 
-  // Spin loop
+  // Spin loop. Test with a plain read before the compare-exchange so
+  // spinners wait on a shared cache line instead of bouncing it between
+  // cores with failed atomic attempts.
   while (spin_count--) {
-    if (xe::atomic_cas(-1, 0, &cs->lock_count)) {
+    if (cs->lock_count == -1 && xe::atomic_cas(-1, 0, &cs->lock_count)) {
       // Acquired.
       cs->owning_thread = cur_thread;
       cs->recursion_count = 1;
@@ -64,6 +64,14 @@ class FormatData {
   virtual uint16_t peek(int32_t offset) = 0;
   virtual void skip(int32_t count) = 0;
   virtual bool put(uint16_t c) = 0;
+  // Bulk output of runs that are already in memory (formatted numbers, %s
+  // bodies), avoiding a virtual call per character.
+  virtual bool put(const uint8_t* buffer, int32_t length) = 0;
+  virtual bool put(const uint16_t* buffer, int32_t length, bool swap) = 0;
+  // Copies the run of literal characters at the current position to the
+  // output, stopping before the next '%' or the terminator. Returns the
+  // number of characters copied.
+  virtual int32_t put_literal_run() = 0;
 };
 
 class ArgList {
@@ -156,6 +164,9 @@ int32_t format_core(PPCContext* ppc_context, FormatData& data, ArgList& args,
           return -1;
         }
         ++count;
+        // The rest of the literal run can be copied in bulk, without going
+        // through the state machine and a virtual call per character.
+        count += data.put_literal_run();
         continue;
       }
 
@@ -631,30 +642,16 @@ int32_t format_core(PPCContext* ppc_context, FormatData& data, ArgList& args,
       }
     }
 
-    int32_t remaining = text.length;
     if (!text.is_wide) {
       // it's a const char*
-      auto b = (const uint8_t*)text.buffer;
-      while (remaining-- > 0) {
-        if (!data.put(*b++)) {
-          return -1;
-        }
+      if (!data.put((const uint8_t*)text.buffer, text.length)) {
+        return -1;
       }
     } else {
       // it's a const wchar_t*
-      auto b = (const uint16_t*)text.buffer;
-      if (text.swap_wide) {
-        while (remaining-- > 0) {
-          if (!data.put(xe::byte_swap(*b++))) {
-            return -1;
-          }
-        }
-      } else {
-        while (remaining-- > 0) {
-          if (!data.put(*b++)) {
-            return -1;
-          }
-        }
+      if (!data.put((const uint16_t*)text.buffer, text.length,
+                    text.swap_wide)) {
+        return -1;
       }
     }
     count += text.length;
@@ -731,6 +728,7 @@ class StringFormatData : public FormatData {
       if (!*input_) {
         break;
       }
+      ++input_;
     }
   }
 
@@ -742,6 +740,33 @@ class StringFormatData : public FormatData {
     return true;
   }
 
+  bool put(const uint8_t* buffer, int32_t length) {
+    output_.write(reinterpret_cast<const char*>(buffer), length);
+    return true;
+  }
+
+  bool put(const uint16_t* buffer, int32_t length, bool swap) {
+    while (length-- > 0) {
+      uint16_t c = swap ? xe::byte_swap(*buffer) : *buffer;
+      ++buffer;
+      if (c >= 0x100) {
+        return false;
+      }
+      output_ << (char)c;
+    }
+    return true;
+  }
+
+  int32_t put_literal_run() {
+    const uint8_t* start = input_;
+    while (*input_ && *input_ != '%') {
+      ++input_;
+    }
+    auto length = int32_t(input_ - start);
+    output_.write(reinterpret_cast<const char*>(start), length);
+    return length;
+  }
+
   std::string str() const { return output_.str(); }
 
  private:
@@ -761,13 +786,14 @@ class WideStringFormatData : public FormatData {
     return xe::byte_swap(result);
   }
 
-  uint16_t peek(int32_t offset) { return input_[offset]; }
+  uint16_t peek(int32_t offset) { return xe::byte_swap(input_[offset]); }
 
   void skip(int32_t count) {
     while (count-- > 0) {
       if (!*input_) {
         break;
       }
+      ++input_;
     }
   }
 
@@ -776,6 +802,35 @@ class WideStringFormatData : public FormatData {
     return true;
   }
 
+  bool put(const uint8_t* buffer, int32_t length) {
+    while (length-- > 0) {
+      output_ << (wchar_t)*buffer++;
+    }
+    return true;
+  }
+
+  bool put(const uint16_t* buffer, int32_t length, bool swap) {
+    while (length-- > 0) {
+      output_ << (wchar_t)(swap ? xe::byte_swap(*buffer) : *buffer);
+      ++buffer;
+    }
+    return true;
+  }
+
+  int32_t put_literal_run() {
+    int32_t length = 0;
+    for (;;) {
+      uint16_t c = xe::byte_swap(*input_);
+      if (!c || c == '%') {
+        break;
+      }
+      output_ << (wchar_t)c;
+      ++input_;
+      ++length;
+    }
+    return length;
+  }
+
   std::wstring wstr() const { return output_.str(); }
 
  private:
@@ -795,13 +850,14 @@ class WideCountFormatData : public FormatData {
     return xe::byte_swap(result);
   }
 
-  uint16_t peek(int32_t offset) { return input_[offset]; }
+  uint16_t peek(int32_t offset) { return xe::byte_swap(input_[offset]); }
 
   void skip(int32_t count) {
     while (count-- > 0) {
       if (!*input_) {
         break;
       }
+      ++input_;
     }
   }
 
@@ -810,6 +866,26 @@ class WideCountFormatData : public FormatData {
     return true;
   }
 
+  bool put(const uint8_t* buffer, int32_t length) {
+    count_ += length;
+    return true;
+  }
+
+  bool put(const uint16_t* buffer, int32_t length, bool swap) {
+    count_ += length;
+    return true;
+  }
+
+  int32_t put_literal_run() {
+    int32_t length = 0;
+    while (*input_ && xe::byte_swap(*input_) != '%') {
+      ++input_;
+      ++length;
+    }
+    count_ += length;
+    return length;
+  }
+
   const int32_t count() const { return count_; }
 
  private:
@@ -24,6 +24,8 @@ void XEvent::Initialize(bool manual_reset, bool initial_state) {
 
   this->CreateNative<X_KEVENT>();
 
+  manual_reset_ = manual_reset;
+  signal_state_ = initial_state ? 1 : 0;
   if (manual_reset) {
     event_ = xe::threading::Event::CreateManualResetEvent(initial_state);
   } else {
@@ -47,6 +49,7 @@ void XEvent::InitializeNative(void* native_ptr, X_DISPATCH_HEADER* header) {
   }
 
   bool initial_state = header->signal_state ? true : false;
+  signal_state_ = initial_state ? 1 : 0;
   if (manual_reset_) {
     event_ = xe::threading::Event::CreateManualResetEvent(initial_state);
   } else {
@@ -54,22 +57,82 @@ void XEvent::InitializeNative(void* native_ptr, X_DISPATCH_HEADER* header) {
   }
 }
 
+XObject::TryWaitResult XEvent::TryWait() {
+  if (manual_reset_) {
+    // Waits don't consume a manual-reset event, so the mirror can answer in
+    // both directions: it only reads 1 once the host event really is set,
+    // and a racing reset could legally have ordered either way.
+    return signal_state_.load(std::memory_order_acquire)
+               ? TryWaitResult::kSignaled
+               : TryWaitResult::kNotSignaled;
+  }
+  // An auto-reset wait consumes the signal, and that consumption has to go
+  // through the host event: satisfying it here could double-release a waiter
+  // already parked in a host wait (including WaitMultiple) on the same set.
+  // The mirror never under-counts though, so zero still proves unsignaled
+  // and lets polls bail without the host transition.
+  return signal_state_.load(std::memory_order_acquire)
+             ? TryWaitResult::kNotSupported
+             : TryWaitResult::kNotSignaled;
+}
+
+void XEvent::WaitCallback() {
+  if (!manual_reset_) {
+    // A host wait delivered one set. Clamp at zero: sets coalesce in the
+    // host event, so the mirror may have counted more than were delivered.
+    uint32_t count = signal_state_.load(std::memory_order_relaxed);
+    while (count && !signal_state_.compare_exchange_weak(
+                        count, count - 1, std::memory_order_acq_rel)) {
+    }
+  }
+}
+
 int32_t XEvent::Set(uint32_t priority_increment, bool wait) {
-  event_->Set();
+  StoreSignalThread();
+  if (manual_reset_) {
+    if (signal_state_.load(std::memory_order_acquire)) {
+      // Already set - setting again is a no-op, so skip the host call.
+      // Notification events that are set every frame cost nothing this way.
+      return 1;
+    }
+    event_->Set();
+    // Stored after the host set so an observed 1 means the host event is
+    // really signaled.
+    signal_state_.store(1, std::memory_order_release);
+  } else {
+    // Counted before the host set so the mirror never under-counts.
+    signal_state_.fetch_add(1, std::memory_order_acq_rel);
+    event_->Set();
+  }
   return 1;
 }
 
 int32_t XEvent::Pulse(uint32_t priority_increment, bool wait) {
+  StoreSignalThread();
+  if (manual_reset_) {
+    signal_state_.store(0, std::memory_order_release);
+  }
   event_->Pulse();
   return 1;
 }
 
 int32_t XEvent::Reset() {
   event_->Reset();
+  if (manual_reset_) {
+    signal_state_.store(0, std::memory_order_release);
+  }
+  // Auto-reset: leave the mirror alone. Lowering it could race a concurrent
+  // set into under-counting; a stale nonzero just sends the next wait down
+  // the host path.
   return 1;
 }
 
-void XEvent::Clear() { event_->Reset(); }
+void XEvent::Clear() {
+  event_->Reset();
+  if (manual_reset_) {
+    signal_state_.store(0, std::memory_order_release);
+  }
+}
 
 bool XEvent::Save(ByteStream* stream) {
   XELOGD("XEvent %.8X (%s)", handle(), manual_reset_ ? "manual" : "auto");
@@ -105,6 +168,7 @@ object_ref<XEvent> XEvent::Restore(KernelState* kernel_state,
   evt->RestoreObject(stream);
   bool signaled = stream->Read<bool>();
   evt->manual_reset_ = stream->Read<bool>();
+  evt->signal_state_ = signaled ? 1 : 0;
 
   if (evt->manual_reset_) {
     evt->event_ = xe::threading::Event::CreateManualResetEvent(false);
@@ -10,6 +10,8 @@
 #ifndef XENIA_KERNEL_XEVENT_H_
 #define XENIA_KERNEL_XEVENT_H_
 
+#include <atomic>
+
 #include "xenia/base/threading.h"
 #include "xenia/kernel/xobject.h"
 #include "xenia/xbox.h"
@@ -43,11 +45,18 @@ class XEvent : public XObject {
                                     ByteStream* stream);
 
  protected:
+  TryWaitResult TryWait() override;
+  void WaitCallback() override;
   xe::threading::WaitHandle* GetWaitHandle() override { return event_.get(); }
 
  private:
   bool manual_reset_ = false;
   std::unique_ptr<xe::threading::Event> event_;
+  // Mirror of the event state for the user-mode wait fast path, see TryWait.
+  // Exact for manual-reset events. For auto-reset events it's a count of
+  // undelivered sets that may over-count (coalesced sets, resets) but never
+  // under-counts, so a zero reliably means unsignaled.
+  std::atomic<uint32_t> signal_state_ = {0};
 };
 
 }  // namespace kernel
@@ -8,6 +8,7 @@
  */
 
 #include "xenia/kernel/xfile.h"
+#include "xenia/vfs/stream_prefetcher.h"
 #include "xenia/vfs/virtual_file_system.h"
 
 #include "xenia/base/byte_stream.h"
@@ -15,6 +16,7 @@
 #include "xenia/base/math.h"
 #include "xenia/kernel/kernel_state.h"
 #include "xenia/kernel/xevent.h"
+#include "xenia/kernel/xthread.h"
 
 namespace xe {
 namespace kernel {
@@ -29,8 +31,22 @@ XFile::XFile() : XObject(kType) {
 }
 
 XFile::~XFile() {
+  if (async_io_thread_) {
+    // Drop any reads still queued - the file is closing out from under them,
+    // like an NT cancel - and join the worker before the vfs file goes away.
+    {
+      std::lock_guard<std::mutex> lock(async_request_lock_);
+      async_io_shutdown_ = true;
+      async_requests_.clear();
+    }
+    async_request_cond_.notify_all();
+    xe::threading::Wait(async_io_thread_.get(), false);
+    async_io_thread_.reset();
+  }
+
   // TODO(benvanik): signal that the file is closing?
   async_event_->Set();
+  vfs::StreamPrefetcher::NotifyFileDestroyed(file_);
   file_->Destroy();
 }
 
@@ -116,6 +132,104 @@ X_STATUS XFile::Read(void* buffer, size_t buffer_length, size_t byte_offset,
   return result;
 }
 
+X_STATUS XFile::ReadAsync(uint32_t buffer_address, uint32_t buffer_length,
+                          size_t byte_offset, uint32_t apc_routine,
+                          uint32_t apc_context,
+                          uint32_t io_status_block_address,
+                          object_ref<XEvent> event) {
+  AsyncRequest request;
+  request.buffer_address = buffer_address;
+  request.buffer_length = buffer_length;
+  request.byte_offset = byte_offset;
+  request.apc_routine = apc_routine;
+  request.apc_context = apc_context;
+  request.io_status_block_address = io_status_block_address;
+  request.event = std::move(event);
+  // APCs are delivered in the context of the thread that issued the I/O.
+  request.issuing_thread = retain_object(XThread::GetCurrentThread());
+
+  {
+    std::lock_guard<std::mutex> lock(async_request_lock_);
+    if (!async_io_thread_) {
+      async_io_shutdown_ = false;
+      async_io_thread_ =
+          xe::threading::Thread::Create({}, [this]() { AsyncIOThread(); });
+      async_io_thread_->set_name("XFile IO");
+    }
+    async_requests_.push_back(std::move(request));
+  }
+  async_request_cond_.notify_one();
+
+  return X_STATUS_PENDING;
+}
+
+void XFile::AsyncIOThread() {
+  std::unique_lock<std::mutex> lock(async_request_lock_);
+  while (!async_io_shutdown_) {
+    if (async_requests_.empty()) {
+      async_request_cond_.wait(lock);
+      continue;
+    }
+    AsyncRequest request = std::move(async_requests_.front());
+    async_requests_.pop_front();
+    lock.unlock();
+    CompleteAsyncRequest(request);
+    lock.lock();
+  }
+}
+
+void XFile::CompleteAsyncRequest(AsyncRequest& request) {
+  // Some games read directly into texture memory; fire watches before the
+  // worker scribbles over it, same as the synchronous path does.
+  auto heap = memory()->LookupHeap(request.buffer_address);
+  if (heap && heap->IsGuestPhysicalHeap()) {
+    memory()->TriggerWatches(request.buffer_address, request.buffer_length,
+                             true, true);
+  }
+
+  // Read already notifies the completion ports and signals the file itself.
+  size_t read_offset =
+      request.byte_offset == -1 ? position_ : request.byte_offset;
+  size_t bytes_read = 0;
+  X_STATUS result =
+      Read(memory()->TranslateVirtual(request.buffer_address),
+           request.buffer_length, request.byte_offset, &bytes_read,
+           request.apc_context);
+
+  // Physically-backed destinations are stream buffers fed to hardware-style
+  // consumers (XMA, the GPU); register the mapping so the prefetcher can
+  // stage the bytes the next refill will ask for.
+  if (XSUCCEEDED(result) && bytes_read && heap &&
+      heap->IsGuestPhysicalHeap()) {
+    uint32_t physical_address =
+        memory()->GetPhysicalAddress(request.buffer_address);
+    if (physical_address != UINT32_MAX) {
+      vfs::StreamPrefetcher::NotifyRead(file_, physical_address,
+                                        uint32_t(bytes_read), read_offset);
+    }
+  }
+
+  if (request.io_status_block_address) {
+    auto io_status_block = memory()->TranslateVirtual<X_IO_STATUS_BLOCK*>(
+        request.io_status_block_address);
+    io_status_block->status = result;
+    io_status_block->information = static_cast<uint32_t>(bytes_read);
+  }
+
+  if (request.event) {
+    request.event->Set(0, false);
+  }
+
+  // Low bit means do not queue to IO ports; see NtReadFile.
+  if (request.apc_routine & ~1u) {
+    if (request.apc_context) {
+      request.issuing_thread->EnqueueApc(request.apc_routine & ~1u,
+                                         request.apc_context,
+                                         request.io_status_block_address, 0);
+    }
+  }
+}
+
 X_STATUS XFile::Write(const void* buffer, size_t buffer_length,
                       size_t byte_offset, size_t* out_bytes_written,
                       uint32_t apc_context) {
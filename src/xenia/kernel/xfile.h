@@ -10,6 +10,10 @@
 #ifndef XENIA_KERNEL_XFILE_H_
 #define XENIA_KERNEL_XFILE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "xenia/base/filesystem.h"
@@ -24,6 +28,8 @@
 namespace xe {
 namespace kernel {
 
+class XThread;
+
 // https://msdn.microsoft.com/en-us/library/windows/hardware/ff545822.aspx
 struct X_FILE_NETWORK_OPEN_INFORMATION {
   xe::be<uint64_t> creation_time;
@@ -101,6 +107,15 @@ class XFile : public XObject {
   X_STATUS Read(void* buffer, size_t buffer_length, size_t byte_offset,
                 size_t* out_bytes_read, uint32_t apc_context);
 
+  // Queues a read onto the file's I/O thread and returns X_STATUS_PENDING
+  // without blocking the issuing thread. On completion the worker writes the
+  // status block, signals the event (if any), queues the APC back to the
+  // issuing thread (if any) and notifies registered completion ports.
+  X_STATUS ReadAsync(uint32_t buffer_address, uint32_t buffer_length,
+                     size_t byte_offset, uint32_t apc_routine,
+                     uint32_t apc_context, uint32_t io_status_block_address,
+                     object_ref<XEvent> event);
+
   X_STATUS Write(const void* buffer, size_t buffer_length, size_t byte_offset,
                  size_t* out_bytes_written, uint32_t apc_context);
 
@@ -123,11 +138,33 @@ class XFile : public XObject {
   }
 
  private:
+  struct AsyncRequest {
+    uint32_t buffer_address = 0;
+    uint32_t buffer_length = 0;
+    size_t byte_offset = 0;
+    uint32_t apc_routine = 0;
+    uint32_t apc_context = 0;
+    uint32_t io_status_block_address = 0;
+    object_ref<XEvent> event;
+    object_ref<XThread> issuing_thread;
+  };
+
   XFile();
 
+  // Worker loop for the per-file I/O thread, created lazily on the first
+  // async request so synchronous-only files pay nothing.
+  void AsyncIOThread();
+  void CompleteAsyncRequest(AsyncRequest& request);
+
   vfs::File* file_ = nullptr;
   std::unique_ptr<threading::Event> async_event_ = nullptr;
 
+  std::unique_ptr<threading::Thread> async_io_thread_;
+  std::deque<AsyncRequest> async_requests_;
+  std::mutex async_request_lock_;
+  std::condition_variable async_request_cond_;
+  bool async_io_shutdown_ = false;
+
   std::mutex completion_port_lock_;
   std::vector<std::pair<uint32_t, object_ref<XIOCompletion>>> completion_ports_;
 
@@ -35,14 +35,14 @@ void XNotifyListener::EnqueueNotification(XNotificationID id, uint32_t data) {
     return;
   }
 
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::mutex> lock(lock_);
   notifications_.push_back(std::pair<XNotificationID, uint32_t>(id, data));
   wait_handle_->Set();
 }
 
 bool XNotifyListener::DequeueNotification(XNotificationID* out_id,
                                           uint32_t* out_data) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::mutex> lock(lock_);
   bool dequeued = false;
   if (notifications_.size()) {
     dequeued = true;
@@ -59,7 +59,7 @@ bool XNotifyListener::DequeueNotification(XNotificationID* out_id,
 
 bool XNotifyListener::DequeueNotification(XNotificationID id,
                                           uint32_t* out_data) {
-  auto global_lock = global_critical_region_.Acquire();
+  std::lock_guard<std::mutex> lock(lock_);
   bool dequeued = false;
   if (!notifications_.size()) {
     return dequeued;
@@ -11,6 +11,7 @@
 #define XENIA_KERNEL_XNOTIFYLISTENER_H_
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "xenia/base/mutex.h"
@@ -47,7 +48,9 @@ class XNotifyListener : public XObject {
 
  private:
   std::unique_ptr<xe::threading::Event> wait_handle_;
-  xe::global_critical_region global_critical_region_;
+  // Guards only this listener's queue: broadcasters and pollers of different
+  // listeners never contend with each other or with the global lock.
+  std::mutex lock_;
   std::vector<std::pair<XNotificationID, uint32_t>> notifications_;
   uint64_t mask_ = 0;
 };
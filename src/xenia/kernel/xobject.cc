@@ -9,10 +9,15 @@
 
 #include "xenia/kernel/xobject.h"
 
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/clock.h"
+#include "xenia/base/math.h"
+#include "xenia/base/profiling.h"
 #include "xenia/kernel/kernel_state.h"
 #include "xenia/kernel/util/shim_utils.h"
 #include "xenia/kernel/xboxkrnl/xboxkrnl_private.h"
@@ -26,9 +31,80 @@
 #include "xenia/kernel/xsymboliclink.h"
 #include "xenia/kernel/xthread.h"
 
+DEFINE_int32(wait_spin_iterations, 2000,
+             "Bounded spin count before a guest wait parks in the host "
+             "kernel, used only on objects whose recent waits were satisfied "
+             "within --wait_spin_threshold_us. 0 disables spinning.",
+             "Kernel");
+DEFINE_int32(wait_spin_threshold_us, 50,
+             "A blocked wait completing within this many microseconds counts "
+             "as short and makes future waits on the object spin first.",
+             "Kernel");
+
 namespace xe {
 namespace kernel {
 
+namespace {
+
+// Backing store for XObject::operator new/delete. Blocks are carved from
+// slabs in batches and freed objects go onto a free list for their size
+// class, so kernel object churn doesn't hit the heap allocator per object.
+// Slab memory is kept for the life of the process; the working set of kernel
+// objects is small and recycles quickly.
+constexpr size_t kObjectSlabGranularity = 64;
+constexpr size_t kObjectSlabBatchCount = 64;
+
+struct ObjectSlabAllocator {
+  std::mutex lock;
+  // Free blocks keyed by size class (allocation size rounded up to the slab
+  // granularity).
+  std::unordered_map<size_t, std::vector<void*>> free_lists;
+};
+
+ObjectSlabAllocator& ObjectSlab() {
+  static ObjectSlabAllocator allocator;
+  return allocator;
+}
+
+MemoryCounter& ObjectSlabMemoryCounter() {
+  static MemoryCounter counter("kernel/xobject_slab");
+  return counter;
+}
+
+}  // namespace
+
+void* XObject::operator new(size_t size) {
+  size_t size_class = xe::round_up(size, kObjectSlabGranularity);
+  auto& allocator = ObjectSlab();
+  std::lock_guard<std::mutex> guard(allocator.lock);
+  auto& free_list = allocator.free_lists[size_class];
+  if (free_list.empty()) {
+    auto slab = reinterpret_cast<uint8_t*>(
+        std::malloc(size_class * kObjectSlabBatchCount));
+    assert_not_null(slab);
+    free_list.reserve(kObjectSlabBatchCount);
+    for (size_t i = 0; i < kObjectSlabBatchCount; ++i) {
+      free_list.push_back(slab + i * size_class);
+    }
+    ObjectSlabMemoryCounter().Add(size_class * kObjectSlabBatchCount);
+  }
+  void* ptr = free_list.back();
+  free_list.pop_back();
+  return ptr;
+}
+
+void XObject::operator delete(void* ptr, size_t size) {
+  if (!ptr) {
+    return;
+  }
+  // The deleting destructor is virtual, so size is that of the most-derived
+  // type and maps back to the size class the block came from.
+  size_t size_class = xe::round_up(size, kObjectSlabGranularity);
+  auto& allocator = ObjectSlab();
+  std::lock_guard<std::mutex> guard(allocator.lock);
+  allocator.free_lists[size_class].push_back(ptr);
+}
+
 XObject::XObject(Type type)
     : kernel_state_(nullptr), pointer_ref_count_(1), type_(type) {
   handles_.reserve(10);
@@ -191,6 +267,13 @@ uint32_t XObject::TimeoutTicksToMs(int64_t timeout_ticks) {
   }
 }
 
+void XObject::StoreSignalThread() {
+  auto current_thread = XThread::GetCurrentThread();
+  last_signal_thread_id_.store(
+      current_thread ? current_thread->thread_id() : 0,
+      std::memory_order_relaxed);
+}
+
 X_STATUS XObject::Wait(uint32_t wait_reason, uint32_t processor_mode,
                        uint32_t alertable, uint64_t* opt_timeout) {
   auto wait_handle = GetWaitHandle();
@@ -199,28 +282,110 @@ X_STATUS XObject::Wait(uint32_t wait_reason, uint32_t processor_mode,
     return X_STATUS_SUCCESS;
   }
 
+  // User-mode fast path: events and semaphores can often answer the wait
+  // from an atomic mirror of their state, skipping the host kernel entirely.
+  // Guest producer/consumer loops wait and poll tens of thousands of times
+  // per second, so this matters. Alertable waits always go to the host so
+  // APC delivery keeps working.
+  if (!alertable) {
+    switch (TryWait()) {
+      case TryWaitResult::kSignaled:
+        WaitCallback();
+        return X_STATUS_SUCCESS;
+      case TryWaitResult::kNotSignaled:
+        if (opt_timeout && !TimeoutTicksToMs(*opt_timeout)) {
+          // Zero-timeout poll of an unsignaled object.
+          return X_STATUS_TIMEOUT;
+        }
+        // Adaptive spin: producer-consumer handoffs between guest threads
+        // are often satisfied within microseconds, where parking is pure
+        // syscall-and-reschedule overhead. Spin only while this object's
+        // recent waits have all been that short, and never when more guest
+        // threads are runnable than the host has cores - spinning then
+        // steals time from the thread that would do the signaling.
+        if (short_wait_streak_.load(std::memory_order_relaxed) &&
+            !XThread::AreHostCoresOversubscribed()) {
+          for (int32_t i = 0; i < cvars::wait_spin_iterations; ++i) {
+            xe::threading::Pause();
+            TryWaitResult spin_result = TryWait();
+            if (spin_result == TryWaitResult::kSignaled) {
+              WaitCallback();
+              return X_STATUS_SUCCESS;
+            }
+            if (spin_result != TryWaitResult::kNotSignaled) {
+              // Auto-reset events and semaphores answer kNotSupported once
+              // signaled because consumption must go through the host
+              // object; fall through to the host wait, which will satisfy
+              // immediately, instead of burning the rest of the spin budget.
+              break;
+            }
+          }
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
   auto timeout_ms =
       opt_timeout ? std::chrono::milliseconds(Clock::ScaleGuestDurationMillis(
                         TimeoutTicksToMs(*opt_timeout)))
                   : std::chrono::milliseconds::max();
 
+  uint64_t start_ticks = Clock::QueryHostTickCount();
+  // While parked the thread doesn't occupy a host core; keep the
+  // oversubscription heuristic honest. Host threads outside the kernel's
+  // view aren't counted live, so don't count their parks either.
+  bool count_parked = XThread::IsInThread();
+  if (count_parked) {
+    XThread::OnThreadParked();
+  }
   auto result =
       xe::threading::Wait(wait_handle, alertable ? true : false, timeout_ms);
+  if (count_parked) {
+    XThread::OnThreadUnparked();
+  }
+  X_STATUS status;
   switch (result) {
     case xe::threading::WaitResult::kSuccess:
       WaitCallback();
-      return X_STATUS_SUCCESS;
+      status = X_STATUS_SUCCESS;
+      break;
     case xe::threading::WaitResult::kUserCallback:
       // Or X_STATUS_ALERTED?
-      return X_STATUS_USER_APC;
+      status = X_STATUS_USER_APC;
+      break;
     case xe::threading::WaitResult::kTimeout:
       xe::threading::MaybeYield();
-      return X_STATUS_TIMEOUT;
+      status = X_STATUS_TIMEOUT;
+      break;
     default:
     case xe::threading::WaitResult::kAbandoned:
     case xe::threading::WaitResult::kFailed:
-      return X_STATUS_ABANDONED_WAIT_0;
+      status = X_STATUS_ABANDONED_WAIT_0;
+      break;
+  }
+  uint64_t duration_ticks = Clock::QueryHostTickCount() - start_ticks;
+  if (status == X_STATUS_SUCCESS) {
+    // Teach the spin heuristic from how long the park actually lasted.
+    uint64_t threshold_ticks = Clock::QueryHostTickFrequency() *
+                               uint64_t(cvars::wait_spin_threshold_us) /
+                               1000000;
+    if (duration_ticks <= threshold_ticks) {
+      uint32_t streak = short_wait_streak_.load(std::memory_order_relaxed);
+      if (streak < 16) {
+        short_wait_streak_.store(streak + 1, std::memory_order_relaxed);
+      }
+    } else {
+      short_wait_streak_.store(0, std::memory_order_relaxed);
+    }
   }
+  if (kernel_state_) {
+    // Only waits that really blocked reach this point; the TryWait fast path
+    // above returns without a record.
+    kernel_state_->RecordWait(this, status, start_ticks, duration_ticks);
+  }
+  return status;
 }
 
 X_STATUS XObject::SignalAndWait(XObject* signal_object, XObject* wait_object,
@@ -231,24 +396,43 @@ X_STATUS XObject::SignalAndWait(XObject* signal_object, XObject* wait_object,
                         TimeoutTicksToMs(*opt_timeout)))
                   : std::chrono::milliseconds::max();
 
+  uint64_t start_ticks = Clock::QueryHostTickCount();
+  bool count_parked = XThread::IsInThread();
+  if (count_parked) {
+    XThread::OnThreadParked();
+  }
   auto result = xe::threading::SignalAndWait(
       signal_object->GetWaitHandle(), wait_object->GetWaitHandle(),
       alertable ? true : false, timeout_ms);
+  if (count_parked) {
+    XThread::OnThreadUnparked();
+  }
+  X_STATUS status;
   switch (result) {
     case xe::threading::WaitResult::kSuccess:
       wait_object->WaitCallback();
-      return X_STATUS_SUCCESS;
+      status = X_STATUS_SUCCESS;
+      break;
     case xe::threading::WaitResult::kUserCallback:
       // Or X_STATUS_ALERTED?
-      return X_STATUS_USER_APC;
+      status = X_STATUS_USER_APC;
+      break;
     case xe::threading::WaitResult::kTimeout:
       xe::threading::MaybeYield();
-      return X_STATUS_TIMEOUT;
+      status = X_STATUS_TIMEOUT;
+      break;
     default:
     case xe::threading::WaitResult::kAbandoned:
     case xe::threading::WaitResult::kFailed:
-      return X_STATUS_ABANDONED_WAIT_0;
+      status = X_STATUS_ABANDONED_WAIT_0;
+      break;
   }
+  if (wait_object->kernel_state_) {
+    wait_object->kernel_state_->RecordWait(
+        wait_object, status, start_ticks,
+        Clock::QueryHostTickCount() - start_ticks);
+  }
+  return status;
 }
 
 X_STATUS XObject::WaitMultiple(uint32_t count, XObject** objects,
@@ -266,25 +450,40 @@ X_STATUS XObject::WaitMultiple(uint32_t count, XObject** objects,
                         TimeoutTicksToMs(*opt_timeout)))
                   : std::chrono::milliseconds::max();
 
+  uint64_t start_ticks = Clock::QueryHostTickCount();
+  // Recorded against the satisfying object on a wait-any success, and
+  // against the first object otherwise.
+  XObject* record_object = objects[0];
+  X_STATUS status;
+  bool count_parked = XThread::IsInThread();
+  if (count_parked) {
+    XThread::OnThreadParked();
+  }
   if (wait_type) {
     auto result = xe::threading::WaitAny(std::move(wait_handles),
                                          alertable ? true : false, timeout_ms);
     switch (result.first) {
       case xe::threading::WaitResult::kSuccess:
-        objects[result.second]->WaitCallback();
+        record_object = objects[result.second];
+        record_object->WaitCallback();
 
-        return X_STATUS(result.second);
+        status = X_STATUS(result.second);
+        break;
       case xe::threading::WaitResult::kUserCallback:
         // Or X_STATUS_ALERTED?
-        return X_STATUS_USER_APC;
+        status = X_STATUS_USER_APC;
+        break;
       case xe::threading::WaitResult::kTimeout:
         xe::threading::MaybeYield();
-        return X_STATUS_TIMEOUT;
+        status = X_STATUS_TIMEOUT;
+        break;
       default:
       case xe::threading::WaitResult::kAbandoned:
-        return X_STATUS(X_STATUS_ABANDONED_WAIT_0 + result.second);
+        status = X_STATUS(X_STATUS_ABANDONED_WAIT_0 + result.second);
+        break;
       case xe::threading::WaitResult::kFailed:
-        return X_STATUS_UNSUCCESSFUL;
+        status = X_STATUS_UNSUCCESSFUL;
+        break;
     }
   } else {
     auto result = xe::threading::WaitAll(std::move(wait_handles),
@@ -295,19 +494,32 @@ X_STATUS XObject::WaitMultiple(uint32_t count, XObject** objects,
           objects[i]->WaitCallback();
         }
 
-        return X_STATUS_SUCCESS;
+        status = X_STATUS_SUCCESS;
+        break;
       case xe::threading::WaitResult::kUserCallback:
         // Or X_STATUS_ALERTED?
-        return X_STATUS_USER_APC;
+        status = X_STATUS_USER_APC;
+        break;
       case xe::threading::WaitResult::kTimeout:
         xe::threading::MaybeYield();
-        return X_STATUS_TIMEOUT;
+        status = X_STATUS_TIMEOUT;
+        break;
       default:
       case xe::threading::WaitResult::kAbandoned:
       case xe::threading::WaitResult::kFailed:
-        return X_STATUS_ABANDONED_WAIT_0;
+        status = X_STATUS_ABANDONED_WAIT_0;
+        break;
     }
   }
+  if (count_parked) {
+    XThread::OnThreadUnparked();
+  }
+  if (record_object->kernel_state_) {
+    record_object->kernel_state_->RecordWait(
+        record_object, status, start_ticks,
+        Clock::QueryHostTickCount() - start_ticks);
+  }
+  return status;
 }
 
 uint8_t* XObject::CreateNative(uint32_t size) {
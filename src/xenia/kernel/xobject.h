@@ -130,6 +130,13 @@ class XObject {
   XObject(KernelState* kernel_state, Type type);
   virtual ~XObject();
 
+  // XObject subtypes are allocated from per-size-class slabs instead of the
+  // general heap: title boot creates hundreds of events, semaphores and
+  // threads back to back, and recycling freed objects avoids a malloc/free
+  // round trip per object. Subtypes of the same rounded size share a slab.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   Emulator* emulator() const;
   KernelState* kernel_state() const;
   Memory* memory() const;
@@ -144,6 +151,13 @@ class XObject {
   std::vector<X_HANDLE>& handles() { return handles_; }
 
   const std::string& name() const { return name_; }
+
+  // ID of the guest thread that most recently signaled this object, or 0 if
+  // it has never been signaled (or was last signaled by a host thread). Used
+  // by the wait records in KernelState for stall attribution.
+  uint32_t last_signal_thread_id() const {
+    return last_signal_thread_id_.load(std::memory_order_relaxed);
+  }
   uint32_t guest_object() const { return guest_object_ptr_; }
 
   // Has this object been created for use by the host?
@@ -192,8 +206,27 @@ class XObject {
   bool SaveObject(ByteStream* stream);
   bool RestoreObject(ByteStream* stream);
 
+  // Result of a TryWait fast-path probe.
+  enum class TryWaitResult {
+    // The object type cannot answer without the host kernel.
+    kNotSupported,
+    // The wait is satisfied, and satisfying it consumed no object state.
+    kSignaled,
+    // The object is provably unsignaled; a poll can time out right away.
+    kNotSignaled,
+  };
+
+  // Probes the object state without a host kernel transition, where the
+  // object type supports that. Only called from Wait for non-alertable
+  // waits; see the XEvent/XSemaphore overrides for the rules involved.
+  virtual TryWaitResult TryWait() { return TryWaitResult::kNotSupported; }
+
   // Called on successful wait.
   virtual void WaitCallback() {}
+
+  // Called by signaling primitives (event set/pulse, semaphore release,
+  // mutant release) so waits can be attributed to the signaling thread.
+  void StoreSignalThread();
   virtual xe::threading::WaitHandle* GetWaitHandle() { return nullptr; }
 
   // Creates the kernel object for guest code to use. Typically not needed.
@@ -225,6 +258,15 @@ class XObject {
   std::vector<X_HANDLE> handles_;
   std::string name_;  // May be zero length.
 
+  // See last_signal_thread_id().
+  std::atomic<uint32_t> last_signal_thread_id_ = {0};
+  // Saturating count of consecutive blocked waits on this object that were
+  // satisfied within the short-wait threshold. Nonzero means the signaler
+  // usually arrives within microseconds, so Wait burns a bounded user-mode
+  // spin before parking in the host kernel. Approximate by design; races
+  // only ever cost a misjudged spin or an early park.
+  std::atomic<uint32_t> short_wait_streak_ = {0};
+
   // Guest pointer for kernel object. Remember: X_OBJECT_HEADER precedes this
   // if we allocated it!
   uint32_t guest_object_ptr_ = 0;
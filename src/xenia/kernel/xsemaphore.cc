@@ -26,6 +26,7 @@ void XSemaphore::Initialize(int32_t initial_count, int32_t maximum_count) {
   CreateNative(sizeof(X_KSEMAPHORE));
 
   maximum_count_ = maximum_count;
+  count_hint_ = initial_count;
   semaphore_ = xe::threading::Semaphore::Create(initial_count, maximum_count);
 }
 
@@ -34,12 +35,37 @@ void XSemaphore::InitializeNative(void* native_ptr, X_DISPATCH_HEADER* header) {
 
   auto semaphore = reinterpret_cast<X_KSEMAPHORE*>(native_ptr);
   maximum_count_ = semaphore->limit;
+  count_hint_ = semaphore->header.signal_state;
   semaphore_ = xe::threading::Semaphore::Create(semaphore->header.signal_state,
                                                 semaphore->limit);
 }
 
+XObject::TryWaitResult XSemaphore::TryWait() {
+  // Acquires have to go through the host semaphore - claiming a count here
+  // could double-release a waiter already parked in a host wait. The hint
+  // never under-counts though, so zero proves there is nothing to acquire
+  // and lets polls bail without the host transition.
+  return count_hint_.load(std::memory_order_acquire)
+             ? TryWaitResult::kNotSupported
+             : TryWaitResult::kNotSignaled;
+}
+
+void XSemaphore::WaitCallback() {
+  // A host wait delivered one count. Clamp at zero: the hint may have been
+  // bumped for releases past the maximum that the host rejected.
+  uint32_t count = count_hint_.load(std::memory_order_relaxed);
+  while (count && !count_hint_.compare_exchange_weak(
+                      count, count - 1, std::memory_order_acq_rel)) {
+  }
+}
+
 int32_t XSemaphore::ReleaseSemaphore(int32_t release_count) {
+  StoreSignalThread();
   int32_t previous_count = 0;
+  // Bumped before the host release so the hint never under-counts.
+  if (release_count > 0) {
+    count_hint_.fetch_add(release_count, std::memory_order_acq_rel);
+  }
   semaphore_->Release(release_count, &previous_count);
   return previous_count;
 }
@@ -82,6 +108,7 @@ object_ref<XSemaphore> XSemaphore::Restore(KernelState* kernel_state,
   XELOGD("XSemaphore %.8X (count %d/%d)", sem->handle(), free_count,
          sem->maximum_count_);
 
+  sem->count_hint_ = free_count;
   sem->semaphore_ =
       threading::Semaphore::Create(free_count, sem->maximum_count_);
 
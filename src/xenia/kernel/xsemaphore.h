@@ -10,6 +10,8 @@
 #ifndef XENIA_KERNEL_XSEMAPHORE_H_
 #define XENIA_KERNEL_XSEMAPHORE_H_
 
+#include <atomic>
+
 #include "xenia/base/threading.h"
 #include "xenia/kernel/xobject.h"
 #include "xenia/xbox.h"
@@ -40,6 +42,8 @@ class XSemaphore : public XObject {
                                         ByteStream* stream);
 
  protected:
+  TryWaitResult TryWait() override;
+  void WaitCallback() override;
   xe::threading::WaitHandle* GetWaitHandle() override {
     return semaphore_.get();
   }
@@ -47,6 +51,10 @@ class XSemaphore : public XObject {
  private:
   std::unique_ptr<xe::threading::Semaphore> semaphore_;
   uint32_t maximum_count_ = 0;
+  // Mirror of the available count for the user-mode wait fast path, see
+  // TryWait. May over-count (releases land after it's bumped) but never
+  // under-counts, so a zero reliably means nothing to acquire.
+  std::atomic<uint32_t> count_hint_ = {0};
 };
 
 }  // namespace kernel
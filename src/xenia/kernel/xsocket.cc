@@ -9,6 +9,8 @@
 
 #include "src/xenia/kernel/xsocket.h"
 
+#include <vector>
+
 #include "xenia/base/platform.h"
 #include "xenia/kernel/kernel_state.h"
 #include "xenia/kernel/xam/xam_module.h"
@@ -238,6 +240,47 @@ int XSocket::SendTo(uint8_t* buf, uint32_t buf_len, uint32_t flags,
                 to ? (sockaddr*)&nto : nullptr, to_len);
 }
 
+int XSocket::SendTo(const BufferSpan* buffers, uint32_t buffer_count,
+                    uint32_t flags, N_XSOCKADDR_IN* to, uint32_t to_len) {
+  sockaddr_in nto;
+  if (to) {
+    nto.sin_addr.s_addr = to->sin_addr;
+    nto.sin_family = to->sin_family;
+    nto.sin_port = to->sin_port;
+  }
+
+#ifdef XE_PLATFORM_WIN32
+  std::vector<WSABUF> wsa_buffers(buffer_count);
+  for (uint32_t i = 0; i < buffer_count; i++) {
+    wsa_buffers[i].buf = reinterpret_cast<char*>(buffers[i].data);
+    wsa_buffers[i].len = buffers[i].length;
+  }
+
+  DWORD bytes_sent = 0;
+  int ret = WSASendTo(native_handle_, wsa_buffers.data(), buffer_count,
+                      &bytes_sent, flags, to ? (sockaddr*)&nto : nullptr,
+                      to_len, nullptr, nullptr);
+  if (ret != 0) {
+    return -1;
+  }
+
+  return int(bytes_sent);
+#else
+  std::vector<iovec> iovecs(buffer_count);
+  for (uint32_t i = 0; i < buffer_count; i++) {
+    iovecs[i].iov_base = buffers[i].data;
+    iovecs[i].iov_len = buffers[i].length;
+  }
+
+  msghdr msg = {};
+  msg.msg_name = to ? &nto : nullptr;
+  msg.msg_namelen = to ? to_len : 0;
+  msg.msg_iov = iovecs.data();
+  msg.msg_iovlen = buffer_count;
+  return int(sendmsg(native_handle_, &msg, flags));
+#endif
+}
+
 bool XSocket::QueuePacket(uint32_t src_ip, uint16_t src_port,
                           const uint8_t* buf, size_t len) {
   packet* pkt = reinterpret_cast<packet*>(new uint8_t[sizeof(packet) + len]);
@@ -114,6 +114,18 @@ class XSocket : public XObject {
   int SendTo(uint8_t* buf, uint32_t buf_len, uint32_t flags, N_XSOCKADDR_IN* to,
              uint32_t to_len);
 
+  // A single span of a scatter-gather send. Pointers are host-translated
+  // guest memory and are handed to the host socket API untouched.
+  struct BufferSpan {
+    uint8_t* data;
+    uint32_t length;
+  };
+
+  // Scatter-gather sendto: the host API gathers the spans directly out of
+  // guest memory, so no intermediate combine buffer is allocated.
+  int SendTo(const BufferSpan* buffers, uint32_t buffer_count, uint32_t flags,
+             N_XSOCKADDR_IN* to, uint32_t to_len);
+
   struct packet {
     // These values are in network byte order.
     xe::be<uint16_t> src_port;
@@ -9,7 +9,10 @@
 
 #include "xenia/kernel/xthread.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #ifdef XE_PLATFORM_WIN32
 #include <objbase.h>
@@ -34,6 +37,14 @@ DEFINE_bool(ignore_thread_priorities, true,
             "Ignores game-specified thread priorities.", "Kernel");
 DEFINE_bool(ignore_thread_affinities, true,
             "Ignores game-specified thread affinities.", "Kernel");
+DEFINE_string(
+    guest_affinity_map, "",
+    "Maps the six guest hardware threads onto host logical processors as a "
+    "comma-separated list of host CPU indices, e.g. \"0,2,4,6,8,10\" to "
+    "keep guest threads off SMT siblings or E-cores. Empty uses the guest "
+    "CPU number as the host CPU number directly. Only honored when "
+    "--ignore_thread_affinities=false.",
+    "Kernel");
 
 namespace xe {
 namespace kernel {
@@ -46,8 +57,13 @@ using xe::cpu::ppc::PPCOpcode;
 
 uint32_t next_xthread_id_ = 0;
 
+std::atomic<uint32_t> XThread::live_thread_count_ = {0};
+std::atomic<uint32_t> XThread::parked_thread_count_ = {0};
+
 XThread::XThread(KernelState* kernel_state)
-    : XObject(kernel_state, kType), guest_thread_(true) {}
+    : XObject(kernel_state, kType), guest_thread_(true) {
+  live_thread_count_.fetch_add(1, std::memory_order_relaxed);
+}
 
 XThread::XThread(KernelState* kernel_state, uint32_t stack_size,
                  uint32_t xapi_thread_startup, uint32_t start_address,
@@ -78,9 +94,13 @@ XThread::XThread(KernelState* kernel_state, uint32_t stack_size,
 
   // The kernel does not take a reference. We must unregister in the dtor.
   kernel_state_->RegisterThread(this);
+
+  live_thread_count_.fetch_add(1, std::memory_order_relaxed);
 }
 
 XThread::~XThread() {
+  live_thread_count_.fetch_sub(1, std::memory_order_relaxed);
+
   // Unregister first to prevent lookups while deleting.
   kernel_state_->UnregisterThread(this);
 
@@ -155,6 +175,82 @@ void XThread::set_name(const std::string& name) {
   }
 }
 
+// Host affinity mask for each guest hardware thread, resolved once from
+// --guest_affinity_map (host CPU topology when unset, identity when the
+// topology is unknown or too small).
+struct GuestAffinityMap {
+  uint64_t host_cpu_masks[6];
+  GuestAffinityMap() {
+    for (uint32_t i = 0; i < xe::countof(host_cpu_masks); ++i) {
+      host_cpu_masks[i] = uint64_t(1) << i;
+    }
+    // Topology-aware defaults when the host has enough physical cores: one
+    // distinct physical core (with all its SMT siblings) per guest CPU,
+    // preferring cores that share the largest last-level cache group so
+    // guest threads don't communicate across CCX/CCD boundaries. The
+    // identity mapping above would place pairs of guest CPUs on the SMT
+    // siblings of the same cores.
+    const auto& topology = xe::threading::logical_processor_topology();
+    if (!topology.empty() && topology.size() <= 64) {
+      uint32_t core_count = 0;
+      for (const auto& processor : topology) {
+        core_count = std::max(core_count, processor.physical_core + 1);
+      }
+      if (core_count >= xe::countof(host_cpu_masks)) {
+        std::vector<uint64_t> core_masks(core_count, 0);
+        for (size_t i = 0; i < topology.size(); ++i) {
+          core_masks[topology[i].physical_core] |= uint64_t(1) << i;
+        }
+        uint64_t llc_mask = xe::threading::largest_llc_group_affinity_mask();
+        std::vector<uint64_t> ordered_masks;
+        for (uint64_t core_mask : core_masks) {
+          if (core_mask & llc_mask) {
+            ordered_masks.push_back(core_mask);
+          }
+        }
+        for (uint64_t core_mask : core_masks) {
+          if (!(core_mask & llc_mask)) {
+            ordered_masks.push_back(core_mask);
+          }
+        }
+        for (uint32_t i = 0; i < xe::countof(host_cpu_masks); ++i) {
+          host_cpu_masks[i] = ordered_masks[i];
+        }
+      }
+    }
+    const std::string& map = cvars::guest_affinity_map;
+    size_t pos = 0;
+    for (uint32_t i = 0;
+         i < xe::countof(host_cpu_masks) && pos < map.size(); ++i) {
+      int host_cpu = std::atoi(map.c_str() + pos);
+      if (host_cpu < 0 || host_cpu >= 64) {
+        XELOGW("Ignoring out-of-range host CPU %d in --guest_affinity_map",
+               host_cpu);
+      } else {
+        host_cpu_masks[i] = uint64_t(1) << host_cpu;
+      }
+      pos = map.find(',', pos);
+      if (pos == std::string::npos) {
+        break;
+      }
+      ++pos;
+    }
+  }
+};
+
+// Translates a guest processor affinity mask into a host affinity mask,
+// applying the configured guest-to-host CPU mapping.
+uint64_t HostAffinityMask(uint8_t guest_mask) {
+  static const GuestAffinityMap map;
+  uint64_t host_mask = 0;
+  for (uint32_t cpu = 0; cpu < xe::countof(map.host_cpu_masks); ++cpu) {
+    if (guest_mask & (uint32_t(1) << cpu)) {
+      host_mask |= map.host_cpu_masks[cpu];
+    }
+  }
+  return host_mask;
+}
+
 uint8_t next_cpu = 0;
 uint8_t GetFakeCpuNumber(uint8_t proc_mask) {
   if (!proc_mask) {
@@ -414,8 +510,8 @@ X_STATUS XThread::Create() {
     return X_STATUS_NO_MEMORY;
   }
 
-  if (!cvars::ignore_thread_affinities) {
-    thread_->set_affinity_mask(proc_mask);
+  if (!cvars::ignore_thread_affinities && proc_mask) {
+    thread_->set_affinity_mask(HostAffinityMask(proc_mask));
   }
 
   // Set the thread name based on host ID (for easier debugging).
@@ -547,6 +643,21 @@ uint32_t XThread::RaiseIrql(uint32_t new_irql) {
 
 void XThread::LowerIrql(uint32_t new_irql) { irql_ = new_irql; }
 
+bool XThread::AreHostCoresOversubscribed() {
+  uint32_t live = live_thread_count_.load(std::memory_order_relaxed);
+  uint32_t parked = parked_thread_count_.load(std::memory_order_relaxed);
+  uint32_t runnable = live > parked ? live - parked : 0;
+  return runnable > xe::threading::logical_processor_count();
+}
+
+void XThread::OnThreadParked() {
+  parked_thread_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void XThread::OnThreadUnparked() {
+  parked_thread_count_.fetch_sub(1, std::memory_order_relaxed);
+}
+
 void XThread::CheckApcs() { DeliverAPCs(); }
 
 void XThread::LockApc() { EnterCriticalRegion(); }
@@ -561,10 +672,9 @@ void XThread::UnlockApc(bool queue_delivery) {
 
 void XThread::EnqueueApc(uint32_t normal_routine, uint32_t normal_context,
                          uint32_t arg1, uint32_t arg2) {
-  LockApc();
-
   // Allocate APC.
-  // We'll tag it as special and free it when dispatched.
+  // We'll tag it as special and free it when dispatched. Allocated and
+  // filled before taking the global lock; only the list insert needs it.
   uint32_t apc_ptr = memory()->SystemHeapAlloc(XAPC::kSize);
   auto apc = reinterpret_cast<XAPC*>(memory()->TranslateVirtual(apc_ptr));
 
@@ -578,8 +688,8 @@ void XThread::EnqueueApc(uint32_t normal_routine, uint32_t normal_context,
   apc->enqueued = 1;
 
   uint32_t list_entry_ptr = apc_ptr + 8;
+  LockApc();
   apc_list_.Insert(list_entry_ptr);
-
   UnlockApc(true);
 }
 
@@ -587,66 +697,80 @@ void XThread::DeliverAPCs() {
   // https://www.drdobbs.com/inside-nts-asynchronous-procedure-call/184416590?pgno=1
   // https://www.drdobbs.com/inside-nts-asynchronous-procedure-call/184416590?pgno=7
   auto processor = kernel_state()->processor();
-  LockApc();
-  while (apc_list_.HasPending()) {
-    // Get APC entry (offset for LIST_ENTRY offset) and cache what we need.
-    // Calling the routine may delete the memory/overwrite it.
-    uint32_t apc_ptr = apc_list_.Shift() - 8;
-    auto apc = reinterpret_cast<XAPC*>(memory()->TranslateVirtual(apc_ptr));
-    bool needs_freeing = apc->kernel_routine == XAPC::kDummyKernelRoutine;
-
-    XELOGD("Delivering APC to %.8X", uint32_t(apc->normal_routine));
-
-    // Mark as uninserted so that it can be reinserted again by the routine.
-    apc->enqueued = 0;
-
-    // Call kernel routine.
-    // The routine can modify all of its arguments before passing it on.
-    // Since we need to give guest accessible pointers over, we copy things
-    // into and out of scratch.
-    uint8_t* scratch_ptr = memory()->TranslateVirtual(scratch_address_);
-    xe::store_and_swap<uint32_t>(scratch_ptr + 0, apc->normal_routine);
-    xe::store_and_swap<uint32_t>(scratch_ptr + 4, apc->normal_context);
-    xe::store_and_swap<uint32_t>(scratch_ptr + 8, apc->arg1);
-    xe::store_and_swap<uint32_t>(scratch_ptr + 12, apc->arg2);
-    if (apc->kernel_routine != XAPC::kDummyKernelRoutine) {
-      // kernel_routine(apc_address, &normal_routine, &normal_context,
-      // &system_arg1, &system_arg2)
-      uint64_t kernel_args[] = {
-          apc_ptr,
-          scratch_address_ + 0,
-          scratch_address_ + 4,
-          scratch_address_ + 8,
-          scratch_address_ + 12,
-      };
-      processor->Execute(thread_state_, apc->kernel_routine, kernel_args,
-                         xe::countof(kernel_args));
+  std::vector<uint32_t> batch;
+  while (true) {
+    // Drain everything queued so far in one lock acquisition and run the
+    // routines with the lock dropped, so workers enqueueing more APCs don't
+    // ping-pong the global lock against us. Anything enqueued while we run
+    // is picked up by the re-drain.
+    batch.clear();
+    LockApc();
+    while (apc_list_.HasPending()) {
+      // Get APC entry (offset for LIST_ENTRY offset).
+      uint32_t apc_ptr = apc_list_.Shift() - 8;
+      auto apc = reinterpret_cast<XAPC*>(memory()->TranslateVirtual(apc_ptr));
+      // Mark as uninserted so that it can be reinserted again by the routine.
+      apc->enqueued = 0;
+      batch.push_back(apc_ptr);
     }
-    uint32_t normal_routine = xe::load_and_swap<uint32_t>(scratch_ptr + 0);
-    uint32_t normal_context = xe::load_and_swap<uint32_t>(scratch_ptr + 4);
-    uint32_t arg1 = xe::load_and_swap<uint32_t>(scratch_ptr + 8);
-    uint32_t arg2 = xe::load_and_swap<uint32_t>(scratch_ptr + 12);
-
-    // Call the normal routine. Note that it may have been killed by the kernel
-    // routine.
-    if (normal_routine) {
-      UnlockApc(false);
-      // normal_routine(normal_context, system_arg1, system_arg2)
-      uint64_t normal_args[] = {normal_context, arg1, arg2};
-      processor->Execute(thread_state_, normal_routine, normal_args,
-                         xe::countof(normal_args));
-      LockApc();
+    UnlockApc(false);
+    if (batch.empty()) {
+      break;
     }
 
-    XELOGD("Completed delivery of APC to %.8X (%.8X, %.8X, %.8X)",
-           normal_routine, normal_context, arg1, arg2);
+    for (uint32_t apc_ptr : batch) {
+      // Cache what we need; calling the routine may delete/overwrite the
+      // memory.
+      auto apc = reinterpret_cast<XAPC*>(memory()->TranslateVirtual(apc_ptr));
+      bool needs_freeing = apc->kernel_routine == XAPC::kDummyKernelRoutine;
+
+      XELOGD("Delivering APC to %.8X", uint32_t(apc->normal_routine));
+
+      // Call kernel routine.
+      // The routine can modify all of its arguments before passing it on.
+      // Since we need to give guest accessible pointers over, we copy things
+      // into and out of scratch.
+      uint8_t* scratch_ptr = memory()->TranslateVirtual(scratch_address_);
+      xe::store_and_swap<uint32_t>(scratch_ptr + 0, apc->normal_routine);
+      xe::store_and_swap<uint32_t>(scratch_ptr + 4, apc->normal_context);
+      xe::store_and_swap<uint32_t>(scratch_ptr + 8, apc->arg1);
+      xe::store_and_swap<uint32_t>(scratch_ptr + 12, apc->arg2);
+      if (apc->kernel_routine != XAPC::kDummyKernelRoutine) {
+        // kernel_routine(apc_address, &normal_routine, &normal_context,
+        // &system_arg1, &system_arg2)
+        uint64_t kernel_args[] = {
+            apc_ptr,
+            scratch_address_ + 0,
+            scratch_address_ + 4,
+            scratch_address_ + 8,
+            scratch_address_ + 12,
+        };
+        processor->Execute(thread_state_, apc->kernel_routine, kernel_args,
+                           xe::countof(kernel_args));
+      }
+      uint32_t normal_routine = xe::load_and_swap<uint32_t>(scratch_ptr + 0);
+      uint32_t normal_context = xe::load_and_swap<uint32_t>(scratch_ptr + 4);
+      uint32_t arg1 = xe::load_and_swap<uint32_t>(scratch_ptr + 8);
+      uint32_t arg2 = xe::load_and_swap<uint32_t>(scratch_ptr + 12);
+
+      // Call the normal routine. Note that it may have been killed by the
+      // kernel routine.
+      if (normal_routine) {
+        // normal_routine(normal_context, system_arg1, system_arg2)
+        uint64_t normal_args[] = {normal_context, arg1, arg2};
+        processor->Execute(thread_state_, normal_routine, normal_args,
+                           xe::countof(normal_args));
+      }
+
+      XELOGD("Completed delivery of APC to %.8X (%.8X, %.8X, %.8X)",
+             normal_routine, normal_context, arg1, arg2);
 
-    // If special, free it.
-    if (needs_freeing) {
-      memory()->SystemHeapFree(apc_ptr);
+      // If special, free it.
+      if (needs_freeing) {
+        memory()->SystemHeapFree(apc_ptr);
+      }
     }
   }
-  UnlockApc(true);
 }
 
 void XThread::RundownAPCs() {
@@ -717,8 +841,8 @@ void XThread::SetAffinity(uint32_t affinity) {
   }
   SetActiveCpu(GetFakeCpuNumber(affinity));
   affinity_ = affinity;
-  if (!cvars::ignore_thread_affinities) {
-    thread_->set_affinity_mask(affinity);
+  if (!cvars::ignore_thread_affinities && affinity) {
+    thread_->set_affinity_mask(HostAffinityMask(uint8_t(affinity)));
   }
 }
 
@@ -768,7 +892,7 @@ X_STATUS XThread::Resume(uint32_t* out_suspend_count) {
 }
 
 X_STATUS XThread::Suspend(uint32_t* out_suspend_count) {
-  auto global_lock = global_critical_region_.Acquire();
+  auto global_lock = global_critical_region_.Acquire(__FUNCTION__);
 
   ++guest_object<X_KTHREAD>()->suspend_count;
 
@@ -800,9 +924,13 @@ X_STATUS XThread::Delay(uint32_t processor_mode, uint32_t alertable,
     timeout_ms = 0;
   }
   timeout_ms = Clock::ScaleGuestDurationMillis(timeout_ms);
+  // A sleeping thread doesn't occupy a host core; let the oversubscription
+  // heuristic see that.
+  OnThreadParked();
   if (alertable) {
     auto result =
         xe::threading::AlertableSleep(std::chrono::milliseconds(timeout_ms));
+    OnThreadUnparked();
     switch (result) {
       default:
       case xe::threading::SleepResult::kSuccess:
@@ -812,6 +940,7 @@ X_STATUS XThread::Delay(uint32_t processor_mode, uint32_t alertable,
     }
   } else {
     xe::threading::Sleep(std::chrono::milliseconds(timeout_ms));
+    OnThreadUnparked();
     return X_STATUS_SUCCESS;
   }
 }
@@ -131,6 +131,17 @@ class XThread : public XObject, public cpu::Thread {
   static uint32_t GetLastError();
   static void SetLastError(uint32_t error_code);
 
+  // True when more threads are live and not parked in a host-kernel wait
+  // than the host has logical cores. In that state a spinning thread steals
+  // cycles from a runnable one and adds to the context-switch thrash, so
+  // wait fast paths should park immediately; see XObject::Wait.
+  static bool AreHostCoresOversubscribed();
+  // Brackets a park in the host kernel (blocking wait or sleep) so parked
+  // threads don't count against the core budget. Calls must be paired on
+  // the parking thread.
+  static void OnThreadParked();
+  static void OnThreadUnparked();
+
   const CreationParams* creation_params() const { return &creation_params_; }
   uint32_t tls_ptr() const { return tls_static_address_; }
   uint32_t pcr_ptr() const { return pcr_address_; }
@@ -225,6 +236,11 @@ class XThread : public XObject, public cpu::Thread {
   xe::global_critical_region global_critical_region_;
   std::atomic<uint32_t> irql_ = {0};
   util::NativeList apc_list_;
+
+  // See AreHostCoresOversubscribed. Live is maintained by the
+  // constructor/destructor, parked by OnThreadParked/OnThreadUnparked.
+  static std::atomic<uint32_t> live_thread_count_;
+  static std::atomic<uint32_t> parked_thread_count_;
 };
 
 class XHostThread : public XThread {
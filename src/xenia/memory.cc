@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <utility>
 
 #include "xenia/base/byte_stream.h"
 #include "xenia/base/clock.h"
@@ -29,6 +30,35 @@ DEFINE_bool(protect_on_release, false,
             "Protect released memory to prevent accesses.", "Memory");
 DEFINE_bool(scribble_heap, false,
             "Scribble 0xCD into all allocated heap memory.", "Memory");
+DEFINE_bool(adaptive_memory_unwatch, true,
+            "Widen the range unprotected by a physical memory write watch "
+            "fault around 64 KB regions that keep faulting, trading coarser "
+            "re-upload granularity for fewer access violations in streaming "
+            "titles.",
+            "Memory");
+DEFINE_bool(guest_memory_large_pages, true,
+            "Request 2MB large page backing for the guest physical heap to "
+            "reduce TLB pressure from streaming accesses. Advisory; the OS "
+            "falls back to regular pages where it can't oblige.",
+            "Memory");
+DEFINE_bool(eager_commit_physical_memory, false,
+            "Commit and prefault the entire 512MB physical heap backing at "
+            "startup instead of committing on first touch, trading resident "
+            "memory for the page fault storms otherwise seen right after "
+            "level loads in streaming titles.",
+            "Memory");
+DEFINE_bool(trim_released_guest_memory, false,
+            "Return the host pages backing decommitted or released guest "
+            "physical memory to the OS where the platform supports it. "
+            "Trimmed ranges read back as zeroes, so titles that read memory "
+            "after freeing it may misbehave with this set.",
+            "Memory");
+DEFINE_bool(guest_memory_heat_map, false,
+            "Count guest physical memory write access violations per 64 KB "
+            "region into a heat map included in the memory map dump, to tune "
+            "memory watch granularity against a title's streaming behavior. "
+            "Adds an atomic increment to every write violation.",
+            "Memory");
 
 namespace xe {
 uint32_t get_page_count(uint32_t value, uint32_t page_size) {
@@ -175,6 +205,28 @@ bool Memory::Initialize() {
   heaps_.vE0000000.Initialize(this, virtual_membase_, 0xE0000000, 0x1FD00000,
                               4096, &heaps_.physical);
 
+  if (cvars::guest_memory_large_pages) {
+    // Advise every view of the physical heap so accesses through any alias
+    // benefit; the backing pages are shared, so the OS only promotes once.
+    xe::memory::AdviseLargePages(physical_membase_, 0x20000000);
+    xe::memory::AdviseLargePages(virtual_membase_ + 0xA0000000, 0x20000000);
+    xe::memory::AdviseLargePages(virtual_membase_ + 0xC0000000, 0x20000000);
+    xe::memory::AdviseLargePages(virtual_membase_ + 0xE0000000, 0x1FD00000);
+  }
+  if (cvars::eager_commit_physical_memory) {
+    // Commit the whole physical range and touch each page so the soft fault
+    // cost is paid here rather than spread across the first frames of
+    // streaming after a level load.
+    xe::memory::AllocFixed(physical_membase_, 0x20000000,
+                           xe::memory::AllocationType::kCommit,
+                           xe::memory::PageAccess::kReadWrite);
+    volatile uint8_t* prefault = physical_membase_;
+    for (size_t offset = 0; offset < 0x20000000;
+         offset += system_page_size_) {
+      prefault[offset] = 0;
+    }
+  }
+
   // Protect the first and last 64kb of memory.
   heaps_.v00000000.AllocFixed(
       0x00000000, 0x10000, 0x10000,
@@ -206,6 +258,11 @@ bool Memory::Initialize() {
   heaps_.vA0000000.Alloc(0x340000, 64 * 1024, kMemoryAllocationReserve,
                          kMemoryProtectNoAccess, true, &unk_phys_alloc);
 
+  if (cvars::guest_memory_heat_map) {
+    // 512 MB of physical space in 64 KB regions.
+    physical_write_heat_map_.reset(new std::atomic<uint32_t>[0x2000]());
+  }
+
   return true;
 }
 
@@ -349,6 +406,24 @@ BaseHeap* Memory::LookupHeapByType(bool physical, uint32_t page_size) {
 
 VirtualHeap* Memory::GetPhysicalHeap() { return &heaps_.physical; }
 
+void Memory::TrimPhysicalRange(uint32_t physical_address, uint32_t length) {
+  if (!cvars::trim_released_guest_memory || !length) {
+    return;
+  }
+  // Only whole host pages can be punched out; edge pages shared with live
+  // allocations stay resident.
+  uint64_t page_mask = system_page_size_ - 1;
+  uint64_t start = (uint64_t(physical_address) + page_mask) & ~page_mask;
+  uint64_t end = (uint64_t(physical_address) + length) & ~page_mask;
+  if (end <= start) {
+    return;
+  }
+  // The physical backing lives at 0x100000000 in the mapping (see map_info);
+  // punching the hole there drops the pages from every aliasing view.
+  xe::memory::DiscardFileViewRange(mapping_, 0x100000000ull + start,
+                                   size_t(end - start));
+}
+
 uint32_t Memory::HostToGuestVirtual(const void* host_address) const {
   size_t virtual_address = reinterpret_cast<size_t>(host_address) -
                            reinterpret_cast<size_t>(virtual_membase_);
@@ -449,6 +524,34 @@ bool Memory::AccessViolationCallback(void* host_address, bool is_write) {
   uint32_t virtual_address = HostToGuestVirtual(host_address);
   BaseHeap* heap = LookupHeap(virtual_address);
   if (heap->IsGuestPhysicalHeap()) {
+    uint32_t physical_address = GetPhysicalAddress(virtual_address);
+    if (physical_address != UINT32_MAX) {
+      if (physical_write_heat_map_) {
+        physical_write_heat_map_[physical_address >> 16].fetch_add(
+            1, std::memory_order_relaxed);
+      }
+      physical_write_churn_[physical_address >> 16].fetch_add(
+          1, std::memory_order_relaxed);
+    }
+    // Decay the churn counters about once a second so the widened unwatch
+    // windows shrink back once a streaming burst ends. One faulting thread
+    // wins the race to do the pass; staleness is harmless, the counters are
+    // purely a heuristic.
+    uint64_t now_ticks = Clock::QueryHostTickCount();
+    uint64_t last_decay_ticks =
+        physical_write_churn_decay_ticks_.load(std::memory_order_relaxed);
+    if (now_ticks - last_decay_ticks >= Clock::QueryHostTickFrequency() &&
+        physical_write_churn_decay_ticks_.compare_exchange_strong(
+            last_decay_ticks, now_ticks, std::memory_order_relaxed)) {
+      for (size_t i = 0; i < xe::countof(physical_write_churn_); ++i) {
+        uint32_t count =
+            physical_write_churn_[i].load(std::memory_order_relaxed);
+        if (count) {
+          physical_write_churn_[i].store(count >> 1,
+                                         std::memory_order_relaxed);
+        }
+      }
+    }
     // Will be rounded to physical page boundaries internally, so just pass 1 as
     // the length - guranteed not to cross page boundaries also.
     return static_cast<PhysicalHeap*>(heap)->TriggerWatches(virtual_address, 1,
@@ -533,6 +636,31 @@ void Memory::SystemHeapFree(uint32_t address) {
   heap->Release(address);
 }
 
+namespace {
+void DumpHeapUsageLine(const char* name, BaseHeap* heap) {
+  uint32_t reserved_pages =
+      heap->GetTotalPageCount() - heap->GetUnreservedPageCount();
+  XELOGI("  %-10s %8.2f MiB reserved of %8.2f MiB (%d KiB pages)", name,
+         double(uint64_t(reserved_pages) * heap->page_size()) /
+             (1024.0 * 1024.0),
+         double(uint64_t(heap->GetTotalPageCount()) * heap->page_size()) /
+             (1024.0 * 1024.0),
+         heap->page_size() / 1024);
+}
+}  // namespace
+
+void Memory::DumpHeapUsage() {
+  XELOGI("Guest heap usage:");
+  DumpHeapUsageLine("v00000000", &heaps_.v00000000);
+  DumpHeapUsageLine("v40000000", &heaps_.v40000000);
+  DumpHeapUsageLine("v80000000", &heaps_.v80000000);
+  DumpHeapUsageLine("v90000000", &heaps_.v90000000);
+  DumpHeapUsageLine("physical", &heaps_.physical);
+  DumpHeapUsageLine("vA0000000", &heaps_.vA0000000);
+  DumpHeapUsageLine("vC0000000", &heaps_.vC0000000);
+  DumpHeapUsageLine("vE0000000", &heaps_.vE0000000);
+}
+
 void Memory::DumpMap() {
   XELOGE("==================================================================");
   XELOGE("Memory Dump");
@@ -562,6 +690,23 @@ void Memory::DumpMap() {
   heaps_.vC0000000.DumpMap();
   heaps_.vE0000000.DumpMap();
   XELOGE("");
+  if (physical_write_heat_map_) {
+    XELOGE(
+        "------------------------------------------------------------------");
+    XELOGE("Physical Write Heat Map (64 KB regions)");
+    XELOGE(
+        "------------------------------------------------------------------");
+    XELOGE("");
+    for (uint32_t i = 0; i < 0x2000; ++i) {
+      uint32_t count =
+          physical_write_heat_map_[i].load(std::memory_order_relaxed);
+      if (count != 0) {
+        XELOGE("  %.8X-%.8X: %u write violations", i << 16,
+               ((i + 1) << 16) - 1, count);
+      }
+    }
+    XELOGE("");
+  }
 }
 
 bool Memory::Save(ByteStream* stream) {
@@ -629,6 +774,7 @@ void BaseHeap::Initialize(Memory* memory, uint8_t* membase, uint32_t heap_base,
   page_size_ = page_size;
   host_address_offset_ = host_address_offset;
   page_table_.resize(heap_size / page_size);
+  free_page_map_.Resize(page_table_.size());
 }
 
 void BaseHeap::Dispose() {
@@ -726,6 +872,31 @@ uint32_t BaseHeap::GetUnreservedPageCount() {
 bool BaseHeap::Save(ByteStream* stream) {
   XELOGD("Heap %.8X-%.8X", heap_base_, heap_base_ + heap_size_);
 
+  // Reading a page only requires read access, so only committed pages whose
+  // current protection forbids reading need a protection change - and those
+  // are toggled in batched spans rather than per page, since the protection
+  // syscalls dominate the save time on large heaps.
+  auto page_unreadable = [this](const PageEntry& page) {
+    return (page.state & kMemoryAllocationCommit) &&
+           ToPageAccess(page.current_protect) == memory::PageAccess::kNoAccess;
+  };
+  std::vector<std::pair<size_t, size_t>> unreadable_spans;
+  size_t span_start = SIZE_MAX;
+  for (size_t i = 0; i <= page_table_.size(); i++) {
+    bool unreadable = i < page_table_.size() && page_unreadable(page_table_[i]);
+    if (unreadable && span_start == SIZE_MAX) {
+      span_start = i;
+    } else if (!unreadable && span_start != SIZE_MAX) {
+      unreadable_spans.emplace_back(span_start, i - span_start);
+      span_start = SIZE_MAX;
+    }
+  }
+  for (auto& span : unreadable_spans) {
+    memory::Protect(TranslateRelative(span.first * page_size_),
+                    span.second * page_size_, memory::PageAccess::kReadOnly,
+                    nullptr);
+  }
+
   for (size_t i = 0; i < page_table_.size(); i++) {
     auto& page = page_table_[i];
     stream->Write(page.qword);
@@ -736,18 +907,16 @@ bool BaseHeap::Save(ByteStream* stream) {
 
     // TODO(DrChat): write compressed with snappy.
     if (page.state & kMemoryAllocationCommit) {
-      void* addr = TranslateRelative(i * page_size_);
-
-      memory::PageAccess old_access;
-      memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite,
-                      &old_access);
-
-      stream->Write(addr, page_size_);
-
-      memory::Protect(addr, page_size_, old_access, nullptr);
+      stream->Write(TranslateRelative(i * page_size_), page_size_);
     }
   }
 
+  for (auto& span : unreadable_spans) {
+    memory::Protect(TranslateRelative(span.first * page_size_),
+                    span.second * page_size_, memory::PageAccess::kNoAccess,
+                    nullptr);
+  }
+
   return true;
 }
 
@@ -757,38 +926,54 @@ bool BaseHeap::Restore(ByteStream* stream) {
   for (size_t i = 0; i < page_table_.size(); i++) {
     auto& page = page_table_[i];
     page.qword = stream->Read<uint64_t>();
+    // Keep the free page map in sync with the restored table.
+    if (page.state) {
+      free_page_map_.Clear(i);
+    } else {
+      free_page_map_.Set(i);
+    }
     if (!page.state) {
       // Unallocated.
       continue;
     }
 
-    memory::PageAccess page_access = memory::PageAccess::kNoAccess;
-    if ((page.current_protect & kMemoryProtectRead) &&
-        (page.current_protect & kMemoryProtectWrite)) {
-      page_access = memory::PageAccess::kReadWrite;
-    } else if (page.current_protect & kMemoryProtectRead) {
-      page_access = memory::PageAccess::kReadOnly;
-    }
-
-    // Commit the memory if it isn't already. We do not need to reserve any
-    // memory, as the mapping has already taken care of that.
-    if (page.state & kMemoryAllocationCommit) {
-      xe::memory::AllocFixed(TranslateRelative(i * page_size_), page_size_,
-                             memory::AllocationType::kCommit,
-                             memory::PageAccess::kReadWrite);
-    }
-
-    // Now read into memory. We'll set R/W protection first, then set the
-    // protection back to its previous state.
+    // Commit the memory writable if it isn't already, then read the page
+    // contents straight in. We do not need to reserve any memory, as the
+    // mapping has already taken care of that. The final protection is
+    // applied afterwards in batched spans - most pages end up read-write
+    // and need no protection change at all.
     // TODO(DrChat): read compressed with snappy.
     if (page.state & kMemoryAllocationCommit) {
       void* addr = TranslateRelative(i * page_size_);
-      xe::memory::Protect(addr, page_size_, memory::PageAccess::kReadWrite,
-                          nullptr);
-
+      xe::memory::AllocFixed(addr, page_size_,
+                             memory::AllocationType::kCommit,
+                             memory::PageAccess::kReadWrite);
       stream->Read(addr, page_size_);
+    }
+  }
 
-      xe::memory::Protect(addr, page_size_, page_access, nullptr);
+  // Apply final page protections in batched spans of equal access.
+  size_t span_start = SIZE_MAX;
+  memory::PageAccess span_access = memory::PageAccess::kReadWrite;
+  for (size_t i = 0; i <= page_table_.size(); i++) {
+    memory::PageAccess page_access = memory::PageAccess::kReadWrite;
+    bool needs_protect = false;
+    if (i < page_table_.size()) {
+      auto& page = page_table_[i];
+      if (page.state & kMemoryAllocationCommit) {
+        page_access = ToPageAccess(page.current_protect);
+        needs_protect = page_access != memory::PageAccess::kReadWrite;
+      }
+    }
+    if (span_start != SIZE_MAX &&
+        (!needs_protect || page_access != span_access)) {
+      xe::memory::Protect(TranslateRelative(span_start * page_size_),
+                          (i - span_start) * page_size_, span_access, nullptr);
+      span_start = SIZE_MAX;
+    }
+    if (needs_protect && span_start == SIZE_MAX) {
+      span_start = i;
+      span_access = page_access;
     }
   }
 
@@ -798,6 +983,7 @@ bool BaseHeap::Restore(ByteStream* stream) {
 void BaseHeap::Reset() {
   // TODO(DrChat): protect pages.
   std::memset(page_table_.data(), 0, sizeof(PageEntry) * page_table_.size());
+  free_page_map_.SetAll();
   // TODO(Triang3l): Unwatch pages.
 }
 
@@ -854,6 +1040,27 @@ bool BaseHeap::AllocFixed(uint32_t base_address, uint32_t size,
     }
   }
 
+  // Claim the range in the page table, snapshotting the previous entries so
+  // a host failure can be rolled back, then drop the lock across the host
+  // allocation so other threads can keep allocating in the meantime.
+  std::vector<PageEntry> previous_entries(
+      page_table_.begin() + start_page_number,
+      page_table_.begin() + end_page_number + 1);
+  for (uint32_t page_number = start_page_number; page_number <= end_page_number;
+       ++page_number) {
+    auto& page_entry = page_table_[page_number];
+    if (allocation_type & kMemoryAllocationReserve) {
+      // Region is based on reservation.
+      page_entry.base_address = start_page_number;
+      page_entry.region_page_count = page_count;
+    }
+    page_entry.allocation_protect = protect;
+    page_entry.current_protect = protect;
+    page_entry.state = kMemoryAllocationReserve | allocation_type;
+  }
+  free_page_map_.ClearRange(start_page_number, page_count);
+  global_lock.unlock();
+
   // Allocate from host.
   if (allocation_type == kMemoryAllocationReserve) {
     // Reserve is not needed, as we are mapped already.
@@ -866,6 +1073,18 @@ bool BaseHeap::AllocFixed(uint32_t base_address, uint32_t size,
         page_count * page_size_, alloc_type, ToPageAccess(protect));
     if (!result) {
       XELOGE("BaseHeap::AllocFixed failed to alloc range from host");
+      // Return the claimed range to its previous state.
+      global_lock.lock();
+      for (uint32_t page_number = start_page_number;
+           page_number <= end_page_number; ++page_number) {
+        auto& page_entry = page_table_[page_number];
+        page_entry = previous_entries[page_number - start_page_number];
+        if (page_entry.state) {
+          free_page_map_.Clear(page_number);
+        } else {
+          free_page_map_.Set(page_number);
+        }
+      }
       return false;
     }
 
@@ -874,20 +1093,6 @@ bool BaseHeap::AllocFixed(uint32_t base_address, uint32_t size,
     }
   }
 
-  // Set page state.
-  for (uint32_t page_number = start_page_number; page_number <= end_page_number;
-       ++page_number) {
-    auto& page_entry = page_table_[page_number];
-    if (allocation_type & kMemoryAllocationReserve) {
-      // Region is based on reservation.
-      page_entry.base_address = start_page_number;
-      page_entry.region_page_count = page_count;
-    }
-    page_entry.allocation_protect = protect;
-    page_entry.current_protect = protect;
-    page_entry.state = kMemoryAllocationReserve | allocation_type;
-  }
-
   return true;
 }
 
@@ -916,91 +1121,43 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address,
   auto global_lock = global_critical_region_.Acquire();
 
   // Find a free page range.
-  // The base page must match the requested alignment, so we first scan for
-  // a free aligned page and only then check for continuous free pages.
-  // TODO(benvanik): optimized searching (free list buckets, bitmap, etc).
-  uint32_t start_page_number = UINT_MAX;
-  uint32_t end_page_number = UINT_MAX;
+  // The base page must match the requested alignment, so only starts at
+  // page_scan_stride multiples are considered. The free page map scans whole
+  // 64-page words (with a summary level over fully-free words) instead of
+  // walking the page table page by page.
   uint32_t page_scan_stride = alignment / page_size_;
   high_page_number = high_page_number - (high_page_number % page_scan_stride);
-  if (top_down) {
-    for (int64_t base_page_number =
-             high_page_number - xe::round_up(page_count, page_scan_stride);
-         base_page_number >= low_page_number;
-         base_page_number -= page_scan_stride) {
-      if (page_table_[base_page_number].state != 0) {
-        // Base page not free, skip to next usable page.
-        continue;
-      }
-      // Check requested range to ensure free.
-      start_page_number = uint32_t(base_page_number);
-      end_page_number = uint32_t(base_page_number) + page_count - 1;
-      assert_true(end_page_number < page_table_.size());
-      bool any_taken = false;
-      for (uint32_t page_number = uint32_t(base_page_number);
-           !any_taken && page_number <= end_page_number; ++page_number) {
-        bool is_free = page_table_[page_number].state == 0;
-        if (!is_free) {
-          // At least one page in the range is used, skip to next.
-          // We know we'll be starting at least before this page.
-          any_taken = true;
-          if (page_count > page_number) {
-            // Not enough space left to fit entire page range. Breaks outer
-            // loop.
-            base_page_number = -1;
-          } else {
-            base_page_number = page_number - page_count;
-            base_page_number -= base_page_number % page_scan_stride;
-            base_page_number += page_scan_stride;  // cancel out loop logic
-          }
-          break;
-        }
-      }
-      if (!any_taken) {
-        // Found our place.
-        break;
-      }
-      // Retry.
-      start_page_number = end_page_number = UINT_MAX;
-    }
-  } else {
-    for (uint32_t base_page_number = low_page_number;
-         base_page_number <= high_page_number - page_count;
-         base_page_number += page_scan_stride) {
-      if (page_table_[base_page_number].state != 0) {
-        // Base page not free, skip to next usable page.
-        continue;
-      }
-      // Check requested range to ensure free.
-      start_page_number = base_page_number;
-      end_page_number = base_page_number + page_count - 1;
-      bool any_taken = false;
-      for (uint32_t page_number = base_page_number;
-           !any_taken && page_number <= end_page_number; ++page_number) {
-        bool is_free = page_table_[page_number].state == 0;
-        if (!is_free) {
-          // At least one page in the range is used, skip to next.
-          // We know we'll be starting at least after this page.
-          any_taken = true;
-          base_page_number = xe::round_up(page_number + 1, page_scan_stride);
-          base_page_number -= page_scan_stride;  // cancel out loop logic
-          break;
-        }
-      }
-      if (!any_taken) {
-        // Found our place.
-        break;
-      }
-      // Retry.
-      start_page_number = end_page_number = UINT_MAX;
-    }
+  if (page_count > high_page_number) {
+    XELOGE("BaseHeap::Alloc page count too big for requested range");
+    return false;
   }
-  if (start_page_number == UINT_MAX || end_page_number == UINT_MAX) {
+  size_t found_page_number =
+      free_page_map_.FindRun(page_count, page_scan_stride, low_page_number,
+                             high_page_number - 1, top_down);
+  if (found_page_number == xe::RunBitMap::kInvalidIndex) {
     // Out of memory.
     XELOGE("BaseHeap::Alloc failed to find contiguous range");
     assert_always("Heap exhausted!");
     return false;
   }
+  uint32_t start_page_number = uint32_t(found_page_number);
+  uint32_t end_page_number = start_page_number + page_count - 1;
+  assert_true(end_page_number < page_table_.size());
+
+  // Claim the range in the page table before doing anything slow, so the
+  // lock can be dropped across the host allocation and other threads can
+  // keep allocating instead of convoying behind the syscall.
+  for (uint32_t page_number = start_page_number; page_number <= end_page_number;
+       ++page_number) {
+    auto& page_entry = page_table_[page_number];
+    page_entry.base_address = start_page_number;
+    page_entry.region_page_count = page_count;
+    page_entry.allocation_protect = protect;
+    page_entry.current_protect = protect;
+    page_entry.state = kMemoryAllocationReserve | allocation_type;
+  }
+  free_page_map_.ClearRange(start_page_number, page_count);
+  global_lock.unlock();
 
   // Allocate from host.
   if (allocation_type == kMemoryAllocationReserve) {
@@ -1014,6 +1171,13 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address,
         page_count * page_size_, alloc_type, ToPageAccess(protect));
     if (!result) {
       XELOGE("BaseHeap::Alloc failed to alloc range from host");
+      // Return the claimed range.
+      global_lock.lock();
+      for (uint32_t page_number = start_page_number;
+           page_number <= end_page_number; ++page_number) {
+        page_table_[page_number].qword = 0;
+      }
+      free_page_map_.SetRange(start_page_number, page_count);
       return false;
     }
 
@@ -1022,17 +1186,6 @@ bool BaseHeap::AllocRange(uint32_t low_address, uint32_t high_address,
     }
   }
 
-  // Set page state.
-  for (uint32_t page_number = start_page_number; page_number <= end_page_number;
-       ++page_number) {
-    auto& page_entry = page_table_[page_number];
-    page_entry.base_address = start_page_number;
-    page_entry.region_page_count = page_count;
-    page_entry.allocation_protect = protect;
-    page_entry.current_protect = protect;
-    page_entry.state = kMemoryAllocationReserve | allocation_type;
-  }
-
   *out_address = heap_base_ + (start_page_number * page_size_);
   return true;
 }
@@ -1122,6 +1275,8 @@ bool BaseHeap::Release(uint32_t base_address, uint32_t* out_region_size) {
     auto& page_entry = page_table_[page_number];
     page_entry.qword = 0;
   }
+  free_page_map_.SetRange(base_page_number,
+                          base_page_entry.region_page_count);
 
   return true;
 }
@@ -1457,17 +1612,29 @@ bool PhysicalHeap::Decommit(uint32_t address, uint32_t size) {
     XELOGE("PhysicalHeap::Decommit failed due to parent heap failure");
     return false;
   }
-  return BaseHeap::Decommit(address, size);
+  if (!BaseHeap::Decommit(address, size)) {
+    return false;
+  }
+  memory_->TrimPhysicalRange(parent_address, size);
+  return true;
 }
 
 bool PhysicalHeap::Release(uint32_t base_address, uint32_t* out_region_size) {
   auto global_lock = global_critical_region_.Acquire();
   uint32_t parent_base_address = GetPhysicalAddress(base_address);
-  if (!parent_heap_->Release(parent_base_address, out_region_size)) {
+  uint32_t region_size = 0;
+  if (!parent_heap_->Release(parent_base_address, &region_size)) {
     XELOGE("PhysicalHeap::Release failed due to parent heap failure");
     return false;
   }
-  return BaseHeap::Release(base_address, out_region_size);
+  if (out_region_size) {
+    *out_region_size = region_size;
+  }
+  if (!BaseHeap::Release(base_address, out_region_size)) {
+    return false;
+  }
+  memory_->TrimPhysicalRange(parent_base_address, region_size);
+  return true;
 }
 
 bool PhysicalHeap::Protect(uint32_t address, uint32_t size, uint32_t protect,
@@ -1654,12 +1821,26 @@ bool PhysicalHeap::TriggerWatches(uint32_t virtual_address, uint32_t length,
         std::max(unwatch_last, physical_address_start + physical_length - 1);
     // Don't unprotect too much if not caring much about the region (limit to
     // 4 MB - somewhat random, but max 1024 iterations of the page loop).
-    const uint32_t kMaxUnwatchExcess = 4 * 1024 * 1024;
-    unwatch_first = std::max(unwatch_first,
-                             physical_address_start & ~(kMaxUnwatchExcess - 1));
+    // Regions that keep faulting get a progressively wider window - one
+    // violation then clears a larger neighborhood, so a streaming target
+    // that is rewritten every frame settles into a handful of faults
+    // instead of one per touched watch range.
+    uint32_t max_unwatch_excess = 4 * 1024 * 1024;
+    if (cvars::adaptive_memory_unwatch) {
+      uint32_t churn =
+          memory_->physical_write_churn_[physical_address_start >> 16].load(
+              std::memory_order_relaxed);
+      if (churn >= 256) {
+        max_unwatch_excess = 64 * 1024 * 1024;
+      } else if (churn >= 64) {
+        max_unwatch_excess = 16 * 1024 * 1024;
+      }
+    }
+    unwatch_first = std::max(
+        unwatch_first, physical_address_start & ~(max_unwatch_excess - 1));
     unwatch_last =
         std::min(unwatch_last, (physical_address_start + physical_length - 1) |
-                                   (kMaxUnwatchExcess - 1));
+                                   (max_unwatch_excess - 1));
     // Convert to heap-relative addresses.
     unwatch_first = xe::sat_sub(unwatch_first, physical_address_offset);
     unwatch_last = xe::sat_sub(unwatch_last, physical_address_offset);
@@ -10,12 +10,14 @@
 #ifndef XENIA_MEMORY_H_
 #define XENIA_MEMORY_H_
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "xenia/base/bit_map.h"
 #include "xenia/base/memory.h"
 #include "xenia/base/mutex.h"
 #include "xenia/cpu/mmio_handler.h"
@@ -194,6 +196,10 @@ class BaseHeap {
   uint32_t host_address_offset_;
   xe::global_critical_region global_critical_region_;
   std::vector<PageEntry> page_table_;
+  // Mirrors page_table_ occupancy (bit set = page free) so allocation scans
+  // run over 64-page words instead of walking the table page by page. Guarded
+  // by the global critical region like page_table_.
+  xe::RunBitMap free_page_map_;
 };
 
 // Normal heap allowing allocations from guest virtual address ranges.
@@ -430,9 +436,19 @@ class Memory {
   // Gets the physical base heap.
   VirtualHeap* GetPhysicalHeap();
 
+  // Returns the host pages backing the given physical range to the OS if
+  // --trim_released_guest_memory is set and the platform supports punching
+  // holes in the mapping. Called by the physical heaps when guest memory is
+  // decommitted or released; the range reads back as zeroes afterwards.
+  void TrimPhysicalRange(uint32_t physical_address, uint32_t length);
+
   // Dumps a map of all allocated memory to the log.
   void DumpMap();
 
+  // Logs one line of reserved/total bytes per guest heap; a compact
+  // alternative to DumpMap for watching heap growth on long sessions.
+  void DumpHeapUsage();
+
   bool Save(ByteStream* stream);
   bool Restore(ByteStream* stream);
 
@@ -447,6 +463,18 @@ class Memory {
   static bool AccessViolationCallbackThunk(void* context, void* host_address,
                                            bool is_write);
 
+  // Guest physical write heat map (--guest_memory_heat_map): write access
+  // violations counted per 64 KB physical region, on the faulting threads.
+  // Null when the instrumentation is disabled. Dumped along with DumpMap.
+  std::unique_ptr<std::atomic<uint32_t>[]> physical_write_heat_map_;
+
+  // Recent write access violations per 64 KB physical region, always on and
+  // decayed about once a second; PhysicalHeap::TriggerWatches widens the
+  // range it unprotects around regions that keep faulting so streaming
+  // writes take fewer access violations (--adaptive_memory_unwatch).
+  std::atomic<uint32_t> physical_write_churn_[512 * 1024 * 1024 >> 16] = {};
+  std::atomic<uint64_t> physical_write_churn_decay_ticks_ = {0};
+
   std::wstring file_name_;
   uint32_t system_page_size_ = 0;
   uint32_t system_allocation_granularity_ = 0;
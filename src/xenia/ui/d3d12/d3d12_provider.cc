@@ -59,6 +59,9 @@ D3D12Provider::~D3D12Provider() {
   if (graphics_analysis_ != nullptr) {
     graphics_analysis_->Release();
   }
+  if (copy_queue_ != nullptr) {
+    copy_queue_->Release();
+  }
   if (direct_queue_ != nullptr) {
     direct_queue_->Release();
   }
@@ -214,9 +217,20 @@ bool D3D12Provider::Initialize() {
     dxgi_factory->Release();
   }
 
+  // Create the command queue for copies (guest memory uploads). Optional -
+  // users fall back to the direct queue when this is null.
+  queue_desc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+  ID3D12CommandQueue* copy_queue = nullptr;
+  if (FAILED(device->CreateCommandQueue(&queue_desc,
+                                        IID_PPV_ARGS(&copy_queue)))) {
+    XELOGW("Failed to create a copy command queue");
+    copy_queue = nullptr;
+  }
+
   dxgi_factory_ = dxgi_factory;
   device_ = device;
   direct_queue_ = direct_queue;
+  copy_queue_ = copy_queue;
 
   // Get descriptor sizes for each type.
   descriptor_size_view_ = device->GetDescriptorHandleIncrementSize(
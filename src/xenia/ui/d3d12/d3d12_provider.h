@@ -38,6 +38,8 @@ class D3D12Provider : public GraphicsProvider {
   }
   ID3D12Device* GetDevice() const { return device_; }
   ID3D12CommandQueue* GetDirectQueue() const { return direct_queue_; }
+  // May be null if copy queue creation failed; fall back to the direct queue.
+  ID3D12CommandQueue* GetCopyQueue() const { return copy_queue_; }
 
   uint32_t GetViewDescriptorSize() const { return descriptor_size_view_; }
   uint32_t GetSamplerDescriptorSize() const { return descriptor_size_sampler_; }
@@ -119,6 +121,7 @@ class D3D12Provider : public GraphicsProvider {
   IDXGraphicsAnalysis* graphics_analysis_ = nullptr;
   ID3D12Device* device_ = nullptr;
   ID3D12CommandQueue* direct_queue_ = nullptr;
+  ID3D12CommandQueue* copy_queue_ = nullptr;
 
   uint32_t descriptor_size_view_;
   uint32_t descriptor_size_sampler_;
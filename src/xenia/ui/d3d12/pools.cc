@@ -12,9 +12,17 @@
 #include <algorithm>
 
 #include "xenia/base/assert.h"
+#include "xenia/base/cvar.h"
 #include "xenia/base/logging.h"
+#include "xenia/base/math.h"
 #include "xenia/ui/d3d12/d3d12_util.h"
 
+DEFINE_int32(d3d12_staging_memory_budget_mb, 48,
+             "Soft limit, in megabytes, for the shared upload staging memory. "
+             "Pages above the budget are released rather than recycled once "
+             "the GPU is done with them. 0 means no limit.",
+             "D3D12");
+
 namespace xe {
 namespace ui {
 namespace d3d12 {
@@ -163,6 +171,212 @@ uint8_t* UploadBufferPool::RequestPartial(
   return mapping;
 }
 
+constexpr uint32_t StagingMemoryManager::kSizeClassCount;
+
+const uint32_t StagingMemoryManager::kSizeClassPageSizes
+    [StagingMemoryManager::kSizeClassCount] = {
+        64 * 1024,
+        1024 * 1024,
+        4 * 1024 * 1024,
+};
+
+StagingMemoryManager::StagingMemoryManager(ID3D12Device* device)
+    : device_(device) {}
+
+StagingMemoryManager::~StagingMemoryManager() { ClearCache(); }
+
+uint32_t StagingMemoryManager::GetSizeClass(uint32_t size) {
+  for (uint32_t i = 0; i < kSizeClassCount; ++i) {
+    if (size <= kSizeClassPageSizes[i]) {
+      return i;
+    }
+  }
+  return kSizeClassCount;
+}
+
+void StagingMemoryManager::ReleasePage(Page* page, uint32_t size_class) {
+  // Releasing anyway, so assuming data not needed anymore.
+  D3D12_RANGE written_range;
+  written_range.Begin = 0;
+  written_range.End = 0;
+  page->buffer->Unmap(0, &written_range);
+  page->buffer->Release();
+  delete page;
+  total_page_bytes_ -= kSizeClassPageSizes[size_class];
+}
+
+void StagingMemoryManager::Reclaim(uint64_t completed_submission_index) {
+  uint64_t budget_bytes =
+      uint64_t(std::max(cvars::d3d12_staging_memory_budget_mb, 0)) << 20;
+  for (uint32_t i = 0; i < kSizeClassCount; ++i) {
+    SizeClass& size_class = size_classes_[i];
+    while (size_class.submitted_first) {
+      if (size_class.submitted_first->last_submission_index >
+          completed_submission_index) {
+        break;
+      }
+      Page* page = size_class.submitted_first;
+      size_class.submitted_first = page->next;
+      if (budget_bytes && total_page_bytes_ > budget_bytes) {
+        // Over the budget - don't keep the page for recycling.
+        ReleasePage(page, i);
+        continue;
+      }
+      page->next = nullptr;
+      if (size_class.writable_last) {
+        size_class.writable_last->next = page;
+      } else {
+        size_class.writable_first = page;
+      }
+      size_class.writable_last = page;
+    }
+    if (!size_class.submitted_first) {
+      size_class.submitted_last = nullptr;
+    }
+  }
+}
+
+void StagingMemoryManager::ClearCache() {
+  for (uint32_t i = 0; i < kSizeClassCount; ++i) {
+    SizeClass& size_class = size_classes_[i];
+    size_class.current_page_used = 0;
+    while (size_class.submitted_first) {
+      Page* next = size_class.submitted_first->next;
+      ReleasePage(size_class.submitted_first, i);
+      size_class.submitted_first = next;
+    }
+    size_class.submitted_last = nullptr;
+    while (size_class.writable_first) {
+      Page* next = size_class.writable_first->next;
+      ReleasePage(size_class.writable_first, i);
+      size_class.writable_first = next;
+    }
+    size_class.writable_last = nullptr;
+  }
+  assert_zero(total_page_bytes_);
+}
+
+uint8_t* StagingMemoryManager::RequestFromClass(
+    uint32_t size_class_index, uint64_t submission_index, uint32_t size,
+    uint32_t alignment, ID3D12Resource** buffer_out, uint32_t* offset_out,
+    D3D12_GPU_VIRTUAL_ADDRESS* gpu_address_out) {
+  SizeClass& size_class = size_classes_[size_class_index];
+  uint32_t page_size = kSizeClassPageSizes[size_class_index];
+  assert_true(!size_class.current_page_used ||
+              submission_index >=
+                  size_class.writable_first->last_submission_index);
+  assert_true(!size_class.submitted_last ||
+              submission_index >=
+                  size_class.submitted_last->last_submission_index);
+  uint32_t offset = xe::align(size_class.current_page_used, alignment);
+  if (page_size - offset < size || !size_class.writable_first) {
+    // Start a new page if can't fit all the bytes or don't have an open page.
+    if (size_class.writable_first) {
+      // Close the page that was current.
+      if (size_class.submitted_last) {
+        size_class.submitted_last->next = size_class.writable_first;
+      } else {
+        size_class.submitted_first = size_class.writable_first;
+      }
+      size_class.submitted_last = size_class.writable_first;
+      size_class.writable_first = size_class.writable_first->next;
+      size_class.submitted_last->next = nullptr;
+      if (!size_class.writable_first) {
+        size_class.writable_last = nullptr;
+      }
+    }
+    if (!size_class.writable_first) {
+      // Create a new page if none available.
+      D3D12_RESOURCE_DESC new_buffer_desc;
+      util::FillBufferResourceDesc(new_buffer_desc, page_size,
+                                   D3D12_RESOURCE_FLAG_NONE);
+      ID3D12Resource* new_buffer;
+      if (FAILED(device_->CreateCommittedResource(
+              &util::kHeapPropertiesUpload, D3D12_HEAP_FLAG_NONE,
+              &new_buffer_desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
+              IID_PPV_ARGS(&new_buffer)))) {
+        XELOGE("Failed to create a D3D staging buffer with %u bytes",
+               page_size);
+        return nullptr;
+      }
+      D3D12_RANGE read_range;
+      read_range.Begin = 0;
+      read_range.End = 0;
+      void* new_buffer_mapping;
+      if (FAILED(new_buffer->Map(0, &read_range, &new_buffer_mapping))) {
+        XELOGE("Failed to map a D3D staging buffer with %u bytes", page_size);
+        new_buffer->Release();
+        return nullptr;
+      }
+      Page* new_page = new Page;
+      new_page->buffer = new_buffer;
+      new_page->gpu_address = new_buffer->GetGPUVirtualAddress();
+      new_page->mapping = new_buffer_mapping;
+      new_page->last_submission_index = submission_index;
+      new_page->next = nullptr;
+      size_class.writable_first = new_page;
+      size_class.writable_last = new_page;
+      total_page_bytes_ += page_size;
+    }
+    size_class.current_page_used = 0;
+    offset = 0;
+  }
+  size_class.writable_first->last_submission_index = submission_index;
+  if (buffer_out) {
+    *buffer_out = size_class.writable_first->buffer;
+  }
+  if (offset_out) {
+    *offset_out = offset;
+  }
+  if (gpu_address_out) {
+    *gpu_address_out = size_class.writable_first->gpu_address + offset;
+  }
+  uint8_t* mapping =
+      reinterpret_cast<uint8_t*>(size_class.writable_first->mapping) + offset;
+  size_class.current_page_used = offset + size;
+  return mapping;
+}
+
+uint8_t* StagingMemoryManager::Request(
+    uint64_t submission_index, uint32_t size, uint32_t alignment,
+    ID3D12Resource** buffer_out, uint32_t* offset_out,
+    D3D12_GPU_VIRTUAL_ADDRESS* gpu_address_out) {
+  assert_zero(alignment & (alignment - 1));
+  uint32_t size_class_index = GetSizeClass(size);
+  assert_true(size_class_index < kSizeClassCount);
+  if (size_class_index >= kSizeClassCount) {
+    return nullptr;
+  }
+  return RequestFromClass(size_class_index, submission_index, size, alignment,
+                          buffer_out, offset_out, gpu_address_out);
+}
+
+uint8_t* StagingMemoryManager::RequestPartial(
+    uint64_t submission_index, uint32_t size, uint32_t alignment,
+    ID3D12Resource** buffer_out, uint32_t* offset_out, uint32_t* size_out,
+    D3D12_GPU_VIRTUAL_ADDRESS* gpu_address_out) {
+  assert_zero(alignment & (alignment - 1));
+  // Bulk data - always stream through the largest size class.
+  uint32_t size_class_index = kSizeClassCount - 1;
+  uint32_t page_size = kSizeClassPageSizes[size_class_index];
+  size = std::min(size, page_size);
+  uint32_t offset =
+      xe::align(size_classes_[size_class_index].current_page_used, alignment);
+  if (offset < page_size) {
+    size = std::min(size, page_size - offset);
+  }
+  uint8_t* mapping =
+      RequestFromClass(size_class_index, submission_index, size, alignment,
+                       buffer_out, offset_out, gpu_address_out);
+  if (!mapping) {
+    return nullptr;
+  }
+  if (size_out) {
+    *size_out = size;
+  }
+  return mapping;
+}
+
 constexpr uint64_t DescriptorHeapPool::kHeapIndexInvalid;
 
 DescriptorHeapPool::DescriptorHeapPool(ID3D12Device* device,
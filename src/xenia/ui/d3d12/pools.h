@@ -63,6 +63,78 @@ class UploadBufferPool {
   uint32_t current_page_used_ = 0;
 };
 
+// Shared staging memory for everything uploaded through the frame - constant
+// buffers, converted primitive data, shared memory ranges. Suballocates
+// linearly from size-classed pages so small constant requests don't dirty
+// multi-megabyte pages, and recycles all pages through one budget so a spike
+// from one producer reuses memory another has already released instead of
+// growing a private pool that stays hot forever.
+//
+// Pages are tracked in frame index space - pass the current frame to Request
+// and the last completed frame to Reclaim, consistently.
+class StagingMemoryManager {
+ public:
+  explicit StagingMemoryManager(ID3D12Device* device);
+  ~StagingMemoryManager();
+
+  void Reclaim(uint64_t completed_submission_index);
+  void ClearCache();
+
+  // Request to write data in a single piece, creating a new page if the
+  // current one of the size class doesn't have enough free space. The
+  // alignment must be a power of two that the smallest page size is a
+  // multiple of.
+  uint8_t* Request(uint64_t submission_index, uint32_t size,
+                   uint32_t alignment, ID3D12Resource** buffer_out,
+                   uint32_t* offset_out,
+                   D3D12_GPU_VIRTUAL_ADDRESS* gpu_address_out);
+  // Request to write bulk data in multiple parts, filling the largest size
+  // class's current page entirely.
+  uint8_t* RequestPartial(uint64_t submission_index, uint32_t size,
+                          uint32_t alignment, ID3D12Resource** buffer_out,
+                          uint32_t* offset_out, uint32_t* size_out,
+                          D3D12_GPU_VIRTUAL_ADDRESS* gpu_address_out);
+
+  // Total size of the pages currently alive, writable or submitted.
+  uint64_t total_page_bytes() const { return total_page_bytes_; }
+
+ private:
+  static constexpr uint32_t kSizeClassCount = 3;
+  static const uint32_t kSizeClassPageSizes[kSizeClassCount];
+
+  struct Page {
+    ID3D12Resource* buffer;
+    D3D12_GPU_VIRTUAL_ADDRESS gpu_address;
+    void* mapping;
+    uint64_t last_submission_index;
+    Page* next;
+  };
+
+  struct SizeClass {
+    // A list of pages with free space, with the first page being the one
+    // currently being filled.
+    Page* writable_first = nullptr;
+    Page* writable_last = nullptr;
+    // A list of full pages that can be reclaimed when the GPU doesn't use
+    // them anymore.
+    Page* submitted_first = nullptr;
+    Page* submitted_last = nullptr;
+    uint32_t current_page_used = 0;
+  };
+
+  // Smallest size class whose pages can hold a request of the size.
+  static uint32_t GetSizeClass(uint32_t size);
+  uint8_t* RequestFromClass(uint32_t size_class, uint64_t submission_index,
+                            uint32_t size, uint32_t alignment,
+                            ID3D12Resource** buffer_out, uint32_t* offset_out,
+                            D3D12_GPU_VIRTUAL_ADDRESS* gpu_address_out);
+  void ReleasePage(Page* page, uint32_t size_class);
+
+  ID3D12Device* device_;
+  SizeClass size_classes_[kSizeClassCount];
+  uint64_t total_page_bytes_ = 0;
+};
+
 class DescriptorHeapPool {
  public:
   static constexpr uint64_t kHeapIndexInvalid = UINT64_MAX;
@@ -9,7 +9,24 @@
 
 #include "xenia/ui/loop_win.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "xenia/base/assert.h"
+#include "xenia/base/clock.h"
+#include "xenia/base/cvar.h"
+#include "xenia/base/logging.h"
+
+DEFINE_bool(ui_loop_profile, false,
+            "Log UI loop task-to-execution latency statistics every few "
+            "seconds.",
+            "UI");
+
+// Only defined in Windows 10 1803+ SDKs; harmlessly ignored by older
+// kernels, which fall back to standard timer resolution.
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 namespace xe {
 namespace ui {
@@ -17,7 +34,13 @@ namespace ui {
 std::unique_ptr<Loop> Loop::Create() { return std::make_unique<Win32Loop>(); }
 
 Win32Loop::Win32Loop() : thread_id_(0) {
-  timer_queue_ = CreateTimerQueue();
+  // High-resolution waitable timers fire with ~0.5ms precision instead of
+  // the ~16ms timer queue granularity that used to jitter delayed tasks.
+  timer_handle_ = CreateWaitableTimerExW(
+      NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+  if (!timer_handle_) {
+    timer_handle_ = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+  }
 
   xe::threading::Fence init_fence;
   thread_ = std::thread([&init_fence, this]() {
@@ -41,33 +64,117 @@ Win32Loop::~Win32Loop() {
   Quit();
   thread_.join();
 
-  DeleteTimerQueueEx(timer_queue_, INVALID_HANDLE_VALUE);
-  std::lock_guard<std::mutex> lock(pending_timers_mutex_);
-  while (!pending_timers_.empty()) {
-    auto timer = pending_timers_.back();
-    pending_timers_.pop_back();
-    delete timer;
-  }
+  CloseHandle(timer_handle_);
 }
 
 void Win32Loop::ThreadMain() {
-  MSG msg;
-  while (!should_exit_ && GetMessage(&msg, NULL, 0, 0)) {
-    TranslateMessage(&msg);
-    DispatchMessage(&msg);
+  while (!should_exit_) {
+    DWORD wait_result = MsgWaitForMultipleObjectsEx(
+        1, &timer_handle_, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+    if (wait_result == WAIT_FAILED) {
+      break;
+    }
 
-    // Process queued functions.
-    std::lock_guard<std::recursive_mutex> lock(posted_functions_mutex_);
-    for (auto it = posted_functions_.begin(); it != posted_functions_.end();) {
-      (*it).Call();
-      it = posted_functions_.erase(it);
+    // Pump all pending window messages before running tasks so input stays
+    // ahead of posted work.
+    MSG msg;
+    while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
+      if (msg.message == WM_QUIT) {
+        should_exit_ = true;
+      }
+      TranslateMessage(&msg);
+      DispatchMessage(&msg);
     }
+
+    RunDueDelayedFunctions(Clock::QueryHostTickCount());
+    RunPostedFunctions();
+    ArmTimerForNextDeadline();
   }
 
   UIEvent e(nullptr);
   on_quit(&e);
 }
 
+void Win32Loop::RunDueDelayedFunctions(uint64_t now_ticks) {
+  std::vector<DelayedFn> due_functions;
+  {
+    std::lock_guard<std::mutex> lock(delayed_functions_mutex_);
+    while (!delayed_functions_.empty() &&
+           delayed_functions_.top().due_ticks <= now_ticks) {
+      due_functions.push_back(
+          std::move(const_cast<DelayedFn&>(delayed_functions_.top())));
+      delayed_functions_.pop();
+    }
+  }
+  for (auto& delayed_fn : due_functions) {
+    // For delayed tasks the interesting latency is the overshoot past the
+    // requested deadline, not the full requested delay.
+    TrackTaskLatency(now_ticks - delayed_fn.due_ticks);
+    delayed_fn.fn();
+  }
+}
+
+void Win32Loop::RunPostedFunctions() {
+  std::lock_guard<std::recursive_mutex> lock(posted_functions_mutex_);
+  uint64_t now_ticks = Clock::QueryHostTickCount();
+  for (auto it = posted_functions_.begin(); it != posted_functions_.end();) {
+    TrackTaskLatency(now_ticks - (*it).post_ticks());
+    (*it).Call();
+    it = posted_functions_.erase(it);
+  }
+}
+
+void Win32Loop::ArmTimerForNextDeadline() {
+  uint64_t due_ticks;
+  {
+    std::lock_guard<std::mutex> lock(delayed_functions_mutex_);
+    if (delayed_functions_.empty()) {
+      CancelWaitableTimer(timer_handle_);
+      return;
+    }
+    due_ticks = delayed_functions_.top().due_ticks;
+  }
+  uint64_t now_ticks = Clock::QueryHostTickCount();
+  // Relative time in 100ns units; negative values are relative deadlines
+  // and must be at least -1 to fire.
+  int64_t relative_100ns = 0;
+  if (due_ticks > now_ticks) {
+    relative_100ns = int64_t((due_ticks - now_ticks) * 10000000ull /
+                             Clock::QueryHostTickFrequency());
+  }
+  LARGE_INTEGER due_time;
+  due_time.QuadPart = -std::max(relative_100ns, int64_t(1));
+  SetWaitableTimer(timer_handle_, &due_time, 0, NULL, NULL, FALSE);
+}
+
+void Win32Loop::TrackTaskLatency(uint64_t latency_ticks) {
+  if (!cvars::ui_loop_profile) {
+    return;
+  }
+  latency_sum_ticks_ += latency_ticks;
+  latency_max_ticks_ = std::max(latency_max_ticks_, latency_ticks);
+  ++latency_sample_count_;
+  uint64_t now_ticks = Clock::QueryHostTickCount();
+  uint64_t tick_frequency = Clock::QueryHostTickFrequency();
+  if (!next_latency_log_ticks_) {
+    next_latency_log_ticks_ = now_ticks + tick_frequency * 5;
+    return;
+  }
+  if (now_ticks < next_latency_log_ticks_) {
+    return;
+  }
+  double ms_per_tick = 1000.0 / double(tick_frequency);
+  XELOGI("Win32Loop: %llu tasks, avg %.3fms max %.3fms post-to-run latency",
+         latency_sample_count_,
+         double(latency_sum_ticks_) * ms_per_tick /
+             double(latency_sample_count_),
+         double(latency_max_ticks_) * ms_per_tick);
+  latency_sum_ticks_ = 0;
+  latency_max_ticks_ = 0;
+  latency_sample_count_ = 0;
+  next_latency_log_ticks_ = now_ticks + tick_frequency * 5;
+}
+
 bool Win32Loop::is_on_loop_thread() {
   return thread_id_ == GetCurrentThreadId();
 }
@@ -76,8 +183,8 @@ void Win32Loop::Post(std::function<void()> fn) {
   assert_true(thread_id_ != 0);
   {
     std::lock_guard<std::recursive_mutex> lock(posted_functions_mutex_);
-    PostedFn posted_fn(fn);
-    posted_functions_.push_back(posted_fn);
+    posted_functions_.emplace_back(std::move(fn),
+                                   Clock::QueryHostTickCount());
   }
 
   while (!PostThreadMessage(thread_id_, WM_NULL, 0, 0)) {
@@ -85,36 +192,23 @@ void Win32Loop::Post(std::function<void()> fn) {
   }
 }
 
-void Win32Loop::TimerQueueCallback(void* context, uint8_t) {
-  auto timer = reinterpret_cast<PendingTimer*>(context);
-  auto loop = timer->loop;
-  auto fn = std::move(timer->fn);
-  DeleteTimerQueueTimer(timer->timer_queue, timer->timer_handle, NULL);
-  {
-    std::lock_guard<std::mutex> lock(loop->pending_timers_mutex_);
-    loop->pending_timers_.remove(timer);
-  }
-  delete timer;
-  loop->Post(std::move(fn));
-}
-
 void Win32Loop::PostDelayed(std::function<void()> fn, uint64_t delay_millis) {
   if (!delay_millis) {
     Post(std::move(fn));
     return;
   }
-  auto timer = new PendingTimer();
-  timer->loop = this;
-  timer->timer_queue = timer_queue_;
-  timer->fn = std::move(fn);
+  uint64_t now_ticks = Clock::QueryHostTickCount();
+  uint64_t due_ticks =
+      now_ticks + delay_millis * Clock::QueryHostTickFrequency() / 1000;
   {
-    std::lock_guard<std::mutex> lock(pending_timers_mutex_);
-    pending_timers_.push_back(timer);
+    std::lock_guard<std::mutex> lock(delayed_functions_mutex_);
+    delayed_functions_.push(
+        DelayedFn{due_ticks, next_delayed_sequence_++, std::move(fn)});
+  }
+  // Wake the loop thread so it rearms the timer for the new deadline.
+  while (!PostThreadMessage(thread_id_, WM_NULL, 0, 0)) {
+    Sleep(1);
   }
-  CreateTimerQueueTimer(&timer->timer_handle, timer_queue_,
-                        WAITORTIMERCALLBACK(TimerQueueCallback), timer,
-                        DWORD(delay_millis), 0,
-                        WT_EXECUTEINTIMERTHREAD | WT_EXECUTEONLYONCE);
 }
 
 void Win32Loop::Quit() {
@@ -12,7 +12,9 @@
 
 #include <list>
 #include <mutex>
+#include <queue>
 #include <thread>
+#include <vector>
 
 #include "xenia/base/platform_win.h"
 #include "xenia/base/threading.h"
@@ -35,37 +37,60 @@ class Win32Loop : public Loop {
   void AwaitQuit() override;
 
  private:
-  struct PendingTimer {
-    Win32Loop* loop;
-    HANDLE timer_queue;
-    HANDLE timer_handle;
-    std::function<void()> fn;
-  };
-
   class PostedFn {
    public:
-    explicit PostedFn(std::function<void()> fn) : fn_(std::move(fn)) {}
+    explicit PostedFn(std::function<void()> fn, uint64_t post_ticks)
+        : fn_(std::move(fn)), post_ticks_(post_ticks) {}
     void Call() { fn_(); }
+    uint64_t post_ticks() const { return post_ticks_; }
 
    private:
     std::function<void()> fn_;
+    uint64_t post_ticks_;
   };
 
-  void ThreadMain();
+  // Delayed task ordered by deadline; sequence keeps tasks with identical
+  // deadlines FIFO.
+  struct DelayedFn {
+    uint64_t due_ticks;
+    uint64_t sequence;
+    std::function<void()> fn;
+  };
+  struct DelayedFnCompare {
+    bool operator()(const DelayedFn& a, const DelayedFn& b) const {
+      return a.due_ticks != b.due_ticks ? a.due_ticks > b.due_ticks
+                                        : a.sequence > b.sequence;
+    }
+  };
 
-  static void TimerQueueCallback(void* context, uint8_t);
+  void ThreadMain();
+  void RunDueDelayedFunctions(uint64_t now_ticks);
+  void RunPostedFunctions();
+  // Programs the waitable timer for the earliest pending deadline, or
+  // cancels it when nothing is queued. Loop thread only.
+  void ArmTimerForNextDeadline();
+  void TrackTaskLatency(uint64_t latency_ticks);
 
   std::thread thread_;
   DWORD thread_id_;
   bool should_exit_ = false;
   xe::threading::Fence quit_fence_;
 
-  HANDLE timer_queue_;
-  std::mutex pending_timers_mutex_;
-  std::list<PendingTimer*> pending_timers_;
+  // High-resolution waitable timer driving delayed task dispatch.
+  HANDLE timer_handle_;
+  std::mutex delayed_functions_mutex_;
+  std::priority_queue<DelayedFn, std::vector<DelayedFn>, DelayedFnCompare>
+      delayed_functions_;
+  uint64_t next_delayed_sequence_ = 0;
 
   std::recursive_mutex posted_functions_mutex_;
   std::list<PostedFn> posted_functions_;
+
+  // Task-to-execution latency instrumentation; loop thread only.
+  uint64_t latency_sum_ticks_ = 0;
+  uint64_t latency_max_ticks_ = 0;
+  uint64_t latency_sample_count_ = 0;
+  uint64_t next_latency_log_ticks_ = 0;
 };
 
 }  // namespace ui
@@ -10,6 +10,7 @@ project("xenia-ui-vulkan")
     "xenia-base",
     "xenia-ui",
     "xenia-ui-spirv",
+    "xxhash",
   })
   defines({
   })
@@ -9,6 +9,9 @@
 
 #include "xenia/ui/vulkan/vulkan_immediate_drawer.h"
 
+#include <unordered_map>
+
+#include "third_party/xxhash/xxhash.h"
 #include "xenia/base/assert.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
@@ -105,6 +108,7 @@ class LightweightCircularBuffer {
     if (current_offset_ + source_length > buffer_capacity_) {
       // Wraps around.
       current_offset_ = 0;
+      ++epoch_;
     }
     VkDeviceSize offset = current_offset_;
     current_offset_ += source_length;
@@ -128,7 +132,51 @@ class LightweightCircularBuffer {
     return offset;
   }
 
+  // Allocates space for data and copies it into the buffer, reusing the
+  // previous upload when identical bytes are still resident. Immediate draw
+  // batches are commonly static frame over frame (debug overlay text that
+  // didn't change), so skipping the copy and cache flush keeps the
+  // presentation path cheap.
+  VkDeviceSize EmplaceCached(const void* source_data, size_t source_length) {
+    uint64_t hash = XXH64(source_data, source_length, 0);
+    auto it = retained_batches_.find(hash);
+    if (it != retained_batches_.end()) {
+      const RetainedBatch& batch = it->second;
+      if (batch.length == source_length && IsResident(batch)) {
+        return batch.offset;
+      }
+      retained_batches_.erase(it);
+    }
+    VkDeviceSize offset = Emplace(source_data, source_length);
+    if (offset != VK_WHOLE_SIZE) {
+      if (retained_batches_.size() >= kMaxRetainedBatches) {
+        // Dynamic content churns hashes; don't let the map grow forever.
+        retained_batches_.clear();
+      }
+      retained_batches_[hash] = {epoch_, offset, source_length};
+    }
+    return offset;
+  }
+
  private:
+  struct RetainedBatch {
+    uint64_t epoch;
+    VkDeviceSize offset;
+    size_t length;
+  };
+
+  // True if nothing has wrapped over the batch's region yet: either no wrap
+  // happened since the upload, or exactly one wrap that hasn't reached the
+  // batch's offset.
+  bool IsResident(const RetainedBatch& batch) const {
+    if (batch.epoch == epoch_) {
+      return true;
+    }
+    return batch.epoch + 1 == epoch_ && current_offset_ <= batch.offset;
+  }
+
+  static const size_t kMaxRetainedBatches = 64;
+
   VkDevice device_ = nullptr;
 
   VkBuffer index_buffer_ = nullptr;
@@ -137,6 +185,9 @@ class LightweightCircularBuffer {
   void* buffer_data_ = nullptr;
   size_t buffer_capacity_ = 0;
   size_t current_offset_ = 0;
+  // Bumped every time the write cursor wraps to the start of the buffer.
+  uint64_t epoch_ = 0;
+  std::unordered_map<uint64_t, RetainedBatch> retained_batches_;
 };
 
 class VulkanImmediateTexture : public ImmediateTexture {
@@ -790,8 +841,8 @@ void VulkanImmediateDrawer::Begin(int render_target_width,
 void VulkanImmediateDrawer::BeginDrawBatch(const ImmediateDrawBatch& batch) {
   auto device = context_->device();
 
-  // Upload vertices.
-  VkDeviceSize vertices_offset = circular_buffer_->Emplace(
+  // Upload vertices, reusing a still-resident identical upload if any.
+  VkDeviceSize vertices_offset = circular_buffer_->EmplaceCached(
       batch.vertices, batch.vertex_count * sizeof(ImmediateVertex));
   if (vertices_offset == VK_WHOLE_SIZE) {
     // TODO(benvanik): die?
@@ -803,7 +854,7 @@ void VulkanImmediateDrawer::BeginDrawBatch(const ImmediateDrawBatch& batch) {
 
   // Upload indices.
   if (batch.indices) {
-    VkDeviceSize indices_offset = circular_buffer_->Emplace(
+    VkDeviceSize indices_offset = circular_buffer_->EmplaceCached(
         batch.indices, batch.index_count * sizeof(uint16_t));
     if (indices_offset == VK_WHOLE_SIZE) {
       // TODO(benvanik): die?
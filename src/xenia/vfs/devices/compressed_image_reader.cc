@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2013 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/devices/compressed_image_reader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "third_party/snappy/snappy.h"
+#include "xenia/base/logging.h"
+#include "xenia/base/thread_pool.h"
+
+namespace xe {
+namespace vfs {
+
+namespace {
+const char kMagic[4] = {'X', 'C', 'I', 'S'};
+const uint32_t kVersion = 1;
+const size_t kHeaderSize = 24;
+// Boundary blocks kept decompressed; sequential readers touch at most two
+// per call, so this is plenty while staying a few MB at typical block sizes.
+const size_t kCacheBlockCount = 64;
+}  // namespace
+
+bool CompressedImageReader::IsCompressedImage(const std::wstring& path) {
+  auto file_handle = xe::filesystem::FileHandle::OpenExisting(
+      path, xe::filesystem::FileAccess::kGenericRead);
+  if (!file_handle) {
+    return false;
+  }
+  char magic[4];
+  size_t bytes_read = 0;
+  if (!file_handle->Read(0, magic, sizeof(magic), &bytes_read) ||
+      bytes_read != sizeof(magic)) {
+    return false;
+  }
+  return std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+std::unique_ptr<CompressedImageReader> CompressedImageReader::Open(
+    const std::wstring& path) {
+  auto file_handle = xe::filesystem::FileHandle::OpenExisting(
+      path, xe::filesystem::FileAccess::kGenericRead);
+  if (!file_handle) {
+    return nullptr;
+  }
+
+  uint8_t header[kHeaderSize];
+  size_t bytes_read = 0;
+  if (!file_handle->Read(0, header, kHeaderSize, &bytes_read) ||
+      bytes_read != kHeaderSize) {
+    XELOGE("Compressed image header truncated");
+    return nullptr;
+  }
+  if (std::memcmp(header, kMagic, sizeof(kMagic)) != 0) {
+    return nullptr;
+  }
+  uint32_t version;
+  std::memcpy(&version, header + 4, sizeof(version));
+  if (version != kVersion) {
+    XELOGE("Compressed image version %u not supported", version);
+    return nullptr;
+  }
+
+  auto reader =
+      std::unique_ptr<CompressedImageReader>(new CompressedImageReader());
+  std::memcpy(&reader->block_size_, header + 8, sizeof(reader->block_size_));
+  std::memcpy(&reader->uncompressed_size_, header + 16,
+              sizeof(reader->uncompressed_size_));
+  if (!reader->block_size_ ||
+      (reader->block_size_ & (reader->block_size_ - 1)) != 0 ||
+      !reader->uncompressed_size_) {
+    XELOGE("Compressed image header damaged");
+    return nullptr;
+  }
+
+  size_t offset_count = reader->block_count() + 1;
+  reader->block_offsets_.resize(offset_count);
+  size_t table_size = offset_count * sizeof(uint64_t);
+  if (!file_handle->Read(kHeaderSize, reader->block_offsets_.data(),
+                         table_size, &bytes_read) ||
+      bytes_read != table_size) {
+    XELOGE("Compressed image block table truncated");
+    return nullptr;
+  }
+  for (size_t i = 1; i < offset_count; i++) {
+    if (reader->block_offsets_[i] < reader->block_offsets_[i - 1]) {
+      XELOGE("Compressed image block table damaged");
+      return nullptr;
+    }
+  }
+
+  reader->file_handle_ = std::move(file_handle);
+  return reader;
+}
+
+size_t CompressedImageReader::BlockUncompressedSize(
+    uint32_t block_index) const {
+  uint64_t block_start = uint64_t(block_index) * block_size_;
+  return size_t(
+      std::min<uint64_t>(block_size_, uncompressed_size_ - block_start));
+}
+
+bool CompressedImageReader::DecompressBlockInto(uint32_t block_index,
+                                                uint8_t* dst) {
+  size_t stored_size = size_t(block_offsets_[block_index + 1] -
+                              block_offsets_[block_index]);
+  size_t block_size = BlockUncompressedSize(block_index);
+
+  if (stored_size == block_size) {
+    // Raw block: read straight into the destination.
+    std::lock_guard<std::mutex> lock(io_mutex_);
+    size_t bytes_read = 0;
+    return file_handle_->Read(size_t(block_offsets_[block_index]), dst,
+                              stored_size, &bytes_read) &&
+           bytes_read == stored_size;
+  }
+
+  std::vector<uint8_t> compressed(stored_size);
+  {
+    std::lock_guard<std::mutex> lock(io_mutex_);
+    size_t bytes_read = 0;
+    if (!file_handle_->Read(size_t(block_offsets_[block_index]),
+                            compressed.data(), stored_size, &bytes_read) ||
+        bytes_read != stored_size) {
+      return false;
+    }
+  }
+
+  size_t uncompressed_length = 0;
+  if (!snappy::GetUncompressedLength(
+          reinterpret_cast<const char*>(compressed.data()), stored_size,
+          &uncompressed_length) ||
+      uncompressed_length != block_size) {
+    XELOGE("Compressed image block %u damaged", block_index);
+    return false;
+  }
+  return snappy::RawUncompress(
+      reinterpret_cast<const char*>(compressed.data()), stored_size,
+      reinterpret_cast<char*>(dst));
+}
+
+bool CompressedImageReader::ReadPartialBlock(uint32_t block_index, size_t skip,
+                                             uint8_t* dst, size_t length) {
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    auto it = block_cache_.find(block_index);
+    if (it != block_cache_.end()) {
+      std::memcpy(dst, it->second.data() + skip, length);
+      return true;
+    }
+  }
+
+  std::vector<uint8_t> block_data(BlockUncompressedSize(block_index));
+  if (!DecompressBlockInto(block_index, block_data.data())) {
+    return false;
+  }
+  std::memcpy(dst, block_data.data() + skip, length);
+
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  if (block_cache_.find(block_index) == block_cache_.end()) {
+    block_cache_.emplace(block_index, std::move(block_data));
+    block_cache_order_.push_back(block_index);
+    while (block_cache_order_.size() > kCacheBlockCount) {
+      block_cache_.erase(block_cache_order_.front());
+      block_cache_order_.pop_front();
+    }
+  }
+  return true;
+}
+
+bool CompressedImageReader::Read(size_t offset, void* buffer, size_t length) {
+  if (!length) {
+    return true;
+  }
+  if (offset + length > uncompressed_size_) {
+    return false;
+  }
+
+  uint8_t* dst = reinterpret_cast<uint8_t*>(buffer);
+  uint32_t first_block = uint32_t(offset / block_size_);
+  uint32_t last_block = uint32_t((offset + length - 1) / block_size_);
+  uint32_t span = last_block - first_block + 1;
+
+  std::atomic<bool> ok(true);
+  auto read_block = [&, this](uint32_t i) {
+    uint32_t block_index = first_block + i;
+    size_t block_start = size_t(block_index) * block_size_;
+    size_t copy_begin = std::max(offset, block_start);
+    size_t copy_end =
+        std::min(offset + length,
+                 block_start + BlockUncompressedSize(block_index));
+    uint8_t* out = dst + (copy_begin - offset);
+    bool result;
+    if (copy_begin == block_start &&
+        copy_end == block_start + BlockUncompressedSize(block_index)) {
+      // Whole block lands in the caller's buffer - decompress in place.
+      result = DecompressBlockInto(block_index, out);
+    } else {
+      result = ReadPartialBlock(block_index, copy_begin - block_start, out,
+                                copy_end - copy_begin);
+    }
+    if (!result) {
+      ok = false;
+    }
+  };
+
+  if (span == 1) {
+    read_block(0);
+  } else {
+    // Fan the blocks out across the pool; decompression dominates the cost.
+    xe::threading::ThreadPool::shared()->ParallelFor(span, read_block);
+  }
+  return ok;
+}
+
+}  // namespace vfs
+}  // namespace xe
@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2013 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_VFS_DEVICES_COMPRESSED_IMAGE_READER_H_
+#define XENIA_VFS_DEVICES_COMPRESSED_IMAGE_READER_H_
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "xenia/base/filesystem.h"
+
+namespace xe {
+namespace vfs {
+
+// Reader for chunked snappy-compressed disc images ("XCIS"). The on-disk
+// layout, all fields little-endian:
+//   [0]  char     magic[4]      'X' 'C' 'I' 'S'
+//   [4]  uint32_t version       1
+//   [8]  uint32_t block_size    uncompressed bytes per block (power of two)
+//   [12] uint32_t reserved      0
+//   [16] uint64_t uncompressed_size
+//   [24] uint64_t block_offsets[block_count + 1]
+// Block i is stored at [block_offsets[i], block_offsets[i + 1]) and is raw
+// when its stored size equals its uncompressed size, snappy-compressed
+// otherwise (so incompressible blocks cost nothing extra).
+//
+// Reads spanning multiple blocks decompress the blocks in parallel on the
+// shared thread pool; partially-consumed boundary blocks are kept in a small
+// cache so sequential readers don't decompress the same block twice.
+class CompressedImageReader {
+ public:
+  // Checks whether the file at the given path carries the XCIS magic.
+  static bool IsCompressedImage(const std::wstring& path);
+
+  // Opens and validates the image, returning nullptr on a damaged header.
+  static std::unique_ptr<CompressedImageReader> Open(
+      const std::wstring& path);
+
+  // Total uncompressed image size in bytes.
+  size_t size() const { return size_t(uncompressed_size_); }
+
+  // Reads [offset, offset + length) of the uncompressed image into buffer.
+  bool Read(size_t offset, void* buffer, size_t length);
+
+ private:
+  CompressedImageReader() = default;
+
+  uint32_t block_count() const {
+    return uint32_t((uncompressed_size_ + block_size_ - 1) / block_size_);
+  }
+  size_t BlockUncompressedSize(uint32_t block_index) const;
+
+  // Decompresses the whole block straight into dst, which must hold
+  // BlockUncompressedSize(block_index) bytes.
+  bool DecompressBlockInto(uint32_t block_index, uint8_t* dst);
+  // Reads a sub-range of a block through the boundary-block cache.
+  bool ReadPartialBlock(uint32_t block_index, size_t skip, uint8_t* dst,
+                        size_t length);
+
+  std::unique_ptr<xe::filesystem::FileHandle> file_handle_;
+  // FileHandle reads go through a shared file position on some hosts, so
+  // stored-block reads are serialized; decompression stays parallel.
+  std::mutex io_mutex_;
+
+  uint32_t block_size_ = 0;
+  uint64_t uncompressed_size_ = 0;
+  std::vector<uint64_t> block_offsets_;
+
+  std::mutex cache_mutex_;
+  std::unordered_map<uint32_t, std::vector<uint8_t>> block_cache_;
+  std::deque<uint32_t> block_cache_order_;
+};
+
+}  // namespace vfs
+}  // namespace xe
+
+#endif  // XENIA_VFS_DEVICES_COMPRESSED_IMAGE_READER_H_
@@ -25,22 +25,41 @@ DiscImageDevice::DiscImageDevice(const std::string& mount_path,
 DiscImageDevice::~DiscImageDevice() = default;
 
 bool DiscImageDevice::Initialize() {
-  mmap_ = MappedMemory::Open(local_path_, MappedMemory::Mode::kRead);
-  if (!mmap_) {
-    XELOGE("Disc image could not be mapped");
-    return false;
+  ParseState state = {0};
+  if (CompressedImageReader::IsCompressedImage(local_path_)) {
+    reader_ = CompressedImageReader::Open(local_path_);
+    if (!reader_) {
+      XELOGE("Compressed disc image could not be opened");
+      return false;
+    }
+    state.ptr = nullptr;
+    state.size = reader_->size();
+  } else {
+    mmap_ = MappedMemory::Open(local_path_, MappedMemory::Mode::kRead);
+    if (!mmap_) {
+      XELOGE("Disc image could not be mapped");
+      return false;
+    }
+    state.ptr = mmap_->data();
+    state.size = mmap_->size();
   }
+  image_size_ = state.size;
 
-  ParseState state = {0};
-  state.ptr = mmap_->data();
-  state.size = mmap_->size();
   auto result = Verify(&state);
   if (result != Error::kSuccess) {
     XELOGE("Failed to verify disc image header: %d", result);
     return false;
   }
 
-  result = ReadAllEntries(&state, state.ptr + state.root_offset);
+  std::vector<uint8_t> root_storage;
+  auto root_buffer =
+      ReadRange(&state, state.root_offset, state.root_size, &root_storage);
+  if (!root_buffer) {
+    XELOGE("Failed to read GDFX root directory");
+    return false;
+  }
+
+  result = ReadAllEntries(&state, root_buffer);
   if (result != Error::kSuccess) {
     XELOGE("Failed to read all GDFX entries: %d", result);
     return false;
@@ -49,6 +68,22 @@ bool DiscImageDevice::Initialize() {
   return true;
 }
 
+const uint8_t* DiscImageDevice::ReadRange(ParseState* state, size_t offset,
+                                          size_t length,
+                                          std::vector<uint8_t>* storage) {
+  if (offset + length > state->size) {
+    return nullptr;
+  }
+  if (state->ptr) {
+    return state->ptr + offset;
+  }
+  storage->resize(length);
+  if (!reader_->Read(offset, storage->data(), length)) {
+    return nullptr;
+  }
+  return storage->data();
+}
+
 void DiscImageDevice::Dump(StringBuffer* string_buffer) {
   auto global_lock = global_critical_region_.Acquire();
   root_entry_->Dump(string_buffer, 0);
@@ -97,7 +132,12 @@ DiscImageDevice::Error DiscImageDevice::Verify(ParseState* state) {
   if (state->size < state->game_offset + (32 * kXESectorSize)) {
     return Error::kErrorReadError;
   }
-  uint8_t* fs_ptr = state->ptr + state->game_offset + (32 * kXESectorSize);
+  std::vector<uint8_t> fs_storage;
+  auto fs_ptr = ReadRange(state, state->game_offset + (32 * kXESectorSize), 28,
+                          &fs_storage);
+  if (!fs_ptr) {
+    return Error::kErrorReadError;
+  }
   state->root_sector = xe::load<uint32_t>(fs_ptr + 20);
   state->root_size = xe::load<uint32_t>(fs_ptr + 24);
   state->root_offset =
@@ -115,12 +155,15 @@ bool DiscImageDevice::VerifyMagic(ParseState* state, size_t offset) {
   }
 
   // Simple check to see if the given offset contains the magic value.
-  return std::memcmp(state->ptr + offset, "MICROSOFT*XBOX*MEDIA", 20) == 0;
+  std::vector<uint8_t> storage;
+  auto p = ReadRange(state, offset, 20, &storage);
+  return p && std::memcmp(p, "MICROSOFT*XBOX*MEDIA", 20) == 0;
 }
 
 DiscImageDevice::Error DiscImageDevice::ReadAllEntries(
     ParseState* state, const uint8_t* root_buffer) {
-  auto root_entry = new DiscImageEntry(this, nullptr, "", mmap_.get());
+  auto root_entry =
+      new DiscImageEntry(this, nullptr, "", mmap_.get(), reader_.get());
   root_entry->attributes_ = kFileAttributeDirectory;
   root_entry_ = std::unique_ptr<Entry>(root_entry);
 
@@ -148,8 +191,9 @@ bool DiscImageDevice::ReadEntry(ParseState* state, const uint8_t* buffer,
     return false;
   }
 
-  auto entry = DiscImageEntry::Create(
-      this, parent, std::string(name, name_length), mmap_.get());
+  auto entry =
+      DiscImageEntry::Create(this, parent, std::string(name, name_length),
+                             mmap_.get(), reader_.get());
   entry->attributes_ = attributes | kFileAttributeReadOnly;
   entry->size_ = length;
   entry->allocation_size_ = xe::round_up(length, bytes_per_sector());
@@ -170,9 +214,11 @@ bool DiscImageDevice::ReadEntry(ParseState* state, const uint8_t* buffer,
         return false;
       }
       // Read child list.
-      uint8_t* folder_ptr =
-          state->ptr + state->game_offset + (sector * kXESectorSize);
-      if (!ReadEntry(state, folder_ptr, 0, entry.get())) {
+      std::vector<uint8_t> folder_storage;
+      auto folder_ptr =
+          ReadRange(state, state->game_offset + (sector * kXESectorSize),
+                    length, &folder_storage);
+      if (!folder_ptr || !ReadEntry(state, folder_ptr, 0, entry.get())) {
         return false;
       }
     }
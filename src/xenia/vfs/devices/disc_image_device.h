@@ -12,9 +12,11 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "xenia/base/mapped_memory.h"
 #include "xenia/vfs/device.h"
+#include "xenia/vfs/devices/compressed_image_reader.h"
 
 namespace xe {
 namespace vfs {
@@ -32,7 +34,7 @@ class DiscImageDevice : public Device {
   Entry* ResolvePath(const std::string& path) override;
 
   uint32_t total_allocation_units() const override {
-    return uint32_t(mmap_->size() / sectors_per_allocation_unit() /
+    return uint32_t(image_size_ / sectors_per_allocation_unit() /
                     bytes_per_sector());
   }
   uint32_t available_allocation_units() const override { return 0; }
@@ -50,10 +52,14 @@ class DiscImageDevice : public Device {
 
   std::wstring local_path_;
   std::unique_ptr<Entry> root_entry_;
+  // Raw images are mapped; XCIS images read through the compressed reader.
+  // Exactly one of these is set after Initialize().
   std::unique_ptr<MappedMemory> mmap_;
+  std::unique_ptr<CompressedImageReader> reader_;
+  size_t image_size_ = 0;
 
   typedef struct {
-    uint8_t* ptr;
+    uint8_t* ptr;        // Image base when memory-mapped, else nullptr.
     size_t size;         // Size (bytes) of total image.
     size_t game_offset;  // Offset (bytes) of game partition.
     size_t root_sector;  // Offset (sector) of root.
@@ -61,6 +67,12 @@ class DiscImageDevice : public Device {
     size_t root_size;    // Size (bytes) of root.
   } ParseState;
 
+  // Returns a pointer to [offset, offset + length) of the image - directly
+  // into the mapping when raw, decompressed into storage when compressed.
+  // Returns nullptr on an out-of-bounds or failed read.
+  const uint8_t* ReadRange(ParseState* state, size_t offset, size_t length,
+                           std::vector<uint8_t>* storage);
+
   Error Verify(ParseState* state);
   bool VerifyMagic(ParseState* state, size_t offset);
   Error ReadAllEntries(ParseState* state, const uint8_t* root_buffer);
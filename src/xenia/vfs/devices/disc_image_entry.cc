@@ -18,20 +18,22 @@ namespace xe {
 namespace vfs {
 
 DiscImageEntry::DiscImageEntry(Device* device, Entry* parent, std::string path,
-                               MappedMemory* mmap)
+                               MappedMemory* mmap,
+                               CompressedImageReader* reader)
     : Entry(device, parent, path),
       mmap_(mmap),
+      reader_(reader),
       data_offset_(0),
       data_size_(0) {}
 
 DiscImageEntry::~DiscImageEntry() = default;
 
-std::unique_ptr<DiscImageEntry> DiscImageEntry::Create(Device* device,
-                                                       Entry* parent,
-                                                       std::string name,
-                                                       MappedMemory* mmap) {
+std::unique_ptr<DiscImageEntry> DiscImageEntry::Create(
+    Device* device, Entry* parent, std::string name, MappedMemory* mmap,
+    CompressedImageReader* reader) {
   auto path = xe::join_paths(parent->path(), name);
-  auto entry = std::make_unique<DiscImageEntry>(device, parent, path, mmap);
+  auto entry =
+      std::make_unique<DiscImageEntry>(device, parent, path, mmap, reader);
 
   return std::move(entry);
 }
@@ -48,8 +50,17 @@ std::unique_ptr<MappedMemory> DiscImageEntry::OpenMapped(
     return nullptr;
   }
 
+  if (!mmap_) {
+    // Compressed image; callers must check can_map() and fall back to reads.
+    return nullptr;
+  }
+
+  if (offset >= data_size_) {
+    return nullptr;
+  }
   size_t real_offset = data_offset_ + offset;
-  size_t real_length = length ? std::min(length, data_size_) : data_size_;
+  size_t real_length =
+      length ? std::min(length, data_size_ - offset) : data_size_ - offset;
   return mmap_->Slice(mode, real_offset, real_length);
 }
 
@@ -15,6 +15,7 @@
 
 #include "xenia/base/filesystem.h"
 #include "xenia/base/mapped_memory.h"
+#include "xenia/vfs/devices/compressed_image_reader.h"
 #include "xenia/vfs/entry.h"
 
 namespace xe {
@@ -25,20 +26,24 @@ class DiscImageDevice;
 class DiscImageEntry : public Entry {
  public:
   DiscImageEntry(Device* device, Entry* parent, std::string path,
-                 MappedMemory* mmap);
+                 MappedMemory* mmap, CompressedImageReader* reader);
   ~DiscImageEntry() override;
 
   static std::unique_ptr<DiscImageEntry> Create(Device* device, Entry* parent,
                                                 std::string name,
-                                                MappedMemory* mmap);
+                                                MappedMemory* mmap,
+                                                CompressedImageReader* reader);
 
+  // Null when the image is compressed; read through reader() instead.
   MappedMemory* mmap() const { return mmap_; }
+  CompressedImageReader* reader() const { return reader_; }
   size_t data_offset() const { return data_offset_; }
   size_t data_size() const { return data_size_; }
 
   X_STATUS Open(uint32_t desired_access, File** out_file) override;
 
-  bool can_map() const override { return true; }
+  // Compressed images can't hand out raw pointers into the file.
+  bool can_map() const override { return mmap_ != nullptr; }
   std::unique_ptr<MappedMemory> OpenMapped(MappedMemory::Mode mode,
                                            size_t offset,
                                            size_t length) override;
@@ -47,6 +52,7 @@ class DiscImageEntry : public Entry {
   friend class DiscImageDevice;
 
   MappedMemory* mmap_;
+  CompressedImageReader* reader_;
   size_t data_offset_;
   size_t data_size_;
 };
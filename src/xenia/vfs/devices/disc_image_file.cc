@@ -31,7 +31,17 @@ X_STATUS DiscImageFile::ReadSync(void* buffer, size_t buffer_length,
   size_t real_offset = entry_->data_offset() + byte_offset;
   size_t real_length =
       std::min(buffer_length, entry_->data_size() - byte_offset);
-  std::memcpy(buffer, entry_->mmap()->data() + real_offset, real_length);
+  if (entry_->mmap()) {
+    // Single copy straight out of the mapped image: NtReadFile hands us the
+    // translated guest buffer, so there is no intermediate staging buffer
+    // anywhere on this path.
+    std::memcpy(buffer, entry_->mmap()->data() + real_offset, real_length);
+  } else {
+    // Compressed image: blocks decompress in parallel into the guest buffer.
+    if (!entry_->reader()->Read(real_offset, buffer, real_length)) {
+      return X_STATUS_UNSUCCESSFUL;
+    }
+  }
   *out_bytes_read = real_length;
   return X_STATUS_SUCCESS;
 }
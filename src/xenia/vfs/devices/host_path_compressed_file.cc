@@ -0,0 +1,45 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2013 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/devices/host_path_compressed_file.h"
+
+#include <algorithm>
+
+#include "xenia/vfs/devices/compressed_image_reader.h"
+#include "xenia/vfs/devices/host_path_entry.h"
+
+namespace xe {
+namespace vfs {
+
+HostPathCompressedFile::HostPathCompressedFile(
+    uint32_t file_access, HostPathEntry* entry,
+    std::shared_ptr<CompressedImageReader> reader)
+    : File(file_access, entry), entry_(entry), reader_(std::move(reader)) {}
+
+HostPathCompressedFile::~HostPathCompressedFile() = default;
+
+void HostPathCompressedFile::Destroy() { delete this; }
+
+X_STATUS HostPathCompressedFile::ReadSync(void* buffer, size_t buffer_length,
+                                          size_t byte_offset,
+                                          size_t* out_bytes_read) {
+  if (byte_offset >= entry_->size()) {
+    return X_STATUS_END_OF_FILE;
+  }
+  size_t real_length = std::min(buffer_length, entry_->size() - byte_offset);
+  // Blocks decompress in parallel straight into the guest buffer.
+  if (!reader_->Read(byte_offset, buffer, real_length)) {
+    return X_STATUS_UNSUCCESSFUL;
+  }
+  *out_bytes_read = real_length;
+  return X_STATUS_SUCCESS;
+}
+
+}  // namespace vfs
+}  // namespace xe
@@ -0,0 +1,50 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2013 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_VFS_DEVICES_HOST_PATH_COMPRESSED_FILE_H_
+#define XENIA_VFS_DEVICES_HOST_PATH_COMPRESSED_FILE_H_
+
+#include <memory>
+
+#include "xenia/vfs/file.h"
+
+namespace xe {
+namespace vfs {
+
+class CompressedImageReader;
+class HostPathEntry;
+
+// Read-only view of an XCIS-compressed loose file. All handles opened on the
+// same entry share one reader, so its boundary-block cache is shared too and
+// blocks a sequential reader straddles decompress once.
+class HostPathCompressedFile : public File {
+ public:
+  HostPathCompressedFile(uint32_t file_access, HostPathEntry* entry,
+                         std::shared_ptr<CompressedImageReader> reader);
+  ~HostPathCompressedFile() override;
+
+  void Destroy() override;
+
+  X_STATUS ReadSync(void* buffer, size_t buffer_length, size_t byte_offset,
+                    size_t* out_bytes_read) override;
+  X_STATUS WriteSync(const void* buffer, size_t buffer_length,
+                     size_t byte_offset, size_t* out_bytes_written) override {
+    return X_STATUS_ACCESS_DENIED;
+  }
+  X_STATUS SetLength(size_t length) override { return X_STATUS_ACCESS_DENIED; }
+
+ private:
+  HostPathEntry* entry_;
+  std::shared_ptr<CompressedImageReader> reader_;
+};
+
+}  // namespace vfs
+}  // namespace xe
+
+#endif  // XENIA_VFS_DEVICES_HOST_PATH_COMPRESSED_FILE_H_
@@ -9,10 +9,13 @@
 
 #include "xenia/vfs/devices/host_path_device.h"
 
+#include <algorithm>
+
 #include "xenia/base/filesystem.h"
 #include "xenia/base/logging.h"
 #include "xenia/base/math.h"
 #include "xenia/kernel/xfile.h"
+#include "xenia/vfs/devices/compressed_image_reader.h"
 #include "xenia/vfs/devices/host_path_entry.h"
 
 namespace xe {
@@ -70,17 +73,46 @@ Entry* HostPathDevice::ResolvePath(const std::string& path) {
 }
 
 void HostPathDevice::PopulateEntry(HostPathEntry* parent_entry) {
-  auto child_infos = xe::filesystem::ListFiles(parent_entry->local_path());
-  for (auto& child_info : child_infos) {
-    auto child = HostPathEntry::Create(
-        this, parent_entry,
-        xe::join_paths(parent_entry->local_path(), child_info.name),
-        child_info);
-    parent_entry->children_.push_back(std::unique_ptr<Entry>(child));
-
-    if (child_info.type == xe::filesystem::FileInfo::Type::kDirectory) {
-      PopulateEntry(child);
-    }
+  // Stream entries straight into the VFS tree; with tens of thousands of
+  // loose files a materialized ListFiles vector is a second full copy of
+  // every name and stat result.
+  std::vector<HostPathEntry*> child_dirs;
+  xe::filesystem::EnumerateFiles(
+      parent_entry->local_path(),
+      [this, parent_entry,
+       &child_dirs](const xe::filesystem::FileInfo& child_info) {
+        auto full_path =
+            xe::join_paths(parent_entry->local_path(), child_info.name);
+        // Loose files stored as XCIS containers mount under their real name
+        // with their uncompressed size and decompress block-wise on read.
+        // A container with a damaged header falls through and is exposed
+        // raw so the problem is visible to the user.
+        const std::wstring kCompressedSuffix = L".xcis";
+        if (child_info.type == xe::filesystem::FileInfo::Type::kFile &&
+            child_info.name.size() > kCompressedSuffix.size() &&
+            std::equal(kCompressedSuffix.rbegin(), kCompressedSuffix.rend(),
+                       child_info.name.rbegin()) &&
+            CompressedImageReader::IsCompressedImage(full_path)) {
+          auto reader = CompressedImageReader::Open(full_path);
+          if (reader) {
+            auto child = HostPathEntry::CreateCompressed(
+                this, parent_entry, full_path, child_info, reader->size());
+            parent_entry->children_.push_back(std::unique_ptr<Entry>(child));
+            return true;
+          }
+        }
+        auto child =
+            HostPathEntry::Create(this, parent_entry, full_path, child_info);
+        parent_entry->children_.push_back(std::unique_ptr<Entry>(child));
+        if (child_info.type == xe::filesystem::FileInfo::Type::kDirectory) {
+          child_dirs.push_back(child);
+        }
+        return true;
+      });
+  // Recurse after this directory's handle is closed so only one enumeration
+  // handle is open at a time regardless of tree depth.
+  for (auto child_dir : child_dirs) {
+    PopulateEntry(child_dir);
   }
 }
 
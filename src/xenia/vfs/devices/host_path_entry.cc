@@ -15,6 +15,8 @@
 #include "xenia/base/math.h"
 #include "xenia/base/string.h"
 #include "xenia/vfs/device.h"
+#include "xenia/vfs/devices/compressed_image_reader.h"
+#include "xenia/vfs/devices/host_path_compressed_file.h"
 #include "xenia/vfs/devices/host_path_file.h"
 
 namespace xe {
@@ -49,12 +51,49 @@ HostPathEntry* HostPathEntry::Create(Device* device, Entry* parent,
   return entry;
 }
 
+HostPathEntry* HostPathEntry::CreateCompressed(
+    Device* device, Entry* parent, const std::wstring& full_path,
+    xe::filesystem::FileInfo file_info, uint64_t uncompressed_size) {
+  // Strip the ".xcis" suffix - the container is a host-side detail.
+  auto name = file_info.name.substr(0, file_info.name.size() - 5);
+  auto path = xe::join_paths(parent->path(), xe::to_string(name));
+  auto entry = new HostPathEntry(device, parent, path, full_path);
+
+  entry->create_timestamp_ = file_info.create_timestamp;
+  entry->access_timestamp_ = file_info.access_timestamp;
+  entry->write_timestamp_ = file_info.write_timestamp;
+  entry->attributes_ = kFileAttributeNormal | kFileAttributeReadOnly;
+  entry->size_ = uncompressed_size;
+  entry->allocation_size_ =
+      xe::round_up(uncompressed_size, device->bytes_per_sector());
+  entry->is_compressed_ = true;
+  return entry;
+}
+
+std::shared_ptr<CompressedImageReader> HostPathEntry::compressed_reader() {
+  std::lock_guard<std::mutex> lock(compressed_reader_mutex_);
+  if (!compressed_reader_) {
+    compressed_reader_ = CompressedImageReader::Open(local_path_);
+  }
+  return compressed_reader_;
+}
+
 X_STATUS HostPathEntry::Open(uint32_t desired_access, File** out_file) {
-  if (is_read_only() && (desired_access & (FileAccess::kFileWriteData |
-                                           FileAccess::kFileAppendData))) {
+  if ((is_read_only() || is_compressed_) &&
+      (desired_access &
+       (FileAccess::kFileWriteData | FileAccess::kFileAppendData))) {
     XELOGE("Attempting to open file for write access on read-only device");
     return X_STATUS_ACCESS_DENIED;
   }
+  if (is_compressed_) {
+    auto reader = compressed_reader();
+    if (!reader) {
+      return X_STATUS_NO_SUCH_FILE;
+    }
+    *out_file =
+        new HostPathCompressedFile(desired_access, this, std::move(reader));
+    return X_STATUS_SUCCESS;
+  }
   auto file_handle =
       xe::filesystem::FileHandle::OpenExisting(local_path_, desired_access);
   if (!file_handle) {
@@ -68,6 +107,10 @@ X_STATUS HostPathEntry::Open(uint32_t desired_access, File** out_file) {
 std::unique_ptr<MappedMemory> HostPathEntry::OpenMapped(MappedMemory::Mode mode,
                                                         size_t offset,
                                                         size_t length) {
+  if (is_compressed_) {
+    // Callers fall back to the read path when mapping is unavailable.
+    return nullptr;
+  }
   return MappedMemory::Open(local_path_, mode, offset, length);
 }
 
@@ -105,15 +148,28 @@ bool HostPathEntry::DeleteEntryInternal(Entry* entry) {
 }
 
 void HostPathEntry::update() {
+  auto now = std::chrono::steady_clock::now();
+  if (now < attribute_cache_expiry_) {
+    // Stat results are still fresh.
+    return;
+  }
+
   xe::filesystem::FileInfo file_info;
   if (!xe::filesystem::GetInfo(local_path_, &file_info)) {
     return;
   }
-  if (file_info.type == xe::filesystem::FileInfo::Type::kFile) {
+  if (file_info.type == xe::filesystem::FileInfo::Type::kFile &&
+      !is_compressed_) {
+    // Compressed entries report the uncompressed size, not the stat result.
     size_ = file_info.total_size;
     allocation_size_ =
         xe::round_up(file_info.total_size, device()->bytes_per_sector());
   }
+  create_timestamp_ = file_info.create_timestamp;
+  access_timestamp_ = file_info.access_timestamp;
+  write_timestamp_ = file_info.write_timestamp;
+
+  attribute_cache_expiry_ = now + std::chrono::milliseconds(100);
 }
 
 }  // namespace vfs
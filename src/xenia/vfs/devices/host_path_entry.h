@@ -10,6 +10,9 @@
 #ifndef XENIA_VFS_DEVICES_HOST_PATH_ENTRY_H_
 #define XENIA_VFS_DEVICES_HOST_PATH_ENTRY_H_
 
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "xenia/base/filesystem.h"
@@ -18,6 +21,7 @@
 namespace xe {
 namespace vfs {
 
+class CompressedImageReader;
 class HostPathDevice;
 
 class HostPathEntry : public Entry {
@@ -29,17 +33,30 @@ class HostPathEntry : public Entry {
   static HostPathEntry* Create(Device* device, Entry* parent,
                                const std::wstring& full_path,
                                xe::filesystem::FileInfo file_info);
+  // Creates an entry for an XCIS-compressed loose file: the guest sees it
+  // under its real name (the .xcis suffix stripped) with its uncompressed
+  // size; the container is a host-side detail.
+  static HostPathEntry* CreateCompressed(Device* device, Entry* parent,
+                                         const std::wstring& full_path,
+                                         xe::filesystem::FileInfo file_info,
+                                         uint64_t uncompressed_size);
 
   const std::wstring& local_path() { return local_path_; }
 
   X_STATUS Open(uint32_t desired_access, File** out_file) override;
 
-  bool can_map() const override { return true; }
+  bool can_map() const override { return !is_compressed_; }
   std::unique_ptr<MappedMemory> OpenMapped(MappedMemory::Mode mode,
                                            size_t offset,
                                            size_t length) override;
   void update() override;
 
+  // Forces the next update() to stat the host file, bypassing the TTL.
+  // Called by the write path so size queries after a write stay accurate.
+  void InvalidateAttributeCache() {
+    attribute_cache_expiry_ = std::chrono::steady_clock::time_point();
+  }
+
  private:
   friend class HostPathDevice;
 
@@ -47,7 +64,17 @@ class HostPathEntry : public Entry {
                                              uint32_t attributes) override;
   bool DeleteEntryInternal(Entry* entry) override;
 
+  // Lazily opens the shared reader for a compressed entry; all open handles
+  // route through it so the block cache is shared.
+  std::shared_ptr<CompressedImageReader> compressed_reader();
+
   std::wstring local_path_;
+  bool is_compressed_ = false;
+  std::mutex compressed_reader_mutex_;
+  std::shared_ptr<CompressedImageReader> compressed_reader_;
+  // Titles poll file attributes (update/DLC existence checks) thousands of
+  // times a minute; reuse the last stat result within this window.
+  std::chrono::steady_clock::time_point attribute_cache_expiry_;
 };
 
 }  // namespace vfs
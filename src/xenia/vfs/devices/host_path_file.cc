@@ -9,17 +9,41 @@
 
 #include "xenia/vfs/devices/host_path_file.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "xenia/base/logging.h"
+#include "xenia/base/string.h"
 #include "xenia/vfs/devices/host_path_entry.h"
 
 namespace xe {
 namespace vfs {
 
+// Backpressure limit on buffered write-behind data per file; writers block
+// once this much is outstanding so a runaway producer can't balloon memory.
+const size_t kMaxPendingWriteBytes = 8 * 1024 * 1024;
+
 HostPathFile::HostPathFile(
     uint32_t file_access, HostPathEntry* entry,
     std::unique_ptr<xe::filesystem::FileHandle> file_handle)
-    : File(file_access, entry), file_handle_(std::move(file_handle)) {}
+    : File(file_access, entry),
+      entry_(entry),
+      file_handle_(std::move(file_handle)) {}
 
-HostPathFile::~HostPathFile() = default;
+HostPathFile::~HostPathFile() {
+  if (flusher_thread_) {
+    {
+      std::unique_lock<std::mutex> lock(pending_write_lock_);
+      // Unlike reads, buffered writes are guest data - commit them all
+      // before the handle goes away.
+      DrainPendingWrites(lock);
+      flusher_shutdown_ = true;
+    }
+    pending_write_cond_.notify_all();
+    xe::threading::Wait(flusher_thread_.get(), false);
+    flusher_thread_.reset();
+  }
+}
 
 void HostPathFile::Destroy() { delete this; }
 
@@ -29,11 +53,37 @@ X_STATUS HostPathFile::ReadSync(void* buffer, size_t buffer_length,
     return X_STATUS_ACCESS_DENIED;
   }
 
-  if (file_handle_->Read(byte_offset, buffer, buffer_length, out_bytes_read)) {
-    return X_STATUS_SUCCESS;
-  } else {
+  {
+    std::unique_lock<std::mutex> lock(pending_write_lock_);
+    DrainPendingWrites(lock);
+  }
+
+  if (!file_handle_->Read(byte_offset, buffer, buffer_length,
+                          out_bytes_read)) {
     return X_STATUS_END_OF_FILE;
   }
+
+  // Sequential stream detection, same heuristic as StfsContainerFile: when
+  // this read picks up where the last one ended, hint the host to start
+  // readahead scaled to the read size (guest streamers use fixed strides).
+  total_reads_++;
+  size_t read_end = byte_offset + *out_bytes_read;
+  if (byte_offset == last_read_end_) {
+    sequential_reads_++;
+    size_t prefetch_length = std::min(
+        std::max(*out_bytes_read * 4, size_t(64 * 1024)), size_t(1024 * 1024));
+    file_handle_->Prefetch(read_end, prefetch_length);
+  }
+  last_read_end_ = read_end;
+
+  return X_STATUS_SUCCESS;
+}
+
+void HostPathFile::Prefetch(size_t byte_offset, size_t length) {
+  if (!(file_access_ & FileAccess::kFileReadData)) {
+    return;
+  }
+  file_handle_->Prefetch(byte_offset, length);
 }
 
 X_STATUS HostPathFile::WriteSync(const void* buffer, size_t buffer_length,
@@ -44,12 +94,36 @@ X_STATUS HostPathFile::WriteSync(const void* buffer, size_t buffer_length,
     return X_STATUS_ACCESS_DENIED;
   }
 
-  if (file_handle_->Write(byte_offset, buffer, buffer_length,
-                          out_bytes_written)) {
-    return X_STATUS_SUCCESS;
-  } else {
-    return X_STATUS_END_OF_FILE;
+  // Queue the write and return; the flusher thread commits it to the host
+  // file so the guest thread isn't stalled on disk latency.
+  PendingWrite write;
+  write.byte_offset = byte_offset;
+  write.data.resize(buffer_length);
+  std::memcpy(write.data.data(), buffer, buffer_length);
+
+  {
+    std::unique_lock<std::mutex> lock(pending_write_lock_);
+    while (pending_write_bytes_ >= kMaxPendingWriteBytes) {
+      pending_write_cond_.wait(lock);
+    }
+    if (!flusher_thread_) {
+      flusher_shutdown_ = false;
+      flusher_thread_ =
+          xe::threading::Thread::Create({}, [this]() { FlusherThread(); });
+      flusher_thread_->set_name("HostPathFile Flush");
+    }
+    pending_write_bytes_ += buffer_length;
+    pending_writes_.push_back(std::move(write));
+  }
+  pending_write_cond_.notify_all();
+
+  // The entry's cached size/timestamps are now stale.
+  entry_->InvalidateAttributeCache();
+
+  if (out_bytes_written) {
+    *out_bytes_written = buffer_length;
   }
+  return X_STATUS_SUCCESS;
 }
 
 X_STATUS HostPathFile::SetLength(size_t length) {
@@ -57,12 +131,69 @@ X_STATUS HostPathFile::SetLength(size_t length) {
     return X_STATUS_ACCESS_DENIED;
   }
 
+  // Truncation must order against buffered writes.
+  {
+    std::unique_lock<std::mutex> lock(pending_write_lock_);
+    DrainPendingWrites(lock);
+  }
+
   if (file_handle_->SetLength(length)) {
+    entry_->InvalidateAttributeCache();
     return X_STATUS_SUCCESS;
   } else {
     return X_STATUS_END_OF_FILE;
   }
 }
 
+void HostPathFile::DrainPendingWrites(std::unique_lock<std::mutex>& lock) {
+  // pending_write_bytes_ only drops to zero after the flusher has committed
+  // the write, so this orders against in-flight writes too.
+  while (pending_write_bytes_ != 0) {
+    pending_write_cond_.wait(lock);
+  }
+}
+
+void HostPathFile::FlusherThread() {
+  // Write-behind flushing is housekeeping; don't steal storage bandwidth
+  // from streaming reads.
+  xe::threading::EnterBackgroundMode();
+  std::unique_lock<std::mutex> lock(pending_write_lock_);
+  bool needs_flush = false;
+  while (true) {
+    if (pending_writes_.empty()) {
+      if (needs_flush) {
+        // Batch the fsync: one flush per burst of writes, issued once the
+        // queue has gone idle, not one per WriteSync.
+        lock.unlock();
+        file_handle_->Flush();
+        lock.lock();
+        needs_flush = false;
+        continue;
+      }
+      if (flusher_shutdown_) {
+        break;
+      }
+      pending_write_cond_.wait(lock);
+      continue;
+    }
+
+    PendingWrite write = std::move(pending_writes_.front());
+    pending_writes_.pop_front();
+    lock.unlock();
+
+    size_t bytes_written = 0;
+    if (!file_handle_->Write(write.byte_offset, write.data.data(),
+                             write.data.size(), &bytes_written)) {
+      XELOGE("HostPathFile: write-behind commit failed for %S",
+             file_handle_->path().c_str());
+    }
+    needs_flush = true;
+
+    lock.lock();
+    pending_write_bytes_ -= write.data.size();
+    pending_write_cond_.notify_all();
+  }
+}
+
 }  // namespace vfs
 }  // namespace xe
@@ -10,9 +10,15 @@
 #ifndef XENIA_VFS_DEVICES_HOST_PATH_FILE_H_
 #define XENIA_VFS_DEVICES_HOST_PATH_FILE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "xenia/base/filesystem.h"
+#include "xenia/base/threading.h"
 #include "xenia/vfs/file.h"
 
 namespace xe {
@@ -34,8 +40,38 @@ class HostPathFile : public File {
                      size_t byte_offset, size_t* out_bytes_written) override;
   X_STATUS SetLength(size_t length) override;
 
+  void Prefetch(size_t byte_offset, size_t length) override;
+
  private:
+  // Write-behind: WriteSync returns once the data is buffered host-side and
+  // the flusher thread commits it, so guest threads don't stall on host disk
+  // latency during saves. Reads and truncation drain the queue first to keep
+  // read-after-write semantics intact.
+  struct PendingWrite {
+    size_t byte_offset;
+    std::vector<uint8_t> data;
+  };
+
+  void FlusherThread();
+  // Blocks until every buffered write has been committed to the host file.
+  // Callers must hold pending_write_lock_ via the given lock.
+  void DrainPendingWrites(std::unique_lock<std::mutex>& lock);
+
+  HostPathEntry* entry_;
   std::unique_ptr<xe::filesystem::FileHandle> file_handle_;
+
+  // Sequential-read tracking: when a read starts where the previous one
+  // ended, the host is hinted to prefetch ahead of the stream.
+  size_t last_read_end_ = 0;
+  uint64_t total_reads_ = 0;
+  uint64_t sequential_reads_ = 0;
+
+  std::unique_ptr<xe::threading::Thread> flusher_thread_;
+  std::mutex pending_write_lock_;
+  std::condition_variable pending_write_cond_;
+  std::deque<PendingWrite> pending_writes_;
+  size_t pending_write_bytes_ = 0;
+  bool flusher_shutdown_ = false;
 };
 
 }  // namespace vfs
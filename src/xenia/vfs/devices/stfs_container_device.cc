@@ -57,7 +57,77 @@ StfsContainerDevice::StfsContainerDevice(const std::string& mount_path,
                                          const std::wstring& local_path)
     : Device(mount_path), local_path_(local_path) {}
 
-StfsContainerDevice::~StfsContainerDevice() = default;
+StfsContainerDevice::~StfsContainerDevice() {
+  if (readahead_thread_) {
+    {
+      std::lock_guard<std::mutex> lock(readahead_lock_);
+      readahead_shutdown_ = true;
+      readahead_requests_.clear();
+    }
+    readahead_cond_.notify_all();
+    xe::threading::Wait(readahead_thread_.get(), false);
+  }
+}
+
+void StfsContainerDevice::RequestReadahead(StfsContainerEntry* entry,
+                                           size_t byte_offset, size_t length) {
+  {
+    std::lock_guard<std::mutex> lock(readahead_lock_);
+    if (readahead_shutdown_) {
+      return;
+    }
+    if (!readahead_thread_) {
+      readahead_thread_ =
+          xe::threading::Thread::Create({}, [this]() { ReadaheadThread(); });
+      readahead_thread_->set_name("STFS Readahead");
+    }
+    // Newest requests matter most; drop stale ones instead of queueing up a
+    // backlog the reader has already overtaken.
+    while (readahead_requests_.size() >= 8) {
+      readahead_requests_.pop_front();
+    }
+    readahead_requests_.push_back({entry, byte_offset, length});
+  }
+  readahead_cond_.notify_one();
+}
+
+void StfsContainerDevice::ReadaheadThread() {
+  // Readahead is speculative: idle-class I/O keeps it off the device
+  // whenever a demand read is pending.
+  xe::threading::EnterBackgroundMode();
+  std::unique_lock<std::mutex> lock(readahead_lock_);
+  while (!readahead_shutdown_) {
+    if (readahead_requests_.empty()) {
+      readahead_cond_.wait(lock);
+      continue;
+    }
+    ReadaheadRequest request = readahead_requests_.front();
+    readahead_requests_.pop_front();
+    lock.unlock();
+
+    // Touch one byte per page of every block overlapping the range to fault
+    // the container pages in ahead of the reader.
+    const size_t page_size = 4096;
+    size_t request_end = request.byte_offset + request.length;
+    size_t src_offset = 0;
+    for (auto& record : request.entry->block_list()) {
+      if (src_offset + record.length > request.byte_offset) {
+        if (src_offset >= request_end) {
+          break;
+        }
+        auto src = request.entry->mmap()->at(record.file)->data();
+        for (size_t page_offset = 0; page_offset < record.length;
+             page_offset += page_size) {
+          volatile uint8_t sink = src[record.offset + page_offset];
+          (void)sink;
+        }
+      }
+      src_offset += record.length;
+    }
+
+    lock.lock();
+  }
+}
 
 bool StfsContainerDevice::Initialize() {
   // Resolve a valid STFS file if a directory is given.
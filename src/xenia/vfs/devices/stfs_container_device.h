@@ -10,11 +10,15 @@
 #ifndef XENIA_VFS_DEVICES_STFS_CONTAINER_DEVICE_H_
 #define XENIA_VFS_DEVICES_STFS_CONTAINER_DEVICE_H_
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "xenia/base/mapped_memory.h"
+#include "xenia/base/threading.h"
 #include "xenia/vfs/device.h"
 
 namespace xe {
@@ -181,6 +185,13 @@ class StfsContainerDevice : public Device {
   uint32_t sectors_per_allocation_unit() const override { return 1; }
   uint32_t bytes_per_sector() const override { return 4 * 1024; }
 
+  // Queues a background page-in of [byte_offset, byte_offset + length) of
+  // the given entry so sequential readers find the container pages hot
+  // instead of faulting them in one at a time. Entries live as long as the
+  // device, so the raw pointer is safe to hold in the queue.
+  void RequestReadahead(StfsContainerEntry* entry, size_t byte_offset,
+                        size_t length);
+
  private:
   enum class Error {
     kSuccess = 0,
@@ -215,6 +226,15 @@ class StfsContainerDevice : public Device {
   BlockHash GetBlockHash(const uint8_t* map_ptr, uint32_t block_index,
                          uint32_t table_offset);
 
+  // Worker loop for the readahead thread, started on the first request.
+  void ReadaheadThread();
+
+  struct ReadaheadRequest {
+    StfsContainerEntry* entry;
+    size_t byte_offset;
+    size_t length;
+  };
+
   std::wstring local_path_;
   std::map<size_t, std::unique_ptr<MappedMemory>> mmap_;
   size_t mmap_total_size_;
@@ -225,6 +245,12 @@ class StfsContainerDevice : public Device {
   StfsPackageType package_type_;
   StfsHeader header_;
   uint32_t table_size_shift_;
+
+  std::unique_ptr<xe::threading::Thread> readahead_thread_;
+  std::deque<ReadaheadRequest> readahead_requests_;
+  std::mutex readahead_lock_;
+  std::condition_variable readahead_cond_;
+  bool readahead_shutdown_ = false;
 };
 
 }  // namespace vfs
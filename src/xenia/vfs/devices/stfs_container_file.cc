@@ -13,6 +13,7 @@
 #include <cmath>
 
 #include "xenia/base/math.h"
+#include "xenia/vfs/devices/stfs_container_device.h"
 #include "xenia/vfs/devices/stfs_container_entry.h"
 
 namespace xe {
@@ -33,13 +34,22 @@ X_STATUS StfsContainerFile::ReadSync(void* buffer, size_t buffer_length,
     return X_STATUS_END_OF_FILE;
   }
 
-  size_t src_offset = 0;
   uint8_t* p = reinterpret_cast<uint8_t*>(buffer);
   size_t remaining_length =
       std::min(buffer_length, entry_->size() - byte_offset);
   *out_bytes_read = remaining_length;
 
-  for (size_t i = 0; i < entry_->block_list().size(); i++) {
+  // Resume the block walk from the cursor when reading at or past it -
+  // streaming reads would otherwise rescan the block list from the start on
+  // every call.
+  size_t i = 0;
+  size_t src_offset = 0;
+  if (byte_offset >= cursor_block_offset_) {
+    i = cursor_block_index_;
+    src_offset = cursor_block_offset_;
+  }
+
+  for (; i < entry_->block_list().size(); i++) {
     auto& record = entry_->block_list()[i];
     if (src_offset + record.length <= byte_offset) {
       // Doesn't begin in this region. Skip it.
@@ -47,6 +57,9 @@ X_STATUS StfsContainerFile::ReadSync(void* buffer, size_t buffer_length,
       continue;
     }
 
+    cursor_block_index_ = i;
+    cursor_block_offset_ = src_offset;
+
     uint8_t* src = entry_->mmap()->at(record.file)->data();
 
     size_t read_offset =
@@ -63,8 +76,29 @@ X_STATUS StfsContainerFile::ReadSync(void* buffer, size_t buffer_length,
     }
   }
 
+  // Sequential stream: prefetch ahead of the reader on the device's
+  // readahead thread, scaled to the read size.
+  size_t read_end = byte_offset + *out_bytes_read;
+  if (byte_offset == last_read_end_ && read_end < entry_->size()) {
+    size_t readahead_length = std::min(
+        std::max(*out_bytes_read * 4, size_t(64 * 1024)), size_t(1024 * 1024));
+    readahead_length = std::min(readahead_length, entry_->size() - read_end);
+    auto device = static_cast<StfsContainerDevice*>(entry_->device());
+    device->RequestReadahead(entry_, read_end, readahead_length);
+  }
+  last_read_end_ = read_end;
+
   return X_STATUS_SUCCESS;
 }
 
+void StfsContainerFile::Prefetch(size_t byte_offset, size_t length) {
+  if (byte_offset >= entry_->size()) {
+    return;
+  }
+  length = std::min(length, entry_->size() - byte_offset);
+  auto device = static_cast<StfsContainerDevice*>(entry_->device());
+  device->RequestReadahead(entry_, byte_offset, length);
+}
+
 }  // namespace vfs
 }  // namespace xe
\ No newline at end of file
@@ -34,8 +34,17 @@ class StfsContainerFile : public File {
   }
   X_STATUS SetLength(size_t length) override { return X_STATUS_ACCESS_DENIED; }
 
+  void Prefetch(size_t byte_offset, size_t length) override;
+
  private:
   StfsContainerEntry* entry_;
+
+  // Cursor into the entry's block list, pointing at the block that held the
+  // end of the last read. The block list is immutable, so sequential reads
+  // can resume the walk here instead of rescanning from the first block.
+  size_t cursor_block_index_ = 0;
+  size_t cursor_block_offset_ = 0;
+  size_t last_read_end_ = 0;
 };
 
 }  // namespace vfs
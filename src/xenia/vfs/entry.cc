@@ -9,6 +9,9 @@
 
 #include "xenia/vfs/entry.h"
 
+#include <algorithm>
+#include <cctype>
+
 #include "xenia/base/filesystem.h"
 #include "xenia/base/string.h"
 #include "xenia/vfs/device.h"
@@ -16,6 +19,19 @@
 namespace xe {
 namespace vfs {
 
+namespace {
+
+// Case-folds a path component the same way the old strcasecmp-based child
+// search compared them.
+std::string CanonicalizeName(const std::string& name) {
+  std::string result = name;
+  std::transform(result.begin(), result.end(), result.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return result;
+}
+
+}  // namespace
+
 Entry::Entry(Device* device, Entry* parent, const std::string& path)
     : device_(device),
       parent_(parent),
@@ -48,13 +64,18 @@ bool Entry::is_read_only() const { return device_->is_read_only(); }
 
 Entry* Entry::GetChild(std::string name) {
   auto global_lock = global_critical_region_.Acquire();
-  // TODO(benvanik): a faster search
-  for (auto& child : children_) {
-    if (strcasecmp(child->name().c_str(), name.c_str()) == 0) {
-      return child.get();
+  if (indexed_child_count_ != children_.size()) {
+    child_index_.clear();
+    child_index_.reserve(children_.size());
+    for (auto& child : children_) {
+      // emplace keeps the first entry on case-folded collisions, matching
+      // what the old first-match linear search returned.
+      child_index_.emplace(CanonicalizeName(child->name()), child.get());
     }
+    indexed_child_count_ = children_.size();
   }
-  return nullptr;
+  auto it = child_index_.find(CanonicalizeName(name));
+  return it != child_index_.end() ? it->second : nullptr;
 }
 
 Entry* Entry::IterateChildren(const xe::filesystem::WildcardEngine& engine,
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "xenia/base/filesystem.h"
@@ -144,6 +145,13 @@ class Entry {
   uint64_t access_timestamp_;
   uint64_t write_timestamp_;
   std::vector<std::unique_ptr<Entry>> children_;
+
+  // Lazily-built index of children keyed on case-folded name, so path
+  // resolution doesn't case-compare every sibling per component. Rebuilt by
+  // GetChild whenever children_ has changed size - devices append to
+  // children_ directly while populating, and create/delete also change it.
+  std::unordered_map<std::string, Entry*> child_index_;
+  size_t indexed_child_count_ = SIZE_MAX;
 };
 
 }  // namespace vfs
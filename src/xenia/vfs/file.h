@@ -46,6 +46,11 @@ class File {
 
   virtual X_STATUS SetLength(size_t length) { return X_STATUS_NOT_IMPLEMENTED; }
 
+  // Best-effort hint that the given byte range is about to be read - devices
+  // that support it stage the data ahead of time so the read doesn't wait on
+  // the host. May be called from any thread.
+  virtual void Prefetch(size_t byte_offset, size_t length) {}
+
   // xe::filesystem::FileAccess
   uint32_t file_access() const { return file_access_; }
   const Entry* entry() const { return entry_; }
@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#include "xenia/vfs/stream_prefetcher.h"
+
+#include <algorithm>
+
+#include "xenia/vfs/file.h"
+
+namespace xe {
+namespace vfs {
+
+StreamPrefetcher* StreamPrefetcher::instance() {
+  static StreamPrefetcher instance;
+  return &instance;
+}
+
+void StreamPrefetcher::NotifyRead(File* file, uint32_t guest_address,
+                                  uint32_t length, uint64_t file_offset) {
+  if (!file || !length) {
+    return;
+  }
+  StreamPrefetcher* prefetcher = instance();
+  std::lock_guard<std::mutex> lock(prefetcher->mutex_);
+  // A refill of a range already tracked just updates it in place, so rolling
+  // stream buffers keep one mapping instead of aging everything else out.
+  for (Mapping& mapping : prefetcher->mappings_) {
+    if (mapping.file == file && mapping.guest_address == guest_address) {
+      mapping.length = length;
+      mapping.file_offset = file_offset;
+      return;
+    }
+  }
+  Mapping& mapping = prefetcher->mappings_[prefetcher->mapping_next_];
+  prefetcher->mapping_next_ =
+      (prefetcher->mapping_next_ + 1) % kMappingCount;
+  mapping.file = file;
+  mapping.guest_address = guest_address;
+  mapping.length = length;
+  mapping.file_offset = file_offset;
+}
+
+void StreamPrefetcher::NotifyFileDestroyed(File* file) {
+  StreamPrefetcher* prefetcher = instance();
+  std::lock_guard<std::mutex> lock(prefetcher->mutex_);
+  for (Mapping& mapping : prefetcher->mappings_) {
+    if (mapping.file == file) {
+      mapping = {};
+    }
+  }
+}
+
+void StreamPrefetcher::PrefetchFrom(uint32_t guest_address, uint32_t length) {
+  StreamPrefetcher* prefetcher = instance();
+  std::lock_guard<std::mutex> lock(prefetcher->mutex_);
+  const Mapping* found = nullptr;
+  for (const Mapping& mapping : prefetcher->mappings_) {
+    if (mapping.file && guest_address >= mapping.guest_address &&
+        guest_address < mapping.guest_address + mapping.length) {
+      found = &mapping;
+      break;
+    }
+  }
+  if (!found) {
+    return;
+  }
+  // The consumer is starting on data the title read up to
+  // (file_offset + delta + length) - what follows is what the title will
+  // read next to refill the buffer. Stage one refill ahead of the reader,
+  // within the same bounds the sequential-read heuristics use. The hint is
+  // issued under the lock so the file can't be destroyed from under it
+  // (NotifyFileDestroyed serializes on the same mutex).
+  uint64_t delta = guest_address - found->guest_address;
+  uint64_t prefetch_offset = found->file_offset + delta + length;
+  uint64_t prefetch_length = std::min(
+      std::max(uint64_t(length), uint64_t(64 * 1024)), uint64_t(1024 * 1024));
+  found->file->Prefetch(size_t(prefetch_offset), size_t(prefetch_length));
+}
+
+}  // namespace vfs
+}  // namespace xe
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * Xenia : Xbox 360 Emulator Research Project                                 *
+ ******************************************************************************
+ * Copyright 2020 Ben Vanik. All rights reserved.                             *
+ * Released under the BSD license - see LICENSE in the root for more details. *
+ ******************************************************************************
+ */
+
+#ifndef XENIA_VFS_STREAM_PREFETCHER_H_
+#define XENIA_VFS_STREAM_PREFETCHER_H_
+
+#include <cstdint>
+#include <mutex>
+
+namespace xe {
+namespace vfs {
+
+class File;
+
+// Correlates guest physical memory ranges filled by file reads with the file
+// bytes they came from, so hardware-style consumers that only see guest
+// addresses - the XMA contexts streaming compressed audio, primarily - can
+// ask the VFS to stage the file data that follows what the title has already
+// handed to them. The kernel I/O path records every read that lands in
+// physically-backed memory; when a consumer begins draining one of those
+// ranges, the bytes the title will read next to refill it are prefetched
+// through File::Prefetch before the title's reader thread asks for them.
+//
+// The registry keeps only the most recent reads - a stream buffer that is
+// being actively drained was by definition filled recently.
+class StreamPrefetcher {
+ public:
+  // Records that file bytes [file_offset, file_offset + length) were read
+  // into guest physical memory at guest_address. Called from the kernel I/O
+  // paths.
+  static void NotifyRead(File* file, uint32_t guest_address, uint32_t length,
+                         uint64_t file_offset);
+  // Drops all mappings of a file about to be destroyed.
+  static void NotifyFileDestroyed(File* file);
+  // Called when a consumer starts draining guest physical memory at
+  // guest_address; if the range is a recorded read destination, prefetches
+  // the file bytes that follow it.
+  static void PrefetchFrom(uint32_t guest_address, uint32_t length);
+
+ private:
+  struct Mapping {
+    File* file;
+    uint32_t guest_address;
+    uint32_t length;
+    uint64_t file_offset;
+  };
+
+  static StreamPrefetcher* instance();
+
+  static constexpr size_t kMappingCount = 64;
+
+  std::mutex mutex_;
+  // Ring of recent read destinations, overwritten oldest-first.
+  Mapping mappings_[kMappingCount] = {};
+  size_t mapping_next_ = 0;
+};
+
+}  // namespace vfs
+}  // namespace xe
+
+#endif  // XENIA_VFS_STREAM_PREFETCHER_H_